@@ -1,13 +1,42 @@
 #include "dht11.h"
+#include "time.h"
+#include "swtimer.h"
+#include "evq.h"
+
+//DHT11ȡ
+//ʼź:,ʱDHT11_START_MSͷ,ڼѭճ
+//:ͷǰPG11½ж,жֻ¼TIM61usʱ;
+//ÿһλ50us͵ƽ26~28us(0)70us(1)ߵƽ,½صļһλĳ
+//ͷDHT11_WAIT_MSѭ벢У,¼(EV_DHT11)
+//ʧʱDHT11_BACKOFF_MS,2,4ļ,űʧ
+
+#define DHT11_IDLE		0
+#define DHT11_BUSY		1		//Եȴ
+
+static volatile u16 dht11_edge[DHT11_EDGES];	//½ʱ
+static volatile u8 dht11_edges;					//Ѽ¼½
+static _swtimer dht11_timer;
+static u8 dht11_state=DHT11_IDLE;
+static u8 dht11_retry;
+static u8 dht11_buf[5];			//һγɹ
+static u8 dht11_valid=0;
+static u32 dht11_time;			//һγɹʱ(ms)
+
+u32 dht11_errors=0;
+
+static void DHT11_Release(void);
+static void DHT11_Finish(void);
 
 
 //DHT11ʼ 
-//0ʼɹ1ʧ
+//0ʼɹ
 u8 DHT11_Init()
 {
 	GPIO_InitTypeDef GPIO_InitStructure;
+	EXTI_InitTypeDef EXTI_InitStructure;
+	NVIC_InitTypeDef NVIC_InitStructure;
 
-	RCC_APB2PeriphClockCmd(RCC_APB2Periph_GPIOG,ENABLE);
+	RCC_APB2PeriphClockCmd(RCC_APB2Periph_GPIOG|RCC_APB2Periph_AFIO,ENABLE);
 
 	GPIO_InitStructure.GPIO_Pin=DHT11;
 	GPIO_InitStructure.GPIO_Mode=GPIO_Mode_Out_PP;
@@ -15,101 +44,127 @@ u8 DHT11_Init()
 	GPIO_Init(GPIO_DHT11,&GPIO_InitStructure);
 	GPIO_SetBits(GPIO_DHT11,DHT11);	   //
 
-	DHT11_Rst();	  
-	return DHT11_Check();	
+	TIM6_Init();
+
+	GPIO_EXTILineConfig(GPIO_PortSourceGPIOG,GPIO_PinSource11);
+	EXTI_InitStructure.EXTI_Line=EXTI_Line11;
+	EXTI_InitStructure.EXTI_Mode=EXTI_Mode_Interrupt;
+	EXTI_InitStructure.EXTI_Trigger=EXTI_Trigger_Falling;
+	EXTI_InitStructure.EXTI_LineCmd=DISABLE;		//ʱŴ
+	EXTI_Init(&EXTI_InitStructure);
+
+	NVIC_InitStructure.NVIC_IRQChannel=EXTI15_10_IRQn;
+	NVIC_InitStructure.NVIC_IRQChannelPreemptionPriority=0;	//ʱҪ׼,ӳٻֱλ
+	NVIC_InitStructure.NVIC_IRQChannelSubPriority=1;
+	NVIC_InitStructure.NVIC_IRQChannelCmd=ENABLE;
+	NVIC_Init(&NVIC_InitStructure);
+
+	dht11_state=DHT11_IDLE;
+	return 0;
+}
+
+//򿪻رPG11½ж
+static void DHT11_EXTI(FunctionalState state)
+{
+	EXTI_ClearITPendingBit(EXTI_Line11);
+	if(state==ENABLE)EXTI->IMR|=EXTI_Line11;
+	else EXTI->IMR&=~EXTI_Line11;
 }
 
-//λDHT11
-void DHT11_Rst()	   
-{                 
+//ʼź
+static void DHT11_Begin(void)
+{
 	DHT11_IO_OUT(); 	//SET OUTPUT
-    DHT11_DQ_OUT=0; 	//DQ
-    delay_ms(20);    	//18ms
-    DHT11_DQ_OUT=1; 	//DQ=1 
-	delay_us(30);     	//20~40us
+	DHT11_DQ_OUT=0; 	//DQ
+	SwTimer_Start(&dht11_timer,DHT11_START_MS,0,DHT11_Release);
 }
 
-//ȴDHT11ĻӦ
-//1:δ⵽DHT11Ĵ
-//0:
-u8 DHT11_Check() 	   
-{   
-	u8 retry=0;
-	DHT11_IO_IN();//SET INPUT	 
-    while (DHT11_DQ_IN&&retry<100)//DHT1140~50us
-	{
-		retry++;
-		delay_us(1);
-	};	 
-	if(retry>=100)return 1;
-	else retry=0;
-    while (!DHT11_DQ_IN&&retry<100)//DHT11ͺٴ40~50us
+//ʼźŽ,ʼ¼½
+static void DHT11_Release(void)
+{
+	dht11_edges=0;
+	DHT11_EXTI(ENABLE);	//ȿжͷ,DHT1120~40usӦ
+	DHT11_IO_IN();		//,
+	SwTimer_Start(&dht11_timer,DHT11_WAIT_MS,0,DHT11_Finish);
+}
+
+//һ֡
+//edge:½ʱ(us,16λ)
+//n:½
+//buf:5ֽ:ʪ,ʪС,¶,¶С,У
+//ֵ:DHT11_OK
+u8 DHT11_Decode(const u16 *edge,u8 n,u8 *buf)
+{
+	u8 i;
+	u16 d;
+
+	if(n<DHT11_EDGES)return DHT11_ERR_NORESP;
+	d=edge[1]-edge[0];		//Ӧ80usͼ80us
+	if(d<120||d>200)return DHT11_ERR_TIMING;
+	for(i=0;i<40;i++)
 	{
-		retry++;
-		delay_us(1);
-	};
-	if(retry>=100)return 1;	    
-	return 0;
+		d=edge[i+2]-edge[i+1];
+		if(d<40||d>170)return DHT11_ERR_TIMING;
+		buf[i>>3]<<=1;
+		if(d>DHT11_BIT1_US)buf[i>>3]|=1;
+	}
+	if((u8)(buf[0]+buf[1]+buf[2]+buf[3])!=buf[4])return DHT11_ERR_SUM;
+	return DHT11_OK;
 }
 
-//DHT11ȡһλ
-//ֵ1/0
-u8 DHT11_Read_Bit(void) 			 
+//һ֡,벢,ʧʱ˱
+static void DHT11_Finish(void)
 {
- 	u8 retry=0;
-	while(DHT11_DQ_IN&&retry<100)//ȴΪ͵ƽ 12-14us ʼ
+	u16 edge[DHT11_EDGES];
+	u8 buf[5],n,i,ret;
+
+	DHT11_EXTI(DISABLE);
+	n=dht11_edges;
+	for(i=0;i<n;i++)edge[i]=dht11_edge[i];
+	ret=DHT11_Decode(edge,n,buf);
+	if(ret==DHT11_OK)
 	{
-		retry++;
-		delay_us(1);
+		for(i=0;i<5;i++)dht11_buf[i]=buf[i];
+		dht11_valid=1;
+		dht11_time=SysTick_Ms();
+		dht11_state=DHT11_IDLE;
+		EvQ_Post(EV_DHT11,((u32)DHT11_OK<<16)|((u32)buf[2]<<8)|buf[0]);
+		return;
 	}
-	retry=0;
-	while(!DHT11_DQ_IN&&retry<100)//ȴߵƽ	 26-28usʾ0,116-118usʾ1
+	dht11_errors++;
+	if(dht11_retry<DHT11_RETRY_MAX)
 	{
-		retry++;
-		delay_us(1);
+		SwTimer_Start(&dht11_timer,(u32)DHT11_BACKOFF_MS<<dht11_retry,0,DHT11_Begin);
+		dht11_retry++;
+		return;
 	}
-	delay_us(40);//ȴ40us
-	if(DHT11_DQ_IN)return 1;
-	else return 0;		   
+	dht11_state=DHT11_IDLE;
+	EvQ_Post(EV_DHT11,(u32)ret<<16);
 }
 
-//DHT11ȡһֽ
-//ֵ
-u8 DHT11_Read_Byte(void)    
-{        
-    u8 i,dat;
-    dat=0;
-	for (i=0;i<8;i++) 
-	{
-   		dat<<=1; 
-	    dat|=DHT11_Read_Bit();
-    }						    
-    return dat;
+//ʼһβ,EV_DHT11¼
+//ֵ:1,ѿʼ;0,һβû
+u8 DHT11_Start(void)
+{
+	if(dht11_state!=DHT11_IDLE)return 0;
+	dht11_state=DHT11_BUSY;
+	dht11_retry=0;
+	DHT11_Begin();
+	return 1;
 }
 
-//DHT11ȡһ
+//һγɹĶ
 //temp:¶ֵ(Χ:0~50)
 //humi:ʪֵ(Χ:20%~90%)
-//ֵ0,;1,ȡʧ
-u8 DHT11_Read_Data(u8 *temp,u8 *humi)    
-{        
- 	u8 buf[5];
-	u8 i;
-	DHT11_Rst();
-	if(DHT11_Check()==0)
-	{
-		for(i=0;i<5;i++)//ȡ40λ
-		{
-			buf[i]=DHT11_Read_Byte();
-		}
-		if((buf[0]+buf[1]+buf[2]+buf[3])==buf[4])
-		{
-			*humi=buf[0];
-			*temp=buf[2];
-		}
-		
-	}else return 1;
-	return 0;	    
+//age:ڵĺ
+//ֵ:0,;1,ûгɹ
+u8 DHT11_Get(u8 *temp,u8 *humi,u32 *age)
+{
+	if(!dht11_valid)return 1;
+	*humi=dht11_buf[0];
+	*temp=dht11_buf[2];
+	*age=SysTick_Ms()-dht11_time;
+	return 0;
 }
 
 //DHT11ģʽ
@@ -131,7 +186,12 @@ void DHT11_IO_IN()
 	GPIO_Init(GPIO_DHT11,&GPIO_InitStructure);	
 }
 
-
-
-
-
+//PG11½,ֻ¼ʱ
+void EXTI15_10_IRQHandler(void)
+{
+	if(EXTI_GetITStatus(EXTI_Line11)!=RESET)
+	{
+		if(dht11_edges<DHT11_EDGES)dht11_edge[dht11_edges++]=TIM6_US();
+		EXTI_ClearITPendingBit(EXTI_Line11);
+	}
+}
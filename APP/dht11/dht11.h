@@ -11,14 +11,27 @@
 #define DHT11_DQ_IN PGin(11)	  //
 #define DHT11_DQ_OUT PGout(11)  //
 
+#define DHT11_START_MS		20		//ʼźʱ,18ms
+#define DHT11_WAIT_MS		10		//ͷߺȴһ֡ݵʱ,һ֡Լ4.5ms
+#define DHT11_EDGES			42		//һ֡½:Ӧ1,40λݸ1,1
+#define DHT11_BIT1_US		98		//½ؼֵΪ1(0Լ77us,1Լ120us,ȡе)
+#define DHT11_RETRY_MAX		3		//ʧܺԴ
+#define DHT11_BACKOFF_MS	1000	//һԵĵȴʱ,֮ÿμӱ
+
+//DHT11_Decodeķֵ,ҲEV_DHT11¼״̬
+#define DHT11_OK			0
+#define DHT11_ERR_NORESP	1		//ûӦݲȫ
+#define DHT11_ERR_TIMING	2		//ؼϷ
+#define DHT11_ERR_SUM		3		//Уʹ
+
+extern u32 dht11_errors;		//ʧܴ()
+
 void DHT11_IO_OUT(void);
 void DHT11_IO_IN(void);
 u8 DHT11_Init(void);
-void DHT11_Rst(void);
-u8 DHT11_Check(void);
-u8 DHT11_Read_Bit(void);
-u8 DHT11_Read_Byte(void);
-u8 DHT11_Read_Data(u8 *temp,u8 *humi);
+u8 DHT11_Start(void);				//ʼһβ,ڲԵȴз0
+u8 DHT11_Get(u8 *temp,u8 *humi,u32 *age);	//һγɹĶʱ(ms),ûж1
+u8 DHT11_Decode(const u16 *edge,u8 n,u8 *buf);	//½ʱ5ֽ
 
 
 #endif
@@ -1,8 +1,29 @@
 #include "hwjs.h"
 #include "SysTick.h"
+#include "time.h"
+#include "evq.h"
 
-u32 hw_jsm;	  //һ32λݱ
-u8  hw_jsbz;  //һ8λݵıָʾձ־
+//NEC
+//ͷ͵ƽЧ,ֻ½ж,жTIM61usȡ½صļ,
+//һ״̬:֮3232λ,1.125msΪ0,2.25msΪ1,
+//˳Ӹλ(ԭĺ붨һ);뻻11.25msظ,ʾס
+//ÿжֻмָ,İ¼:һ֡ΪEV_IR,ظΪEV_IR_REP
+
+#define HW_IDLE		0		//ȴ
+#define HW_LEAD		1		//յһ½,һ뻹ظ
+#define HW_DATA		2		//32λ
+
+u32 hw_frames=0;
+u32 hw_repeats=0;
+u32 hw_errors=0;
+
+static u8 hw_state=HW_IDLE;
+static u8 hw_bits;			//ѽյλ
+static u32 hw_code;			//ڽյİ
+static u32 hw_last;			//һ֡İ,ظʱ
+static u32 hw_last_ms;		//һ֡ظʱ
+static u16 hw_prev_us;		//һ½صʱ
+static u32 hw_prev_ms;
 
 
 /*******************************************************************************
@@ -23,6 +44,8 @@ void Hwjs_Init()
 	GPIO_InitStructure.GPIO_Pin=GPIO_Pin_9;//
 	GPIO_InitStructure.GPIO_Mode=GPIO_Mode_IPU;
 	GPIO_Init(GPIOB,&GPIO_InitStructure);
+
+	TIM6_Init();	//½ʱ
 	
 	GPIO_EXTILineConfig(GPIO_PortSourceGPIOB, GPIO_PinSource9); //ѡGPIOܽⲿж·
 	EXTI_ClearITPendingBit(EXTI_Line9);
@@ -36,76 +59,79 @@ void Hwjs_Init()
 
 	/* NVIC */
 	NVIC_InitStructure.NVIC_IRQChannel = EXTI9_5_IRQn;   //ȫж
-	NVIC_InitStructure.NVIC_IRQChannelPreemptionPriority = 0; //ռȼΪ0
-	NVIC_InitStructure.NVIC_IRQChannelSubPriority = 1; 	 //ӦȼΪ1
+	NVIC_InitStructure.NVIC_IRQChannelPreemptionPriority = 1; //жϺܶ,Ҫȼ
+	NVIC_InitStructure.NVIC_IRQChannelSubPriority = 0;
 	NVIC_InitStructure.NVIC_IRQChannelCmd = ENABLE;   //ʹ
 	NVIC_Init(&NVIC_InitStructure);
 
+	hw_state=HW_IDLE;
 }
 
 
 /*******************************************************************************
-*            : HW_jssj
-* 		   : ߵƽʱ䣬¼ʱ䱣tзأһδԼ20us 
-*              : 
-*              : t
+*            : HW_Edge
+* 		   : һ½,һ½صļƽ״̬
+*              : us:TIM6ʱ
+					 ms:SysTick,жTIM6֮ĳ
+*              : 
 *******************************************************************************/
-u8 HW_jssj()
+static void HW_Edge(u16 us,u32 ms)
 {
-	u8 t=0;
-	while(GPIO_ReadInputDataBit(GPIOB,GPIO_Pin_9)==1)//ߵƽ
+	u16 d=us-hw_prev_us;
+
+	if(ms-hw_prev_ms>HW_GAP_MS)d=0xFFFF;	//̫,ʱ
+	hw_prev_us=us;
+	hw_prev_ms=ms;
+
+	switch(hw_state)
 	{
-		t++;
-		delay_us(20);
-		if(t>=250) return t;//ʱ
+	case HW_IDLE:
+		hw_state=HW_LEAD;
+		break;
+	case HW_LEAD:
+		if(d>=HW_LEAD_MIN&&d<HW_LEAD_MAX)
+		{
+			hw_state=HW_DATA;
+			hw_bits=0;
+			hw_code=0;
+		}
+		else if(d>=HW_REP_MIN&&d<HW_REP_MAX)
+		{
+			if(hw_last&&ms-hw_last_ms<=HW_REPEAT_MS)
+			{
+				hw_last_ms=ms;
+				hw_repeats++;
+				EvQ_Post(EV_IR_REP,hw_last);
+			}
+			hw_state=HW_IDLE;
+		}
+		//:½ؿµ,HW_LEAD
+		break;
+	case HW_DATA:
+		if(d<HW_BIT_MIN||d>=HW_BIT_MAX)	//λ,½صµ
+		{
+			hw_errors++;
+			hw_state=HW_LEAD;
+			break;
+		}
+		hw_code<<=1;
+		if(d>=HW_BIT1_MIN)hw_code|=1;
+		if(++hw_bits<32)break;
+		hw_last=hw_code;
+		hw_last_ms=ms;
+		hw_frames++;
+		EvQ_Post(EV_IR,hw_code);
+		hw_state=HW_IDLE;
+		break;
 	}
-	return t;
 }
 
 
 void EXTI9_5_IRQHandler(void)	  //ңⲿж
 {
-	u8 Tim=0,Ok=0,Data,Num=0;
-
-   while(1)
-   {
-	   	if(GPIO_ReadInputDataBit(GPIOB,GPIO_Pin_9)==1)
-		{
-			 Tim=HW_jssj();//ô˴θߵƽʱ
-
-			 if(Tim>=250) break;//õź
-
-			 if(Tim>=200 && Tim<250)
-			 {
-			 	Ok=1;//յʼź
-			 }
-			 else if(Tim>=60 && Tim<90)
-			 {
-			 	Data=1;//յ 1
-			 }
-			 else if(Tim>=10 && Tim<50)
-			 {
-			 	Data=0;//յ 0
-			 }
-
-			 if(Ok==1)
-			 {
-			 	hw_jsm<<=1;
-				hw_jsm+=Data;
-
-				if(Num>=32)
-				{
-					hw_jsbz=1;
-				  	break;
-				}
-			 }
-
-			 Num++;
-		}
-   }
-
-   EXTI_ClearITPendingBit(EXTI_Line9);	
+	if(EXTI_GetITStatus(EXTI_Line9)!=RESET)
+	{
+		HW_Edge(TIM6_US(),SysTick_Ms());
+		EXTI_ClearITPendingBit(EXTI_Line9);
+	}
 }
-
-
-
@@ -4,13 +4,23 @@
 #include "system.h"
 
 
+//NEC,½ؼ(us)ķΧ
+#define HW_LEAD_MIN		12500	//:9ms+4.5ms,13.5ms
+#define HW_LEAD_MAX		15000
+#define HW_REP_MIN		10000	//ظ:9ms+2.25ms,11.25ms
+#define HW_REP_MAX		12500
+#define HW_BIT_MIN		800		//0:1.125ms
+#define HW_BIT1_MIN		1600	//1:2.25ms
+#define HW_BIT_MAX		2800
+#define HW_GAP_MS		60		//½ʱһͬһ֡,TIM6ѻ
+#define HW_REPEAT_MS	150		//ظһ֡һظ벻ʱЧ
+
 
 void Hwjs_Init(void);
-u8 HW_jssj(void);
 
 //ȫֱ
-extern u32 hw_jsm;
-extern u8  hw_jsbz;
-extern u8  frame_cnt;
+extern u32 hw_frames;		//յ֡
+extern u32 hw_repeats;		//յظ
+extern u32 hw_errors;		//֮󲻺Ϸļ
 
 #endif
@@ -1,5 +1,19 @@
 #include "key.h"
-#include "SysTick.h"
+#include "time.h"
+#include "evq.h"
+
+//
+//ĸκαضⲿж,жֻTIM41msж,
+//Key_Tickÿ1msһа,ÿһּ:ʱ1,ɿʱ1,
+//ӵKEY_DEB_MS㰴,0ɿ,ڼ,¼
+//аɿҼΪ0ʱصTIM4,ûаʱռCPU,ҲӰ˯
+//¼¼(EV_KEY),ͬʱʱԲ¼
+
+static u8 key_cnt[KEY_NUM];		//ּ
+static u16 key_hold[KEY_NUM];	//ºĺ,ÿظȥKEY_REPEAT_MS
+static u8 key_state=0;			//İ״̬
+static u8 key_on=0;				//1:TIM4
+
 
 /*******************************************************************************
 *            : KEY_Init
@@ -10,7 +24,10 @@
 void KEY_Init(void)
 {
 	GPIO_InitTypeDef GPIO_InitStructure; //ṹ	
-	RCC_APB2PeriphClockCmd(RCC_APB2Periph_GPIOA|RCC_APB2Periph_GPIOE,ENABLE);
+	EXTI_InitTypeDef EXTI_InitStructure;
+	NVIC_InitTypeDef NVIC_InitStructure;
+	
+	RCC_APB2PeriphClockCmd(RCC_APB2Periph_GPIOA|RCC_APB2Periph_GPIOE|RCC_APB2Periph_AFIO,ENABLE);
 	
 	GPIO_InitStructure.GPIO_Pin=KEY_UP_PIN;	   //ѡҪõIO
 	GPIO_InitStructure.GPIO_Mode=GPIO_Mode_IPD;//  
@@ -19,40 +36,142 @@ void KEY_Init(void)
 	GPIO_InitStructure.GPIO_Pin=KEY0_PIN|KEY1_PIN|KEY2_PIN;
 	GPIO_InitStructure.GPIO_Mode=GPIO_Mode_IPU;	//
 	GPIO_Init(KEY_PORT,&GPIO_InitStructure);
+	
+	GPIO_EXTILineConfig(GPIO_PortSourceGPIOA,GPIO_PinSource0);
+	GPIO_EXTILineConfig(GPIO_PortSourceGPIOE,GPIO_PinSource2);
+	GPIO_EXTILineConfig(GPIO_PortSourceGPIOE,GPIO_PinSource3);
+	GPIO_EXTILineConfig(GPIO_PortSourceGPIOE,GPIO_PinSource4);
+	EXTI_ClearITPendingBit(EXTI_Line0|EXTI_Line2|EXTI_Line3|EXTI_Line4);
+	
+	/* ºɿ,ҲܰCPUֹͣģʽ */
+	EXTI_InitStructure.EXTI_Line=EXTI_Line0|EXTI_Line2|EXTI_Line3|EXTI_Line4;
+	EXTI_InitStructure.EXTI_Mode=EXTI_Mode_Interrupt;
+	EXTI_InitStructure.EXTI_Trigger=EXTI_Trigger_Rising_Falling;
+	EXTI_InitStructure.EXTI_LineCmd=ENABLE;
+	EXTI_Init(&EXTI_InitStructure);
+	
+	/* TIM4ͬһռȼ,,TIM4رպ´򿪲ͻ */
+	NVIC_InitStructure.NVIC_IRQChannelPreemptionPriority=0;
+	NVIC_InitStructure.NVIC_IRQChannelSubPriority=3;
+	NVIC_InitStructure.NVIC_IRQChannelCmd=ENABLE;
+	NVIC_InitStructure.NVIC_IRQChannel=EXTI0_IRQn;
+	NVIC_Init(&NVIC_InitStructure);
+	NVIC_InitStructure.NVIC_IRQChannel=EXTI2_IRQn;
+	NVIC_Init(&NVIC_InitStructure);
+	NVIC_InitStructure.NVIC_IRQChannel=EXTI3_IRQn;
+	NVIC_Init(&NVIC_InitStructure);
+	NVIC_InitStructure.NVIC_IRQChannel=EXTI4_IRQn;
+	NVIC_Init(&NVIC_InitStructure);
+	
+	key_on=1;
+	TIM4_Init(1000-1,72-1);	//1ms,һ,ϵʱѰסİҲܼ⵽
+}
+
+//ֵ:ǰİƽ,Ϊ1,nλΪֵn+1
+static u8 Key_Raw(void)
+{
+	u8 raw=0;
+	
+	if(KEY_UP==1)raw|=1<<(KEY_UP_PRESS-1);
+	if(KEY0==0)raw|=1<<(KEY0_PRESS-1);
+	if(KEY1==0)raw|=1<<(KEY1_PRESS-1);
+	if(KEY2==0)raw|=1<<(KEY2_PRESS-1);
+	return raw;
+}
+
+//,TIM4ûʱ
+static void Key_Edge(void)
+{
+	if(key_on)return;
+	key_on=1;
+	TIM_SetCounter(TIM4,0);
+	TIM_Cmd(TIM4,ENABLE);
 }
 
 /*******************************************************************************
-*            : KEY_Scan
-* 		   : ɨ
-*              : mode=0:ΰ°
-					 mode=1°
-*              : 0δа
-					 KEY_UP_PRESSKEY_UP
-					 KEY0_PRESSKEY0
-					 KEY1_PRESSKEY1
-					 KEY2_PRESSKEY2
+*            : Key_Tick
+* 		   : 1ms,TIM4же
+*              : 
+*              : 
 *******************************************************************************/
-u8 KEY_Scan(u8 mode)
+void Key_Tick(void)
 {
-	static u8 key=1;
+	u8 raw=Key_Raw();
+	u8 i,bit,busy=0;
 	
-	if(mode==1) //
-		key=1;
-	if(key==1&&(KEY_UP==1||KEY0==0||KEY1==0||KEY2==0)) //һ
+	for(i=0;i<KEY_NUM;i++)
+	{
+		bit=1<<i;
+		if(raw&bit)
+		{
+			if(key_cnt[i]<KEY_DEB_MS)key_cnt[i]++;
+		}
+		else if(key_cnt[i])
+			key_cnt[i]--;
+		
+		if(key_state&bit)
+		{
+			if(key_cnt[i]==0)
+			{
+				key_state&=~bit;
+				EvQ_Post(EV_KEY,(KEY_EV_RELEASE<<8)|(i+1));
+			}
+			else if(++key_hold[i]==KEY_LONG_MS)
+				EvQ_Post(EV_KEY,(KEY_EV_LONG<<8)|(i+1));
+			else if(key_hold[i]==KEY_LONG_MS+KEY_REPEAT_MS)
+			{
+				key_hold[i]=KEY_LONG_MS;
+				EvQ_Post(EV_KEY,(KEY_EV_REPEAT<<8)|(i+1));
+			}
+		}
+		else if(key_cnt[i]==KEY_DEB_MS)
+		{
+			key_state|=bit;
+			key_hold[i]=0;
+			EvQ_Post(EV_KEY,(KEY_EV_PRESS<<8)|(i+1));
+		}
+		if(key_cnt[i])busy=1;
+	}
+	if(!busy)		//ɿ,һ
 	{
-		delay_ms(10);  //
-		key=0;
-		if(KEY_UP==1)
-			return KEY_UP_PRESS; 
-		else if(KEY0==0)
-			return KEY0_PRESS; 
-		else if(KEY1==0)
-			return KEY1_PRESS; 
-		else if(KEY2==0)
-			return KEY2_PRESS; 
+		key_on=0;
+		TIM_Cmd(TIM4,DISABLE);
 	}
-	else if(KEY_UP==0&&KEY0==1&&KEY1==1&&KEY2==1)    //ް
-		key=1;
-	return 0;
+}
+
+//ֵ:µİ,nλΪֵn+1
+u8 Key_State(void)
+{
+	return key_state;
+}
+
+//ֵ:1:а»,TIM4
+u8 Key_Busy(void)
+{
+	return key_on;
+}
+
+void EXTI0_IRQHandler(void)
+{
+	EXTI_ClearITPendingBit(EXTI_Line0);
+	Key_Edge();
+}
+
+void EXTI2_IRQHandler(void)
+{
+	EXTI_ClearITPendingBit(EXTI_Line2);
+	Key_Edge();
+}
+
+void EXTI3_IRQHandler(void)
+{
+	EXTI_ClearITPendingBit(EXTI_Line3);
+	Key_Edge();
+}
+
+void EXTI4_IRQHandler(void)
+{
+	EXTI_ClearITPendingBit(EXTI_Line4);
+	Key_Edge();
 }
 
@@ -23,8 +23,23 @@
 #define KEY0_PRESS		2
 #define KEY1_PRESS		3
 #define KEY2_PRESS		4
+#define KEY_NUM			4
+
+//¼,EV_KEYargΪ ¼<<8|ֵ
+#define KEY_EV_PRESS	1		//
+#define KEY_EV_RELEASE	2		//ɿ
+#define KEY_EV_LONG		3		//סKEY_LONG_MS,ֻһ
+#define KEY_EV_REPEAT	4		//֮ÿKEY_REPEAT_MSһ
+#define KEY_EVENT(arg)	(((arg)>>8)&0xFF)
+#define KEY_CODE(arg)	((arg)&0xFF)
+
+#define KEY_DEB_MS		8		//,ƽȶôŸı䰴״̬
+#define KEY_LONG_MS		1000
+#define KEY_REPEAT_MS	200
  
 void KEY_Init(void);
-u8 KEY_Scan(u8 mode);
+void Key_Tick(void);	//TIM4жÿ1msһ
+u8 Key_State(void);		//µİ,nλΪֵn+1
+u8 Key_Busy(void);		//1:а»
 
 #endif
@@ -0,0 +1,126 @@
+#include "ldet.h"
+
+//取药动作检测
+//每输入一个光敏值O(1)更新:基准均值和方差用指数加权(EWMA)的Welford递推,全部是整数运算;
+//偏离基准超过max(LDET_MIN_DELTA,K_HI倍标准差)且连续LDET_ONSET_N个输入,确认一次动作,
+//回到K_LO倍标准差以内连续LDET_RELEASE_N个输入才结束,高低两个阈值形成滞回;
+//动作期间基准冻结,不会把取药时的光照学进基准
+//两次事件的间隔按输入的时间戳判断,不用延时;偏离持续太久认为环境光变了,以当前值重建基准
+
+
+//清除统计,重新学习基准
+void Ldet_Init(_ldet *d)
+{
+	d->mean=0;
+	d->var=0;
+	d->n=0;
+	d->state=LDET_IDLE;
+	d->cnt=0;
+	d->t_start=0;
+	d->t_event=0;
+	d->delta=0;
+	d->events=0;
+}
+
+//更新基准,Welford递推的指数加权形式:
+//mean+=diff/2^k; var=(1-1/2^k)*(var+diff*diff/2^k)
+static void Ldet_Learn(_ldet *d,s32 x)
+{
+	s32 diff=x-d->mean;
+	u32 sq;
+
+	d->mean+=diff>>LDET_SHIFT;
+	sq=(u32)(diff<0?-diff:diff);
+	sq=sq*sq>>LDET_SHIFT;			//|diff|<2^16,平方不溢出
+	d->var+=sq;
+	d->var-=d->var>>LDET_SHIFT;
+}
+
+//|diff|是否超过k倍标准差和最小偏离min,diff和min都带LDET_FRAC位小数
+static u8 Ldet_Over(_ldet *d,s32 diff,u8 k,s32 min)
+{
+	u32 a=(u32)(diff<0?-diff:diff);
+
+	if(a<=(u32)min)return 0;
+	return a*a/((u32)k*k)>d->var;		//a<2^16,平方不溢出
+}
+
+//输入一个光敏ADC值
+//x:ADC值,0~4095,越大越暗
+//t:采样时间(ms)
+//返回值:1,确认了一次取药动作,偏离在d->delta;0,没有
+u8 Ldet_Update(_ldet *d,u16 x,u32 t)
+{
+	s32 v=(s32)x<<LDET_FRAC;
+	s32 diff;
+
+	if(d->n<LDET_WARMUP)			//学习基准
+	{
+		if(d->n==0)d->mean=v;
+		d->n++;
+		Ldet_Learn(d,v);
+		return 0;
+	}
+
+	diff=v-d->mean;
+	switch(d->state)
+	{
+	case LDET_IDLE:
+		if(Ldet_Over(d,diff,LDET_K_HI,LDET_MIN_DELTA<<LDET_FRAC))
+		{
+			d->state=LDET_ONSET;
+			d->cnt=1;
+			d->t_start=t;
+		}
+		else Ldet_Learn(d,v);
+		break;
+	case LDET_ONSET:
+		if(!Ldet_Over(d,diff,LDET_K_HI,LDET_MIN_DELTA<<LDET_FRAC))	//只是毛刺
+		{
+			d->state=LDET_IDLE;
+			Ldet_Learn(d,v);
+			break;
+		}
+		if(++d->cnt<LDET_ONSET_N)break;
+		d->state=LDET_ACTIVE;
+		d->cnt=0;
+		if(d->events&&t-d->t_event<LDET_HOLD_MS)break;	//离上一次事件太近,算同一次动作
+		d->t_event=t;
+		d->delta=diff>>LDET_FRAC;
+		d->events++;
+		return 1;
+	case LDET_ACTIVE:
+		if(Ldet_Over(d,diff,LDET_K_LO,(LDET_MIN_DELTA/2)<<LDET_FRAC))
+		{
+			d->cnt=0;
+			if(t-d->t_start>=LDET_STUCK_MS)	//环境光变了,从当前值重新学习
+			{
+				d->mean=v;
+				d->state=LDET_IDLE;
+			}
+			break;
+		}
+		if(++d->cnt>=LDET_RELEASE_N)d->state=LDET_IDLE;
+		break;
+	}
+	return 0;
+}
+
+//返回值:基准标准差(ADC值),整数开方
+u16 Ldet_Sigma(_ldet *d)
+{
+	u32 v=d->var,r=0,b=(u32)1<<30;
+
+	while(b>v)b>>=2;
+	while(b)
+	{
+		if(v>=r+b)
+		{
+			v-=r+b;
+			r=(r>>1)+b;
+		}
+		else r>>=1;
+		b>>=2;
+	}
+	return (u16)(r>>LDET_FRAC);
+}
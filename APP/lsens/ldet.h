@@ -0,0 +1,41 @@
+#ifndef _ldet_H
+#define _ldet_H
+
+#include "system.h"
+
+
+//取药动作检测参数,输入为光敏ADC值(0~4095),统计量用4位小数的定点数
+#define LDET_FRAC		4		//均值的小数位数
+#define LDET_SHIFT		6		//EWMA系数1/64,20Hz输入时时间常数约3.2s
+#define LDET_WARMUP		32		//上电后只学习基准、不检测的输入个数
+#define LDET_MIN_DELTA	200		//触发所需的最小偏离(ADC值),约5%光照
+#define LDET_K_HI		4		//偏离超过K_HI倍标准差开始计入触发
+#define LDET_K_LO		2		//偏离回到K_LO倍标准差以内算恢复
+#define LDET_ONSET_N	2		//连续超过阈值的输入个数,确认一次动作
+#define LDET_RELEASE_N	4		//连续恢复的输入个数,结束一次动作
+#define LDET_HOLD_MS	1000	//两次动作事件的最小间隔
+#define LDET_STUCK_MS	10000	//偏离持续超过该时间认为环境光变了,重新建立基准
+
+//检测状态
+#define LDET_IDLE		0		//跟踪基准
+#define LDET_ONSET		1		//超过阈值,等待确认
+#define LDET_ACTIVE		2		//动作进行中,基准冻结
+
+typedef struct
+{
+	s32 mean;			//基准均值,ADC值<<LDET_FRAC
+	u32 var;			//基准方差,(ADC值<<LDET_FRAC)^2
+	u16 n;				//已输入个数,到LDET_WARMUP为止
+	u8 state;
+	u8 cnt;				//ONSET/ACTIVE状态下连续满足条件的个数
+	u32 t_start;		//本次偏离开始时间(ms)
+	u32 t_event;		//上一次动作事件时间(ms)
+	s32 delta;			//本次动作的偏离(ADC值),正为变暗
+	u32 events;			//动作事件数
+}_ldet;
+
+void Ldet_Init(_ldet *d);
+u8 Ldet_Update(_ldet *d,u16 x,u32 t);	//输入一个ADC值和它的时间(ms),确认一次动作时返回1
+u16 Ldet_Sigma(_ldet *d);				//基准标准差(ADC值)
+
+#endif
@@ -1,71 +1,170 @@
-#include "lsens.h"
-#include "SysTick.h"
-
-//ʼ
-void Lsens_Init(void)
-{
-	GPIO_InitTypeDef GPIO_InitStructure;
-	ADC_InitTypeDef ADC_InitStructure; 
-	
-	RCC_APB2PeriphClockCmd(RCC_APB2Periph_GPIOF,ENABLE);//ʹPORTFʱ	
-	RCC_APB2PeriphClockCmd(RCC_APB2Periph_ADC3	, ENABLE );	  //ʹADC3ͨʱ
-	RCC_APB2PeriphResetCmd(RCC_APB2Periph_ADC3,ENABLE);//ADCλ	
-	RCC_APB2PeriphResetCmd(RCC_APB2Periph_ADC3,DISABLE);//λ
-	
-	GPIO_InitStructure.GPIO_Pin = GPIO_Pin_8;//PF8 anolog
-	GPIO_InitStructure.GPIO_Mode = GPIO_Mode_AIN;		//ģ
-	GPIO_Init(GPIOF, &GPIO_InitStructure);	
-	
-	ADC_DeInit(ADC3);  //λADC3, ADC3ȫĴΪȱʡֵ
-
-	ADC_InitStructure.ADC_Mode = ADC_Mode_Independent;	//ADCģʽ: ģʽ
-	ADC_InitStructure.ADC_ScanConvMode = DISABLE;	//ģתڵͨģʽ
-	ADC_InitStructure.ADC_ContinuousConvMode = DISABLE;	//ģתڵתģʽ
-	ADC_InitStructure.ADC_ExternalTrigConv = ADC_ExternalTrigConv_None;	//תⲿ
-	ADC_InitStructure.ADC_DataAlign = ADC_DataAlign_Right;	//ADCҶ
-	ADC_InitStructure.ADC_NbrOfChannel = 1;	//˳йתADCͨĿ
-	ADC_Init(ADC3, &ADC_InitStructure);	//ADC_InitStructָĲʼADCxļĴ  
-
-	ADC_Cmd(ADC3, ENABLE);	//ʹָADC3
-	
-	ADC_ResetCalibration(ADC3);	//ʹܸλУ׼  
-	 
-	while(ADC_GetResetCalibrationStatus(ADC3));	//ȴλУ׼
-	
-	ADC_StartCalibration(ADC3);	 //ADУ׼
- 
-	while(ADC_GetCalibrationStatus(ADC3));	 //ȴУ׼
-}
-
-//ADC3ĳֵͨ
-//ch:ֵͨ 0~16
-//ֵ:ת
-u16 Get_ADC3(u8 ch)   
-{
-	//ָADCĹͨһУʱ
-	ADC_RegularChannelConfig(ADC3, ch, 1, ADC_SampleTime_239Cycles5 );	//ADC3,ADCͨ,ʱΪ239.5	  			    
-  
-	ADC_SoftwareStartConvCmd(ADC3, ENABLE);		//ʹָADC3ת	
-	 
-	while(!ADC_GetFlagStatus(ADC3, ADC_FLAG_EOC ));//ȴת
-
-	return ADC_GetConversionValue(ADC3);	//һADC3ת
-} 
-
-#define LSENS_READ_TIMES	10	//ȡ,ô,Ȼȡƽֵ
-
-//ȡLight Sensֵ
-//0~100:0,;100, 
-u8 Lsens_Get_Val(void)
-{
-	u32 temp_val=0;
-	u8 t;
-	for(t=0;t<LSENS_READ_TIMES;t++)
-	{
-		temp_val+=Get_ADC3(ADC_Channel_6);	//ȡADCֵ
-		delay_ms(5);
-	}
-	temp_val/=LSENS_READ_TIMES;//õƽֵ 
-	if(temp_val>4000)temp_val=4000;
-	return (u8)(100-(temp_val/40));
-}
+#include "lsens.h"
+#include "SysTick.h"
+
+//
+//TIM8¼(TRGO)ʴADC3ͨ6ת,DMA2ͨ5ѽѭд뻷λ,
+//ֳǰ,DMAдһ(봫/ж)ʱCPUһƽ,õһȡ,
+//DMAͬʱдһ.ȡֵֻȡ,ٵȴת
+//ȡͬʱһС,ѭLsens_Read˳ȡ,ȡҩ
+
+static u16 lsens_dma[LSENS_DEC_MAX*2];	//DMAλ
+static u8 lsens_dec=LSENS_DEC;			//ǰȡ,Ĳ
+static u16 lsens_ring[LSENS_RING];		//ȡ
+static u32 lsens_rd=0;					//һҪȡ
+
+volatile u16 lsens_raw=0;
+volatile u32 lsens_seq=0;
+u32 lsens_lost=0;
+
+
+//ʼ
+void Lsens_Init(void)
+{
+	GPIO_InitTypeDef GPIO_InitStructure;
+	ADC_InitTypeDef ADC_InitStructure; 
+	NVIC_InitTypeDef NVIC_InitStructure;
+	
+	RCC_APB2PeriphClockCmd(RCC_APB2Periph_GPIOF,ENABLE);//ʹPORTFʱ	
+	RCC_APB2PeriphClockCmd(RCC_APB2Periph_ADC3	, ENABLE );	  //ʹADC3ͨʱ
+	RCC_APB2PeriphClockCmd(RCC_APB2Periph_TIM8,ENABLE);	//TIM8ADC3
+	RCC_AHBPeriphClockCmd(RCC_AHBPeriph_DMA2,ENABLE);	//DMA2ͨ5̶ӦADC3
+	RCC_ADCCLKConfig(RCC_PCLK2_Div6);	//ADCʱ72M/6=12M,ܳ14M
+	RCC_APB2PeriphResetCmd(RCC_APB2Periph_ADC3,ENABLE);//ADCλ	
+	RCC_APB2PeriphResetCmd(RCC_APB2Periph_ADC3,DISABLE);//λ
+	
+	GPIO_InitStructure.GPIO_Pin = GPIO_Pin_8;//PF8 anolog
+	GPIO_InitStructure.GPIO_Mode = GPIO_Mode_AIN;		//ģ
+	GPIO_Init(GPIOF, &GPIO_InitStructure);	
+	
+	ADC_DeInit(ADC3);  //λADC3, ADC3ȫĴΪȱʡֵ
+
+	ADC_InitStructure.ADC_Mode = ADC_Mode_Independent;	//ADCģʽ: ģʽ
+	ADC_InitStructure.ADC_ScanConvMode = DISABLE;	//ģתڵͨģʽ
+	ADC_InitStructure.ADC_ContinuousConvMode = DISABLE;	//ÿδתһ
+	ADC_InitStructure.ADC_ExternalTrigConv = ADC_ExternalTrigConv_T8_TRGO;	//TIM8¼
+	ADC_InitStructure.ADC_DataAlign = ADC_DataAlign_Right;	//ADCҶ
+	ADC_InitStructure.ADC_NbrOfChannel = 1;	//˳йתADCͨĿ
+	ADC_Init(ADC3, &ADC_InitStructure);	//ADC_InitStructָĲʼADCxļĴ  
+	ADC_RegularChannelConfig(ADC3, ADC_Channel_6, 1, ADC_SampleTime_239Cycles5 );	//ͨ6,ʱΪ239.5
+	ADC_DMACmd(ADC3, ENABLE);	//תDMAȡ
+	ADC_ExternalTrigConvCmd(ADC3, ENABLE);
+
+	ADC_Cmd(ADC3, ENABLE);	//ʹָADC3
+	
+	ADC_ResetCalibration(ADC3);	//ʹܸλУ׼  
+	 
+	while(ADC_GetResetCalibrationStatus(ADC3));	//ȴλУ׼
+	
+	ADC_StartCalibration(ADC3);	 //ADУ׼
+ 
+	while(ADC_GetCalibrationStatus(ADC3));	 //ȴУ׼
+
+	NVIC_InitStructure.NVIC_IRQChannel=DMA2_Channel4_5_IRQn;
+	NVIC_InitStructure.NVIC_IRQChannelPreemptionPriority=2;
+	NVIC_InitStructure.NVIC_IRQChannelSubPriority=1;
+	NVIC_InitStructure.NVIC_IRQChannelCmd=ENABLE;
+	NVIC_Init(&NVIC_InitStructure);
+
+	Lsens_Config(LSENS_RATE_HZ,LSENS_DEC);
+	while(lsens_seq==0);	//ȵһ,֮ĶЧֵ
+	lsens_rd=lsens_seq;
+}
+
+//òʺͳȡ,¿ʼ
+//hz:,16~LSENS_RATE_MAX
+//dec:ȡ,1~LSENS_DEC_MAX,Ϊhz/dec
+void Lsens_Config(u16 hz,u8 dec)
+{
+	TIM_TimeBaseInitTypeDef TIM_TimeBaseInitStructure;
+	DMA_InitTypeDef DMA_InitStructure;
+
+	if(hz<16)hz=16;
+	if(hz>LSENS_RATE_MAX)hz=LSENS_RATE_MAX;
+	if(dec==0)dec=1;
+	if(dec>LSENS_DEC_MAX)dec=LSENS_DEC_MAX;
+
+	TIM_Cmd(TIM8,DISABLE);
+	DMA_Cmd(DMA2_Channel5,DISABLE);
+	lsens_dec=dec;
+
+	DMA_InitStructure.DMA_PeripheralBaseAddr=(u32)(uintptr_t)&ADC3->DR;
+	DMA_InitStructure.DMA_MemoryBaseAddr=(u32)(uintptr_t)lsens_dma;
+	DMA_InitStructure.DMA_DIR=DMA_DIR_PeripheralSRC;
+	DMA_InitStructure.DMA_BufferSize=(u16)dec*2;
+	DMA_InitStructure.DMA_PeripheralInc=DMA_PeripheralInc_Disable;
+	DMA_InitStructure.DMA_MemoryInc=DMA_MemoryInc_Enable;
+	DMA_InitStructure.DMA_PeripheralDataSize=DMA_PeripheralDataSize_HalfWord;
+	DMA_InitStructure.DMA_MemoryDataSize=DMA_MemoryDataSize_HalfWord;
+	DMA_InitStructure.DMA_Mode=DMA_Mode_Circular;		//дĩβصͷ
+	DMA_InitStructure.DMA_Priority=DMA_Priority_Medium;
+	DMA_InitStructure.DMA_M2M=DMA_M2M_Disable;
+	DMA_Init(DMA2_Channel5,&DMA_InitStructure);
+	DMA_ClearITPendingBit(DMA2_IT_GL5);
+	DMA_ITConfig(DMA2_Channel5,DMA_IT_HT|DMA_IT_TC,ENABLE);
+	DMA_Cmd(DMA2_Channel5,ENABLE);
+
+	TIM_TimeBaseInitStructure.TIM_Period=1000000/hz-1;	//1us
+	TIM_TimeBaseInitStructure.TIM_Prescaler=72-1;
+	TIM_TimeBaseInitStructure.TIM_ClockDivision=TIM_CKD_DIV1;
+	TIM_TimeBaseInitStructure.TIM_CounterMode=TIM_CounterMode_Up;
+	TIM_TimeBaseInitStructure.TIM_RepetitionCounter=0;
+	TIM_TimeBaseInit(TIM8,&TIM_TimeBaseInitStructure);
+	TIM_SelectOutputTrigger(TIM8,TIM_TRGOSource_Update);	//ÿθ´һת
+	TIM_Cmd(TIM8,ENABLE);
+}
+
+//DMAд,ƽΪһȡ
+static void Lsens_Block(const u16 *p)
+{
+	u32 sum=0,seq;
+	u8 i;
+
+	for(i=0;i<lsens_dec;i++)sum+=p[i];
+	seq=lsens_seq;
+	lsens_raw=sum/lsens_dec;
+	lsens_ring[seq&(LSENS_RING-1)]=lsens_raw;
+	lsens_seq=seq+1;
+}
+
+//DMA2ͨ45õж,ͨ4ûʹ
+void DMA2_Channel4_5_IRQHandler(void)
+{
+	if(DMA_GetITStatus(DMA2_IT_HT5))	//ǰһд
+	{
+		DMA_ClearITPendingBit(DMA2_IT_HT5);
+		Lsens_Block(lsens_dma);
+	}
+	if(DMA_GetITStatus(DMA2_IT_TC5))	//һд
+	{
+		DMA_ClearITPendingBit(DMA2_IT_TC5);
+		Lsens_Block(lsens_dma+lsens_dec);
+	}
+}
+
+//ȡһµĳȡ
+//raw:ADCֵ
+//ֵ:1,ȡһ;0,ûµ
+u8 Lsens_Read(u16 *raw)
+{
+	u32 seq=lsens_seq;
+
+	if(seq==lsens_rd)return 0;
+	if(seq-lsens_rd>LSENS_RING-2)		//ѱ,;һȡڼждһ
+	{
+		lsens_lost+=seq-lsens_rd-(LSENS_RING-2);
+		lsens_rd=seq-(LSENS_RING-2);
+	}
+	*raw=lsens_ring[lsens_rd&(LSENS_RING-1)];
+	lsens_rd++;
+	return 1;
+}
+
+//ȡLight Sensֵ,һȡ,ȴ
+//0~100:0,;100, 
+u8 Lsens_Get_Val(void)
+{
+	u32 temp_val=lsens_raw;
+
+	if(temp_val>4000)temp_val=4000;
+	return (u8)(100-(temp_val/40));
+}
@@ -1,10 +1,22 @@
-#ifndef _lsens_H
-#define _lsens_H
-
-
-#include "system.h"  
-
-
-void Lsens_Init(void); 				//ʼ
-u8 Lsens_Get_Val(void);				//ȡֵ
-#endif 
+#ifndef _lsens_H
+#define _lsens_H
+
+
+#include "system.h"  
+
+
+#define LSENS_RATE_HZ		1000	//Ĭϲ
+#define LSENS_RATE_MAX		20000	//߲,ADCʱ12MHz,239.5ڲʱһת21us
+#define LSENS_DEC			50		//Ĭϳȡ,ÿ50ƽΪһ,1kHzʱÿ50msһ
+#define LSENS_DEC_MAX		128		//ȡ,DMAλΪ2
+#define LSENS_RING			16		//ȡĻ,2
+
+extern volatile u16 lsens_raw;		//һȡ(ADCֵ0~4095)
+extern volatile u32 lsens_seq;		//ȡĸ
+extern u32 lsens_lost;				//ѭȡʧĳȡ
+
+void Lsens_Init(void); 				//ʼ
+void Lsens_Config(u16 hz,u8 dec);	//òʺͳȡ
+u8 Lsens_Get_Val(void);				//ȡֵ
+u8 Lsens_Read(u16 *raw);			//ȡһµĳȡ,ûʱ0
+#endif
@@ -1,6 +1,7 @@
 #include "rtc.h" 
 #include "SysTick.h"
 #include "usart.h"
+#include "evq.h"
 		    
 
 	   
@@ -72,6 +73,7 @@ void RTC_IRQHandler(void)
 	if (RTC_GetITStatus(RTC_IT_SEC) != RESET)//ж
 	{							
 		RTC_Get();//ʱ  
+		EvQ_Post(EV_RTC_SEC,((u32)calendar.hour<<16)|((u32)calendar.min<<8)|calendar.sec);
 		printf("RTC Time:%d-%d-%d %d:%d:%d\r\n",calendar.w_year,calendar.w_month,calendar.w_date,calendar.hour,calendar.min,calendar.sec);//ʱ	
 				
  	}
@@ -0,0 +1,113 @@
+#include "evq.h"
+#include "SysTick.h"
+
+//中断到主循环的事件队列
+//各中断调用EvQ_Post放入事件,主循环调用EvQ_Get按放入顺序取出,中断和主循环都不需要关中断
+//每个格子带一个序号:序号等于写位置表示空闲,等于写位置+1表示已写好可以读取
+//写位置用LDREX/STREX原子地加1,抢到位置后再写数据,最后更新序号发布事件;
+//写数据时被更高优先级的中断打断,高优先级中断会抢到下一个位置,互不影响,
+//主循环优先级最低,能运行时所有已抢到位置的中断都已写完
+
+typedef struct
+{
+	volatile u32 seq;
+	_event ev;
+}_evq_cell;
+
+static _evq_cell evq_cell[EVQ_SIZE];
+static volatile u32 evq_head;		//下一个写位置,多个中断共用
+static u32 evq_tail;				//下一个读位置,只有主循环使用
+
+u32 evq_dropped=0;
+u8 evq_peak=0;
+
+
+#if defined(__CC_ARM)
+#define EVQ_DMB()		__dmb(0xF)
+//*p从old改为new,返回1表示成功,0表示*p已不是old
+static u8 EvQ_CAS(volatile u32 *p,u32 old,u32 val)
+{
+	if(__ldrex(p)!=old)
+	{
+		__clrex();
+		return 0;
+	}
+	return __strex(val,p)==0;
+}
+#else
+#define EVQ_DMB()		__sync_synchronize()
+static u8 EvQ_CAS(volatile u32 *p,u32 old,u32 val)
+{
+	return __sync_bool_compare_and_swap(p,old,val);
+}
+#endif
+
+
+void EvQ_Init(void)
+{
+	u8 i;
+
+	for(i=0;i<EVQ_SIZE;i++)evq_cell[i].seq=i;
+	evq_head=0;
+	evq_tail=0;
+	evq_dropped=0;
+	evq_peak=0;
+}
+
+//放入事件
+//type:事件类型
+//arg:事件参数
+//返回值:1,成功;0,队列满,事件丢弃并计数
+u8 EvQ_Post(u8 type,u32 arg)
+{
+	_evq_cell *c;
+	u32 pos,n;
+	s32 dif;
+
+	while(1)
+	{
+		pos=evq_head;
+		c=&evq_cell[pos&(EVQ_SIZE-1)];
+		dif=(s32)(c->seq-pos);
+		if(dif==0)
+		{
+			if(EvQ_CAS(&evq_head,pos,pos+1))break;	//抢到这个位置
+		}
+		else if(dif<0)	//主循环还没取走一圈前的事件
+		{
+			do n=evq_dropped;
+			while(!EvQ_CAS((volatile u32 *)&evq_dropped,n,n+1));
+			return 0;
+		}
+	}
+	c->ev.type=type;
+	c->ev.arg=arg;
+	c->ev.time=SysTick_Us();
+	EVQ_DMB();
+	c->seq=pos+1;		//发布
+	return 1;
+}
+
+//取出最早的事件
+//返回值:1,取到事件;0,队列空
+u8 EvQ_Get(_event *ev)
+{
+	_evq_cell *c=&evq_cell[evq_tail&(EVQ_SIZE-1)];
+	u32 n;
+
+	if(c->seq!=evq_tail+1)return 0;
+	n=evq_head-evq_tail;
+	if(n>evq_peak)evq_peak=n;
+	EVQ_DMB();
+	*ev=c->ev;
+	EVQ_DMB();
+	c->seq=evq_tail+EVQ_SIZE;	//格子留给下一圈
+	evq_tail++;
+	return 1;
+}
+
+//返回值:1,有事件等待取出
+u8 EvQ_Pending(void)
+{
+	return evq_cell[evq_tail&(EVQ_SIZE-1)].seq==evq_tail+1;
+}
@@ -0,0 +1,35 @@
+#ifndef _evq_H
+#define _evq_H
+
+#include "system.h"
+
+
+#define EVQ_SIZE		32		//队列长度,必须是2的幂
+
+//事件类型
+#define EV_NONE			0
+#define EV_IR			1		//红外遥控一帧,arg为32位红外码
+#define EV_BT_FRAME		2		//串口3(蓝牙)收到一帧,arg为数据长度
+#define EV_RTC_SEC		3		//RTC秒中断,arg为时<<16|分<<8|秒
+#define EV_KEY			4		//按键事件,arg为事件<<8|按键值,见key.h
+#define EV_ADC			5		//光敏检测到取药动作,arg为偏离基准的ADC值
+#define EV_DHT11		6		//DHT11测量结束,arg为状态<<16|温度<<8|湿度
+#define EV_IR_REP		7		//红外重复码(按键按住不放),arg为按住的红外码
+
+
+typedef struct
+{
+	u8 type;			//事件类型
+	u32 arg;			//事件参数
+	u32 time;			//产生时间(us),SysTick_Us()
+}_event;
+
+extern u32 evq_dropped;		//队列满时丢弃的事件数
+extern u8 evq_peak;			//取事件时见到的最大积压数
+
+void EvQ_Init(void);
+u8 EvQ_Post(u8 type,u32 arg);	//中断或主循环中调用,返回0表示队列满
+u8 EvQ_Get(_event *ev);			//只在主循环中调用,返回0表示队列空
+u8 EvQ_Pending(void);			//有事件等待取出时返回1
+
+#endif
@@ -0,0 +1,131 @@
+#include "power.h"
+#include "SysTick.h"
+#include "sched.h"
+#include "swtimer.h"
+#include "stdio.h"
+
+//低功耗
+//睡眠模式:调度器没有到期任务时调用Power_Idle,SysTick改成在下一个任务到期时才中断,
+//CPU执行WFI停在睡眠模式,任何中断都会唤醒
+//停止模式:Power_Stop关掉所有高速时钟,由RTC闹钟(EXTI17)或其他EXTI中断唤醒,
+//醒来后重新配置72MHz时钟,按RTC计数器和分频器算出停止的时间补到SysTick时基上
+//停止期间SysTick、USART、ADC都不工作,由应用用Power_StopUntil决定什么时候可以进入,
+//真正进入要等调度器空闲:没有到期任务、定时器和未处理的事件
+
+u32 power_sleep_us=0;
+u32 power_stop_ms=0;
+u32 power_stop_cnt=0;
+static u32 power_start_ms=0;	//统计开始时间
+static u32 power_alarm=0;		//请求的停止模式唤醒时间(RTC计数值),0为没有请求
+
+
+//配置RTC闹钟中断,用来从停止模式唤醒
+void Power_Init(void)
+{
+	EXTI_InitTypeDef EXTI_InitStructure;
+	NVIC_InitTypeDef NVIC_InitStructure;
+
+	RCC_APB1PeriphClockCmd(RCC_APB1Periph_PWR|RCC_APB1Periph_BKP,ENABLE);
+
+	EXTI_ClearITPendingBit(EXTI_Line17);	//RTC闹钟连接到EXTI17
+	EXTI_InitStructure.EXTI_Line=EXTI_Line17;
+	EXTI_InitStructure.EXTI_Mode=EXTI_Mode_Interrupt;
+	EXTI_InitStructure.EXTI_Trigger=EXTI_Trigger_Rising;
+	EXTI_InitStructure.EXTI_LineCmd=ENABLE;
+	EXTI_Init(&EXTI_InitStructure);
+
+	NVIC_InitStructure.NVIC_IRQChannel=RTCAlarm_IRQn;
+	NVIC_InitStructure.NVIC_IRQChannelPreemptionPriority=0;	//比RTC全局中断先清除闹钟标志
+	NVIC_InitStructure.NVIC_IRQChannelSubPriority=0;
+	NVIC_InitStructure.NVIC_IRQChannelCmd=ENABLE;
+	NVIC_Init(&NVIC_InitStructure);
+
+	RTC_WaitForLastTask();
+	RTC_ITConfig(RTC_IT_ALR,ENABLE);
+	RTC_WaitForLastTask();
+	power_start_ms=SysTick_Ms();
+}
+
+//RTC闹钟中断,只用来唤醒
+void RTCAlarm_IRQHandler(void)
+{
+	if(RTC_GetITStatus(RTC_IT_ALR)!=RESET)
+	{
+		RTC_ClearITPendingBit(RTC_IT_ALR);
+		RTC_WaitForLastTask();
+	}
+	EXTI_ClearITPendingBit(EXTI_Line17);
+}
+
+//空闲睡眠,在关中断时调用
+//ms:距下一个任务到期的毫秒数
+void Power_Idle(u32 ms)
+{
+	u32 alarm=power_alarm;
+
+	power_alarm=0;
+	if(alarm&&SwTimer_Next()==0xFFFFFFFF&&Power_Stop(alarm))	//停止期间软件定时器不走,有定时器在运行时只睡眠
+	{
+		Sched_Resync();			//停止期间没有任务运行,从现在重新计时
+		return;
+	}
+	power_sleep_us+=SysTick_Sleep(ms);
+}
+
+//请求进入停止模式,调度器下次空闲时进入,只生效一次
+//alarm:唤醒时的RTC计数值(秒)
+void Power_StopUntil(u32 alarm)
+{
+	power_alarm=alarm;
+}
+
+//进入停止模式,在关中断时调用
+//alarm:唤醒时的RTC计数值(秒),RTC计数器从alarm-1变为alarm时闹钟标志置位
+//返回值:停止的毫秒数,0表示alarm已到,没有进入停止模式
+u32 Power_Stop(u32 alarm)
+{
+	u32 cnt0,div0,cnt1,div1,ms;
+
+	RTC_WaitForSynchro();
+	cnt0=RTC_GetCounter();
+	div0=RTC_GetDivider();
+	if((s32)(alarm-cnt0)<=0)return 0;
+
+	RTC_WaitForLastTask();
+	RTC_SetAlarm(alarm-1);			//计数器到达ALR后的下一秒开始时置位闹钟标志
+	RTC_WaitForLastTask();
+	RTC_ClearFlag(RTC_FLAG_ALR);
+	EXTI_ClearITPendingBit(EXTI_Line17);
+
+	SysTick->CTRL&=~SysTick_CTRL_ENABLE_Msk;
+	PWR_EnterSTOPMode(PWR_Regulator_LowPower,PWR_STOPEntry_WFI);
+	SystemInit();					//醒来后是HSI 8MHz,重新配置HSE和PLL到72MHz
+
+	RTC_WaitForSynchro();
+	cnt1=RTC_GetCounter();
+	div1=RTC_GetDivider();
+	ms=(cnt1-cnt0)*1000+(s32)(div0-div1)*1000/POWER_RTC_HZ;	//分频器向下计数
+	SysTick_Resume(ms);
+	power_stop_ms+=ms;
+	power_stop_cnt++;
+	return ms;
+}
+
+//串口1打印上次打印以来运行、睡眠、停止的时间比例,之后清零
+void Power_Report(void)
+{
+	u32 now=SysTick_Ms();
+	u32 total=now-power_start_ms;
+	u32 sleep=power_sleep_us/1000;
+	u32 run;
+
+	if(total==0)return;
+	run=total>sleep+power_stop_ms?total-sleep-power_stop_ms:0;
+	printf("power %lums: run %lu%%, sleep %lu%%, stop %lu%% (%lu)\r\n",(unsigned long)total,
+		(unsigned long)(run*100ULL/total),(unsigned long)(sleep*100ULL/total),
+		(unsigned long)(power_stop_ms*100ULL/total),(unsigned long)power_stop_cnt);
+	power_sleep_us=0;
+	power_stop_ms=0;
+	power_stop_cnt=0;
+	power_start_ms=now;
+}
@@ -0,0 +1,20 @@
+#ifndef _power_H
+#define _power_H
+
+#include "system.h"
+
+
+#define POWER_RTC_HZ		32768	//RTC计数时钟,RTC_Init中预分频为32767
+
+
+extern u32 power_sleep_us;		//睡眠模式(WFI)累计时间
+extern u32 power_stop_ms;		//停止模式累计时间
+extern u32 power_stop_cnt;		//进入停止模式的次数
+
+void Power_Init(void);
+void Power_Idle(u32 ms);		//关中断后调用,tickless睡眠最多ms毫秒,有停止请求时进入停止模式
+void Power_StopUntil(u32 alarm);	//请求下次空闲时进入停止模式,直到RTC计数器到alarm
+u32 Power_Stop(u32 alarm);		//关中断后调用,停止模式直到RTC计数器到alarm或外部中断,返回停止的毫秒数
+void Power_Report(void);		//串口1打印运行/睡眠/停止时间并清零
+
+#endif
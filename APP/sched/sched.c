@@ -0,0 +1,176 @@
+#include "sched.h"
+#include "SysTick.h"
+#include "swtimer.h"
+#include "evq.h"
+#include "stdio.h"
+
+//协作式任务调度
+//各任务以自己的周期注册,时间基准为SysTick的1ms计数,
+//主循环每次从到期的任务中选下次到期时间最早的一个运行,任务运行完才会轮到下一个,
+//所以任务里不能有长时间的阻塞延时
+//到期时间按周期累加,偶尔运行晚了不会让之后的周期整体后移;
+//落后超过一个周期时直接从当前时间重新计算,不补跑错过的次数
+//周期为0的任务是轮询任务,主循环每一轮都运行,用来处理中断事件这类随时可能到来的工作
+//软件定时器也在主循环每一轮处理
+//没有到期任务时计算到最近一个任务或定时器到期的毫秒数,交给SCHED_IDLE()睡眠,并统计空闲时间
+
+static _sched_task sched_task[SCHED_MAX_TASKS];
+static u8 sched_num=0;
+
+u32 sched_idle_us=0;
+u32 sched_start_us=0;
+
+
+//添加任务
+//name:任务名,用于统计输出
+//fn:任务函数
+//period:周期(ms),0为轮询任务
+//offset:第一次运行距现在的毫秒数,用来把周期相同的任务错开
+//deadline:到期后允许的最大延迟(ms)
+//返回值:任务号,0xFF表示任务已满
+u8 Sched_Add(const char *name,void (*fn)(void),u16 period,u16 offset,u16 deadline)
+{
+	_sched_task *t;
+
+	if(sched_num>=SCHED_MAX_TASKS)return 0xFF;
+	t=&sched_task[sched_num];
+	t->name=name;
+	t->fn=fn;
+	t->period=period;
+	t->deadline=deadline;
+	t->next=SysTick_Ms()+offset;
+	t->runs=0;
+	t->misses=0;
+	t->max_late=0;
+	t->max_us=0;
+	t->total_us=0;
+	return sched_num++;
+}
+
+//任务下次在ms毫秒后运行,任务中调用可以临时改变下次运行时间
+void Sched_Delay(u8 id,u16 ms)
+{
+	if(id<sched_num)sched_task[id].next=SysTick_Ms()+ms;
+}
+
+//运行任务并统计运行时间
+static void Sched_Exec(_sched_task *t)
+{
+	u32 t0,us;
+
+	t0=SysTick_Us();
+	t->fn();
+	us=SysTick_Us()-t0;
+	t->runs++;
+	t->total_us+=us;
+	if(us>t->max_us)t->max_us=us;
+}
+
+//运行一个到期任务
+//返回值:1,运行了一个任务;0,没有到期任务
+u8 Sched_Run(void)
+{
+	u8 i,best=0xFF;
+	u32 now=SysTick_Ms();
+	u32 late;
+	_sched_task *t;
+
+	for(i=0;i<sched_num;i++)	//到期任务中下次到期时间最早的一个
+	{
+		if(sched_task[i].period==0)continue;
+		if((s32)(now-sched_task[i].next)<0)continue;
+		if(best==0xFF||(s32)(sched_task[i].next-sched_task[best].next)<0)best=i;
+	}
+	if(best==0xFF)return 0;
+
+	t=&sched_task[best];
+	late=now-t->next;
+	if(late>t->max_late)t->max_late=late>0xFFFF?0xFFFF:late;
+	if(late>t->deadline)t->misses++;
+	t->next+=t->period;
+	if((s32)(now-t->next)>=0)t->next=now+t->period;	//落后超过一个周期
+	Sched_Exec(t);
+	return 1;
+}
+
+//运行所有轮询任务
+void Sched_Poll(void)
+{
+	u8 i;
+
+	for(i=0;i<sched_num;i++)
+		if(sched_task[i].period==0)Sched_Exec(&sched_task[i]);
+}
+
+//返回值:距最近一个任务或软件定时器到期的毫秒数,0表示已有任务到期
+u32 Sched_NextDue(void)
+{
+	u8 i;
+	u32 now=SysTick_Ms();
+	u32 ms=SwTimer_Next();
+	s32 d;
+
+	for(i=0;i<sched_num&&ms;i++)
+	{
+		if(sched_task[i].period==0)continue;
+		d=(s32)(sched_task[i].next-now);
+		if(d<=0)return 0;
+		if((u32)d<ms)ms=d;
+	}
+	return ms;
+}
+
+//所有周期任务从现在开始重新计时,STOP模式醒来后调用,停止期间错过的运行不计入超时
+void Sched_Resync(void)
+{
+	u8 i;
+	u32 now=SysTick_Ms();
+
+	for(i=0;i<sched_num;i++)sched_task[i].next=now;
+}
+
+//调度主循环,不返回
+void Sched_Loop(void)
+{
+	u32 t0;
+
+	sched_start_us=SysTick_Us();
+	while(1)
+	{
+		SwTimer_Poll();
+		Sched_Poll();
+		if(Sched_Run())continue;
+		t0=SysTick_Us();
+		SCHED_LOCK();
+		if(!EvQ_Pending())		//关中断后再检查一次,检查之后到来的事件会让SCHED_IDLE立即返回
+			SCHED_IDLE(Sched_NextDue());
+		SCHED_UNLOCK();
+		sched_idle_us+=SysTick_Us()-t0;
+	}
+}
+
+//串口1打印各任务统计和空闲率,之后清零重新统计
+void Sched_Report(void)
+{
+	u8 i;
+	u32 now=SysTick_Us();
+	u32 total=now-sched_start_us;
+	_sched_task *t;
+
+	printf("task        runs  miss late(ms) max(us) avg(us)\r\n");
+	for(i=0;i<sched_num;i++)
+	{
+		t=&sched_task[i];
+		printf("%-10s %5lu %5lu %8u %7lu %7lu\r\n",t->name,(unsigned long)t->runs,(unsigned long)t->misses,
+			t->max_late,(unsigned long)t->max_us,(unsigned long)(t->runs?t->total_us/t->runs:0));
+		t->runs=0;
+		t->misses=0;
+		t->max_late=0;
+		t->max_us=0;
+		t->total_us=0;
+	}
+	if(total)printf("idle %lu.%lu%%\r\n",(unsigned long)(sched_idle_us*100ULL/total),
+		(unsigned long)(sched_idle_us*1000ULL/total%10));
+	sched_idle_us=0;
+	sched_start_us=now;
+}
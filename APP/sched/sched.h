@@ -0,0 +1,46 @@
+#ifndef _sched_H
+#define _sched_H
+
+#include "system.h"
+
+
+#define SCHED_MAX_TASKS		12		//最多任务数
+
+//空闲时执行,ms为距下一个任务到期的毫秒数,在关中断时调用
+#ifndef SCHED_IDLE
+#include "power.h"
+#define SCHED_IDLE(ms)		Power_Idle(ms)
+#endif
+#ifndef SCHED_LOCK
+#define SCHED_LOCK()		__disable_irq()
+#define SCHED_UNLOCK()		__enable_irq()
+#endif
+
+
+typedef struct
+{
+	const char *name;
+	void (*fn)(void);
+	u16 period;			//周期(ms)
+	u16 deadline;		//到期后允许的最大延迟(ms),超过记为一次超时
+	u32 next;			//下次到期时间(ms)
+	u32 runs;			//运行次数
+	u32 misses;			//超时次数
+	u16 max_late;		//最大延迟(ms)
+	u32 max_us;			//单次最长运行时间(us)
+	u32 total_us;		//累计运行时间(us)
+}_sched_task;
+
+extern u32 sched_idle_us;		//累计空闲时间(us)
+extern u32 sched_start_us;		//统计开始时间(us)
+
+u8 Sched_Add(const char *name,void (*fn)(void),u16 period,u16 offset,u16 deadline);	//添加任务,返回任务号
+void Sched_Delay(u8 id,u16 ms);			//任务下次在ms毫秒后运行
+u8 Sched_Run(void);						//运行一个到期任务,没有到期任务时返回0
+void Sched_Poll(void);					//运行所有轮询任务
+u32 Sched_NextDue(void);				//距最近一个任务或定时器到期的毫秒数
+void Sched_Resync(void);				//所有周期任务从现在开始重新计时
+void Sched_Loop(void);					//调度主循环,不返回
+void Sched_Report(void);				//串口1打印各任务统计并清零
+
+#endif
@@ -0,0 +1,171 @@
+#include "swtimer.h"
+#include "SysTick.h"
+
+//软件定时器,分层时间轮
+//定时器按到期时间距当前的远近放进不同的层:256ms内的放在第0层对应毫秒的格子,
+//更远的放在上层,每格覆盖下一层转一圈的时间;第0层每转完一圈,
+//把上层当前格里的定时器按剩余时间重新分到下层
+//启动和停止都是双向链表的插入删除,与定时器数量无关
+//SysTick中断只负责计数,到期回调在主循环调用SwTimer_Poll时执行,回调中可以启动和停止定时器
+
+static _swtimer *swt_l0[SWT_L0_SIZE];
+static _swtimer *swt_ln[SWT_LEVELS][SWT_LN_SIZE];
+static u32 swt_now;			//下一个要处理的毫秒
+static u8 swt_count;		//运行中的定时器数
+
+
+//把定时器链入格子
+static void SwTimer_Link(_swtimer **slot,_swtimer *t)
+{
+	t->next=*slot;
+	if(*slot)(*slot)->pprev=&t->next;
+	t->pprev=slot;
+	*slot=t;
+}
+
+//根据到期时间选择格子
+static _swtimer **SwTimer_Slot(u32 expire)
+{
+	u32 delta=expire-swt_now;
+	u8 lv,shift;
+
+	if((s32)delta<0)return &swt_l0[swt_now&(SWT_L0_SIZE-1)];	//已经过期,当前毫秒处理
+	if(delta<SWT_L0_SIZE)return &swt_l0[expire&(SWT_L0_SIZE-1)];
+	for(lv=0;lv<SWT_LEVELS-1;lv++)
+	{
+		shift=SWT_L0_BITS+(lv+1)*SWT_LN_BITS;
+		if(delta<((u32)1<<shift))break;
+	}
+	shift=SWT_L0_BITS+lv*SWT_LN_BITS;
+	return &swt_ln[lv][(expire>>shift)&(SWT_LN_SIZE-1)];
+}
+
+static void SwTimer_Add(_swtimer *t)
+{
+	_swtimer **slot=SwTimer_Slot(t->expire);
+
+	SwTimer_Link(slot,t);
+	t->active=1;
+	swt_count++;
+}
+
+//从链表中取下定时器
+static void SwTimer_Unlink(_swtimer *t)
+{
+	*t->pprev=t->next;
+	if(t->next)t->next->pprev=t->pprev;
+	t->next=0;
+	t->pprev=0;
+	t->active=0;
+	swt_count--;
+}
+
+//把上层一格里的定时器重新分到下层
+static void SwTimer_Cascade(u8 lv,u8 index)
+{
+	_swtimer *t=swt_ln[lv][index];
+	_swtimer *n;
+
+	swt_ln[lv][index]=0;
+	while(t)
+	{
+		n=t->next;
+		SwTimer_Link(SwTimer_Slot(t->expire),t);
+		t=n;
+	}
+}
+
+void SwTimer_Init(void)
+{
+	u16 i;
+	u8 lv;
+
+	for(i=0;i<SWT_L0_SIZE;i++)swt_l0[i]=0;
+	for(lv=0;lv<SWT_LEVELS;lv++)
+		for(i=0;i<SWT_LN_SIZE;i++)swt_ln[lv][i]=0;
+	swt_now=SysTick_Ms();
+	swt_count=0;
+}
+
+//启动定时器,定时器已在运行时重新开始计时
+//t:定时器,由调用者分配,运行期间不能释放
+//ms:距第一次到期的毫秒数
+//period:之后每次到期的间隔,0为单次定时器
+//fn:到期回调
+void SwTimer_Start(_swtimer *t,u32 ms,u32 period,void (*fn)(void))
+{
+	if(t->active)SwTimer_Unlink(t);
+	t->expire=SysTick_Ms()+ms;
+	t->period=period;
+	t->fn=fn;
+	SwTimer_Add(t);
+}
+
+void SwTimer_Stop(_swtimer *t)
+{
+	if(t->active)SwTimer_Unlink(t);
+}
+
+u8 SwTimer_Active(_swtimer *t)
+{
+	return t->active;
+}
+
+//处理到当前时间为止的所有到期定时器
+//返回值:调用的回调数
+u8 SwTimer_Poll(void)
+{
+	u32 now=SysTick_Ms();
+	u16 index;
+	u8 lv,shift,cnt=0;
+	_swtimer *t;
+
+	while((s32)(now-swt_now)>=0)
+	{
+		index=swt_now&(SWT_L0_SIZE-1);
+		if(index==0)	//第0层转完一圈,逐层向下分配
+		{
+			for(lv=0;lv<SWT_LEVELS;lv++)
+			{
+				shift=SWT_L0_BITS+lv*SWT_LN_BITS;
+				index=(swt_now>>shift)&(SWT_LN_SIZE-1);
+				SwTimer_Cascade(lv,index);
+				if(index)break;
+			}
+			index=0;
+		}
+		while((t=swt_l0[index])!=0)	//回调中新加入当前格的定时器也在这里处理
+		{
+			SwTimer_Unlink(t);
+			if(t->period)
+			{
+				t->expire+=t->period;
+				if((s32)(t->expire-now)<=0)t->expire=now+t->period;	//落后超过一个周期,不补调用
+				SwTimer_Add(t);
+			}
+			t->fn();
+			if(cnt<0xFF)cnt++;
+		}
+		swt_now++;
+	}
+	return cnt;
+}
+
+//返回值:距最近一个定时器到期的毫秒数,没有定时器时为0xFFFFFFFF
+//只查看第0层到这一圈结束,上层的定时器在第0层转完一圈时才分配下来,所以最多返回到那时为止;
+//下一个要处理的毫秒正好是新一圈的开始时,上层的定时器还没分配下来,也要在那时醒来
+u32 SwTimer_Next(void)
+{
+	u32 now=SysTick_Ms();
+	u32 t=swt_now;
+	u16 j;
+
+	if(swt_count==0)return 0xFFFFFFFF;
+	if((s32)(now-swt_now)>=0)return 0;	//还有没处理的毫秒
+	for(j=0;j<SWT_L0_SIZE;j++,t++)
+	{
+		if((t&(SWT_L0_SIZE-1))==0)break;
+		if(swt_l0[t&(SWT_L0_SIZE-1)])break;
+	}
+	return t-now;
+}
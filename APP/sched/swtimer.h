@@ -0,0 +1,32 @@
+#ifndef _swtimer_H
+#define _swtimer_H
+
+#include "system.h"
+
+
+//分层时间轮:第0层256格,每格1ms;第1~4层各64格,每格是下一层一圈的时间
+#define SWT_L0_BITS		8
+#define SWT_LN_BITS		6
+#define SWT_L0_SIZE		(1<<SWT_L0_BITS)
+#define SWT_LN_SIZE		(1<<SWT_LN_BITS)
+#define SWT_LEVELS		4		//第1层开始的层数,5层共覆盖32位毫秒
+
+
+typedef struct _swtimer
+{
+	struct _swtimer *next;
+	struct _swtimer **pprev;	//指向链表中前一个节点的next或格子表头
+	u32 expire;				//到期时间(ms)
+	u32 period;				//周期(ms),0表示单次定时器
+	void (*fn)(void);		//到期回调,在SwTimer_Poll中调用
+	u8 active;				//1:定时器在时间轮中
+}_swtimer;
+
+void SwTimer_Init(void);
+void SwTimer_Start(_swtimer *t,u32 ms,u32 period,void (*fn)(void));	//ms毫秒后到期,period非0时之后每period毫秒到期一次
+void SwTimer_Stop(_swtimer *t);
+u8 SwTimer_Active(_swtimer *t);
+u8 SwTimer_Poll(void);		//处理到当前时间为止的所有到期定时器,返回调用的回调数
+u32 SwTimer_Next(void);		//距最近一个定时器到期的毫秒数
+
+#endif
@@ -1,26 +1,17 @@
 #include "snake.h"
 #include "tftlcd.h"
+#include "lcd_image.h"
 #include "picture.h"
 #include "ascii.h"
 
 u8 key;
 
 
+//ʾpicͼƬ,picΪlcdimg.pyѹ
+//wide,high:,ȡͼƬͷ
 void LCD_ShowPictureEx(u16 x, u16 y, u16 wide, u16 high)
 {
-	u16 temp = 0;
-	long tmp=0,num=0;
-	LCD_Set_Window(x, y, x+wide-1, y+high-1);
-	num = wide * high*2 ;
-	do
-	{  
-		temp = pic[tmp + 1];
-		temp = temp << 8;
-		temp = temp | pic[tmp];
-		LCD_WriteData_Color(temp);//ʾ
-		tmp += 2;
-	}
-	while(tmp < num);	
+	LCD_ShowImage(x,y,pic);
 }
 
 //ָλ ʾ116*16ĺ
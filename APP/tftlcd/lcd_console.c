@@ -0,0 +1,209 @@
+#include "lcd_console.h"
+#include "tftlcd.h"
+#include "lcd_dlist.h"
+#include "string.h"
+#include "stdio.h"
+#include "stdarg.h"
+
+//滚动日志控制台
+//占用屏幕上整行宽度的一块区域,每行显示一条文字,写满后旧行向上滚出
+//竖屏且驱动支持硬件垂直滚动时,区域设为滚动区,新行直接画在最旧一行所在的GRAM行上,
+//再改一次滚动起始行,追加一行只需画一行文字和写一个寄存器
+//其他情况下追加一行后整个区域按新顺序重画
+//硬件滚动时GRAM中第k行文字固定画在区域内第k个行位置,屏幕上的顺序由滚动起始行决定,
+//因此其他绘图不能画在控制台区域内,离开所在界面时要调用LCD_Console_Detach恢复正常显示
+
+static char con_text[LCD_CONSOLE_LINES][LCD_CONSOLE_COLS+1];	//各行文字
+static u8 con_lines=0;		//区域内的行数,0表示未建立
+static u8 con_count=0;		//已有文字的行数
+static u8 con_top=0;		//屏幕上第一行对应的con_text下标
+static u8 con_cols;			//每行字符数
+static u8 con_col=0;		//当前行已写入的字符数,0表示下一个字符另起一行
+static u8 con_size;
+static u16 con_sy;
+static u16 con_fg,con_bg;
+static u8 con_hw=0;			//1:使用硬件滚动
+static u8 con_shown=0;		//1:控制台所在界面正在显示
+
+
+#ifdef LCD_PORT_VSCROLL
+//设置滚动起始行
+//row:显示在滚动区顶部的GRAM行
+static void Console_Scroll(u16 row)
+{
+#if LCD_DLIST
+	if(lcd_dl_rec)LCD_DL_Sync();	//先画出已记录的行
+#endif
+	LCD_WriteCmd(0x37);
+	LCD_WriteData(row>>8);
+	LCD_WriteData(row&0xff);
+}
+#endif
+
+//把第k行文字画在第slot个行位置上,行尾不足部分填背景色
+static void Console_Line(u8 k,u8 slot)
+{
+	u16 y=con_sy+slot*con_size;
+	u16 n=strlen(con_text[k]);
+	u16 fg=FRONT_COLOR,bg=BACK_COLOR;
+
+	if(n)
+	{
+		FRONT_COLOR=con_fg;
+		BACK_COLOR=con_bg;
+		LCD_ShowString(0,y,n*(con_size/2),con_size,con_size,(u8 *)con_text[k]);
+		FRONT_COLOR=fg;
+		BACK_COLOR=bg;
+	}
+	LCD_Fill(n*(con_size/2),y,tftlcd_data.width-1,y+con_size-1,con_bg);
+}
+
+//在第sy~ey行建立控制台,区域宽度为整屏宽,行数为区域高度能放下的整行数
+//sy,ey:区域起止行
+//size:字体大小
+//fg,bg:文字颜色和背景色
+void LCD_Console_Init(u16 sy,u16 ey,u8 size,u16 fg,u16 bg)
+{
+	u16 n=(ey-sy+1)/size;
+
+	if(n>LCD_CONSOLE_LINES)n=LCD_CONSOLE_LINES;
+	con_lines=n;
+	con_count=0;
+	con_top=0;
+	con_col=0;
+	con_cols=tftlcd_data.width/(size/2);
+	if(con_cols>LCD_CONSOLE_COLS)con_cols=LCD_CONSOLE_COLS;
+	con_size=size;
+	con_sy=sy;
+	con_fg=fg;
+	con_bg=bg;
+	memset(con_text,0,sizeof(con_text));
+#ifdef LCD_PORT_VSCROLL
+	con_hw=(tftlcd_data.dir==0);	//横屏时硬件滚动方向是水平的
+	if(con_hw)
+	{
+		LCD_WriteCmd(0x33);		//顶部固定区,滚动区,底部固定区的行数
+		LCD_WriteData(sy>>8);
+		LCD_WriteData(sy&0xff);
+		LCD_WriteData((n*size)>>8);
+		LCD_WriteData((n*size)&0xff);
+		LCD_WriteData((tftlcd_data.height-sy-n*size)>>8);
+		LCD_WriteData((tftlcd_data.height-sy-n*size)&0xff);
+		Console_Scroll(sy);
+	}
+#endif
+	con_shown=0;
+}
+
+//另起一行,写满时最旧的一行滚出,只改内容不画
+//scroll:写满时置1
+//返回值:新行的con_text下标
+static u8 Console_NewLine(u8 *scroll)
+{
+	u8 k;
+
+	if(con_count<con_lines)
+	{
+		k=(con_top+con_count)%con_lines;
+		con_count++;
+	}
+	else
+	{
+		k=con_top;		//最旧的一行
+		con_top=(con_top+1)%con_lines;
+		*scroll=1;
+	}
+	con_text[k][0]=0;
+	return k;
+}
+
+//显示第k行文字
+//scroll:1,之前有旧行滚出
+static void Console_Show(u8 k,u8 scroll)
+{
+	u8 i;
+
+	if(con_shown==0)return;
+	if(con_hw)
+	{
+		Console_Line(k,k);		//新行画在滚出的旧行位置上,再移动起始行
+#ifdef LCD_PORT_VSCROLL
+		if(scroll)Console_Scroll(con_sy+con_top*con_size);
+#endif
+	}
+	else if(scroll)
+	{
+		for(i=0;i<con_lines;i++)Console_Line((con_top+i)%con_lines,i);
+	}
+	else Console_Line(k,(k+con_lines-con_top)%con_lines);
+}
+
+//追加文字,遇到'\n'或写满一行时换行,'\r'和其他不能显示的字符被忽略
+//s:文字
+void LCD_Console_Puts(const char *s)
+{
+	u8 k=(con_top+con_count+con_lines-1)%con_lines;	//当前行
+	u8 dirty=0,scroll=0;
+
+	if(con_lines==0)return;
+	for(;*s;s++)
+	{
+		if(*s=='\n')
+		{
+			con_col=0;
+			continue;
+		}
+		if(*s<' '||*s>'~')continue;
+		if(con_col==0||con_col>=con_cols)
+		{
+			if(dirty)Console_Show(k,scroll);
+			dirty=0;
+			scroll=0;
+			k=Console_NewLine(&scroll);
+			con_col=0;
+		}
+		con_text[k][con_col++]=*s;
+		con_text[k][con_col]=0;
+		dirty=1;
+	}
+	if(dirty)Console_Show(k,scroll);
+}
+
+//格式化后追加,用法同printf
+void LCD_Console_Printf(const char *fmt,...)
+{
+	char buf[LCD_CONSOLE_BUF];
+	va_list ap;
+
+	va_start(ap,fmt);
+	vsnprintf(buf,sizeof buf,fmt,ap);	//超长截断
+	va_end(ap);
+	LCD_Console_Puts(buf);
+}
+
+//按当前内容重画控制台区域,在所在界面的绘制函数中调用
+//之后追加的文字会立即显示
+void LCD_Console_Paint(void)
+{
+	u8 i;
+
+	if(con_lines==0)return;
+	for(i=0;i<con_lines;i++)
+	{
+		if(con_hw)Console_Line(i,i);
+		else Console_Line((con_top+i)%con_lines,i);
+	}
+#ifdef LCD_PORT_VSCROLL
+	if(con_hw)Console_Scroll(con_sy+con_top*con_size);
+#endif
+	con_shown=1;
+}
+
+//离开控制台所在界面,恢复正常显示,之后追加的文字只保存不显示
+void LCD_Console_Detach(void)
+{
+#ifdef LCD_PORT_VSCROLL
+	if(con_hw&&con_shown)Console_Scroll(con_sy);
+#endif
+	con_shown=0;
+}
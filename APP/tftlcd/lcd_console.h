@@ -0,0 +1,18 @@
+#ifndef _lcd_console_H
+#define _lcd_console_H
+
+#include "system.h"
+
+
+#define LCD_CONSOLE_LINES	16		//最多显示的行数
+#define LCD_CONSOLE_COLS	40		//每行最多字符数
+#define LCD_CONSOLE_BUF		128		//LCD_Console_Printf格式化后的最大长度
+
+
+void LCD_Console_Init(u16 sy,u16 ey,u8 size,u16 fg,u16 bg);	//在第sy~ey行建立控制台
+void LCD_Console_Puts(const char *s);							//追加文字,'\n'或写满一行时换行
+void LCD_Console_Printf(const char *fmt,...);					//格式化后追加
+void LCD_Console_Paint(void);									//按当前内容重画控制台区域
+void LCD_Console_Detach(void);									//离开所在界面,恢复正常显示
+
+#endif
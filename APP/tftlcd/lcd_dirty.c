@@ -0,0 +1,150 @@
+#include "lcd_dirty.h"
+#include "tftlcd.h"
+#include "lcd_dlist.h"
+
+
+//脏矩形合成器
+//各界面把内容发生变化的区域登记为脏矩形,重叠的矩形会被合并,
+//主循环每轮调用一次LCD_Dirty_Flush,以每个脏矩形为裁剪区域调用界面的绘制函数,
+//这样只有变化的区域被写入GRAM,不必整屏清屏重绘
+
+static _lcd_rect dirty_rect[LCD_DIRTY_MAX];
+static u8 dirty_num=0;
+
+u32 lcd_dirty_pixels=0;
+
+
+//矩形面积
+static u32 Rect_Area(_lcd_rect *r)
+{
+	return (u32)(r->ex-r->sx+1)*(r->ey-r->sy+1);
+}
+
+//两个矩形合并后的外接矩形面积
+static u32 Rect_Union_Area(_lcd_rect *a,_lcd_rect *b)
+{
+	_lcd_rect u;
+	u.sx=a->sx<b->sx?a->sx:b->sx;
+	u.sy=a->sy<b->sy?a->sy:b->sy;
+	u.ex=a->ex>b->ex?a->ex:b->ex;
+	u.ey=a->ey>b->ey?a->ey:b->ey;
+	return Rect_Area(&u);
+}
+
+//把矩形b并入a
+static void Rect_Merge(_lcd_rect *a,_lcd_rect *b)
+{
+	if(b->sx<a->sx)a->sx=b->sx;
+	if(b->sy<a->sy)a->sy=b->sy;
+	if(b->ex>a->ex)a->ex=b->ex;
+	if(b->ey>a->ey)a->ey=b->ey;
+}
+
+//判断两个矩形是否应该合并
+//相交,或者合并后不比分开刷新多写像素(例如上下相邻等宽的两行文字)
+static u8 Rect_Should_Merge(_lcd_rect *a,_lcd_rect *b)
+{
+	if(a->sx<=b->ex&&b->sx<=a->ex&&a->sy<=b->ey&&b->sy<=a->ey)return 1;
+	return Rect_Union_Area(a,b)<=Rect_Area(a)+Rect_Area(b);
+}
+
+//初始化,清空所有脏矩形
+void LCD_Dirty_Init(void)
+{
+	dirty_num=0;
+	lcd_dirty_pixels=0;
+}
+
+//标记需要重绘的区域
+//(sx,sy),(ex,ey):矩形对角坐标
+void LCD_Dirty_Add(u16 sx,u16 sy,u16 ex,u16 ey)
+{
+	_lcd_rect r;
+	u8 i,best;
+	u32 grow,best_grow;
+
+	if(sx>ex||sy>ey)return;
+	if(ex>=tftlcd_data.width)ex=tftlcd_data.width-1;
+	if(ey>=tftlcd_data.height)ey=tftlcd_data.height-1;
+	if(sx>ex||sy>ey)return;
+	r.sx=sx;
+	r.sy=sy;
+	r.ex=ex;
+	r.ey=ey;
+
+	//与已有矩形反复合并,直到不再有可合并的矩形
+	i=0;
+	while(i<dirty_num)
+	{
+		if(Rect_Should_Merge(&dirty_rect[i],&r))
+		{
+			Rect_Merge(&r,&dirty_rect[i]);
+			dirty_rect[i]=dirty_rect[--dirty_num];	//移出该矩形,合并结果重新参与比较
+			i=0;
+		}
+		else i++;
+	}
+	if(dirty_num<LCD_DIRTY_MAX)
+	{
+		dirty_rect[dirty_num++]=r;
+		return;
+	}
+
+	//表已满,并入增加面积最小的矩形
+	best=0;
+	best_grow=0xFFFFFFFF;
+	for(i=0;i<dirty_num;i++)
+	{
+		grow=Rect_Union_Area(&dirty_rect[i],&r)-Rect_Area(&dirty_rect[i]);
+		if(grow<best_grow)
+		{
+			best_grow=grow;
+			best=i;
+		}
+	}
+	Rect_Merge(&dirty_rect[best],&r);
+}
+
+//标记整个屏幕需要重绘
+void LCD_Dirty_All(void)
+{
+	LCD_Dirty_Add(0,0,tftlcd_data.width-1,tftlcd_data.height-1);
+}
+
+//当前脏矩形个数
+u8 LCD_Dirty_Count(void)
+{
+	return dirty_num;
+}
+
+//重绘所有脏矩形
+//paint:界面绘制函数,需绘制整个界面(含背景),实际只有裁剪区域内的像素会写入GRAM
+//返回值:本次写入的像素数
+u32 LCD_Dirty_Flush(void (*paint)(void))
+{
+	u8 i;
+	u32 pixels=0;
+
+	if(paint!=0)
+	{
+#if LCD_DLIST
+		LCD_DL_Stat_Reset();
+#endif
+		for(i=0;i<dirty_num;i++)
+		{
+			LCD_Set_Clip(dirty_rect[i].sx,dirty_rect[i].sy,dirty_rect[i].ex,dirty_rect[i].ey);
+#if LCD_DLIST
+			LCD_DL_Begin();		//被后面内容盖住的背景不再写入
+			paint();
+			LCD_DL_End();
+#else
+			paint();
+#endif
+			pixels+=Rect_Area(&dirty_rect[i]);
+		}
+		LCD_Reset_Clip();
+	}
+	dirty_num=0;
+	lcd_dirty_pixels=pixels;
+	return pixels;
+}
@@ -0,0 +1,26 @@
+#ifndef _lcd_dirty_H
+#define _lcd_dirty_H
+
+#include "system.h"
+
+
+#define LCD_DIRTY_MAX	8	//每帧最多记录的脏矩形个数,超出时并入增加面积最小的矩形
+
+//矩形区域,(sx,sy),(ex,ey)为对角坐标
+typedef struct
+{
+	u16 sx;
+	u16 sy;
+	u16 ex;
+	u16 ey;
+}_lcd_rect;
+
+extern u32 lcd_dirty_pixels;	//上一次刷新写入的像素数
+
+void LCD_Dirty_Init(void);
+void LCD_Dirty_Add(u16 sx,u16 sy,u16 ex,u16 ey);	//标记需要重绘的区域
+void LCD_Dirty_All(void);							//标记整个屏幕需要重绘
+u8 LCD_Dirty_Count(void);							//当前脏矩形个数
+u32 LCD_Dirty_Flush(void (*paint)(void));			//重绘所有脏矩形
+
+#endif
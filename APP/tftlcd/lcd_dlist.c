@@ -0,0 +1,294 @@
+#include "lcd_dlist.h"
+#include "tftlcd.h"
+#include "lcd_dirty.h"
+#include "string.h"
+
+#if LCD_DLIST
+
+//显示列表
+//LCD_DL_Begin之后LCD_Fill(含LCD_Clear)和LCD_ShowString只记录到命令缓冲,
+//LCD_DL_End时统一优化后再绘制:
+//1.被后面的不透明操作(填充,单行字符串)完全遮住的操作直接丢弃
+//2.相邻且颜色相同,拼起来仍是矩形的两个填充合成一个
+//3.填充扣除后面不透明操作覆盖的部分,只写露出来的几块,例如先清屏再写字时字下面不再先写背景
+//操作仍按记录的先后顺序绘制,保证重叠部分的结果不变
+//记录期间调用其他绘图函数时,LCD_Set_Window会先把已记录的操作画出,顺序同样不变
+
+#define DL_FILL		0
+#define DL_TEXT		1
+
+typedef struct
+{
+	u16 sx,sy,ex,ey;	//占用区域(已裁剪)
+	u16 fg;				//填充色或字符颜色
+	u16 bg;				//字符背景色
+	u16 x,y,w,h;		//LCD_ShowString的参数
+	u16 text;			//字符串在dl_text中的位置
+	u8 size;
+	u8 type;
+	u8 opaque;			//1:占用区域内每个像素都会被写,可以遮挡前面的操作
+}_lcd_dl_op;
+
+static _lcd_dl_op dl_op[LCD_DLIST_OPS];
+static u8 dl_num=0;
+static char dl_text[LCD_DLIST_TEXT];
+static u16 dl_text_len=0;
+static _lcd_rect dl_piece[LCD_DLIST_PIECES];
+
+volatile u8 lcd_dl_rec=0;
+_lcd_dlist_stat lcd_dlist_stat;
+
+
+//a是否完全包含b
+static u8 Rect_Cover(u16 sx,u16 sy,u16 ex,u16 ey,_lcd_dl_op *b)
+{
+	return sx<=b->sx&&sy<=b->sy&&ex>=b->ex&&ey>=b->ey;
+}
+
+//两个填充能否合成一个矩形,能则把b并入a
+static u8 Fill_Merge(_lcd_dl_op *a,_lcd_dl_op *b)
+{
+	if(a->type!=DL_FILL||b->type!=DL_FILL||a->fg!=b->fg)return 0;
+	if(a->sx==b->sx&&a->ex==b->ex&&(a->ey+1==b->sy||b->ey+1==a->sy))	//上下相接
+	{
+		if(b->sy<a->sy)a->sy=b->sy;
+		if(b->ey>a->ey)a->ey=b->ey;
+		return 1;
+	}
+	if(a->sy==b->sy&&a->ey==b->ey&&(a->ex+1==b->sx||b->ex+1==a->sx))	//左右相接
+	{
+		if(b->sx<a->sx)a->sx=b->sx;
+		if(b->ex>a->ex)a->ex=b->ex;
+		return 1;
+	}
+	return 0;
+}
+
+//第i个填充扣除后面不透明操作覆盖的部分,结果放在dl_piece中
+//返回值:块数,0xFF表示块数超出LCD_DLIST_PIECES
+static u8 Fill_Subtract(u8 i)
+{
+	u8 n=1,k,j,m;
+	_lcd_rect p,*r;
+	_lcd_dl_op *o;
+
+	dl_piece[0].sx=dl_op[i].sx;
+	dl_piece[0].sy=dl_op[i].sy;
+	dl_piece[0].ex=dl_op[i].ex;
+	dl_piece[0].ey=dl_op[i].ey;
+	for(k=i+1;k<dl_num&&n;k++)
+	{
+		o=&dl_op[k];
+		if(!o->opaque)continue;
+		m=n;
+		for(j=0;j<m;)
+		{
+			r=&dl_piece[j];
+			if(r->ex<o->sx||r->sx>o->ex||r->ey<o->sy||r->sy>o->ey)	//不相交
+			{
+				j++;
+				continue;
+			}
+			p=*r;
+			*r=dl_piece[--m];		//移出该块,用末尾的块补位
+			dl_piece[m]=dl_piece[--n];
+			if(n+4>LCD_DLIST_PIECES)return 0xFF;
+			if(p.sy<o->sy)			//上方露出的部分
+			{
+				dl_piece[n].sx=p.sx;dl_piece[n].sy=p.sy;dl_piece[n].ex=p.ex;dl_piece[n].ey=o->sy-1;n++;
+				p.sy=o->sy;
+			}
+			if(p.ey>o->ey)			//下方
+			{
+				dl_piece[n].sx=p.sx;dl_piece[n].sy=o->ey+1;dl_piece[n].ex=p.ex;dl_piece[n].ey=p.ey;n++;
+				p.ey=o->ey;
+			}
+			if(p.sx<o->sx)			//左侧
+			{
+				dl_piece[n].sx=p.sx;dl_piece[n].sy=p.sy;dl_piece[n].ex=o->sx-1;dl_piece[n].ey=p.ey;n++;
+			}
+			if(p.ex>o->ex)			//右侧
+			{
+				dl_piece[n].sx=o->ex+1;dl_piece[n].sy=p.sy;dl_piece[n].ex=p.ex;dl_piece[n].ey=p.ey;n++;
+			}
+		}
+	}
+	return n;
+}
+
+//字符串实际写出的像素数:按换行规则逐行求出写到的字符格,与裁剪区域求交
+//多行且最后一行不满时比占用区域少
+static u32 Text_Pixels(_lcd_dl_op *o)
+{
+	u16 cw=o->size/2,per_line=(o->w+cw-1)/cw,len=strlen(&dl_text[o->text]),n;
+	u16 sx,sy,ex,ey;
+	u32 y,px=0;
+
+	for(y=o->y;len&&y<(u32)o->y+o->h;y+=o->size)
+	{
+		n=len<per_line?len:per_line;
+		len-=n;
+		sx=o->x;
+		sy=y;
+		ex=o->x+n*cw-1;
+		ey=y+o->size-1;
+		if(y>0xFFFF||LCD_ClipRect(&sx,&sy,&ex,&ey)==0)continue;
+		px+=(u32)(ex-sx+1)*(ey-sy+1);
+	}
+	return px;
+}
+
+//开始记录一帧
+void LCD_DL_Begin(void)
+{
+	dl_num=0;
+	dl_text_len=0;
+	lcd_dl_rec=1;
+}
+
+//统计清零
+void LCD_DL_Stat_Reset(void)
+{
+	memset(&lcd_dlist_stat,0,sizeof(lcd_dlist_stat));
+}
+
+//立即绘制已记录的操作,继续记录
+void LCD_DL_Sync(void)
+{
+	u8 i,k,n;
+	u16 fg=FRONT_COLOR,bg=BACK_COLOR;
+	_lcd_dl_op *o;
+
+	lcd_dl_rec=0;
+	for(i=0;i<dl_num;i++)	//被完全遮住的操作
+	{
+		o=&dl_op[i];
+		for(k=i+1;k<dl_num;k++)
+		{
+			if(dl_op[k].opaque&&Rect_Cover(dl_op[k].sx,dl_op[k].sy,dl_op[k].ex,dl_op[k].ey,o))
+			{
+				o->type=0xFF;
+				lcd_dlist_stat.culled++;
+				break;
+			}
+		}
+	}
+	for(i=0;i+1<dl_num;i++)	//相邻填充合并,合并结果留在后一个的位置
+	{
+		if(dl_op[i].type==DL_FILL&&Fill_Merge(&dl_op[i+1],&dl_op[i]))
+		{
+			dl_op[i].type=0xFF;
+			lcd_dlist_stat.merged++;
+		}
+	}
+	for(i=0;i<dl_num;i++)
+	{
+		o=&dl_op[i];
+		if(o->type==DL_FILL)
+		{
+			n=Fill_Subtract(i);
+			if(n==0xFF)		//遮挡太碎,整块填充
+			{
+				LCD_Fill(o->sx,o->sy,o->ex,o->ey,o->fg);
+				lcd_dlist_stat.pieces++;
+				lcd_dlist_stat.pixel+=(u32)(o->ex-o->sx+1)*(o->ey-o->sy+1);
+				continue;
+			}
+			for(k=0;k<n;k++)
+			{
+				LCD_Fill(dl_piece[k].sx,dl_piece[k].sy,dl_piece[k].ex,dl_piece[k].ey,o->fg);
+				lcd_dlist_stat.pixel+=(u32)(dl_piece[k].ex-dl_piece[k].sx+1)*(dl_piece[k].ey-dl_piece[k].sy+1);
+			}
+			lcd_dlist_stat.pieces+=n;
+		}
+		else if(o->type==DL_TEXT)
+		{
+			FRONT_COLOR=o->fg;
+			BACK_COLOR=o->bg;
+			LCD_ShowString(o->x,o->y,o->w,o->h,o->size,(u8 *)&dl_text[o->text]);
+			lcd_dlist_stat.pixel+=Text_Pixels(o);
+		}
+	}
+	FRONT_COLOR=fg;
+	BACK_COLOR=bg;
+	dl_num=0;
+	dl_text_len=0;
+	lcd_dl_rec=1;
+}
+
+//优化并绘制记录的操作,结束记录
+void LCD_DL_End(void)
+{
+	LCD_DL_Sync();
+	lcd_dl_rec=0;
+}
+
+//取得一个空操作,缓冲已满时先画出已记录的操作
+//need:字符串需要的字节数
+static _lcd_dl_op *DL_New(u16 need)
+{
+	if(dl_num>=LCD_DLIST_OPS||dl_text_len+need>LCD_DLIST_TEXT)LCD_DL_Sync();
+	lcd_dlist_stat.ops++;
+	return &dl_op[dl_num++];
+}
+
+//记录填充
+//(sx,sy),(ex,ey):已经裁剪过的矩形
+//color:填充色
+void LCD_DL_Fill(u16 sx,u16 sy,u16 ex,u16 ey,u16 color)
+{
+	_lcd_dl_op *o=DL_New(0);
+
+	o->type=DL_FILL;
+	o->opaque=1;
+	o->sx=sx;
+	o->sy=sy;
+	o->ex=ex;
+	o->ey=ey;
+	o->fg=color;
+}
+
+//记录字符串,参数与LCD_ShowString相同,颜色取当前的FRONT_COLOR和BACK_COLOR
+//字符串被复制,调用后可以修改
+void LCD_DL_String(u16 x,u16 y,u16 width,u16 height,u8 size,u8 *p)
+{
+	u16 len=0,per_line,lines,cols;
+	u16 cw=size/2;
+	u16 sx,sy,ex,ey;
+	_lcd_dl_op *o;
+
+	while(p[len]<='~'&&p[len]>=' ')len++;
+	if(len==0||cw==0||width==0||height==0)return;
+	if(LCD_FontBase(size)==0)return;		//没有这个大小的字体,LCD_ShowString什么也不画,不能遮挡前面的操作
+	//与LCD_ShowString相同的换行规则求出占用区域
+	per_line=(width+cw-1)/cw;
+	lines=(len+per_line-1)/per_line;
+	if(lines>(height+size-1)/size)lines=(height+size-1)/size;
+	cols=len<per_line?len:per_line;
+	sx=x;
+	sy=y;
+	ex=x+cols*cw-1;
+	ey=y+lines*size-1;
+	if(LCD_ClipRect(&sx,&sy,&ex,&ey)==0)return;		//全部在裁剪区域外
+
+	o=DL_New(len+1);
+	o->type=DL_TEXT;
+	o->opaque=lines==1||len>=lines*per_line;	//多行且最后一行不满时右下角不会写到
+	o->sx=sx;
+	o->sy=sy;
+	o->ex=ex;
+	o->ey=ey;
+	o->fg=FRONT_COLOR;
+	o->bg=BACK_COLOR;
+	o->x=x;
+	o->y=y;
+	o->w=width;
+	o->h=height;
+	o->size=size;
+	o->text=dl_text_len;
+	memcpy(&dl_text[dl_text_len],p,len);
+	dl_text[dl_text_len+len]=0;
+	dl_text_len+=len+1;
+}
+
+#endif
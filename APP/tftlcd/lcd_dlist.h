@@ -0,0 +1,38 @@
+#ifndef _lcd_dlist_H
+#define _lcd_dlist_H
+
+#include "system.h"
+
+
+//显示列表  1:开启 0:关闭
+#define LCD_DLIST			1
+
+#define LCD_DLIST_OPS		32		//每批最多记录的操作数
+#define LCD_DLIST_TEXT		512		//每批字符串的总字节数
+#define LCD_DLIST_PIECES	32		//填充被遮挡后最多拆成的块数,超出时整块填充
+
+
+#if LCD_DLIST
+
+typedef struct
+{
+	u16 ops;			//记录的操作数
+	u16 culled;			//被后面的操作完全遮住而丢弃的操作数
+	u16 merged;			//与相邻填充合并的填充数
+	u16 pieces;			//填充扣除遮挡部分后实际写出的块数
+	u32 pixel;			//实际写出的像素数
+}_lcd_dlist_stat;
+
+extern volatile u8 lcd_dl_rec;				//1:正在记录,LCD_Fill/LCD_ShowString只记录不绘制
+extern _lcd_dlist_stat lcd_dlist_stat;		//累计统计,LCD_Dirty_Flush开始时清零
+
+void LCD_DL_Begin(void);												//开始记录一帧
+void LCD_DL_End(void);													//优化并绘制记录的操作,结束记录
+void LCD_DL_Sync(void);													//立即绘制已记录的操作,继续记录
+void LCD_DL_Fill(u16 sx,u16 sy,u16 ex,u16 ey,u16 color);				//记录填充(已裁剪)
+void LCD_DL_String(u16 x,u16 y,u16 width,u16 height,u8 size,u8 *p);		//记录字符串
+void LCD_DL_Stat_Reset(void);											//统计清零
+
+#endif
+
+#endif
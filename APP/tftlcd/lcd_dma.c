@@ -0,0 +1,260 @@
+#include "lcd_dma.h"
+#include "lcd_dlist.h"
+
+#if LCD_DMA_ENABLE
+
+//DMA刷屏引擎
+//使用DMA2通道1的存储器到存储器模式,目标地址固定为TFTLCD->LCD_DATA,
+//CPU只负责设置窗口,像素数据由DMA写入,大面积填充时主循环可以继续运行
+//填充单色:源地址不递增.每像素写2次的屏用32位传输,FSMC会把一次32位
+//写拆成低半字,高半字两次16位写,正好依次写出LCD_DMA_W0,LCD_DMA_W1
+//颜色块:16位屏直接从颜色数组传输;每像素写2次的屏由CPU把颜色拆成总线
+//数据放入中转缓冲,两个缓冲轮流使用,DMA传一块的同时准备下一块
+//任务放入队列后立即返回,由传输完成中断依次执行,
+//CPU再访问LCD时LCD_WriteCmd会先等待队列清空
+
+typedef struct
+{
+	u16 sx;
+	u16 sy;
+	u16 ex;
+	u16 ey;
+	const u16 *buf;			//颜色块,为0时填充color
+	u16 color;
+	void (*done)(void);		//完成回调,在中断中执行
+}_lcd_dma_job;
+
+static _lcd_dma_job dma_queue[LCD_DMA_QUEUE];
+static volatile u8 dma_head=0;	//正在执行的任务
+static volatile u8 dma_tail=0;	//下一个空位
+
+static u32 dma_left;			//当前任务还未送出的像素数
+static const u16 *dma_src;		//颜色块中下一个要送出的像素
+static u32 dma_word;			//填充时的源数据
+
+#ifdef LCD_DMA_BUS8
+static u16 dma_stage[2][LCD_DMA_STAGE*2];	//中转缓冲
+static u16 dma_stage_num[2];				//中转缓冲中的像素数
+static u8 dma_stage_cur;					//下一次要传输的中转缓冲
+#endif
+
+volatile u8 lcd_dma_busy=0;
+
+
+//初始化DMA2时钟及传输完成中断
+void LCD_DMA_Init(void)
+{
+	NVIC_InitTypeDef NVIC_InitStructure;
+
+	RCC_AHBPeriphClockCmd(RCC_AHBPeriph_DMA2,ENABLE);
+	DMA_DeInit(DMA2_Channel1);
+
+	NVIC_InitStructure.NVIC_IRQChannel=DMA2_Channel1_IRQn;
+	NVIC_InitStructure.NVIC_IRQChannelPreemptionPriority=2;
+	NVIC_InitStructure.NVIC_IRQChannelSubPriority=0;
+	NVIC_InitStructure.NVIC_IRQChannelCmd=ENABLE;
+	NVIC_Init(&NVIC_InitStructure);
+
+	dma_head=0;
+	dma_tail=0;
+	lcd_dma_busy=0;
+}
+
+//启动一次DMA传输
+//src:源地址
+//minc:1,源地址递增;0,固定
+//word:1,32位传输;0,16位传输
+//num:传输次数
+static void LCD_DMA_Start(const void *src,u8 minc,u8 word,u16 num)
+{
+	DMA_InitTypeDef DMA_InitStructure;
+
+	DMA_Cmd(DMA2_Channel1,DISABLE);
+	DMA_InitStructure.DMA_PeripheralBaseAddr=(u32)(uintptr_t)&TFTLCD->LCD_DATA;
+	DMA_InitStructure.DMA_MemoryBaseAddr=(u32)(uintptr_t)src;
+	DMA_InitStructure.DMA_DIR=DMA_DIR_PeripheralDST;		//从存储器读,写入LCD
+	DMA_InitStructure.DMA_BufferSize=num;
+	DMA_InitStructure.DMA_PeripheralInc=DMA_PeripheralInc_Disable;
+	DMA_InitStructure.DMA_MemoryInc=minc?DMA_MemoryInc_Enable:DMA_MemoryInc_Disable;
+	DMA_InitStructure.DMA_PeripheralDataSize=word?DMA_PeripheralDataSize_Word:DMA_PeripheralDataSize_HalfWord;
+	DMA_InitStructure.DMA_MemoryDataSize=word?DMA_MemoryDataSize_Word:DMA_MemoryDataSize_HalfWord;
+	DMA_InitStructure.DMA_Mode=DMA_Mode_Normal;
+	DMA_InitStructure.DMA_Priority=DMA_Priority_High;
+	DMA_InitStructure.DMA_M2M=DMA_M2M_Enable;
+	DMA_Init(DMA2_Channel1,&DMA_InitStructure);
+	DMA_ITConfig(DMA2_Channel1,DMA_IT_TC,ENABLE);
+	DMA_Cmd(DMA2_Channel1,ENABLE);
+}
+
+#ifdef LCD_DMA_BUS8
+//把颜色块的下一段拆成总线数据放入中转缓冲
+//返回值:放入的像素数
+static u16 LCD_DMA_Stage(u16 *p)
+{
+	u16 i,n,c;
+
+	n=dma_left>LCD_DMA_STAGE?LCD_DMA_STAGE:dma_left;
+	for(i=0;i<n;i++)
+	{
+		c=dma_src[i];
+		p[2*i]=LCD_DMA_W0(c);
+		p[2*i+1]=LCD_DMA_W1(c);
+	}
+	dma_src+=n;
+	dma_left-=n;
+	return n;
+}
+#endif
+
+//启动当前任务的下一段传输
+//返回值:0,当前任务已全部传完
+static u8 LCD_DMA_Next(void)
+{
+	u16 n;
+
+	if(dma_src==0)	//填充单色,每段最多65535个像素
+	{
+		if(dma_left==0)return 0;
+		n=dma_left>0xFFFF?0xFFFF:dma_left;
+		dma_left-=n;
+#ifdef LCD_DMA_BUS8
+		LCD_DMA_Start(&dma_word,0,1,n);
+#else
+		LCD_DMA_Start(&dma_word,0,0,n);
+#endif
+		return 1;
+	}
+#ifdef LCD_DMA_BUS8
+	n=dma_stage_num[dma_stage_cur];
+	if(n==0)return 0;
+	LCD_DMA_Start(dma_stage[dma_stage_cur],1,0,n*2);
+	dma_stage_cur^=1;
+	dma_stage_num[dma_stage_cur]=LCD_DMA_Stage(dma_stage[dma_stage_cur]);	//传输期间准备下一块
+#else
+	if(dma_left==0)return 0;
+	n=dma_left>0xFFFF?0xFFFF:dma_left;
+	LCD_DMA_Start(dma_src,1,0,n);
+	dma_src+=n;
+	dma_left-=n;
+#endif
+	return 1;
+}
+
+//开始执行队首任务,调用时中断已关闭或在DMA中断中
+static void LCD_DMA_Begin(void)
+{
+	_lcd_dma_job *job=&dma_queue[dma_head];
+#if LCD_DLIST
+	u8 rec=lcd_dl_rec;
+
+	lcd_dl_rec=0;		//可能在中断中,不能触发显示列表绘制
+#endif
+
+	lcd_dma_busy=0;		//设置窗口要由CPU写总线
+	LCD_Set_Window(job->sx,job->sy,job->ex,job->ey);
+	lcd_dma_busy=1;
+#if LCD_DLIST
+	lcd_dl_rec=rec;
+#endif
+
+	dma_left=(u32)(job->ex-job->sx+1)*(job->ey-job->sy+1);
+#if TFTLCD_BUS_STAT
+	lcd_bus_stat.pixel+=dma_left;
+#endif
+	dma_src=job->buf;
+	if(dma_src==0)
+	{
+#ifdef LCD_DMA_BUS8
+		dma_word=LCD_DMA_W0(job->color)|((u32)LCD_DMA_W1(job->color)<<16);
+#else
+		dma_word=job->color;
+#endif
+	}
+#ifdef LCD_DMA_BUS8
+	else
+	{
+		dma_stage_cur=0;
+		dma_stage_num[0]=LCD_DMA_Stage(dma_stage[0]);
+	}
+#endif
+	LCD_DMA_Next();
+}
+
+//任务入队,引擎空闲时立即开始
+static void LCD_DMA_Push(u16 sx,u16 sy,u16 ex,u16 ey,const u16 *buf,u16 color,void (*done)(void))
+{
+	u8 next;
+	_lcd_dma_job *job;
+
+#if LCD_DLIST
+	if(lcd_dl_rec)LCD_DL_Sync();	//记录期间直接绘图,先画出已记录的操作
+#endif
+	next=(dma_tail+1)%LCD_DMA_QUEUE;
+	while(next==dma_head)LCD_DMA_IDLE();	//队列已满,等待中断取走任务
+
+	job=&dma_queue[dma_tail];
+	job->sx=sx;
+	job->sy=sy;
+	job->ex=ex;
+	job->ey=ey;
+	job->buf=buf;
+	job->color=color;
+	job->done=done;
+
+	LCD_DMA_LOCK();
+	dma_tail=next;
+	if(lcd_dma_busy==0)LCD_DMA_Begin();
+	LCD_DMA_UNLOCK();
+}
+
+//异步填充单色,不做裁剪
+//(sx,sy),(ex,ey):填充矩形对角坐标
+//color:要填充的颜色
+//done:完成回调,在中断中执行,不能在回调中操作LCD,可为0
+void LCD_DMA_Fill(u16 sx,u16 sy,u16 ex,u16 ey,u16 color,void (*done)(void))
+{
+	LCD_DMA_Push(sx,sy,ex,ey,0,color,done);
+}
+
+//异步写入颜色块,不做裁剪
+//(sx,sy),(ex,ey):矩形对角坐标
+//buf:颜色数组,按行存放,传输完成前不能修改或释放
+//done:完成回调,在中断中执行,不能在回调中操作LCD,可为0
+void LCD_DMA_Blit(u16 sx,u16 sy,u16 ex,u16 ey,const u16 *buf,void (*done)(void))
+{
+	LCD_DMA_Push(sx,sy,ex,ey,buf,0,done);
+}
+
+//返回值:1,还有未完成的任务
+u8 LCD_DMA_Busy(void)
+{
+	return lcd_dma_busy;
+}
+
+//等待全部任务完成
+void LCD_DMA_Wait(void)
+{
+	LCD_DMA_WAIT();
+}
+
+//DMA2通道1传输完成中断,继续当前任务或开始下一个任务
+void DMA2_Channel1_IRQHandler(void)
+{
+	void (*done)(void);
+
+	if(DMA_GetITStatus(DMA2_IT_TC1)!=RESET)
+	{
+		DMA_ClearITPendingBit(DMA2_IT_GL1);
+		if(LCD_DMA_Next()==0)
+		{
+			DMA_Cmd(DMA2_Channel1,DISABLE);
+			done=dma_queue[dma_head].done;
+			dma_head=(dma_head+1)%LCD_DMA_QUEUE;
+			if(dma_head!=dma_tail)LCD_DMA_Begin();
+			else lcd_dma_busy=0;
+			if(done)done();
+		}
+	}
+}
+
+#endif
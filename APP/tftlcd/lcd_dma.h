@@ -0,0 +1,60 @@
+#ifndef _lcd_dma_H
+#define _lcd_dma_H
+
+#include "system.h"
+#include "tftlcd.h"
+
+
+//DMA刷屏引擎  1:开启 0:关闭(全部由CPU写屏)
+#define LCD_DMA_ENABLE		1
+
+#define LCD_DMA_MIN_PIXELS	64		//少于该像素数的填充仍由CPU完成,DMA启动开销不划算
+#define LCD_DMA_QUEUE		8		//异步任务队列长度
+#define LCD_DMA_STAGE		128		//每像素写2次的屏,块传输时每个中转缓冲的像素数
+
+//任务入队时关中断
+#ifndef LCD_DMA_LOCK
+#define LCD_DMA_LOCK()		__disable_irq()
+#define LCD_DMA_UNLOCK()	__enable_irq()
+#endif
+//CPU等待DMA时每次空转执行,主机测试在这里推进模拟的DMA
+#ifndef LCD_DMA_IDLE
+#define LCD_DMA_IDLE()
+#endif
+
+
+//按驱动区分每个像素的总线写法,见lcd_port.h
+//LCD_DMA_BUS16:每个像素一次16位写入
+//LCD_DMA_BUS8:每个像素两次写入,LCD_DMA_W0/LCD_DMA_W1为先后写入的值
+#if defined(LCD_PORT_BUS8)
+#define LCD_DMA_BUS8
+#define LCD_DMA_W0(c)	LCD_PORT_W0(c)
+#define LCD_DMA_W1(c)	LCD_PORT_W1(c)
+#elif defined(LCD_PORT_18BIT)
+#undef LCD_DMA_ENABLE						//18位色需要换算,不走DMA
+#define LCD_DMA_ENABLE		0
+#else
+#define LCD_DMA_BUS16
+#endif
+
+
+#if LCD_DMA_ENABLE
+
+extern volatile u8 lcd_dma_busy;			//1:队列中还有任务,CPU不能操作LCD总线
+
+//CPU访问LCD前等待DMA任务全部完成
+#define LCD_DMA_WAIT()	while(lcd_dma_busy)LCD_DMA_IDLE()
+
+void LCD_DMA_Init(void);
+void LCD_DMA_Fill(u16 sx,u16 sy,u16 ex,u16 ey,u16 color,void (*done)(void));		//异步填充单色
+void LCD_DMA_Blit(u16 sx,u16 sy,u16 ex,u16 ey,const u16 *buf,void (*done)(void));	//异步写入颜色块
+u8 LCD_DMA_Busy(void);
+void LCD_DMA_Wait(void);
+
+#else
+
+#define LCD_DMA_WAIT()
+
+#endif
+
+#endif
@@ -0,0 +1,187 @@
+#include "lcd_glyph.h"
+#include "tftlcd.h"
+
+#if LCD_GLYPH_CACHE
+
+//字符点阵缓存
+//把最近显示过的字符按(字符,大小,前景色,背景色)展开成RGB565像素保存,
+//再次显示时直接把像素写入数据口,不必重新逐位展开点阵
+//缓存区按LCD_GLYPH_BLOCK个像素分块,每个字符占连续的若干块,按行存放,宽size/2,高size
+//空间不够时依次释放最久未使用的字符,直到腾出足够的连续块
+
+typedef struct
+{
+	u8 ch;			//字符
+	u8 size;		//字体大小
+	u16 fg;			//前景色
+	u16 bg;			//背景色
+	u8 start;		//起始块
+	u8 num;			//占用块数,0表示空项
+	u32 used;		//最近一次使用的时间,越大越新
+}_lcd_glyph;
+
+static _lcd_glyph glyph_tag[LCD_GLYPH_BLOCKS];				//每个字符至少占1块,项数不会超过块数
+static u16 glyph_pixel[LCD_GLYPH_BLOCKS*LCD_GLYPH_BLOCK];
+static u8 glyph_block[LCD_GLYPH_BLOCKS];					//1:该块已分配
+static u32 glyph_clock=0;
+
+u32 lcd_glyph_hit=0;
+u32 lcd_glyph_miss=0;
+
+
+//清空缓存和计数
+void LCD_Glyph_Clear(void)
+{
+	u8 i;
+
+	for(i=0;i<LCD_GLYPH_BLOCKS;i++)
+	{
+		glyph_tag[i].num=0;
+		glyph_block[i]=0;
+	}
+	glyph_clock=0;
+	lcd_glyph_hit=0;
+	lcd_glyph_miss=0;
+}
+
+//把字符点阵展开成像素
+//out:按行存放,宽size/2,高size
+static void Glyph_Expand(u8 ch,u8 size,u16 fg,u16 bg,u16 *out)
+{
+	const u8 *font;
+	u8 base=LCD_FontBase(size);
+	u8 scale=size/base;
+	u8 cbytes=base/8+((base%8)?1:0);
+	u8 cw=size/2;
+	u8 r,c,sr,mask;
+
+	font=LCD_GetFont(ch,base);
+	for(r=0;r<size;r++)
+	{
+		sr=r/scale;
+		mask=0x80>>(sr&7);
+		for(c=0;c<cw;c++)
+		{
+			*out++=(font[(c/scale)*cbytes+(sr>>3)]&mask)?fg:bg;
+		}
+	}
+}
+
+//分配num个连续块,不够时释放最久未使用且used<keep的字符
+//返回值:起始块,0xFF表示分配失败
+static u8 Glyph_Alloc(u8 num,u32 keep)
+{
+	u8 i,b,run,old;
+
+	while(1)
+	{
+		run=0;
+		for(b=0;b<LCD_GLYPH_BLOCKS;b++)
+		{
+			run=glyph_block[b]?0:run+1;
+			if(run==num)return b-num+1;
+		}
+		old=0xFF;
+		for(i=0;i<LCD_GLYPH_BLOCKS;i++)
+		{
+			if(glyph_tag[i].num==0||glyph_tag[i].used>=keep)continue;
+			if(old==0xFF||glyph_tag[i].used<glyph_tag[old].used)old=i;
+		}
+		if(old==0xFF)return 0xFF;
+		for(b=0;b<glyph_tag[old].num;b++)glyph_block[glyph_tag[old].start+b]=0;
+		glyph_tag[old].num=0;
+	}
+}
+
+//取得字符的像素,未缓存时展开保存
+//keep:used不小于keep的字符正在使用,不能释放
+//返回值:像素首地址,0表示空间不够
+static const u16 *Glyph_Get(u8 ch,u8 size,u32 keep)
+{
+	u8 i,b,num,start;
+
+	if(LCD_GetFont(ch,LCD_FontBase(size))==0)ch=' ';		//非法字符显示为空格
+	glyph_clock++;
+	for(i=0;i<LCD_GLYPH_BLOCKS;i++)
+	{
+		if(glyph_tag[i].num&&glyph_tag[i].size==size&&glyph_tag[i].ch==ch&&glyph_tag[i].fg==FRONT_COLOR&&glyph_tag[i].bg==BACK_COLOR)
+		{
+			glyph_tag[i].used=glyph_clock;
+			lcd_glyph_hit++;
+			return &glyph_pixel[glyph_tag[i].start*LCD_GLYPH_BLOCK];
+		}
+	}
+	num=((u16)size*(size/2)+LCD_GLYPH_BLOCK-1)/LCD_GLYPH_BLOCK;
+	start=Glyph_Alloc(num,keep);
+	if(start==0xFF)return 0;
+	for(i=0;glyph_tag[i].num;i++);		//已有空块,必定还有空项
+	for(b=0;b<num;b++)glyph_block[start+b]=1;
+	glyph_tag[i].ch=ch;
+	glyph_tag[i].size=size;
+	glyph_tag[i].fg=FRONT_COLOR;
+	glyph_tag[i].bg=BACK_COLOR;
+	glyph_tag[i].start=start;
+	glyph_tag[i].num=num;
+	glyph_tag[i].used=glyph_clock;
+	lcd_glyph_miss++;
+	Glyph_Expand(ch,size,FRONT_COLOR,BACK_COLOR,&glyph_pixel[start*LCD_GLYPH_BLOCK]);
+	return &glyph_pixel[start*LCD_GLYPH_BLOCK];
+}
+
+//用缓存在一个窗口内显示n个字符(非叠加方式),只输出裁剪区域内的部分
+//缓存放不下整段字符时分批,每批开一次窗口,同一批的字符不会互相替换
+//x,y:起始坐标
+//p:字符串,n:字符个数
+//size:字体大小
+//返回值:0,该字体不缓存,由调用者展开显示;1,已显示
+u8 LCD_Glyph_ShowRun(u16 x,u16 y,u8 *p,u16 n,u8 size)
+{
+	static const u16 *glyph[LCD_GLYPH_BLOCKS];	//512字节,不占用栈(启动文件中共2KB);只在主循环中绘图,不会重入
+	const u16 *q;
+	u8 cw=size/2;
+	u16 sx,sy,ex,ey,bsx,bex;
+	u16 first,last,k,i,r,col,cnt;
+	u32 keep;
+
+	if(n==0||size>LCD_GLYPH_MAX_SIZE||LCD_FontBase(size)==0)return 0;
+	sx=x;
+	sy=y;
+	ex=x+n*cw-1;
+	ey=y+size-1;
+	if(LCD_ClipRect(&sx,&sy,&ex,&ey)==0)return 1;
+	first=(sx-x)/cw;
+	last=(ex-x)/cw;
+	while(first<=last)
+	{
+		keep=glyph_clock+1;				//本批取到的字符都不能被释放
+		k=last-first+1;
+		if(k>LCD_GLYPH_BLOCKS)k=LCD_GLYPH_BLOCKS;
+		for(i=0;i<k;i++)
+		{
+			glyph[i]=Glyph_Get(p[first+i],size,keep);
+			if(glyph[i]==0)break;
+		}
+		if(i==0)return 0;				//缓存区比一个字符还小
+		k=i;
+		bsx=x+first*cw;
+		bex=bsx+k*cw-1;
+		if(bsx<sx)bsx=sx;
+		if(bex>ex)bex=ex;
+		LCD_Set_Window(bsx,sy,bex,ey);
+		for(r=sy;r<=ey;r++)
+		{
+			for(col=bsx;col<=bex;col+=cnt)
+			{
+				i=(col-x)/cw;
+				q=glyph[i-first]+(r-y)*cw+(col-x-i*cw);
+				cnt=(i+1)*cw+x-col;			//本字符这一行剩余的像素
+				if(cnt>bex-col+1)cnt=bex-col+1;
+				for(i=cnt;i;i--)LCD_PIXEL(*q++);
+			}
+		}
+		first+=k;
+	}
+	return 1;
+}
+
+#endif
@@ -0,0 +1,29 @@
+#ifndef _lcd_glyph_H
+#define _lcd_glyph_H
+
+#include "system.h"
+
+
+//字符点阵缓存  1:开启 0:关闭
+#ifndef LCD_GLYPH_CACHE
+#define LCD_GLYPH_CACHE		1
+#endif
+
+#define LCD_GLYPH_BYTES		16384	//缓存占用的SRAM字节数,不超过255块
+#define LCD_GLYPH_MAX_SIZE	24		//可缓存的最大字体,更大的字体直接展开
+
+#define LCD_GLYPH_BLOCK		64		//分配单位(像素),16号字占2块,24号字占5块
+#define LCD_GLYPH_BLOCKS	(LCD_GLYPH_BYTES/(LCD_GLYPH_BLOCK*2))		//块数
+
+
+#if LCD_GLYPH_CACHE
+
+extern u32 lcd_glyph_hit;		//命中次数
+extern u32 lcd_glyph_miss;		//未命中次数
+
+void LCD_Glyph_Clear(void);								//清空缓存和计数
+u8 LCD_Glyph_ShowRun(u16 x,u16 y,u8 *p,u16 n,u8 size);	//用缓存显示n个字符
+
+#endif
+
+#endif
@@ -0,0 +1,116 @@
+#include "lcd_image.h"
+#include "tftlcd.h"
+
+
+//压缩图片流式解码
+//每次解出一个像素直接写入GRAM,整幅图片只开一次窗口,不需要解码缓冲区
+//编码方式与tools/lcdimg.py一致:颜色表索引,与前一像素的小差值,重复,原色
+
+//解码器状态
+typedef struct
+{
+	const u8 *p;		//下一个要读的字节
+	u16 prev;			//前一个像素
+	u8 run;				//前一个像素还要重复的次数
+	u16 index[64];		//最近出现的颜色
+}_lcd_img_dec;
+
+#define IMG_HASH(c)		((((c)>>11)*3+(((c)>>5)&0x3f)*5+((c)&0x1f)*7)&0x3f)
+
+
+//读取图片宽高
+//返回值:0,不是lcdimg.py生成的图片;1,宽高写入width,height
+u8 LCD_Img_Size(const u8 *img,u16 *width,u16 *height)
+{
+	if(img[0]!='L'||img[1]!='I'||img[2]!=1)return 0;
+	*width=img[4]|(img[5]<<8);
+	*height=img[6]|(img[7]<<8);
+	return 1;
+}
+
+static void Img_Start(_lcd_img_dec *d,const u8 *img)
+{
+	u8 i;
+
+	d->p=img+LCD_IMG_HEAD;
+	d->prev=0;
+	d->run=0;
+	for(i=0;i<64;i++)d->index[i]=0;
+}
+
+//解出下一个像素
+static u16 Img_Next(_lcd_img_dec *d)
+{
+	u8 b,b2;
+	s16 r,g,bl,dg;
+	u16 c;
+
+	if(d->run)
+	{
+		d->run--;
+		return d->prev;
+	}
+	b=*d->p++;
+	if(b==0xFE)					//原色
+	{
+		c=(d->p[0]<<8)|d->p[1];
+		d->p+=2;
+	}
+	else
+	{
+		switch(b>>6)
+		{
+			case 0:				//颜色表
+				c=d->index[b];
+				break;
+			case 1:				//小差值
+				r=(d->prev>>11)+((b>>4)&3)-2;
+				g=((d->prev>>5)&0x3f)+((b>>2)&3)-2;
+				bl=(d->prev&0x1f)+(b&3)-2;
+				c=((r&0x1f)<<11)|((g&0x3f)<<5)|(bl&0x1f);
+				break;
+			case 2:				//绿色差值,红蓝相对绿色的差值
+				dg=(b&0x3f)-32;
+				b2=*d->p++;
+				r=(d->prev>>11)+(b2>>4)-8+((dg+32)>>1)-16;
+				g=((d->prev>>5)&0x3f)+dg;
+				bl=(d->prev&0x1f)+(b2&0x0f)-8+((dg+32)>>1)-16;
+				c=((r&0x1f)<<11)|((g&0x3f)<<5)|(bl&0x1f);
+				break;
+			default:			//重复前一个像素
+				d->run=b&0x3f;
+				return d->prev;
+		}
+	}
+	d->index[IMG_HASH(c)]=c;
+	d->prev=c;
+	return c;
+}
+
+//显示压缩图片
+//x,y:左上角坐标
+//img:lcdimg.py生成的数组
+void LCD_ShowImage(u16 x,u16 y,const u8 *img)
+{
+	_lcd_img_dec dec;
+	u16 width,height;
+	u16 sx,sy,ex,ey;
+	u16 i,j,c;
+
+	if(LCD_Img_Size(img,&width,&height)==0)return;
+	sx=x;
+	sy=y;
+	ex=x+width-1;
+	ey=y+height-1;
+	if(LCD_ClipRect(&sx,&sy,&ex,&ey)==0)return;
+	Img_Start(&dec,img);
+	LCD_Set_Window(sx,sy,ex,ey);
+	for(j=y;j<=ey;j++)			//裁剪区以下的行不用再解码
+	{
+		for(i=x;i<x+width;i++)
+		{
+			c=Img_Next(&dec);
+			if(j>=sy&&i>=sx&&i<=ex)LCD_PIXEL(c);
+		}
+	}
+}
@@ -0,0 +1,13 @@
+#ifndef _lcd_image_H
+#define _lcd_image_H
+
+#include "system.h"
+
+
+//压缩图片由tools/lcdimg.py生成,格式说明见该脚本
+#define LCD_IMG_HEAD	8		//文件头字节数
+
+u8 LCD_Img_Size(const u8 *img,u16 *width,u16 *height);	//读取图片宽高
+void LCD_ShowImage(u16 x,u16 y,const u8 *img);			//显示压缩图片
+
+#endif
@@ -0,0 +1,105 @@
+#ifndef _lcd_port_H
+#define _lcd_port_H
+
+//各驱动芯片的总线写法,由tftlcd.h在选定驱动和TFTLCD地址之后包含
+//编译时按所选驱动展开成对数据口/命令口的直接写入,
+//热点路径用LCD_PIXEL逐像素写入时没有函数调用开销
+//
+//LCD_PORT_CMD(c)	写命令
+//LCD_PORT_DATA(d)	写参数
+//LCD_PORT_PIXEL(c)	写一个RGB565颜色,c只求值一次
+//LCD_PORT_BUS8		每个像素两次写入,先写LCD_PORT_W0(c),再写LCD_PORT_W1(c)
+//LCD_PORT_18BIT	每个像素换算成18位色后两次写入
+//窗口设置方式(LCD_Set_Window使用):
+//LCD_PORT_WIN_DCS		0x2A/0x2B各4个参数,0x2C开始写GRAM
+//LCD_PORT_WIN_DCS_SWAP	同上,竖屏时0x2A/0x2B对调(SSD1963)
+//LCD_PORT_WIN_NT35510	16位命令,每个命令1个参数
+//LCD_PORT_WIN_HX8352C	每个坐标字节一个寄存器
+//LCD_PORT_WIN_REG		窗口起止4个寄存器加光标2个寄存器,
+//						寄存器号LCD_PORT_REG_HSA,LCD_PORT_REG_HEA,LCD_PORT_REG_VSA,
+//						LCD_PORT_REG_VEA,LCD_PORT_REG_X,LCD_PORT_REG_Y,LCD_PORT_REG_GRAM
+//LCD_PORT_VSCROLL		支持0x33(滚动区域)和0x37(滚动起始行)硬件垂直滚动
+//LCD_PORT_READ_BUS8	0x2E连续读GRAM,一次空读后每个像素读两次,先高字节后低字节
+
+
+//命令和参数
+#if defined(TFTLCD_R61509VN)
+#define LCD_PORT_CMD(c)		do{TFTLCD->LCD_CMD=((c)>>8)<<1;TFTLCD->LCD_CMD=((c)&0xff)<<1;}while(0)
+#define LCD_PORT_DATA(d)	do{TFTLCD->LCD_DATA=((d)>>8)<<1;TFTLCD->LCD_DATA=((d)&0xff)<<1;}while(0)
+#elif defined(TFTLCD_HX8352C)||defined(TFTLCD_ILI9341)
+#define LCD_PORT_CMD(c)		(TFTLCD->LCD_CMD=(c)<<8)
+#define LCD_PORT_DATA(d)	(TFTLCD->LCD_DATA=(d)<<8)
+#elif defined(TFTLCD_ST7793)
+#define LCD_PORT_CMD(c)		do{TFTLCD->LCD_CMD=(c)>>8;TFTLCD->LCD_CMD=(c)&0xff;}while(0)
+#define LCD_PORT_DATA(d)	do{TFTLCD->LCD_DATA=(d)>>8;TFTLCD->LCD_DATA=(d)&0xff;}while(0)
+#else
+#define LCD_PORT_CMD(c)		(TFTLCD->LCD_CMD=(c))
+#define LCD_PORT_DATA(d)	(TFTLCD->LCD_DATA=(d))
+#endif
+
+
+//像素
+#if defined(TFTLCD_HX8357DN)||defined(TFTLCD_ILI9327)||defined(TFTLCD_ST7793)||defined(TFTLCD_ILI9488)
+#define LCD_PORT_BUS8
+#define LCD_PORT_W0(c)		((c)>>8)
+#define LCD_PORT_W1(c)		((c)&0xff)
+#elif defined(TFTLCD_HX8352C)||defined(TFTLCD_ILI9341)
+#define LCD_PORT_BUS8
+#define LCD_PORT_W0(c)		((c)&0xff00)
+#define LCD_PORT_W1(c)		((u16)((c)<<8))
+#elif defined(TFTLCD_R61509VN)
+#define LCD_PORT_18BIT
+#endif
+
+#if defined(LCD_PORT_BUS8)
+#define LCD_PORT_PIXEL(c)	do{u16 c_=(c);TFTLCD->LCD_DATA=LCD_PORT_W0(c_);TFTLCD->LCD_DATA=LCD_PORT_W1(c_);}while(0)
+#elif defined(LCD_PORT_18BIT)
+#define LCD_PORT_PIXEL(c)	do{u32 c_=LCD_RGBColor_Change(c);TFTLCD->LCD_DATA=c_>>9;TFTLCD->LCD_DATA=c_;}while(0)
+#else
+#define LCD_PORT_PIXEL(c)	(TFTLCD->LCD_DATA=(c))
+#endif
+
+
+//窗口
+#if defined(TFTLCD_SSD1963)||defined(TFTLCD_SSD1963N)
+#define LCD_PORT_WIN_DCS_SWAP
+#elif defined(TFTLCD_NT35510)
+#define LCD_PORT_WIN_NT35510
+#elif defined(TFTLCD_HX8352C)
+#define LCD_PORT_WIN_HX8352C
+#elif defined(TFTLCD_ILI9325)
+#define LCD_PORT_WIN_REG
+#define LCD_PORT_REG_HSA	0x0050
+#define LCD_PORT_REG_HEA	0x0051
+#define LCD_PORT_REG_VSA	0x0052
+#define LCD_PORT_REG_VEA	0x0053
+#define LCD_PORT_REG_X		0x0020
+#define LCD_PORT_REG_Y		0x0021
+#define LCD_PORT_REG_GRAM	0x0022
+#elif defined(TFTLCD_R61509V)||defined(TFTLCD_R61509VN)||defined(TFTLCD_R61509V3)||defined(TFTLCD_R61509VE)||defined(TFTLCD_ST7793)
+#define LCD_PORT_WIN_REG
+#define LCD_PORT_REG_HSA	0x0210
+#define LCD_PORT_REG_HEA	0x0211
+#define LCD_PORT_REG_VSA	0x0212
+#define LCD_PORT_REG_VEA	0x0213
+#define LCD_PORT_REG_X		0x0200
+#define LCD_PORT_REG_Y		0x0201
+#define LCD_PORT_REG_GRAM	0x0202
+#else
+#define LCD_PORT_WIN_DCS
+#endif
+
+
+//硬件垂直滚动
+#ifdef LCD_PORT_WIN_DCS
+#define LCD_PORT_VSCROLL
+#endif
+
+
+//连续读GRAM,其他驱动由LCD_ReadRect逐点读取
+#if defined(TFTLCD_HX8357DN)
+#define LCD_PORT_READ_BUS8
+#endif
+
+
+#endif
@@ -0,0 +1,116 @@
+#include "lcd_prof.h"
+#include "lcd_dma.h"
+#include "lcd_image.h"
+#include "usart.h"
+#include "picture.h"
+
+#if TFTLCD_BUS_STAT
+
+//DWT周期计数器,core_cm3.h中没有定义DWT结构体
+#define DWT_CTRL	(*(volatile u32 *)0xE0001000)
+#define DWT_CYCCNT	(*(volatile u32 *)0xE0001004)
+
+_lcd_prof lcd_prof;
+
+static u32 prof_start;
+
+
+//开启DWT周期计数器,打印表头
+void LCD_Prof_Init(void)
+{
+	CoreDebug->DEMCR|=CoreDebug_DEMCR_TRCENA_Msk;
+	DWT_CYCCNT=0;
+	DWT_CTRL|=1;		//CYCCNTENA
+	printf("%-24s %8s %8s %8s %10s %8s\r\n","call","cmd","data","pixel","cycle","us");
+}
+
+//开始测试
+void LCD_Prof_Begin(void)
+{
+	LCD_DMA_WAIT();		//之前的DMA任务不计入本次测试
+	LCD_BusStat_Clear();
+	prof_start=DWT_CYCCNT;
+}
+
+//结束测试并打印一行结果
+//name:测试项名称
+void LCD_Prof_End(const char *name)
+{
+	LCD_DMA_WAIT();
+	lcd_prof.cycle=DWT_CYCCNT-prof_start;
+	lcd_prof.cmd=lcd_bus_stat.cmd;
+	lcd_prof.data=lcd_bus_stat.data;
+	lcd_prof.pixel=lcd_bus_stat.pixel;
+	printf("%-24s %8u %8u %8u %10u %8u\r\n",name,lcd_prof.cmd,lcd_prof.data,lcd_prof.pixel,
+		lcd_prof.cycle,lcd_prof.cycle/(SystemCoreClock/1000000));
+}
+
+//测试一个函数
+//name:测试项名称
+//fn:被测函数,例如界面的绘制函数
+void LCD_Prof_Call(const char *name,void (*fn)(void))
+{
+	LCD_Prof_Begin();
+	fn();
+	LCD_Prof_End(name);
+}
+
+//测试常用绘图函数,测试后屏幕内容被破坏,需要重绘
+void LCD_Prof_Run(void)
+{
+	LCD_Prof_Begin();
+	LCD_Clear(WHITE);
+	LCD_Prof_End("LCD_Clear");
+
+	LCD_Prof_Begin();
+	LCD_Fill(10,10,109,109,RED);
+	LCD_Prof_End("LCD_Fill 100x100");
+
+	LCD_Prof_Begin();
+	LCD_Fill(10,120,17,127,BLUE);
+	LCD_Prof_End("LCD_Fill 8x8");
+
+	FRONT_COLOR=BLACK;
+	BACK_COLOR=WHITE;
+	LCD_Prof_Begin();
+	LCD_ShowString(10,140,300,16,16,(u8 *)"Medicine Box 0123");
+	LCD_Prof_End("LCD_ShowString 16x17");
+
+	LCD_Prof_Begin();
+	LCD_ShowString(10,160,300,24,24,(u8 *)"Medicine Box 0123");
+	LCD_Prof_End("LCD_ShowString 24x17");
+
+	LCD_Prof_Begin();
+	LCD_DrawLine(10,200,309,200);
+	LCD_Prof_End("LCD_DrawLine horiz 300");
+
+	LCD_Prof_Begin();
+	LCD_DrawLine(10,210,309,309);
+	LCD_Prof_End("LCD_DrawLine diag 300");
+
+	LCD_Prof_Begin();
+	LCD_DrawRectangle(10,220,209,319);
+	LCD_Prof_End("LCD_DrawRectangle");
+
+	LCD_Prof_Begin();
+	LCD_Draw_Circle(260,260,50);
+	LCD_Prof_End("LCD_Draw_Circle r50");
+
+	LCD_Prof_Begin();
+	LCD_Fill_Circle(260,260,40,GREEN);
+	LCD_Prof_End("LCD_Fill_Circle r40");
+
+	LCD_Prof_Begin();
+	LCD_Fill_RoundRect(10,400,209,439,10,BLUE);
+	LCD_Prof_End("LCD_Fill_RoundRect");
+
+	LCD_Prof_Begin();
+	LCD_ShowPicture(10,320,64,64,(u8 *)FLASH_BASE);		//内容无关,只测总线开销
+	LCD_Prof_End("LCD_ShowPicture 64x64");
+
+	LCD_Prof_Begin();
+	LCD_ShowImage(10,320,gImage_picture);
+	LCD_Prof_End("LCD_ShowImage 200x112");
+}
+
+#endif
@@ -0,0 +1,30 @@
+#ifndef _lcd_prof_H
+#define _lcd_prof_H
+
+#include "system.h"
+#include "tftlcd.h"
+
+
+//绘图函数开销测试,需先把tftlcd.h中的TFTLCD_BUS_STAT设为1
+//每次测试记录命令写,参数写,颜色写次数和CPU周期数(含等待DMA完成),结果由串口1打印
+#if TFTLCD_BUS_STAT
+
+typedef struct
+{
+	u32 cmd;			//命令写次数
+	u32 data;			//参数写次数
+	u32 pixel;			//颜色写次数
+	u32 cycle;			//CPU周期数
+}_lcd_prof;
+
+extern _lcd_prof lcd_prof;		//最近一次测试的结果
+
+void LCD_Prof_Init(void);							//开启DWT周期计数器,打印表头
+void LCD_Prof_Begin(void);							//开始测试
+void LCD_Prof_End(const char *name);				//结束测试并打印一行结果
+void LCD_Prof_Call(const char *name,void (*fn)(void));	//测试一个函数
+void LCD_Prof_Run(void);							//测试常用绘图函数
+
+#endif
+
+#endif
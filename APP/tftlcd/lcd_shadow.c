@@ -0,0 +1,230 @@
+#include "lcd_shadow.h"
+#include "tftlcd.h"
+
+#if LCD_SHADOW
+
+//调色板影子帧缓冲
+//屏幕内容先画到SRAM中的索引色缓冲,每像素LCD_SHADOW_BPP位,
+//写入时与原值比较,真正改变了像素的块被标记为脏,只有脏块才写出.
+//LCD_Shadow_Flush把同一块行中相邻的脏块合成一个窗口,经调色板换成RGB565连续写出,
+//整屏可以先在缓冲中画好再一次刷新,不会闪烁,内容没变的块不占总线
+
+#define SHADOW_PPB		(8/LCD_SHADOW_BPP)						//每字节像素数
+#define SHADOW_MASK		((1<<LCD_SHADOW_BPP)-1)
+#define SHADOW_STRIDE	((LCD_SHADOW_W+SHADOW_PPB-1)/SHADOW_PPB)	//每行字节数
+
+static u8 shadow_buf[SHADOW_STRIDE*LCD_SHADOW_H];
+static u32 shadow_dirty[LCD_SHADOW_TY];		//每块行一个字,第n位对应第n块
+static u16 shadow_pal[LCD_SHADOW_COLORS];
+
+u32 lcd_shadow_tiles=0;
+
+
+//把(x,y)所在的块标记为脏
+#define SHADOW_DIRTY(x,y)	(shadow_dirty[(y)/LCD_SHADOW_TILE]|=1ul<<((x)/LCD_SHADOW_TILE))
+#define SHADOW_ALL			((LCD_SHADOW_TX>=32)?0xFFFFFFFF:((1ul<<LCD_SHADOW_TX)-1))
+
+//整个缓冲都必须重新写出
+static void Shadow_Force_All(void)
+{
+	u8 i;
+
+	for(i=0;i<LCD_SHADOW_TY;i++)shadow_dirty[i]=SHADOW_ALL;
+}
+
+//清成颜色0,全部标记为脏
+void LCD_Shadow_Init(void)
+{
+	u32 i;
+
+	for(i=0;i<sizeof(shadow_buf);i++)shadow_buf[i]=0;
+	Shadow_Force_All();
+	lcd_shadow_tiles=0;
+}
+
+//设置调色板,颜色改变后整个缓冲需要重新写出
+//pal:颜色数组
+//num:颜色个数,超过LCD_SHADOW_COLORS的部分不用
+void LCD_Shadow_Palette(const u16 *pal,u8 num)
+{
+	u8 i;
+	u8 changed=0;
+
+	if(num>LCD_SHADOW_COLORS)num=LCD_SHADOW_COLORS;
+	for(i=0;i<num;i++)
+	{
+		if(shadow_pal[i]!=pal[i])changed=1;
+		shadow_pal[i]=pal[i];
+	}
+	if(changed)Shadow_Force_All();
+}
+
+//颜色在调色板中的序号
+//返回值:序号,调色板中没有该颜色时返回0
+u8 LCD_Shadow_Index(u16 color)
+{
+	u8 i;
+
+	for(i=0;i<LCD_SHADOW_COLORS;i++)
+	{
+		if(shadow_pal[i]==color)return i;
+	}
+	return 0;
+}
+
+//填充矩形,超出影子区域的部分不画
+//(sx,sy),(ex,ey):矩形对角坐标
+//idx:调色板序号
+void LCD_Shadow_Fill(u16 sx,u16 sy,u16 ex,u16 ey,u8 idx)
+{
+	u8 pattern,old,nb,sh;
+	u8 *p;
+	u16 x,y;
+
+	if(ex>=LCD_SHADOW_W)ex=LCD_SHADOW_W-1;
+	if(ey>=LCD_SHADOW_H)ey=LCD_SHADOW_H-1;
+	if(sx>ex||sy>ey)return;
+	idx&=SHADOW_MASK;
+	pattern=idx;
+	for(x=LCD_SHADOW_BPP;x<8;x+=LCD_SHADOW_BPP)pattern|=pattern<<LCD_SHADOW_BPP;
+	for(y=sy;y<=ey;y++)
+	{
+		p=&shadow_buf[(u32)y*SHADOW_STRIDE];
+		x=sx;
+		while(x<=ex)
+		{
+			if(x%SHADOW_PPB==0&&x+SHADOW_PPB-1<=ex)	//整字节
+			{
+				if(p[x/SHADOW_PPB]!=pattern)
+				{
+					p[x/SHADOW_PPB]=pattern;
+					SHADOW_DIRTY(x,y);
+				}
+				x+=SHADOW_PPB;
+			}
+			else
+			{
+				sh=(x%SHADOW_PPB)*LCD_SHADOW_BPP;
+				old=p[x/SHADOW_PPB];
+				nb=(old&~(SHADOW_MASK<<sh))|(idx<<sh);
+				if(nb!=old)
+				{
+					p[x/SHADOW_PPB]=nb;
+					SHADOW_DIRTY(x,y);
+				}
+				x++;
+			}
+		}
+	}
+}
+
+//画点
+//x,y:坐标
+//idx:调色板序号
+void LCD_Shadow_Point(u16 x,u16 y,u8 idx)
+{
+	LCD_Shadow_Fill(x,y,x,y,idx);
+}
+
+//显示字符,前景和背景同时写入,每个像素只写一次,内容不变的块不会变脏
+//x,y:起始坐标
+//num:要显示的字符:" "--->"~"
+//size:字体大小,可以是12/16/24/32的整数倍
+//fg,bg:前景和背景的调色板序号
+void LCD_Shadow_Char(u16 x,u16 y,u8 num,u8 size,u8 fg,u8 bg)
+{
+	const u8 *font;
+	u8 base=LCD_FontBase(size);
+	u8 cbytes=base/8+((base%8)?1:0);
+	u8 scale,r,c;
+	u16 x0,y0;
+
+	if(base==0)return;
+	font=LCD_GetFont(num,base);
+	if(font==0)return;
+	scale=size/base;
+	for(c=0;c<base/2;c++)
+	{
+		x0=x+c*scale;
+		for(r=0;r<base;r++)
+		{
+			y0=y+r*scale;
+			LCD_Shadow_Fill(x0,y0,x0+scale-1,y0+scale-1,(font[c*cbytes+(r>>3)]&(0x80>>(r&7)))?fg:bg);
+		}
+	}
+}
+
+//显示字符串,换行规则与LCD_ShowString相同
+//x,y:起点坐标
+//width,height:区域大小
+//size:字体大小
+//*p:字符串起始地址
+//fg,bg:前景和背景的调色板序号
+void LCD_Shadow_String(u16 x,u16 y,u16 width,u16 height,u8 size,u8 *p,u8 fg,u8 bg)
+{
+	u16 x0=x;
+
+	width+=x;
+	height+=y;
+	while((*p<='~')&&(*p>=' '))
+	{
+		if(x>=width){x=x0;y+=size;}
+		if(y>=height)break;
+		LCD_Shadow_Char(x,y,*p,size,fg,bg);
+		x+=size/2;
+		p++;
+	}
+}
+
+//把变化的块写到屏幕上
+//同一块行中相邻的脏块合成一个窗口,逐像素查调色板连续写出
+//返回值:本次写出的块数
+u32 LCD_Shadow_Flush(void)
+{
+	u16 ty,t0,t1,sx,ex,sy,ey,x,y;
+	u32 bits,tiles=0;
+	u8 *p;
+
+	for(ty=0;ty<LCD_SHADOW_TY;ty++)
+	{
+		bits=shadow_dirty[ty];
+		shadow_dirty[ty]=0;
+		t0=0;
+		while(bits)
+		{
+			while((bits&1)==0)
+			{
+				bits>>=1;
+				t0++;
+			}
+			t1=t0;
+			while(bits&2)	//相邻的脏块
+			{
+				bits>>=1;
+				t1++;
+			}
+			bits>>=1;
+			tiles+=t1-t0+1;
+			sx=t0*LCD_SHADOW_TILE;
+			ex=(t1+1)*LCD_SHADOW_TILE-1;
+			sy=ty*LCD_SHADOW_TILE;
+			ey=sy+LCD_SHADOW_TILE-1;
+			if(ex>=LCD_SHADOW_W)ex=LCD_SHADOW_W-1;
+			if(ey>=LCD_SHADOW_H)ey=LCD_SHADOW_H-1;
+			LCD_Set_Window(sx,sy,ex,ey);
+			for(y=sy;y<=ey;y++)
+			{
+				p=&shadow_buf[(u32)y*SHADOW_STRIDE];
+				for(x=sx;x<=ex;x++)
+				{
+					LCD_PIXEL(shadow_pal[(p[x/SHADOW_PPB]>>((x%SHADOW_PPB)*LCD_SHADOW_BPP))&SHADOW_MASK]);
+				}
+			}
+			t0=t1+1;
+		}
+	}
+	lcd_shadow_tiles=tiles;
+	return tiles;
+}
+
+#endif
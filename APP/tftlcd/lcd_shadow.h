@@ -0,0 +1,38 @@
+#ifndef _lcd_shadow_H
+#define _lcd_shadow_H
+
+#include "system.h"
+
+
+//调色板影子帧缓冲  1:开启 0:关闭
+//2位色整屏320x480占38400字节,与字符点阵缓存同时开启时需减小LCD_GLYPH_BYTES
+#ifndef LCD_SHADOW
+#define LCD_SHADOW			0
+#endif
+
+#define LCD_SHADOW_BPP		2		//每像素位数,2:4色 4:16色
+#define LCD_SHADOW_W		320		//影子区域宽度,从屏幕左上角开始
+#define LCD_SHADOW_H		480		//影子区域高度,4位色时可减小高度只缓冲屏幕上部
+#define LCD_SHADOW_TILE		16		//脏标记的块大小(像素),宽度方向不超过32块
+
+#define LCD_SHADOW_COLORS	(1<<LCD_SHADOW_BPP)
+#define LCD_SHADOW_TX		((LCD_SHADOW_W+LCD_SHADOW_TILE-1)/LCD_SHADOW_TILE)	//每行块数
+#define LCD_SHADOW_TY		((LCD_SHADOW_H+LCD_SHADOW_TILE-1)/LCD_SHADOW_TILE)	//块行数
+
+
+#if LCD_SHADOW
+
+extern u32 lcd_shadow_tiles;	//上一次刷新写出的块数
+
+void LCD_Shadow_Init(void);											//清成颜色0,全部标记为脏
+void LCD_Shadow_Palette(const u16 *pal,u8 num);						//设置调色板
+u8 LCD_Shadow_Index(u16 color);										//颜色在调色板中的序号
+void LCD_Shadow_Fill(u16 sx,u16 sy,u16 ex,u16 ey,u8 idx);			//填充矩形
+void LCD_Shadow_Point(u16 x,u16 y,u8 idx);							//画点
+void LCD_Shadow_Char(u16 x,u16 y,u8 num,u8 size,u8 fg,u8 bg);		//显示字符
+void LCD_Shadow_String(u16 x,u16 y,u16 width,u16 height,u8 size,u8 *p,u8 fg,u8 bg);	//显示字符串
+u32 LCD_Shadow_Flush(void);											//把变化的块写到屏幕上
+
+#endif
+
+#endif
@@ -0,0 +1,176 @@
+#include "lcd_shot.h"
+#include "tftlcd.h"
+#include "usart.h"
+
+//截屏
+//逐行用LCD_ReadRect连续读出GRAM,按行做游程压缩后从USART1发送
+//界面大部分是纯色背景,压缩后一般只有原始数据的几十分之一,
+//115200波特率下一帧只需零点几秒到几秒
+//发送不占用CPU:两个缓冲轮流使用,DMA1通道4从一个缓冲发送到USART1时,
+//任务每次调用LCD_Shot_Poll读出压缩最多LCD_SHOT_ROWS行写入另一个缓冲,
+//每次调用只用很短时间,不影响其他任务;截屏期间界面有变化时,前后的行可能来自不同的画面
+//发送期间printf的输出丢弃(USART1_TX_MUTE),以免混入截屏数据
+
+static u16 shot_row[LCD_SHOT_MAXW];
+static u8 shot_buf[2][LCD_SHOT_BUF];
+static u16 shot_len;		//正在写的缓冲中的字节数
+static u8 shot_cur;			//正在写的缓冲
+static u8 shot_stage=0;		//0:空闲 1:读出各行 2:各行已读完,等待写入尾部 3:等待发送完
+static u16 shot_w,shot_h,shot_y;
+static u16 shot_row_max;	//一行最坏情况的压缩长度
+static u32 shot_sum;
+static u32 shot_bytes;
+
+
+//写一个字节
+static void Shot_Put(u8 c)
+{
+	shot_buf[shot_cur][shot_len++]=c;
+	shot_bytes++;
+}
+
+//写一个16位数
+static void Shot_Put16(u16 v)
+{
+	Shot_Put(v&0xff);
+	Shot_Put(v>>8);
+}
+
+//压缩一行
+//p:像素,n:像素数
+static void Shot_Row(const u16 *p,u16 n)
+{
+	u16 i=0,run,lit,k;
+
+	while(i<n)
+	{
+		run=1;
+		while(i+run<n&&run<128&&p[i+run]==p[i])run++;
+		if(run>=2)		//重复
+		{
+			Shot_Put(0x80|(run-1));
+			Shot_Put16(p[i]);
+			i+=run;
+			continue;
+		}
+		lit=1;			//直到下一段重复之前的像素直接发送
+		while(i+lit<n&&lit<128&&(i+lit+1>=n||p[i+lit+1]!=p[i+lit]))lit++;
+		Shot_Put(lit-1);
+		for(k=0;k<lit;k++)Shot_Put16(p[i+k]);
+		i+=lit;
+	}
+}
+
+//DMA正在发送时返回1
+static u8 Shot_DMA_Busy(void)
+{
+	return (DMA1_Channel4->CCR&DMA_CCR4_EN)&&DMA_GetFlagStatus(DMA1_FLAG_TC4)==RESET;
+}
+
+//把正在写的缓冲交给DMA发送,换另一个缓冲继续写
+static void Shot_DMA_Send(void)
+{
+	DMA_Cmd(DMA1_Channel4,DISABLE);
+	DMA1_Channel4->CMAR=(u32)(uintptr_t)shot_buf[shot_cur];
+	DMA1_Channel4->CNDTR=shot_len;
+	DMA_ClearFlag(DMA1_FLAG_TC4);
+	USART_ClearFlag(USART1,USART_FLAG_TC);	//最后一个字节发送完才再置位
+	DMA_Cmd(DMA1_Channel4,ENABLE);
+	shot_cur^=1;
+	shot_len=0;
+}
+
+//开始截屏
+//返回值:1,开始;0,上一次截屏还没发送完
+u8 LCD_Shot_Start(void)
+{
+	DMA_InitTypeDef DMA_InitStructure;
+
+	if(shot_stage)return 0;
+	RCC_AHBPeriphClockCmd(RCC_AHBPeriph_DMA1,ENABLE);	//DMA1通道4固定对应USART1_TX
+	DMA_DeInit(DMA1_Channel4);
+	DMA_InitStructure.DMA_PeripheralBaseAddr=(u32)(uintptr_t)&USART1->DR;
+	DMA_InitStructure.DMA_MemoryBaseAddr=(u32)(uintptr_t)shot_buf[0];
+	DMA_InitStructure.DMA_DIR=DMA_DIR_PeripheralDST;
+	DMA_InitStructure.DMA_BufferSize=1;
+	DMA_InitStructure.DMA_PeripheralInc=DMA_PeripheralInc_Disable;
+	DMA_InitStructure.DMA_MemoryInc=DMA_MemoryInc_Enable;
+	DMA_InitStructure.DMA_PeripheralDataSize=DMA_PeripheralDataSize_Byte;
+	DMA_InitStructure.DMA_MemoryDataSize=DMA_MemoryDataSize_Byte;
+	DMA_InitStructure.DMA_Mode=DMA_Mode_Normal;
+	DMA_InitStructure.DMA_Priority=DMA_Priority_Low;
+	DMA_InitStructure.DMA_M2M=DMA_M2M_Disable;
+	DMA_Init(DMA1_Channel4,&DMA_InitStructure);
+	USART_DMACmd(USART1,USART_DMAReq_Tx,ENABLE);
+
+	shot_w=tftlcd_data.width;
+	shot_h=tftlcd_data.height;
+	if(shot_w>LCD_SHOT_MAXW)shot_w=LCD_SHOT_MAXW;
+	shot_row_max=shot_w*2+(shot_w+127)/128;
+	shot_y=0;
+	shot_sum=0;
+	shot_bytes=0;
+	shot_cur=0;
+	shot_len=0;
+	Shot_Put('L');
+	Shot_Put('S');
+	Shot_Put(1);
+	Shot_Put(0);
+	Shot_Put16(shot_w);
+	Shot_Put16(shot_h);
+	USART1_TX_MUTE=1;
+	shot_stage=1;
+	return 1;
+}
+
+//读出压缩几行,DMA空闲时发送已写好的缓冲
+//返回值:1,还没发送完,需要继续调用;0,已发送完(或没有截屏)
+u8 LCD_Shot_Poll(void)
+{
+	u8 n;
+	u16 x;
+
+	if(shot_stage==0)return 0;
+	for(n=0;shot_stage==1&&n<LCD_SHOT_ROWS&&LCD_SHOT_BUF-shot_len>=shot_row_max;n++)
+	{
+		LCD_ReadRect(0,shot_y,shot_w-1,shot_y,shot_row);
+		for(x=0;x<shot_w;x++)shot_sum+=shot_row[x];
+		Shot_Row(shot_row,shot_w);
+		if(++shot_y==shot_h)shot_stage=2;
+	}
+	if(shot_stage==2&&LCD_SHOT_BUF-shot_len>=6)
+	{
+		Shot_Put('E');
+		Shot_Put('S');
+		Shot_Put16(shot_sum&0xffff);
+		Shot_Put16(shot_sum>>16);
+		shot_stage=3;
+	}
+	if(Shot_DMA_Busy())return 1;
+	if(shot_len)
+	{
+		Shot_DMA_Send();
+		return 1;
+	}
+	if(shot_stage==3&&USART_GetFlagStatus(USART1,USART_FLAG_TC)!=RESET)
+	{
+		USART_DMACmd(USART1,USART_DMAReq_Tx,DISABLE);
+		DMA_Cmd(DMA1_Channel4,DISABLE);
+		USART1_TX_MUTE=0;
+		shot_stage=0;
+		return 0;
+	}
+	return 1;
+}
+
+//截屏正在发送时返回1
+u8 LCD_Shot_Busy(void)
+{
+	return shot_stage!=0;
+}
+
+//最近一次截屏已发送的字节数
+u32 LCD_Shot_Bytes(void)
+{
+	return shot_bytes;
+}
@@ -0,0 +1,24 @@
+#ifndef _lcd_shot_H
+#define _lcd_shot_H
+
+#include "system.h"
+
+
+#define LCD_SHOT_MAXW		480		//一行最多像素数,即屏幕长边
+#define LCD_SHOT_BUF		2048	//两个发送缓冲各自的字节数,不小于一行最坏情况的压缩长度(长边的2倍多一点)
+#define LCD_SHOT_ROWS		16		//每次LCD_Shot_Poll最多读出压缩的行数
+
+
+//截屏数据格式(与tools/lcdshot.py对应),多字节数均为低字节在前:
+//头8字节: 'L' 'S' 版本(1) 保留(0) 宽(16位) 高(16位)
+//之后按行编码,游程不跨行:
+//0nnnnnnn	后面跟n+1个像素,每个像素2字节
+//1nnnnnnn	后面1个像素重复n+1次
+//尾6字节: 'E' 'S' 全部像素值之和(32位)
+
+u8 LCD_Shot_Start(void);		//开始截屏,返回0表示上一次截屏还没发送完
+u8 LCD_Shot_Poll(void);			//在任务中反复调用,读出压缩几行交给DMA发送,返回0表示已发送完
+u8 LCD_Shot_Busy(void);			//截屏正在发送时返回1
+u32 LCD_Shot_Bytes(void);		//最近一次截屏已发送的字节数
+
+#endif
@@ -1,2804 +1,1472 @@
-const unsigned char gImage_picture[44800] = { /* 0X00,0X10,0XC8,0X00,0X70,0X00,0X01,0X1B, */
-0X8A,0X4A,0X8A,0X4A,0X8A,0X4A,0X8A,0X4A,0X8A,0X4A,0X8A,0X4A,0X8A,0X4A,0X8A,0X4A,
-0X8A,0X4A,0X8A,0X4A,0X8A,0X4A,0X8A,0X4A,0X8A,0X4A,0X8A,0X4A,0XAA,0X52,0XAA,0X52,
-0XAA,0X52,0XAA,0X52,0XAA,0X52,0XAA,0X52,0XAB,0X52,0XAB,0X52,0XAB,0X52,0XAB,0X52,
-0XAB,0X52,0XCB,0X52,0XCB,0X52,0XCB,0X52,0XCB,0X52,0XCB,0X52,0XCB,0X52,0XCB,0X52,
-0XCB,0X52,0XCB,0X52,0XEB,0X5A,0XCB,0X52,0XCB,0X52,0XEB,0X5A,0XEB,0X5A,0XEB,0X5A,
-0XEC,0X5A,0XEB,0X5A,0XEC,0X5A,0X0C,0X5B,0X0C,0X5B,0X0C,0X5B,0XEC,0X5A,0X0C,0X5B,
-0X0C,0X5B,0X0C,0X5B,0X0C,0X5B,0X0C,0X5B,0X0C,0X5B,0X2C,0X63,0X2C,0X63,0X0C,0X5B,
-0X2C,0X63,0X0C,0X5B,0X2C,0X63,0X0C,0X63,0X2C,0X5B,0X2C,0X63,0X0C,0X5B,0XEB,0X5A,
-0X4D,0X63,0X4D,0X63,0X4D,0X63,0X4D,0X6B,0XEC,0X5A,0X2C,0X63,0X0C,0X5B,0X6E,0X6B,
-0XAA,0X52,0X24,0X21,0XA2,0X18,0XE3,0X18,0X45,0X29,0X04,0X21,0X04,0X21,0X24,0X21,
-0XE3,0X18,0XC3,0X18,0XA2,0X18,0XC3,0X18,0XC3,0X18,0XA2,0X18,0XA2,0X18,0XC2,0X18,
-0XA2,0X10,0X82,0X10,0XA2,0X10,0XA2,0X10,0X82,0X10,0X61,0X08,0X61,0X08,0X40,0X08,
-0X41,0X08,0X61,0X08,0X82,0X10,0X61,0X10,0X40,0X08,0X61,0X08,0X41,0X08,0X82,0X10,
-0XA2,0X10,0XE3,0X20,0XC3,0X18,0XC3,0X18,0XE3,0X20,0X65,0X31,0X08,0X42,0X08,0X42,
-0XEB,0X5A,0XAB,0X52,0X4D,0X6B,0X4D,0X63,0X4D,0X63,0X4D,0X63,0X4D,0X63,0X4D,0X63,
-0X4D,0X63,0X6D,0X6B,0X4D,0X63,0X4D,0X6B,0X4D,0X6B,0X4D,0X63,0X4D,0X63,0X4D,0X63,
-0X4D,0X63,0X4D,0X63,0X4D,0X63,0X4D,0X63,0X4D,0X63,0X2D,0X63,0X4D,0X63,0X2D,0X63,
-0X2D,0X63,0X2D,0X63,0X2C,0X63,0X2C,0X63,0X2C,0X63,0X0C,0X63,0X2C,0X63,0X0C,0X63,
-0X0C,0X63,0X0C,0X5B,0X0C,0X63,0X0C,0X63,0X0C,0X5B,0X0C,0X63,0X0C,0X63,0X0C,0X5B,
-0XEC,0X5A,0XEC,0X5A,0XEC,0X5A,0XEC,0X5A,0XEC,0X5A,0XEC,0X5A,0XEC,0X5A,0XEC,0X5A,
-0XEB,0X5A,0XEB,0X5A,0XCB,0X5A,0XEB,0X5A,0XCB,0X5A,0XEB,0X5A,0XCB,0X5A,0XCB,0X5A,
-0XCB,0X5A,0XCB,0X52,0XCB,0X5A,0XAB,0X52,0XAB,0X52,0XAB,0X52,0XAB,0X52,0XAB,0X52,
-0XAB,0X52,0XAA,0X52,0XAA,0X52,0X8A,0X52,0XAA,0X52,0X8A,0X52,0XAA,0X52,0X8A,0X52,
-0X8A,0X52,0X8A,0X52,0X8A,0X52,0X8A,0X52,0X8A,0X52,0X8A,0X52,0X8A,0X52,0X8A,0X4A,
-0X8A,0X4A,0X8A,0X52,0X6A,0X4A,0X8A,0X4A,0X8A,0X4A,0X8A,0X4A,0X6A,0X4A,0X8A,0X4A,
-0X8A,0X4A,0X8A,0X4A,0X8A,0X4A,0X8A,0X4A,0X8A,0X4A,0X8A,0X4A,0X8A,0X4A,0X8A,0X4A,
-0X8A,0X4A,0X8A,0X4A,0X8A,0X4A,0XAA,0X52,0X8A,0X4A,0XAA,0X52,0XAA,0X52,0XAA,0X52,
-0XAA,0X52,0XAA,0X52,0XAA,0X52,0XAB,0X52,0XAA,0X52,0XAB,0X52,0XAB,0X52,0XCB,0X52,
-0XCB,0X52,0XCB,0X52,0XCB,0X52,0XCB,0X52,0XCB,0X52,0XCB,0X52,0XCB,0X52,0XCB,0X52,
-0XEB,0X5A,0XCB,0X52,0XCB,0X52,0XCB,0X52,0XEB,0X5A,0XEB,0X5A,0XEB,0X5A,0XEC,0X5A,
-0XEB,0X5A,0XEC,0X5A,0X0C,0X5B,0X0C,0X5B,0X0C,0X5B,0X0C,0X5B,0X0C,0X5B,0X0C,0X5B,
-0X0C,0X5B,0X0C,0X5B,0X0C,0X5B,0X2C,0X63,0X2C,0X63,0X0C,0X5B,0X2C,0X63,0X2C,0X63,
-0X2C,0X63,0X2D,0X63,0X0C,0X63,0X0C,0X63,0X2C,0X63,0X2C,0X63,0X4D,0X63,0XEC,0X5A,
-0X2C,0X63,0X4D,0X6B,0X4D,0X6B,0XCB,0X5A,0X4D,0X6B,0X0C,0X5B,0X6C,0X6B,0X86,0X31,
-0X61,0X10,0XA3,0X10,0X04,0X21,0X25,0X29,0X04,0X21,0X04,0X21,0XE4,0X20,0XE3,0X18,
-0XC3,0X18,0XA3,0X18,0XC3,0X18,0XC3,0X18,0XA3,0X18,0X82,0X10,0X81,0X10,0X82,0X10,
-0XA2,0X18,0X61,0X08,0X41,0X08,0X82,0X10,0X61,0X10,0X61,0X08,0X21,0X08,0X40,0X08,
-0X61,0X08,0X20,0X08,0X41,0X08,0X61,0X08,0X82,0X10,0X61,0X08,0X82,0X10,0X41,0X08,
-0X61,0X08,0X82,0X10,0XE3,0X20,0X04,0X21,0XC3,0X18,0XA2,0X10,0XC3,0X18,0X65,0X29,
-0XC7,0X39,0XAA,0X52,0X6A,0X4A,0X4D,0X63,0X6E,0X6B,0X4D,0X63,0X8E,0X6B,0X4D,0X63,
-0X6D,0X6B,0X6D,0X6B,0X6D,0X6B,0X6D,0X6B,0X6D,0X6B,0X6D,0X6B,0X4D,0X6B,0X4D,0X6B,
-0X4D,0X6B,0X4D,0X6B,0X4D,0X63,0X4D,0X63,0X4D,0X63,0X4D,0X63,0X4D,0X6B,0X4D,0X63,
-0X4D,0X63,0X2D,0X63,0X2D,0X63,0X2C,0X63,0X2D,0X63,0X2C,0X63,0X2C,0X63,0X2C,0X63,
-0X2C,0X63,0X2C,0X63,0X0C,0X63,0X0C,0X63,0X0C,0X63,0X0C,0X63,0X0C,0X5B,0X0C,0X5B,
-0X0C,0X5B,0X0C,0X5B,0X0C,0X5B,0XEC,0X5A,0X0C,0X5B,0X0C,0X5B,0XEC,0X5A,0XEC,0X5A,
-0XEC,0X5A,0XEB,0X5A,0XEB,0X5A,0XEB,0X5A,0XCB,0X5A,0XCB,0X5A,0XEB,0X5A,0XCB,0X5A,
-0XCB,0X5A,0XCB,0X5A,0XCB,0X52,0XCB,0X5A,0XCB,0X52,0XCB,0X52,0XAB,0X52,0XAB,0X52,
-0XAB,0X52,0XAB,0X52,0XAA,0X52,0XAA,0X52,0XAA,0X52,0X8A,0X52,0X8A,0X52,0XAA,0X52,
-0X8A,0X52,0X8A,0X52,0X8A,0X52,0X8A,0X52,0X8A,0X52,0X8A,0X52,0X8A,0X4A,0X8A,0X4A,
-0X8A,0X52,0X8A,0X52,0X8A,0X4A,0X6A,0X4A,0X6A,0X4A,0X8A,0X4A,0X6A,0X4A,0X8A,0X4A,
-0X8A,0X4A,0X8A,0X4A,0X8A,0X4A,0X8A,0X4A,0X8A,0X4A,0X8A,0X4A,0X8A,0X4A,0X8A,0X4A,
-0X8A,0X4A,0XAA,0X52,0XAA,0X52,0X8A,0X4A,0XAA,0X52,0XAA,0X52,0XAA,0X52,0XAA,0X52,
-0XAA,0X52,0XAA,0X52,0XAB,0X52,0XAB,0X52,0XAA,0X52,0XCB,0X52,0XAB,0X52,0XCB,0X52,
-0XCB,0X52,0XCB,0X52,0XCB,0X52,0XCB,0X52,0XCB,0X52,0XCB,0X52,0XCB,0X52,0XCB,0X52,
-0XEB,0X5A,0XEB,0X5A,0XEB,0X5A,0XEB,0X5A,0XEB,0X5A,0XEB,0X5A,0XEB,0X5A,0XEC,0X5A,
-0XEC,0X5A,0X0C,0X5B,0X0C,0X5B,0X0C,0X5B,0X0C,0X5B,0X0C,0X5B,0X0C,0X5B,0X0C,0X5B,
-0X0C,0X5B,0X0C,0X5B,0X0C,0X5B,0X2C,0X63,0X2C,0X63,0X2C,0X63,0X2C,0X63,0X2C,0X63,
-0X0C,0X63,0X2D,0X63,0X4D,0X63,0X0C,0X5B,0X0C,0X5B,0X4D,0X63,0X2C,0X63,0X2C,0X63,
-0X0C,0X63,0X4D,0X63,0XEB,0X5A,0X4D,0X6B,0X2C,0X63,0XEB,0X5A,0XE3,0X20,0X61,0X10,
-0XC3,0X18,0X25,0X29,0X04,0X21,0X24,0X21,0X45,0X29,0X25,0X29,0X04,0X21,0X04,0X21,
-0XE3,0X20,0XE3,0X20,0XC3,0X18,0XA2,0X18,0XA2,0X18,0XA2,0X10,0X61,0X08,0X41,0X08,
-0X61,0X10,0XC3,0X18,0X81,0X10,0X81,0X10,0X81,0X10,0XA2,0X10,0X61,0X08,0X82,0X10,
-0XA2,0X18,0XA2,0X18,0X82,0X10,0X82,0X10,0X81,0X10,0X81,0X10,0XA2,0X10,0X21,0X08,
-0X41,0X08,0X41,0X08,0X62,0X10,0XE3,0X20,0X65,0X29,0X24,0X21,0X82,0X10,0X82,0X10,
-0XE3,0X18,0X86,0X31,0X8A,0X52,0X8A,0X52,0X0C,0X63,0X6D,0X6B,0X4D,0X63,0X8E,0X6B,
-0X8E,0X6B,0X6E,0X6B,0X8E,0X6B,0X6D,0X6B,0X6D,0X6B,0X6D,0X6B,0X6D,0X6B,0X6D,0X6B,
-0X4D,0X6B,0X4D,0X6B,0X6D,0X6B,0X6D,0X6B,0X4D,0X63,0X4D,0X6B,0X4D,0X6B,0X4D,0X6B,
-0X4D,0X6B,0X4D,0X6B,0X2D,0X63,0X4D,0X63,0X4D,0X63,0X2D,0X63,0X2C,0X63,0X2C,0X63,
-0X2C,0X63,0X2C,0X63,0X2C,0X63,0X2C,0X63,0X2C,0X63,0X2C,0X5B,0X0C,0X5B,0X0C,0X5B,
-0X0C,0X63,0X0C,0X5B,0X0C,0X5B,0X0C,0X5B,0X0C,0X5B,0X0C,0X5B,0X0C,0X5B,0X0C,0X5B,
-0XEC,0X5A,0XEB,0X5A,0XEC,0X5A,0XEC,0X5A,0XEB,0X5A,0XEB,0X5A,0XEB,0X5A,0XEB,0X5A,
-0XCB,0X5A,0XCB,0X5A,0XCB,0X5A,0XCB,0X5A,0XCB,0X5A,0XCB,0X52,0XAB,0X52,0XAB,0X52,
-0XAB,0X52,0XAB,0X52,0XAB,0X52,0XAA,0X52,0XAA,0X52,0XAA,0X52,0XAA,0X52,0X8A,0X52,
-0XAA,0X52,0X8A,0X52,0X8A,0X52,0X8A,0X52,0X8A,0X52,0X8A,0X52,0X8A,0X52,0X8A,0X52,
-0X8A,0X52,0X8A,0X52,0X89,0X4A,0X8A,0X4A,0X6A,0X4A,0X6A,0X4A,0X8A,0X4A,0X8A,0X52,
-0X8A,0X4A,0X8A,0X4A,0X8A,0X4A,0X8A,0X4A,0X8A,0X4A,0X8A,0X4A,0X8A,0X4A,0X8A,0X4A,
-0X8A,0X4A,0XAA,0X52,0X8A,0X4A,0XAA,0X52,0XAA,0X52,0XAA,0X52,0XAA,0X52,0XAA,0X52,
-0XAA,0X52,0XAA,0X52,0XAA,0X52,0XAB,0X52,0XAB,0X52,0XAB,0X52,0XAB,0X52,0XCB,0X52,
-0XCB,0X52,0XCB,0X52,0XCB,0X52,0XCB,0X52,0XCB,0X52,0XEB,0X5A,0XCB,0X52,0XEB,0X5A,
-0XEB,0X5A,0XEB,0X5A,0XEB,0X5A,0XEB,0X5A,0XEB,0X5A,0XEC,0X5A,0XEC,0X5A,0X0C,0X5B,
-0X0C,0X5B,0X0C,0X5B,0X0C,0X5B,0X0C,0X5B,0X0C,0X5B,0X0C,0X5B,0X0C,0X5B,0X0C,0X5B,
-0X0C,0X5B,0X0C,0X5B,0X2C,0X63,0X2C,0X63,0X2C,0X63,0X2C,0X63,0X2C,0X63,0X2D,0X63,
-0X2C,0X63,0X4D,0X63,0X4D,0X63,0X2D,0X63,0X2C,0X63,0X2C,0X63,0X4D,0X6B,0X2D,0X63,
-0XEB,0X5A,0XEC,0X5A,0X4D,0X6B,0XEC,0X5A,0X69,0X52,0X81,0X10,0XA2,0X18,0XE3,0X20,
-0X04,0X21,0X24,0X29,0X45,0X29,0X45,0X29,0X24,0X21,0XE3,0X18,0XC3,0X18,0XE3,0X20,
-0XC3,0X18,0X82,0X10,0XC3,0X18,0XC3,0X18,0XE3,0X20,0XA2,0X18,0XA2,0X18,0X82,0X10,
-0XA2,0X10,0XA2,0X10,0XC2,0X18,0X82,0X10,0XA2,0X18,0XC3,0X18,0XE3,0X18,0XA2,0X18,
-0X82,0X10,0XA2,0X18,0X82,0X10,0X61,0X10,0X61,0X08,0X82,0X10,0X81,0X10,0X82,0X10,
-0X61,0X10,0X61,0X08,0X61,0X08,0XA2,0X10,0XA2,0X18,0X25,0X29,0X45,0X29,0X04,0X21,
-0X82,0X10,0X61,0X10,0X24,0X29,0X28,0X42,0X69,0X4A,0X0C,0X63,0X4D,0X6B,0X8E,0X6B,
-0X8E,0X6B,0X8E,0X6B,0X8E,0X6B,0X6E,0X6B,0X6E,0X6B,0X6E,0X6B,0X6E,0X6B,0X6D,0X6B,
-0X6D,0X6B,0X6D,0X6B,0X6D,0X6B,0X6D,0X6B,0X6D,0X6B,0X4D,0X6B,0X6D,0X6B,0X4D,0X6B,
-0X4D,0X6B,0X4D,0X6B,0X4D,0X6B,0X4D,0X6B,0X4D,0X63,0X4D,0X63,0X4D,0X63,0X4D,0X63,
-0X4D,0X63,0X2C,0X63,0X2C,0X63,0X2C,0X63,0X2C,0X63,0X2C,0X63,0X0C,0X63,0X0C,0X63,
-0X0C,0X5B,0X0C,0X5B,0X0C,0X5B,0X0C,0X5B,0X0C,0X5B,0X0C,0X5B,0X0C,0X5B,0X0C,0X5B,
-0XEC,0X5A,0XEC,0X5A,0XEB,0X5A,0XEB,0X5A,0XEB,0X5A,0XEB,0X5A,0XEB,0X5A,0XEB,0X5A,
-0XCB,0X5A,0XCB,0X5A,0XCB,0X5A,0XCB,0X5A,0XCB,0X5A,0XCB,0X5A,0XCB,0X52,0XAB,0X52,
-0XAB,0X52,0XAB,0X52,0XAB,0X52,0XAB,0X52,0XAA,0X52,0XAA,0X52,0XAA,0X52,0XAA,0X52,
-0X8A,0X52,0X8A,0X52,0X8A,0X52,0X8A,0X52,0X8A,0X52,0X8A,0X52,0X8A,0X52,0X8A,0X52,
-0X8A,0X4A,0X8A,0X52,0X8A,0X4A,0X8A,0X52,0X8A,0X4A,0X8A,0X4A,0X6A,0X4A,0X8A,0X52,
-0X8A,0X4A,0X8A,0X4A,0X8A,0X4A,0X8A,0X4A,0X8A,0X4A,0X8A,0X4A,0X8A,0X4A,0X8A,0X4A,
-0X8A,0X4A,0X8A,0X4A,0X8A,0X4A,0XAA,0X52,0XAA,0X52,0XAA,0X52,0XAA,0X52,0XAA,0X52,
-0XAA,0X52,0XAA,0X52,0XAB,0X52,0XAA,0X52,0XCB,0X52,0XCB,0X52,0XCB,0X52,0XCB,0X52,
-0XCB,0X52,0XCB,0X52,0XCB,0X52,0XEB,0X5A,0XEB,0X5A,0XEB,0X5A,0XCB,0X52,0XCB,0X52,
-0XEB,0X5A,0XEB,0X5A,0XEB,0X5A,0XEB,0X5A,0XEB,0X5A,0XEB,0X5A,0XEC,0X5A,0XEC,0X5A,
-0X0C,0X5B,0X0C,0X5B,0X0C,0X5B,0X0C,0X5B,0X0C,0X5B,0X0C,0X5B,0X0C,0X5B,0X2C,0X63,
-0X2C,0X63,0X2C,0X63,0X2C,0X63,0X2C,0X63,0X2D,0X63,0X2C,0X63,0X4D,0X63,0X4D,0X63,
-0X4D,0X63,0X2D,0X63,0X6D,0X6B,0X2C,0X63,0X4D,0X63,0X2C,0X63,0X4D,0X6B,0X4D,0X6B,
-0XAA,0X52,0X0C,0X63,0X0C,0X63,0X28,0X4A,0X81,0X10,0XC2,0X18,0XE3,0X20,0X04,0X21,
-0X25,0X29,0X65,0X29,0X45,0X29,0XE3,0X20,0X24,0X21,0X04,0X21,0X04,0X21,0XC3,0X18,
-0XC3,0X18,0XC3,0X18,0XA2,0X10,0X61,0X10,0X81,0X10,0XE3,0X20,0X04,0X21,0XC3,0X18,
-0X82,0X10,0X81,0X10,0XC3,0X18,0X04,0X21,0XE3,0X20,0XA2,0X18,0XC3,0X18,0XA2,0X18,
-0X82,0X10,0X61,0X10,0X61,0X10,0X41,0X10,0X81,0X10,0X61,0X10,0X82,0X10,0XA2,0X10,
-0X82,0X10,0X40,0X08,0X81,0X10,0X61,0X08,0X82,0X10,0XC3,0X18,0X24,0X29,0X24,0X21,
-0X25,0X29,0XE4,0X20,0X82,0X10,0X04,0X21,0X28,0X42,0X69,0X4A,0X0C,0X5B,0X2C,0X63,
-0X8E,0X6B,0X8E,0X6B,0X8E,0X6B,0X8E,0X6B,0X8E,0X6B,0X8E,0X6B,0X6E,0X6B,0X8E,0X6B,
-0X8E,0X6B,0X6E,0X6B,0X6D,0X6B,0X6D,0X6B,0X6D,0X6B,0X6D,0X6B,0X4D,0X6B,0X4D,0X6B,
-0X4D,0X6B,0X4D,0X6B,0X6D,0X6B,0X4D,0X6B,0X4D,0X6B,0X4D,0X63,0X4D,0X63,0X4D,0X63,
-0X4D,0X63,0X2D,0X63,0X2D,0X63,0X2C,0X63,0X2C,0X63,0X2C,0X63,0X0C,0X63,0X2C,0X63,
-0X2C,0X5B,0X0C,0X5B,0X0C,0X5B,0X0C,0X5B,0X0C,0X5B,0X0C,0X63,0XEC,0X5A,0X0C,0X63,
-0XEC,0X5A,0XEC,0X5A,0XEC,0X5A,0XEC,0X5A,0XEB,0X5A,0XEB,0X5A,0XEC,0X5A,0XEB,0X5A,
-0XCB,0X5A,0XEB,0X5A,0XCB,0X5A,0XCB,0X5A,0XCB,0X5A,0XCB,0X5A,0XCB,0X5A,0XCB,0X52,
-0XCB,0X52,0XAB,0X52,0XAB,0X52,0XAB,0X52,0XAA,0X52,0XAA,0X52,0XAB,0X52,0X8A,0X52,
-0X8A,0X52,0XAA,0X52,0X8A,0X52,0X8A,0X52,0X8A,0X52,0X8A,0X52,0X8A,0X52,0X8A,0X52,
-0X8A,0X52,0X8A,0X52,0X8A,0X4A,0X8A,0X4A,0X8A,0X52,0X6A,0X4A,0X6A,0X4A,0X8A,0X52,
-0X8A,0X4A,0X8A,0X4A,0X8A,0X4A,0X8A,0X4A,0X8A,0X4A,0X8A,0X4A,0X8A,0X4A,0XAA,0X52,
-0XAA,0X52,0XAA,0X52,0XAA,0X52,0X8A,0X52,0X8A,0X52,0XAA,0X52,0XAA,0X52,0XAA,0X52,
-0XAA,0X52,0XAB,0X52,0XAB,0X52,0XAA,0X52,0XCB,0X52,0XCB,0X52,0XCB,0X52,0XCB,0X52,
-0XCB,0X52,0XCB,0X52,0XCB,0X52,0XEB,0X5A,0XEB,0X5A,0XCB,0X52,0XEB,0X5A,0XEB,0X5A,
-0XEB,0X5A,0XEB,0X5A,0XEB,0X5A,0XEC,0X5A,0XEB,0X5A,0X0C,0X5B,0X0C,0X5B,0XEC,0X5A,
-0X0C,0X5B,0X0C,0X5B,0X0C,0X5B,0X0C,0X5B,0X0C,0X5B,0X2C,0X63,0X2C,0X63,0X2C,0X63,
-0X2C,0X63,0X2C,0X63,0X2C,0X63,0X2D,0X63,0X2D,0X63,0X2D,0X63,0X2D,0X63,0X4D,0X63,
-0X4D,0X63,0X4D,0X63,0X2C,0X63,0X6D,0X6B,0X6D,0X6B,0X2D,0X63,0X2C,0X63,0X2C,0X63,
-0X0C,0X63,0X8A,0X52,0XC6,0X39,0X81,0X10,0XA2,0X18,0X04,0X21,0X24,0X21,0X24,0X29,
-0X86,0X31,0X04,0X21,0X04,0X21,0X45,0X29,0X04,0X21,0XE3,0X20,0XC3,0X18,0XC3,0X18,
-0X03,0X21,0XE3,0X20,0XC3,0X18,0XE3,0X20,0XE3,0X20,0XE3,0X20,0XE3,0X20,0X04,0X21,
-0X24,0X29,0X45,0X31,0X65,0X31,0X03,0X21,0X03,0X21,0XE3,0X20,0XA2,0X18,0XA2,0X18,
-0XA2,0X18,0X82,0X10,0X82,0X10,0X82,0X10,0X82,0X10,0X61,0X10,0X81,0X10,0X61,0X10,
-0XA2,0X10,0X61,0X08,0X20,0X08,0X41,0X08,0X61,0X08,0XC2,0X18,0XC3,0X18,0X45,0X29,
-0X45,0X29,0XE3,0X20,0XE3,0X18,0XA2,0X18,0XE3,0X18,0XA6,0X39,0X89,0X52,0X0C,0X63,
-0X0C,0X63,0X6E,0X6B,0X8E,0X73,0X8E,0X6B,0X8E,0X6B,0X8E,0X6B,0X8E,0X6B,0X8E,0X6B,
-0X6D,0X6B,0X6E,0X6B,0X8E,0X6B,0X6E,0X6B,0X6E,0X6B,0X6D,0X6B,0X6E,0X6B,0X6E,0X6B,
-0X6D,0X6B,0X6D,0X6B,0X6D,0X6B,0X6D,0X6B,0X4D,0X6B,0X4D,0X6B,0X4D,0X63,0X4D,0X63,
-0X4D,0X63,0X4D,0X63,0X4D,0X63,0X4D,0X63,0X2D,0X63,0X2C,0X63,0X2C,0X63,0X2C,0X63,
-0X2C,0X63,0X2C,0X63,0X2C,0X63,0X0C,0X5B,0X0C,0X5B,0X0C,0X5B,0X0C,0X5B,0X0C,0X63,
-0X0C,0X63,0X0C,0X5B,0X0C,0X5B,0XEC,0X5A,0XEC,0X5A,0XEC,0X5A,0XEB,0X5A,0XEB,0X5A,
-0XEB,0X5A,0XEB,0X5A,0XEB,0X5A,0XCB,0X5A,0XCB,0X5A,0XCB,0X52,0XCB,0X52,0XCB,0X5A,
-0XCB,0X5A,0XCB,0X52,0XCB,0X52,0XAB,0X52,0XAB,0X52,0XAA,0X52,0XAB,0X52,0XAA,0X52,
-0X8A,0X52,0X8A,0X52,0XAA,0X52,0XAA,0X52,0X8A,0X52,0X8A,0X52,0X8A,0X52,0X8A,0X52,
-0X8A,0X52,0X8A,0X52,0X8A,0X52,0X8A,0X52,0X8A,0X52,0X6A,0X4A,0X6A,0X4A,0X8A,0X52,
-0X8A,0X4A,0X8A,0X4A,0X8A,0X4A,0X8A,0X4A,0X8A,0X4A,0X8A,0X4A,0XAA,0X52,0XAA,0X52,
-0X8A,0X4A,0XAA,0X52,0XAA,0X52,0XAA,0X52,0XAA,0X52,0XAA,0X52,0XAA,0X52,0XAA,0X52,
-0XAA,0X52,0XAB,0X52,0XAB,0X52,0XAB,0X52,0XCB,0X52,0XCB,0X52,0XCB,0X52,0XCB,0X52,
-0XCB,0X52,0XCB,0X52,0XCB,0X52,0XCB,0X52,0XEB,0X5A,0XEB,0X5A,0XEB,0X5A,0XEB,0X5A,
-0XEC,0X5A,0XEB,0X5A,0XEC,0X5A,0XEC,0X5A,0XEC,0X5A,0X0C,0X5B,0X0C,0X5B,0X0C,0X5B,
-0X0C,0X5B,0X0C,0X5B,0X0C,0X5B,0X2C,0X63,0X2C,0X63,0X2C,0X63,0X2C,0X63,0X2C,0X63,
-0X2C,0X63,0X2D,0X63,0X2D,0X63,0X4D,0X63,0X4D,0X63,0X4D,0X63,0X4D,0X63,0X4D,0X63,
-0X4D,0X63,0X6D,0X6B,0X4D,0X63,0X4D,0X63,0X8E,0X6B,0X6D,0X6B,0X0C,0X63,0XAB,0X52,
-0X2C,0X63,0XA6,0X39,0X81,0X10,0XC3,0X18,0X45,0X29,0X25,0X29,0X24,0X21,0X45,0X29,
-0X24,0X21,0X24,0X21,0X45,0X29,0X24,0X29,0X24,0X29,0X04,0X21,0X04,0X21,0X24,0X29,
-0X82,0X10,0X61,0X10,0XC3,0X18,0XC3,0X18,0XA2,0X10,0X82,0X10,0XE3,0X18,0X44,0X29,
-0X44,0X29,0X24,0X29,0X24,0X29,0X24,0X29,0XE3,0X20,0XC3,0X18,0XA2,0X18,0XC3,0X18,
-0XC2,0X18,0X82,0X10,0X82,0X10,0X82,0X10,0X82,0X10,0X82,0X10,0XA2,0X10,0XA2,0X10,
-0X82,0X10,0XA2,0X18,0X61,0X10,0X61,0X08,0XA2,0X10,0XC2,0X18,0XE3,0X18,0X24,0X29,
-0X24,0X29,0X24,0X21,0XE3,0X18,0XE3,0X18,0XC3,0X18,0XC2,0X18,0X65,0X29,0X8A,0X52,
-0X2C,0X63,0X2D,0X63,0X4D,0X6B,0XAE,0X73,0XAE,0X73,0XAE,0X73,0X6E,0X6B,0X6E,0X6B,
-0X8E,0X6B,0X8E,0X6B,0X8E,0X6B,0X8E,0X6B,0X8E,0X6B,0X8E,0X6B,0X8E,0X6B,0X6E,0X6B,
-0X8E,0X6B,0X6E,0X6B,0X6E,0X6B,0X6D,0X6B,0X6D,0X6B,0X6D,0X6B,0X6D,0X6B,0X4D,0X63,
-0X4D,0X63,0X4D,0X63,0X4D,0X63,0X4D,0X63,0X4D,0X63,0X4D,0X63,0X2D,0X63,0X2C,0X63,
-0X2C,0X63,0X2C,0X63,0X2C,0X63,0X2C,0X63,0X2C,0X63,0X2C,0X5B,0X0C,0X63,0X0C,0X63,
-0X0C,0X63,0X0C,0X5B,0X0C,0X63,0XEC,0X5A,0XEC,0X5A,0XEC,0X5A,0XEC,0X5A,0XEB,0X5A,
-0XEC,0X5A,0XEB,0X5A,0XEB,0X5A,0XEB,0X5A,0XEB,0X5A,0XCB,0X5A,0XCB,0X52,0XCB,0X5A,
-0XCB,0X5A,0XCB,0X5A,0XCB,0X5A,0XCB,0X52,0XAB,0X52,0XAB,0X52,0XAB,0X52,0XAB,0X52,
-0XAA,0X52,0XAA,0X52,0XAA,0X52,0XAA,0X52,0X8A,0X52,0X8A,0X52,0X8A,0X52,0X8A,0X52,
-0X8A,0X52,0X8A,0X52,0X8A,0X52,0X8A,0X52,0X8A,0X4A,0X8A,0X4A,0X8A,0X4A,0X8A,0X52,
-0X8A,0X4A,0X8A,0X4A,0X8A,0X4A,0X8A,0X4A,0X8A,0X4A,0X8A,0X4A,0XAA,0X52,0XAA,0X52,
-0XAA,0X52,0XAA,0X52,0XAA,0X52,0XAA,0X52,0XAA,0X52,0XAA,0X52,0XAA,0X52,0XAA,0X52,
-0XAB,0X52,0XAB,0X52,0XCB,0X52,0XCB,0X52,0XCB,0X52,0XCB,0X52,0XCB,0X52,0XCB,0X52,
-0XCB,0X52,0XCB,0X52,0XEB,0X5A,0XEB,0X5A,0XEB,0X5A,0XEB,0X5A,0XEB,0X5A,0XEB,0X5A,
-0XEB,0X5A,0XEC,0X5A,0XEC,0X5A,0X0C,0X5B,0XEC,0X5A,0X0C,0X5B,0X0C,0X5B,0X0C,0X5B,
-0X0C,0X5B,0X0C,0X5B,0X0C,0X5B,0X2C,0X63,0X2C,0X63,0X2C,0X63,0X2C,0X63,0X2D,0X63,
-0X2D,0X63,0X4D,0X63,0X4D,0X63,0X4D,0X63,0X4D,0X63,0X4D,0X63,0X4D,0X63,0X4D,0X63,
-0X6D,0X6B,0X6D,0X6B,0X4D,0X6B,0X4D,0X6B,0X2C,0X63,0X6D,0X6B,0XCA,0X5A,0X2C,0X63,
-0X85,0X31,0X61,0X10,0XA2,0X18,0X04,0X21,0X04,0X21,0X24,0X29,0X45,0X29,0XE3,0X18,
-0X45,0X29,0X45,0X29,0X24,0X29,0X45,0X29,0X04,0X21,0X03,0X21,0XE3,0X20,0X41,0X08,
-0XA2,0X10,0XC3,0X18,0X04,0X21,0X04,0X29,0X45,0X29,0X86,0X31,0X65,0X31,0X24,0X29,
-0X44,0X29,0X44,0X29,0X03,0X21,0XC3,0X20,0X03,0X21,0XE3,0X20,0XE3,0X20,0X61,0X10,
-0X61,0X10,0X82,0X10,0X61,0X10,0X41,0X08,0X41,0X08,0X61,0X10,0X61,0X10,0XA2,0X18,
-0X61,0X10,0X82,0X10,0XA2,0X10,0X61,0X08,0X61,0X08,0XA2,0X10,0XC3,0X18,0XE3,0X18,
-0XE4,0X20,0XE3,0X18,0XE3,0X20,0XA2,0X10,0XC3,0X18,0XA3,0X18,0XA2,0X10,0X45,0X29,
-0XCB,0X5A,0X2D,0X63,0X4D,0X6B,0X4D,0X6B,0X6D,0X6B,0X8E,0X6B,0XAE,0X73,0XAE,0X73,
-0X8E,0X6B,0X8E,0X6B,0X8E,0X6B,0X8E,0X6B,0X8E,0X6B,0X8E,0X6B,0X8E,0X6B,0X8E,0X6B,
-0X8E,0X6B,0X8E,0X73,0X8E,0X6B,0X6D,0X6B,0X8E,0X6B,0X6D,0X6B,0X6D,0X6B,0X6D,0X6B,
-0X4D,0X6B,0X6D,0X6B,0X4D,0X63,0X4D,0X6B,0X4D,0X63,0X4D,0X63,0X4D,0X63,0X4D,0X63,
-0X4D,0X63,0X2C,0X63,0X2C,0X63,0X2C,0X63,0X2C,0X63,0X2C,0X63,0X0C,0X63,0X0C,0X63,
-0X0C,0X63,0X0C,0X63,0X0C,0X63,0X0C,0X5B,0X0C,0X5B,0XEC,0X5A,0XEC,0X5A,0XEC,0X5A,
-0XEB,0X5A,0XEB,0X5A,0XEB,0X5A,0XEB,0X5A,0XEB,0X5A,0XCB,0X5A,0XCB,0X5A,0XCB,0X5A,
-0XCB,0X5A,0XCB,0X5A,0XCB,0X52,0XCB,0X52,0XCB,0X52,0XAB,0X52,0XAB,0X52,0XAA,0X52,
-0XAB,0X52,0XAA,0X52,0XAA,0X52,0XAA,0X52,0XAA,0X52,0X8A,0X52,0X8A,0X52,0X8A,0X52,
-0X8A,0X52,0X8A,0X52,0XAA,0X52,0X8A,0X52,0X8A,0X52,0X8A,0X52,0X8A,0X4A,0X8A,0X52,
-0X8A,0X4A,0X8A,0X4A,0X8A,0X4A,0X8A,0X4A,0X8A,0X4A,0XAA,0X52,0X8A,0X4A,0XAA,0X52,
-0XAA,0X52,0XAA,0X52,0XAA,0X52,0XAA,0X52,0XAA,0X52,0XAA,0X52,0XAA,0X52,0XAB,0X52,
-0XAB,0X52,0XAB,0X52,0XCB,0X52,0XCB,0X52,0XCB,0X52,0XCB,0X52,0XCB,0X52,0XCB,0X52,
-0XCB,0X5A,0XEB,0X5A,0XEB,0X5A,0XEB,0X5A,0XEB,0X5A,0XEB,0X5A,0XEB,0X5A,0XEC,0X5A,
-0XEC,0X5A,0XEC,0X5A,0XEC,0X5A,0XEC,0X5A,0X0C,0X5B,0X0C,0X5B,0X0C,0X5B,0X0C,0X5B,
-0X0C,0X5B,0X2C,0X63,0X2C,0X63,0X2C,0X63,0X2C,0X63,0X2C,0X63,0X2C,0X63,0X2D,0X63,
-0X4D,0X63,0X4D,0X63,0X4D,0X63,0X4D,0X63,0X4D,0X63,0X4D,0X63,0X6D,0X6B,0X6D,0X6B,
-0X6D,0X6B,0X6D,0X6B,0X4D,0X6B,0X6D,0X6B,0X4D,0X6B,0XCB,0X5A,0X0C,0X5B,0XA6,0X39,
-0X81,0X10,0XA3,0X18,0XE3,0X20,0X04,0X21,0X45,0X29,0X04,0X21,0XE4,0X20,0X65,0X31,
-0X86,0X31,0X65,0X31,0X04,0X21,0X04,0X21,0X04,0X21,0XC2,0X18,0X82,0X10,0X04,0X21,
-0X65,0X29,0XA6,0X39,0X85,0X31,0X65,0X31,0X85,0X39,0X24,0X29,0X24,0X29,0X44,0X31,
-0XE3,0X20,0XC2,0X18,0XE3,0X20,0XA2,0X18,0X61,0X10,0X61,0X10,0X82,0X10,0XE3,0X20,
-0X81,0X10,0X41,0X08,0X61,0X10,0X81,0X10,0X61,0X10,0X61,0X10,0X61,0X08,0X82,0X10,
-0X81,0X10,0X61,0X10,0X61,0X10,0XA2,0X18,0X61,0X10,0X61,0X10,0XA2,0X18,0XE3,0X20,
-0X25,0X29,0X45,0X29,0XE4,0X20,0XC3,0X18,0X82,0X10,0X82,0X10,0XC3,0X18,0XA2,0X10,
-0X24,0X29,0X6D,0X6B,0X0C,0X63,0X0C,0X5B,0X6D,0X6B,0X6E,0X6B,0XAE,0X73,0X8E,0X6B,
-0X8E,0X6B,0X8E,0X6B,0X8E,0X6B,0X8E,0X6B,0X8E,0X6B,0X8E,0X6B,0X8E,0X6B,0X8E,0X6B,
-0X8E,0X6B,0X8E,0X6B,0X8E,0X6B,0X8E,0X6B,0X8E,0X6B,0X8E,0X6B,0X8E,0X6B,0X6D,0X6B,
-0X6D,0X6B,0X6D,0X6B,0X6D,0X6B,0X4D,0X6B,0X4D,0X63,0X4D,0X63,0X4D,0X63,0X4D,0X63,
-0X4D,0X63,0X2D,0X63,0X4D,0X63,0X2C,0X63,0X2C,0X63,0X2C,0X63,0X2C,0X63,0X0C,0X63,
-0X0C,0X63,0X0C,0X63,0X0C,0X5B,0X0C,0X63,0X0C,0X5B,0X0C,0X5B,0X0C,0X63,0XEC,0X5A,
-0XEC,0X5A,0XEB,0X5A,0XEB,0X5A,0XEC,0X5A,0XEB,0X5A,0XCB,0X5A,0XEB,0X5A,0XCB,0X5A,
-0XCB,0X5A,0XCB,0X5A,0XCB,0X5A,0XCB,0X52,0XCB,0X52,0XCB,0X52,0XAB,0X52,0XAA,0X52,
-0XAB,0X52,0XAA,0X52,0XAA,0X52,0XAA,0X52,0XAA,0X52,0X8A,0X52,0X8A,0X52,0X8A,0X52,
-0X8A,0X52,0X8A,0X52,0X8A,0X52,0X8A,0X52,0X8A,0X52,0X8A,0X52,0X8A,0X4A,0X8A,0X52,
-0X8A,0X4A,0X8A,0X4A,0X8A,0X4A,0X8A,0X4A,0XAA,0X52,0X8A,0X4A,0XAA,0X52,0XAA,0X52,
-0XAA,0X52,0XAA,0X52,0XAA,0X52,0XAA,0X52,0XAA,0X52,0XAA,0X52,0XAB,0X52,0XAB,0X52,
-0XAB,0X52,0XAB,0X52,0XCB,0X52,0XCB,0X52,0XCB,0X52,0XCB,0X52,0XCB,0X52,0XCB,0X5A,
-0XEB,0X5A,0XCB,0X5A,0XEB,0X5A,0XEB,0X5A,0XEB,0X5A,0XEB,0X5A,0XEC,0X5A,0XEB,0X5A,
-0X0C,0X5B,0X0C,0X5B,0X0C,0X5B,0X0C,0X5B,0X0C,0X5B,0X0C,0X5B,0X0C,0X5B,0X0C,0X5B,
-0X2C,0X63,0X2C,0X63,0X2C,0X63,0X2C,0X63,0X2D,0X63,0X2C,0X63,0X2C,0X63,0X4D,0X63,
-0X4D,0X63,0X4D,0X63,0X4D,0X63,0X6D,0X6B,0X6D,0X6B,0X6D,0X6B,0X6D,0X6B,0X6D,0X6B,
-0X6D,0X6B,0X8E,0X6B,0X6D,0X6B,0X6E,0X6B,0X0C,0X63,0XCB,0X5A,0X07,0X42,0X61,0X10,
-0XC3,0X18,0XE3,0X18,0X24,0X21,0X45,0X29,0X24,0X29,0X04,0X21,0X65,0X31,0XA6,0X39,
-0X04,0X21,0X45,0X29,0X25,0X29,0X24,0X29,0XE3,0X20,0X04,0X21,0X65,0X31,0XA6,0X31,
-0X65,0X31,0X65,0X31,0XA6,0X39,0X65,0X31,0X24,0X29,0X24,0X29,0XE3,0X20,0XC3,0X20,
-0XE3,0X20,0XC2,0X18,0XA2,0X18,0XA2,0X10,0X82,0X10,0XC2,0X18,0X82,0X10,0X82,0X10,
-0XE3,0X20,0XC3,0X18,0XA2,0X10,0X81,0X10,0X61,0X10,0X40,0X08,0X82,0X10,0X81,0X10,
-0X81,0X10,0X61,0X10,0X61,0X10,0X81,0X10,0X82,0X10,0X41,0X08,0X82,0X10,0XA2,0X18,
-0X04,0X21,0X66,0X31,0X24,0X29,0XE3,0X18,0XC3,0X18,0XA2,0X18,0X82,0X10,0XC2,0X18,
-0XC2,0X18,0X03,0X21,0X0C,0X63,0X4D,0X6B,0X2D,0X63,0XEB,0X5A,0X4D,0X6B,0X8E,0X73,
-0XAF,0X73,0XAF,0X73,0XAF,0X73,0XAF,0X73,0XAE,0X73,0XAE,0X73,0X8E,0X6B,0XAE,0X73,
-0X8E,0X6B,0XAE,0X73,0X8E,0X6B,0X8E,0X6B,0X8E,0X6B,0X8E,0X6B,0X8E,0X6B,0X6E,0X6B,
-0X6E,0X6B,0X6D,0X6B,0X6D,0X6B,0X6D,0X6B,0X6D,0X6B,0X4D,0X63,0X4D,0X63,0X4D,0X63,
-0X4D,0X63,0X4D,0X63,0X4D,0X63,0X4D,0X63,0X2D,0X63,0X2C,0X63,0X2C,0X63,0X2C,0X63,
-0X2C,0X63,0X2C,0X63,0X2C,0X5B,0X0C,0X5B,0X0C,0X63,0X0C,0X5B,0X0C,0X5B,0X0C,0X5B,
-0XEC,0X5A,0XEC,0X5A,0XEC,0X5A,0XEB,0X5A,0XEB,0X5A,0XEB,0X5A,0XEB,0X5A,0XCB,0X5A,
-0XEB,0X5A,0XCB,0X5A,0XCB,0X5A,0XCB,0X5A,0XCB,0X5A,0XCB,0X52,0XCB,0X52,0XAB,0X52,
-0XAA,0X52,0XAA,0X52,0XAA,0X52,0XAA,0X52,0XAA,0X52,0XAA,0X52,0XAA,0X52,0XAA,0X52,
-0X8A,0X52,0X8A,0X52,0X8A,0X52,0X8A,0X52,0X8A,0X52,0X8A,0X52,0X8A,0X52,0XAA,0X52,
-0X8A,0X4A,0X8A,0X4A,0X8A,0X4A,0XAA,0X52,0XAA,0X52,0XAA,0X52,0XAA,0X52,0XAA,0X52,
-0XAA,0X52,0XAA,0X52,0XAA,0X52,0XAA,0X52,0XAA,0X52,0XAA,0X52,0XAA,0X52,0XAB,0X52,
-0XAB,0X52,0XCB,0X52,0XCB,0X52,0XCB,0X52,0XCB,0X52,0XCB,0X52,0XCB,0X52,0XEB,0X52,
-0XEB,0X5A,0XEB,0X5A,0XEB,0X5A,0XEB,0X5A,0XEB,0X5A,0XEC,0X5A,0XEB,0X5A,0X0C,0X5B,
-0X0C,0X5B,0X0C,0X5B,0X0C,0X5B,0X0C,0X5B,0X0C,0X5B,0X0C,0X5B,0X0C,0X5B,0X2C,0X63,
-0X2C,0X63,0X2C,0X63,0X2C,0X63,0X2C,0X63,0X4D,0X63,0X4D,0X63,0X4D,0X63,0X4D,0X63,
-0X4D,0X63,0X4D,0X63,0X4D,0X63,0X6D,0X6B,0X6D,0X6B,0X6D,0X6B,0X6D,0X6B,0X6E,0X6B,
-0X6D,0X6B,0X8E,0X6B,0X6D,0X6B,0X0C,0X63,0XCB,0X52,0X69,0X4A,0X81,0X10,0XA2,0X18,
-0XC3,0X18,0X04,0X21,0X45,0X29,0XE3,0X20,0X24,0X29,0X86,0X31,0X65,0X31,0X04,0X21,
-0X86,0X31,0X65,0X31,0X45,0X29,0X24,0X29,0X24,0X29,0X45,0X29,0X45,0X29,0X66,0X31,
-0XA6,0X39,0X86,0X39,0X65,0X31,0X24,0X29,0X24,0X29,0X24,0X29,0X44,0X29,0X44,0X29,
-0XE3,0X20,0XE3,0X20,0XA2,0X18,0XC3,0X18,0XC3,0X18,0X82,0X10,0XA2,0X18,0X81,0X10,
-0X81,0X10,0X82,0X10,0X61,0X10,0XA2,0X18,0X82,0X18,0X61,0X10,0X82,0X10,0XA2,0X10,
-0X82,0X10,0X81,0X10,0X82,0X10,0X61,0X10,0X82,0X10,0X61,0X10,0X61,0X08,0X61,0X10,
-0XA2,0X18,0XC3,0X20,0X65,0X31,0X65,0X31,0X04,0X21,0XA3,0X18,0XC3,0X18,0XA2,0X10,
-0XC2,0X18,0XA2,0X18,0X86,0X31,0XCB,0X5A,0X0C,0X63,0XAF,0X73,0X4D,0X6B,0X4D,0X6B,
-0XCF,0X73,0XAE,0X73,0XAE,0X73,0XAE,0X73,0XAF,0X73,0XAE,0X73,0XAE,0X73,0XAE,0X73,
-0XAE,0X73,0XAE,0X73,0XAE,0X73,0X8E,0X6B,0XAE,0X73,0X8E,0X6B,0X8E,0X6B,0X8E,0X6B,
-0X8E,0X6B,0X6E,0X6B,0X6E,0X6B,0X6E,0X6B,0X6D,0X6B,0X6D,0X6B,0X6D,0X6B,0X4D,0X6B,
-0X4D,0X63,0X4D,0X63,0X4D,0X63,0X4D,0X63,0X4D,0X63,0X2D,0X63,0X2D,0X63,0X2C,0X63,
-0X2C,0X63,0X0C,0X63,0X2C,0X63,0X2C,0X63,0X0C,0X5B,0X0C,0X63,0X0C,0X63,0X0C,0X63,
-0X0C,0X5B,0X0C,0X5B,0XEC,0X5A,0XEC,0X5A,0XEC,0X5A,0XEB,0X5A,0XEB,0X5A,0XEB,0X5A,
-0XEB,0X5A,0XCB,0X5A,0XCB,0X5A,0XCB,0X5A,0XCB,0X5A,0XCB,0X5A,0XCB,0X5A,0XAB,0X52,
-0XAB,0X52,0XAB,0X52,0XAB,0X52,0XAB,0X52,0XAB,0X52,0XAB,0X52,0XAA,0X52,0XAA,0X52,
-0XAA,0X52,0XAA,0X52,0XAA,0X52,0X8A,0X52,0X8A,0X52,0X8A,0X52,0X8A,0X52,0X8A,0X52,
-0X8A,0X4A,0X8A,0X4A,0X8A,0X4A,0XAA,0X52,0XAA,0X52,0X8A,0X4A,0XAA,0X52,0XAA,0X52,
-0XAA,0X52,0XAA,0X52,0XAA,0X52,0XAA,0X52,0XAB,0X52,0XAB,0X52,0XAB,0X52,0XAB,0X52,
-0XCB,0X52,0XCB,0X52,0XCB,0X52,0XCB,0X52,0XCB,0X52,0XCB,0X52,0XEB,0X5A,0XEB,0X5A,
-0XEB,0X5A,0XEB,0X5A,0XEB,0X5A,0XEC,0X5A,0XEC,0X5A,0XEC,0X5A,0XEC,0X5A,0X0C,0X5B,
-0X0C,0X5B,0X0C,0X5B,0X0C,0X5B,0X0C,0X5B,0X0C,0X5B,0X2C,0X63,0X2C,0X63,0X2C,0X63,
-0X2C,0X63,0X2C,0X63,0X2C,0X63,0X2D,0X63,0X4D,0X63,0X4D,0X63,0X4D,0X63,0X4D,0X63,
-0X4D,0X63,0X4D,0X63,0X6D,0X6B,0X6D,0X6B,0X6D,0X6B,0X6D,0X6B,0X6E,0X6B,0X8E,0X6B,
-0X6E,0X6B,0X8E,0X73,0X0C,0X63,0X0C,0X63,0XCA,0X5A,0XA2,0X18,0XA2,0X18,0XC3,0X18,
-0X24,0X29,0X24,0X21,0XC3,0X18,0X65,0X31,0X65,0X31,0X45,0X29,0X45,0X29,0X65,0X31,
-0X45,0X29,0X86,0X31,0X45,0X29,0X24,0X29,0X65,0X31,0X65,0X31,0XC6,0X39,0XA6,0X39,
-0X24,0X29,0X24,0X29,0X65,0X31,0X65,0X31,0X45,0X31,0X44,0X29,0XE3,0X20,0XC3,0X18,
-0XC2,0X18,0XA2,0X18,0XC3,0X18,0XA2,0X18,0XA2,0X18,0XC3,0X18,0XA2,0X18,0XA2,0X18,
-0X82,0X10,0X61,0X10,0X82,0X10,0X82,0X10,0X61,0X10,0XA2,0X18,0X82,0X10,0X82,0X10,
-0X82,0X10,0X82,0X10,0XA2,0X18,0X82,0X10,0X61,0X10,0X81,0X10,0X61,0X08,0X82,0X10,
-0XC2,0X18,0XC3,0X18,0XC3,0X18,0XE3,0X20,0X65,0X31,0XE3,0X20,0X61,0X10,0X82,0X10,
-0XA2,0X18,0XA2,0X18,0X82,0X10,0XE7,0X39,0X2C,0X63,0X2C,0X63,0X8E,0X6B,0X0C,0X63,
-0X2D,0X63,0XCF,0X73,0XCF,0X73,0XAE,0X73,0XAE,0X73,0XAE,0X73,0XAE,0X73,0XAF,0X73,
-0XCF,0X73,0XAF,0X73,0XAF,0X73,0XAE,0X73,0XAE,0X73,0XAE,0X73,0X8E,0X6B,0X8E,0X73,
-0X8E,0X6B,0X8E,0X6B,0X6E,0X6B,0X8E,0X6B,0X6D,0X6B,0X6D,0X6B,0X6D,0X6B,0X6D,0X6B,
-0X6D,0X6B,0X4D,0X63,0X4D,0X63,0X4D,0X6B,0X4D,0X63,0X4D,0X63,0X2D,0X63,0X2D,0X63,
-0X2D,0X63,0X2C,0X63,0X2C,0X63,0X2C,0X63,0X2C,0X63,0X0C,0X63,0X0C,0X63,0X0C,0X63,
-0X0C,0X63,0X0C,0X5B,0XEC,0X5A,0X0C,0X5B,0XEC,0X5A,0XEC,0X5A,0XEB,0X5A,0XEC,0X5A,
-0XEB,0X5A,0XEB,0X5A,0XCB,0X5A,0XCB,0X5A,0XCB,0X5A,0XCB,0X5A,0XCB,0X5A,0XCB,0X52,
-0XAB,0X52,0XAB,0X52,0XAB,0X52,0XAB,0X52,0XAB,0X52,0XAA,0X52,0XAA,0X52,0XAA,0X52,
-0XAA,0X52,0X8A,0X52,0X8A,0X52,0XAA,0X52,0X8A,0X52,0X8A,0X52,0X8A,0X52,0X8A,0X52,
-0X8A,0X4A,0X8A,0X4A,0XAA,0X52,0X8A,0X4A,0X8A,0X4A,0XAA,0X52,0XAA,0X52,0XAA,0X52,
-0XAA,0X52,0XAA,0X52,0XAA,0X52,0XAA,0X52,0XAA,0X52,0XAB,0X52,0XAB,0X52,0XAB,0X52,
-0XCB,0X52,0XCB,0X52,0XCB,0X52,0XCB,0X52,0XCB,0X52,0XEB,0X5A,0XEB,0X5A,0XCB,0X5A,
-0XEB,0X5A,0XEB,0X5A,0XEC,0X5A,0XEB,0X5A,0XEC,0X5A,0XEC,0X5A,0XEC,0X5A,0X0C,0X5B,
-0X0C,0X5B,0X0C,0X5B,0X0C,0X5B,0X0C,0X5B,0X0C,0X5B,0X2C,0X63,0X2C,0X63,0X2C,0X63,
-0X2C,0X63,0X2C,0X63,0X4D,0X63,0X4D,0X63,0X4D,0X63,0X4D,0X63,0X4D,0X63,0X6D,0X6B,
-0X6D,0X6B,0X6D,0X6B,0X6D,0X6B,0X6D,0X6B,0X6D,0X6B,0X6E,0X6B,0X8E,0X6B,0X6E,0X6B,
-0X8E,0X6B,0X6D,0X6B,0X0C,0X63,0XAA,0X52,0X24,0X29,0X82,0X10,0XA2,0X18,0X04,0X21,
-0XE4,0X20,0XE3,0X18,0X24,0X21,0X45,0X29,0X04,0X21,0X45,0X29,0X45,0X29,0X65,0X31,
-0X85,0X31,0X86,0X31,0X44,0X29,0X85,0X31,0XA6,0X39,0XC6,0X41,0XA6,0X39,0X65,0X31,
-0X86,0X39,0XA6,0X39,0X65,0X31,0X85,0X31,0X24,0X29,0XE3,0X20,0XC3,0X20,0X04,0X21,
-0X04,0X21,0XE3,0X20,0XC3,0X18,0XA2,0X18,0XA2,0X18,0X61,0X10,0X82,0X10,0X82,0X10,
-0XA2,0X18,0X82,0X10,0X81,0X10,0X81,0X10,0X81,0X10,0XA2,0X10,0XA2,0X18,0XA2,0X18,
-0X81,0X10,0XA2,0X18,0XA2,0X18,0XE3,0X20,0X82,0X10,0XA2,0X18,0X61,0X10,0X41,0X08,
-0XA2,0X18,0XE3,0X20,0X25,0X29,0X24,0X29,0X04,0X21,0X45,0X29,0XE3,0X18,0X82,0X10,
-0X41,0X08,0X81,0X10,0X82,0X10,0XE3,0X20,0X8A,0X52,0X6D,0X6B,0XAE,0X73,0X8E,0X73,
-0X4D,0X6B,0X8E,0X73,0XF0,0X7B,0XCF,0X73,0XCF,0X73,0XCF,0X73,0XCF,0X73,0XCF,0X73,
-0XCF,0X73,0XCF,0X73,0XCF,0X73,0XAF,0X73,0XAF,0X73,0XAE,0X73,0XAE,0X73,0XAE,0X73,
-0X8E,0X6B,0X8E,0X6B,0X8E,0X6B,0X8E,0X6B,0X8E,0X6B,0X8E,0X6B,0X6E,0X6B,0X6E,0X6B,
-0X6D,0X6B,0X6D,0X6B,0X6D,0X63,0X4D,0X6B,0X4D,0X6B,0X4D,0X63,0X4D,0X63,0X4D,0X63,
-0X4D,0X63,0X4D,0X63,0X2D,0X63,0X2C,0X63,0X0C,0X63,0X0C,0X63,0X0C,0X63,0X0C,0X63,
-0X0C,0X63,0X0C,0X63,0X0C,0X5B,0X0C,0X5B,0X0C,0X5B,0XEC,0X5A,0XEC,0X5A,0XEB,0X5A,
-0XEC,0X5A,0XEB,0X5A,0XCB,0X5A,0XEB,0X5A,0XCB,0X5A,0XCB,0X5A,0XCB,0X5A,0XCB,0X5A,
-0XCB,0X5A,0XAB,0X52,0XAB,0X52,0XAB,0X52,0XAB,0X52,0XAB,0X52,0XAA,0X52,0XAA,0X52,
-0XAA,0X52,0XAA,0X52,0X8A,0X52,0XAA,0X52,0XAA,0X52,0X8A,0X52,0X8A,0X52,0X8A,0X52,
-0X8A,0X4A,0X8A,0X4A,0XAA,0X52,0X8A,0X4A,0XAA,0X52,0X8A,0X4A,0XAA,0X52,0XAA,0X52,
-0XAA,0X52,0XAA,0X52,0XAA,0X52,0XAA,0X52,0XAB,0X52,0XAB,0X52,0XAB,0X52,0XCB,0X52,
-0XCB,0X52,0XCB,0X52,0XCB,0X52,0XCB,0X52,0XCB,0X52,0XCB,0X52,0XEB,0X5A,0XEB,0X5A,
-0XEB,0X5A,0XEB,0X5A,0XEC,0X5A,0XEB,0X5A,0X0C,0X5B,0X0C,0X5B,0X0C,0X5B,0X0C,0X5B,
-0X0C,0X5B,0X0C,0X5B,0X0C,0X5B,0X0C,0X5B,0X2C,0X63,0X2C,0X63,0X2C,0X63,0X4D,0X63,
-0X2C,0X63,0X4D,0X63,0X4D,0X63,0X4D,0X63,0X4D,0X63,0X6D,0X6B,0X4D,0X63,0X6D,0X6B,
-0X6D,0X6B,0X6D,0X6B,0X6E,0X6B,0X6D,0X6B,0X6E,0X6B,0X8E,0X6B,0X8E,0X6B,0X8E,0X6B,
-0X8E,0X6B,0X8E,0X6B,0XAA,0X52,0XA6,0X31,0X82,0X10,0X82,0X10,0XE3,0X20,0XC3,0X18,
-0X04,0X21,0X04,0X21,0X24,0X29,0X04,0X21,0X45,0X29,0X04,0X21,0X65,0X31,0X65,0X31,
-0X65,0X31,0X04,0X21,0X65,0X31,0XA6,0X39,0XA6,0X39,0X65,0X31,0X65,0X31,0XA6,0X39,
-0X24,0X29,0X45,0X31,0X44,0X29,0XE3,0X20,0XC3,0X18,0X24,0X29,0X45,0X31,0XE3,0X20,
-0XC3,0X18,0XA2,0X18,0XC3,0X18,0XC3,0X18,0XC3,0X18,0XE3,0X20,0XA2,0X18,0X82,0X10,
-0X82,0X10,0XA2,0X18,0XC2,0X18,0XA2,0X18,0XA2,0X18,0XA2,0X18,0XA2,0X18,0XC2,0X18,
-0XE3,0X20,0XA2,0X18,0XC2,0X18,0XC2,0X18,0XC2,0X18,0XA2,0X18,0X61,0X10,0X41,0X08,
-0X61,0X10,0XA2,0X18,0X04,0X21,0X45,0X29,0X24,0X29,0X04,0X21,0XE3,0X20,0XC2,0X18,
-0XA2,0X18,0X61,0X10,0X82,0X10,0XA2,0X18,0X04,0X21,0X8A,0X52,0X2D,0X63,0XEF,0X7B,
-0XAF,0X73,0X0C,0X5B,0XCF,0X7B,0XEF,0X7B,0XEF,0X7B,0XEF,0X7B,0XCF,0X73,0XCF,0X73,
-0XCF,0X73,0XCF,0X73,0XCF,0X73,0XCF,0X73,0XCF,0X73,0XCF,0X73,0XAF,0X73,0XAE,0X73,
-0XAE,0X73,0XAE,0X73,0XAE,0X73,0X8E,0X6B,0X8E,0X6B,0X8E,0X6B,0X8E,0X6B,0X6E,0X6B,
-0X6E,0X6B,0X6D,0X6B,0X6E,0X6B,0X4D,0X6B,0X4D,0X6B,0X4D,0X6B,0X4D,0X63,0X4D,0X63,
-0X4D,0X63,0X4D,0X63,0X4D,0X63,0X2D,0X63,0X2C,0X63,0X2C,0X63,0X2C,0X63,0X0C,0X63,
-0X0C,0X63,0X0C,0X63,0X0C,0X63,0X0C,0X5B,0X0C,0X5B,0XEC,0X5A,0XEC,0X5A,0XEC,0X5A,
-0XEB,0X5A,0XEB,0X5A,0XEB,0X5A,0XCB,0X5A,0XCB,0X5A,0XCB,0X5A,0XCB,0X5A,0XCB,0X5A,
-0XCB,0X5A,0XCB,0X5A,0XAB,0X52,0XAB,0X52,0XAB,0X52,0XAB,0X52,0XAB,0X52,0XAA,0X52,
-0XAA,0X52,0XAA,0X52,0XAA,0X52,0XAA,0X52,0X8A,0X52,0X8A,0X52,0X8A,0X52,0X8A,0X52,
-0X8A,0X4A,0XAA,0X52,0XAA,0X52,0X8A,0X4A,0XAA,0X52,0XAA,0X52,0XAA,0X52,0XAA,0X52,
-0XAA,0X52,0XAA,0X52,0XAB,0X52,0XAB,0X52,0XCB,0X52,0XAB,0X52,0XCB,0X52,0XCB,0X52,
-0XCB,0X52,0XCB,0X52,0XCB,0X52,0XCB,0X52,0XCB,0X52,0XEB,0X5A,0XEB,0X5A,0XEB,0X5A,
-0XEC,0X5A,0XEC,0X5A,0XEB,0X5A,0XEC,0X5A,0X0C,0X5B,0X0C,0X5B,0X0C,0X63,0X0C,0X63,
-0X0C,0X5B,0X0C,0X5B,0X2C,0X63,0X2C,0X63,0X2C,0X63,0X2D,0X63,0X4D,0X63,0X2D,0X63,
-0X4D,0X63,0X4D,0X63,0X4D,0X63,0X4D,0X63,0X6D,0X6B,0X4D,0X63,0X6D,0X6B,0X6D,0X6B,
-0X6D,0X6B,0X6D,0X6B,0X8E,0X6B,0X6E,0X6B,0X8E,0X6B,0X8E,0X6B,0X8E,0X6B,0X8E,0X6B,
-0X8E,0X6B,0X2C,0X63,0X28,0X42,0XA2,0X10,0X82,0X18,0XA2,0X18,0XC3,0X18,0XE3,0X20,
-0X04,0X21,0X45,0X29,0X24,0X29,0X45,0X29,0X24,0X29,0X65,0X31,0X86,0X31,0X65,0X31,
-0X45,0X29,0X65,0X31,0XC7,0X39,0XC6,0X39,0XA6,0X39,0X65,0X31,0X86,0X31,0X45,0X29,
-0X65,0X31,0X45,0X29,0X65,0X31,0X44,0X29,0X45,0X29,0X04,0X29,0XE3,0X20,0XE3,0X20,
-0XC2,0X18,0X82,0X10,0X82,0X10,0X81,0X10,0X81,0X08,0X82,0X10,0X82,0X10,0X82,0X10,
-0X82,0X10,0X82,0X10,0XA2,0X18,0XA2,0X18,0XC3,0X18,0XC3,0X18,0XE3,0X20,0XE3,0X20,
-0X44,0X29,0XE3,0X20,0XE3,0X20,0X03,0X21,0X03,0X21,0X44,0X29,0X24,0X29,0XA2,0X18,
-0X82,0X10,0X41,0X08,0X61,0X10,0X82,0X10,0X04,0X21,0X04,0X21,0XE3,0X20,0XC3,0X18,
-0XA2,0X18,0X82,0X10,0X81,0X10,0XA2,0X10,0X82,0X18,0X04,0X21,0X6D,0X6B,0X4D,0X6B,
-0XAF,0X73,0X31,0X84,0X0C,0X63,0XEF,0X7B,0XCF,0X73,0XCF,0X73,0XEF,0X7B,0XEF,0X7B,
-0XEF,0X7B,0XEF,0X7B,0XEF,0X7B,0XEF,0X7B,0XCF,0X73,0XCF,0X73,0XCF,0X73,0XAF,0X73,
-0XAF,0X73,0XAF,0X73,0XAF,0X73,0XAE,0X73,0X8E,0X6B,0X8E,0X6B,0X8E,0X6B,0X8E,0X6B,
-0X8E,0X6B,0X8E,0X6B,0X8E,0X6B,0X6D,0X6B,0X6D,0X6B,0X6D,0X6B,0X4D,0X6B,0X4D,0X63,
-0X4D,0X6B,0X4D,0X63,0X4D,0X63,0X4D,0X63,0X4D,0X63,0X2D,0X63,0X2C,0X63,0X2C,0X63,
-0X0C,0X63,0X0C,0X63,0X0C,0X63,0X0C,0X63,0X0C,0X63,0XEC,0X5A,0X0C,0X5B,0XEC,0X5A,
-0XEC,0X5A,0XEB,0X5A,0XEB,0X5A,0XEB,0X5A,0XCB,0X5A,0XEB,0X5A,0XEB,0X5A,0XCB,0X5A,
-0XCB,0X5A,0XCB,0X52,0XCB,0X5A,0XCB,0X52,0XCB,0X52,0XAB,0X52,0XAB,0X52,0XAB,0X52,
-0XAA,0X52,0XAA,0X52,0XAA,0X52,0XAA,0X52,0X8A,0X52,0X8A,0X52,0X8A,0X52,0XAA,0X52,
-0X8A,0X4A,0XAA,0X52,0X8A,0X4A,0XAA,0X52,0XAA,0X52,0XAA,0X52,0XAA,0X52,0XAA,0X52,
-0XAA,0X52,0XAA,0X52,0XAB,0X52,0XAB,0X52,0XAB,0X52,0XCB,0X52,0XCB,0X52,0XCB,0X52,
-0XCB,0X52,0XCB,0X52,0XCB,0X52,0XEB,0X5A,0XEB,0X52,0XEB,0X5A,0XEB,0X5A,0XEB,0X5A,
-0XEC,0X5A,0XEC,0X5A,0X0C,0X5B,0X0C,0X5B,0X0C,0X5B,0X0C,0X5B,0X0C,0X63,0X0C,0X63,
-0X0C,0X63,0X2C,0X63,0X2C,0X63,0X2C,0X63,0X2C,0X63,0X2C,0X63,0X4D,0X63,0X4D,0X63,
-0X4D,0X63,0X4D,0X63,0X4D,0X63,0X6D,0X6B,0X6D,0X6B,0X6D,0X6B,0X6D,0X6B,0X6D,0X6B,
-0X6D,0X6B,0X8E,0X6B,0X8E,0X6B,0X8E,0X6B,0X8E,0X6B,0X8E,0X6B,0XAE,0X6B,0XAF,0X73,
-0X6D,0X6B,0X89,0X52,0XE3,0X20,0XA2,0X18,0XA3,0X18,0XC3,0X18,0XE3,0X20,0X24,0X29,
-0X03,0X21,0X45,0X29,0X04,0X21,0X24,0X29,0X45,0X29,0X45,0X29,0X66,0X31,0X45,0X29,
-0X65,0X31,0XC7,0X41,0XA6,0X39,0XA6,0X39,0X86,0X31,0X86,0X31,0X65,0X31,0X65,0X31,
-0X45,0X31,0X24,0X29,0X24,0X29,0X44,0X29,0X03,0X29,0X04,0X21,0XC3,0X18,0X82,0X10,
-0X82,0X10,0XA2,0X18,0XC3,0X18,0XE3,0X20,0XE3,0X20,0XE3,0X20,0XC3,0X18,0XC3,0X18,
-0XE3,0X20,0XC3,0X20,0X03,0X21,0X03,0X21,0X04,0X29,0X24,0X31,0X03,0X21,0X65,0X31,
-0X45,0X31,0X65,0X39,0X45,0X31,0X45,0X31,0X44,0X31,0X85,0X39,0XE6,0X41,0XA6,0X39,
-0XA2,0X18,0X82,0X10,0XA2,0X10,0XC3,0X18,0XC3,0X18,0XC3,0X18,0X24,0X21,0XC3,0X18,
-0XC3,0X18,0X82,0X10,0X81,0X10,0X81,0X10,0XC2,0X18,0XA2,0X18,0XA6,0X39,0X8E,0X6B,
-0X2D,0X63,0X10,0X84,0XCF,0X73,0X8E,0X6B,0X10,0X7C,0XF0,0X7B,0XF0,0X7B,0XF0,0X7B,
-0XEF,0X7B,0XEF,0X7B,0XEF,0X7B,0XEF,0X7B,0XEF,0X7B,0XCF,0X73,0XCF,0X73,0XCF,0X73,
-0XCF,0X73,0XCF,0X73,0XAF,0X73,0XAE,0X73,0XAE,0X73,0XAE,0X73,0XAE,0X73,0X8E,0X6B,
-0X8E,0X6B,0X8E,0X6B,0X8E,0X6B,0X6E,0X6B,0X8E,0X6B,0X6D,0X6B,0X6D,0X6B,0X4D,0X6B,
-0X6D,0X6B,0X4D,0X6B,0X4D,0X6B,0X4D,0X6B,0X4D,0X6B,0X4D,0X63,0X2D,0X63,0X2C,0X63,
-0X2C,0X63,0X0C,0X63,0X0C,0X63,0X0C,0X63,0X0C,0X63,0X0C,0X63,0X0C,0X63,0X0C,0X5B,
-0XEC,0X5A,0XEC,0X5A,0XEC,0X5A,0XEB,0X5A,0XEB,0X5A,0XEB,0X5A,0XCB,0X5A,0XCB,0X5A,
-0XCB,0X5A,0XCB,0X5A,0XCB,0X5A,0XCB,0X5A,0XAB,0X52,0XCB,0X52,0XAB,0X52,0XAB,0X52,
-0XAB,0X52,0XAA,0X52,0XAA,0X52,0XAA,0X52,0X8A,0X52,0XAA,0X52,0X8A,0X52,0XAA,0X52,
-0XAA,0X52,0X8A,0X4A,0X8A,0X4A,0XAA,0X52,0XAA,0X52,0XAA,0X52,0XAA,0X52,0XAA,0X52,
-0XAA,0X52,0XAA,0X52,0XAB,0X52,0XAB,0X52,0XAB,0X52,0XCB,0X52,0XCB,0X52,0XCB,0X52,
-0XCB,0X52,0XCB,0X52,0XCB,0X52,0XEB,0X5A,0XEB,0X5A,0XEB,0X5A,0XEB,0X5A,0XEB,0X5A,
-0XEC,0X5A,0X0C,0X5B,0X0C,0X5B,0X0C,0X5B,0X0C,0X5B,0X0C,0X5B,0X0C,0X63,0X0C,0X63,
-0X0C,0X63,0X2C,0X63,0X2C,0X63,0X2C,0X63,0X2D,0X63,0X4D,0X63,0X4D,0X63,0X4D,0X63,
-0X4D,0X63,0X4D,0X63,0X4D,0X63,0X6D,0X6B,0X6D,0X6B,0X6D,0X6B,0X6D,0X6B,0X8E,0X6B,
-0X8E,0X6B,0X6E,0X6B,0X8E,0X6B,0X8E,0X6B,0X8E,0X6B,0X8E,0X6B,0XAE,0X73,0XCF,0X73,
-0XAA,0X52,0XA6,0X39,0X82,0X10,0XA2,0X18,0XC3,0X18,0XE3,0X20,0XE3,0X20,0XE3,0X20,
-0X24,0X29,0X24,0X29,0XE3,0X20,0X65,0X31,0X86,0X31,0X45,0X29,0X45,0X29,0X65,0X31,
-0XA6,0X39,0XA6,0X39,0XA6,0X39,0X86,0X31,0X86,0X39,0X65,0X31,0X65,0X31,0X24,0X29,
-0X24,0X29,0X86,0X31,0X24,0X29,0XC3,0X20,0XE3,0X20,0X82,0X10,0XC3,0X20,0X04,0X29,
-0X24,0X29,0X04,0X21,0XE3,0X20,0X04,0X21,0X44,0X29,0X24,0X29,0X24,0X29,0X45,0X29,
-0X24,0X29,0X24,0X29,0X24,0X29,0X65,0X31,0XA6,0X39,0X85,0X39,0X85,0X39,0XA5,0X39,
-0X07,0X4A,0XA6,0X39,0XC7,0X41,0X08,0X4A,0XE7,0X41,0X07,0X4A,0X89,0X5A,0XE7,0X41,
-0X65,0X31,0XE3,0X20,0XE3,0X18,0XE4,0X20,0X04,0X21,0X04,0X21,0XC3,0X18,0XE3,0X20,
-0XC3,0X18,0XA2,0X18,0X81,0X10,0X82,0X10,0X82,0X10,0XA2,0X18,0XC3,0X18,0XEC,0X62,
-0X8E,0X73,0X0C,0X63,0X51,0X84,0X4D,0X63,0X31,0X84,0X10,0X7C,0X10,0X7C,0X10,0X7C,
-0X10,0X7C,0X10,0X7C,0XF0,0X7B,0XEF,0X7B,0XF0,0X7B,0XF0,0X7B,0XF0,0X7B,0XCF,0X73,
-0XCF,0X73,0XCF,0X73,0XCF,0X73,0XCF,0X73,0XAF,0X73,0XAE,0X73,0XAF,0X73,0XAE,0X73,
-0X8E,0X6B,0X8E,0X6B,0X8E,0X6B,0X8E,0X6B,0X8E,0X6B,0X6E,0X6B,0X6E,0X6B,0X6E,0X6B,
-0X6D,0X6B,0X6D,0X6B,0X4D,0X6B,0X4D,0X6B,0X4D,0X6B,0X4D,0X6B,0X4D,0X63,0X2D,0X63,
-0X2D,0X63,0X2C,0X63,0X2C,0X63,0X0C,0X63,0X0C,0X63,0X0C,0X63,0X0C,0X63,0X0C,0X5B,
-0X0C,0X5B,0XEC,0X5A,0XEC,0X5A,0XEC,0X5A,0XEB,0X5A,0XEB,0X5A,0XEB,0X5A,0XCB,0X5A,
-0XCB,0X5A,0XCB,0X5A,0XCB,0X5A,0XCB,0X5A,0XCB,0X5A,0XCB,0X52,0XAB,0X52,0XAB,0X52,
-0XAA,0X52,0XAA,0X52,0XAA,0X52,0XAA,0X52,0X8A,0X52,0X8A,0X52,0X8A,0X52,0XAA,0X52,
-0XAA,0X52,0X8A,0X4A,0XAA,0X52,0XAA,0X52,0XAA,0X52,0XAA,0X52,0XAA,0X52,0XAA,0X52,
-0XAB,0X52,0XAB,0X52,0XCB,0X52,0XCB,0X52,0XCB,0X52,0XCB,0X52,0XCB,0X52,0XCB,0X52,
-0XCB,0X52,0XCB,0X52,0XCB,0X52,0XEB,0X5A,0XCB,0X5A,0XEB,0X5A,0XEC,0X5A,0XEB,0X5A,
-0XEC,0X5A,0X0C,0X5B,0X0C,0X5B,0X0C,0X5B,0X0C,0X5B,0X0C,0X5B,0X0C,0X63,0X0C,0X63,
-0X0C,0X63,0X2C,0X63,0X2C,0X63,0X2C,0X63,0X2D,0X63,0X4D,0X63,0X4D,0X6B,0X4D,0X63,
-0X4D,0X63,0X6D,0X6B,0X6D,0X6B,0X6D,0X6B,0X6D,0X6B,0X6E,0X6B,0X6E,0X6B,0X8E,0X6B,
-0X8E,0X6B,0X8E,0X6B,0X8E,0X6B,0X8E,0X6B,0XAE,0X73,0XAE,0X73,0XCF,0X73,0X0C,0X63,
-0XCB,0X5A,0X81,0X10,0XA2,0X18,0XC3,0X18,0XC3,0X18,0X04,0X21,0XE3,0X20,0X24,0X29,
-0X03,0X21,0XE3,0X20,0X65,0X31,0X24,0X29,0X44,0X29,0X45,0X29,0X66,0X31,0X86,0X31,
-0XA6,0X39,0X86,0X31,0X66,0X31,0XA6,0X39,0X65,0X31,0X66,0X31,0X24,0X29,0X65,0X31,
-0X86,0X31,0X24,0X29,0X24,0X29,0XE3,0X20,0X04,0X29,0X45,0X31,0X04,0X29,0XE3,0X20,
-0XE3,0X20,0X24,0X29,0X24,0X29,0X24,0X29,0X04,0X29,0X44,0X31,0X65,0X31,0X24,0X31,
-0X85,0X39,0X85,0X39,0X44,0X31,0X85,0X39,0XC6,0X41,0XC6,0X41,0XE6,0X41,0X48,0X52,
-0X68,0X5A,0X28,0X52,0X68,0X5A,0XCA,0X62,0X68,0X5A,0X2C,0X73,0XAA,0X62,0XC6,0X41,
-0XA6,0X39,0X44,0X29,0X04,0X21,0X04,0X21,0X24,0X29,0X24,0X29,0X04,0X21,0XC3,0X18,
-0XA2,0X18,0XA2,0X18,0XA2,0X10,0X81,0X10,0X82,0X10,0X82,0X10,0X82,0X10,0X44,0X29,
-0X6D,0X6B,0X8E,0X73,0X2C,0X63,0XEF,0X7B,0XCF,0X73,0X31,0X84,0X30,0X84,0X10,0X7C,
-0X10,0X7C,0X10,0X7C,0X10,0X7C,0X10,0X7C,0X10,0X7C,0XF0,0X7B,0XF0,0X7B,0XF0,0X7B,
-0XF0,0X7B,0XF0,0X7B,0XCF,0X73,0XCF,0X73,0XCF,0X73,0XCF,0X73,0XAF,0X73,0XAF,0X73,
-0XAF,0X73,0XAE,0X73,0X8E,0X6B,0X8E,0X6B,0X8E,0X6B,0X8E,0X6B,0X8E,0X6B,0X6E,0X6B,
-0X6E,0X6B,0X6D,0X6B,0X6D,0X6B,0X6D,0X6B,0X4D,0X6B,0X4D,0X6B,0X4D,0X6B,0X4D,0X63,
-0X2D,0X63,0X2D,0X63,0X2C,0X63,0X2C,0X63,0X0C,0X63,0X0C,0X63,0X0C,0X63,0X0C,0X63,
-0X0C,0X63,0XEC,0X5A,0XEC,0X5A,0XEC,0X5A,0XEC,0X5A,0XEB,0X5A,0XEB,0X5A,0XEB,0X5A,
-0XCB,0X5A,0XCB,0X5A,0XCB,0X5A,0XCB,0X5A,0XCB,0X5A,0XCB,0X5A,0XCB,0X52,0XAB,0X52,
-0XAB,0X52,0XAB,0X52,0XAA,0X52,0XAA,0X52,0XAA,0X52,0XAA,0X52,0X8A,0X52,0XAA,0X52,
-0X8A,0X4A,0X8A,0X4A,0XAA,0X52,0XAA,0X52,0XAA,0X52,0XAA,0X52,0XAA,0X52,0XAA,0X52,
-0XAB,0X52,0XCB,0X52,0XCB,0X52,0XCB,0X52,0XCB,0X52,0XCB,0X52,0XCB,0X52,0XCB,0X52,
-0XCB,0X52,0XCB,0X52,0XEB,0X5A,0XEB,0X5A,0XEB,0X5A,0XEB,0X5A,0XEC,0X5A,0XEC,0X5A,
-0X0C,0X5B,0X0C,0X5B,0X0C,0X5B,0X0C,0X5B,0X0C,0X5B,0X0C,0X5B,0X0C,0X63,0X2C,0X63,
-0X2C,0X63,0X2C,0X63,0X2D,0X63,0X4D,0X63,0X4D,0X63,0X4D,0X63,0X4D,0X6B,0X4D,0X6B,
-0X4D,0X63,0X6D,0X6B,0X6D,0X6B,0X6D,0X6B,0X8E,0X6B,0X6E,0X6B,0X6E,0X6B,0X8E,0X6B,
-0X8E,0X6B,0X8E,0X6B,0XAE,0X73,0XAE,0X73,0X8E,0X6B,0XAE,0X73,0XAF,0X73,0XEB,0X5A,
-0X65,0X29,0X82,0X10,0XA2,0X18,0XC3,0X18,0XE3,0X20,0XE3,0X20,0XE3,0X20,0XE3,0X20,
-0XE3,0X20,0X24,0X29,0X04,0X21,0X03,0X21,0X04,0X21,0X24,0X29,0X24,0X29,0XE7,0X41,
-0X65,0X31,0X86,0X39,0X65,0X31,0X65,0X31,0X85,0X31,0X03,0X21,0X65,0X31,0X65,0X31,
-0XE3,0X20,0X04,0X29,0XE3,0X20,0X03,0X21,0XC3,0X18,0XA2,0X10,0XE3,0X18,0X24,0X29,
-0X24,0X29,0X65,0X31,0X86,0X39,0X85,0X31,0XC6,0X41,0X85,0X39,0XE7,0X41,0X28,0X52,
-0X69,0X5A,0X69,0X5A,0X27,0X52,0XC6,0X41,0X07,0X52,0X68,0X5A,0X68,0X52,0X68,0X5A,
-0X0B,0X73,0X68,0X5A,0X2B,0X7B,0X8C,0X83,0XEA,0X6A,0X2B,0X73,0X28,0X52,0X07,0X4A,
-0XC6,0X41,0X86,0X39,0X65,0X31,0X24,0X29,0X04,0X21,0XE3,0X20,0XC3,0X18,0XC3,0X18,
-0XC3,0X18,0XA2,0X18,0XA2,0X18,0X81,0X10,0X82,0X10,0XA2,0X18,0X82,0X10,0XA2,0X18,
-0X69,0X52,0X2C,0X63,0X10,0X84,0X2C,0X63,0X8E,0X6B,0X51,0X84,0X31,0X84,0X30,0X84,
-0X30,0X84,0X31,0X84,0X10,0X7C,0X10,0X7C,0X10,0X7C,0X10,0X7C,0X10,0X7C,0XF0,0X7B,
-0XF0,0X7B,0XF0,0X7B,0XF0,0X7B,0XEF,0X73,0XCF,0X73,0XCF,0X73,0XCF,0X73,0XCF,0X73,
-0XAF,0X73,0XAF,0X73,0XAE,0X73,0XAE,0X73,0X8E,0X6B,0XAE,0X6B,0X8E,0X6B,0X8E,0X6B,
-0X8E,0X6B,0X8E,0X6B,0X6E,0X6B,0X6D,0X6B,0X6D,0X6B,0X6D,0X6B,0X4D,0X6B,0X4D,0X63,
-0X4D,0X6B,0X4D,0X63,0X2C,0X63,0X2C,0X63,0X2C,0X63,0X2C,0X63,0X0C,0X63,0X0C,0X63,
-0X0C,0X5B,0X0C,0X5B,0XEC,0X5A,0XEC,0X5A,0XEC,0X5A,0XEB,0X5A,0XEC,0X5A,0XEB,0X5A,
-0XEB,0X5A,0XCB,0X5A,0XCB,0X5A,0XCB,0X5A,0XCB,0X5A,0XCB,0X52,0XCB,0X52,0XAB,0X52,
-0XAA,0X52,0XAA,0X52,0XAA,0X52,0XAA,0X52,0XAA,0X52,0XAA,0X52,0XAA,0X52,0XAA,0X52,
-0XAA,0X52,0X8A,0X4A,0XAA,0X52,0XAA,0X52,0XAA,0X52,0XAA,0X52,0XAB,0X52,0XAA,0X52,
-0XAB,0X52,0XAB,0X52,0XCB,0X52,0XCB,0X52,0XCB,0X52,0XCB,0X52,0XCB,0X52,0XCB,0X52,
-0XCB,0X52,0XEB,0X5A,0XEB,0X5A,0XEB,0X5A,0XEB,0X5A,0XEC,0X5A,0X0C,0X5B,0XEC,0X5A,
-0X0C,0X5B,0X0C,0X5B,0X0C,0X5B,0X0C,0X5B,0X0C,0X5B,0X0C,0X5B,0X2C,0X63,0X2C,0X63,
-0X2D,0X63,0X2D,0X63,0X2D,0X63,0X4D,0X63,0X4D,0X63,0X4D,0X63,0X4D,0X63,0X4D,0X6B,
-0X6D,0X6B,0X6D,0X6B,0X6E,0X6B,0X6E,0X6B,0X8E,0X6B,0X6E,0X6B,0X6E,0X6B,0X8E,0X6B,
-0XAE,0X73,0X8E,0X6B,0XAE,0X73,0XAE,0X73,0X8E,0X6B,0XCF,0X73,0X0C,0X63,0X69,0X52,
-0X61,0X10,0XA2,0X18,0XC2,0X18,0XC3,0X18,0XC3,0X18,0XE3,0X20,0XE3,0X20,0XE3,0X20,
-0X03,0X21,0X04,0X21,0XE3,0X20,0X03,0X21,0X04,0X21,0X45,0X29,0XA6,0X39,0X65,0X31,
-0X65,0X31,0X86,0X39,0X65,0X31,0X45,0X31,0X65,0X31,0XA6,0X39,0X45,0X31,0XE3,0X20,
-0X24,0X29,0X24,0X29,0XC3,0X18,0XC3,0X18,0XE3,0X20,0X45,0X29,0X45,0X29,0XA6,0X39,
-0X28,0X4A,0X48,0X52,0X48,0X52,0X68,0X52,0X89,0X5A,0X89,0X62,0X89,0X62,0XA9,0X62,
-0X0B,0X73,0X8D,0X83,0X4F,0X9C,0X4B,0X7B,0X0A,0X73,0X0B,0X73,0X0B,0X7B,0X89,0X62,
-0X8C,0X8B,0X2B,0X7B,0XAC,0X8B,0XCD,0X8B,0X2B,0X7B,0X27,0X4A,0XE7,0X41,0XC6,0X41,
-0XA6,0X41,0X65,0X31,0X24,0X29,0XE3,0X20,0XE3,0X20,0XE3,0X20,0XC3,0X18,0XA2,0X18,
-0XA2,0X18,0X82,0X10,0XA2,0X10,0X81,0X10,0X82,0X10,0XA2,0X18,0XC2,0X18,0XA2,0X18,
-0X04,0X29,0XEB,0X5A,0X2C,0X63,0X8E,0X73,0XCB,0X5A,0X10,0X84,0X31,0X84,0X10,0X7C,
-0X30,0X84,0X31,0X84,0X31,0X84,0X31,0X84,0X30,0X84,0X10,0X7C,0X10,0X7C,0X10,0X7C,
-0X10,0X7C,0XF0,0X7B,0XF0,0X7B,0XF0,0X7B,0XF0,0X7B,0XEF,0X7B,0XCF,0X73,0XCF,0X73,
-0XCF,0X73,0XCF,0X73,0XCF,0X73,0XAF,0X73,0XAF,0X73,0X8F,0X73,0X8E,0X6B,0X8E,0X6B,
-0X8E,0X6B,0X8E,0X6B,0X6E,0X6B,0X6E,0X6B,0X6D,0X6B,0X6D,0X6B,0X4D,0X6B,0X6D,0X63,
-0X4D,0X63,0X4D,0X6B,0X4D,0X63,0X2D,0X63,0X2C,0X63,0X2C,0X63,0X0C,0X63,0X2C,0X5B,
-0X0C,0X5B,0X0C,0X63,0X0C,0X5B,0XEC,0X5A,0X0C,0X5B,0XEC,0X5A,0XEC,0X5A,0XEB,0X5A,
-0XCB,0X5A,0XCB,0X5A,0XCB,0X5A,0XCB,0X5A,0XCB,0X5A,0XCB,0X5A,0XAB,0X52,0XAB,0X52,
-0XAB,0X52,0XAB,0X52,0XAA,0X52,0XAB,0X52,0XAA,0X52,0XAA,0X52,0XAA,0X52,0XAB,0X52,
-0XAA,0X52,0XAA,0X52,0XAA,0X52,0XAA,0X52,0XAA,0X52,0XAA,0X52,0XAB,0X52,0XAB,0X52,
-0XCB,0X52,0XCB,0X52,0XCB,0X52,0XCB,0X52,0XCB,0X52,0XCB,0X52,0XEB,0X52,0XEB,0X5A,
-0XEB,0X5A,0XEB,0X5A,0XEB,0X5A,0XEB,0X5A,0XEC,0X5A,0XEC,0X5A,0XEC,0X5A,0X0C,0X5B,
-0X0C,0X5B,0X0C,0X5B,0X0C,0X5B,0X2C,0X63,0X0C,0X5B,0X2C,0X63,0X2C,0X63,0X2C,0X63,
-0X2C,0X63,0X4D,0X63,0X4D,0X63,0X4D,0X63,0X4D,0X63,0X4D,0X63,0X4D,0X63,0X6D,0X6B,
-0X6D,0X6B,0X6E,0X6B,0X6E,0X6B,0X8E,0X6B,0X8E,0X6B,0X6E,0X6B,0X8E,0X73,0X8E,0X6B,
-0XAE,0X73,0XAE,0X73,0XAE,0X73,0XAE,0X73,0XCF,0X73,0XAE,0X73,0XEB,0X5A,0X03,0X21,
-0XA2,0X18,0XC2,0X18,0XA2,0X18,0XC3,0X18,0XE3,0X20,0XE3,0X20,0XC3,0X18,0XE3,0X20,
-0X04,0X21,0XE3,0X20,0XC3,0X18,0X04,0X21,0X04,0X29,0X45,0X31,0X85,0X39,0X65,0X31,
-0X65,0X31,0X86,0X39,0X45,0X29,0X45,0X31,0X86,0X39,0X45,0X31,0X45,0X31,0X44,0X29,
-0XC3,0X20,0X82,0X18,0XE3,0X20,0X45,0X29,0XA6,0X39,0XE7,0X49,0XCA,0X62,0XEB,0X6A,
-0XAE,0X8B,0XCE,0X8B,0X4F,0X9C,0X0E,0X94,0XEE,0X93,0XEE,0X93,0XAD,0X8B,0X8D,0X8B,
-0X8C,0X8B,0X8C,0X8B,0X2E,0X9C,0X90,0XAC,0X0E,0X9C,0X4F,0XA4,0X4F,0XA4,0X90,0XAC,
-0X2B,0X7B,0XAC,0X8B,0X4F,0XA4,0X0E,0X94,0X4C,0X7B,0X0B,0X73,0X48,0X5A,0X07,0X4A,
-0X85,0X39,0X65,0X31,0X24,0X29,0XE3,0X20,0X82,0X10,0XA2,0X18,0XC3,0X18,0XA2,0X18,
-0X61,0X10,0X61,0X10,0X61,0X08,0X81,0X10,0X81,0X10,0X82,0X10,0XA2,0X18,0XE3,0X20,
-0XA2,0X18,0X28,0X42,0X8E,0X73,0X8E,0X73,0X2D,0X63,0X8E,0X73,0X51,0X8C,0X51,0X84,
-0X31,0X84,0X30,0X84,0X10,0X7C,0X31,0X84,0X30,0X84,0X30,0X84,0X31,0X84,0X30,0X84,
-0X10,0X7C,0X10,0X7C,0X10,0X7C,0X10,0X7C,0XF0,0X7B,0XF0,0X7B,0XF0,0X7B,0XCF,0X73,
-0XCF,0X73,0XCF,0X73,0XCF,0X73,0XCF,0X73,0XAF,0X73,0XAF,0X73,0XAF,0X73,0X8E,0X6B,
-0XAE,0X73,0X8E,0X6B,0X8E,0X6B,0X6E,0X6B,0X6E,0X6B,0X6E,0X6B,0X6D,0X6B,0X4D,0X6B,
-0X6D,0X6B,0X4D,0X6B,0X4D,0X63,0X4D,0X63,0X4D,0X63,0X2D,0X63,0X2C,0X63,0X0C,0X63,
-0X0C,0X63,0X0C,0X63,0X0C,0X63,0X0C,0X63,0X0C,0X5B,0X0C,0X5B,0XEC,0X5A,0XEC,0X5A,
-0XEB,0X5A,0XEB,0X5A,0XEB,0X5A,0XEB,0X5A,0XCB,0X5A,0XCB,0X5A,0XCB,0X5A,0XCB,0X52,
-0XCB,0X52,0XAB,0X52,0XAB,0X52,0XAA,0X52,0XAB,0X52,0XAA,0X52,0XAA,0X52,0XAB,0X52,
-0XAA,0X52,0XAA,0X52,0XAA,0X52,0XAA,0X52,0XAA,0X52,0XAA,0X52,0XAB,0X52,0XAB,0X52,
-0XCB,0X52,0XCB,0X52,0XCB,0X52,0XCB,0X52,0XCB,0X52,0XCB,0X52,0XCB,0X52,0XCB,0X5A,
-0XEB,0X5A,0XEB,0X5A,0XEB,0X5A,0XEB,0X5A,0XEC,0X5A,0X0C,0X5B,0X0C,0X5B,0X0C,0X5B,
-0X0C,0X5B,0X0C,0X5B,0X0C,0X5B,0X2C,0X63,0X0C,0X5B,0X2C,0X63,0X2C,0X63,0X2D,0X63,
-0X2D,0X63,0X4D,0X63,0X4D,0X63,0X4D,0X63,0X4D,0X63,0X6D,0X6B,0X6D,0X6B,0X6D,0X6B,
-0X6E,0X6B,0X8E,0X6B,0X6E,0X6B,0X8E,0X6B,0X8E,0X6B,0X8E,0X6B,0XAE,0X73,0XAE,0X73,
-0XAE,0X73,0XAF,0X73,0XCF,0X73,0XCF,0X73,0XEF,0X7B,0X4D,0X6B,0X28,0X42,0XA2,0X10,
-0X82,0X10,0XC3,0X18,0XC2,0X18,0XC3,0X18,0XC3,0X18,0XC3,0X18,0XE3,0X20,0XC3,0X18,
-0XE3,0X20,0XA2,0X18,0XE3,0X20,0XC3,0X18,0XE3,0X20,0X86,0X39,0X45,0X31,0X65,0X31,
-0XA6,0X39,0X24,0X29,0X86,0X39,0X86,0X39,0X44,0X31,0X86,0X39,0X24,0X29,0X82,0X18,
-0XC3,0X18,0X45,0X31,0XC6,0X41,0X07,0X4A,0X48,0X52,0XEB,0X6A,0X0E,0X94,0X91,0XA4,
-0XD1,0XB4,0X33,0XBD,0X73,0XC5,0X94,0XCD,0XD5,0XD5,0X74,0XCD,0X94,0XCD,0X33,0XC5,
-0XD1,0XB4,0XB1,0XB4,0XB1,0XB4,0XD1,0XBC,0X32,0XC5,0XF2,0XBC,0X94,0XCD,0X12,0XBD,
-0X2F,0XA4,0X6F,0XAC,0X0E,0XA4,0XCD,0X93,0XAD,0X8B,0XCA,0X6A,0X89,0X5A,0X07,0X4A,
-0XC6,0X41,0X85,0X39,0X24,0X29,0XE3,0X20,0X04,0X21,0XE3,0X20,0X82,0X10,0X61,0X10,
-0X81,0X10,0X61,0X10,0X61,0X08,0X61,0X10,0X61,0X10,0X82,0X10,0XA2,0X10,0X82,0X10,
-0XC3,0X20,0X03,0X21,0XEB,0X5A,0XAF,0X73,0X8E,0X73,0XCA,0X52,0X30,0X84,0X51,0X84,
-0X51,0X84,0X51,0X84,0X51,0X84,0X51,0X84,0X10,0X7C,0X31,0X84,0X31,0X84,0X31,0X84,
-0X10,0X7C,0X10,0X7C,0X10,0X7C,0X10,0X7C,0X10,0X7C,0XF0,0X7B,0XF0,0X7B,0XF0,0X7B,
-0XF0,0X7B,0XCF,0X73,0XCF,0X73,0XCF,0X73,0XCF,0X73,0XAF,0X73,0XAF,0X73,0XAF,0X73,
-0XAE,0X73,0XAE,0X73,0X8E,0X6B,0X8E,0X6B,0X8E,0X6B,0X8E,0X6B,0X6E,0X6B,0X6E,0X6B,
-0X6D,0X6B,0X4D,0X6B,0X4D,0X6B,0X4D,0X6B,0X4D,0X63,0X4D,0X63,0X2C,0X63,0X2C,0X63,
-0X0C,0X63,0X2C,0X63,0X0C,0X63,0X0C,0X63,0X0C,0X63,0X0C,0X63,0XEC,0X5A,0XEC,0X5A,
-0XEB,0X5A,0XEC,0X5A,0XEB,0X5A,0XEB,0X5A,0XEB,0X5A,0XEB,0X5A,0XCB,0X5A,0XCB,0X5A,
-0XCB,0X5A,0XCB,0X52,0XAB,0X52,0XAB,0X52,0XAB,0X52,0XAA,0X52,0XAA,0X52,0XAB,0X52,
-0XAA,0X52,0XAA,0X52,0XAA,0X52,0XAA,0X52,0XAA,0X52,0XAB,0X52,0XAB,0X52,0XCB,0X52,
-0XCB,0X52,0XCB,0X52,0XCB,0X52,0XCB,0X52,0XCB,0X52,0XCB,0X52,0XCB,0X52,0XEB,0X5A,
-0XEB,0X5A,0XEB,0X5A,0XEB,0X5A,0XEB,0X5A,0XEB,0X5A,0X0C,0X5B,0X0C,0X5B,0X0C,0X5B,
-0X0C,0X5B,0X0C,0X5B,0X2C,0X63,0X2C,0X63,0X2C,0X63,0X2D,0X63,0X2D,0X63,0X2D,0X63,
-0X4D,0X63,0X4D,0X63,0X6D,0X6B,0X4D,0X63,0X6D,0X6B,0X6D,0X6B,0X6D,0X6B,0X6D,0X6B,
-0X8E,0X6B,0X8E,0X6B,0X8E,0X6B,0X8E,0X6B,0X6E,0X6B,0XAE,0X73,0XAE,0X73,0XAE,0X73,
-0XCF,0X73,0XCF,0X73,0XCF,0X73,0XCF,0X73,0XEF,0X7B,0XAA,0X52,0XE3,0X20,0X82,0X10,
-0X82,0X10,0XA2,0X18,0XC3,0X18,0XC3,0X18,0XC3,0X18,0XE3,0X20,0XA2,0X18,0XC3,0X18,
-0XC2,0X18,0XA2,0X18,0XE3,0X20,0XC3,0X18,0X24,0X29,0X65,0X31,0X45,0X31,0X65,0X31,
-0X45,0X29,0X65,0X39,0X86,0X39,0X45,0X31,0X65,0X39,0XC3,0X20,0XC2,0X20,0X44,0X31,
-0XE7,0X49,0X28,0X52,0XAA,0X62,0XCA,0X6A,0X6C,0X7B,0X70,0XA4,0X12,0XBD,0XB5,0XCD,
-0X37,0XDE,0X57,0XDE,0X78,0XE6,0X37,0XDE,0X57,0XE6,0X37,0XE6,0X37,0XDE,0X37,0XDE,
-0X37,0XE6,0X94,0XCD,0X53,0XCD,0X13,0XC5,0X33,0XC5,0X12,0XC5,0XB5,0XD5,0X33,0XC5,
-0XB1,0XB4,0X6F,0XAC,0XAD,0X93,0XEA,0X7A,0X2B,0X7B,0X0A,0X73,0X68,0X5A,0XE7,0X49,
-0X85,0X39,0X65,0X31,0X65,0X39,0X65,0X31,0X04,0X21,0XC3,0X18,0XA2,0X18,0X82,0X10,
-0X61,0X10,0X61,0X10,0X61,0X10,0X61,0X10,0X61,0X08,0X61,0X08,0X82,0X10,0XC3,0X18,
-0XA2,0X18,0XE3,0X20,0XC6,0X39,0X6D,0X6B,0XCF,0X7B,0X8E,0X73,0X0C,0X63,0XEF,0X7B,
-0X10,0X84,0X51,0X84,0X51,0X84,0X51,0X84,0X51,0X84,0X31,0X84,0X31,0X84,0X51,0X84,
-0X31,0X84,0X31,0X84,0X11,0X84,0X30,0X84,0X10,0X7C,0X10,0X7C,0X10,0X7C,0XF0,0X7B,
-0XF0,0X7B,0XF0,0X7B,0XCF,0X73,0XCF,0X73,0XCF,0X73,0XCF,0X73,0XCF,0X73,0XCF,0X73,
-0XAF,0X73,0XAF,0X73,0XAE,0X73,0X8E,0X6B,0X8E,0X6B,0X8E,0X6B,0X8E,0X6B,0X6E,0X6B,
-0X6D,0X6B,0X6D,0X6B,0X6D,0X6B,0X4D,0X6B,0X4D,0X6B,0X4D,0X63,0X4D,0X63,0X2D,0X63,
-0X2C,0X63,0X2C,0X63,0X2C,0X63,0X0C,0X63,0X0C,0X63,0X0C,0X63,0X0C,0X63,0XEC,0X5A,
-0XEC,0X5A,0XEC,0X5A,0XEC,0X5A,0XEB,0X5A,0XEB,0X5A,0XCB,0X5A,0XCB,0X5A,0XCB,0X5A,
-0XCB,0X5A,0XCB,0X5A,0XAB,0X52,0XAB,0X52,0XAB,0X52,0XAB,0X52,0XAA,0X52,0XAB,0X52,
-0XAA,0X52,0XAA,0X52,0XAA,0X52,0XAA,0X52,0XAA,0X52,0XAA,0X52,0XCB,0X52,0XCB,0X52,
-0XCB,0X52,0XCB,0X52,0XCB,0X52,0XCB,0X52,0XCB,0X52,0XCB,0X52,0XEB,0X5A,0XEB,0X5A,
-0XEB,0X5A,0XEB,0X5A,0XEB,0X5A,0XEB,0X5A,0XEC,0X5A,0X0C,0X5B,0X0C,0X5B,0X0C,0X5B,
-0X0C,0X5B,0X0C,0X5B,0X0C,0X5B,0X2C,0X63,0X2C,0X63,0X4D,0X63,0X2D,0X63,0X4D,0X63,
-0X4D,0X63,0X4D,0X63,0X4D,0X63,0X6D,0X6B,0X6D,0X6B,0X6D,0X6B,0X6E,0X6B,0X6E,0X6B,
-0X8E,0X6B,0X8E,0X6B,0X8E,0X6B,0X8E,0X73,0X8E,0X6B,0XAF,0X73,0XAF,0X73,0XCF,0X73,
-0XCF,0X73,0XCF,0X73,0XCF,0X73,0XF0,0X7B,0X4D,0X6B,0XA6,0X39,0X82,0X10,0X82,0X10,
-0XE3,0X20,0XA2,0X18,0XA2,0X18,0XC3,0X18,0XC3,0X20,0XA2,0X18,0XC3,0X18,0XC3,0X18,
-0X82,0X10,0XC3,0X18,0XC3,0X18,0XE3,0X20,0X86,0X31,0X45,0X29,0X45,0X29,0X86,0X31,
-0X65,0X31,0X65,0X31,0X65,0X31,0X65,0X31,0XE3,0X20,0X24,0X29,0XC6,0X49,0XA9,0X6A,
-0X2B,0X7B,0X8C,0X8B,0XAD,0X93,0X90,0XA4,0X12,0XB5,0X94,0XC5,0X16,0XD6,0X78,0XE6,
-0X78,0XE6,0XB9,0XEE,0XB9,0XEE,0XB9,0XEE,0X98,0XEE,0X99,0XEE,0X98,0XEE,0X78,0XEE,
-0X57,0XE6,0X36,0XDE,0XD5,0XD5,0XB5,0XD5,0XB5,0XD5,0XB5,0XD5,0XB5,0XD5,0X94,0XD5,
-0X33,0XC5,0X90,0XB4,0X70,0XAC,0X0E,0X9C,0X4E,0XA4,0X4B,0X7B,0XC9,0X6A,0X89,0X62,
-0X07,0X4A,0XA6,0X39,0X86,0X39,0X44,0X29,0XC3,0X18,0XC3,0X18,0XA2,0X18,0XA2,0X18,
-0XA2,0X18,0X82,0X10,0X61,0X10,0X61,0X08,0X61,0X08,0X61,0X08,0X61,0X08,0X82,0X18,
-0XA2,0X18,0XE3,0X20,0X24,0X29,0X89,0X52,0XF0,0X7B,0XEF,0X7B,0XEB,0X5A,0XEF,0X7B,
-0X10,0X84,0X31,0X84,0X51,0X84,0X51,0X84,0X72,0X8C,0X72,0X8C,0X31,0X84,0X51,0X84,
-0X51,0X84,0X51,0X84,0X31,0X84,0X31,0X84,0X30,0X84,0X10,0X7C,0X10,0X7C,0X10,0X7C,
-0X10,0X7C,0XF0,0X7B,0XF0,0X7B,0XF0,0X7B,0XEF,0X73,0XCF,0X73,0XCF,0X73,0XCF,0X73,
-0XAF,0X73,0XAF,0X73,0XAF,0X73,0XAE,0X73,0X8E,0X6B,0X8E,0X6B,0X8E,0X6B,0X8E,0X6B,
-0X6E,0X6B,0X6D,0X6B,0X6E,0X6B,0X6D,0X6B,0X4D,0X6B,0X4D,0X6B,0X4D,0X6B,0X4D,0X6B,
-0X2D,0X63,0X2D,0X63,0X2C,0X63,0X0C,0X63,0X0C,0X63,0X0C,0X63,0X0C,0X63,0X0C,0X5B,
-0XEC,0X5A,0XEC,0X5A,0XEB,0X5A,0XEC,0X5A,0XEB,0X5A,0XCB,0X5A,0XCB,0X5A,0XCB,0X5A,
-0XCB,0X5A,0XCB,0X52,0XCB,0X52,0XAB,0X52,0XAB,0X52,0XAB,0X52,0XAA,0X52,0XAB,0X52,
-0XAA,0X52,0XAA,0X52,0XAA,0X52,0XAA,0X52,0XAB,0X52,0XCB,0X52,0XAB,0X52,0XCB,0X52,
-0XCB,0X52,0XCB,0X52,0XCB,0X52,0XCB,0X52,0XCB,0X52,0XEB,0X5A,0XEB,0X5A,0XEB,0X5A,
-0XEB,0X5A,0XEB,0X5A,0XEB,0X5A,0X0C,0X5B,0X0C,0X5B,0X0C,0X5B,0X0C,0X5B,0X0C,0X5B,
-0X2C,0X63,0X2C,0X63,0X2C,0X63,0X2D,0X63,0X4D,0X63,0X4D,0X63,0X4D,0X63,0X4D,0X63,
-0X4D,0X63,0X6D,0X6B,0X6D,0X6B,0X6D,0X6B,0X6E,0X6B,0X6E,0X6B,0X6E,0X6B,0X8E,0X6B,
-0X8E,0X6B,0X8E,0X6B,0X8E,0X6B,0XAE,0X73,0X8E,0X6B,0XAF,0X73,0XCF,0X73,0XCF,0X73,
-0XCF,0X73,0XCF,0X73,0XEF,0X7B,0XCF,0X73,0XEB,0X5A,0XA2,0X18,0X82,0X10,0XC3,0X18,
-0XA2,0X18,0XA2,0X18,0XA2,0X18,0XC3,0X18,0XA2,0X18,0XA2,0X18,0XC3,0X18,0XA2,0X18,
-0XA2,0X18,0XC3,0X18,0XC3,0X18,0X24,0X29,0X45,0X29,0X24,0X29,0X65,0X31,0X65,0X31,
-0X65,0X31,0X65,0X31,0X45,0X31,0XE3,0X20,0X85,0X39,0XA9,0X6A,0XEE,0X9B,0X6F,0XB4,
-0XF2,0XC4,0X53,0XCD,0X74,0XCD,0XD5,0XCD,0X36,0XDE,0X78,0XE6,0X98,0XE6,0XB9,0XEE,
-0XFA,0XEE,0XFA,0XF6,0XFA,0XF6,0XFA,0XF6,0XD9,0XEE,0XD9,0XEE,0XD9,0XEE,0XB9,0XF6,
-0X98,0XEE,0X57,0XE6,0X37,0XE6,0XF6,0XDD,0XD5,0XD5,0XB5,0XD5,0X94,0XCD,0XB5,0XD5,
-0X53,0XCD,0X94,0XCD,0XF2,0XBC,0XB0,0XBC,0X90,0XB4,0XED,0X9B,0XE9,0X72,0X88,0X62,
-0X07,0X4A,0XE7,0X41,0X65,0X39,0X44,0X31,0XE3,0X20,0XA2,0X18,0X61,0X10,0X61,0X10,
-0X41,0X08,0X82,0X10,0X82,0X10,0X81,0X10,0X81,0X10,0X61,0X08,0X61,0X08,0X61,0X10,
-0XA2,0X18,0XC3,0X18,0X04,0X21,0XC7,0X39,0XCB,0X5A,0X31,0X84,0XCF,0X7B,0XEF,0X7B,
-0XCF,0X7B,0X10,0X7C,0X51,0X8C,0X71,0X8C,0X51,0X84,0X72,0X8C,0X72,0X8C,0X31,0X84,
-0X51,0X84,0X51,0X84,0X51,0X84,0X51,0X84,0X31,0X84,0X30,0X84,0X30,0X84,0X10,0X7C,
-0X10,0X7C,0X10,0X7C,0X10,0X7C,0XF0,0X7B,0XF0,0X7B,0XF0,0X7B,0XEF,0X73,0XCF,0X73,
-0XCF,0X73,0XCF,0X73,0XAF,0X73,0XAF,0X73,0XAF,0X73,0XAE,0X73,0XAE,0X73,0X8E,0X6B,
-0X8E,0X6B,0X8E,0X6B,0X6D,0X6B,0X6D,0X6B,0X6D,0X6B,0X4D,0X6B,0X4D,0X6B,0X4D,0X63,
-0X2D,0X63,0X2D,0X63,0X2C,0X63,0X0C,0X63,0X2C,0X63,0X0C,0X63,0X0C,0X63,0X0C,0X63,
-0X0C,0X5B,0XEC,0X5A,0XEC,0X5A,0XEC,0X5A,0XEB,0X5A,0XEB,0X5A,0XCB,0X5A,0XCB,0X5A,
-0XCB,0X5A,0XCB,0X5A,0XCB,0X52,0XCB,0X5A,0XCB,0X5A,0XAB,0X52,0XAA,0X52,0XAB,0X52,
-0XAA,0X52,0XAA,0X52,0XAA,0X52,0XAB,0X52,0XAA,0X52,0XAB,0X52,0XAB,0X52,0XCB,0X52,
-0XCB,0X52,0XCB,0X52,0XCB,0X52,0XCB,0X5A,0XCB,0X5A,0XEB,0X5A,0XEB,0X5A,0XEB,0X5A,
-0XEB,0X5A,0XEB,0X5A,0XEC,0X5A,0X0C,0X5B,0XEC,0X5A,0X0C,0X5B,0X0C,0X5B,0X0C,0X5B,
-0X2C,0X63,0X2C,0X63,0X2C,0X63,0X2D,0X63,0X2D,0X63,0X4D,0X63,0X4D,0X63,0X4D,0X63,
-0X4D,0X63,0X6D,0X6B,0X6D,0X6B,0X6D,0X6B,0X6E,0X6B,0X6E,0X6B,0X8E,0X6B,0X8E,0X6B,
-0X8E,0X6B,0X8E,0X6B,0XAE,0X73,0XAE,0X73,0XAE,0X73,0XCF,0X73,0XCF,0X73,0XCF,0X73,
-0XCF,0X73,0XEF,0X73,0XCF,0X7B,0X8E,0X73,0XA6,0X39,0X61,0X10,0X82,0X10,0XC3,0X18,
-0XA2,0X18,0XA2,0X18,0XA2,0X18,0XC3,0X18,0XC3,0X18,0XA2,0X18,0X82,0X10,0XA2,0X18,
-0XA2,0X18,0XA2,0X18,0XA2,0X18,0X65,0X31,0X24,0X29,0X85,0X31,0X65,0X31,0X45,0X31,
-0X45,0X31,0X65,0X31,0XC3,0X20,0XC6,0X41,0X6C,0X8B,0X12,0XC5,0XD5,0XDD,0XF6,0XE5,
-0X16,0XE6,0XD5,0XDD,0X37,0XE6,0X98,0XEE,0XB9,0XEE,0XB9,0XEE,0XDA,0XEE,0XFA,0XF6,
-0XFA,0XF6,0X1B,0XF7,0X1A,0XF7,0XFA,0XF6,0XFA,0XF6,0XFA,0XF6,0XFA,0XEE,0XFA,0XF6,
-0XB9,0XEE,0X98,0XEE,0X58,0XEE,0X17,0XE6,0X16,0XDE,0XD5,0XD5,0XD5,0XD5,0X94,0XCD,
-0XB5,0XD5,0X95,0XD5,0X12,0XC5,0X53,0XCD,0X4F,0XAC,0XD2,0XBC,0XED,0X93,0XC9,0X72,
-0XA9,0X6A,0X07,0X52,0X85,0X39,0X44,0X29,0X44,0X29,0X45,0X29,0XA2,0X18,0X62,0X10,
-0X41,0X08,0X20,0X00,0X61,0X08,0X82,0X10,0X61,0X08,0X82,0X10,0X82,0X10,0X41,0X08,
-0X61,0X10,0X82,0X10,0XC3,0X18,0X24,0X29,0X29,0X4A,0X6D,0X6B,0X92,0X8C,0X4D,0X6B,
-0X51,0X84,0X30,0X84,0XF0,0X7B,0X72,0X8C,0X71,0X84,0X92,0X8C,0X72,0X8C,0X51,0X84,
-0X71,0X8C,0X71,0X8C,0X51,0X84,0X51,0X84,0X51,0X84,0X31,0X84,0X11,0X84,0X31,0X84,
-0X30,0X84,0X10,0X7C,0X10,0X7C,0X10,0X7C,0X10,0X7C,0XF0,0X7B,0XEF,0X7B,0XEF,0X7B,
-0XEF,0X7B,0XCF,0X73,0XCF,0X73,0XAF,0X73,0XAF,0X73,0XAE,0X73,0XAE,0X73,0X8E,0X73,
-0X8E,0X73,0X6E,0X6B,0X8E,0X6B,0X6E,0X6B,0X6E,0X6B,0X6D,0X6B,0X4D,0X6B,0X4D,0X6B,
-0X4D,0X63,0X4D,0X63,0X2D,0X63,0X2D,0X63,0X2C,0X63,0X0C,0X63,0X0C,0X63,0X0C,0X63,
-0X0C,0X63,0X0C,0X5B,0XEC,0X5A,0XEC,0X5A,0XEB,0X5A,0XEB,0X5A,0XEB,0X5A,0XCB,0X5A,
-0XCB,0X5A,0XCB,0X5A,0XCB,0X5A,0XCB,0X5A,0XCB,0X52,0XCB,0X52,0XAB,0X52,0XCB,0X52,
-0XAA,0X52,0XAA,0X52,0XAA,0X52,0XAB,0X52,0XAB,0X52,0XAB,0X52,0XCB,0X52,0XCB,0X52,
-0XCB,0X52,0XCB,0X5A,0XCB,0X52,0XCB,0X52,0XCB,0X5A,0XEB,0X5A,0XEB,0X5A,0XEB,0X5A,
-0XEB,0X5A,0XEC,0X5A,0X0C,0X5B,0X0C,0X5B,0X0C,0X5B,0X0C,0X5B,0X0C,0X5B,0X0C,0X5B,
-0X2C,0X63,0X2C,0X63,0X2D,0X63,0X2D,0X63,0X4D,0X63,0X4D,0X63,0X4D,0X63,0X4D,0X63,
-0X6D,0X6B,0X6D,0X6B,0X6D,0X6B,0X6D,0X6B,0X6E,0X6B,0X8E,0X6B,0X8E,0X6B,0X8E,0X6B,
-0X8E,0X6B,0XAE,0X73,0XAF,0X73,0XAF,0X73,0XAE,0X73,0XCF,0X73,0XCF,0X73,0XCF,0X73,
-0XEF,0X7B,0X10,0X7C,0X6D,0X6B,0XAE,0X73,0XC3,0X18,0XA2,0X18,0XC2,0X18,0XA2,0X18,
-0XA2,0X18,0X82,0X10,0XC3,0X20,0XA2,0X18,0XA2,0X18,0XA2,0X18,0X82,0X10,0XA2,0X18,
-0X82,0X10,0XC2,0X18,0X04,0X29,0X24,0X29,0X44,0X29,0X65,0X31,0X45,0X31,0X86,0X39,
-0X45,0X31,0XE3,0X18,0X85,0X41,0X6C,0X8B,0X74,0XD5,0X37,0XEE,0X37,0XE6,0X57,0XE6,
-0X98,0XEE,0X99,0XEE,0XB9,0XEE,0XDA,0XEE,0XDA,0XF6,0XFA,0XF6,0X1A,0XF7,0X1B,0XF7,
-0X1B,0XF7,0X3B,0XFF,0X1B,0XF7,0X1B,0XF7,0X1B,0XF7,0X1B,0XF7,0XFB,0XF6,0XDA,0XF6,
-0XD9,0XF6,0X98,0XEE,0X78,0XEE,0X57,0XE6,0X16,0XDE,0XF6,0XDD,0XD5,0XD5,0XB4,0XD5,
-0X94,0XD5,0XB5,0XD5,0X53,0XC5,0X74,0XCD,0XB0,0XBC,0XD1,0XBC,0XB0,0XB4,0XAD,0X8B,
-0XCA,0X6A,0X68,0X5A,0XC6,0X41,0XA6,0X39,0X44,0X31,0X24,0X29,0X04,0X21,0X82,0X10,
-0X82,0X10,0X62,0X10,0X41,0X08,0X41,0X08,0X82,0X10,0X41,0X10,0X41,0X08,0X82,0X10,
-0X61,0X10,0X61,0X10,0XA2,0X18,0X04,0X21,0XA6,0X39,0XAA,0X52,0XCF,0X73,0X10,0X84,
-0XAF,0X73,0XF0,0X7B,0X92,0X94,0XF0,0X7B,0X51,0X8C,0X72,0X8C,0X51,0X84,0X51,0X84,
-0X51,0X84,0X72,0X8C,0X72,0X8C,0X71,0X8C,0X51,0X84,0X31,0X84,0X31,0X84,0X31,0X84,
-0X31,0X84,0X10,0X84,0X10,0X7C,0X10,0X7C,0X10,0X7C,0X10,0X7C,0XF0,0X7B,0XF0,0X7B,
-0XF0,0X7B,0XCF,0X73,0XCF,0X73,0XCF,0X73,0XCF,0X73,0XCF,0X73,0XAE,0X73,0XAE,0X73,
-0XAE,0X73,0X8E,0X6B,0X8E,0X6B,0X8E,0X6B,0X6E,0X6B,0X6D,0X6B,0X6D,0X6B,0X4D,0X6B,
-0X4D,0X6B,0X4D,0X6B,0X2D,0X63,0X2D,0X63,0X2D,0X63,0X0C,0X63,0X0C,0X63,0X0C,0X63,
-0X0C,0X63,0X0C,0X63,0X0C,0X5B,0XEC,0X5A,0XEC,0X5A,0XEC,0X5A,0XEB,0X5A,0XEB,0X5A,
-0XEB,0X5A,0XCB,0X5A,0XCB,0X5A,0XCB,0X5A,0XCB,0X5A,0XCB,0X52,0XAB,0X52,0XAB,0X52,
-0XAA,0X52,0XAA,0X52,0XAA,0X52,0XAB,0X52,0XCB,0X52,0XCB,0X52,0XCB,0X52,0XCB,0X52,
-0XCB,0X5A,0XCB,0X5A,0XEB,0X52,0XCB,0X52,0XEB,0X5A,0XEB,0X5A,0XEB,0X5A,0XEB,0X5A,
-0XEB,0X5A,0XEC,0X5A,0X0C,0X5B,0X0C,0X5B,0X0C,0X5B,0X0C,0X5B,0X2C,0X63,0X2C,0X63,
-0X0C,0X5B,0X2C,0X63,0X2D,0X63,0X4D,0X63,0X4D,0X63,0X4D,0X63,0X4D,0X63,0X6D,0X6B,
-0X6D,0X6B,0X6D,0X6B,0X8E,0X6B,0X8E,0X6B,0X8E,0X6B,0X8E,0X6B,0X8E,0X6B,0XAE,0X73,
-0XAF,0X73,0XAF,0X73,0XCF,0X73,0XCF,0X73,0XAE,0X73,0XCF,0X73,0XEF,0X7B,0XEF,0X7B,
-0XF0,0X7B,0XAE,0X73,0X11,0X84,0X08,0X42,0X81,0X10,0X82,0X10,0XC3,0X18,0XC3,0X18,
-0X82,0X10,0XA2,0X18,0XA2,0X18,0XA2,0X18,0XC2,0X18,0X81,0X10,0XA2,0X18,0X82,0X10,
-0XA2,0X18,0X03,0X21,0X03,0X21,0XE3,0X20,0X45,0X31,0X24,0X29,0X65,0X39,0X65,0X31,
-0XE3,0X28,0X65,0X31,0XCA,0X7A,0X12,0XCD,0X37,0XE6,0X78,0XEE,0X78,0XEE,0X78,0XEE,
-0XB9,0XF6,0XD9,0XF6,0XFA,0XF6,0XFA,0XF6,0XFA,0XF6,0X1B,0XF7,0X1B,0XF7,0X1B,0XF7,
-0X3B,0XFF,0X3B,0XFF,0X3B,0XFF,0X1B,0XF7,0X1B,0XF7,0X1B,0XF7,0X1B,0XF7,0XFA,0XF6,
-0XDA,0XF6,0XB9,0XF6,0X98,0XEE,0X57,0XE6,0X17,0XE6,0XF6,0XDD,0XD5,0XD5,0XD5,0XDD,
-0XD5,0XD5,0X74,0XCD,0X53,0XCD,0X74,0XD5,0X11,0XC5,0X4F,0XA4,0X0F,0XA4,0X2F,0X9C,
-0X2B,0X7B,0XCA,0X6A,0X48,0X52,0XC6,0X41,0X85,0X39,0X24,0X29,0X24,0X29,0XA3,0X18,
-0X61,0X10,0X82,0X10,0X41,0X08,0X61,0X08,0X21,0X08,0X61,0X10,0X61,0X10,0X41,0X08,
-0X61,0X10,0X82,0X10,0X81,0X10,0XC3,0X18,0X04,0X21,0XA6,0X39,0X8E,0X6B,0X51,0X8C,
-0XCF,0X73,0X31,0X84,0XCF,0X73,0X92,0X8C,0XEF,0X7B,0XB2,0X94,0X92,0X8C,0X71,0X8C,
-0X51,0X84,0X51,0X84,0X51,0X84,0X72,0X8C,0X71,0X8C,0X51,0X84,0X51,0X84,0X51,0X84,
-0X51,0X84,0X31,0X84,0X11,0X84,0X30,0X84,0X10,0X7C,0X10,0X7C,0X10,0X7C,0X10,0X7C,
-0XF0,0X7B,0XF0,0X7B,0XCF,0X73,0XCF,0X73,0XCF,0X73,0XCF,0X73,0XCF,0X73,0XAF,0X73,
-0XAF,0X73,0XAE,0X73,0XAE,0X6B,0X8E,0X6B,0X8E,0X73,0X6E,0X6B,0X6D,0X6B,0X6D,0X6B,
-0X4D,0X6B,0X4D,0X6B,0X4D,0X63,0X2D,0X63,0X2D,0X63,0X2C,0X63,0X2C,0X63,0X0C,0X63,
-0X0C,0X63,0X0C,0X63,0X0C,0X63,0XEC,0X5A,0XEC,0X5A,0XEC,0X5A,0XEB,0X5A,0XEB,0X5A,
-0XCB,0X5A,0XEB,0X5A,0XCB,0X5A,0XCB,0X5A,0XCB,0X5A,0XCB,0X52,0XCB,0X52,0XCB,0X5A,
-0XAA,0X52,0XAA,0X52,0XAA,0X52,0XAB,0X52,0XCB,0X52,0XCB,0X52,0XCB,0X52,0XCB,0X5A,
-0XCB,0X5A,0XCB,0X5A,0XEB,0X52,0XCB,0X52,0XEB,0X5A,0XEB,0X5A,0XEB,0X5A,0XEC,0X5A,
-0XEC,0X5A,0X0C,0X5B,0X0C,0X5B,0X0C,0X5B,0X0C,0X5B,0X0C,0X5B,0X2C,0X63,0X2C,0X63,
-0X2C,0X63,0X2D,0X63,0X4D,0X63,0X4D,0X63,0X4D,0X63,0X4D,0X63,0X6D,0X6B,0X6D,0X6B,
-0X6D,0X6B,0X8E,0X6B,0X8E,0X6B,0X8E,0X6B,0X8E,0X6B,0X8E,0X6B,0XAE,0X73,0XAE,0X73,
-0XAE,0X73,0XAE,0X73,0XCF,0X73,0XCF,0X73,0XAE,0X73,0XF0,0X7B,0XEF,0X7B,0XF0,0X7B,
-0X10,0X7C,0X8E,0X73,0X10,0X84,0XA2,0X18,0X82,0X10,0XC2,0X18,0XC3,0X18,0XC2,0X18,
-0X82,0X10,0XC3,0X18,0X82,0X10,0XA2,0X18,0XA2,0X18,0XA2,0X18,0XA2,0X18,0XC2,0X18,
-0XE3,0X20,0XE3,0X20,0XE3,0X20,0X44,0X29,0X45,0X29,0X45,0X31,0X45,0X31,0X04,0X29,
-0X04,0X29,0X07,0X52,0X8F,0XB4,0X16,0XE6,0X57,0XEE,0X78,0XEE,0X98,0XEE,0XB9,0XF6,
-0XFA,0XF6,0XFA,0XF6,0X1A,0XF7,0X1B,0XF7,0X1B,0XF7,0X3B,0XFF,0X3B,0XFF,0X3B,0XFF,
-0X3C,0XFF,0X3C,0XFF,0X3B,0XFF,0X3B,0XFF,0X3B,0XFF,0X3B,0XFF,0X1B,0XF7,0XFA,0XF6,
-0XFA,0XF6,0XB9,0XF6,0X98,0XEE,0X78,0XEE,0X37,0XE6,0X17,0XE6,0XF6,0XDD,0XF5,0XDD,
-0XD5,0XDD,0XB5,0XD5,0XD5,0XDD,0X53,0XCD,0X12,0XC5,0X4F,0XAC,0XAD,0X93,0XEE,0X93,
-0X2B,0X7B,0XA9,0X6A,0X48,0X5A,0XC6,0X41,0X86,0X39,0X24,0X29,0XA3,0X18,0XC3,0X18,
-0XA2,0X10,0X61,0X08,0X62,0X10,0X41,0X08,0X41,0X08,0X41,0X08,0X41,0X08,0X61,0X10,
-0X40,0X08,0X61,0X10,0X82,0X10,0X82,0X10,0XC2,0X18,0XAA,0X5A,0X28,0X42,0X30,0X84,
-0XAF,0X73,0X51,0X84,0X51,0X8C,0X51,0X8C,0X72,0X8C,0X51,0X84,0XB3,0X94,0X72,0X8C,
-0X92,0X8C,0X92,0X8C,0X92,0X8C,0X51,0X84,0X31,0X84,0X72,0X8C,0X71,0X8C,0X51,0X84,
-0X51,0X84,0X51,0X84,0X31,0X84,0X31,0X84,0X31,0X84,0X10,0X7C,0X10,0X7C,0X10,0X7C,
-0X10,0X7C,0XF0,0X7B,0XF0,0X7B,0XF0,0X7B,0XEF,0X7B,0XCF,0X73,0XCF,0X73,0XCF,0X73,
-0XAF,0X73,0XAE,0X73,0XAE,0X73,0X8E,0X6B,0X8E,0X6B,0X8E,0X6B,0X6E,0X6B,0X6D,0X6B,
-0X6D,0X6B,0X6D,0X6B,0X4D,0X6B,0X4D,0X63,0X4D,0X63,0X2D,0X63,0X2C,0X63,0X0C,0X63,
-0X0C,0X63,0X0C,0X63,0X0C,0X63,0X0C,0X5B,0X0C,0X5B,0XEC,0X5A,0XEC,0X5A,0XEB,0X5A,
-0XEB,0X5A,0XCB,0X5A,0XCB,0X5A,0XCB,0X5A,0XCB,0X5A,0XCB,0X5A,0XCB,0X52,0XCB,0X5A,
-0XAB,0X52,0XAA,0X52,0XAB,0X52,0XCB,0X52,0XCB,0X52,0XCB,0X52,0XCB,0X52,0XEB,0X52,
-0XCB,0X52,0XCB,0X5A,0XEB,0X52,0XEB,0X5A,0XEB,0X5A,0XEC,0X5A,0XEC,0X5A,0XEB,0X5A,
-0X0C,0X5B,0X0C,0X5B,0X0C,0X5B,0X0C,0X5B,0X0C,0X5B,0X2C,0X63,0X0C,0X5B,0X2C,0X63,
-0X2C,0X63,0X4D,0X63,0X4D,0X63,0X4D,0X63,0X6D,0X6B,0X4D,0X63,0X6D,0X6B,0X6D,0X6B,
-0X6E,0X6B,0X8E,0X6B,0X8E,0X6B,0X8E,0X6B,0XAE,0X73,0XAE,0X73,0XAE,0X73,0XAF,0X73,
-0XAE,0X73,0XCF,0X73,0XCF,0X73,0XEF,0X7B,0XCF,0X73,0XEF,0X7B,0XF0,0X7B,0X10,0X7C,
-0X8E,0X6B,0X51,0X84,0XCB,0X5A,0X61,0X10,0XA2,0X18,0XC3,0X18,0XC2,0X18,0XA2,0X18,
-0XA2,0X18,0XC3,0X18,0XA2,0X18,0XA2,0X18,0XA2,0X18,0X82,0X10,0XC3,0X18,0X82,0X10,
-0XC2,0X18,0XE3,0X20,0XE3,0X20,0X24,0X29,0X24,0X29,0X65,0X39,0XE3,0X20,0X24,0X29,
-0X65,0X39,0X6C,0X93,0XB4,0XDD,0X57,0XEE,0X78,0XEE,0X78,0XEE,0X99,0XF6,0XD9,0XF6,
-0XFA,0XF6,0X1A,0XF7,0X1B,0XF7,0X3B,0XFF,0X3B,0XFF,0X3B,0XFF,0X5C,0XFF,0X5C,0XFF,
-0X5C,0XFF,0X3C,0XFF,0X3B,0XFF,0X3B,0XFF,0X3B,0XFF,0X3B,0XFF,0X3B,0XFF,0X1A,0XF7,
-0XFA,0XF6,0XD9,0XF6,0XB9,0XF6,0X78,0XEE,0X57,0XEE,0X37,0XE6,0X17,0XE6,0X16,0XE6,
-0XF5,0XDD,0XB5,0XD5,0XF6,0XDD,0X94,0XD5,0XB0,0XBC,0XD1,0XBC,0XCD,0X9B,0X0A,0X73,
-0X2B,0X7B,0XEA,0X72,0X68,0X5A,0X07,0X4A,0X86,0X39,0X24,0X29,0XE3,0X20,0X82,0X10,
-0X82,0X10,0X82,0X10,0X61,0X08,0X41,0X08,0X41,0X08,0X41,0X08,0X61,0X08,0X81,0X10,
-0X81,0X10,0X41,0X08,0X61,0X10,0X81,0X10,0XA2,0X18,0X65,0X29,0X08,0X42,0X8E,0X73,
-0X72,0X8C,0X10,0X7C,0X92,0X8C,0XCF,0X7B,0XD3,0X94,0X71,0X8C,0XB3,0X94,0X92,0X8C,
-0XB2,0X94,0XB2,0X94,0X92,0X8C,0X92,0X8C,0X92,0X8C,0X31,0X84,0X72,0X8C,0X71,0X8C,
-0X71,0X84,0X51,0X84,0X51,0X84,0X51,0X84,0X31,0X84,0X31,0X84,0X30,0X84,0X10,0X7C,
-0X10,0X7C,0X10,0X7C,0X10,0X7C,0XF0,0X7B,0XF0,0X7B,0XF0,0X7B,0XEF,0X73,0XCF,0X73,
-0XCF,0X73,0XCF,0X73,0XAF,0X73,0XAE,0X73,0X8E,0X6B,0X8E,0X6B,0X8E,0X6B,0X6E,0X6B,
-0X6E,0X6B,0X6D,0X6B,0X4D,0X6B,0X4D,0X6B,0X4D,0X63,0X4D,0X63,0X2D,0X63,0X2C,0X63,
-0X2C,0X63,0X0C,0X63,0X0C,0X63,0X0C,0X63,0X0C,0X63,0X0C,0X5B,0XEC,0X5A,0XEB,0X5A,
-0XEC,0X5A,0XEB,0X5A,0XEB,0X5A,0XCB,0X5A,0XCB,0X5A,0XCB,0X5A,0XCB,0X5A,0XCB,0X5A,
-0XAB,0X52,0XAB,0X52,0XCB,0X52,0XCB,0X52,0XCB,0X52,0XCB,0X52,0XCB,0X52,0XCB,0X52,
-0XCB,0X52,0XEB,0X52,0XEB,0X5A,0XEB,0X5A,0XEB,0X5A,0XEC,0X5A,0XEB,0X5A,0X0C,0X5B,
-0X0C,0X5B,0X0C,0X5B,0X0C,0X5B,0X0C,0X5B,0X0C,0X5B,0X2C,0X63,0X2C,0X63,0X2C,0X63,
-0X4D,0X63,0X4D,0X63,0X4D,0X63,0X6D,0X6B,0X6D,0X6B,0X6D,0X6B,0X6D,0X6B,0X6E,0X6B,
-0X8E,0X6B,0X8E,0X6B,0X8E,0X6B,0XAE,0X73,0XAE,0X73,0XAE,0X73,0XAF,0X73,0XAF,0X73,
-0XCF,0X73,0XCF,0X73,0XCF,0X73,0XEF,0X7B,0XEF,0X7B,0XCF,0X73,0XEF,0X7B,0XF0,0X7B,
-0X8E,0X6B,0X51,0X84,0X04,0X21,0X82,0X10,0XC2,0X18,0XC3,0X18,0XC2,0X18,0XA2,0X18,
-0XC3,0X18,0XC2,0X18,0XA2,0X18,0XA2,0X18,0XA2,0X18,0XC3,0X18,0X82,0X10,0XA2,0X18,
-0XC2,0X18,0X24,0X29,0X24,0X29,0XE3,0X28,0X65,0X31,0XE3,0X28,0X24,0X29,0X45,0X31,
-0XA9,0X72,0X12,0XCD,0X16,0XE6,0X57,0XEE,0X98,0XEE,0XB9,0XF6,0XB9,0XF6,0XDA,0XF6,
-0X1B,0XF7,0X1B,0XF7,0X3B,0XFF,0X1B,0XF7,0X3C,0XFF,0X5C,0XFF,0X3C,0XFF,0X5C,0XFF,
-0X5C,0XFF,0X5C,0XFF,0X3C,0XFF,0X5C,0XFF,0X5C,0XFF,0X3B,0XFF,0X3B,0XFF,0X1B,0XF7,
-0X1A,0XF7,0XD9,0XF6,0XB9,0XEE,0X78,0XEE,0X57,0XEE,0X57,0XE6,0X37,0XE6,0X37,0XE6,
-0X16,0XE6,0XF6,0XDD,0XF5,0XDD,0XB5,0XDD,0X32,0XCD,0X4F,0XAC,0X0E,0XA4,0X6C,0X83,
-0XCA,0X6A,0X0B,0X73,0XAA,0X62,0X28,0X52,0X86,0X39,0X44,0X29,0XE3,0X20,0XC3,0X18,
-0X82,0X10,0X82,0X10,0X62,0X10,0X62,0X10,0X61,0X08,0X82,0X10,0X41,0X08,0X41,0X10,
-0X41,0X08,0X61,0X10,0X41,0X08,0X41,0X08,0X61,0X10,0XE3,0X20,0X03,0X21,0XAA,0X5A,
-0X92,0X94,0X8E,0X73,0XF4,0X9C,0X10,0X7C,0X71,0X8C,0XF3,0X9C,0X71,0X8C,0XB2,0X94,
-0XB3,0X94,0XB3,0X94,0XB3,0X94,0X92,0X8C,0X92,0X8C,0X92,0X8C,0X51,0X84,0X72,0X8C,
-0X72,0X8C,0X71,0X8C,0X51,0X84,0X51,0X84,0X51,0X84,0X31,0X84,0X31,0X84,0X11,0X84,
-0X30,0X84,0X10,0X7C,0X10,0X7C,0X10,0X7C,0XF0,0X7B,0XEF,0X7B,0XEF,0X7B,0XEF,0X7B,
-0XCF,0X73,0XCF,0X73,0XCF,0X73,0XAE,0X73,0XAE,0X73,0X8E,0X73,0X8E,0X73,0X8E,0X6B,
-0X6E,0X6B,0X6D,0X6B,0X6D,0X6B,0X4D,0X6B,0X4D,0X6B,0X4D,0X6B,0X2D,0X63,0X2D,0X63,
-0X2C,0X63,0X2C,0X63,0X0C,0X63,0X0C,0X63,0X0C,0X5B,0X0C,0X63,0XEC,0X5A,0XEC,0X5A,
-0XEC,0X5A,0XEB,0X5A,0XEB,0X5A,0XEB,0X5A,0XCB,0X5A,0XCB,0X5A,0XCB,0X5A,0XEB,0X5A,
-0XAB,0X52,0XAB,0X52,0XAB,0X52,0XCB,0X52,0XCB,0X52,0XCB,0X52,0XCB,0X52,0XCB,0X52,
-0XCB,0X52,0XEB,0X5A,0XEB,0X5A,0XEB,0X5A,0XEC,0X5A,0XEC,0X5A,0XEC,0X5A,0X0C,0X5B,
-0X0C,0X5B,0X0C,0X5B,0X0C,0X5B,0X0C,0X5B,0X2C,0X63,0X2C,0X63,0X2D,0X63,0X2D,0X63,
-0X4D,0X63,0X4D,0X63,0X4D,0X63,0X6D,0X6B,0X6D,0X6B,0X6D,0X6B,0X6E,0X6B,0X8E,0X6B,
-0X8E,0X6B,0X8E,0X6B,0X8E,0X6B,0XAE,0X73,0XAF,0X73,0XAF,0X73,0XAF,0X73,0XCF,0X73,
-0XCF,0X73,0XCF,0X73,0XCF,0X73,0XF0,0X7B,0XEF,0X7B,0X10,0X7C,0X10,0X7C,0XAF,0X73,
-0X10,0X7C,0X4D,0X6B,0X82,0X18,0XA2,0X18,0XA2,0X18,0XE3,0X20,0XA2,0X18,0XA2,0X18,
-0XA2,0X18,0XA2,0X18,0XA2,0X18,0XC3,0X20,0XA2,0X18,0XC3,0X20,0XA2,0X18,0XC2,0X18,
-0X24,0X29,0XE3,0X20,0X04,0X29,0X45,0X31,0X45,0X31,0XE3,0X28,0X44,0X31,0XC6,0X51,
-0X4E,0XAC,0XF5,0XE5,0X37,0XEE,0X78,0XEE,0X98,0XEE,0XB9,0XF6,0XD9,0XF6,0XDA,0XF6,
-0X1B,0XF7,0X3B,0XFF,0X3B,0XFF,0X3B,0XFF,0X3C,0XFF,0X5C,0XFF,0X3C,0XFF,0X5C,0XFF,
-0X5C,0XFF,0X5C,0XFF,0X5C,0XFF,0X5C,0XFF,0X5C,0XFF,0X5C,0XFF,0X3B,0XFF,0X1B,0XF7,
-0X1A,0XF7,0XD9,0XF6,0XB9,0XF6,0X98,0XEE,0X78,0XEE,0X58,0XEE,0X57,0XE6,0X37,0XE6,
-0X17,0XE6,0X16,0XE6,0XF5,0XDD,0XF5,0XDD,0X94,0XD5,0XD1,0XBC,0XD1,0XBC,0XAD,0X93,
-0X4C,0X7B,0X89,0X62,0X8A,0X5A,0X49,0X52,0XE7,0X41,0X86,0X39,0X45,0X29,0XE4,0X20,
-0XC3,0X18,0X82,0X10,0XA2,0X10,0X82,0X10,0X82,0X10,0X61,0X10,0X21,0X08,0X20,0X08,
-0X41,0X08,0X41,0X08,0X61,0X10,0X61,0X10,0X61,0X10,0XA2,0X18,0XA2,0X18,0X85,0X31,
-0XAE,0X73,0X31,0X84,0X92,0X8C,0XD3,0X94,0XCF,0X7B,0XF3,0X9C,0X72,0X8C,0XB3,0X94,
-0XD3,0X94,0XB3,0X94,0XB3,0X94,0X92,0X94,0XB2,0X94,0X92,0X8C,0X72,0X8C,0X72,0X8C,
-0X72,0X8C,0X72,0X8C,0X72,0X8C,0X51,0X84,0X51,0X84,0X51,0X84,0X51,0X84,0X31,0X84,
-0X31,0X84,0X31,0X84,0X30,0X84,0X10,0X7C,0X10,0X7C,0X10,0X7C,0XF0,0X7B,0XEF,0X7B,
-0XEF,0X7B,0XCF,0X73,0XCF,0X73,0XCF,0X73,0XAF,0X73,0XAE,0X73,0X8E,0X73,0X8E,0X6B,
-0X8E,0X6B,0X8E,0X6B,0X6E,0X6B,0X6D,0X6B,0X6D,0X6B,0X4D,0X6B,0X4D,0X6B,0X4D,0X63,
-0X2C,0X63,0X2C,0X63,0X0C,0X63,0X2C,0X63,0X0C,0X63,0X0C,0X63,0X0C,0X63,0XEC,0X5A,
-0XEC,0X5A,0XEC,0X5A,0XEB,0X5A,0XEB,0X5A,0XEB,0X5A,0XEB,0X5A,0XCB,0X5A,0XCB,0X5A,
-0XAB,0X52,0XCB,0X52,0XCB,0X52,0XCB,0X52,0XCB,0X52,0XCB,0X52,0XCB,0X52,0XCB,0X52,
-0XEB,0X5A,0XEB,0X5A,0XEB,0X5A,0XEB,0X5A,0XEC,0X5A,0XEC,0X5A,0X0C,0X5B,0X0C,0X5B,
-0X0C,0X5B,0X0C,0X5B,0X0C,0X5B,0X0C,0X5B,0X2C,0X63,0X2C,0X63,0X2D,0X63,0X4D,0X63,
-0X4D,0X63,0X4D,0X63,0X6D,0X6B,0X6D,0X6B,0X6D,0X6B,0X6E,0X6B,0X6E,0X6B,0X8E,0X73,
-0X8E,0X6B,0X8E,0X6B,0XAE,0X73,0XAE,0X73,0XCF,0X73,0XCF,0X73,0XCF,0X73,0XCF,0X73,
-0XCF,0X73,0XCF,0X73,0XEF,0X7B,0XF0,0X7B,0X10,0X7C,0X10,0X7C,0X30,0X84,0XAF,0X73,
-0X31,0X84,0X86,0X31,0X82,0X10,0XC3,0X18,0XA2,0X18,0XE3,0X20,0XA2,0X10,0XA2,0X18,
-0XC3,0X18,0XA2,0X18,0XC3,0X18,0XA2,0X18,0XC3,0X20,0XC3,0X20,0XA2,0X18,0X03,0X21,
-0XE3,0X20,0X04,0X29,0X03,0X29,0X24,0X31,0X03,0X29,0X45,0X31,0X64,0X31,0X6C,0X93,
-0X53,0XD5,0X36,0XE6,0X57,0XEE,0X78,0XF6,0X99,0XF6,0XD9,0XF6,0XDA,0XF6,0XFA,0XF6,
-0X1B,0XF7,0X3B,0XFF,0X3B,0XFF,0X3B,0XFF,0X5C,0XFF,0X5C,0XFF,0X5C,0XFF,0X5C,0XFF,
-0X5C,0XFF,0X5C,0XFF,0X5C,0XFF,0X5C,0XFF,0X5C,0XFF,0X5C,0XFF,0X3B,0XFF,0X1B,0XF7,
-0X1A,0XF7,0XD9,0XF6,0XB9,0XF6,0X99,0XEE,0X78,0XEE,0X78,0XEE,0X78,0XEE,0X57,0XEE,
-0X37,0XE6,0X36,0XE6,0XF6,0XDD,0XD5,0XDD,0XD5,0XDD,0X53,0XCD,0XF2,0XC4,0XD1,0XBC,
-0X6C,0X83,0X2B,0X73,0X69,0X52,0X69,0X5A,0XE7,0X41,0X65,0X31,0X04,0X21,0XC3,0X18,
-0XA3,0X10,0X62,0X10,0X82,0X10,0XA2,0X18,0X82,0X10,0X61,0X10,0X61,0X10,0X41,0X08,
-0X61,0X10,0X61,0X10,0X41,0X08,0X61,0X10,0X81,0X10,0X81,0X10,0XA2,0X18,0XC3,0X18,
-0X44,0X29,0X51,0X8C,0X31,0X84,0X72,0X8C,0X92,0X94,0X30,0X84,0XB3,0X94,0XB2,0X94,
-0XD3,0X94,0XD3,0X94,0XB3,0X94,0XB3,0X94,0XB3,0X94,0XB2,0X94,0XB2,0X94,0X71,0X8C,
-0X92,0X8C,0X92,0X8C,0X72,0X8C,0X72,0X8C,0X71,0X8C,0X51,0X84,0X51,0X84,0X51,0X84,
-0X51,0X84,0X31,0X84,0X31,0X84,0X30,0X84,0X10,0X7C,0X10,0X7C,0X10,0X7C,0XF0,0X7B,
-0XF0,0X7B,0XF0,0X7B,0XCF,0X73,0XCF,0X73,0XCF,0X73,0XAF,0X73,0XAE,0X73,0XAE,0X73,
-0X8E,0X6B,0X8E,0X6B,0X6E,0X6B,0X6D,0X6B,0X6D,0X6B,0X6D,0X6B,0X4D,0X6B,0X4D,0X6B,
-0X4D,0X63,0X2D,0X63,0X2D,0X63,0X2C,0X63,0X0C,0X63,0X0C,0X63,0X0C,0X63,0X0C,0X63,
-0X0C,0X5B,0XEC,0X5A,0XEC,0X5A,0XEB,0X5A,0XEB,0X5A,0XEB,0X5A,0XEB,0X5A,0XEB,0X5A,
-0XAB,0X52,0XCB,0X52,0XCB,0X52,0XCB,0X52,0XEB,0X52,0XCB,0X52,0XCB,0X52,0XEB,0X5A,
-0XEB,0X5A,0XEB,0X5A,0XEB,0X5A,0XEC,0X5A,0XEB,0X5A,0X0C,0X5B,0X0C,0X5B,0X0C,0X5B,
-0X0C,0X5B,0X0C,0X5B,0X0C,0X5B,0X2C,0X63,0X2D,0X63,0X2D,0X63,0X4D,0X63,0X4D,0X63,
-0X4D,0X63,0X4D,0X63,0X6D,0X6B,0X6E,0X6B,0X8E,0X6B,0X8E,0X6B,0X8E,0X6B,0X8E,0X6B,
-0X8E,0X6B,0XAE,0X73,0XAE,0X73,0XAF,0X73,0XCF,0X73,0XCF,0X73,0XCF,0X73,0XCF,0X73,
-0XEF,0X7B,0XF0,0X7B,0X10,0X7C,0X10,0X7C,0X10,0X7C,0X10,0X7C,0X31,0X84,0XCF,0X7B,
-0XEF,0X7B,0X04,0X21,0X82,0X10,0XA2,0X18,0XE3,0X20,0XC2,0X18,0XC2,0X18,0XC3,0X18,
-0XC3,0X18,0XA2,0X18,0XC3,0X18,0XA2,0X18,0XA2,0X18,0X82,0X10,0XE4,0X20,0XE3,0X20,
-0X03,0X21,0XE3,0X28,0X24,0X29,0X24,0X29,0X24,0X29,0X44,0X31,0X89,0X6A,0XB0,0XBC,
-0XD5,0XDD,0X36,0XE6,0X57,0XEE,0X98,0XEE,0XD9,0XF6,0XDA,0XF6,0XFA,0XF6,0XFA,0XF6,
-0X1B,0XF7,0X3B,0XFF,0X3B,0XFF,0X3B,0XFF,0X5C,0XFF,0X3C,0XFF,0X5C,0XFF,0X5C,0XFF,
-0X5C,0XFF,0X5C,0XFF,0X5C,0XFF,0X5C,0XFF,0X5C,0XFF,0X5C,0XFF,0X3C,0XFF,0X1B,0XF7,
-0X1A,0XF7,0XD9,0XF6,0XB9,0XF6,0XB9,0XF6,0X78,0XEE,0X78,0XEE,0X78,0XEE,0X78,0XEE,
-0X57,0XEE,0X37,0XE6,0X36,0XE6,0XF5,0XDD,0XF5,0XDD,0XB4,0XD5,0X53,0XCD,0XD1,0XBC,
-0XF2,0XBC,0X2B,0X7B,0XCA,0X62,0X49,0X52,0X08,0X4A,0X86,0X31,0X25,0X29,0XA3,0X18,
-0XC3,0X18,0X04,0X21,0XC3,0X18,0XA2,0X10,0X62,0X10,0X61,0X10,0X61,0X08,0X21,0X08,
-0X41,0X08,0X61,0X08,0X41,0X08,0X61,0X10,0X61,0X10,0XA2,0X18,0XC2,0X18,0X24,0X29,
-0X44,0X29,0X44,0X29,0X51,0X8C,0XD3,0X94,0XD3,0X94,0X10,0X7C,0X92,0X94,0X92,0X8C,
-0XF4,0X9C,0XF3,0X9C,0XD3,0X94,0XD3,0X94,0XB3,0X94,0XB3,0X94,0XB3,0X94,0X72,0X8C,
-0X92,0X8C,0X92,0X8C,0X72,0X8C,0X92,0X8C,0X72,0X8C,0X72,0X8C,0X71,0X8C,0X71,0X84,
-0X51,0X84,0X51,0X84,0X31,0X84,0X31,0X84,0X11,0X84,0X10,0X7C,0X10,0X7C,0X10,0X7C,
-0XF0,0X7B,0XF0,0X7B,0XEF,0X7B,0XCF,0X73,0XCF,0X73,0XCF,0X73,0XAF,0X73,0XAE,0X73,
-0XAE,0X73,0X8E,0X73,0X8E,0X73,0X6E,0X6B,0X6D,0X6B,0X6D,0X6B,0X4D,0X6B,0X4D,0X6B,
-0X4D,0X6B,0X2D,0X63,0X2D,0X63,0X2D,0X63,0X2C,0X63,0X0C,0X63,0X0C,0X63,0X0C,0X63,
-0X0C,0X5B,0XEC,0X5A,0XEB,0X5A,0XEB,0X5A,0XEB,0X5A,0XEB,0X5A,0XEB,0X5A,0XEB,0X5A,
-0XAB,0X52,0XCB,0X52,0XCB,0X5A,0XCB,0X5A,0XCB,0X52,0XCB,0X52,0XEB,0X5A,0XEB,0X5A,
-0XEB,0X5A,0XEB,0X5A,0XEB,0X5A,0XEC,0X5A,0XEC,0X5A,0XEC,0X5A,0X0C,0X5B,0X0C,0X5B,
-0X0C,0X5B,0X2C,0X63,0X0C,0X5B,0X2C,0X63,0X2D,0X63,0X4D,0X63,0X4D,0X63,0X4D,0X63,
-0X6D,0X6B,0X6D,0X6B,0X6D,0X6B,0X6E,0X6B,0X8E,0X6B,0X8E,0X6B,0X8E,0X6B,0XAE,0X73,
-0XAE,0X73,0XAE,0X73,0XAF,0X73,0XCF,0X73,0XCF,0X73,0XEF,0X7B,0XEF,0X7B,0XCF,0X73,
-0XF0,0X7B,0XF0,0X7B,0XF0,0X7B,0X10,0X7C,0X10,0X7C,0X30,0X84,0X31,0X84,0XF0,0X7B,
-0X0B,0X63,0XE3,0X20,0XA2,0X18,0XA2,0X18,0X03,0X21,0XC3,0X18,0XC3,0X18,0XC3,0X20,
-0XC3,0X18,0XC3,0X20,0XC3,0X20,0XA2,0X18,0XA2,0X18,0XC3,0X20,0XC3,0X20,0X03,0X21,
-0X24,0X29,0X04,0X29,0X04,0X29,0X24,0X29,0X44,0X31,0XC6,0X49,0XED,0XA3,0X94,0XD5,
-0X16,0XE6,0X37,0XEE,0X78,0XEE,0X99,0XF6,0XD9,0XF6,0XFA,0XF6,0XFA,0XF6,0X1A,0XF7,
-0X1B,0XF7,0X3B,0XFF,0X3B,0XFF,0X5C,0XFF,0X5C,0XFF,0X5C,0XFF,0X5C,0XFF,0X5C,0XFF,
-0X5C,0XFF,0X5C,0XFF,0X7C,0XFF,0X7C,0XFF,0X7C,0XFF,0X3C,0XFF,0X3B,0XFF,0X3B,0XFF,
-0X1A,0XF7,0XFA,0XF6,0XD9,0XF6,0XB9,0XEE,0X98,0XEE,0X98,0XEE,0X78,0XEE,0X78,0XEE,
-0X58,0XEE,0X57,0XE6,0X36,0XE6,0X16,0XE6,0XD5,0XDD,0XD5,0XDD,0XB5,0XDD,0XF2,0XC4,
-0X70,0XAC,0X90,0XAC,0X4C,0X7B,0X48,0X52,0X07,0X42,0XC7,0X39,0X86,0X31,0X66,0X29,
-0XE4,0X20,0X82,0X10,0X62,0X10,0X61,0X10,0X61,0X10,0X61,0X08,0X61,0X08,0X61,0X08,
-0X20,0X00,0X41,0X08,0X40,0X08,0X41,0X08,0X61,0X10,0X81,0X10,0X82,0X10,0XE3,0X20,
-0X04,0X21,0X28,0X4A,0X24,0X29,0X30,0X84,0X35,0X9D,0XD3,0X94,0X10,0X84,0XD3,0X94,
-0X92,0X8C,0XF3,0X9C,0XF3,0X94,0XD3,0X94,0XD3,0X94,0XB3,0X94,0XD3,0X94,0X92,0X8C,
-0XB3,0X94,0X92,0X8C,0X92,0X8C,0X92,0X8C,0X92,0X8C,0X72,0X8C,0X72,0X8C,0X51,0X84,
-0X51,0X84,0X31,0X84,0X31,0X84,0X31,0X84,0X31,0X84,0X31,0X84,0X30,0X84,0X10,0X7C,
-0X10,0X7C,0XF0,0X7B,0XF0,0X7B,0XEF,0X7B,0XEF,0X7B,0XCF,0X73,0XCF,0X73,0XCF,0X73,
-0XAE,0X73,0X8E,0X73,0X8E,0X73,0X6E,0X6B,0X8E,0X6B,0X6E,0X6B,0X6D,0X6B,0X6D,0X6B,
-0X4D,0X6B,0X4D,0X6B,0X4D,0X63,0X2D,0X63,0X2C,0X63,0X2C,0X63,0X0C,0X63,0X0C,0X5B,
-0X0C,0X63,0XEC,0X5A,0XEC,0X5A,0XEB,0X5A,0XEC,0X5A,0XEC,0X5A,0XEB,0X5A,0XEB,0X5A,
-0XAB,0X52,0XCB,0X52,0XCB,0X5A,0XCB,0X5A,0XCB,0X5A,0XCB,0X5A,0XCB,0X5A,0XCB,0X5A,
-0XEB,0X5A,0XEB,0X5A,0XEC,0X5A,0XEC,0X5A,0XEC,0X5A,0X0C,0X5B,0X0C,0X5B,0X0C,0X5B,
-0X0C,0X63,0X0C,0X63,0X2C,0X63,0X2C,0X63,0X2C,0X63,0X4D,0X63,0X4D,0X63,0X4D,0X6B,
-0X4D,0X6B,0X6D,0X6B,0X6D,0X6B,0X6E,0X6B,0X8E,0X6B,0X8E,0X6B,0X8E,0X73,0X8E,0X73,
-0XAF,0X73,0XCF,0X73,0XCF,0X73,0XCF,0X73,0XEF,0X7B,0XEF,0X7B,0XEF,0X7B,0XCF,0X73,
-0XF0,0X7B,0X10,0X7C,0X10,0X7C,0X30,0X84,0X31,0X84,0X31,0X84,0XF0,0X7B,0X10,0X84,
-0X08,0X42,0XA2,0X18,0XC2,0X18,0XA2,0X18,0XC3,0X18,0XA2,0X18,0XC3,0X18,0XC3,0X20,
-0XE3,0X20,0XE3,0X20,0XA2,0X18,0XA2,0X18,0XE3,0X20,0XC3,0X18,0X03,0X21,0X24,0X29,
-0X04,0X29,0X04,0X29,0X24,0X29,0XE3,0X28,0X65,0X39,0X0A,0X7B,0XF1,0XC4,0XF6,0XDD,
-0X37,0XE6,0X78,0XEE,0X98,0XF6,0XB9,0XF6,0XF9,0XF6,0XFA,0XF6,0X1B,0XF7,0X1B,0XF7,
-0X3B,0XFF,0X3B,0XFF,0X3B,0XFF,0X5C,0XFF,0X5C,0XFF,0X5C,0XFF,0X5C,0XFF,0X5C,0XFF,
-0X5C,0XFF,0X5C,0XFF,0X5C,0XFF,0X5C,0XFF,0X5C,0XFF,0X5C,0XFF,0X3B,0XFF,0X1B,0XF7,
-0XFA,0XF6,0XFA,0XF6,0XF9,0XF6,0XF9,0XF6,0X98,0XF6,0X98,0XEE,0X98,0XEE,0X78,0XEE,
-0X78,0XEE,0X58,0XEE,0X37,0XE6,0X16,0XE6,0XF5,0XDD,0XF5,0XDD,0X74,0XD5,0X53,0XCD,
-0XB1,0XB4,0XAD,0X93,0X8C,0X83,0X89,0X62,0XE7,0X49,0X65,0X31,0XE3,0X20,0XA2,0X18,
-0X82,0X10,0X61,0X08,0X61,0X08,0X61,0X08,0X61,0X08,0X61,0X08,0X62,0X10,0X41,0X08,
-0X41,0X08,0X20,0X00,0X81,0X10,0X41,0X08,0X41,0X08,0X61,0X10,0X61,0X10,0XA2,0X18,
-0X04,0X21,0X24,0X29,0X49,0X4A,0X86,0X39,0X51,0X8C,0X35,0X9D,0X51,0X8C,0X72,0X8C,
-0XF3,0X9C,0XD3,0X94,0XD3,0X94,0XF4,0X9C,0XF3,0X9C,0XD3,0X94,0XD3,0X94,0X92,0X8C,
-0XB3,0X94,0XB3,0X94,0X92,0X8C,0X92,0X8C,0X72,0X8C,0X72,0X8C,0X72,0X8C,0X72,0X8C,
-0X72,0X8C,0X71,0X8C,0X51,0X84,0X51,0X84,0X31,0X84,0X30,0X84,0X10,0X7C,0X10,0X7C,
-0X10,0X7C,0X10,0X7C,0X10,0X7C,0XF0,0X7B,0XEF,0X7B,0XEF,0X7B,0XCF,0X73,0XCF,0X73,
-0XAE,0X73,0XAF,0X73,0XAE,0X73,0X8E,0X73,0X8E,0X73,0X6E,0X6B,0X6E,0X6B,0X6D,0X6B,
-0X6D,0X6B,0X4D,0X6B,0X4D,0X6B,0X2D,0X63,0X2C,0X63,0X0C,0X63,0X0C,0X63,0X0C,0X63,
-0X0C,0X63,0X0C,0X5B,0XEC,0X5A,0XEC,0X5A,0XEB,0X5A,0XEC,0X5A,0XEB,0X5A,0XEB,0X5A,
-0XAB,0X52,0XCB,0X5A,0XCB,0X5A,0XCB,0X5A,0XCB,0X5A,0XCB,0X5A,0XEB,0X5A,0XEB,0X5A,
-0XEB,0X5A,0XEB,0X5A,0XEC,0X5A,0XEC,0X5A,0X0C,0X5B,0X0C,0X5B,0X0C,0X5B,0X0C,0X5B,
-0X0C,0X63,0X2C,0X63,0X2C,0X63,0X2D,0X63,0X4D,0X63,0X4D,0X63,0X4D,0X63,0X4D,0X6B,
-0X6E,0X6B,0X6D,0X6B,0X8E,0X6B,0X8E,0X6B,0X8E,0X6B,0XAE,0X73,0XAE,0X73,0XAE,0X73,
-0XAF,0X73,0XCF,0X73,0XCF,0X73,0XEF,0X7B,0XEF,0X7B,0XF0,0X7B,0XF0,0X7B,0XEF,0X7B,
-0X10,0X7C,0X10,0X7C,0X10,0X7C,0X31,0X84,0X31,0X84,0X51,0X84,0XF0,0X7B,0X8E,0X73,
-0XA6,0X39,0XA2,0X18,0XC2,0X18,0XC3,0X18,0XC3,0X20,0XA2,0X18,0XC3,0X18,0XA2,0X18,
-0XC3,0X18,0XE3,0X20,0XC2,0X18,0XC2,0X18,0XA2,0X18,0XA2,0X18,0X24,0X29,0X04,0X29,
-0XE3,0X28,0X04,0X29,0X03,0X29,0X24,0X29,0X48,0X5A,0X2E,0XAC,0X94,0XDD,0X16,0XE6,
-0X57,0XE6,0X98,0XEE,0XB9,0XF6,0XD9,0XF6,0XFA,0XF6,0XFA,0XF6,0X1B,0XF7,0X1B,0XF7,
-0X1B,0XF7,0X3B,0XFF,0X3B,0XFF,0X3B,0XFF,0X5C,0XFF,0X5C,0XFF,0X5C,0XFF,0X5C,0XFF,
-0X5C,0XFF,0X5C,0XFF,0X5C,0XFF,0X5C,0XFF,0X5C,0XFF,0X5C,0XFF,0X3B,0XFF,0X3B,0XFF,
-0X1A,0XF7,0XFA,0XF6,0XFA,0XF6,0XF9,0XF6,0XB9,0XF6,0X98,0XEE,0XB9,0XF6,0X98,0XEE,
-0X58,0XEE,0X58,0XEE,0X57,0XE6,0X16,0XE6,0XF5,0XDD,0XD5,0XDD,0X94,0XD5,0X73,0XD5,
-0X32,0XC5,0X2F,0XA4,0X4C,0X7B,0XAA,0X62,0XE7,0X49,0X85,0X39,0X04,0X29,0XC3,0X18,
-0XC3,0X18,0XA3,0X18,0XA3,0X18,0XA2,0X10,0XA2,0X10,0X61,0X08,0X61,0X10,0X61,0X08,
-0X41,0X08,0X61,0X08,0X61,0X08,0X61,0X08,0X61,0X10,0X61,0X10,0X61,0X10,0X82,0X10,
-0XC3,0X18,0X04,0X29,0XE3,0X20,0X8A,0X52,0X07,0X42,0XCF,0X7B,0XD3,0X9C,0X10,0X7C,
-0X14,0XA5,0X14,0X9D,0X14,0X9D,0XB3,0X94,0XF4,0X9C,0XF3,0X9C,0XD3,0X94,0X92,0X8C,
-0XB3,0X94,0XB2,0X94,0XB3,0X94,0XB2,0X94,0XB2,0X94,0X92,0X8C,0X92,0X8C,0X72,0X8C,
-0X92,0X8C,0X72,0X8C,0X71,0X8C,0X51,0X84,0X51,0X84,0X51,0X84,0X31,0X84,0X31,0X84,
-0X10,0X7C,0X10,0X7C,0X10,0X7C,0X10,0X7C,0XF0,0X7B,0XEF,0X7B,0XEF,0X7B,0XCF,0X73,
-0XCF,0X73,0XCF,0X73,0XAF,0X73,0X8E,0X73,0XAE,0X73,0X8E,0X73,0X6E,0X6B,0X6E,0X6B,
-0X6D,0X6B,0X6D,0X6B,0X4D,0X6B,0X4D,0X6B,0X2D,0X63,0X2C,0X63,0X2C,0X63,0X0C,0X63,
-0X0C,0X63,0X0C,0X63,0X0C,0X5B,0XEC,0X5A,0XEC,0X5A,0XEC,0X5A,0XEB,0X5A,0XEC,0X5A,
-0XCB,0X52,0XCB,0X5A,0XCB,0X5A,0XCB,0X5A,0XCB,0X5A,0XEB,0X5A,0XEB,0X5A,0XEB,0X5A,
-0XEB,0X5A,0X0C,0X5B,0X0C,0X5B,0X0C,0X5B,0X0C,0X5B,0X0C,0X5B,0X0C,0X5B,0X0C,0X5B,
-0X2C,0X63,0X2C,0X63,0X2C,0X63,0X4D,0X63,0X4D,0X63,0X4D,0X63,0X4D,0X63,0X6E,0X6B,
-0X6E,0X6B,0X8E,0X6B,0X8E,0X6B,0X8E,0X6B,0XAE,0X73,0XAE,0X73,0XAE,0X73,0XCF,0X73,
-0XCF,0X73,0XCF,0X73,0XCF,0X73,0XEF,0X7B,0XF0,0X7B,0X10,0X7C,0X10,0X7C,0X10,0X7C,
-0X10,0X7C,0X10,0X84,0X11,0X84,0X31,0X84,0X51,0X84,0X71,0X84,0XF0,0X7B,0XCB,0X5A,
-0X04,0X21,0XA2,0X18,0XC3,0X18,0XC2,0X18,0XE3,0X20,0XA2,0X18,0XC3,0X18,0XA2,0X18,
-0XE3,0X20,0XA2,0X18,0XC3,0X18,0XE3,0X20,0X82,0X10,0XA2,0X18,0X04,0X29,0X24,0X29,
-0X04,0X29,0X04,0X29,0X04,0X29,0XC6,0X41,0X6B,0X93,0X12,0XC5,0XF6,0XDD,0X57,0XE6,
-0X78,0XEE,0X99,0XF6,0XB9,0XF6,0XFA,0XF6,0XFA,0XF6,0X1A,0XF7,0X1B,0XF7,0X1B,0XF7,
-0X1B,0XF7,0X3B,0XFF,0X3C,0XFF,0X3C,0XFF,0X5C,0XFF,0X5C,0XFF,0X5C,0XFF,0X5C,0XFF,
-0X5C,0XFF,0X5C,0XFF,0X5C,0XFF,0X5C,0XFF,0X5C,0XFF,0X5C,0XFF,0X5C,0XFF,0X3B,0XFF,
-0X1B,0XF7,0X1A,0XF7,0X1A,0XF7,0XFA,0XF6,0XF9,0XF6,0XD9,0XEE,0XB9,0XEE,0X78,0XEE,
-0X78,0XEE,0X78,0XEE,0X58,0XEE,0X16,0XE6,0XF5,0XDD,0XD5,0XDD,0X94,0XD5,0X73,0XCD,
-0X53,0XCD,0XB0,0XB4,0XEE,0X93,0XEA,0X6A,0X89,0X5A,0X85,0X39,0X65,0X31,0X04,0X21,
-0XC3,0X18,0X82,0X10,0X62,0X10,0X41,0X08,0X61,0X08,0X62,0X10,0X41,0X08,0X41,0X10,
-0X41,0X08,0X61,0X08,0X61,0X08,0X61,0X10,0X61,0X10,0X61,0X10,0XA2,0X18,0X81,0X10,
-0XA2,0X18,0XC3,0X20,0XC7,0X39,0XC3,0X18,0X49,0X52,0XC6,0X39,0XCF,0X7B,0X71,0X8C,
-0XB3,0X94,0XF4,0X9C,0X14,0X9D,0X14,0X9D,0XF3,0X9C,0XD3,0X94,0X92,0X8C,0XF4,0X9C,
-0XF3,0X9C,0XF3,0X9C,0XD3,0X94,0XD3,0X94,0XB3,0X94,0XB2,0X94,0XB2,0X94,0X92,0X8C,
-0X92,0X8C,0X92,0X8C,0X72,0X8C,0X71,0X8C,0X51,0X84,0X51,0X84,0X51,0X84,0X31,0X84,
-0X31,0X84,0X10,0X7C,0X10,0X7C,0X10,0X7C,0X10,0X7C,0X10,0X7C,0XF0,0X7B,0XEF,0X7B,
-0XEF,0X7B,0XCF,0X73,0XAE,0X73,0XAE,0X73,0XAE,0X73,0X8E,0X73,0X8E,0X73,0X6E,0X6B,
-0X6D,0X6B,0X6D,0X6B,0X4D,0X6B,0X4D,0X6B,0X4D,0X6B,0X2D,0X63,0X2C,0X63,0X0C,0X63,
-0X0C,0X63,0X0C,0X63,0X0C,0X63,0X0C,0X5B,0XEC,0X5A,0XEC,0X5A,0XEB,0X5A,0XEC,0X5A,
-0XCB,0X52,0XCB,0X52,0XCB,0X5A,0XCB,0X5A,0XCB,0X5A,0XEB,0X5A,0XEB,0X5A,0XEB,0X5A,
-0XEC,0X5A,0XEC,0X5A,0XEC,0X5A,0X0C,0X5B,0X0C,0X5B,0X0C,0X5B,0X2C,0X63,0X2C,0X63,
-0X2C,0X63,0X2C,0X63,0X2D,0X63,0X4D,0X63,0X4D,0X63,0X4D,0X63,0X6D,0X6B,0X6D,0X6B,
-0X8E,0X6B,0X8E,0X73,0X8E,0X73,0XAE,0X6B,0XAE,0X73,0XAE,0X73,0XAF,0X73,0XCF,0X73,
-0XCF,0X73,0XEF,0X7B,0XF0,0X7B,0XF0,0X7B,0X10,0X7C,0X10,0X7C,0X10,0X7C,0X10,0X7C,
-0X10,0X7C,0X31,0X84,0X31,0X84,0X51,0X84,0X51,0X84,0X51,0X84,0XCF,0X7B,0X08,0X42,
-0XA2,0X18,0XC3,0X18,0XA2,0X18,0XA2,0X18,0XC3,0X18,0XA2,0X18,0XA2,0X18,0XA2,0X18,
-0XC3,0X20,0XA2,0X18,0XC3,0X18,0X82,0X10,0X81,0X10,0X04,0X29,0X04,0X29,0X04,0X29,
-0X04,0X29,0XE3,0X20,0X45,0X31,0XA9,0X6A,0X0E,0XAC,0X73,0XD5,0X16,0XE6,0X57,0XEE,
-0X98,0XEE,0XB9,0XF6,0XD9,0XF6,0XFA,0XF6,0XFA,0XF6,0XFA,0XF6,0X1B,0XF7,0X1B,0XF7,
-0X1B,0XF7,0X3B,0XFF,0X3B,0XFF,0X3C,0XFF,0X5C,0XFF,0X5C,0XFF,0X7C,0XFF,0X5C,0XFF,
-0X5C,0XFF,0X5C,0XFF,0X5C,0XFF,0X7C,0XFF,0X5C,0XFF,0X5C,0XFF,0X3C,0XFF,0X3B,0XFF,
-0X1B,0XF7,0X1B,0XF7,0XFA,0XF6,0X1A,0XF7,0XFA,0XF6,0XF9,0XEE,0XB9,0XEE,0X98,0XEE,
-0X78,0XEE,0X78,0XEE,0X58,0XEE,0X37,0XE6,0X16,0XE6,0XF6,0XDD,0XB5,0XDD,0X94,0XD5,
-0X73,0XCD,0X53,0XCD,0XD1,0XB4,0X6C,0X8B,0XCA,0X6A,0X07,0X4A,0X44,0X31,0XC3,0X18,
-0X62,0X10,0X61,0X10,0X62,0X10,0X61,0X08,0X41,0X08,0X41,0X08,0X41,0X08,0X41,0X08,
-0X41,0X08,0X41,0X08,0X61,0X10,0X61,0X10,0X81,0X10,0X82,0X10,0X81,0X10,0XA2,0X18,
-0XC3,0X18,0X03,0X21,0XE3,0X20,0XC6,0X39,0XA2,0X18,0X28,0X42,0X28,0X4A,0XEF,0X7B,
-0XCF,0X7B,0X35,0XA5,0X15,0X9D,0X92,0X8C,0X72,0X8C,0X71,0X8C,0X51,0X8C,0X72,0X8C,
-0X71,0X8C,0X51,0X84,0X51,0X84,0X51,0X84,0XB2,0X94,0X92,0X8C,0X92,0X8C,0X92,0X8C,
-0X92,0X8C,0X92,0X8C,0X92,0X8C,0X72,0X8C,0X72,0X8C,0X71,0X8C,0X51,0X84,0X51,0X84,
-0X51,0X84,0X31,0X84,0X10,0X7C,0X10,0X7C,0X10,0X7C,0X10,0X7C,0XF0,0X7B,0XEF,0X7B,
-0XEF,0X7B,0XAF,0X73,0XAF,0X73,0XCF,0X73,0XAE,0X73,0X8E,0X73,0X8E,0X73,0X8E,0X6B,
-0X6E,0X6B,0X6D,0X6B,0X6D,0X6B,0X4D,0X6B,0X4D,0X6B,0X2D,0X63,0X2D,0X63,0X2D,0X63,
-0X0C,0X63,0X2C,0X63,0X0C,0X63,0X0C,0X63,0X0C,0X5B,0X0C,0X63,0XEC,0X5A,0XEC,0X5A,
-0XCB,0X52,0XCB,0X52,0XCB,0X5A,0XCB,0X5A,0XCB,0X5A,0XEB,0X5A,0XEB,0X5A,0XEC,0X5A,
-0XEC,0X5A,0XEC,0X5A,0X0C,0X5B,0X0C,0X5B,0X0C,0X5B,0X0C,0X5B,0X2C,0X63,0X2C,0X63,
-0X2C,0X63,0X2D,0X63,0X4D,0X63,0X4D,0X63,0X4D,0X63,0X6D,0X6B,0X6D,0X6B,0X8E,0X6B,
-0X8E,0X6B,0X8E,0X73,0X8E,0X73,0XAE,0X73,0XAE,0X73,0XCF,0X73,0XCF,0X73,0XCF,0X73,
-0XEF,0X7B,0XF0,0X7B,0XF0,0X7B,0XF0,0X7B,0X10,0X7C,0X11,0X7C,0X31,0X84,0X31,0X84,
-0X10,0X7C,0X31,0X84,0X51,0X84,0X51,0X84,0X31,0X84,0X51,0X84,0X4D,0X6B,0X65,0X31,
-0XA2,0X18,0XC3,0X18,0X82,0X10,0XC3,0X18,0XA2,0X18,0XC2,0X18,0X82,0X18,0XC2,0X18,
-0XC3,0X20,0XC3,0X20,0XA2,0X18,0X82,0X10,0XC2,0X18,0X04,0X29,0XE3,0X28,0X04,0X29,
-0X03,0X21,0X03,0X29,0XC6,0X41,0X6B,0X83,0XB1,0XBC,0XF5,0XDD,0X16,0XE6,0X57,0XEE,
-0X98,0XEE,0XB9,0XF6,0XD9,0XF6,0XFA,0XF6,0XFA,0XF6,0X1B,0XF7,0X1B,0XF7,0X3B,0XFF,
-0X1B,0XF7,0X1B,0XF7,0X3B,0XFF,0X3C,0XFF,0X5C,0XFF,0X5C,0XFF,0X7C,0XFF,0X7C,0XFF,
-0X5C,0XFF,0X5C,0XFF,0X7C,0XFF,0X5C,0XFF,0X7C,0XFF,0X5C,0XFF,0X5C,0XFF,0X3B,0XFF,
-0X3B,0XFF,0X1B,0XF7,0X1A,0XF7,0X1A,0XF7,0XFA,0XF6,0XF9,0XEE,0XD9,0XEE,0X98,0XEE,
-0X98,0XEE,0X78,0XEE,0X58,0XEE,0X57,0XEE,0X16,0XE6,0XF6,0XDD,0XB5,0XDD,0X94,0XD5,
-0X73,0XCD,0X32,0XCD,0XB1,0XB4,0X2E,0X9C,0X89,0X62,0X28,0X52,0XA6,0X39,0XE3,0X20,
-0XA2,0X10,0X62,0X10,0X61,0X08,0X61,0X08,0X61,0X10,0X61,0X08,0X41,0X08,0X20,0X08,
-0X61,0X08,0X41,0X08,0X61,0X08,0X61,0X10,0XA2,0X18,0X82,0X10,0X82,0X10,0X82,0X10,
-0XA2,0X18,0XE3,0X20,0X65,0X31,0XA6,0X39,0X08,0X42,0XC3,0X18,0X08,0X42,0X69,0X52,
-0X0C,0X63,0X2C,0X6B,0X92,0X8C,0XF4,0X9C,0XF4,0X9C,0XD3,0X94,0XF4,0X9C,0XF3,0X9C,
-0XF3,0X9C,0XD3,0X94,0XB3,0X94,0XB3,0X94,0X51,0X84,0X92,0X8C,0X92,0X8C,0X51,0X84,
-0X31,0X84,0X31,0X84,0X72,0X8C,0X72,0X8C,0X72,0X8C,0X72,0X8C,0X72,0X8C,0X51,0X84,
-0X51,0X84,0X51,0X84,0X31,0X84,0X30,0X84,0X30,0X84,0X10,0X7C,0X10,0X7C,0XEF,0X7B,
-0XEF,0X7B,0XCF,0X73,0XCF,0X73,0XCF,0X73,0XAF,0X73,0XAE,0X73,0X8E,0X73,0X8E,0X73,
-0X8E,0X6B,0X6E,0X6B,0X6D,0X6B,0X6D,0X6B,0X4D,0X6B,0X4D,0X6B,0X2D,0X63,0X2D,0X63,
-0X2C,0X63,0X2C,0X63,0X0C,0X63,0X0C,0X63,0X0C,0X63,0X0C,0X63,0XEC,0X5A,0XEC,0X5A,
-0XCB,0X5A,0XCB,0X5A,0XCB,0X5A,0XEB,0X5A,0XEB,0X5A,0XEB,0X5A,0XEC,0X5A,0XEB,0X5A,
-0XEC,0X5A,0XEC,0X5A,0X0C,0X5B,0X0C,0X5B,0X0C,0X5B,0X2C,0X5B,0X2C,0X63,0X2C,0X63,
-0X2D,0X63,0X4D,0X63,0X4D,0X63,0X4D,0X63,0X6D,0X6B,0X6D,0X6B,0X6E,0X6B,0X8E,0X6B,
-0X8E,0X6B,0X8E,0X6B,0XAE,0X73,0XAE,0X73,0XCF,0X73,0XCF,0X73,0XCF,0X73,0XEF,0X7B,
-0XEF,0X7B,0XF0,0X7B,0X10,0X7C,0X10,0X7C,0X10,0X7C,0X30,0X84,0X31,0X84,0X31,0X84,
-0X10,0X7C,0X51,0X84,0X30,0X84,0X31,0X84,0X72,0X8C,0X92,0X8C,0X28,0X4A,0XC3,0X18,
-0XC3,0X18,0XA2,0X18,0XA2,0X18,0XC3,0X18,0XA2,0X18,0XA2,0X18,0XA2,0X18,0XC2,0X18,
-0XC2,0X18,0XC2,0X18,0XA2,0X18,0XA2,0X18,0XE3,0X20,0XE3,0X20,0X04,0X29,0X04,0X29,
-0XC3,0X20,0X24,0X29,0XA9,0X6A,0X0E,0X9C,0X94,0XD5,0X16,0XE6,0X37,0XE6,0X77,0XEE,
-0X98,0XEE,0XD9,0XEE,0XF9,0XF6,0XFA,0XF6,0X1A,0XF7,0X1B,0XF7,0X1B,0XF7,0X3B,0XFF,
-0X1B,0XF7,0X3B,0XFF,0X3B,0XFF,0X3C,0XFF,0X3C,0XFF,0X3C,0XFF,0X7C,0XFF,0X7C,0XFF,
-0X5C,0XFF,0X5C,0XFF,0X7C,0XFF,0X7C,0XFF,0X5C,0XFF,0X5C,0XFF,0X5C,0XFF,0X3B,0XFF,
-0X3B,0XFF,0X1B,0XF7,0X1A,0XF7,0X1A,0XF7,0XFA,0XF6,0XF9,0XEE,0XD9,0XEE,0XB9,0XEE,
-0XB8,0XEE,0X78,0XEE,0X58,0XEE,0X57,0XE6,0X16,0XE6,0XF6,0XDD,0XD5,0XDD,0XB4,0XD5,
-0X74,0XD5,0X53,0XCD,0XD1,0XBC,0X6F,0XAC,0X4B,0X83,0X48,0X52,0X85,0X39,0X24,0X29,
-0XE3,0X20,0XA2,0X10,0X82,0X10,0X61,0X10,0X41,0X08,0X41,0X08,0X41,0X08,0X41,0X08,
-0X41,0X08,0X61,0X08,0X61,0X10,0X82,0X10,0X82,0X10,0X82,0X10,0XA2,0X18,0XA2,0X18,
-0XA2,0X18,0XC3,0X18,0X24,0X29,0XE7,0X41,0XC7,0X39,0X07,0X42,0X03,0X21,0XA6,0X39,
-0X4C,0X6B,0X8E,0X73,0XB3,0X94,0XD3,0X9C,0XD3,0X94,0X14,0X9D,0XD3,0X94,0XF3,0X9C,
-0XD3,0X94,0X14,0X9D,0XF4,0X9C,0XF4,0X9C,0XD3,0X94,0XD3,0X94,0XD3,0X94,0XD3,0X94,
-0XB3,0X94,0X92,0X8C,0X51,0X84,0X31,0X84,0X10,0X7C,0X31,0X84,0X72,0X8C,0X72,0X8C,
-0X71,0X8C,0X51,0X84,0X51,0X84,0X31,0X84,0X31,0X84,0X10,0X7C,0X10,0X7C,0XF0,0X7B,
-0XCF,0X73,0XF0,0X7B,0XCF,0X73,0XCF,0X73,0XAF,0X73,0XAF,0X73,0X8E,0X73,0X8E,0X73,
-0X8E,0X73,0X6E,0X6B,0X6E,0X6B,0X6E,0X6B,0X6D,0X6B,0X4D,0X6B,0X4D,0X6B,0X4D,0X63,
-0X2D,0X63,0X2C,0X63,0X2C,0X63,0X0C,0X63,0X0C,0X63,0X0C,0X5B,0XEC,0X5A,0XEC,0X5A,
-0XCB,0X5A,0XCB,0X5A,0XCB,0X5A,0XCB,0X5A,0XEB,0X5A,0XEB,0X5A,0XEB,0X5A,0XEC,0X5A,
-0X0C,0X5B,0X0C,0X5B,0X0C,0X5B,0X0C,0X5B,0X0C,0X5B,0X2C,0X63,0X2D,0X63,0X2D,0X63,
-0X4D,0X63,0X4D,0X63,0X4D,0X63,0X4D,0X63,0X6D,0X6B,0X6D,0X6B,0X6E,0X6B,0X8E,0X6B,
-0X8E,0X6B,0XAE,0X73,0XAE,0X73,0XAF,0X73,0XCF,0X73,0XCF,0X73,0XCF,0X73,0XEF,0X7B,
-0XF0,0X7B,0X10,0X7C,0X10,0X7C,0X10,0X7C,0X31,0X84,0X31,0X84,0X31,0X84,0X51,0X84,
-0X31,0X84,0X31,0X84,0X71,0X8C,0X51,0X84,0X72,0X8C,0X30,0X84,0X86,0X39,0XA2,0X18,
-0XC3,0X18,0XC2,0X18,0XC2,0X18,0XE3,0X20,0XA2,0X18,0XC2,0X18,0XC2,0X18,0XE3,0X20,
-0XE3,0X20,0XC2,0X18,0X82,0X18,0XC3,0X18,0X03,0X21,0XC3,0X20,0XE3,0X28,0X24,0X29,
-0XC3,0X20,0XC6,0X41,0X4B,0X83,0X90,0XB4,0XB5,0XDD,0X16,0XE6,0X37,0XE6,0X98,0XEE,
-0XB8,0XEE,0XD9,0XF6,0XFA,0XF6,0XFA,0XF6,0XFA,0XF6,0X1B,0XF7,0X3B,0XFF,0X3B,0XFF,
-0X3B,0XFF,0X3B,0XFF,0X3B,0XFF,0X3C,0XFF,0X5C,0XFF,0X3C,0XFF,0X7C,0XFF,0X7C,0XFF,
-0X5C,0XFF,0X5C,0XFF,0X7C,0XFF,0X7C,0XFF,0X5C,0XFF,0X5C,0XFF,0X5C,0XFF,0X3B,0XFF,
-0X3B,0XFF,0X3B,0XFF,0X1A,0XF7,0X1A,0XF7,0XFA,0XF6,0XFA,0XF6,0XD9,0XEE,0XB9,0XEE,
-0XB8,0XEE,0X78,0XEE,0X58,0XEE,0X57,0XE6,0X16,0XE6,0XF6,0XDD,0XD5,0XDD,0XB4,0XD5,
-0X94,0XD5,0X53,0XCD,0X53,0XCD,0XB0,0XBC,0X4F,0XA4,0X89,0X62,0XA6,0X39,0X04,0X21,
-0XA2,0X18,0X61,0X08,0X61,0X08,0X41,0X08,0X61,0X08,0X41,0X08,0X41,0X08,0X21,0X08,
-0X41,0X08,0X41,0X08,0X41,0X08,0X62,0X10,0X82,0X10,0X82,0X10,0XA2,0X18,0XA2,0X18,
-0X82,0X10,0XC2,0X18,0X03,0X21,0X65,0X31,0X69,0X52,0XC7,0X39,0X08,0X42,0X24,0X29,
-0XA6,0X39,0X6D,0X6B,0X0B,0X63,0X14,0XA5,0X55,0XAD,0X14,0X9D,0X14,0X9D,0XF4,0X9C,
-0X14,0X9D,0XF3,0X9C,0XF4,0X9C,0XF4,0X9C,0XF4,0X9C,0XB3,0X94,0XD3,0X94,0XD3,0X94,
-0XD3,0X94,0XB3,0X94,0XB3,0X94,0XB3,0X94,0X92,0X8C,0X71,0X8C,0X51,0X84,0X31,0X84,
-0X31,0X84,0X71,0X8C,0X51,0X84,0X31,0X84,0X10,0X7C,0X31,0X84,0X10,0X7C,0XF0,0X7B,
-0X10,0X7C,0XF0,0X7B,0XCF,0X73,0XCF,0X73,0XCF,0X73,0XCF,0X73,0XAF,0X73,0XAE,0X73,
-0X8E,0X73,0X8E,0X73,0X8E,0X6B,0X6E,0X6B,0X6D,0X6B,0X4D,0X6B,0X4D,0X6B,0X4D,0X6B,
-0X2D,0X63,0X2D,0X63,0X2C,0X63,0X2C,0X63,0X0C,0X5B,0X0C,0X63,0X0C,0X5B,0X0C,0X63,
-0XCB,0X5A,0XCB,0X5A,0XCB,0X5A,0XEB,0X5A,0XEB,0X5A,0XEC,0X5A,0XEB,0X5A,0X0C,0X5B,
-0X0C,0X5B,0X0C,0X5B,0X0C,0X5B,0X0C,0X5B,0X2C,0X63,0X2C,0X63,0X2C,0X63,0X2D,0X63,
-0X4D,0X63,0X4D,0X63,0X4D,0X63,0X4D,0X63,0X6D,0X63,0X8E,0X6B,0X8E,0X73,0X8E,0X6B,
-0X8E,0X6B,0XAE,0X73,0XAF,0X73,0XCF,0X73,0XCF,0X73,0XCF,0X73,0XF0,0X7B,0XF0,0X7B,
-0X10,0X7C,0X10,0X7C,0X10,0X7C,0X30,0X84,0X31,0X84,0X31,0X84,0X51,0X84,0X51,0X84,
-0X31,0X84,0X51,0X84,0X72,0X8C,0X72,0X8C,0X92,0X8C,0XAE,0X73,0X04,0X29,0XA2,0X18,
-0X82,0X10,0XA2,0X18,0XA2,0X18,0XC2,0X18,0XC2,0X18,0XC2,0X18,0XE3,0X20,0XC2,0X18,
-0XC2,0X18,0XA2,0X18,0XA2,0X18,0XC3,0X20,0XC3,0X20,0XE3,0X20,0X04,0X29,0X04,0X29,
-0X04,0X29,0XA9,0X62,0XEE,0X9B,0X13,0XC5,0XB5,0XD5,0XF6,0XDD,0X37,0XE6,0X78,0XEE,
-0XB8,0XEE,0XD9,0XF6,0XF9,0XF6,0XFA,0XF6,0X1A,0XF7,0X1B,0XF7,0X3B,0XFF,0X3B,0XFF,
-0X3B,0XFF,0X3B,0XFF,0X1B,0XF7,0X3B,0XFF,0X3C,0XFF,0X5C,0XFF,0X5C,0XFF,0X5C,0XFF,
-0X7C,0XFF,0X7C,0XFF,0X7C,0XFF,0X7C,0XFF,0X5C,0XFF,0X7C,0XFF,0X5C,0XFF,0X5C,0XFF,
-0X3B,0XFF,0X1B,0XF7,0XFA,0XF6,0XFA,0XF6,0XFA,0XF6,0XDA,0XEE,0XD9,0XEE,0XB9,0XEE,
-0XB8,0XEE,0X98,0XEE,0X57,0XEE,0X37,0XE6,0X16,0XDE,0XF6,0XDD,0XD5,0XDD,0XD5,0XDD,
-0X94,0XD5,0X94,0XD5,0X53,0XCD,0XF1,0XBC,0X4F,0XAC,0XAD,0X8B,0X48,0X52,0X24,0X29,
-0XA2,0X18,0X82,0X10,0X61,0X08,0X41,0X08,0X00,0X00,0X20,0X00,0X20,0X00,0X41,0X08,
-0X41,0X08,0X41,0X08,0X41,0X08,0X61,0X08,0X61,0X10,0X82,0X10,0X82,0X10,0XC2,0X18,
-0X82,0X10,0XE3,0X20,0XC3,0X20,0XE3,0X20,0X45,0X31,0X89,0X52,0X65,0X31,0X28,0X4A,
-0XE7,0X41,0XE7,0X41,0XEF,0X7B,0X4D,0X6B,0XB2,0X94,0X35,0XA5,0X14,0X9D,0X34,0XA5,
-0XF4,0X9C,0XF4,0X9C,0X14,0X9D,0XF3,0X9C,0XF4,0X9C,0XD3,0X94,0XF4,0X9C,0XD3,0X94,
-0XD3,0X94,0XD3,0X94,0XB3,0X94,0XB3,0X94,0X92,0X8C,0X92,0X8C,0X31,0X84,0X92,0X8C,
-0X51,0X84,0X10,0X7C,0X31,0X84,0X51,0X84,0X31,0X84,0XF0,0X7B,0X10,0X7C,0XF0,0X7B,
-0XF0,0X7B,0XEF,0X7B,0XF0,0X7B,0XF0,0X7B,0XCF,0X7B,0XCF,0X73,0XCF,0X73,0XAE,0X73,
-0X8E,0X73,0X8E,0X73,0X8E,0X6B,0X6E,0X6B,0X6D,0X6B,0X6D,0X6B,0X4D,0X6B,0X4D,0X6B,
-0X4D,0X63,0X4D,0X63,0X2C,0X63,0X0C,0X63,0X0C,0X63,0X0C,0X63,0X0C,0X63,0X0C,0X63,
-0XCB,0X5A,0XCB,0X5A,0XEB,0X5A,0XEB,0X5A,0XEB,0X5A,0XEB,0X5A,0XEC,0X5A,0X0C,0X5B,
-0X0C,0X5B,0X0C,0X5B,0X0C,0X63,0X0C,0X63,0X2C,0X63,0X2D,0X63,0X4D,0X63,0X4D,0X63,
-0X4D,0X63,0X4D,0X63,0X4D,0X6B,0X6D,0X6B,0X6D,0X6B,0X8E,0X6B,0X8E,0X6B,0X8E,0X6B,
-0X8E,0X6B,0XAE,0X73,0XCF,0X73,0XCF,0X73,0XCF,0X73,0XF0,0X7B,0XEF,0X7B,0XF0,0X7B,
-0X10,0X7C,0X10,0X7C,0X30,0X84,0X31,0X84,0X51,0X84,0X51,0X84,0X51,0X84,0X71,0X8C,
-0X51,0X84,0X51,0X84,0X72,0X8C,0X92,0X8C,0XB2,0X8C,0X8A,0X5A,0XE3,0X20,0XC3,0X18,
-0XA2,0X18,0XA2,0X18,0XA2,0X18,0XC3,0X18,0XE3,0X20,0XA2,0X18,0XC3,0X20,0XE3,0X20,
-0XA2,0X18,0XA2,0X18,0XC2,0X18,0XE3,0X20,0XC3,0X20,0XC3,0X20,0X24,0X29,0XE3,0X20,
-0X65,0X39,0X0A,0X7B,0X0E,0X9C,0X13,0XC5,0XB5,0XD5,0XF6,0XDD,0X37,0XDE,0X78,0XEE,
-0X99,0XEE,0XD9,0XF6,0XD9,0XF6,0XFA,0XF6,0XFA,0XF6,0X1A,0XF7,0X1B,0XF7,0X3C,0XFF,
-0X3B,0XFF,0X3B,0XFF,0X3B,0XFF,0X3B,0XFF,0X3C,0XFF,0X5C,0XFF,0X5C,0XFF,0X7C,0XFF,
-0X7C,0XFF,0X7C,0XFF,0X5C,0XFF,0X5C,0XFF,0X5C,0XFF,0X5C,0XFF,0X5C,0XFF,0X3C,0XFF,
-0X3B,0XF7,0X1B,0XF7,0XFA,0XF6,0XFA,0XF6,0XDA,0XEE,0XB9,0XEE,0XB9,0XEE,0X98,0XEE,
-0XB9,0XEE,0X98,0XEE,0X57,0XE6,0X17,0XE6,0XF6,0XDD,0XF6,0XDD,0XD5,0XDD,0XD5,0XDD,
-0XB4,0XD5,0X94,0XD5,0X53,0XCD,0X11,0XC5,0XD0,0XBC,0X4E,0XA4,0XC9,0X6A,0XC6,0X41,
-0XC2,0X18,0X61,0X08,0X41,0X08,0X41,0X08,0X61,0X08,0X61,0X10,0X41,0X08,0X41,0X08,
-0X20,0X00,0X41,0X08,0X41,0X08,0X61,0X08,0X62,0X10,0X82,0X10,0XC3,0X18,0XE3,0X20,
-0XC3,0X18,0XA2,0X18,0XA2,0X18,0X24,0X29,0X04,0X29,0XA6,0X39,0X08,0X42,0XAA,0X52,
-0XA6,0X31,0X08,0X42,0XAA,0X5A,0X6E,0X73,0XCF,0X7B,0XD3,0X9C,0X35,0X9D,0XF4,0X9C,
-0X14,0X9D,0X14,0X9D,0XD3,0X94,0XF3,0X9C,0XD3,0X94,0XB3,0X94,0XD3,0X94,0XD3,0X94,
-0XD3,0X94,0XF3,0X94,0XF3,0X94,0XD3,0X94,0X92,0X8C,0X92,0X8C,0XB2,0X94,0XF0,0X7B,
-0X10,0X7C,0X10,0X7C,0XAF,0X73,0XCF,0X7B,0X10,0X7C,0X51,0X84,0X31,0X84,0X31,0X84,
-0X30,0X84,0X10,0X7C,0X10,0X7C,0XF0,0X7B,0XF0,0X7B,0XCF,0X73,0XCF,0X73,0XCF,0X73,
-0XAE,0X73,0XAE,0X73,0X8E,0X73,0X8E,0X73,0X6E,0X6B,0X6D,0X6B,0X6D,0X6B,0X4D,0X6B,
-0X4D,0X6B,0X2D,0X63,0X2C,0X63,0X2D,0X63,0X2C,0X63,0X2C,0X63,0X0C,0X63,0X0C,0X63,
-0XCB,0X5A,0XCB,0X5A,0XEB,0X5A,0XEB,0X5A,0XEC,0X5A,0XEB,0X5A,0XEC,0X5A,0X0C,0X5B,
-0X0C,0X5B,0X0C,0X5B,0X0C,0X63,0X2C,0X63,0X2C,0X63,0X2C,0X63,0X4D,0X63,0X4D,0X63,
-0X4D,0X63,0X6D,0X6B,0X6D,0X6B,0X6E,0X6B,0X8E,0X6B,0X8E,0X6B,0X8E,0X6B,0XAE,0X73,
-0XAE,0X73,0XAF,0X73,0XCF,0X73,0XCF,0X73,0XEF,0X7B,0XF0,0X7B,0XEF,0X7B,0X10,0X7C,
-0X10,0X7C,0X30,0X84,0X31,0X84,0X51,0X84,0X51,0X84,0X51,0X84,0X71,0X8C,0X71,0X8C,
-0X51,0X84,0X72,0X8C,0X72,0X8C,0X92,0X8C,0XD3,0X94,0XA6,0X39,0XC2,0X18,0X81,0X10,
-0XC2,0X18,0X82,0X10,0XE3,0X20,0XA2,0X18,0XC2,0X18,0XC2,0X18,0XE3,0X20,0X82,0X18,
-0XC2,0X18,0XA2,0X18,0XE3,0X20,0XA2,0X18,0XC2,0X18,0XC3,0X20,0X03,0X29,0X24,0X29,
-0XA6,0X41,0X89,0X6A,0XCD,0X93,0XF2,0XBC,0XD5,0XD5,0XF6,0XDD,0X57,0XE6,0X98,0XEE,
-0XB9,0XEE,0XB9,0XEE,0XD9,0XF6,0XFA,0XF6,0XFA,0XF6,0X1A,0XF7,0X3B,0XF7,0X3B,0XFF,
-0X3C,0XFF,0X3B,0XFF,0X1B,0XF7,0X3B,0XFF,0X3B,0XFF,0X5C,0XFF,0X5C,0XFF,0X7C,0XFF,
-0X7C,0XFF,0X7C,0XFF,0X5C,0XFF,0X5C,0XFF,0X5C,0XFF,0X5C,0XFF,0X5C,0XFF,0X3C,0XFF,
-0X3B,0XFF,0XFB,0XF6,0XFA,0XF6,0XDA,0XEE,0XB9,0XEE,0X58,0XDE,0X38,0XDE,0XB5,0XD5,
-0XD5,0XD5,0X98,0XEE,0X78,0XEE,0X16,0XDE,0XD5,0XDD,0XB5,0XD5,0XB5,0XD5,0XB5,0XD5,
-0XB4,0XD5,0X94,0XD5,0X73,0XCD,0X12,0XC5,0XD0,0XBC,0X4F,0XAC,0X6C,0X83,0XE7,0X49,
-0X24,0X29,0X82,0X10,0X41,0X08,0X41,0X08,0X20,0X00,0X41,0X08,0X41,0X08,0X41,0X08,
-0X20,0X08,0X21,0X08,0X61,0X08,0X62,0X10,0X82,0X10,0X62,0X10,0XA2,0X18,0XC3,0X18,
-0XE3,0X20,0XA2,0X18,0XE3,0X20,0XE3,0X20,0X45,0X31,0X03,0X29,0X28,0X4A,0XC7,0X39,
-0X49,0X4A,0XC7,0X39,0X69,0X52,0X2D,0X6B,0X2C,0X6B,0X2C,0X6B,0XB2,0X94,0X76,0XAD,
-0X55,0XA5,0X15,0X9D,0X14,0X9D,0X14,0X9D,0X14,0X9D,0XD3,0X94,0XF4,0X9C,0XF4,0X9C,
-0XD3,0X9C,0XB3,0X94,0X72,0X8C,0X51,0X84,0X31,0X84,0X10,0X7C,0XF0,0X7B,0X31,0X84,
-0X51,0X84,0X71,0X8C,0X72,0X8C,0X31,0X84,0X51,0X84,0X71,0X84,0X51,0X84,0X31,0X84,
-0X30,0X84,0X10,0X7C,0X10,0X7C,0XF0,0X7B,0XF0,0X7B,0XEF,0X7B,0XEF,0X73,0XCF,0X73,
-0XAF,0X73,0XAE,0X73,0X8E,0X73,0X8E,0X73,0X6E,0X6B,0X6E,0X6B,0X6E,0X6B,0X6D,0X6B,
-0X2D,0X63,0X4D,0X63,0X4D,0X63,0X2D,0X63,0X2C,0X63,0X0C,0X63,0X0C,0X63,0X0C,0X63,
-0XEB,0X5A,0XCB,0X5A,0XEB,0X5A,0XEB,0X5A,0XEB,0X5A,0XEC,0X5A,0X0C,0X5B,0X0C,0X5B,
-0X0C,0X5B,0X0C,0X5B,0X2C,0X63,0X2C,0X63,0X2C,0X63,0X2D,0X63,0X4D,0X63,0X4D,0X63,
-0X4D,0X63,0X6D,0X6B,0X6D,0X6B,0X8E,0X6B,0X8E,0X6B,0X8E,0X6B,0X8E,0X6B,0XAE,0X73,
-0XAF,0X73,0XCF,0X73,0XCF,0X73,0XEF,0X7B,0XF0,0X7B,0XF0,0X7B,0X10,0X7C,0X10,0X7C,
-0X30,0X84,0X31,0X84,0X51,0X84,0X51,0X84,0X51,0X84,0X71,0X8C,0X72,0X8C,0X51,0X84,
-0X92,0X8C,0X92,0X8C,0X51,0X84,0X51,0X84,0X10,0X84,0XE3,0X20,0XE3,0X20,0X61,0X10,
-0XC3,0X18,0XA2,0X18,0XC3,0X18,0XC3,0X18,0XC2,0X18,0XC3,0X20,0XA2,0X18,0XE3,0X20,
-0XA2,0X18,0XC2,0X18,0XE3,0X20,0XA2,0X18,0XC3,0X20,0X04,0X29,0XE3,0X20,0XE3,0X20,
-0X44,0X39,0X07,0X52,0X0B,0X7B,0X8D,0X8B,0X8D,0X93,0X2F,0XAC,0X12,0XCD,0X73,0XCD,
-0X16,0XE6,0X77,0XEE,0XB8,0XEE,0XDA,0XF6,0XD9,0XF6,0XFA,0XF6,0X1B,0XF7,0X1B,0XF7,
-0X3C,0XFF,0X3B,0XFF,0X3B,0XFF,0X3B,0XFF,0X3C,0XFF,0X3C,0XFF,0X5C,0XFF,0X5C,0XFF,
-0X7C,0XFF,0X7C,0XFF,0X5C,0XFF,0X3B,0XF7,0X3C,0XFF,0X3C,0XFF,0X5C,0XFF,0X5B,0XF7,
-0X1B,0XF7,0X99,0XEE,0X78,0XE6,0X58,0XE6,0XB6,0XD5,0X54,0XC5,0XF2,0XBC,0X91,0XB4,
-0XB1,0XBC,0X70,0XB4,0X33,0XCD,0XD5,0XDD,0XB5,0XD5,0X95,0XD5,0X95,0XD5,0X94,0XD5,
-0XB4,0XD5,0X94,0XD5,0X53,0XCD,0X32,0XC5,0XD1,0XBC,0X6F,0XAC,0XAC,0X8B,0X68,0X5A,
-0X24,0X29,0XC3,0X18,0X61,0X10,0X41,0X08,0X41,0X08,0X20,0X00,0X21,0X08,0X41,0X08,
-0X61,0X10,0X41,0X08,0X61,0X08,0X61,0X08,0X61,0X10,0X62,0X10,0X82,0X10,0X82,0X10,
-0XC3,0X18,0X04,0X21,0X04,0X21,0XE3,0X20,0X04,0X29,0X45,0X29,0X24,0X29,0X86,0X31,
-0X07,0X42,0XC7,0X39,0X49,0X4A,0XCF,0X7B,0X4D,0X6B,0XEF,0X7B,0X2C,0X63,0X8E,0X73,
-0XEF,0X7B,0XD3,0X9C,0XF4,0X9C,0XF4,0X9C,0XD3,0X9C,0XB3,0X94,0XB3,0X94,0X51,0X8C,
-0X30,0X84,0X30,0X84,0X51,0X8C,0X92,0X94,0XB2,0X8C,0X92,0X8C,0XD3,0X94,0XB3,0X94,
-0X92,0X8C,0X72,0X8C,0X72,0X8C,0X72,0X8C,0X51,0X84,0X31,0X84,0X51,0X84,0X51,0X84,
-0X31,0X84,0X30,0X84,0X10,0X7C,0X10,0X7C,0X10,0X7C,0XEF,0X7B,0XEF,0X7B,0XCF,0X73,
-0XCF,0X73,0XAF,0X73,0XAF,0X73,0X8E,0X73,0X8E,0X73,0X8E,0X6B,0X6E,0X6B,0X2D,0X63,
-0X4D,0X6B,0X4D,0X6B,0X4D,0X63,0X4D,0X63,0X2C,0X63,0X2C,0X63,0X0C,0X63,0X0C,0X63,
-0XCB,0X5A,0XEB,0X5A,0XEB,0X5A,0XEC,0X5A,0XEC,0X5A,0XEC,0X5A,0X0C,0X5B,0X0C,0X5B,
-0X0C,0X5B,0X0C,0X5B,0X2C,0X63,0X2C,0X63,0X2D,0X63,0X4D,0X63,0X4D,0X63,0X4D,0X63,
-0X6D,0X6B,0X6D,0X6B,0X6E,0X6B,0X8E,0X6B,0X8E,0X6B,0X8E,0X6B,0X8E,0X6B,0XAF,0X73,
-0XCF,0X73,0XCF,0X73,0XEF,0X7B,0XF0,0X7B,0XF0,0X7B,0X10,0X7C,0X10,0X7C,0X30,0X84,
-0X31,0X84,0X51,0X84,0X51,0X84,0X51,0X84,0X71,0X84,0X72,0X8C,0X72,0X8C,0X71,0X8C,
-0X92,0X8C,0X92,0X8C,0X92,0X8C,0XD3,0X94,0X6D,0X6B,0XE3,0X20,0XA2,0X18,0XA2,0X18,
-0XC2,0X18,0XE3,0X18,0XC3,0X18,0XE3,0X20,0XC2,0X18,0XE3,0X20,0XA2,0X18,0XC3,0X18,
-0XA2,0X18,0XE3,0X20,0XA2,0X18,0XC2,0X18,0XA2,0X20,0XE3,0X20,0XE3,0X20,0XC3,0X20,
-0X65,0X39,0X27,0X5A,0X69,0X62,0XEA,0X72,0X2B,0X83,0X4B,0X8B,0X6B,0X93,0XCD,0XA3,
-0X2E,0XB4,0X90,0XC4,0XF2,0XCC,0XD5,0XDD,0X37,0XE6,0XB9,0XF6,0X1A,0XF7,0X1A,0XF7,
-0X3B,0XFF,0X3B,0XFF,0X1B,0XF7,0X1B,0XF7,0X3B,0XFF,0X3B,0XFF,0X3B,0XFF,0X3B,0XFF,
-0X5C,0XFF,0X3B,0XFF,0X1B,0XF7,0XFB,0XF6,0X99,0XEE,0XB9,0XEE,0X78,0XEE,0X17,0XE6,
-0X53,0XCD,0XB1,0XC4,0X91,0XBC,0XCD,0X9B,0X2F,0XA4,0X0E,0X9C,0X0F,0XA4,0XEE,0X9B,
-0X6C,0X8B,0X0F,0XA4,0X8D,0X9B,0X4B,0X93,0X2F,0XA4,0X33,0XCD,0X94,0XD5,0XB5,0XD5,
-0XB4,0XD5,0X94,0XD5,0X53,0XCD,0X32,0XC5,0XF1,0XBC,0X8F,0XB4,0XCD,0X93,0XA9,0X62,
-0X85,0X39,0XA2,0X18,0X62,0X10,0X21,0X08,0X00,0X00,0X41,0X08,0X20,0X08,0X21,0X08,
-0X20,0X00,0X21,0X08,0X41,0X08,0X61,0X08,0X82,0X10,0X82,0X10,0X82,0X10,0XA2,0X18,
-0XE3,0X20,0XC3,0X18,0XE3,0X20,0X04,0X21,0XE3,0X20,0X24,0X29,0X04,0X21,0X45,0X29,
-0X65,0X31,0XA6,0X39,0XCB,0X5A,0XAA,0X5A,0X30,0X84,0X6E,0X73,0X92,0X8C,0X92,0X94,
-0X34,0XA5,0X10,0X84,0X10,0X84,0X30,0X84,0X92,0X94,0X71,0X8C,0X92,0X8C,0XD3,0X94,
-0XF4,0X9C,0XF3,0X94,0XF3,0X94,0X92,0X8C,0XD3,0X94,0XD3,0X94,0XD3,0X94,0XB3,0X94,
-0X72,0X8C,0XB2,0X94,0X72,0X8C,0X92,0X8C,0X92,0X8C,0X51,0X84,0X31,0X84,0X51,0X84,
-0X51,0X84,0X31,0X84,0X30,0X84,0X10,0X7C,0X10,0X7C,0X10,0X7C,0XF0,0X7B,0XEF,0X7B,
-0XCF,0X7B,0XCF,0X73,0XAF,0X73,0XAE,0X73,0X8E,0X73,0X8E,0X6B,0X4D,0X6B,0X6E,0X6B,
-0X6D,0X6B,0X4D,0X6B,0X4D,0X6B,0X2D,0X63,0X2D,0X63,0X2C,0X63,0X2C,0X63,0X2C,0X63,
-0XCB,0X5A,0XCB,0X5A,0XEB,0X5A,0XEB,0X5A,0XEC,0X5A,0XEC,0X5A,0X0C,0X63,0X0C,0X63,
-0X0C,0X5B,0X2C,0X63,0X2C,0X63,0X2C,0X63,0X4D,0X63,0X4D,0X63,0X4D,0X63,0X6D,0X6B,
-0X6D,0X6B,0X6D,0X6B,0X8E,0X6B,0X8E,0X6B,0X8E,0X6B,0X8E,0X6B,0XAF,0X73,0XCF,0X73,
-0XCF,0X73,0XCF,0X73,0XF0,0X7B,0XF0,0X7B,0X10,0X7C,0X10,0X7C,0X10,0X7C,0X31,0X84,
-0X31,0X84,0X51,0X84,0X51,0X84,0X51,0X84,0X72,0X8C,0X72,0X8C,0X92,0X8C,0X72,0X8C,
-0X92,0X8C,0X92,0X8C,0XB2,0X94,0X14,0X9D,0X28,0X4A,0XC3,0X18,0X61,0X10,0XA2,0X18,
-0XC2,0X18,0XC3,0X18,0XA2,0X18,0XE3,0X20,0XA2,0X18,0XC3,0X18,0XC3,0X20,0XA2,0X18,
-0XA2,0X18,0XC2,0X18,0X82,0X18,0XC2,0X18,0XA2,0X20,0XE3,0X28,0XE3,0X28,0X03,0X29,
-0X85,0X39,0X28,0X5A,0X69,0X62,0X89,0X62,0XA9,0X6A,0XA9,0X72,0XA9,0X6A,0XAA,0X6A,
-0XEA,0X7A,0XEB,0X7A,0XCD,0X9B,0XD1,0XBC,0X32,0XCD,0XD5,0XDD,0XB9,0XF6,0XFA,0XF6,
-0X1B,0XF7,0X1B,0XF7,0X1B,0XF7,0X1B,0XF7,0X1B,0XF7,0X1B,0XF7,0X1B,0XF7,0X1B,0XF7,
-0X3B,0XF7,0X1B,0XF7,0X78,0XE6,0X58,0XE6,0XF6,0XDD,0X74,0XCD,0X12,0XC5,0X0F,0XA4,
-0X4C,0X8B,0X6C,0X8B,0XEA,0X7A,0X0B,0X73,0X0B,0X73,0XAD,0X93,0X8D,0X8B,0XCD,0X93,
-0XCE,0X9B,0X8D,0X93,0X8D,0X93,0X0A,0X7B,0X89,0X72,0X2B,0X8B,0XB0,0XBC,0X95,0XD5,
-0X94,0XD5,0X94,0XD5,0X94,0XD5,0X52,0XCD,0XF1,0XBC,0XB0,0XB4,0X0D,0X9C,0X2A,0X73,
-0X85,0X39,0XE3,0X18,0X82,0X10,0X21,0X08,0X20,0X08,0X00,0X00,0X21,0X08,0X20,0X00,
-0X21,0X08,0X20,0X08,0X41,0X08,0X82,0X10,0X82,0X10,0X82,0X10,0X82,0X10,0XC2,0X18,
-0XA2,0X18,0XC3,0X18,0XA2,0X18,0X03,0X21,0X24,0X29,0X24,0X29,0X44,0X29,0X04,0X21,
-0X24,0X29,0X45,0X31,0X04,0X21,0X8E,0X73,0XAE,0X73,0X8E,0X73,0X10,0X84,0XB2,0X94,
-0X92,0X94,0X14,0X9D,0XF3,0X94,0XD3,0X94,0X92,0X8C,0X92,0X94,0XF4,0X9C,0X14,0XA5,
-0XD3,0X94,0XD3,0X94,0XD3,0X94,0XD3,0X94,0XB2,0X94,0XB2,0X94,0X92,0X8C,0X72,0X8C,
-0X92,0X8C,0X72,0X8C,0X72,0X8C,0X72,0X8C,0X72,0X8C,0X72,0X8C,0X51,0X84,0X31,0X84,
-0X51,0X84,0X31,0X84,0X31,0X84,0X30,0X84,0X10,0X7C,0X10,0X7C,0X10,0X7C,0XEF,0X7B,
-0XCF,0X7B,0XCF,0X73,0XCF,0X73,0XAE,0X73,0X8E,0X73,0X6E,0X6B,0X8E,0X73,0X6E,0X6B,
-0X6E,0X6B,0X6D,0X6B,0X4D,0X6B,0X4D,0X6B,0X4D,0X63,0X2C,0X63,0X2C,0X63,0X2C,0X63,
-0XCB,0X5A,0XEB,0X5A,0XEC,0X5A,0XEC,0X5A,0XEC,0X5A,0XEC,0X5A,0X0C,0X5B,0X0C,0X63,
-0X0C,0X63,0X2C,0X63,0X2C,0X63,0X4D,0X63,0X4D,0X63,0X4D,0X63,0X6D,0X6B,0X6D,0X6B,
-0X6D,0X6B,0X6E,0X6B,0X8E,0X6B,0X8E,0X6B,0X8E,0X6B,0XAE,0X73,0XAF,0X73,0XAF,0X73,
-0XCF,0X73,0XEF,0X7B,0XF0,0X7B,0X10,0X7C,0X10,0X7C,0X10,0X7C,0X11,0X84,0X31,0X84,
-0X51,0X84,0X51,0X84,0X51,0X84,0X71,0X8C,0X72,0X8C,0X72,0X8C,0X92,0X8C,0X72,0X8C,
-0X92,0X94,0XB3,0X94,0XD3,0X94,0XD3,0X9C,0X44,0X29,0XA2,0X10,0XA2,0X18,0X82,0X10,
-0XC3,0X20,0XC3,0X20,0XA2,0X18,0XE3,0X20,0XC2,0X18,0XC2,0X18,0XC2,0X18,0X82,0X18,
-0XE3,0X20,0XA2,0X18,0XC2,0X18,0XA2,0X18,0XA2,0X20,0XE3,0X20,0XE3,0X28,0X08,0X52,
-0XEA,0X72,0XEA,0X7A,0XCA,0X72,0XEA,0X72,0X89,0X62,0X49,0X5A,0X69,0X5A,0X28,0X52,
-0X48,0X5A,0XA9,0X72,0X8C,0X8B,0X4F,0XAC,0X90,0XB4,0X74,0XD5,0X16,0XE6,0XD9,0XF6,
-0XFA,0XF6,0X1B,0XF7,0X1B,0XFF,0XFA,0XF6,0XFA,0XF6,0X1B,0XFF,0XFA,0XF6,0X1A,0XF7,
-0XDA,0XF6,0X98,0XE6,0X17,0XDE,0X94,0XD5,0X74,0XCD,0X33,0XCD,0X91,0XB4,0X6C,0X8B,
-0X6C,0X8B,0X4C,0X83,0XEA,0X72,0XCA,0X72,0X0B,0X7B,0X6C,0X8B,0X0E,0XA4,0XCE,0X9B,
-0XEE,0X9B,0X2F,0XAC,0X0E,0XAC,0X0E,0XA4,0X4C,0X8B,0X4C,0X8B,0X4B,0X93,0X4F,0XB4,
-0X74,0XD5,0X94,0XCD,0X74,0XCD,0X73,0XCD,0X12,0XC5,0XB0,0XB4,0X2E,0XA4,0X8C,0X83,
-0XE6,0X41,0XC3,0X18,0XA2,0X10,0X41,0X08,0X20,0X00,0X21,0X08,0X20,0X00,0X41,0X08,
-0X41,0X08,0X20,0X08,0X21,0X08,0X82,0X10,0XA2,0X10,0XA2,0X18,0XA2,0X18,0X82,0X10,
-0XA2,0X18,0XA2,0X18,0XC3,0X18,0XC3,0X18,0X44,0X29,0X03,0X21,0X65,0X31,0X65,0X31,
-0XC6,0X39,0X24,0X29,0X04,0X29,0X89,0X52,0X6D,0X6B,0X51,0X8C,0XF0,0X7B,0XAF,0X73,
-0XF3,0X9C,0X14,0X9D,0X76,0XAD,0X14,0X9D,0XD3,0X94,0XD3,0X94,0X72,0X8C,0X92,0X8C,
-0XD3,0X94,0XF3,0X9C,0XD3,0X94,0XB3,0X94,0X92,0X8C,0XF4,0X9C,0XD3,0X94,0XB3,0X94,
-0X72,0X8C,0X92,0X8C,0X92,0X8C,0X92,0X8C,0X92,0X8C,0X72,0X8C,0X71,0X8C,0X31,0X84,
-0X51,0X84,0X31,0X84,0X30,0X84,0X31,0X84,0XF0,0X7B,0X10,0X7C,0X10,0X7C,0XF0,0X7B,
-0XCF,0X7B,0XCF,0X73,0XCF,0X73,0XAE,0X73,0X8E,0X73,0X8E,0X73,0X8E,0X73,0X8E,0X73,
-0X6E,0X6B,0X6D,0X6B,0X4D,0X6B,0X4D,0X6B,0X4D,0X6B,0X2D,0X63,0X2D,0X63,0X2D,0X63,
-0XEB,0X5A,0XEB,0X5A,0XEB,0X5A,0XEC,0X5A,0X0C,0X5B,0X0C,0X63,0X0C,0X63,0X0C,0X63,
-0X2C,0X63,0X2D,0X63,0X2C,0X63,0X4D,0X63,0X4D,0X63,0X4D,0X63,0X6D,0X6B,0X6D,0X6B,
-0X6D,0X6B,0X8E,0X6B,0X8E,0X6B,0X8E,0X6B,0XAE,0X73,0XAF,0X73,0XCF,0X73,0XCF,0X73,
-0XEF,0X73,0XF0,0X7B,0XF0,0X7B,0X10,0X7C,0X10,0X7C,0X31,0X84,0X31,0X84,0X31,0X84,
-0X51,0X84,0X51,0X84,0X72,0X8C,0X72,0X8C,0X72,0X8C,0X92,0X8C,0X92,0X8C,0X92,0X8C,
-0XB3,0X94,0XD3,0X94,0XF4,0X94,0XF0,0X7B,0XC2,0X20,0XC3,0X18,0XA2,0X18,0XA2,0X18,
-0XC3,0X18,0XC3,0X20,0XA2,0X18,0XE3,0X20,0XC2,0X18,0XA2,0X18,0XC2,0X18,0X81,0X10,
-0XE3,0X20,0XA2,0X18,0XA2,0X18,0XA2,0X18,0XA2,0X18,0XA2,0X18,0XA5,0X41,0X0E,0XA4,
-0X53,0XC5,0XB4,0XD5,0XB5,0XD5,0X53,0XCD,0XD1,0XB4,0X6F,0XAC,0X8D,0X8B,0X4B,0X8B,
-0X6C,0X8B,0XEA,0X7A,0XEA,0X7A,0X6B,0X8B,0X4F,0XB4,0X6F,0XBC,0X54,0XD5,0X78,0XEE,
-0XD9,0XF6,0X1A,0XF7,0XFA,0XF6,0XFA,0XF6,0XFA,0XF6,0XFA,0XF6,0XFA,0XF6,0XFA,0XF6,
-0XD9,0XEE,0X16,0XE6,0XB4,0XD5,0X53,0XCD,0X32,0XCD,0XB0,0XBC,0XCD,0XA3,0X2B,0X8B,
-0X8C,0X93,0XAD,0X93,0XCD,0X9B,0X50,0XAC,0X75,0XCD,0X17,0XD6,0X17,0XDE,0X79,0XE6,
-0X78,0XE6,0X17,0XDE,0X16,0XDE,0XD5,0XD5,0XF6,0XDD,0XB5,0XD5,0X74,0XCD,0XD1,0XBC,
-0XB0,0XBC,0X53,0XCD,0X73,0XCD,0X53,0XCD,0X32,0XC5,0XB1,0XB4,0X4F,0XAC,0XAD,0X8B,
-0X48,0X52,0XE3,0X20,0XA2,0X10,0X61,0X08,0X21,0X08,0X41,0X08,0X21,0X08,0X41,0X08,
-0X61,0X08,0X82,0X10,0X62,0X10,0XA2,0X18,0X82,0X10,0X82,0X10,0XA2,0X18,0XA2,0X18,
-0X82,0X10,0XC2,0X18,0XC3,0X18,0X04,0X21,0XE3,0X20,0X04,0X29,0XA6,0X39,0X65,0X31,
-0XA6,0X39,0XE7,0X41,0X44,0X29,0X45,0X29,0XC6,0X39,0XAA,0X5A,0X8E,0X73,0X51,0X8C,
-0XAE,0X73,0X92,0X8C,0XF3,0X94,0X35,0XA5,0X35,0XA5,0X75,0XAD,0X35,0XA5,0X14,0X9D,
-0X35,0XA5,0XF3,0X9C,0XD3,0X94,0XF4,0X9C,0XB3,0X94,0XD3,0X94,0X92,0X8C,0X92,0X8C,
-0X92,0X8C,0XD3,0X94,0XB3,0X94,0X92,0X94,0X92,0X8C,0X92,0X8C,0X72,0X8C,0X72,0X8C,
-0X51,0X84,0X51,0X84,0X51,0X84,0X10,0X7C,0X30,0X84,0X10,0X7C,0X10,0X7C,0XF0,0X7B,
-0XF0,0X7B,0XCF,0X73,0XAF,0X73,0XAF,0X73,0XAF,0X73,0XAE,0X73,0X8E,0X73,0X8E,0X73,
-0X6E,0X6B,0X6E,0X6B,0X6D,0X6B,0X6D,0X6B,0X4D,0X6B,0X4D,0X6B,0X2D,0X63,0X2D,0X63,
-0XEB,0X5A,0XEC,0X5A,0XEC,0X5A,0X0C,0X5B,0X0C,0X5B,0X0C,0X63,0X0C,0X63,0X2C,0X63,
-0X2C,0X63,0X2D,0X63,0X4D,0X63,0X4D,0X63,0X4D,0X63,0X6D,0X6B,0X6D,0X6B,0X6E,0X6B,
-0X6E,0X6B,0X8E,0X6B,0X8E,0X6B,0XAE,0X73,0XAE,0X73,0XAF,0X73,0XCF,0X73,0XCF,0X73,
-0XF0,0X7B,0XF0,0X7B,0XF0,0X7B,0X10,0X7C,0X10,0X84,0X31,0X84,0X51,0X84,0X51,0X84,
-0X51,0X84,0X72,0X8C,0X72,0X8C,0X72,0X8C,0X92,0X8C,0X92,0X8C,0XB2,0X94,0X92,0X8C,
-0XD3,0X94,0XD3,0X94,0X34,0X9D,0X8A,0X5A,0XE3,0X20,0XE3,0X20,0X61,0X10,0XC3,0X18,
-0XC3,0X18,0XE3,0X20,0XA2,0X18,0XC2,0X18,0XC3,0X20,0X82,0X18,0XC2,0X18,0X82,0X18,
-0XE3,0X28,0XA2,0X18,0XC2,0X18,0XA2,0X18,0XA2,0X18,0XE3,0X20,0X28,0X5A,0XB1,0XBC,
-0X73,0XCD,0XD5,0XD5,0X16,0XDE,0X16,0XE6,0XF6,0XDD,0XF6,0XDD,0X94,0XDD,0X32,0XCD,
-0X11,0XC5,0X4F,0XB4,0X0E,0XAC,0X0D,0XA4,0X4E,0XAC,0X8F,0XB4,0X32,0XCD,0X16,0XE6,
-0X98,0XEE,0XD9,0XF6,0XFA,0XF6,0XFA,0XF6,0XDA,0XF6,0XFA,0XF6,0XFA,0XF6,0XFA,0XF6,
-0XDA,0XF6,0XD5,0XDD,0X53,0XD5,0X32,0XCD,0XD0,0XC4,0X4F,0XB4,0X4E,0XAC,0XB0,0XBC,
-0XB1,0XB4,0X53,0XCD,0XD5,0XDD,0X37,0XE6,0XBA,0XF6,0X1B,0XF7,0XFA,0XEE,0XFA,0XEE,
-0XDA,0XEE,0XDA,0XF6,0XD9,0XEE,0X98,0XEE,0X57,0XE6,0X37,0XE6,0XD5,0XDD,0XB5,0XD5,
-0X74,0XCD,0X53,0XCD,0X73,0XCD,0X73,0XCD,0X33,0XCD,0XD1,0XBC,0X6F,0XAC,0XCD,0X93,
-0X68,0X52,0X04,0X21,0X82,0X10,0X82,0X10,0X20,0X08,0X20,0X00,0X20,0X08,0X20,0X08,
-0X41,0X08,0X41,0X08,0X20,0X08,0X61,0X10,0XA2,0X18,0X82,0X10,0XC3,0X18,0XA2,0X18,
-0X82,0X10,0XC2,0X18,0XC3,0X18,0XC3,0X18,0X24,0X29,0XC3,0X20,0X45,0X29,0XC7,0X39,
-0XE7,0X41,0X28,0X4A,0XC7,0X39,0X04,0X21,0X28,0X4A,0XEB,0X62,0X07,0X42,0XCA,0X5A,
-0XAE,0X73,0X30,0X84,0XD3,0X9C,0XB3,0X94,0X35,0XA5,0X14,0X9D,0X34,0XA5,0XF4,0X9C,
-0XD3,0X94,0X14,0X9D,0XF4,0X9C,0XD3,0X94,0X35,0XA5,0X72,0X8C,0XD3,0X94,0XD3,0X94,
-0XD3,0X94,0XB3,0X94,0XB3,0X94,0X92,0X8C,0XB3,0X94,0X92,0X8C,0X92,0X8C,0X92,0X8C,
-0X71,0X8C,0X51,0X84,0X31,0X84,0X51,0X84,0X30,0X84,0X10,0X7C,0X30,0X84,0X10,0X7C,
-0XF0,0X7B,0XCF,0X7B,0XCF,0X73,0XCF,0X7B,0XCF,0X73,0XAF,0X73,0XAE,0X73,0X8E,0X73,
-0X8E,0X73,0X8E,0X6B,0X6E,0X6B,0X6D,0X6B,0X4D,0X6B,0X4D,0X6B,0X4D,0X63,0X4D,0X63,
-0XEB,0X5A,0XEB,0X5A,0XEC,0X5A,0XEC,0X5A,0X0C,0X63,0X0C,0X5B,0X0C,0X63,0X2C,0X63,
-0X2C,0X63,0X4D,0X63,0X4D,0X63,0X4D,0X63,0X4D,0X63,0X6D,0X6B,0X6E,0X6B,0X6E,0X6B,
-0X8E,0X6B,0X8E,0X6B,0X8E,0X6B,0XAF,0X73,0XAF,0X73,0XCF,0X73,0XCF,0X73,0XEF,0X73,
-0XF0,0X7B,0XF0,0X7B,0X10,0X7C,0X10,0X7C,0X30,0X84,0X31,0X84,0X51,0X84,0X51,0X84,
-0X71,0X8C,0X72,0X8C,0X72,0X8C,0X72,0X8C,0X72,0X8C,0X92,0X8C,0XB3,0X94,0XB2,0X8C,
-0XD3,0X94,0XF4,0X9C,0X92,0X94,0X03,0X29,0XC3,0X18,0XA2,0X18,0X82,0X10,0XC3,0X18,
-0XC3,0X20,0XC3,0X20,0XC3,0X20,0XC2,0X18,0XA2,0X18,0XE3,0X20,0XA2,0X18,0XC3,0X20,
-0XC2,0X20,0XA2,0X18,0XA2,0X18,0X81,0X10,0XC3,0X20,0XE3,0X20,0XEA,0X72,0XD0,0XBC,
-0X73,0XD5,0XB5,0XDD,0XD5,0XDD,0X15,0XE6,0X16,0XE6,0X16,0XE6,0X36,0XE6,0X15,0XE6,
-0XD5,0XDD,0X93,0XD5,0X73,0XD5,0X11,0XCD,0XF1,0XCC,0X11,0XCD,0X72,0XD5,0XB4,0XDD,
-0X37,0XE6,0X78,0XEE,0X99,0XF6,0XD9,0XF6,0XD9,0XF6,0XFA,0XF6,0XF9,0XF6,0XD9,0XF6,
-0X99,0XEE,0X16,0XE6,0X73,0XD5,0X52,0XD5,0XF1,0XCC,0X31,0XD5,0X52,0XD5,0X93,0XDD,
-0XD5,0XDD,0X36,0XE6,0X78,0XEE,0X98,0XEE,0XB9,0XEE,0X98,0XEE,0XB9,0XEE,0X99,0XEE,
-0XB9,0XEE,0X98,0XEE,0X78,0XEE,0X58,0XE6,0X37,0XE6,0X16,0XE6,0XF6,0XDD,0XB5,0XD5,
-0X94,0XD5,0X74,0XCD,0X94,0XD5,0X73,0XCD,0X53,0XCD,0XF1,0XBC,0X90,0XB4,0X0E,0X9C,
-0X48,0X52,0X24,0X29,0XA2,0X10,0X41,0X08,0X41,0X08,0X00,0X00,0X20,0X00,0X20,0X00,
-0X41,0X08,0X41,0X08,0X41,0X08,0X41,0X08,0XC3,0X18,0X82,0X10,0XC3,0X18,0XC3,0X18,
-0XE3,0X20,0XA2,0X18,0XC3,0X18,0XA2,0X18,0X45,0X29,0XE3,0X20,0X65,0X31,0X28,0X4A,
-0X08,0X42,0XEB,0X5A,0X8A,0X52,0XA6,0X39,0X04,0X21,0X08,0X42,0X69,0X52,0XE7,0X41,
-0X07,0X4A,0X69,0X52,0X4D,0X6B,0X92,0X94,0X92,0X94,0X14,0XA5,0X35,0XA5,0X55,0XA5,
-0XF3,0X9C,0XD3,0X94,0X55,0XA5,0X14,0X9D,0X51,0X84,0XF3,0X9C,0X14,0X9D,0XF4,0X9C,
-0XF4,0X9C,0XD3,0X94,0XD3,0X94,0XD3,0X94,0XB2,0X94,0X92,0X8C,0X92,0X8C,0X72,0X8C,
-0X71,0X8C,0X71,0X8C,0X51,0X84,0X51,0X84,0X31,0X84,0X10,0X7C,0X31,0X84,0XF0,0X7B,
-0XF0,0X7B,0X10,0X7C,0XF0,0X7B,0XCF,0X73,0XCF,0X7B,0XCF,0X73,0XAF,0X73,0XAF,0X73,
-0X8E,0X73,0X6E,0X6B,0X8E,0X6B,0X6D,0X6B,0X6D,0X6B,0X4D,0X6B,0X4D,0X6B,0X4D,0X6B,
-0XEB,0X5A,0XEB,0X5A,0XEC,0X5A,0XEC,0X5A,0X0C,0X63,0X0C,0X5B,0X2C,0X63,0X0C,0X63,
-0X2D,0X63,0X4D,0X63,0X4D,0X63,0X6D,0X6B,0X6D,0X6B,0X6D,0X6B,0X6E,0X6B,0X8E,0X6B,
-0X8E,0X6B,0X8E,0X6B,0XAE,0X73,0XAF,0X73,0XAF,0X73,0XCF,0X73,0XCF,0X73,0XF0,0X7B,
-0XF0,0X7B,0X10,0X7C,0X10,0X7C,0X30,0X84,0X31,0X84,0X51,0X84,0X51,0X84,0X71,0X8C,
-0X72,0X8C,0X92,0X8C,0X92,0X8C,0X92,0X8C,0X51,0X84,0XB3,0X94,0XD3,0X94,0XB3,0X94,
-0XD3,0X94,0X35,0XA5,0XCB,0X5A,0XE3,0X20,0XE4,0X20,0XA2,0X18,0X82,0X10,0XC3,0X20,
-0X04,0X21,0XA3,0X18,0XC2,0X18,0XE3,0X20,0XC2,0X18,0XC2,0X18,0XA2,0X18,0XE3,0X28,
-0XA2,0X18,0XC2,0X18,0XA2,0X18,0XA2,0X18,0XC3,0X20,0XE3,0X20,0X2B,0X83,0XD0,0XBC,
-0X73,0XCD,0XB3,0XD5,0XD5,0XDD,0X35,0XE6,0X57,0XEE,0X78,0XEE,0XB9,0XEE,0X98,0XEE,
-0X78,0XEE,0X16,0XE6,0XB4,0XDD,0X93,0XD5,0X32,0XD5,0X11,0XCD,0X31,0XCD,0X73,0XD5,
-0XB4,0XDD,0X37,0XE6,0X78,0XEE,0XB9,0XF6,0XD9,0XF6,0XF9,0XF6,0XF9,0XF6,0XB9,0XEE,
-0X57,0XEE,0XF5,0XE5,0XB4,0XDD,0X73,0XD5,0X52,0XD5,0X52,0XD5,0XB4,0XDD,0XD5,0XDD,
-0X37,0XE6,0X98,0XEE,0X98,0XEE,0XB9,0XF6,0XB9,0XEE,0X99,0XEE,0X78,0XEE,0X78,0XEE,
-0X78,0XEE,0X57,0XEE,0X78,0XEE,0X37,0XE6,0X57,0XEE,0X16,0XE6,0XD5,0XDD,0XD5,0XDD,
-0XB5,0XD5,0X94,0XD5,0X94,0XD5,0X93,0XD5,0X52,0XCD,0X11,0XC5,0XD0,0XBC,0X0E,0XA4,
-0X68,0X5A,0X25,0X29,0XC3,0X18,0X41,0X08,0X20,0X00,0X20,0X00,0X21,0X08,0X20,0X00,
-0X20,0X08,0X41,0X08,0X61,0X10,0X41,0X08,0XC3,0X18,0XA2,0X18,0X82,0X10,0XE3,0X20,
-0XC3,0X18,0XE3,0X20,0XA2,0X18,0XA2,0X18,0X03,0X21,0X44,0X29,0X45,0X29,0XA6,0X39,
-0X8A,0X52,0XCB,0X5A,0XAF,0X73,0XCB,0X5A,0XE3,0X20,0X8A,0X5A,0X8F,0X73,0X08,0X42,
-0X69,0X52,0XE7,0X41,0X28,0X4A,0XEB,0X62,0X30,0X84,0X71,0X8C,0XB2,0X94,0X14,0X9D,
-0X14,0X9D,0XB2,0X94,0XD3,0X94,0XD3,0X94,0X35,0XA5,0XF3,0X9C,0X14,0X9D,0X14,0X9D,
-0XF4,0X9C,0XF4,0X9C,0XF3,0X9C,0XD3,0X94,0XB2,0X94,0X92,0X8C,0X72,0X8C,0X72,0X8C,
-0X72,0X8C,0X92,0X8C,0X72,0X8C,0X71,0X8C,0X51,0X84,0X10,0X7C,0X10,0X7C,0X10,0X7C,
-0X10,0X7C,0X10,0X7C,0X10,0X7C,0XCF,0X7B,0XCF,0X7B,0XCF,0X73,0XCF,0X73,0XAF,0X73,
-0X8E,0X73,0X8E,0X6B,0X6E,0X6B,0X8E,0X6B,0X6D,0X6B,0X6D,0X6B,0X4D,0X6B,0X4D,0X6B,
-0XEB,0X5A,0XEC,0X5A,0X0C,0X5B,0X0C,0X5B,0X0C,0X63,0X2C,0X5B,0X2C,0X63,0X2C,0X63,
-0X4D,0X63,0X4D,0X63,0X4D,0X63,0X4D,0X63,0X6D,0X6B,0X6E,0X6B,0X6E,0X6B,0X8E,0X6B,
-0X8E,0X6B,0XAE,0X73,0XAF,0X73,0XAF,0X73,0XCF,0X73,0XCF,0X73,0XEF,0X7B,0XF0,0X7B,
-0X10,0X7C,0X10,0X7C,0X10,0X7C,0X31,0X84,0X51,0X84,0X51,0X84,0X51,0X8C,0X72,0X8C,
-0X72,0X8C,0X92,0X8C,0X92,0X8C,0XB2,0X94,0X92,0X8C,0X92,0X8C,0XB2,0X94,0XD3,0X94,
-0XF4,0X9C,0X71,0X8C,0X8A,0X52,0XE3,0X20,0XE3,0X20,0XA2,0X18,0X82,0X18,0XC3,0X20,
-0XE3,0X20,0XC3,0X18,0XC3,0X20,0XE3,0X20,0XA2,0X18,0XE3,0X20,0XA2,0X18,0XC3,0X20,
-0XC2,0X20,0XA2,0X18,0X82,0X18,0XC2,0X18,0XA2,0X20,0XE3,0X28,0X2B,0X83,0XB0,0XBC,
-0XB0,0XBC,0X11,0XCD,0XD1,0XC4,0X0E,0XAC,0XED,0XAB,0X8F,0XBC,0XF1,0XC4,0X16,0XE6,
-0XFA,0XF6,0XDA,0XF6,0X98,0XEE,0XF5,0XE5,0XB4,0XDD,0X53,0XD5,0X52,0XCD,0X52,0XD5,
-0XB4,0XDD,0X16,0XE6,0X57,0XEE,0X99,0XEE,0XB9,0XF6,0XD9,0XF6,0XD9,0XF6,0X98,0XEE,
-0X37,0XE6,0XD5,0XDD,0X93,0XDD,0X93,0XD5,0X93,0XDD,0XD5,0XDD,0X36,0XE6,0X57,0XEE,
-0X78,0XEE,0XB9,0XEE,0XB9,0XEE,0XD9,0XF6,0X78,0XEE,0XD5,0XDD,0X94,0XD5,0XD4,0XDD,
-0XD5,0XDD,0X36,0XEE,0X16,0XE6,0X36,0XE6,0X16,0XE6,0XD5,0XDD,0XD5,0XDD,0XB4,0XDD,
-0XB4,0XD5,0X94,0XD5,0X94,0XD5,0X93,0XD5,0X52,0XCD,0X32,0XC5,0XD0,0XBC,0X4F,0XA4,
-0X28,0X52,0X25,0X29,0XC3,0X18,0X61,0X10,0X20,0X00,0X00,0X00,0X21,0X08,0X21,0X08,
-0X21,0X08,0X41,0X08,0X61,0X08,0X61,0X08,0XA2,0X18,0XC3,0X18,0XA2,0X18,0X81,0X10,
-0X04,0X21,0XC3,0X18,0XE3,0X20,0XA2,0X18,0XA2,0X18,0X86,0X31,0X24,0X29,0X86,0X31,
-0X69,0X52,0X49,0X4A,0X2C,0X63,0X8E,0X73,0XE8,0X39,0X04,0X29,0XCE,0X7B,0X72,0X8C,
-0X49,0X4A,0X8E,0X73,0XCB,0X5A,0XAA,0X5A,0X69,0X52,0X8E,0X73,0XCF,0X7B,0X31,0X84,
-0XF3,0X9C,0XF4,0X9C,0XB3,0X94,0X14,0X9D,0X14,0X9D,0XD3,0X94,0XF4,0X9C,0XF4,0X9C,
-0XD3,0X94,0XD3,0X94,0XD3,0X94,0XB3,0X94,0XD3,0X94,0XD3,0X94,0XB3,0X94,0XB2,0X94,
-0X92,0X8C,0X71,0X8C,0X72,0X8C,0X72,0X8C,0X31,0X84,0XF0,0X7B,0X51,0X84,0X31,0X84,
-0X10,0X7C,0X10,0X84,0X10,0X7C,0XCF,0X7B,0XEF,0X7B,0XEF,0X73,0XCF,0X73,0XCF,0X73,
-0XAE,0X73,0X8E,0X73,0X8E,0X73,0X8E,0X73,0X6E,0X6B,0X6D,0X6B,0X6D,0X6B,0X4D,0X6B,
-0XEC,0X5A,0XEC,0X5A,0X0C,0X5B,0X0C,0X63,0X0C,0X63,0X2C,0X63,0X2C,0X63,0X2D,0X63,
-0X4D,0X63,0X4D,0X63,0X4D,0X63,0X4D,0X63,0X6E,0X6B,0X8E,0X6B,0X8E,0X6B,0X8E,0X6B,
-0X8E,0X6B,0XAF,0X73,0XAF,0X73,0XAF,0X73,0XCF,0X73,0XEF,0X73,0XF0,0X7B,0XF0,0X7B,
-0X10,0X7C,0X10,0X7C,0X30,0X84,0X31,0X84,0X51,0X84,0X51,0X84,0X72,0X8C,0X72,0X8C,
-0X72,0X8C,0X92,0X8C,0XB2,0X94,0XB3,0X94,0XB3,0X94,0XB2,0X94,0XB3,0X94,0X92,0X8C,
-0XF3,0X9C,0X6D,0X73,0XE7,0X41,0X04,0X29,0XC3,0X20,0X82,0X10,0X82,0X10,0XE3,0X20,
-0XE3,0X20,0XC3,0X20,0XC3,0X20,0XC3,0X20,0XC2,0X20,0XC3,0X20,0XA2,0X18,0XE3,0X20,
-0XC2,0X20,0XA2,0X18,0X82,0X18,0XC2,0X20,0X81,0X18,0X03,0X29,0X2B,0X83,0X0D,0XA4,
-0XEA,0X82,0XA5,0X49,0XE6,0X59,0X85,0X49,0X85,0X49,0X47,0X6A,0XCA,0X7A,0X6B,0X8B,
-0XCD,0XA3,0X32,0XCD,0XB8,0XF6,0X98,0XEE,0X17,0XE6,0XD5,0XDD,0X93,0XD5,0X52,0XD5,
-0X93,0XD5,0XF5,0XDD,0X57,0XEE,0X78,0XEE,0XB9,0XF6,0XB9,0XF6,0XD9,0XF6,0XB9,0XF6,
-0X57,0XEE,0XD5,0XDD,0XB4,0XDD,0XD4,0XDD,0XF6,0XE5,0X37,0XE6,0X57,0XE6,0X57,0XEE,
-0X57,0XEE,0X73,0XD5,0X4F,0XBC,0X8C,0X9B,0XC9,0X7A,0X67,0X72,0XA5,0X51,0X47,0X6A,
-0X0A,0X8B,0XAC,0XA3,0XF1,0XCC,0X53,0XD5,0XB4,0XDD,0XB4,0XDD,0X94,0XD5,0X73,0XD5,
-0X74,0XD5,0X94,0XD5,0X94,0XD5,0X93,0XD5,0X73,0XCD,0X32,0XC5,0XD0,0XBC,0X4F,0XA4,
-0X48,0X52,0X45,0X29,0XC3,0X20,0X62,0X10,0X20,0X00,0X00,0X00,0X20,0X08,0X41,0X08,
-0X61,0X08,0X41,0X08,0X61,0X10,0X62,0X10,0XA2,0X18,0XC3,0X18,0XA2,0X18,0XA2,0X18,
-0XC3,0X18,0XC3,0X18,0XC2,0X18,0XE3,0X20,0XA2,0X18,0X86,0X31,0X85,0X31,0X85,0X31,
-0X28,0X4A,0X4D,0X6B,0X10,0X84,0X0C,0X63,0XAA,0X5A,0X04,0X21,0X86,0X39,0X96,0XB5,
-0X92,0X8C,0X2C,0X6B,0X2C,0X6B,0X2C,0X6B,0X8A,0X52,0X8A,0X5A,0X71,0X8C,0X10,0X7C,
-0X30,0X84,0XF4,0X9C,0XB3,0X94,0X14,0X9D,0X34,0XA5,0X14,0X9D,0XF4,0X9C,0X14,0X9D,
-0X14,0X9D,0X14,0X9D,0XD3,0X94,0XF4,0X9C,0XD3,0X94,0XD3,0X94,0XB3,0X94,0XB3,0X94,
-0X92,0X8C,0X92,0X8C,0X51,0X84,0X30,0X84,0X72,0X8C,0X30,0X84,0X51,0X84,0X51,0X84,
-0X31,0X84,0X10,0X84,0X10,0X84,0XF0,0X7B,0XF0,0X7B,0XF0,0X7B,0XCF,0X7B,0XCF,0X7B,
-0XAF,0X73,0XAE,0X73,0X8E,0X73,0X8E,0X73,0X8E,0X6B,0X6E,0X6B,0X6D,0X6B,0X6D,0X6B,
-0XEC,0X5A,0X0C,0X5B,0X0C,0X63,0X0C,0X63,0X0C,0X63,0X0C,0X63,0X2D,0X63,0X4D,0X63,
-0X4D,0X63,0X4D,0X63,0X6D,0X6B,0X6D,0X6B,0X6E,0X6B,0X6E,0X6B,0X8E,0X6B,0X8E,0X6B,
-0XAF,0X73,0XAF,0X73,0XAF,0X73,0XCF,0X73,0XCF,0X7B,0XF0,0X7B,0XF0,0X7B,0XF0,0X7B,
-0X10,0X7C,0X11,0X84,0X31,0X84,0X51,0X84,0X51,0X84,0X71,0X8C,0X72,0X8C,0X72,0X8C,
-0X92,0X8C,0X92,0X8C,0XB2,0X94,0XB3,0X94,0XD3,0X94,0XD3,0X94,0XD3,0X94,0XF3,0X94,
-0XCF,0X7B,0XEF,0X7B,0X65,0X31,0X04,0X21,0XC2,0X18,0XA2,0X18,0XC3,0X18,0XE3,0X20,
-0X03,0X21,0XE3,0X20,0XE3,0X20,0XE3,0X20,0XE3,0X20,0XA2,0X18,0XA2,0X18,0XC3,0X18,
-0XC3,0X18,0XC2,0X18,0XA2,0X18,0XA2,0X20,0XA2,0X18,0X24,0X31,0XA9,0X72,0XC9,0X7A,
-0XA6,0X51,0X44,0X39,0X81,0X10,0X62,0X10,0XE8,0X41,0X65,0X31,0X61,0X10,0X41,0X10,
-0XC3,0X20,0XC9,0X72,0XED,0XAB,0X16,0XE6,0X58,0XEE,0X16,0XE6,0XD5,0XDD,0X73,0XD5,
-0X73,0XD5,0XD4,0XDD,0X37,0XEE,0X98,0XEE,0XD9,0XF6,0XFA,0XF6,0XD9,0XF6,0X98,0XEE,
-0X57,0XEE,0XF6,0XE5,0XB5,0XDD,0XD5,0XDD,0X17,0XE6,0X17,0XE6,0X16,0XE6,0X15,0XE6,
-0X4E,0XBC,0X88,0X72,0X44,0X31,0X24,0X29,0X24,0X29,0X03,0X21,0XE3,0X20,0XA2,0X18,
-0X03,0X31,0XE6,0X51,0X47,0X6A,0X2A,0X93,0X6F,0XC4,0XF1,0XCC,0X32,0XCD,0X32,0XCD,
-0X93,0XD5,0XB4,0XD5,0XB4,0XDD,0XB4,0XD5,0X93,0XD5,0X52,0XCD,0XF1,0XBC,0X6F,0XAC,
-0X08,0X4A,0X04,0X29,0XC3,0X18,0X82,0X10,0X41,0X08,0X00,0X00,0X20,0X00,0X61,0X08,
-0X62,0X10,0X41,0X08,0X82,0X10,0X82,0X10,0XA2,0X18,0XC3,0X18,0XC3,0X18,0XC3,0X18,
-0XA2,0X18,0XE3,0X20,0XC3,0X18,0XC3,0X20,0XE3,0X20,0X86,0X31,0X65,0X31,0XA6,0X39,
-0X44,0X29,0X2C,0X63,0X8E,0X73,0XD3,0X94,0X4D,0X6B,0X08,0X42,0X24,0X29,0XAA,0X5A,
-0X75,0XAD,0X31,0X84,0X52,0X8C,0X2D,0X63,0X51,0X8C,0X0C,0X63,0X07,0X42,0X71,0X8C,
-0X92,0X94,0X51,0X8C,0XF3,0X9C,0XF4,0X9C,0XF4,0X9C,0XB3,0X94,0X14,0X9D,0X34,0XA5,
-0X14,0X9D,0XF3,0X9C,0X14,0X9D,0XF4,0X9C,0XF4,0X9C,0XF3,0X9C,0XD3,0X94,0X92,0X8C,
-0X92,0X8C,0X72,0X8C,0X92,0X8C,0X92,0X8C,0X51,0X84,0X30,0X84,0X51,0X8C,0X51,0X84,
-0X31,0X84,0X31,0X84,0X30,0X7C,0XF0,0X7B,0XF0,0X7B,0XF0,0X7B,0XEF,0X73,0XCF,0X73,
-0XAF,0X73,0XAE,0X73,0XAE,0X73,0X8E,0X73,0X8E,0X6B,0X8E,0X6B,0X6E,0X6B,0X6D,0X6B,
-0XEC,0X5A,0XEC,0X5A,0X0C,0X63,0X0C,0X63,0X2C,0X63,0X2C,0X63,0X2D,0X63,0X4D,0X63,
-0X4D,0X63,0X4D,0X63,0X6D,0X6B,0X6D,0X6B,0X6E,0X6B,0X8E,0X6B,0X8E,0X6B,0XAF,0X73,
-0XAF,0X73,0XAF,0X73,0XCF,0X73,0XCF,0X73,0XEF,0X7B,0XF0,0X7B,0X10,0X7C,0X10,0X7C,
-0X10,0X7C,0X31,0X84,0X31,0X84,0X51,0X84,0X71,0X8C,0X71,0X8C,0X72,0X8C,0X92,0X8C,
-0X92,0X8C,0XB3,0X94,0XB3,0X94,0XB3,0X94,0XD3,0X94,0XD3,0X94,0XF4,0X9C,0XD3,0X94,
-0X30,0X84,0X8E,0X73,0XA6,0X39,0XE3,0X20,0XA2,0X18,0X82,0X10,0XC3,0X18,0X04,0X21,
-0X03,0X21,0XC2,0X18,0XC3,0X20,0XE3,0X20,0XE3,0X20,0X82,0X10,0XC3,0X20,0XE3,0X20,
-0XE3,0X20,0XC2,0X20,0X81,0X18,0XA2,0X20,0XC2,0X20,0X85,0X41,0X68,0X62,0XA6,0X49,
-0X03,0X29,0XA3,0X18,0XA6,0X49,0XD2,0XA4,0X9A,0XDE,0X24,0X31,0X40,0X10,0XB0,0X73,
-0XED,0X5A,0X20,0X08,0X44,0X39,0XED,0XA3,0XD5,0XDD,0XF6,0XDD,0X17,0XE6,0XB5,0XD5,
-0X73,0XD5,0XB4,0XDD,0X57,0XE6,0XB9,0XEE,0XFA,0XF6,0X1A,0XF7,0XFA,0XF6,0XB9,0XEE,
-0X57,0XEE,0X15,0XE6,0XF6,0XE5,0X16,0XE6,0X16,0XE6,0X16,0XE6,0XD5,0XE5,0XCD,0XA3,
-0X47,0X62,0X29,0X4A,0X04,0X29,0XA2,0X18,0X17,0X9D,0XE8,0X41,0X81,0X18,0X08,0X4A,
-0X6A,0X52,0XA2,0X18,0XE3,0X28,0XE6,0X59,0XEA,0X82,0XAC,0XA3,0X2E,0XB4,0XF1,0XC4,
-0X93,0XD5,0XD5,0XDD,0XF5,0XDD,0XD4,0XDD,0XB4,0XD5,0X53,0XCD,0XF1,0XC4,0X4F,0XAC,
-0X28,0X52,0XE4,0X20,0XA3,0X18,0X82,0X10,0X41,0X08,0X00,0X00,0X20,0X00,0X82,0X10,
-0XA2,0X10,0X61,0X10,0X82,0X10,0XA3,0X18,0XA2,0X18,0XC3,0X18,0XE3,0X20,0XA2,0X18,
-0XC3,0X18,0XE3,0X18,0XE3,0X20,0XC3,0X18,0XC3,0X18,0X04,0X21,0X86,0X31,0X86,0X31,
-0X44,0X29,0XAA,0X5A,0X8E,0X73,0X96,0XB5,0XAE,0X73,0X2C,0X63,0XA6,0X39,0XC6,0X39,
-0XAE,0X73,0X30,0X84,0XAE,0X73,0X35,0XA5,0X0B,0X63,0X30,0X8C,0X10,0X84,0X28,0X4A,
-0X51,0X8C,0X92,0X94,0X92,0X94,0X31,0X84,0XD3,0X9C,0XF4,0X9C,0X92,0X8C,0XB2,0X94,
-0XD3,0X9C,0X14,0X9D,0XF4,0X9C,0XD3,0X94,0XB3,0X94,0XB3,0X94,0XB3,0X94,0XB3,0X94,
-0XB3,0X94,0XB3,0X94,0X92,0X8C,0X92,0X8C,0X71,0X8C,0X51,0X84,0X51,0X84,0X51,0X84,
-0X51,0X84,0X31,0X84,0X10,0X7C,0X10,0X7C,0X10,0X7C,0XF0,0X7B,0XF0,0X7B,0XCF,0X7B,
-0XCF,0X7B,0XAF,0X73,0XAE,0X73,0X8E,0X73,0X8E,0X73,0X8E,0X6B,0X6E,0X6B,0X6E,0X6B,
-0X0C,0X5B,0X0C,0X5B,0X0C,0X63,0X0C,0X63,0X2C,0X63,0X2C,0X63,0X2D,0X63,0X4D,0X63,
-0X4D,0X63,0X6D,0X6B,0X6D,0X6B,0X6D,0X6B,0X8E,0X6B,0X8E,0X6B,0X8E,0X6B,0XAF,0X73,
-0XAF,0X73,0XCF,0X73,0XCF,0X73,0XCF,0X73,0XF0,0X7B,0XF0,0X7B,0X10,0X7C,0X10,0X7C,
-0X30,0X84,0X31,0X84,0X51,0X84,0X51,0X84,0X72,0X8C,0X72,0X8C,0X92,0X8C,0X92,0X8C,
-0XB2,0X94,0XB3,0X94,0XD3,0X94,0XD3,0X94,0XD3,0X94,0XF4,0X9C,0X14,0X9D,0X31,0X84,
-0X72,0X8C,0XCA,0X5A,0XC7,0X39,0X24,0X29,0XA2,0X18,0XC2,0X18,0XC2,0X18,0X04,0X29,
-0X03,0X21,0XE3,0X20,0XC3,0X20,0XC3,0X20,0XE3,0X20,0XA2,0X18,0XE3,0X20,0XC3,0X20,
-0XC3,0X20,0XA2,0X20,0XA2,0X18,0XA2,0X20,0XC2,0X20,0X28,0X5A,0X89,0X6A,0XE6,0X51,
-0X44,0X31,0XE7,0X59,0XEF,0X9B,0X79,0XD6,0X58,0XCE,0XC2,0X20,0XA2,0X28,0XE4,0X18,
-0X04,0X21,0X81,0X18,0XC7,0X41,0XEF,0X83,0X6F,0XAC,0X16,0XE6,0X17,0XE6,0X16,0XE6,
-0XB4,0XDD,0XD4,0XDD,0X57,0XE6,0XB9,0XEE,0X1A,0XF7,0X3B,0XFF,0X1A,0XF7,0XD9,0XF6,
-0X78,0XEE,0X57,0XEE,0X57,0XE6,0X37,0XE6,0XF6,0XE5,0XD5,0XDD,0XB0,0XC4,0X48,0X62,
-0X4D,0X73,0X39,0XC6,0XC2,0X20,0X81,0X18,0XE9,0X39,0XC3,0X20,0XC2,0X20,0XA6,0X41,
-0XDB,0XDE,0X30,0X9C,0X89,0X6A,0X85,0X49,0XC6,0X49,0X89,0X72,0X8C,0XA3,0X11,0XCD,
-0XB5,0XDD,0X16,0XE6,0XF5,0XDD,0XD4,0XDD,0XD4,0XDD,0X53,0XCD,0XF1,0XC4,0X4F,0XAC,
-0X28,0X52,0XA3,0X18,0XC3,0X20,0X04,0X21,0X41,0X08,0X21,0X08,0X20,0X00,0X82,0X10,
-0XC3,0X18,0X82,0X10,0XA3,0X18,0XC3,0X18,0XC3,0X18,0XC3,0X18,0XC3,0X18,0XC3,0X18,
-0XA2,0X18,0XE3,0X20,0XE3,0X20,0XE3,0X20,0XA2,0X18,0XE3,0X20,0XA6,0X39,0X08,0X42,
-0X65,0X31,0X08,0X42,0XF0,0X7B,0XD3,0X9C,0XD3,0X9C,0X6D,0X73,0XAB,0X5A,0X48,0X4A,
-0X0C,0X63,0XB2,0X94,0XAE,0X73,0XB2,0X94,0XF4,0X9C,0X8A,0X52,0XCF,0X7B,0XCF,0X7B,
-0X49,0X52,0XF0,0X7B,0X72,0X8C,0XF4,0X9C,0XD3,0X9C,0XD3,0X9C,0XF4,0X9C,0XF4,0X9C,
-0XD3,0X9C,0XD3,0X94,0X14,0X9D,0X14,0X9D,0X14,0X9D,0XF4,0X9C,0XF3,0X9C,0XD3,0X94,
-0XB3,0X94,0XB3,0X94,0XB2,0X94,0X92,0X8C,0X71,0X8C,0X51,0X84,0X72,0X8C,0X51,0X84,
-0X51,0X84,0X10,0X7C,0X30,0X84,0X30,0X84,0X10,0X7C,0X10,0X7C,0XF0,0X7B,0XEF,0X7B,
-0XCF,0X7B,0XCF,0X7B,0XAE,0X73,0XAE,0X73,0X8E,0X73,0X8E,0X73,0X6E,0X6B,0X6E,0X6B,
-0XEC,0X5A,0X0C,0X63,0X0C,0X5B,0X2C,0X63,0X2D,0X63,0X2C,0X63,0X4D,0X63,0X4D,0X63,
-0X4D,0X63,0X6D,0X6B,0X6D,0X6B,0X6E,0X6B,0X8E,0X6B,0X8E,0X6B,0XAF,0X73,0XAF,0X73,
-0XCF,0X73,0XCF,0X73,0XCF,0X73,0XEF,0X7B,0XF0,0X7B,0X10,0X7C,0X10,0X7C,0X31,0X84,
-0X31,0X84,0X31,0X84,0X51,0X84,0X71,0X8C,0X72,0X8C,0X92,0X8C,0X92,0X8C,0XB2,0X94,
-0XB3,0X94,0XB3,0X94,0XD3,0X94,0XD3,0X94,0XF4,0X9C,0X14,0X9D,0X72,0X8C,0XB3,0X94,
-0X92,0X8C,0X48,0X52,0X86,0X31,0XE3,0X20,0XA2,0X18,0X04,0X21,0XC3,0X20,0X24,0X29,
-0XE3,0X20,0XE3,0X20,0XE3,0X20,0XC3,0X20,0XE3,0X20,0XA3,0X18,0XE3,0X20,0XE3,0X28,
-0XC2,0X20,0XC3,0X20,0XA2,0X18,0XC2,0X20,0XC2,0X20,0XC9,0X72,0X8C,0X93,0X4B,0X8B,
-0XC6,0X59,0X64,0X49,0XEA,0X8A,0XF7,0XD5,0X3C,0XEF,0X85,0X39,0XA2,0X20,0XCB,0X62,
-0X0C,0X6B,0X40,0X18,0XAF,0X7B,0XDA,0XDE,0X2C,0X83,0XB4,0XDD,0X98,0XEE,0X78,0XEE,
-0XF5,0XDD,0XF4,0XDD,0X36,0XE6,0XB9,0XEE,0X1B,0XF7,0X5B,0XFF,0X3B,0XFF,0XFA,0XF6,
-0XB9,0XF6,0X98,0XEE,0X78,0XEE,0X78,0XEE,0X16,0XE6,0XD4,0XDD,0X0A,0X8B,0X4C,0X93,
-0X38,0XCE,0X3C,0XDF,0XE3,0X28,0X81,0X20,0XF5,0X9C,0X44,0X31,0XC2,0X28,0X29,0X4A,
-0X3D,0XE7,0X2F,0XB4,0X88,0X82,0XEA,0X82,0X4B,0X8B,0XED,0XAB,0XD1,0XC4,0X93,0XD5,
-0X15,0XE6,0X15,0XE6,0X15,0XE6,0XD5,0XDD,0XD4,0XDD,0X73,0XD5,0XF1,0XC4,0X0E,0XA4,
-0X27,0X52,0XA2,0X18,0XE3,0X20,0X44,0X29,0X61,0X08,0X41,0X08,0X21,0X08,0X62,0X10,
-0XA3,0X18,0XC3,0X18,0XC3,0X18,0XC3,0X18,0XC3,0X18,0XE3,0X20,0XC3,0X18,0XC3,0X18,
-0XE3,0X20,0XC3,0X18,0XC3,0X18,0XE3,0X20,0XE3,0X20,0XA2,0X18,0X65,0X31,0X28,0X4A,
-0X24,0X29,0X86,0X31,0X2C,0X63,0X51,0X8C,0X92,0X94,0X10,0X7C,0X2C,0X63,0XE7,0X39,
-0X0C,0X6B,0XB2,0X94,0X92,0X94,0X14,0XA5,0XD3,0X9C,0XF4,0X9C,0XCA,0X5A,0X8E,0X7B,
-0X8E,0X73,0XEB,0X62,0X72,0X94,0X91,0X8C,0XD3,0X9C,0XF4,0X9C,0X14,0X9D,0X55,0XA5,
-0XF4,0X9C,0X35,0XA5,0XD3,0X94,0X14,0X9D,0X14,0X9D,0XF4,0X9C,0XF4,0X9C,0XF3,0X9C,
-0XD3,0X94,0XD3,0X94,0XB2,0X94,0X71,0X8C,0X92,0X8C,0X72,0X8C,0X72,0X8C,0X72,0X8C,
-0X10,0X7C,0X31,0X84,0X51,0X84,0X31,0X84,0X10,0X7C,0X10,0X7C,0X10,0X7C,0XF0,0X7B,
-0XF0,0X7B,0XCF,0X73,0XCF,0X73,0XAF,0X73,0XAE,0X73,0X8E,0X73,0X6E,0X6B,0X8E,0X73,
-0X0C,0X5B,0X0C,0X63,0X2C,0X63,0X2C,0X63,0X2D,0X63,0X4D,0X63,0X4D,0X63,0X4D,0X63,
-0X6D,0X6B,0X6D,0X6B,0X6E,0X6B,0X8E,0X6B,0X8E,0X6B,0XAE,0X73,0XAF,0X73,0XAF,0X73,
-0XCF,0X73,0XCF,0X73,0XEF,0X7B,0XF0,0X7B,0X10,0X7C,0X10,0X7C,0X30,0X84,0X31,0X84,
-0X31,0X84,0X51,0X84,0X51,0X84,0X72,0X8C,0X92,0X8C,0X92,0X8C,0X92,0X8C,0XB3,0X94,
-0XB3,0X94,0XD3,0X94,0XD3,0X94,0XF4,0X9C,0XF4,0X9C,0XD3,0X94,0XD3,0X94,0X51,0X8C,
-0XD3,0X94,0XC6,0X39,0X45,0X29,0XE3,0X20,0XA2,0X18,0XC3,0X20,0XE3,0X20,0X04,0X29,
-0XE3,0X20,0X24,0X29,0XE3,0X28,0XC3,0X20,0XA2,0X18,0XA2,0X18,0XE3,0X20,0XE3,0X20,
-0XE3,0X20,0XC3,0X20,0XA2,0X18,0XC3,0X20,0XE2,0X20,0X0A,0X7B,0XED,0XA3,0XCD,0XA3,
-0X88,0X7A,0XC6,0X61,0X27,0X6A,0X0A,0X93,0X75,0XC5,0XD7,0XBD,0XE3,0X28,0X61,0X18,
-0X61,0X18,0XE7,0X49,0X58,0XD6,0X74,0XCD,0XC9,0X8A,0XE9,0X8A,0X3B,0XFF,0XD9,0XEE,
-0X36,0XE6,0X15,0XE6,0X56,0XE6,0XB9,0XEE,0X3B,0XF7,0X7C,0XFF,0X5B,0XFF,0XFA,0XF6,
-0XB9,0XF6,0XB9,0XF6,0XB9,0XF6,0X98,0XEE,0X57,0XEE,0X2E,0XB4,0XAD,0XAB,0X6C,0XB3,
-0XF6,0XCD,0X3C,0XE7,0X72,0X94,0X61,0X18,0XE2,0X28,0XC1,0X20,0X81,0X18,0XB2,0XA4,
-0X90,0XBC,0X0A,0X93,0XE9,0X8A,0X4B,0X9B,0XB0,0XCC,0X73,0XDD,0X16,0XDE,0X37,0XE6,
-0X16,0XE6,0X36,0XE6,0X15,0XE6,0XF5,0XDD,0XD4,0XDD,0X73,0XD5,0XD1,0XBC,0X2F,0XAC,
-0XE7,0X49,0XC3,0X18,0XA2,0X18,0X61,0X10,0X81,0X10,0X61,0X08,0X20,0X08,0X62,0X10,
-0XC3,0X18,0XA2,0X10,0XC3,0X18,0XC3,0X18,0XC3,0X18,0XC3,0X18,0XC2,0X18,0XC3,0X18,
-0XA2,0X18,0X04,0X21,0X04,0X21,0XE3,0X18,0XC3,0X18,0XC3,0X18,0X65,0X31,0XE7,0X41,
-0XA6,0X39,0X45,0X29,0XEB,0X62,0XAF,0X73,0XF3,0X9C,0XD3,0X9C,0X4D,0X6B,0X86,0X39,
-0X4D,0X6B,0X30,0X8C,0X72,0X8C,0X72,0X8C,0X55,0XA5,0XF7,0XB5,0X14,0X9D,0XAA,0X5A,
-0X6D,0X73,0XEB,0X62,0XAE,0X7B,0X0F,0X7C,0X35,0XA5,0X92,0X8C,0XF4,0X9C,0X14,0X9D,
-0X55,0XA5,0XF4,0X9C,0X34,0XA5,0XD3,0X94,0X14,0X9D,0X14,0X9D,0XF4,0X9C,0XF4,0X9C,
-0XD3,0X94,0X92,0X8C,0X92,0X8C,0XB3,0X94,0X72,0X8C,0X92,0X8C,0X72,0X8C,0X51,0X84,
-0X51,0X84,0X31,0X84,0X31,0X84,0X31,0X84,0X10,0X7C,0X10,0X7C,0X10,0X7C,0XF0,0X7B,
-0XF0,0X7B,0XCF,0X73,0XCF,0X73,0XAF,0X73,0XAF,0X73,0X8E,0X73,0X8E,0X73,0X8E,0X73,
-0X0C,0X5B,0X0C,0X5B,0X2C,0X63,0X2C,0X63,0X2C,0X63,0X2D,0X63,0X4D,0X6B,0X6D,0X6B,
-0X6D,0X6B,0X6D,0X6B,0X6E,0X6B,0X8E,0X6B,0X8E,0X6B,0XAE,0X73,0XAF,0X73,0XAF,0X73,
-0XCF,0X73,0XEF,0X7B,0XF0,0X7B,0XF0,0X7B,0X10,0X7C,0X10,0X7C,0X30,0X84,0X31,0X84,
-0X51,0X84,0X51,0X84,0X72,0X8C,0X72,0X8C,0X92,0X8C,0X92,0X8C,0X93,0X94,0XB3,0X94,
-0XD3,0X94,0XD3,0X94,0XF4,0X9C,0XF4,0X9C,0X14,0X9D,0XB2,0X94,0XF4,0X9C,0X51,0X84,
-0X71,0X8C,0XC7,0X41,0X45,0X29,0X04,0X21,0XA2,0X18,0XC3,0X18,0XC3,0X20,0X24,0X29,
-0XE3,0X20,0XE3,0X20,0XE3,0X28,0XC2,0X18,0XA2,0X18,0XC2,0X18,0X03,0X29,0X04,0X29,
-0XE3,0X28,0XC3,0X20,0XC2,0X20,0XA2,0X20,0X23,0X29,0X2B,0X83,0X2E,0XAC,0X6F,0XB4,
-0XED,0XAB,0X88,0X7A,0XA9,0X82,0XCA,0X8A,0X6C,0XA3,0X0E,0XAC,0X2F,0XAC,0XCE,0X93,
-0X50,0XAC,0X13,0XC5,0X90,0XBC,0X90,0XBC,0XF3,0XC4,0X70,0XAC,0X57,0XEE,0XFA,0XF6,
-0X57,0XEE,0X36,0XE6,0X37,0XE6,0XB9,0XEE,0X3B,0XFF,0X7C,0XFF,0X5C,0XFF,0XFA,0XF6,
-0XD9,0XF6,0XD9,0XF6,0XF9,0XF6,0XB9,0XEE,0X77,0XF6,0XAC,0XA3,0XCD,0XB3,0XAD,0XAB,
-0X8C,0XA3,0XD1,0XC4,0X53,0XC5,0X4C,0X83,0X6A,0X62,0XEB,0X72,0X8D,0X93,0XF1,0XCC,
-0XED,0XB3,0X4B,0X9B,0X6B,0XA3,0X90,0XC4,0X73,0XD5,0XD5,0XDD,0X37,0XE6,0X37,0XE6,
-0X36,0XE6,0X36,0XE6,0X16,0XE6,0XF5,0XDD,0XB4,0XDD,0X73,0XD5,0XD0,0XBC,0XCD,0X9B,
-0XC6,0X41,0X65,0X31,0X41,0X10,0X61,0X18,0X20,0X08,0X41,0X08,0X41,0X08,0X61,0X10,
-0XC3,0X18,0XC3,0X18,0XA3,0X18,0XC3,0X18,0XC3,0X18,0XC3,0X18,0XE3,0X20,0XE3,0X20,
-0XE3,0X20,0XC2,0X18,0X24,0X29,0XC3,0X18,0XC3,0X20,0XA2,0X18,0X24,0X29,0X48,0X4A,
-0X08,0X42,0X44,0X29,0X2C,0X6B,0XEB,0X62,0X51,0X8C,0X14,0XA5,0X8E,0X73,0X08,0X42,
-0X0C,0X63,0X6E,0X6B,0XD3,0X94,0XF3,0X9C,0X92,0X94,0X35,0XA5,0XB7,0XB5,0X35,0XA5,
-0XCB,0X5A,0XEB,0X62,0X0C,0X63,0X4D,0X6B,0X51,0X8C,0X55,0XAD,0XB3,0X94,0XF4,0X9C,
-0X14,0X9D,0X34,0X9D,0XF4,0X9C,0X14,0X9D,0XF4,0X9C,0X14,0X9D,0XF3,0X9C,0XD3,0X94,
-0XB2,0X94,0XD3,0X94,0XD3,0X94,0X92,0X8C,0X72,0X8C,0X72,0X8C,0X72,0X8C,0X92,0X8C,
-0X72,0X8C,0X51,0X84,0X51,0X84,0X31,0X84,0X31,0X84,0X10,0X7C,0X10,0X7C,0X10,0X7C,
-0XF0,0X7B,0XF0,0X7B,0XCF,0X73,0XCF,0X7B,0XAF,0X73,0XAF,0X73,0X8E,0X73,0X8E,0X73,
-0X0C,0X63,0X0C,0X63,0X2C,0X63,0X2C,0X63,0X4D,0X63,0X4D,0X6B,0X4D,0X6B,0X6D,0X6B,
-0X6D,0X6B,0X6E,0X6B,0X8E,0X6B,0X8E,0X6B,0XAE,0X73,0XAF,0X73,0XAF,0X73,0XCF,0X73,
-0XCF,0X73,0XEF,0X7B,0XF0,0X7B,0X10,0X7C,0X10,0X7C,0X10,0X7C,0X31,0X84,0X51,0X84,
-0X51,0X84,0X51,0X84,0X72,0X8C,0X72,0X8C,0X92,0X8C,0XB2,0X94,0XB3,0X94,0XB3,0X94,
-0XD3,0X94,0XD3,0X94,0XF4,0X9C,0X14,0X9D,0X92,0X8C,0X35,0XA5,0XD3,0X94,0X51,0X8C,
-0X10,0X84,0X08,0X42,0X65,0X31,0XA2,0X18,0XC3,0X18,0XA2,0X18,0X03,0X21,0XE3,0X20,
-0XC2,0X18,0XE3,0X20,0XC3,0X20,0XA2,0X18,0XA2,0X18,0XC2,0X18,0X03,0X29,0X24,0X29,
-0XE3,0X28,0XC2,0X20,0XC2,0X20,0XA2,0X20,0X44,0X31,0X4B,0X8B,0X8F,0XB4,0XB0,0XBC,
-0XB0,0XBC,0X2E,0XB4,0X8B,0XA3,0XAC,0XAB,0XAC,0XAB,0XEE,0XB3,0XD2,0XCC,0XB1,0XC4,
-0X95,0XD5,0X74,0XD5,0X53,0XD5,0X73,0XD5,0X17,0XE6,0X37,0XE6,0X77,0XEE,0XD9,0XF6,
-0X77,0XEE,0X36,0XE6,0X36,0XE6,0XD9,0XF6,0X5B,0XFF,0X9D,0XFF,0X5C,0XFF,0X1A,0XF7,
-0XF9,0XF6,0XF9,0XF6,0XF9,0XEE,0XFA,0XF6,0X77,0XEE,0X15,0XE6,0X94,0XDD,0XF2,0XCC,
-0X12,0XCD,0X33,0XCD,0X74,0XDD,0X33,0XD5,0XB5,0XDD,0XF6,0XE5,0X33,0XD5,0X4F,0XBC,
-0X70,0XC4,0X90,0XC4,0XF1,0XCC,0XB4,0XDD,0X16,0XE6,0X36,0XE6,0X37,0XE6,0X37,0XE6,
-0X57,0XE6,0X36,0XE6,0X36,0XE6,0XF5,0XE5,0XB4,0XDD,0X53,0XCD,0XB0,0XBC,0XAD,0X93,
-0XE6,0X41,0XA5,0X41,0X24,0X29,0XA5,0X41,0X44,0X31,0X41,0X08,0X62,0X10,0X41,0X08,
-0XC3,0X18,0XA3,0X18,0XC3,0X18,0XC3,0X18,0XE3,0X20,0XC3,0X18,0XA2,0X18,0XC2,0X18,
-0XC3,0X18,0XC2,0X18,0XE3,0X20,0XE3,0X20,0XC3,0X18,0XC3,0X20,0XC3,0X20,0X85,0X31,
-0X6A,0X52,0XCB,0X5A,0XE7,0X39,0X4D,0X6B,0XAE,0X7B,0X14,0X9D,0X51,0X8C,0X4D,0X6B,
-0X08,0X42,0X6E,0X73,0XF4,0X9C,0X14,0XA5,0X55,0XA5,0X14,0X9D,0XB6,0XAD,0X18,0XB6,
-0X97,0XAD,0XCB,0X5A,0XAA,0X5A,0X4D,0X6B,0X10,0X84,0X72,0X8C,0X35,0XA5,0XB3,0X94,
-0XB3,0X94,0XB3,0X94,0XD4,0X9C,0XD3,0X94,0XB2,0X94,0X92,0X8C,0XD3,0X9C,0XD3,0X94,
-0XD3,0X94,0X92,0X8C,0X92,0X8C,0X92,0X8C,0XB3,0X94,0XB3,0X94,0X92,0X8C,0X92,0X8C,
-0X72,0X8C,0X72,0X8C,0X51,0X84,0X51,0X84,0X31,0X84,0X30,0X84,0X10,0X7C,0X10,0X7C,
-0XF0,0X7B,0XF0,0X7B,0XCF,0X7B,0XCF,0X73,0XAF,0X73,0XAF,0X73,0XAE,0X73,0X8E,0X73,
-0X0C,0X63,0X0C,0X63,0X2C,0X63,0X4D,0X63,0X4D,0X63,0X6D,0X63,0X6D,0X63,0X6D,0X6B,
-0X6D,0X6B,0X6E,0X6B,0X8E,0X6B,0X8E,0X6B,0XAE,0X73,0XAF,0X73,0XAF,0X73,0XCF,0X73,
-0XCF,0X73,0XF0,0X7B,0XF0,0X7B,0X10,0X7C,0X10,0X7C,0X31,0X84,0X31,0X84,0X51,0X84,
-0X51,0X84,0X72,0X8C,0X92,0X8C,0X92,0X8C,0XB2,0X94,0XB2,0X94,0XB3,0X94,0XD3,0X94,
-0XF3,0X94,0XF4,0X9C,0X14,0X9D,0XD3,0X94,0XF4,0X9C,0X35,0XA5,0XD3,0X94,0X72,0X8C,
-0X8E,0X73,0XE7,0X41,0XA6,0X31,0XC3,0X20,0XA2,0X18,0XC3,0X18,0XE3,0X20,0XE3,0X20,
-0XE3,0X20,0X03,0X21,0XC3,0X20,0XC2,0X20,0XC2,0X18,0XA2,0X18,0X04,0X29,0X03,0X29,
-0XE3,0X28,0XC3,0X20,0XA2,0X18,0XA2,0X20,0X44,0X39,0X8C,0X93,0XB0,0XBC,0X11,0XCD,
-0X11,0XCD,0X12,0XCD,0XD1,0XC4,0XF1,0XCC,0XD1,0XCC,0XB1,0XCC,0X32,0XD5,0X74,0XD5,
-0X54,0XD5,0X54,0XD5,0X53,0XD5,0XB4,0XDD,0X37,0XE6,0X78,0XEE,0XB9,0XF6,0XB9,0XF6,
-0X97,0XEE,0X36,0XE6,0X57,0XE6,0XB9,0XEE,0X3B,0XFF,0X9D,0XFF,0X5C,0XFF,0XFA,0XF6,
-0XF9,0XF6,0XF9,0XF6,0X1A,0XF7,0X1B,0XF7,0XD9,0XF6,0XD9,0XEE,0X16,0XDE,0X33,0XD5,
-0XD1,0XCC,0X33,0XD5,0X74,0XD5,0X74,0XD5,0XD5,0XDD,0XD5,0XDD,0X53,0XD5,0X53,0XD5,
-0X53,0XD5,0XB4,0XDD,0XF5,0XE5,0X36,0XE6,0X37,0XE6,0X57,0XE6,0X57,0XEE,0X57,0XEE,
-0X36,0XEE,0X37,0XEE,0X36,0XE6,0XF6,0XE5,0X94,0XDD,0X53,0XCD,0X90,0XB4,0X4B,0X83,
-0XA6,0X41,0X23,0X31,0X4B,0X7B,0XA5,0X41,0X65,0X39,0X61,0X08,0X82,0X10,0X41,0X08,
-0XA2,0X10,0XA2,0X10,0XC3,0X18,0XC3,0X18,0XE3,0X20,0XE3,0X20,0XA2,0X18,0XC3,0X18,
-0XC3,0X18,0XE3,0X18,0XC3,0X18,0XE3,0X20,0XA3,0X18,0XC3,0X20,0XC3,0X20,0X24,0X29,
-0XE7,0X39,0X6E,0X6B,0X04,0X29,0X10,0X84,0XEB,0X62,0XB2,0X94,0XF3,0X9C,0X2D,0X6B,
-0X49,0X4A,0X6D,0X73,0X51,0X8C,0XD3,0X9C,0XB7,0XB5,0X55,0XAD,0X14,0X9D,0X76,0XAD,
-0XB7,0XB5,0X96,0XB5,0X8A,0X52,0XCF,0X7B,0XCB,0X5A,0X91,0X94,0X14,0X9D,0XF4,0X9C,
-0XB3,0X94,0X14,0XA5,0X35,0XA5,0X14,0X9D,0XD3,0X94,0XD3,0X9C,0XD3,0X9C,0XD3,0X94,
-0XB3,0X94,0XD3,0X94,0XF3,0X9C,0XD3,0X94,0XB3,0X94,0XB3,0X94,0X92,0X8C,0X92,0X8C,
-0X72,0X8C,0X72,0X8C,0X72,0X8C,0X51,0X84,0X51,0X84,0X31,0X84,0X30,0X84,0X10,0X7C,
-0X10,0X7C,0XF0,0X7B,0XF0,0X7B,0XCF,0X7B,0XCF,0X7B,0XCF,0X73,0XAF,0X73,0XAE,0X73,
-0X0C,0X63,0X2C,0X63,0X2C,0X63,0X2D,0X63,0X4D,0X63,0X4D,0X63,0X4D,0X6B,0X6E,0X6B,
-0X6E,0X6B,0X8E,0X6B,0X8E,0X6B,0XAE,0X73,0XAE,0X73,0XAF,0X73,0XCF,0X73,0XCF,0X73,
-0XEF,0X7B,0XF0,0X7B,0X10,0X7C,0X10,0X7C,0X31,0X84,0X31,0X84,0X51,0X84,0X51,0X84,
-0X51,0X84,0X72,0X8C,0X72,0X8C,0X92,0X8C,0X92,0X8C,0XB3,0X94,0XD3,0X94,0XD3,0X94,
-0XD3,0X94,0XF4,0X9C,0XF4,0X9C,0XB3,0X94,0X35,0XA5,0X14,0X9D,0X14,0X9D,0XB3,0X94,
-0XCB,0X5A,0X24,0X29,0X85,0X31,0XE3,0X20,0XA2,0X18,0XA2,0X18,0XE3,0X20,0XE3,0X20,
-0X04,0X29,0XE3,0X20,0XE3,0X20,0XC2,0X18,0XA2,0X18,0XA2,0X18,0X24,0X29,0X04,0X29,
-0XE3,0X20,0XE3,0X28,0XA2,0X18,0XA2,0X20,0X24,0X39,0XCD,0X9B,0XF1,0XC4,0X52,0XCD,
-0X73,0XD5,0X94,0XD5,0X94,0XDD,0XB4,0XDD,0XD4,0XDD,0XD4,0XDD,0XD5,0XDD,0XF5,0XE5,
-0XD5,0XDD,0XD6,0XDD,0X17,0XEE,0X57,0XE6,0X78,0XEE,0X78,0XEE,0XB9,0XF6,0XB9,0XF6,
-0X77,0XEE,0X56,0XE6,0X57,0XE6,0XB9,0XF6,0X5B,0XFF,0X7C,0XFF,0X5C,0XFF,0X1A,0XF7,
-0X1A,0XF7,0XFA,0XF6,0X1A,0XF7,0X1B,0XF7,0X1A,0XF7,0XD9,0XF6,0X78,0XEE,0X37,0XE6,
-0X37,0XE6,0XF6,0XDD,0X16,0XE6,0X16,0XE6,0X37,0XE6,0X37,0XEE,0X57,0XEE,0X36,0XE6,
-0X57,0XEE,0X56,0XEE,0X36,0XEE,0X57,0XEE,0X57,0XEE,0X57,0XEE,0X78,0XEE,0X57,0XEE,
-0X57,0XEE,0X37,0XEE,0X16,0XE6,0XF5,0XE5,0XB4,0XD5,0X32,0XC5,0X4F,0XAC,0XEA,0X72,
-0X85,0X41,0X2B,0X7B,0X0A,0X73,0XC6,0X49,0X85,0X39,0X61,0X08,0XC3,0X18,0XA2,0X10,
-0X82,0X10,0XA2,0X10,0XC3,0X18,0XC3,0X18,0XC3,0X18,0XC3,0X18,0XC3,0X18,0XE3,0X20,
-0XC3,0X20,0XC3,0X20,0XE3,0X20,0XE3,0X20,0XE3,0X20,0XC3,0X18,0XC2,0X18,0X03,0X21,
-0X85,0X31,0X2C,0X6B,0XA6,0X31,0XCF,0X7B,0XAA,0X52,0X72,0X94,0X92,0X94,0X6E,0X6B,
-0XAA,0X5A,0XCB,0X5A,0XCF,0X7B,0XB7,0XB5,0X96,0XB5,0X96,0XAD,0X76,0XAD,0X35,0XA5,
-0X76,0XAD,0X35,0XA5,0XB3,0X94,0X28,0X4A,0X2C,0X6B,0X8E,0X73,0X55,0XAD,0X14,0X9D,
-0X35,0XA5,0X14,0XA5,0X34,0X9D,0X75,0XAD,0X14,0X9D,0X14,0X9D,0X14,0X9D,0X14,0X9D,
-0X14,0X9D,0XF3,0X9C,0XD3,0X94,0XD3,0X94,0XD3,0X94,0XB3,0X94,0XB2,0X94,0X92,0X8C,
-0X92,0X8C,0X92,0X8C,0X72,0X8C,0X51,0X84,0X51,0X84,0X31,0X84,0X11,0X84,0X10,0X7C,
-0X10,0X7C,0XF0,0X7B,0XF0,0X7B,0XF0,0X7B,0XEF,0X7B,0XCF,0X73,0XAF,0X73,0XAE,0X73,
-0X0C,0X63,0X2C,0X63,0X2D,0X63,0X4D,0X63,0X4D,0X63,0X4D,0X63,0X6E,0X6B,0X6E,0X6B,
-0X6E,0X6B,0X8E,0X6B,0X8E,0X6B,0XAF,0X73,0XAF,0X73,0XAF,0X73,0XCF,0X73,0XEF,0X7B,
-0XF0,0X7B,0XF0,0X7B,0X10,0X7C,0X30,0X84,0X31,0X84,0X51,0X84,0X51,0X84,0X51,0X84,
-0X72,0X8C,0X72,0X8C,0X92,0X8C,0X92,0X8C,0XB3,0X94,0XB3,0X94,0XD3,0X94,0XD3,0X94,
-0XF4,0X9C,0X14,0X9D,0XD3,0X94,0XF4,0X9C,0X35,0XA5,0X14,0X9D,0XF4,0X9C,0X72,0X8C,
-0XCA,0X5A,0XC7,0X41,0X85,0X31,0XE3,0X20,0XA2,0X18,0XC3,0X20,0XE3,0X20,0X03,0X29,
-0XC3,0X20,0XE3,0X20,0XE3,0X20,0XC2,0X20,0XA2,0X18,0XC2,0X18,0X24,0X29,0X24,0X29,
-0XE3,0X20,0XE3,0X20,0XC2,0X20,0XA2,0X20,0X24,0X31,0XEE,0XA3,0XF1,0XC4,0X73,0XD5,
-0XB4,0XDD,0XF5,0XDD,0XF5,0XE5,0X16,0XE6,0X57,0XEE,0X57,0XEE,0X57,0XE6,0X57,0XEE,
-0X58,0XEE,0X57,0XEE,0X78,0XEE,0X98,0XEE,0X98,0XEE,0XB9,0XF6,0XB9,0XF6,0XB9,0XF6,
-0X77,0XEE,0X56,0XE6,0X37,0XE6,0XB9,0XF6,0X3B,0XFF,0X7C,0XFF,0X5B,0XFF,0X1A,0XF7,
-0XF9,0XF6,0XF9,0XF6,0X1A,0XF7,0X3B,0XF7,0X3B,0XFF,0X1A,0XFF,0XD9,0XF6,0XB9,0XEE,
-0X98,0XEE,0X98,0XEE,0X99,0XEE,0XB9,0XF6,0XD9,0XF6,0XD9,0XF6,0XB9,0XF6,0X98,0XF6,
-0X98,0XEE,0X78,0XEE,0X57,0XEE,0X57,0XEE,0X57,0XEE,0X78,0XEE,0X78,0XEE,0X78,0XEE,
-0X57,0XEE,0X37,0XEE,0X16,0XE6,0XF5,0XE5,0XB4,0XDD,0X12,0XC5,0X2F,0XA4,0X48,0X5A,
-0X88,0X62,0X0A,0X7B,0X06,0X52,0X68,0X62,0XC6,0X49,0X20,0X08,0XC3,0X18,0XC3,0X18,
-0X61,0X10,0X82,0X10,0XC3,0X18,0XC3,0X18,0XC3,0X18,0XC3,0X18,0XC3,0X18,0XC3,0X18,
-0XE3,0X20,0X04,0X21,0XA2,0X18,0XA2,0X18,0XA2,0X18,0X04,0X21,0XE3,0X20,0XE3,0X20,
-0XA6,0X39,0X8A,0X52,0XEB,0X5A,0X4D,0X6B,0XAE,0X73,0X10,0X84,0X31,0X84,0XCF,0X7B,
-0X28,0X4A,0X48,0X4A,0X8E,0X73,0X55,0XA5,0X55,0XAD,0XB7,0XB5,0XF7,0XBD,0X55,0XAD,
-0X96,0XAD,0X76,0XA5,0X96,0XAD,0X4D,0X6B,0XCB,0X62,0X8E,0X73,0X51,0X84,0X76,0XAD,
-0XD3,0X9C,0X55,0XAD,0X14,0X9D,0X35,0XA5,0X35,0XA5,0X14,0X9D,0X14,0X9D,0X14,0X9D,
-0X14,0X9D,0X14,0X9D,0XF4,0X9C,0XD3,0X94,0XB3,0X94,0XD3,0X94,0XB3,0X94,0XB2,0X94,
-0X92,0X8C,0X92,0X8C,0X72,0X8C,0X72,0X8C,0X51,0X84,0X51,0X84,0X31,0X84,0X31,0X84,
-0X10,0X7C,0X10,0X7C,0XF0,0X7B,0XF0,0X7B,0XCF,0X7B,0XCF,0X7B,0XAF,0X73,0XAF,0X73,
-0X2C,0X63,0X2C,0X63,0X4D,0X63,0X4D,0X63,0X4D,0X63,0X4D,0X6B,0X6D,0X6B,0X6E,0X6B,
-0X8E,0X6B,0X8E,0X6B,0XAE,0X73,0XAF,0X73,0XAF,0X73,0XCF,0X73,0XCF,0X73,0XEF,0X7B,
-0X10,0X7C,0X10,0X7C,0X10,0X7C,0X31,0X84,0X31,0X84,0X51,0X84,0X51,0X84,0X71,0X8C,
-0X72,0X8C,0X72,0X8C,0X92,0X8C,0XB2,0X94,0XB3,0X94,0XD3,0X94,0XD3,0X94,0XF4,0X9C,
-0XF4,0X9C,0XF4,0X9C,0XD3,0X94,0X15,0XA5,0X35,0XA5,0X35,0XA5,0XB3,0X94,0XD3,0X94,
-0X89,0X52,0XA7,0X39,0X85,0X31,0XC3,0X18,0XA2,0X18,0XE3,0X20,0X03,0X21,0XE3,0X20,
-0XC3,0X20,0XC3,0X20,0XC3,0X18,0XC2,0X18,0XE3,0X20,0XC2,0X18,0X24,0X29,0X04,0X29,
-0XE3,0X20,0XE3,0X28,0XC2,0X20,0X82,0X18,0X44,0X39,0XCD,0X9B,0X12,0XC5,0X94,0XD5,
-0XD5,0XE5,0XF6,0XE5,0X16,0XE6,0X57,0XEE,0X78,0XEE,0X78,0XEE,0X98,0XEE,0X98,0XEE,
-0X78,0XEE,0X98,0XEE,0X98,0XEE,0X99,0XF6,0XB9,0XF6,0XD9,0XF6,0XB9,0XF6,0X98,0XEE,
-0X77,0XEE,0X37,0XE6,0X57,0XE6,0XB9,0XEE,0X3B,0XFF,0X7C,0XFF,0X3B,0XF7,0X1A,0XF7,
-0XD9,0XF6,0XD9,0XF6,0X1A,0XF7,0X3A,0XF7,0X3B,0XFF,0X3B,0XFF,0X1A,0XF7,0XFA,0XF6,
-0XD9,0XF6,0XD9,0XF6,0XDA,0XF6,0XFA,0XFE,0XFA,0XF6,0XFA,0XF6,0XFA,0XF6,0XF9,0XF6,
-0XB9,0XF6,0X98,0XF6,0X98,0XF6,0X98,0XF6,0X78,0XEE,0X98,0XEE,0X78,0XEE,0X57,0XEE,
-0X57,0XEE,0X16,0XE6,0X16,0XE6,0XF5,0XE5,0X94,0XD5,0XF1,0XC4,0X0E,0XA4,0X07,0X52,
-0XEA,0X72,0X88,0X62,0XE9,0X72,0X68,0X62,0X20,0X08,0X61,0X10,0XA2,0X18,0XC3,0X18,
-0XC3,0X18,0XA2,0X10,0XA3,0X18,0XC3,0X18,0XC3,0X18,0XC3,0X18,0XC3,0X18,0XC2,0X18,
-0XC2,0X18,0XC3,0X20,0X04,0X21,0XC3,0X18,0XE3,0X20,0XA2,0X18,0XE3,0X20,0X04,0X21,
-0X45,0X29,0XEF,0X7B,0X28,0X4A,0X49,0X4A,0XB3,0X9C,0X8E,0X73,0XD3,0X9C,0X10,0X84,
-0XCB,0X5A,0X69,0X52,0XEC,0X62,0XD3,0X9C,0X18,0XBE,0X76,0XAD,0XD7,0XB5,0XD7,0XB5,
-0X96,0XAD,0X76,0XAD,0X76,0XAD,0X76,0XAD,0X28,0X4A,0X69,0X52,0X14,0X9D,0XB3,0X94,
-0X35,0XA5,0XF4,0X9C,0X55,0XA5,0X55,0XA5,0X14,0X9D,0X35,0XA5,0X14,0X9D,0X14,0X9D,
-0X14,0X9D,0XF4,0X9C,0XF4,0X9C,0XF4,0X9C,0XD3,0X94,0XB3,0X94,0XD3,0X94,0XB3,0X94,
-0X92,0X8C,0X92,0X8C,0X92,0X8C,0X72,0X8C,0X71,0X8C,0X51,0X84,0X51,0X84,0X31,0X84,
-0X10,0X7C,0X10,0X7C,0X10,0X7C,0XF0,0X7B,0XF0,0X7B,0XCF,0X7B,0XCF,0X7B,0XCF,0X73,
-0X2C,0X63,0X2C,0X63,0X4D,0X63,0X4D,0X63,0X6D,0X63,0X4D,0X6B,0X6E,0X6B,0X6E,0X6B,
-0X8E,0X6B,0X8E,0X6B,0X8E,0X6B,0XAF,0X73,0XAF,0X73,0XCF,0X73,0XF0,0X7B,0XF0,0X7B,
-0X10,0X7C,0X10,0X7C,0X10,0X7C,0X31,0X84,0X31,0X84,0X51,0X84,0X51,0X84,0X72,0X8C,
-0X72,0X8C,0X92,0X8C,0X92,0X8C,0XB3,0X94,0XB3,0X94,0XD3,0X94,0XF3,0X9C,0XF4,0X9C,
-0X14,0X9D,0XF3,0X9C,0X14,0X9D,0X35,0XA5,0X35,0XA5,0X35,0XA5,0XB2,0X94,0X14,0XA5,
-0X48,0X4A,0X8A,0X52,0X85,0X31,0XC2,0X18,0XA3,0X18,0XC2,0X18,0XE3,0X20,0XE3,0X20,
-0XE3,0X20,0XE3,0X20,0XC2,0X20,0XC3,0X20,0XE3,0X20,0XA2,0X18,0X24,0X29,0X04,0X29,
-0X04,0X29,0XE3,0X28,0XC2,0X20,0X82,0X18,0X24,0X31,0XCD,0XA3,0XF2,0XC4,0XB4,0XDD,
-0XF6,0XE5,0X16,0XE6,0X57,0XEE,0X78,0XEE,0X78,0XEE,0X98,0XF6,0XB9,0XF6,0XB9,0XF6,
-0XB9,0XF6,0XB9,0XF6,0XB9,0XF6,0XD9,0XF6,0XD9,0XF6,0XD9,0XF6,0XB9,0XF6,0X98,0XEE,
-0X57,0XE6,0X36,0XE6,0X57,0XE6,0X98,0XEE,0X3B,0XFF,0X5C,0XFF,0X3B,0XF7,0XFA,0XF6,
-0XF9,0XF6,0XB9,0XF6,0XF9,0XF6,0X3A,0XF7,0X3A,0XFF,0X3B,0XFF,0X3B,0XFF,0X1A,0XF7,
-0XFA,0XF6,0XFA,0XF6,0XFA,0XF6,0X1A,0XFF,0X1B,0XFF,0X1A,0XF7,0XFA,0XF6,0XFA,0XF6,
-0XD9,0XF6,0XB9,0XF6,0XB9,0XF6,0X99,0XF6,0X98,0XF6,0X98,0XF6,0X78,0XF6,0X78,0XF6,
-0X57,0XEE,0X37,0XEE,0XF6,0XE5,0XB5,0XDD,0X53,0XD5,0XB0,0XBC,0XAD,0X93,0X28,0X5A,
-0XEA,0X72,0XEA,0X7A,0X6B,0X8B,0X06,0X52,0X00,0X00,0X82,0X10,0X82,0X10,0XE3,0X18,
-0XC3,0X18,0X82,0X10,0XA2,0X10,0XC3,0X18,0X82,0X10,0XA2,0X18,0XC3,0X18,0XE3,0X20,
-0XC3,0X18,0XC3,0X18,0X04,0X29,0XE3,0X20,0XE3,0X20,0XE3,0X20,0XE3,0X20,0XE3,0X20,
-0X24,0X29,0XEB,0X5A,0XCB,0X5A,0XA6,0X39,0XEF,0X7B,0X55,0XAD,0X0C,0X63,0XB3,0X94,
-0X6D,0X6B,0XC6,0X41,0XAE,0X7B,0XEF,0X7B,0XB7,0XB5,0XD4,0X9C,0XF8,0XBD,0X96,0XAD,
-0XB7,0XB5,0X76,0XAD,0X35,0XA5,0X55,0XA5,0X14,0X9D,0XA6,0X39,0X51,0X8C,0X35,0XA5,
-0XF4,0X9C,0XB3,0X94,0X35,0XA5,0X55,0XA5,0X14,0X9D,0XF3,0X9C,0X35,0XA5,0X35,0XA5,
-0X14,0X9D,0X14,0X9D,0X14,0X9D,0XF4,0X9C,0XF4,0X9C,0XB3,0X94,0XD3,0X94,0XB3,0X94,
-0XB2,0X94,0X92,0X8C,0X92,0X8C,0X72,0X8C,0X72,0X8C,0X51,0X84,0X51,0X84,0X31,0X84,
-0X31,0X84,0X10,0X84,0X10,0X7C,0X10,0X7C,0XF0,0X7B,0XEF,0X7B,0XCF,0X7B,0XCF,0X73,
-0X2C,0X63,0X2C,0X63,0X4D,0X63,0X4D,0X63,0X4D,0X63,0X6E,0X6B,0X6E,0X6B,0X8E,0X6B,
-0X8E,0X6B,0XAE,0X73,0XAE,0X73,0XAF,0X73,0XCF,0X73,0XCF,0X73,0XEF,0X7B,0XF0,0X7B,
-0X10,0X7C,0X10,0X7C,0X30,0X84,0X31,0X84,0X51,0X84,0X51,0X84,0X72,0X8C,0X72,0X8C,
-0X92,0X8C,0X92,0X8C,0XB3,0X94,0XB3,0X94,0XD3,0X94,0XD4,0X94,0XF4,0X9C,0X14,0X9D,
-0XF4,0X9C,0XF4,0X9C,0X35,0XA5,0X55,0XA5,0X55,0XA5,0X14,0X9D,0XD3,0X94,0XF4,0X9C,
-0X28,0X4A,0X49,0X4A,0XC7,0X39,0XA2,0X18,0XA2,0X18,0XC2,0X18,0XE3,0X20,0X03,0X21,
-0XC2,0X20,0XE3,0X28,0XC2,0X20,0XC2,0X20,0XC2,0X18,0XA2,0X18,0X03,0X29,0X24,0X31,
-0XE3,0X28,0X04,0X29,0XC3,0X20,0X82,0X18,0X03,0X31,0XCD,0XA3,0XF1,0XC4,0X94,0XD5,
-0XF6,0XE5,0X57,0XEE,0X78,0XEE,0X78,0XF6,0X98,0XF6,0XB9,0XF6,0XB9,0XF6,0XB9,0XF6,
-0XD9,0XF6,0XD9,0XF6,0XD9,0XF6,0XF9,0XF6,0XFA,0XFE,0XD9,0XF6,0XB9,0XF6,0X98,0XEE,
-0X36,0XE6,0X16,0XDE,0X37,0XE6,0X98,0XEE,0X1B,0XFF,0X5C,0XFF,0X3B,0XFF,0X1A,0XF7,
-0XD9,0XF6,0XB9,0XF6,0XD9,0XF6,0X1A,0XF7,0X1A,0XF7,0X1A,0XF7,0X3B,0XFF,0X3B,0XFF,
-0X3B,0XFF,0X1A,0XFF,0X1A,0XF7,0X1A,0XFF,0X1B,0XFF,0X1B,0XFF,0XFA,0XF6,0XFA,0XFE,
-0XD9,0XF6,0XB9,0XF6,0XD9,0XF6,0XB9,0XF6,0X98,0XF6,0X78,0XF6,0X98,0XF6,0X78,0XEE,
-0X57,0XEE,0X16,0XE6,0XF6,0XE5,0XB4,0XDD,0X32,0XCD,0X4F,0XA4,0X0B,0X7B,0X47,0X5A,
-0X0A,0X7B,0X8B,0X93,0XAC,0X93,0XA2,0X20,0X00,0X00,0XA2,0X18,0XA2,0X18,0XC3,0X18,
-0XC3,0X18,0XC3,0X18,0X82,0X10,0XC3,0X18,0XC3,0X18,0XA2,0X10,0XC3,0X18,0XC3,0X18,
-0XE3,0X20,0XE3,0X20,0XC3,0X18,0X24,0X29,0XC3,0X20,0XC3,0X18,0XC3,0X18,0XA2,0X18,
-0X04,0X29,0XCB,0X5A,0X28,0X4A,0X28,0X4A,0XAB,0X5A,0X14,0X9D,0XB7,0XB5,0X0C,0X63,
-0XB2,0X94,0X45,0X31,0XAE,0X7B,0X71,0X8C,0XB7,0XB5,0X76,0XAD,0X76,0XAD,0XF8,0XBD,
-0XD7,0XB5,0XB7,0XB5,0X96,0XAD,0XF4,0X9C,0XF8,0XBD,0XCB,0X52,0XCB,0X62,0X75,0XA5,
-0X55,0XAD,0XD4,0X9C,0XF4,0X9C,0X55,0XA5,0X14,0X9D,0X14,0X9D,0X35,0XA5,0X34,0XA5,
-0X34,0XA5,0X34,0XA5,0X14,0X9D,0XF4,0X9C,0XF4,0X9C,0XD3,0X94,0XD3,0X94,0XD3,0X94,
-0XB3,0X94,0XB2,0X94,0X92,0X8C,0X92,0X8C,0X72,0X8C,0X71,0X8C,0X51,0X84,0X31,0X84,
-0X31,0X84,0X31,0X84,0X10,0X7C,0X10,0X7C,0X10,0X7C,0XF0,0X7B,0XCF,0X73,0XCF,0X73,
-0X2D,0X63,0X4D,0X63,0X4D,0X63,0X6D,0X6B,0X6E,0X6B,0X6E,0X6B,0X6E,0X6B,0X8E,0X6B,
-0X8E,0X6B,0XAF,0X73,0XAF,0X73,0XCF,0X73,0XCF,0X73,0XCF,0X73,0XF0,0X7B,0XF0,0X7B,
-0X10,0X7C,0X10,0X7C,0X31,0X84,0X51,0X84,0X51,0X84,0X71,0X8C,0X72,0X8C,0X92,0X8C,
-0X92,0X8C,0X93,0X94,0XB3,0X94,0XB3,0X94,0XD3,0X94,0XF4,0X9C,0XF4,0X9C,0X14,0X9D,
-0X14,0X9D,0XF4,0X9C,0X35,0XA5,0X55,0XA5,0X35,0XA5,0X55,0XA5,0XD3,0X94,0X34,0XA5,
-0XE7,0X41,0X49,0X4A,0X08,0X4A,0XC3,0X20,0XA2,0X18,0XC2,0X18,0XE3,0X20,0XC3,0X20,
-0XE3,0X20,0XC3,0X20,0XC3,0X20,0XC3,0X20,0XA2,0X18,0XC2,0X18,0X03,0X29,0X24,0X31,
-0X03,0X29,0X03,0X29,0XA2,0X20,0X82,0X18,0XC2,0X20,0X8C,0X93,0XD1,0XBC,0X73,0XD5,
-0XF6,0XE5,0X57,0XEE,0X78,0XEE,0X98,0XF6,0X98,0XF6,0XB9,0XF6,0XD9,0XF6,0XD9,0XF6,
-0XDA,0XF6,0XDA,0XF6,0XD9,0XF6,0XFA,0XF6,0XD9,0XF6,0XD9,0XF6,0XB9,0XF6,0X77,0XEE,
-0X16,0XE6,0XF6,0XDD,0X37,0XE6,0XB9,0XF6,0X3B,0XFF,0X5C,0XFF,0X1A,0XFF,0XD9,0XF6,
-0XB9,0XF6,0X98,0XEE,0XD9,0XF6,0XF9,0XF6,0XFA,0XFE,0X1A,0XFF,0X3B,0XFF,0X3B,0XFF,
-0X5B,0XFF,0X1B,0XF7,0X3B,0XFF,0X1B,0XFF,0X3B,0XFF,0X1B,0XFF,0X1B,0XFF,0X1A,0XFF,
-0XFA,0XFE,0XDA,0XFE,0XD9,0XF6,0X99,0XF6,0X99,0XF6,0X99,0XF6,0X78,0XF6,0X58,0XEE,
-0X57,0XEE,0X16,0XE6,0XD5,0XDD,0X74,0XD5,0XF1,0XBC,0X0E,0X9C,0X68,0X5A,0X0A,0X83,
-0X0D,0XA4,0XCC,0XA3,0X47,0X62,0X00,0X00,0X00,0X00,0X82,0X10,0X82,0X10,0XC3,0X18,
-0XC3,0X18,0XE3,0X18,0XA2,0X18,0XC3,0X18,0XA3,0X18,0XC3,0X18,0XC3,0X18,0XC3,0X18,
-0XE3,0X20,0XE3,0X20,0XE3,0X20,0XE3,0X20,0X45,0X29,0XC3,0X20,0XC3,0X18,0XA2,0X18,
-0XE3,0X20,0X86,0X39,0XEB,0X5A,0X07,0X42,0X49,0X4A,0XCF,0X7B,0X96,0XAD,0X92,0X8C,
-0X2C,0X63,0XC7,0X41,0XAA,0X5A,0XEF,0X83,0XB7,0XB5,0X96,0XB5,0XB6,0XB5,0XF7,0XBD,
-0XD7,0XB5,0XD7,0XB5,0XF8,0XBD,0XF4,0X9C,0X76,0XAD,0X15,0X9D,0X85,0X39,0X14,0XA5,
-0X35,0XA5,0X14,0XA5,0X75,0XA5,0X14,0X9D,0XF4,0X9C,0X55,0XA5,0X35,0XA5,0X55,0XA5,
-0X35,0XA5,0X35,0XA5,0X14,0X9D,0X14,0X9D,0X14,0X9D,0XF4,0X9C,0XD3,0X94,0XD3,0X94,
-0XD3,0X94,0XB3,0X94,0X92,0X8C,0X92,0X8C,0X72,0X8C,0X72,0X8C,0X71,0X8C,0X51,0X84,
-0X51,0X84,0X31,0X84,0X30,0X7C,0X10,0X84,0X10,0X7C,0XF0,0X7B,0XF0,0X7B,0XEF,0X7B,
-0X2D,0X63,0X4D,0X63,0X4D,0X63,0X4D,0X63,0X6D,0X6B,0X6E,0X6B,0X8E,0X6B,0X8E,0X6B,
-0X8E,0X6B,0XAF,0X73,0XAF,0X73,0XCF,0X73,0XCF,0X73,0XF0,0X7B,0XF0,0X7B,0XF0,0X7B,
-0X10,0X7C,0X10,0X84,0X31,0X84,0X51,0X84,0X51,0X84,0X72,0X8C,0X72,0X8C,0X92,0X8C,
-0X92,0X8C,0X92,0X94,0XB3,0X94,0XB3,0X94,0XD3,0X94,0XF4,0X9C,0X14,0X9D,0X14,0X9D,
-0XF4,0X9C,0X14,0X9D,0X55,0XA5,0X55,0XA5,0X55,0XA5,0X35,0XA5,0XF4,0X9C,0X34,0XA5,
-0X48,0X4A,0XCB,0X5A,0XC7,0X41,0XC3,0X20,0XC2,0X18,0XC2,0X18,0XC3,0X20,0XC3,0X20,
-0XC3,0X20,0XC3,0X20,0XE3,0X20,0XA2,0X18,0XC3,0X20,0XA2,0X18,0XE3,0X20,0X04,0X29,
-0X24,0X31,0X03,0X29,0XC3,0X20,0X82,0X18,0X81,0X18,0X4B,0X8B,0XB0,0XBC,0X53,0XD5,
-0XF6,0XE5,0X57,0XEE,0X78,0XF6,0X78,0XEE,0X99,0XF6,0XB9,0XF6,0XB9,0XF6,0XD9,0XF6,
-0XDA,0XFE,0XFA,0XFE,0XFA,0XFE,0XFA,0XFE,0XD9,0XF6,0XB9,0XF6,0X78,0XEE,0X56,0XE6,
-0XF5,0XDD,0XF5,0XDD,0X37,0XE6,0X99,0XEE,0X1B,0XF7,0X3C,0XFF,0XFA,0XF6,0XD9,0XF6,
-0X99,0XF6,0X98,0XEE,0X98,0XEE,0XD9,0XF6,0XD9,0XF6,0X1A,0XFF,0X3B,0XFF,0X3B,0XFF,
-0X3B,0XFF,0X3B,0XFF,0X3B,0XFF,0X1B,0XFF,0X3B,0XFF,0X3B,0XFF,0X3B,0XFF,0X1B,0XFF,
-0XFB,0XFE,0XD9,0XFE,0XDA,0XFE,0XB9,0XF6,0X99,0XF6,0X99,0XF6,0X78,0XEE,0X58,0XEE,
-0X37,0XEE,0X16,0XE6,0XB5,0XDD,0X33,0XCD,0X90,0XB4,0XAC,0X93,0X07,0X52,0X0D,0XA4,
-0X4E,0XAC,0XA8,0X72,0X00,0X00,0X00,0X00,0X20,0X00,0XA2,0X10,0XC3,0X18,0XC3,0X18,
-0XA2,0X10,0XC3,0X18,0X04,0X21,0XA3,0X18,0XC3,0X18,0XE3,0X20,0XA3,0X18,0X03,0X21,
-0X24,0X29,0X04,0X29,0XC3,0X20,0XC3,0X20,0X04,0X21,0X24,0X29,0XC3,0X20,0X82,0X10,
-0XC3,0X20,0X65,0X31,0XAA,0X52,0X08,0X42,0X0C,0X63,0X10,0X84,0XAF,0X7B,0X96,0XB5,
-0X6D,0X6B,0XC7,0X39,0XAE,0X7B,0X49,0X4A,0XF7,0XBD,0X96,0XAD,0X96,0XAD,0X18,0XBE,
-0XF7,0XBD,0XF8,0XBD,0X96,0XAD,0X96,0XAD,0X55,0XA5,0XB7,0XB5,0X89,0X52,0XCF,0X7B,
-0X96,0XAD,0X92,0X94,0X96,0XAD,0X14,0X9D,0X34,0XA5,0XF4,0X9C,0X35,0XA5,0X55,0XA5,
-0X55,0XA5,0X35,0XA5,0X34,0XA5,0X14,0X9D,0X14,0X9D,0XF4,0X9C,0XD3,0X94,0XF3,0X94,
-0XD3,0X94,0XB3,0X94,0X92,0X94,0X92,0X8C,0X72,0X8C,0X72,0X8C,0X51,0X84,0X51,0X84,
-0X51,0X84,0X31,0X84,0X10,0X7C,0X10,0X84,0X10,0X7C,0X10,0X7C,0XF0,0X7B,0XEF,0X7B,
-0X2D,0X63,0X4D,0X63,0X4D,0X6B,0X6D,0X6B,0X6D,0X6B,0X6E,0X6B,0X8E,0X6B,0X8E,0X6B,
-0X8E,0X6B,0XAF,0X73,0XAF,0X73,0XCF,0X73,0XCF,0X73,0XEF,0X7B,0XF0,0X7B,0X10,0X7C,
-0X10,0X7C,0X11,0X84,0X31,0X84,0X51,0X84,0X51,0X84,0X72,0X8C,0X72,0X8C,0X92,0X8C,
-0X92,0X8C,0X92,0X8C,0XB3,0X94,0XD3,0X94,0XD3,0X94,0XF4,0X9C,0X14,0X9D,0X14,0X9D,
-0XD3,0X94,0X35,0XA5,0X55,0XA5,0X35,0XA5,0X76,0XAD,0X34,0XA5,0X34,0XA5,0X14,0X9D,
-0X49,0X4A,0X0C,0X63,0X6A,0X52,0XA2,0X18,0XC3,0X20,0XC2,0X18,0XC2,0X20,0XC3,0X20,
-0XC2,0X20,0X04,0X29,0XA2,0X18,0XA2,0X18,0XC3,0X20,0XA2,0X18,0X04,0X29,0XE3,0X20,
-0X04,0X29,0X04,0X29,0XC3,0X20,0XA2,0X20,0X40,0X10,0X0A,0X7B,0X70,0XB4,0X33,0XD5,
-0XD5,0XDD,0X37,0XEE,0X78,0XF6,0X78,0XEE,0X99,0XF6,0X99,0XF6,0XB9,0XF6,0XB9,0XF6,
-0XDA,0XFE,0XFA,0XFE,0XFA,0XFE,0XDA,0XF6,0XD9,0XF6,0X99,0XF6,0X78,0XEE,0X16,0XDE,
-0XD5,0XDD,0XD5,0XDD,0X17,0XE6,0X98,0XEE,0X1B,0XFF,0X3B,0XFF,0XFA,0XF6,0XB9,0XF6,
-0X98,0XF6,0X77,0XEE,0X57,0XEE,0X78,0XEE,0XD9,0XF6,0XFA,0XFE,0X1A,0XFF,0X3B,0XFF,
-0X3B,0XFF,0X3B,0XFF,0X3B,0XFF,0X3B,0XFF,0X3B,0XFF,0X3B,0XFF,0X3B,0XFF,0X1B,0XFF,
-0XFB,0XFE,0XFB,0XFE,0XFA,0XFE,0XB9,0XFE,0XB9,0XF6,0X99,0XF6,0X78,0XF6,0X58,0XEE,
-0X17,0XE6,0XF6,0XE5,0X94,0XD5,0XF2,0XBC,0X2F,0XA4,0X4B,0X83,0XC6,0X49,0X06,0X52,
-0XA2,0X20,0X00,0X00,0X41,0X08,0X20,0X08,0X20,0X08,0X82,0X10,0XE3,0X18,0XC3,0X18,
-0XC3,0X18,0XA2,0X10,0XE3,0X20,0X25,0X29,0XC3,0X18,0XE3,0X20,0X04,0X29,0XC3,0X18,
-0XE3,0X20,0X24,0X29,0X04,0X21,0X24,0X29,0XC3,0X18,0X24,0X29,0X45,0X29,0X24,0X29,
-0XA2,0X18,0X04,0X29,0X69,0X4A,0XEB,0X62,0X08,0X42,0X6D,0X73,0X51,0X8C,0X72,0X8C,
-0XF0,0X7B,0XE7,0X41,0X8A,0X52,0X69,0X52,0XF3,0X9C,0X96,0XAD,0X96,0XAD,0X18,0XBE,
-0X18,0XBE,0X18,0XBE,0X76,0XAD,0XD7,0XB5,0X76,0XAD,0X35,0XA5,0X92,0X8C,0X28,0X4A,
-0XB7,0XB5,0X55,0XA5,0X35,0XA5,0X55,0XA5,0X55,0XA5,0X96,0XAD,0X55,0XA5,0X55,0XA5,
-0X55,0XA5,0X35,0XA5,0X35,0XA5,0X14,0X9D,0X14,0X9D,0X14,0X9D,0XD3,0X94,0XF3,0X9C,
-0XD3,0X94,0XD3,0X94,0XB3,0X94,0XB2,0X8C,0X92,0X8C,0X72,0X8C,0X72,0X8C,0X51,0X84,
-0X51,0X84,0X31,0X84,0X31,0X84,0X10,0X84,0X10,0X7C,0X10,0X7C,0XF0,0X7B,0XF0,0X7B,
-0X2D,0X63,0X4D,0X63,0X6D,0X63,0X6D,0X63,0X6E,0X6B,0X6E,0X6B,0X8E,0X6B,0X8E,0X6B,
-0XAF,0X73,0XAF,0X73,0XCF,0X73,0XCF,0X73,0XCF,0X73,0XF0,0X7B,0X10,0X7C,0X10,0X7C,
-0X30,0X7C,0X31,0X84,0X51,0X84,0X51,0X84,0X72,0X8C,0X72,0X8C,0X92,0X8C,0X92,0X8C,
-0XB3,0X94,0XB3,0X94,0XD3,0X94,0XB3,0X94,0XF4,0X9C,0XF4,0X9C,0X14,0X9D,0X14,0X9D,
-0X14,0X9D,0X55,0XA5,0X35,0XA5,0X34,0XA5,0X76,0XAD,0X55,0XA5,0XF3,0X9C,0X55,0XA5,
-0X28,0X4A,0X8E,0X73,0X29,0X4A,0XA2,0X18,0XC3,0X20,0XE3,0X20,0XC3,0X20,0XC3,0X20,
-0X04,0X29,0XE3,0X20,0XC3,0X20,0XC2,0X18,0XC3,0X20,0XC2,0X18,0XE3,0X28,0X04,0X29,
-0X04,0X29,0X03,0X29,0XA2,0X20,0XC3,0X20,0X40,0X08,0X68,0X62,0X4F,0XB4,0X12,0XCD,
-0XB5,0XDD,0X17,0XEE,0X58,0XEE,0X78,0XF6,0X99,0XF6,0XB9,0XF6,0XB9,0XF6,0XB9,0XF6,
-0XDA,0XFE,0XDA,0XFE,0XFA,0XFE,0XD9,0XF6,0XD9,0XF6,0XB9,0XF6,0X78,0XEE,0XB4,0XDD,
-0X73,0XCD,0XD5,0XDD,0XF6,0XE5,0XB9,0XF6,0XFA,0XF6,0X3B,0XFF,0XFA,0XF6,0X99,0XF6,
-0X78,0XEE,0X37,0XEE,0X16,0XE6,0X36,0XE6,0XB8,0XEE,0XFA,0XF6,0XFA,0XFE,0X1A,0XFF,
-0X1B,0XFF,0X3B,0XFF,0X3B,0XFF,0X3B,0XFF,0X3B,0XFF,0X3C,0XFF,0X3B,0XFF,0X1B,0XFF,
-0XFB,0XFE,0XFB,0XFE,0XDA,0XFE,0XD9,0XF6,0XB9,0XF6,0X98,0XF6,0X78,0XF6,0X37,0XEE,
-0X16,0XE6,0XB5,0XDD,0X53,0XCD,0XB1,0XB4,0XED,0X9B,0XEA,0X72,0X03,0X21,0X00,0X00,
-0X00,0X00,0X00,0X00,0X61,0X08,0X41,0X08,0X21,0X08,0X82,0X10,0XC3,0X18,0XC3,0X18,
-0XA2,0X18,0X82,0X10,0XC3,0X18,0XC3,0X18,0X45,0X29,0XE3,0X20,0X04,0X21,0X24,0X29,
-0XE3,0X20,0X24,0X29,0X03,0X21,0XE3,0X20,0X04,0X21,0X82,0X18,0X24,0X29,0X24,0X29,
-0XE3,0X20,0XE3,0X20,0XA6,0X39,0X8A,0X52,0X8A,0X52,0X8E,0X73,0X92,0X94,0X92,0X94,
-0X35,0XA5,0X28,0X4A,0X28,0X4A,0XCB,0X62,0X51,0X8C,0X92,0X94,0XB6,0XB5,0XF8,0XBD,
-0X18,0XBE,0XB7,0XB5,0XD7,0XB5,0X76,0XAD,0X76,0XAD,0X75,0XAD,0X18,0XBE,0X45,0X31,
-0X35,0XA5,0X56,0XAD,0XF4,0X9C,0X35,0XA5,0X55,0XA5,0X96,0XAD,0X76,0XAD,0X55,0XA5,
-0X55,0XA5,0X55,0XA5,0X35,0XA5,0X34,0XA5,0X14,0X9D,0XF4,0X9C,0XF4,0X9C,0XF4,0X9C,
-0XD3,0X94,0XD3,0X94,0XB3,0X94,0X93,0X94,0X92,0X8C,0X92,0X8C,0X72,0X8C,0X72,0X8C,
-0X51,0X84,0X51,0X84,0X31,0X84,0X30,0X84,0X10,0X7C,0X10,0X7C,0XF0,0X7B,0XF0,0X7B,
-0X4D,0X6B,0X4D,0X63,0X4D,0X6B,0X6E,0X6B,0X8E,0X6B,0X8E,0X6B,0X8E,0X6B,0XAE,0X73,
-0XAF,0X73,0XAF,0X73,0XCF,0X73,0XCF,0X73,0XF0,0X7B,0XF0,0X7B,0X10,0X7C,0X10,0X7C,
-0X30,0X84,0X51,0X84,0X51,0X84,0X51,0X84,0X51,0X84,0X72,0X8C,0X92,0X8C,0X92,0X8C,
-0XB3,0X94,0XD3,0X94,0XD3,0X94,0XF4,0X9C,0XD3,0X94,0XF4,0X9C,0X14,0X9D,0XF4,0X9C,
-0XF3,0X9C,0X55,0XA5,0X55,0XA5,0X76,0XAD,0X35,0XA5,0XF4,0X9C,0X14,0XA5,0X76,0XAD,
-0XC7,0X41,0X6E,0X6B,0X49,0X52,0XC2,0X20,0XA2,0X18,0XE3,0X20,0XE3,0X20,0XE3,0X20,
-0XE3,0X28,0XE3,0X28,0XC2,0X18,0XC3,0X20,0XC2,0X18,0XA2,0X20,0XE3,0X28,0XE3,0X20,
-0X04,0X29,0X03,0X29,0XC3,0X20,0XC3,0X20,0X41,0X10,0XC6,0X41,0X0F,0XAC,0XD1,0XC4,
-0X74,0XDD,0XF6,0XE5,0X37,0XEE,0X78,0XF6,0X98,0XF6,0XB9,0XF6,0XB9,0XF6,0XD9,0XFE,
-0XD9,0XFE,0XFA,0XFE,0XFA,0XFE,0XFA,0XFE,0XD9,0XF6,0XB9,0XF6,0X77,0XEE,0X52,0XCD,
-0X73,0XCD,0XD5,0XD5,0XF6,0XE5,0X98,0XF6,0X3B,0XFF,0X3C,0XFF,0XDA,0XF6,0X98,0XEE,
-0X57,0XEE,0X16,0XE6,0XF4,0XDD,0XB4,0XDD,0X57,0XEE,0XFA,0XF6,0X1A,0XFF,0XFA,0XFE,
-0X1B,0XFF,0X3B,0XFF,0X3B,0XFF,0X3B,0XFF,0X3C,0XFF,0X3C,0XFF,0X3C,0XFF,0X1B,0XFF,
-0XFB,0XFE,0XFB,0XFE,0XDA,0XFE,0XDA,0XFE,0X99,0XF6,0X78,0XF6,0X58,0XF6,0X37,0XEE,
-0XF6,0XE5,0XB5,0XDD,0X12,0XC5,0X90,0XAC,0XAD,0X93,0X89,0X62,0XC2,0X18,0X00,0X00,
-0X21,0X08,0X41,0X08,0X62,0X10,0X41,0X08,0X41,0X08,0XA2,0X10,0XA2,0X10,0XC3,0X18,
-0XA2,0X10,0X82,0X10,0XA2,0X10,0X04,0X21,0XA3,0X18,0X24,0X29,0X24,0X29,0X45,0X29,
-0X04,0X21,0X04,0X21,0X45,0X29,0XE3,0X20,0X04,0X21,0XE3,0X20,0X03,0X21,0X03,0X21,
-0X04,0X21,0X04,0X29,0X65,0X31,0X07,0X42,0X28,0X4A,0X0B,0X63,0XCF,0X7B,0XF8,0XBD,
-0XF0,0X7B,0XCB,0X5A,0X69,0X52,0XAA,0X5A,0XB2,0X94,0XCF,0X7B,0X35,0XA5,0X76,0XAD,
-0XD7,0XB5,0XF7,0XBD,0X18,0XBE,0X96,0XAD,0X75,0XAD,0XD7,0XB5,0XF8,0XBD,0X69,0X52,
-0X2F,0X84,0X96,0XAD,0X14,0X9D,0X55,0XAD,0X76,0XAD,0X76,0XAD,0X76,0XAD,0X76,0XAD,
-0X55,0XA5,0X55,0XA5,0X35,0XA5,0X35,0XA5,0X34,0XA5,0XF3,0X9C,0X14,0X9D,0XF4,0X9C,
-0XF3,0X9C,0XD3,0X94,0XD3,0X94,0XB3,0X94,0X93,0X94,0X92,0X8C,0X72,0X8C,0X72,0X8C,
-0X71,0X8C,0X51,0X84,0X51,0X84,0X31,0X84,0X10,0X7C,0X10,0X7C,0XF0,0X7B,0XF0,0X7B,
-0X2D,0X63,0X4D,0X6B,0X6E,0X6B,0X6E,0X6B,0X6E,0X6B,0X8E,0X6B,0X8E,0X6B,0XAF,0X73,
-0XAF,0X73,0XCF,0X73,0XCF,0X73,0XEF,0X7B,0XF0,0X7B,0XF0,0X7B,0X10,0X7C,0X30,0X84,
-0X31,0X84,0X51,0X84,0X51,0X84,0X71,0X8C,0X72,0X8C,0X72,0X8C,0X72,0X8C,0X72,0X8C,
-0X92,0X8C,0XB3,0X94,0XD3,0X94,0XF4,0X9C,0X14,0X9D,0X14,0X9D,0X35,0XA5,0X14,0X9D,
-0XF4,0X9C,0XF4,0X9C,0X35,0XA5,0X55,0XA5,0X55,0XA5,0X14,0X9D,0XD3,0X94,0XF4,0X9C,
-0X48,0X4A,0X69,0X4A,0X89,0X52,0XE3,0X20,0XA2,0X18,0X03,0X21,0XE3,0X20,0XC3,0X20,
-0XE3,0X20,0XC3,0X20,0XC3,0X20,0XC2,0X20,0XC3,0X20,0XE3,0X20,0XC3,0X20,0XE3,0X20,
-0X04,0X29,0XE3,0X20,0XC3,0X20,0XC2,0X20,0X41,0X10,0XE3,0X28,0XAD,0X93,0X90,0XBC,
-0X53,0XD5,0XD6,0XE5,0X37,0XEE,0X58,0XF6,0X99,0XF6,0XB9,0XF6,0XB9,0XF6,0XB9,0XF6,
-0XFA,0XFE,0XFA,0XFE,0XFA,0XFE,0XFA,0XFE,0XFA,0XF6,0XD9,0XF6,0XF6,0XE5,0XF2,0XC4,
-0X73,0XCD,0XB5,0XDD,0X16,0XE6,0X99,0XF6,0X1B,0XF7,0X5C,0XFF,0XDA,0XF6,0X78,0XF6,
-0X57,0XEE,0X16,0XE6,0XF5,0XE5,0X73,0XD5,0XB4,0XDD,0XB9,0XF6,0X1A,0XF7,0XFA,0XFE,
-0X1A,0XFF,0X1B,0XFF,0X3B,0XFF,0X1B,0XFF,0X3B,0XFF,0X3B,0XFF,0X5B,0XFF,0X3B,0XFF,
-0X1B,0XFF,0XFA,0XFE,0XDA,0XFE,0XB9,0XFE,0X98,0XF6,0X78,0XEE,0X37,0XEE,0X17,0XE6,
-0XD5,0XDD,0X74,0XD5,0XF2,0XBC,0X4F,0XA4,0XAC,0X8B,0X69,0X5A,0X20,0X08,0X20,0X08,
-0X41,0X08,0X41,0X08,0X62,0X10,0X41,0X08,0X41,0X08,0X82,0X10,0XC3,0X18,0XA3,0X18,
-0XA2,0X10,0XA2,0X10,0X82,0X10,0XE3,0X18,0XE4,0X20,0XC3,0X18,0X04,0X29,0X45,0X29,
-0X86,0X31,0X04,0X21,0X45,0X29,0X24,0X29,0XE3,0X20,0X04,0X21,0XC3,0X20,0X04,0X21,
-0X03,0X21,0XC2,0X20,0X44,0X29,0XE7,0X41,0X69,0X52,0X69,0X52,0X10,0X84,0X34,0XA5,
-0X14,0XA5,0X08,0X42,0XEB,0X62,0X8A,0X52,0XEF,0X83,0X14,0X9D,0XD3,0X9C,0XD7,0XB5,
-0X76,0XAD,0X96,0XAD,0XF8,0XBD,0XB6,0XB5,0XB7,0XB5,0X96,0XAD,0XD7,0XB5,0X10,0X7C,
-0X4C,0X6B,0X55,0XAD,0X14,0XA5,0X55,0XAD,0X55,0XA5,0X96,0XAD,0X96,0XAD,0X76,0XAD,
-0X76,0XAD,0X55,0XA5,0X55,0XA5,0X55,0XA5,0X14,0X9D,0X14,0X9D,0X14,0X9D,0XF4,0X9C,
-0XF4,0X9C,0XF3,0X9C,0XD3,0X94,0XD3,0X94,0XB3,0X94,0X92,0X8C,0X92,0X8C,0X72,0X8C,
-0X72,0X8C,0X51,0X84,0X51,0X84,0X31,0X84,0X30,0X84,0X10,0X7C,0X10,0X7C,0XF0,0X7B,
-0X4D,0X6B,0X4D,0X6B,0X6E,0X6B,0X6E,0X6B,0X6E,0X6B,0X8E,0X6B,0X8E,0X6B,0XAF,0X73,
-0XAF,0X73,0XCF,0X73,0XCF,0X73,0XF0,0X7B,0XF0,0X7B,0X10,0X7C,0X10,0X7C,0X31,0X84,
-0X31,0X84,0X51,0X84,0X51,0X84,0X72,0X8C,0X72,0X8C,0X92,0X8C,0X92,0X8C,0XB3,0X94,
-0XB3,0X94,0XD3,0X94,0XF3,0X9C,0XF3,0X9C,0XF3,0X9C,0XF4,0X9C,0X14,0X9D,0X14,0X9D,
-0XF4,0X9C,0X35,0XA5,0X35,0XA5,0XF4,0X9C,0X35,0XA5,0X55,0XA5,0X55,0XA5,0X96,0XAD,
-0XCA,0X5A,0X2D,0X63,0X69,0X52,0XA6,0X39,0X82,0X10,0X03,0X21,0XC3,0X20,0XC3,0X20,
-0XE3,0X20,0XE3,0X28,0XC3,0X20,0XA2,0X20,0XC3,0X20,0XA2,0X18,0XE3,0X20,0XE3,0X28,
-0X03,0X29,0X04,0X29,0XC3,0X20,0XC3,0X20,0X61,0X18,0X20,0X08,0X4C,0X83,0X2F,0XAC,
-0X13,0XCD,0XB5,0XDD,0X17,0XEE,0X58,0XEE,0X78,0XF6,0X98,0XF6,0XB9,0XF6,0XDA,0XFE,
-0XFA,0XFE,0XFA,0XFE,0XFA,0XFE,0X1A,0XFF,0XFA,0XF6,0XD9,0XF6,0X94,0XD5,0X73,0XD5,
-0XB4,0XD5,0XD6,0XDD,0X37,0XE6,0X99,0XF6,0X3B,0XFF,0X5C,0XFF,0XB9,0XF6,0X78,0XEE,
-0X57,0XEE,0X37,0XE6,0X16,0XE6,0XB4,0XDD,0X53,0XD5,0X36,0XE6,0XFA,0XF6,0XFA,0XFE,
-0XFA,0XFE,0X1A,0XFF,0X1B,0XFF,0X1B,0XFF,0X3B,0XFF,0X3B,0XFF,0X1B,0XFF,0X1B,0XFF,
-0X1B,0XFF,0XFA,0XFE,0XD9,0XFE,0XB9,0XF6,0X98,0XF6,0X78,0XEE,0X37,0XEE,0XF6,0XE5,
-0XB5,0XDD,0X33,0XCD,0XB1,0XB4,0X2F,0XA4,0X6C,0X83,0X07,0X4A,0X00,0X00,0X41,0X08,
-0X41,0X08,0X41,0X08,0X82,0X10,0X41,0X08,0X41,0X08,0X82,0X10,0XC3,0X18,0XA2,0X18,
-0X82,0X10,0XC3,0X18,0X62,0X10,0XC3,0X18,0X04,0X21,0X04,0X21,0XC3,0X18,0X04,0X21,
-0X24,0X29,0X65,0X31,0X65,0X31,0X45,0X29,0X24,0X29,0XC3,0X18,0X04,0X29,0X24,0X29,
-0X03,0X21,0XA2,0X18,0X04,0X21,0X86,0X39,0X28,0X4A,0X48,0X4A,0XCF,0X7B,0X10,0X84,
-0X72,0X8C,0XEC,0X62,0X89,0X52,0XF0,0X7B,0XEB,0X62,0X14,0XA5,0XB3,0X94,0X55,0XAD,
-0XB7,0XB5,0XB7,0XB5,0X55,0XA5,0X75,0XAD,0XD7,0XB5,0XD7,0XB5,0XF7,0XBD,0X76,0XAD,
-0X69,0X52,0X14,0X9D,0X35,0XA5,0X76,0XAD,0X96,0XAD,0X96,0XAD,0X76,0XAD,0X96,0XAD,
-0X76,0XAD,0X75,0XAD,0X55,0XA5,0X55,0XA5,0X14,0X9D,0X14,0X9D,0X14,0X9D,0X14,0X9D,
-0XF4,0X9C,0XF4,0X9C,0XD3,0X94,0XD3,0X94,0XB3,0X94,0XB2,0X94,0X92,0X8C,0X72,0X8C,
-0X72,0X8C,0X51,0X84,0X51,0X84,0X51,0X84,0X31,0X84,0X10,0X7C,0X10,0X7C,0X10,0X7C,
-0X4D,0X6B,0X6D,0X63,0X6E,0X6B,0X8E,0X6B,0X8E,0X6B,0X8E,0X6B,0XAF,0X73,0XAF,0X73,
-0XCF,0X73,0XCF,0X73,0XEF,0X7B,0XF0,0X7B,0XF0,0X7B,0X10,0X7C,0X10,0X7C,0X31,0X84,
-0X31,0X84,0X51,0X84,0X51,0X84,0X72,0X8C,0X92,0X8C,0X92,0X8C,0X92,0X8C,0XB3,0X94,
-0XD3,0X94,0XD3,0X94,0XF4,0X9C,0XF4,0X9C,0X14,0X9D,0X35,0XA5,0X35,0XA5,0X35,0XA5,
-0X14,0X9D,0X55,0XA5,0X55,0XA5,0X96,0XAD,0X76,0XAD,0X55,0XA5,0X14,0X9D,0XB6,0XAD,
-0X4D,0X6B,0X28,0X42,0X2D,0X6B,0X85,0X31,0X82,0X18,0X03,0X21,0XE3,0X20,0XE3,0X28,
-0XE3,0X28,0X03,0X29,0XC3,0X20,0XC2,0X20,0XE3,0X28,0X82,0X18,0X03,0X21,0X03,0X29,
-0X03,0X29,0XC3,0X20,0XE3,0X20,0XC2,0X20,0X82,0X18,0X20,0X00,0X48,0X5A,0XCD,0X9B,
-0XB1,0XBC,0X74,0XD5,0XF6,0XE5,0X58,0XF6,0X78,0XF6,0X78,0XF6,0XB9,0XF6,0XD9,0XFE,
-0XFA,0XFE,0XFA,0XFE,0XFA,0XFE,0XFA,0XFE,0XFA,0XFE,0XFA,0XFE,0X94,0XD5,0X74,0XD5,
-0X94,0XD5,0XD6,0XDD,0X37,0XEE,0XB9,0XF6,0X5C,0XFF,0X5C,0XFF,0XDA,0XF6,0X78,0XEE,
-0X17,0XE6,0X57,0XEE,0X36,0XE6,0X36,0XEE,0XB4,0XE5,0X93,0XD5,0XF9,0XF6,0XD9,0XF6,
-0XDA,0XFE,0XFA,0XFE,0X1A,0XFF,0X1B,0XFF,0X1B,0XFF,0X1B,0XFF,0XFB,0XFE,0X1B,0XFF,
-0XFA,0XFE,0XD9,0XFE,0XD9,0XF6,0X99,0XF6,0X78,0XF6,0X58,0XEE,0X17,0XEE,0XF6,0XE5,
-0X94,0XD5,0X12,0XC5,0X70,0XAC,0XED,0X93,0X0A,0X73,0X45,0X31,0X00,0X00,0X41,0X08,
-0X41,0X08,0X41,0X08,0X82,0X10,0X41,0X08,0X41,0X08,0X82,0X10,0XC3,0X18,0X82,0X10,
-0X82,0X10,0XC3,0X18,0XA2,0X10,0X82,0X10,0XE3,0X20,0XE3,0X20,0XE4,0X20,0X04,0X21,
-0X04,0X21,0X04,0X21,0X45,0X29,0X25,0X29,0X45,0X29,0X04,0X21,0X04,0X29,0X04,0X21,
-0X24,0X29,0X24,0X29,0XE3,0X20,0XC7,0X39,0X28,0X4A,0X69,0X52,0XAE,0X73,0XCF,0X7B,
-0X31,0X84,0XCF,0X7B,0XC6,0X39,0X6D,0X6B,0X6D,0X6B,0XB2,0X94,0XD3,0X9C,0X75,0XAD,
-0X18,0XBE,0XF8,0XBD,0XD7,0XB5,0XB7,0XB5,0X75,0XAD,0X96,0XAD,0XB6,0XB5,0X18,0XBE,
-0XA7,0X39,0X55,0XA5,0X35,0XA5,0X96,0XAD,0X96,0XAD,0X96,0XAD,0X96,0XAD,0X76,0XAD,
-0X76,0XAD,0X76,0XAD,0X75,0XAD,0X35,0XA5,0X35,0XA5,0X14,0X9D,0X34,0XA5,0X14,0X9D,
-0X14,0X9D,0XF4,0X9C,0XF3,0X94,0XD3,0X94,0XB3,0X94,0XB3,0X94,0X92,0X8C,0X92,0X8C,
-0X72,0X8C,0X71,0X8C,0X51,0X84,0X51,0X84,0X31,0X84,0X31,0X84,0X10,0X7C,0X10,0X7C,
-0X4D,0X6B,0X6D,0X6B,0X6E,0X6B,0X6E,0X6B,0X8E,0X6B,0X8E,0X6B,0XAF,0X73,0XAF,0X73,
-0XCF,0X73,0XCF,0X73,0XEF,0X7B,0XF0,0X7B,0X10,0X7C,0X10,0X7C,0X30,0X84,0X31,0X84,
-0X31,0X84,0X51,0X84,0X72,0X8C,0X92,0X8C,0X92,0X8C,0X92,0X8C,0X93,0X94,0XB3,0X94,
-0XD3,0X94,0XF3,0X9C,0XF4,0X9C,0X14,0X9D,0X14,0X9D,0X15,0XA5,0X35,0XA5,0X35,0XA5,
-0XF4,0X9C,0X55,0XA5,0X76,0XAD,0X76,0XAD,0X96,0XAD,0X96,0XAD,0X14,0X9D,0X76,0XAD,
-0XEF,0X83,0X49,0X4A,0XEB,0X5A,0X24,0X29,0XC3,0X18,0X03,0X21,0XE3,0X20,0XE3,0X20,
-0XE3,0X20,0XE3,0X28,0XC3,0X20,0X03,0X29,0XA2,0X18,0XA2,0X18,0X03,0X21,0X03,0X29,
-0X24,0X29,0XE3,0X20,0XC2,0X20,0XA2,0X20,0X82,0X18,0X20,0X08,0X24,0X31,0X6C,0X8B,
-0X70,0XB4,0X13,0XCD,0XB5,0XDD,0X53,0XDD,0X74,0XDD,0X78,0XF6,0X99,0XF6,0XB9,0XF6,
-0XFA,0XFE,0XFA,0XFE,0XFA,0XFE,0XFA,0XFE,0XFA,0XFE,0XD9,0XF6,0X94,0XD5,0X94,0XD5,
-0X73,0XCD,0X94,0XD5,0X58,0XEE,0X78,0XF6,0XDA,0XFE,0X1A,0XFF,0XD9,0XF6,0X77,0XEE,
-0XF5,0XDD,0X77,0XF6,0X97,0XEE,0X57,0XEE,0XF5,0XE5,0X53,0XD5,0XB9,0XEE,0XD9,0XF6,
-0XD9,0XF6,0XFA,0XFE,0XFA,0XFE,0X1A,0XFF,0X1B,0XFF,0X1B,0XFF,0X1B,0XFF,0XFA,0XFE,
-0XFA,0XFE,0XB9,0XFE,0XB9,0XF6,0X99,0XF6,0X78,0XEE,0X37,0XEE,0XF6,0XE5,0XB5,0XDD,
-0X53,0XCD,0XF1,0XC4,0X4F,0XA4,0X8C,0X8B,0XCA,0X6A,0X62,0X10,0X00,0X00,0X61,0X10,
-0X41,0X08,0X41,0X08,0X82,0X10,0X61,0X08,0X41,0X08,0X82,0X10,0XC3,0X18,0XC3,0X18,
-0X82,0X10,0XE3,0X20,0XA3,0X18,0X61,0X08,0XE3,0X18,0XE4,0X20,0XA2,0X18,0X04,0X21,
-0X24,0X29,0XC3,0X18,0X04,0X21,0X25,0X29,0X45,0X29,0X24,0X29,0XA2,0X18,0X04,0X21,
-0X04,0X21,0XE3,0X20,0XE3,0X20,0X65,0X31,0XA6,0X39,0X08,0X42,0XEF,0X7B,0XF0,0X7B,
-0X35,0XA5,0X92,0X94,0XAA,0X5A,0XCA,0X5A,0XEF,0X7B,0X35,0XA5,0XB2,0X94,0X14,0XA5,
-0X55,0XAD,0X18,0XBE,0X18,0XBE,0XD7,0XB5,0XD7,0XB5,0XB6,0XB5,0XB6,0XB5,0XB7,0XB5,
-0X28,0X4A,0XB6,0XB5,0XB3,0X94,0X96,0XB5,0X76,0XAD,0XB7,0XB5,0XB6,0XB5,0X96,0XAD,
-0X96,0XAD,0X76,0XAD,0X55,0XA5,0X55,0XA5,0X55,0XA5,0X14,0X9D,0X15,0XA5,0X14,0X9D,
-0X14,0X9D,0X14,0X9D,0XF3,0X9C,0XD3,0X94,0XD3,0X94,0XB3,0X94,0XB2,0X94,0X92,0X8C,
-0X92,0X8C,0X72,0X8C,0X71,0X8C,0X51,0X84,0X51,0X84,0X31,0X84,0X10,0X7C,0X10,0X7C,
-0X6D,0X63,0X6E,0X6B,0X6E,0X6B,0X8E,0X6B,0X8E,0X6B,0X8E,0X6B,0XAE,0X73,0XAF,0X73,
-0XCF,0X73,0XCF,0X73,0XF0,0X7B,0XF0,0X7B,0X10,0X7C,0X30,0X84,0X30,0X84,0X31,0X84,
-0X51,0X84,0X51,0X84,0X71,0X8C,0X72,0X8C,0X72,0X8C,0X93,0X94,0X93,0X94,0XD3,0X94,
-0XD3,0X94,0XF3,0X9C,0XF4,0X9C,0X14,0X9D,0X14,0X9D,0X35,0XA5,0X55,0XA5,0X75,0XAD,
-0XB3,0X94,0X96,0XAD,0X76,0XAD,0X96,0XAD,0X96,0XAD,0X96,0XAD,0X14,0X9D,0XD7,0XB5,
-0X71,0X94,0X0C,0X63,0X8A,0X52,0X45,0X31,0XA2,0X18,0XC3,0X20,0XE3,0X20,0XE3,0X20,
-0X04,0X29,0XE3,0X20,0X04,0X29,0X03,0X29,0XC2,0X18,0XC2,0X18,0XE3,0X20,0X03,0X29,
-0X03,0X29,0XE3,0X20,0XC3,0X20,0XA2,0X20,0X82,0X18,0X41,0X10,0X00,0X08,0X0B,0X73,
-0X0E,0XA4,0XB1,0XBC,0X74,0XD5,0XB5,0XDD,0XD6,0XE5,0X78,0XEE,0X98,0XF6,0XB9,0XF6,
-0XDA,0XF6,0XFA,0XF6,0XFA,0XFE,0X1A,0XFF,0XFA,0XFE,0XD9,0XF6,0X94,0XD5,0X32,0XCD,
-0X8B,0X9B,0X6B,0X8B,0XF5,0XE5,0X17,0XEE,0X16,0XEE,0X77,0XEE,0X16,0XEE,0XB4,0XDD,
-0X0E,0XA4,0XE6,0X51,0X4F,0XAC,0XF5,0XE5,0X93,0XDD,0X32,0XD5,0XFA,0XF6,0XFA,0XFE,
-0XF9,0XF6,0XFA,0XFE,0XFA,0XFE,0XFA,0XFE,0X1A,0XFF,0XFA,0XFE,0XFA,0XFE,0XFA,0XFE,
-0XDA,0XF6,0XB9,0XFE,0X99,0XF6,0X98,0XF6,0X58,0XEE,0X37,0XEE,0XF6,0XE5,0XB5,0XDD,
-0X33,0XCD,0XB0,0XB4,0X0F,0XA4,0X4B,0X83,0X68,0X5A,0X00,0X00,0X20,0X00,0X41,0X08,
-0X21,0X08,0X41,0X08,0X82,0X10,0X61,0X08,0X82,0X10,0X62,0X10,0XA2,0X10,0X04,0X21,
-0XA2,0X18,0XC3,0X18,0XE3,0X18,0X61,0X10,0XA2,0X10,0XE3,0X20,0X24,0X29,0XA2,0X18,
-0X24,0X29,0X24,0X29,0X04,0X21,0X45,0X29,0X24,0X29,0X24,0X29,0XE3,0X20,0X82,0X10,
-0X24,0X29,0XC3,0X20,0XC3,0X20,0X04,0X29,0X65,0X31,0X08,0X42,0XCA,0X5A,0X71,0X8C,
-0X51,0X8C,0X92,0X94,0X6A,0X52,0XEB,0X62,0X8D,0X73,0XB6,0XB5,0XB3,0X94,0X96,0XB5,
-0XB3,0X94,0XD7,0XB5,0XD7,0XB5,0XD7,0XB5,0X96,0XAD,0X96,0XAD,0X75,0XAD,0XD7,0XB5,
-0X08,0X42,0XD7,0XB5,0X35,0XA5,0X14,0X9D,0X96,0XAD,0XB7,0XB5,0XB7,0XB5,0X96,0XAD,
-0X96,0XAD,0X76,0XAD,0X75,0XAD,0X75,0XAD,0X35,0XA5,0X35,0XA5,0X35,0XA5,0X34,0XA5,
-0X14,0X9D,0XF4,0X9C,0XF4,0X9C,0XF4,0X9C,0XD3,0X94,0XB3,0X94,0XB2,0X94,0X92,0X8C,
-0X92,0X8C,0X72,0X8C,0X71,0X8C,0X51,0X84,0X51,0X84,0X31,0X84,0X30,0X84,0X10,0X7C,
-0X6D,0X6B,0X6E,0X6B,0X6E,0X6B,0X8E,0X6B,0X8E,0X6B,0XAE,0X73,0XAF,0X73,0XCF,0X73,
-0XCF,0X73,0XF0,0X7B,0XF0,0X7B,0XF0,0X7B,0X10,0X7C,0X10,0X7C,0X31,0X84,0X51,0X84,
-0X51,0X84,0X51,0X8C,0X72,0X8C,0X72,0X8C,0X92,0X8C,0X92,0X8C,0XB3,0X94,0XD3,0X94,
-0XD3,0X94,0XF4,0X9C,0XF4,0X9C,0X14,0X9D,0X15,0X9D,0X35,0XA5,0X55,0XA5,0X35,0XA5,
-0X14,0X9D,0X75,0XAD,0X76,0XAD,0X96,0XAD,0X96,0XAD,0XB7,0XB5,0X34,0XA5,0XD7,0XB5,
-0X14,0XA5,0XCB,0X5A,0X8A,0X52,0X65,0X31,0XC2,0X18,0XC3,0X20,0XA2,0X18,0XC3,0X20,
-0X03,0X29,0X04,0X29,0XC3,0X20,0XE3,0X20,0XA2,0X18,0XC3,0X20,0XC3,0X20,0X24,0X31,
-0X04,0X29,0X03,0X29,0XA2,0X20,0XC2,0X20,0X81,0X18,0X61,0X10,0X00,0X00,0X28,0X52,
-0XAD,0X93,0X70,0XAC,0X33,0XCD,0XB5,0XDD,0XF6,0XE5,0X37,0XEE,0X78,0XEE,0X98,0XF6,
-0XD9,0XF6,0XFA,0XF6,0XFA,0XF6,0XF9,0XF6,0XD9,0XF6,0XB9,0XF6,0XD5,0XDD,0X2E,0XB4,
-0X8F,0XBC,0X4B,0X93,0X6B,0X93,0X73,0XD5,0X93,0XDD,0X32,0XD5,0X11,0XCD,0XEA,0X8A,
-0XEA,0X82,0X06,0X62,0X88,0X7A,0XD0,0XC4,0XD0,0XCC,0XF5,0XDD,0X1A,0XFF,0XFA,0XFE,
-0XFA,0XFE,0XFA,0XFE,0XFA,0XFE,0XFA,0XFE,0XFA,0XFE,0XFA,0XFE,0XFA,0XFE,0XD9,0XFE,
-0XB9,0XF6,0XB9,0XF6,0X99,0XF6,0X58,0XEE,0X57,0XEE,0X37,0XE6,0XD5,0XDD,0X94,0XD5,
-0X12,0XC5,0X90,0XB4,0XCD,0X9B,0X2A,0X7B,0X65,0X39,0X00,0X00,0X41,0X08,0X41,0X08,
-0X41,0X08,0X41,0X08,0X82,0X10,0X62,0X10,0X61,0X08,0X82,0X10,0XC3,0X18,0XE4,0X18,
-0XE4,0X20,0XC3,0X18,0XE3,0X20,0XA2,0X18,0X61,0X08,0XA3,0X18,0X04,0X21,0X04,0X21,
-0X82,0X10,0XE4,0X20,0X04,0X21,0XE4,0X20,0X44,0X29,0X24,0X29,0X24,0X29,0XC3,0X20,
-0XC3,0X20,0X03,0X21,0XE3,0X20,0XA2,0X18,0X86,0X31,0X86,0X39,0XEB,0X62,0X10,0X84,
-0X10,0X84,0XB3,0X94,0X0C,0X63,0X4C,0X6B,0X8E,0X7B,0X96,0XB5,0X76,0XAD,0X55,0XAD,
-0XB2,0X94,0X14,0XA5,0X39,0XC6,0XB7,0XB5,0XD7,0XB5,0X96,0XAD,0XB7,0XB5,0X55,0XAD,
-0X0C,0X63,0X35,0XA5,0X35,0XA5,0X76,0XAD,0X96,0XAD,0XB6,0XB5,0X96,0XAD,0XB6,0XB5,
-0X96,0XAD,0X76,0XAD,0X55,0XA5,0X55,0XA5,0X75,0XAD,0X35,0XA5,0X35,0XA5,0X35,0XA5,
-0X14,0X9D,0X14,0X9D,0XF4,0X9C,0XF4,0X9C,0XD3,0X94,0XD3,0X94,0XB3,0X94,0X92,0X8C,
-0X92,0X8C,0X72,0X8C,0X72,0X8C,0X71,0X8C,0X51,0X84,0X31,0X84,0X30,0X84,0X30,0X84,
-0X6D,0X6B,0X6E,0X6B,0X8E,0X6B,0X8E,0X6B,0XAE,0X73,0XAF,0X73,0XAF,0X73,0XCF,0X73,
-0XCF,0X73,0XEF,0X7B,0XF0,0X7B,0X10,0X7C,0X10,0X7C,0X30,0X84,0X31,0X84,0X51,0X84,
-0X51,0X84,0X72,0X8C,0X92,0X8C,0X92,0X8C,0X92,0X8C,0XB3,0X94,0XD3,0X94,0XD3,0X94,
-0XF3,0X9C,0XF4,0X9C,0X14,0X9D,0X14,0X9D,0X14,0XA5,0X35,0XA5,0X55,0XA5,0X14,0X9D,
-0X55,0XA5,0X35,0XA5,0X96,0XAD,0X96,0XAD,0X76,0XAD,0XB7,0XB5,0X55,0XA5,0XB6,0XAD,
-0X96,0XB5,0X28,0X4A,0X2C,0X63,0X85,0X31,0X81,0X18,0XE3,0X20,0XC3,0X18,0XC3,0X18,
-0X04,0X29,0X24,0X31,0XE3,0X20,0XC3,0X20,0XE3,0X20,0XC3,0X20,0XE3,0X20,0X24,0X29,
-0X24,0X31,0XE3,0X20,0XC2,0X20,0XE3,0X28,0X61,0X10,0X61,0X10,0X20,0X08,0XE3,0X20,
-0X4C,0X83,0X0E,0XA4,0XD2,0XC4,0X74,0XD5,0XD6,0XDD,0X17,0XEE,0X57,0XEE,0X58,0XEE,
-0X98,0XF6,0XD9,0XF6,0XD9,0XF6,0XD9,0XF6,0XB9,0XF6,0X98,0XF6,0X37,0XE6,0X12,0XCD,
-0X0E,0XAC,0X4E,0XB4,0X0E,0XAC,0XED,0XA3,0XD1,0XBC,0X12,0XCD,0XD0,0XBC,0X2E,0XB4,
-0X32,0XCD,0X74,0XDD,0X94,0XDD,0XB0,0XC4,0X74,0XD5,0XDA,0XF6,0X1A,0XFF,0X1A,0XFF,
-0XFA,0XF6,0XFA,0XFE,0XFA,0XFE,0XFA,0XFE,0XFA,0XFE,0XFA,0XFE,0XD9,0XF6,0XB9,0XF6,
-0XB9,0XF6,0X99,0XF6,0X98,0XF6,0X58,0XEE,0X37,0XEE,0XF6,0XE5,0XB5,0XDD,0X74,0XD5,
-0XD1,0XC4,0X4F,0XAC,0X8C,0X8B,0X0A,0X73,0X81,0X18,0X00,0X00,0X21,0X08,0X61,0X08,
-0X41,0X08,0X61,0X10,0X82,0X10,0X61,0X08,0X41,0X08,0XA3,0X18,0XE3,0X20,0X82,0X10,
-0XE4,0X20,0XA3,0X18,0XE3,0X20,0XC3,0X18,0X82,0X10,0X61,0X10,0XC3,0X18,0X04,0X21,
-0X04,0X21,0XC3,0X18,0XC3,0X18,0XE3,0X20,0XE3,0X20,0X44,0X29,0X24,0X29,0X04,0X21,
-0XC3,0X18,0X03,0X21,0XE3,0X20,0XC3,0X20,0X04,0X21,0X08,0X42,0XE7,0X41,0X4D,0X6B,
-0X8E,0X73,0XB3,0X94,0X8A,0X52,0XEB,0X62,0XCF,0X7B,0XF3,0X9C,0X96,0XAD,0X59,0XCE,
-0X75,0XAD,0XCF,0X7B,0XD7,0XBD,0X39,0XC6,0X39,0XC6,0X75,0XAD,0X96,0XAD,0XF4,0X9C,
-0XEC,0X62,0X55,0XAD,0XB7,0XB5,0X76,0XAD,0X14,0X9D,0XB7,0XB5,0X96,0XAD,0X76,0XAD,
-0X55,0XA5,0X75,0XAD,0X96,0XAD,0X76,0XAD,0X75,0XAD,0X35,0XA5,0X55,0XA5,0X35,0XA5,
-0X14,0X9D,0X14,0X9D,0XF4,0X9C,0XF4,0X9C,0XF4,0X9C,0XD3,0X94,0XD3,0X94,0XB3,0X94,
-0X92,0X8C,0X92,0X8C,0X72,0X8C,0X72,0X8C,0X51,0X84,0X51,0X84,0X31,0X84,0X30,0X84,
-0X6D,0X6B,0X6D,0X6B,0X8E,0X6B,0X8E,0X6B,0X8E,0X6B,0XAF,0X73,0XCF,0X73,0XCF,0X73,
-0XEF,0X73,0XF0,0X7B,0XF0,0X7B,0X10,0X7C,0X10,0X7C,0X31,0X84,0X51,0X84,0X51,0X84,
-0X71,0X84,0X72,0X8C,0X92,0X8C,0X92,0X8C,0X93,0X94,0XB3,0X94,0XD3,0X94,0XD3,0X94,
-0XF4,0X9C,0XF4,0X9C,0X14,0X9D,0X14,0X9D,0X35,0XA5,0X55,0XA5,0X35,0XA5,0X55,0XA5,
-0X55,0XA5,0X35,0XA5,0X96,0XAD,0X75,0XAD,0XB6,0XB5,0XB7,0XB5,0X75,0XAD,0X96,0XAD,
-0XB7,0XB5,0XCB,0X5A,0X2C,0X63,0XE3,0X20,0XA2,0X18,0XC3,0X18,0XC3,0X18,0XC3,0X18,
-0X24,0X31,0X04,0X29,0XE3,0X28,0XE3,0X20,0XC3,0X20,0XE3,0X28,0XE3,0X28,0X03,0X29,
-0X65,0X39,0XE3,0X28,0XE3,0X28,0XC2,0X20,0XA2,0X20,0X61,0X10,0X41,0X08,0X00,0X00,
-0XCA,0X6A,0XAD,0X93,0X90,0XB4,0X13,0XCD,0X94,0XD5,0X16,0XE6,0X37,0XEE,0X58,0XEE,
-0X98,0XF6,0X99,0XF6,0XB9,0XF6,0XB9,0XF6,0X99,0XF6,0X98,0XEE,0X36,0XE6,0XD5,0XDD,
-0X94,0XD5,0X11,0XC5,0XB0,0XBC,0X90,0XB4,0X6F,0XB4,0X90,0XB4,0XB0,0XBC,0X94,0XD5,
-0XF6,0XDD,0XB5,0XDD,0X53,0XD5,0X37,0XE6,0XD9,0XF6,0X3A,0XFF,0X1A,0XFF,0X1A,0XF7,
-0XFA,0XF6,0XFA,0XFE,0XFA,0XFE,0XD9,0XF6,0XDA,0XFE,0XD9,0XF6,0XD9,0XF6,0XB9,0XF6,
-0X99,0XF6,0X98,0XF6,0X78,0XEE,0X37,0XEE,0XF6,0XE5,0XD5,0XDD,0X94,0XD5,0X33,0XCD,
-0XB1,0XBC,0X0E,0XA4,0X4B,0X83,0X68,0X62,0X00,0X00,0X00,0X00,0X20,0X08,0X41,0X08,
-0X41,0X08,0X82,0X10,0X61,0X08,0X62,0X10,0X41,0X08,0XA2,0X18,0XE3,0X20,0XA2,0X18,
-0XC3,0X18,0XA2,0X10,0XE3,0X20,0XE4,0X20,0XA3,0X18,0X61,0X08,0XA2,0X10,0XE3,0X20,
-0X04,0X21,0XE4,0X20,0XE3,0X20,0XE4,0X20,0XE3,0X20,0XC3,0X18,0X03,0X21,0X04,0X21,
-0X04,0X21,0XE3,0X20,0X24,0X29,0XC3,0X18,0XC3,0X18,0XA6,0X39,0X8A,0X52,0XE7,0X41,
-0X2C,0X6B,0XF4,0X9C,0X6D,0X73,0X8A,0X52,0XCF,0X7B,0X34,0XA5,0X55,0XA5,0X38,0XC6,
-0X39,0XC6,0X76,0XAD,0XEF,0X7B,0X38,0XC6,0X96,0XAD,0X18,0XBE,0X34,0XA5,0XF8,0XBD,
-0X0C,0X63,0XD3,0X9C,0XF8,0XBD,0XD7,0XB5,0X76,0XAD,0X76,0XAD,0X75,0XAD,0X76,0XAD,
-0XB7,0XB5,0X76,0XAD,0X55,0XA5,0X76,0XAD,0X55,0XA5,0X55,0XA5,0X55,0XA5,0X35,0XA5,
-0X15,0XA5,0X14,0X9D,0X14,0X9D,0XF4,0X9C,0XF4,0X9C,0XD3,0X94,0XB3,0X94,0XB3,0X94,
-0X92,0X8C,0X92,0X8C,0X72,0X8C,0X72,0X8C,0X51,0X84,0X51,0X84,0X31,0X84,0X31,0X84,
-0X6D,0X6B,0X8E,0X6B,0X8E,0X6B,0X8E,0X6B,0XAE,0X73,0XAF,0X73,0XCF,0X73,0XCF,0X73,
-0XF0,0X7B,0XF0,0X7B,0X10,0X7C,0X10,0X7C,0X30,0X84,0X31,0X84,0X51,0X84,0X51,0X84,
-0X72,0X8C,0X72,0X8C,0X92,0X8C,0X92,0X8C,0XB3,0X94,0XB3,0X94,0XD3,0X94,0XD3,0X94,
-0XF4,0X9C,0XF4,0X9C,0X14,0X9D,0X14,0XA5,0X35,0XA5,0X55,0XA5,0X35,0XA5,0X55,0XA5,
-0X76,0XAD,0X14,0X9D,0X76,0XAD,0X96,0XAD,0XB6,0XB5,0XD7,0XB5,0X55,0XA5,0XD7,0XB5,
-0X96,0XAD,0X2C,0X63,0XCB,0X5A,0XE3,0X20,0XA2,0X18,0XA2,0X18,0XC3,0X18,0XC3,0X20,
-0X04,0X29,0X04,0X29,0XC3,0X20,0XE3,0X28,0XE3,0X28,0XC3,0X20,0XE3,0X20,0XE3,0X20,
-0X65,0X39,0XC3,0X20,0XE3,0X28,0XA2,0X20,0XE3,0X28,0X41,0X10,0X81,0X18,0X00,0X00,
-0XA6,0X39,0X6C,0X83,0X2F,0XA4,0XD2,0XBC,0X54,0XD5,0XD5,0XDD,0X16,0XE6,0X57,0XEE,
-0X78,0XEE,0X98,0XF6,0X98,0XF6,0X98,0XF6,0X98,0XEE,0X98,0XEE,0X77,0XEE,0X37,0XE6,
-0XF6,0XE5,0X94,0XD5,0X73,0XD5,0X73,0XD5,0X73,0XD5,0X73,0XD5,0X73,0XCD,0X36,0XE6,
-0X57,0XE6,0X57,0XEE,0X78,0XEE,0XF9,0XF6,0X1A,0XFF,0X1A,0XFF,0X1A,0XF7,0XFA,0XF6,
-0XFA,0XF6,0XF9,0XF6,0XD9,0XF6,0XD9,0XF6,0XD9,0XF6,0XB9,0XF6,0XB9,0XF6,0X99,0XF6,
-0X98,0XF6,0X78,0XEE,0X58,0XEE,0X37,0XE6,0XF6,0XE5,0XB5,0XDD,0X74,0XD5,0X12,0XC5,
-0X70,0XB4,0XCD,0X9B,0X2B,0X83,0X65,0X39,0X00,0X00,0X00,0X00,0X41,0X08,0X41,0X08,
-0X61,0X08,0XA2,0X10,0X41,0X08,0X61,0X08,0X82,0X10,0XA2,0X10,0X04,0X21,0XC3,0X18,
-0XE3,0X18,0XA2,0X18,0XE3,0X20,0XC3,0X18,0XC3,0X18,0XA2,0X10,0XA2,0X10,0XA2,0X10,
-0X04,0X21,0X04,0X21,0XE4,0X20,0X04,0X21,0X24,0X29,0XE3,0X20,0XE3,0X20,0X04,0X21,
-0X04,0X29,0X04,0X29,0XE3,0X20,0X04,0X21,0XC2,0X18,0X03,0X21,0X28,0X4A,0X28,0X4A,
-0X8E,0X73,0X30,0X84,0X8E,0X73,0X69,0X52,0X0C,0X63,0X55,0XAD,0XF8,0XBD,0X18,0XBE,
-0X38,0XC6,0XD7,0XB5,0XF4,0X9C,0X10,0X84,0XF8,0XBD,0X18,0XBE,0X72,0X8C,0X59,0XC6,
-0X69,0X52,0X75,0XAD,0XF8,0XBD,0XD7,0XB5,0XD7,0XB5,0X96,0XAD,0XB7,0XB5,0X96,0XAD,
-0X75,0XAD,0X35,0XA5,0X14,0X9D,0X96,0XAD,0X55,0XA5,0X75,0XAD,0X55,0XA5,0X35,0XA5,
-0X35,0XA5,0X14,0X9D,0X14,0X9D,0XF4,0X9C,0XF4,0X9C,0XD3,0X94,0XD3,0X94,0XB3,0X94,
-0XB2,0X94,0X92,0X8C,0X92,0X8C,0X72,0X8C,0X72,0X8C,0X51,0X84,0X31,0X84,0X31,0X84,
-0X6D,0X6B,0X6E,0X6B,0X8E,0X73,0X8E,0X73,0XAE,0X73,0XCF,0X73,0XCF,0X73,0XCF,0X73,
-0XF0,0X7B,0XF0,0X7B,0X10,0X7C,0X30,0X84,0X30,0X84,0X31,0X84,0X51,0X84,0X51,0X84,
-0X72,0X8C,0X72,0X8C,0X92,0X8C,0X92,0X8C,0XB3,0X94,0XB3,0X94,0XD3,0X94,0XF4,0X9C,
-0XF4,0X9C,0X14,0X9D,0X14,0X9D,0X15,0XA5,0X35,0XA5,0X55,0XA5,0X56,0XA5,0X35,0XA5,
-0X76,0XAD,0X34,0XA5,0X75,0XAD,0X96,0XAD,0XB7,0XB5,0XD7,0XB5,0X34,0XA5,0XB6,0XB5,
-0X76,0XAD,0X51,0X8C,0X28,0X4A,0X24,0X29,0XC2,0X18,0XE3,0X20,0XC3,0X20,0XA2,0X18,
-0XC3,0X20,0X24,0X29,0XE3,0X28,0XE3,0X28,0XE3,0X28,0XC2,0X20,0XE3,0X28,0XC3,0X20,
-0X85,0X39,0XE3,0X20,0XE3,0X20,0X03,0X29,0XA2,0X20,0XC2,0X20,0X41,0X10,0X20,0X10,
-0X41,0X10,0X0B,0X73,0XED,0X9B,0X90,0XB4,0X33,0XCD,0XB5,0XDD,0X16,0XE6,0X37,0XEE,
-0X78,0XEE,0X78,0XEE,0X78,0XEE,0X77,0XEE,0X77,0XEE,0X78,0XEE,0X78,0XEE,0X57,0XEE,
-0X36,0XE6,0XF5,0XDD,0XF5,0XE5,0X16,0XE6,0X16,0XE6,0XF6,0XE5,0XF5,0XDD,0X78,0XEE,
-0XB9,0XF6,0XB9,0XF6,0XB9,0XF6,0XD9,0XF6,0XF9,0XF6,0XFA,0XF6,0XFA,0XF6,0XF9,0XF6,
-0XF9,0XF6,0XD9,0XF6,0XB9,0XF6,0XB9,0XF6,0XB9,0XF6,0XB9,0XF6,0X98,0XF6,0X78,0XEE,
-0X78,0XEE,0X58,0XEE,0X57,0XEE,0X17,0XE6,0XD6,0XDD,0X94,0XD5,0X53,0XCD,0XF1,0XC4,
-0X2F,0XAC,0X8C,0X8B,0XEA,0X72,0X82,0X18,0X00,0X00,0X00,0X00,0X41,0X08,0X41,0X08,
-0X61,0X08,0XA2,0X10,0X21,0X08,0X41,0X08,0XC3,0X18,0X82,0X10,0X04,0X21,0XC3,0X18,
-0X04,0X21,0XC3,0X18,0XA3,0X18,0XA2,0X18,0XE3,0X20,0XA2,0X10,0X82,0X10,0X82,0X10,
-0X82,0X10,0X04,0X21,0X04,0X21,0X04,0X21,0X04,0X21,0X24,0X29,0X24,0X29,0X04,0X21,
-0X04,0X21,0X24,0X29,0X24,0X29,0X04,0X29,0XC2,0X18,0XA2,0X18,0X49,0X4A,0X85,0X31,
-0X2C,0X6B,0XCF,0X7B,0XAE,0X73,0XCB,0X5A,0X6D,0X73,0X72,0X8C,0X18,0XBE,0XD7,0XB5,
-0X18,0XBE,0XF8,0XBD,0XB7,0XB5,0XF4,0X9C,0X34,0XA5,0X75,0XAD,0X35,0XA5,0X59,0XC6,
-0X07,0X42,0XF7,0XBD,0XD7,0XB5,0XB7,0XB5,0X76,0XAD,0X76,0XAD,0X55,0XA5,0XB6,0XAD,
-0X96,0XAD,0XB7,0XB5,0X96,0XB5,0X55,0XA5,0X75,0XAD,0X75,0XAD,0X55,0XA5,0X55,0XA5,
-0X35,0XA5,0X35,0XA5,0X14,0X9D,0X14,0X9D,0XF4,0X9C,0XD3,0X94,0XD3,0X94,0XB3,0X94,
-0XB3,0X94,0X92,0X8C,0X92,0X8C,0X72,0X8C,0X72,0X8C,0X71,0X8C,0X51,0X84,0X31,0X84,
-0X6E,0X6B,0X8E,0X6B,0X8E,0X6B,0X8E,0X6B,0XAF,0X73,0XCF,0X73,0XCF,0X73,0XEF,0X7B,
-0XF0,0X7B,0X10,0X7C,0X10,0X7C,0X10,0X7C,0X31,0X84,0X31,0X84,0X51,0X84,0X51,0X84,
-0X72,0X8C,0X92,0X8C,0X92,0X8C,0X93,0X94,0XB3,0X94,0XD3,0X94,0XD3,0X94,0XF4,0X9C,
-0XF4,0X9C,0XF4,0X9C,0X14,0X9D,0X35,0XA5,0X35,0XA5,0X35,0XA5,0X75,0XA5,0X35,0XA5,
-0X35,0XA5,0X76,0XAD,0X35,0XA5,0X96,0XAD,0X96,0XAD,0XB6,0XB5,0XD3,0X9C,0X96,0XB5,
-0X35,0XA5,0XB2,0X94,0X45,0X31,0XE3,0X20,0XC3,0X18,0X81,0X10,0XA2,0X18,0XA2,0X18,
-0XE3,0X20,0X45,0X31,0XE3,0X20,0XA2,0X18,0X03,0X21,0X03,0X29,0XC3,0X20,0XE3,0X20,
-0X65,0X39,0X04,0X29,0XE3,0X20,0XE3,0X28,0XA2,0X20,0X04,0X29,0X61,0X18,0X41,0X10,
-0X00,0X00,0X69,0X5A,0X8D,0X8B,0X4F,0XAC,0XF1,0XC4,0X74,0XD5,0XD5,0XDD,0X16,0XE6,
-0X57,0XEE,0X77,0XEE,0X57,0XEE,0X57,0XE6,0X57,0XE6,0X37,0XEE,0X57,0XEE,0X57,0XEE,
-0X57,0XE6,0X37,0XE6,0X16,0XE6,0X98,0XEE,0X78,0XEE,0X57,0XEE,0X36,0XE6,0X78,0XEE,
-0XB9,0XF6,0XB9,0XF6,0XB9,0XF6,0XB9,0XF6,0XD9,0XF6,0XF9,0XF6,0XF9,0XF6,0XD9,0XF6,
-0XD9,0XF6,0XB9,0XF6,0X99,0XF6,0XB9,0XF6,0X99,0XF6,0X98,0XF6,0X98,0XF6,0X78,0XEE,
-0X58,0XEE,0X57,0XEE,0X16,0XE6,0X16,0XE6,0XB5,0XDD,0X94,0XD5,0X32,0XCD,0XB1,0XBC,
-0X0E,0XA4,0X6B,0X83,0X48,0X5A,0X40,0X08,0X00,0X00,0X20,0X08,0X41,0X08,0X41,0X08,
-0X82,0X10,0X82,0X10,0X41,0X08,0X61,0X10,0XE3,0X20,0X41,0X08,0X04,0X21,0XE3,0X20,
-0X04,0X21,0X04,0X21,0X61,0X10,0XC3,0X18,0XA2,0X10,0XC3,0X18,0XA2,0X10,0X82,0X10,
-0X82,0X10,0XC3,0X18,0X04,0X21,0X04,0X21,0XE3,0X20,0XE3,0X20,0X24,0X29,0X45,0X29,
-0X04,0X29,0X04,0X29,0XC3,0X20,0X24,0X29,0X24,0X29,0XC3,0X20,0XE3,0X20,0X86,0X39,
-0X8A,0X52,0XB3,0X94,0X28,0X4A,0XEB,0X5A,0X6D,0X73,0X92,0X94,0X79,0XC6,0X7A,0XCE,
-0X18,0XBE,0X59,0XC6,0X38,0XC6,0XB6,0XB5,0X14,0X9D,0X30,0X84,0X18,0XBE,0XF7,0XBD,
-0XEB,0X62,0X18,0XBE,0XB6,0XB5,0X76,0XAD,0X96,0XAD,0XF7,0XBD,0XD7,0XB5,0XB6,0XB5,
-0XB6,0XB5,0X97,0XB5,0X96,0XAD,0X76,0XAD,0X55,0XA5,0X76,0XAD,0X75,0XAD,0X55,0XA5,
-0X35,0XA5,0X35,0XA5,0X14,0XA5,0X14,0X9D,0XF4,0X9C,0XF4,0X9C,0XF3,0X9C,0XD3,0X94,
-0XB3,0X94,0XB3,0X94,0X92,0X8C,0X92,0X8C,0X72,0X8C,0X51,0X84,0X51,0X84,0X51,0X84,
-0X6E,0X6B,0X8E,0X6B,0X8E,0X6B,0XAE,0X73,0XAF,0X73,0XCF,0X73,0XCF,0X73,0XF0,0X7B,
-0XF0,0X7B,0X10,0X7C,0X10,0X7C,0X31,0X84,0X31,0X84,0X31,0X84,0X51,0X84,0X72,0X8C,
-0X72,0X8C,0X92,0X8C,0X92,0X8C,0X93,0X94,0XB3,0X94,0XD3,0X94,0XD3,0X94,0XF4,0X9C,
-0X14,0X9D,0X14,0X9D,0X14,0X9D,0X35,0XA5,0X55,0XA5,0X55,0XA5,0X55,0XA5,0X55,0XA5,
-0X76,0XAD,0X76,0XAD,0X14,0X9D,0X96,0XAD,0X96,0XAD,0X76,0XAD,0X96,0XAD,0X34,0XA5,
-0XD7,0XBD,0XD3,0X9C,0X65,0X31,0X24,0X29,0XC3,0X18,0XA2,0X18,0X82,0X18,0X81,0X10,
-0X03,0X21,0X45,0X31,0XE3,0X20,0XC3,0X20,0XA2,0X18,0XE3,0X20,0XE3,0X20,0XE3,0X28,
-0X04,0X29,0X24,0X31,0XE3,0X20,0X03,0X29,0XE3,0X20,0XE3,0X20,0XE3,0X28,0X81,0X18,
-0X20,0X08,0XE3,0X28,0X4B,0X83,0XEE,0XA3,0XB0,0XBC,0X32,0XCD,0X94,0XD5,0XF5,0XE5,
-0X16,0XE6,0X37,0XE6,0X37,0XE6,0X16,0XDE,0XF6,0XDD,0X16,0XE6,0X16,0XE6,0X37,0XE6,
-0X57,0XE6,0X98,0XE6,0X98,0XEE,0X1A,0XF7,0X77,0XEE,0X16,0XE6,0X36,0XE6,0XD9,0XEE,
-0XFA,0XF6,0XFA,0XF6,0XF9,0XF6,0XD9,0XF6,0XB9,0XF6,0XD9,0XF6,0XD9,0XEE,0XB8,0XEE,
-0X98,0XEE,0X78,0XEE,0X78,0XEE,0X78,0XEE,0X78,0XEE,0X98,0XF6,0X98,0XF6,0X78,0XEE,
-0X37,0XEE,0X16,0XE6,0XF6,0XE5,0XD5,0XDD,0XB4,0XDD,0X53,0XCD,0XF1,0XC4,0X70,0XB4,
-0XCD,0X9B,0XEA,0X72,0X85,0X39,0X20,0X08,0X20,0X00,0X20,0X08,0X41,0X08,0X41,0X08,
-0X82,0X10,0X62,0X10,0X41,0X08,0XA2,0X10,0XA2,0X18,0X41,0X08,0XC3,0X18,0XE3,0X20,
-0X04,0X21,0X04,0X21,0XC3,0X18,0XA3,0X18,0X82,0X10,0XC3,0X18,0XA2,0X10,0X82,0X10,
-0X82,0X10,0XC3,0X18,0XC3,0X18,0XE3,0X20,0XE3,0X20,0X04,0X21,0XE3,0X20,0X24,0X29,
-0X45,0X31,0X24,0X29,0X45,0X29,0X04,0X21,0X45,0X29,0X04,0X21,0X24,0X29,0XC7,0X39,
-0XA6,0X39,0XB2,0X94,0X49,0X4A,0XEB,0X5A,0XCB,0X62,0X10,0X84,0X39,0XC6,0XF8,0XBD,
-0XF8,0XBD,0X39,0XC6,0XB7,0XB5,0XB7,0XB5,0X96,0XB5,0X30,0X84,0X18,0XBE,0X92,0X8C,
-0X4D,0X6B,0X18,0XBE,0X55,0XA5,0XD7,0XB5,0XD7,0XB5,0XF7,0XBD,0XD7,0XB5,0XD7,0XB5,
-0XB7,0XB5,0X76,0XAD,0X96,0XAD,0X96,0XAD,0X76,0XAD,0X76,0XAD,0X75,0XAD,0X55,0XA5,
-0X55,0XA5,0X35,0XA5,0X35,0XA5,0X14,0X9D,0X14,0X9D,0XF4,0X9C,0XF4,0X9C,0XD3,0X94,
-0XD3,0X94,0XB3,0X94,0X92,0X8C,0X92,0X8C,0X72,0X8C,0X72,0X8C,0X51,0X84,0X51,0X84,
-0X6E,0X6B,0X8E,0X6B,0X8E,0X6B,0XAF,0X73,0XAF,0X73,0XCF,0X73,0XEF,0X73,0XF0,0X7B,
-0XF0,0X7B,0X10,0X7C,0X10,0X7C,0X31,0X84,0X31,0X84,0X51,0X84,0X51,0X84,0X71,0X8C,
-0X72,0X8C,0X92,0X8C,0X92,0X8C,0XB3,0X94,0XB3,0X94,0XD3,0X94,0XD4,0X9C,0XF4,0X9C,
-0X14,0X9D,0X14,0X9D,0X14,0X9D,0X35,0XA5,0X35,0XA5,0X55,0XA5,0X76,0XAD,0X55,0XA5,
-0X76,0XAD,0X96,0XAD,0X96,0XAD,0X55,0XA5,0X96,0XAD,0XF7,0XBD,0XF4,0X9C,0X76,0XAD,
-0X76,0XAD,0X14,0XA5,0X08,0X42,0XE3,0X20,0XA2,0X18,0XA2,0X18,0X61,0X10,0X61,0X10,
-0XE3,0X20,0X24,0X31,0XC3,0X20,0X04,0X29,0XA2,0X18,0XE3,0X20,0XC3,0X20,0X04,0X29,
-0XC3,0X20,0X44,0X31,0XC3,0X20,0X03,0X29,0XE3,0X20,0XC3,0X20,0XE3,0X28,0XA2,0X18,
-0X61,0X18,0X00,0X00,0XC9,0X6A,0XAD,0X93,0X70,0XAC,0X11,0XC5,0X74,0XD5,0XD5,0XDD,
-0XF5,0XE5,0X16,0XE6,0X15,0XDE,0XB5,0XD5,0XB5,0XD5,0X94,0XD5,0XD5,0XDD,0X36,0XE6,
-0XB5,0XED,0XB2,0XEC,0X10,0XE4,0X14,0XF5,0XD6,0XF5,0X98,0XF6,0XDA,0XF6,0X59,0XFE,
-0XD7,0XFD,0X18,0XF6,0X38,0XF6,0XD9,0XF6,0XD9,0XF6,0X98,0XEE,0X78,0XEE,0X57,0XE6,
-0X37,0XE6,0X16,0XE6,0X37,0XE6,0X58,0XEE,0X78,0XEE,0X78,0XEE,0X78,0XEE,0X57,0XEE,
-0X37,0XE6,0X16,0XE6,0XF5,0XDD,0XB5,0XDD,0X94,0XD5,0X32,0XCD,0XB1,0XBC,0X0E,0XA4,
-0X6C,0X8B,0X47,0X5A,0X44,0X31,0X20,0X08,0X20,0X08,0X20,0X08,0X41,0X08,0X61,0X08,
-0X61,0X10,0X41,0X08,0X41,0X08,0X04,0X21,0X61,0X08,0X61,0X10,0XC3,0X18,0XE3,0X20,
-0XC3,0X20,0X25,0X29,0X04,0X21,0XC3,0X18,0XA2,0X18,0X82,0X10,0XC3,0X18,0X82,0X10,
-0X61,0X10,0X82,0X10,0XC3,0X18,0XE3,0X20,0X04,0X21,0XE3,0X20,0X24,0X29,0X03,0X21,
-0XE3,0X20,0X45,0X31,0X24,0X29,0X04,0X21,0X24,0X29,0X45,0X31,0X04,0X29,0X45,0X29,
-0XC7,0X41,0X6D,0X73,0X6E,0X73,0X89,0X52,0XC7,0X39,0X31,0X8C,0X96,0XAD,0XB6,0XAD,
-0X18,0XC6,0XF8,0XBD,0X38,0XBE,0XD7,0XB5,0X31,0X84,0XB7,0XB5,0XF4,0X9C,0XF0,0X7B,
-0XF3,0X9C,0XD7,0XB5,0XD7,0XB5,0XF7,0XBD,0XF8,0XBD,0XD7,0XB5,0XD7,0XB5,0XB7,0XB5,
-0XB6,0XB5,0XB7,0XB5,0X96,0XAD,0X76,0XAD,0X76,0XAD,0X76,0XAD,0X55,0XA5,0X55,0XA5,
-0X55,0XA5,0X35,0XA5,0X34,0XA5,0X14,0X9D,0X14,0X9D,0XF4,0X9C,0XF4,0X9C,0XD3,0X94,
-0XD3,0X94,0XB3,0X94,0X92,0X8C,0X92,0X8C,0X92,0X8C,0X72,0X8C,0X71,0X8C,0X51,0X84,
-0X8E,0X6B,0X8E,0X6B,0XAE,0X73,0XAF,0X73,0XCF,0X73,0XCF,0X73,0XCF,0X73,0XF0,0X7B,
-0XF0,0X7B,0X10,0X7C,0X10,0X7C,0X31,0X84,0X51,0X84,0X51,0X84,0X51,0X84,0X72,0X8C,
-0X92,0X8C,0X92,0X8C,0X92,0X8C,0X93,0X8C,0XB3,0X94,0XD3,0X94,0XD3,0X94,0XF4,0X9C,
-0XF4,0X9C,0X14,0X9D,0XF4,0X9C,0X15,0XA5,0X55,0XA5,0X56,0XAD,0X76,0XAD,0X55,0XA5,
-0X76,0XAD,0X96,0XAD,0XB7,0XB5,0X14,0X9D,0XD7,0XB5,0X96,0XAD,0X55,0XA5,0XB6,0XB5,
-0X76,0XAD,0X14,0XA5,0X86,0X31,0XA2,0X18,0XA2,0X18,0X81,0X10,0X81,0X10,0X81,0X10,
-0X03,0X29,0X24,0X29,0XC3,0X20,0X03,0X29,0XE3,0X20,0XE3,0X20,0X03,0X29,0XC3,0X20,
-0X03,0X29,0X04,0X29,0X03,0X29,0XE3,0X20,0X03,0X29,0X82,0X18,0XA2,0X18,0X04,0X29,
-0X61,0X18,0X41,0X10,0XE3,0X28,0X6C,0X8B,0X2F,0XA4,0XD1,0XBC,0X52,0XCD,0X93,0XD5,
-0XD5,0XDD,0XF5,0XDD,0XD4,0XD5,0X73,0XD5,0X12,0XC5,0X12,0XC5,0XB1,0XCC,0X6E,0XD3,
-0XAB,0XD2,0X8B,0XD2,0XAB,0XDA,0XAB,0XE2,0XED,0XEA,0X52,0XF4,0X52,0XF4,0XD0,0XEB,
-0X6E,0XE3,0X2D,0XDB,0X4D,0XDB,0XF0,0XE3,0X54,0XED,0X57,0XEE,0X57,0XE6,0XF6,0XDD,
-0X94,0XD5,0X94,0XD5,0XD5,0XDD,0X37,0XE6,0X78,0XEE,0X78,0XEE,0X57,0XEE,0X57,0XEE,
-0X36,0XE6,0XF6,0XE5,0XD5,0XDD,0X94,0XDD,0X53,0XCD,0XF1,0XC4,0X6F,0XB4,0XCD,0X93,
-0XC9,0X6A,0X06,0X52,0X23,0X31,0X61,0X10,0X20,0X00,0X21,0X08,0X61,0X08,0X41,0X08,
-0X62,0X10,0X61,0X08,0XC3,0X18,0XE3,0X18,0X41,0X08,0XE4,0X18,0XC3,0X18,0X04,0X21,
-0XE3,0X20,0X04,0X21,0X66,0X31,0X82,0X10,0XC3,0X18,0X82,0X10,0XA2,0X18,0XA3,0X18,
-0XA2,0X18,0XA2,0X18,0X82,0X10,0XC3,0X18,0XE3,0X20,0XE3,0X20,0XC3,0X18,0X04,0X29,
-0X04,0X29,0X24,0X29,0X24,0X29,0X45,0X31,0X04,0X21,0X04,0X21,0XE3,0X20,0X45,0X29,
-0XE3,0X20,0X85,0X31,0XAA,0X5A,0XEB,0X62,0X48,0X4A,0X30,0X8C,0X59,0XC6,0X59,0XC6,
-0XF8,0XBD,0X96,0XAD,0XB7,0XB5,0X96,0XAD,0XF4,0XA4,0XF4,0X9C,0X72,0X8C,0X49,0X4A,
-0X18,0XBE,0X96,0XAD,0XF8,0XBD,0XB7,0XB5,0XD7,0XB5,0XD7,0XB5,0XD7,0XB5,0XD7,0XB5,
-0XD7,0XB5,0XB6,0XB5,0X96,0XAD,0X96,0XAD,0X96,0XAD,0X96,0XAD,0X55,0XA5,0X76,0XAD,
-0X55,0XA5,0X55,0XA5,0X35,0XA5,0X34,0XA5,0X14,0X9D,0XF4,0X9C,0XF4,0X9C,0XF3,0X9C,
-0XD3,0X94,0XB3,0X94,0XB3,0X94,0X92,0X8C,0X92,0X8C,0X72,0X8C,0X71,0X8C,0X51,0X84,
-0X8E,0X6B,0X8E,0X6B,0XAF,0X73,0XAF,0X73,0XCF,0X73,0XCF,0X73,0XEF,0X7B,0XF0,0X7B,
-0XF0,0X7B,0X10,0X7C,0X10,0X7C,0X31,0X84,0X31,0X84,0X51,0X84,0X71,0X8C,0X72,0X8C,
-0X92,0X8C,0X92,0X8C,0XB3,0X94,0XB3,0X94,0XD3,0X94,0XD3,0X94,0XF4,0X9C,0XF4,0X9C,
-0X14,0X9D,0X15,0XA5,0X35,0XA5,0X35,0XA5,0X35,0XA5,0X55,0XA5,0X76,0XAD,0X56,0XAD,
-0X96,0XAD,0X96,0XAD,0X76,0XAD,0X96,0XAD,0X76,0XAD,0X75,0XAD,0X96,0XAD,0XB7,0XB5,
-0XD7,0XB5,0X92,0X94,0X08,0X42,0X81,0X10,0XA2,0X18,0X81,0X10,0X81,0X10,0X61,0X10,
-0X04,0X29,0X24,0X29,0XC3,0X20,0XE3,0X20,0X03,0X21,0X04,0X29,0XE3,0X20,0XE3,0X20,
-0X24,0X29,0XE3,0X20,0X24,0X29,0XE3,0X28,0X03,0X29,0XC2,0X20,0X81,0X18,0X82,0X18,
-0XC2,0X20,0X61,0X10,0X00,0X00,0XA9,0X6A,0XCD,0X93,0X6F,0XB4,0X11,0XC5,0X73,0XD5,
-0XB4,0XDD,0XB4,0XDD,0X93,0XD5,0X32,0XC5,0X2E,0XAC,0X2C,0XA3,0X29,0XAA,0X09,0XA2,
-0X09,0XAA,0XC8,0XA9,0XC8,0XB9,0X88,0XB9,0XA8,0XC9,0XAC,0XDA,0X6B,0XDA,0X46,0XA9,
-0X4A,0XB2,0X8B,0XB2,0X2A,0XAA,0X09,0XAA,0X09,0XB2,0XCB,0XBA,0XEF,0XC3,0X90,0XCC,
-0X4C,0X93,0XED,0XA3,0X93,0XD5,0XF6,0XE5,0X37,0XE6,0X57,0XEE,0X57,0XEE,0X37,0XE6,
-0X16,0XE6,0XF6,0XDD,0XD5,0XDD,0X74,0XD5,0X12,0XC5,0XB0,0XBC,0X2E,0XAC,0X4B,0X83,
-0X06,0X52,0XE6,0X51,0X44,0X31,0XA2,0X18,0X00,0X00,0X41,0X08,0X41,0X08,0X41,0X08,
-0X82,0X10,0X41,0X08,0X24,0X21,0X82,0X10,0X41,0X08,0X04,0X21,0XC3,0X18,0XC3,0X18,
-0XC3,0X18,0X04,0X21,0X66,0X31,0XC3,0X18,0XE4,0X20,0XA2,0X18,0XA2,0X18,0XA2,0X18,
-0XA2,0X18,0XA2,0X18,0XA2,0X18,0X82,0X10,0XE3,0X20,0XE3,0X20,0XE3,0X20,0XE3,0X20,
-0XE3,0X20,0XE3,0X20,0X24,0X29,0X04,0X29,0X24,0X29,0X04,0X29,0XE3,0X20,0XC3,0X20,
-0XAA,0X5A,0X24,0X29,0XCB,0X5A,0X28,0X42,0XE7,0X39,0X51,0X8C,0X96,0XAD,0X18,0XBE,
-0XD7,0XB5,0X39,0XC6,0XB7,0XB5,0X96,0XAD,0X14,0XA5,0X96,0XB5,0XD3,0X9C,0XEB,0X62,
-0XF8,0XBD,0X96,0XAD,0XB7,0XB5,0XB6,0XB5,0XD7,0XB5,0XB7,0XB5,0X96,0XAD,0X96,0XAD,
-0X76,0XAD,0XB6,0XB5,0X96,0XAD,0X96,0XAD,0X96,0XAD,0X76,0XAD,0X76,0XAD,0X76,0XAD,
-0X55,0XA5,0X55,0XA5,0X35,0XA5,0X34,0XA5,0X14,0X9D,0X14,0X9D,0XF4,0X9C,0XF4,0X9C,
-0XD3,0X94,0XB3,0X94,0XB3,0X94,0XB2,0X94,0X92,0X8C,0X92,0X8C,0X72,0X8C,0X71,0X8C,
-0X8E,0X6B,0X8E,0X6B,0XAF,0X73,0XCF,0X73,0XCF,0X73,0XEF,0X7B,0XF0,0X7B,0XF0,0X7B,
-0X10,0X7C,0X10,0X7C,0X11,0X84,0X31,0X84,0X51,0X84,0X51,0X84,0X72,0X8C,0X72,0X8C,
-0X92,0X8C,0XB2,0X8C,0XB3,0X94,0XD3,0X94,0XD3,0X94,0XF3,0X9C,0XF4,0X9C,0X14,0X9D,
-0X14,0X9D,0X15,0X9D,0X35,0XA5,0X55,0XA5,0X35,0XA5,0X75,0XAD,0X75,0XAD,0X76,0XAD,
-0X75,0XAD,0X96,0XAD,0X96,0XAD,0XB6,0XAD,0X14,0X9D,0XB7,0XB5,0X76,0XAD,0X96,0XAD,
-0X59,0XC6,0X8E,0X73,0X86,0X31,0X81,0X10,0X82,0X18,0X81,0X10,0X61,0X10,0X82,0X18,
-0X04,0X29,0X24,0X31,0XC3,0X20,0XE3,0X20,0XA2,0X18,0X24,0X29,0XE3,0X28,0X04,0X29,
-0X04,0X29,0X04,0X29,0X24,0X31,0XE3,0X28,0XE3,0X20,0XC3,0X20,0X82,0X18,0X81,0X18,
-0XC2,0X20,0X61,0X18,0X61,0X10,0XA2,0X20,0X6C,0X8B,0X0E,0XA4,0XD1,0XBC,0X52,0XCD,
-0X93,0XD5,0XB4,0XDD,0X73,0XD5,0X52,0XCD,0X2F,0XB4,0X03,0X41,0X82,0X38,0X82,0X28,
-0XE3,0X30,0X68,0X62,0XEB,0X72,0XAE,0X93,0XCE,0XAB,0XCB,0XB2,0X0C,0XA3,0X34,0XC5,
-0X58,0XCE,0X38,0XD6,0X2C,0X7B,0X89,0X6A,0X65,0X49,0XA3,0X40,0XA3,0X48,0XC4,0X58,
-0XC7,0X71,0X4F,0XB4,0XB4,0XD5,0X16,0XE6,0X37,0XE6,0X57,0XE6,0X57,0XE6,0X36,0XE6,
-0X16,0XE6,0XD5,0XDD,0X94,0XD5,0X33,0XCD,0XB1,0XBC,0X2F,0XAC,0X8C,0X93,0X88,0X62,
-0X06,0X52,0XC5,0X49,0X84,0X39,0X03,0X29,0X00,0X00,0X62,0X10,0X21,0X08,0X61,0X08,
-0X61,0X08,0X82,0X10,0X45,0X29,0X41,0X08,0XA2,0X10,0XE3,0X20,0XC3,0X18,0XC3,0X18,
-0XC3,0X18,0X04,0X21,0X45,0X29,0X04,0X21,0XE3,0X20,0XC3,0X18,0XA3,0X18,0XC3,0X18,
-0XA2,0X18,0XA2,0X18,0XA2,0X18,0XC3,0X18,0XA2,0X18,0XE3,0X20,0XE3,0X20,0XE3,0X20,
-0XE3,0X20,0XE3,0X20,0X04,0X21,0X03,0X21,0XE3,0X20,0XE3,0X20,0X24,0X29,0XE3,0X20,
-0X86,0X31,0X24,0X29,0X48,0X4A,0X0D,0X63,0X65,0X31,0X28,0X4A,0X59,0XC6,0XB7,0XB5,
-0X7A,0XCE,0XF8,0XBD,0X96,0XAD,0XB6,0XB5,0X34,0XA5,0X96,0XB5,0X30,0X84,0X31,0X8C,
-0XB7,0XB5,0X39,0XC6,0XF8,0XBD,0X18,0XBE,0X18,0XBE,0XD7,0XB5,0XD7,0XB5,0XF7,0XBD,
-0XD7,0XB5,0XB7,0XB5,0X96,0XAD,0X76,0XAD,0X55,0XA5,0X55,0XA5,0X55,0XA5,0X76,0XAD,
-0X55,0XA5,0X55,0XA5,0X35,0XA5,0X35,0XA5,0X14,0X9D,0X14,0X9D,0XF4,0X9C,0XF3,0X9C,
-0XD3,0X94,0XD3,0X94,0XB3,0X94,0XB2,0X94,0X92,0X8C,0X92,0X8C,0X72,0X8C,0X72,0X8C,
-0X8E,0X6B,0X8E,0X6B,0XAF,0X73,0XAF,0X73,0XCF,0X73,0XEF,0X7B,0XF0,0X7B,0XF0,0X7B,
-0X10,0X7C,0X10,0X7C,0X31,0X84,0X31,0X84,0X51,0X84,0X51,0X84,0X72,0X8C,0X72,0X8C,
-0X92,0X8C,0X92,0X94,0XB3,0X94,0XD3,0X94,0XD3,0X94,0XF4,0X9C,0XF4,0X9C,0X14,0X9D,
-0X34,0XA5,0X35,0XA5,0X35,0XA5,0X55,0XA5,0X55,0XA5,0X55,0XA5,0X76,0XAD,0X76,0XAD,
-0X55,0XA5,0X55,0XA5,0X76,0XAD,0X76,0XAD,0X55,0XA5,0XB7,0XB5,0X76,0XAD,0XB7,0XB5,
-0X35,0XA5,0XCF,0X7B,0X45,0X29,0X61,0X10,0X81,0X10,0X61,0X10,0X40,0X08,0XE3,0X20,
-0XE3,0X20,0X24,0X29,0XC3,0X20,0XE3,0X20,0XA2,0X18,0XE3,0X28,0X04,0X29,0X04,0X29,
-0X24,0X31,0X04,0X29,0XE3,0X20,0XE3,0X28,0XC3,0X20,0XC3,0X20,0X82,0X18,0X82,0X18,
-0X61,0X10,0XA2,0X18,0X61,0X10,0X00,0X08,0X27,0X52,0XAD,0X93,0X6F,0XAC,0X11,0XC5,
-0X73,0XD5,0X93,0XD5,0X93,0XD5,0X93,0XD5,0XD5,0XDD,0XB1,0XCC,0X6A,0X9A,0X08,0X8A,
-0XE8,0X89,0XA7,0X79,0X86,0X71,0X08,0X6A,0XCA,0X72,0X4C,0X7B,0XA9,0X6A,0XCE,0X9B,
-0X0F,0XAC,0XEF,0XAB,0X87,0X99,0XC9,0XA9,0X2A,0XBA,0X09,0XB2,0X8B,0XCA,0XEC,0XD2,
-0X95,0XE5,0X16,0XDE,0XF6,0XDD,0X16,0XE6,0X36,0XE6,0X37,0XE6,0X37,0XE6,0X16,0XE6,
-0XD5,0XDD,0X94,0XD5,0X53,0XCD,0XF1,0XC4,0X6F,0XB4,0XCD,0X9B,0XE9,0X72,0X06,0X52,
-0X26,0X5A,0XE6,0X51,0X85,0X41,0X64,0X39,0X00,0X08,0X61,0X10,0X41,0X08,0X61,0X08,
-0X41,0X08,0XE3,0X20,0XE4,0X20,0X41,0X08,0XE4,0X20,0XE3,0X20,0XC3,0X18,0XC3,0X18,
-0XC3,0X18,0XC3,0X18,0X04,0X21,0X45,0X29,0XA2,0X18,0X04,0X21,0XA3,0X18,0XC3,0X18,
-0XA2,0X18,0XC3,0X18,0XA2,0X18,0XA2,0X18,0XE3,0X20,0XA2,0X18,0XE3,0X20,0XE3,0X20,
-0XE3,0X20,0XE3,0X20,0XE3,0X20,0X03,0X21,0XE3,0X20,0XE3,0X20,0X61,0X10,0XA2,0X18,
-0X24,0X29,0X04,0X21,0X45,0X29,0X0C,0X63,0XE7,0X41,0X07,0X42,0X0C,0X63,0XB2,0X94,
-0X35,0XA5,0XD7,0XBD,0XF3,0X9C,0X55,0XAD,0X96,0XAD,0XD3,0X9C,0XCB,0X5A,0X18,0XBE,
-0XB7,0XB5,0XF7,0XBD,0X18,0XBE,0XF8,0XBD,0XD7,0XB5,0XF8,0XBD,0XF8,0XBD,0XF7,0XBD,
-0XD7,0XB5,0XD7,0XB5,0XB7,0XB5,0XB7,0XB5,0X76,0XAD,0X96,0XAD,0X76,0XAD,0X35,0XA5,
-0X35,0XA5,0X55,0XA5,0X35,0XA5,0X35,0XA5,0X34,0XA5,0X14,0X9D,0X14,0X9D,0XF4,0X9C,
-0XD3,0X94,0XD3,0X94,0XB3,0X94,0XB3,0X94,0X92,0X8C,0X92,0X8C,0X72,0X8C,0X72,0X8C,
-0X8E,0X6B,0XAF,0X73,0XAF,0X73,0XAF,0X73,0XCF,0X73,0XCF,0X7B,0XF0,0X7B,0XF0,0X7B,
-0X10,0X7C,0X30,0X84,0X31,0X84,0X51,0X84,0X51,0X84,0X71,0X8C,0X72,0X8C,0X92,0X8C,
-0X92,0X8C,0XB3,0X94,0XB3,0X94,0XB3,0X94,0XD3,0X94,0XF4,0X9C,0X14,0X9D,0X14,0X9D,
-0XF4,0X9C,0X35,0XA5,0X35,0XA5,0X55,0XA5,0X76,0XAD,0X76,0XAD,0X55,0XA5,0X76,0XAD,
-0X55,0XA5,0X14,0X9D,0X55,0XA5,0X55,0XA5,0X76,0XAD,0X35,0XA5,0X35,0XA5,0X34,0XA5,
-0X10,0X7C,0X6D,0X6B,0X85,0X31,0X81,0X10,0XA2,0X10,0X62,0X10,0X61,0X10,0XE3,0X20,
-0XC2,0X20,0X04,0X29,0XC3,0X20,0XE3,0X20,0XA2,0X18,0XE3,0X20,0XE3,0X20,0XE3,0X20,
-0X24,0X29,0X44,0X31,0XA2,0X20,0X24,0X31,0XC2,0X20,0XC3,0X20,0XA2,0X20,0X81,0X18,
-0X61,0X10,0X61,0X18,0X82,0X18,0X20,0X10,0X41,0X10,0X0B,0X7B,0XEE,0X9B,0XB0,0XB4,
-0X32,0XC5,0X93,0XD5,0X94,0XD5,0X94,0XD5,0X94,0XD5,0XB4,0XDD,0XEF,0XCB,0XCC,0XBA,
-0X0D,0XDB,0X0D,0XE3,0X0D,0XDB,0X8C,0XD2,0X09,0XB2,0XC9,0XA9,0XE9,0XB9,0X4A,0XCA,
-0X8C,0XDA,0XAD,0XE2,0XB0,0XF3,0X6F,0XEB,0X2E,0XF3,0X4E,0XEB,0X8F,0XDB,0X54,0XDD,
-0X57,0XE6,0X37,0XE6,0X16,0XE6,0X37,0XE6,0X36,0XE6,0X16,0XE6,0X16,0XE6,0XD5,0XDD,
-0XB4,0XD5,0X73,0XD5,0X11,0XC5,0X8F,0XB4,0X0D,0XA4,0X4B,0X83,0X06,0X52,0X67,0X62,
-0X47,0X5A,0X06,0X52,0XC5,0X49,0XA5,0X49,0X20,0X08,0X61,0X10,0X20,0X08,0X61,0X10,
-0X41,0X08,0X45,0X29,0X82,0X10,0X61,0X10,0X04,0X21,0XE3,0X20,0XC3,0X18,0XE3,0X18,
-0X82,0X10,0XE3,0X20,0XE3,0X20,0X24,0X29,0X82,0X10,0X24,0X29,0XE3,0X20,0XE3,0X20,
-0XC3,0X18,0XA2,0X18,0XE3,0X20,0XC3,0X18,0XC3,0X18,0XC3,0X18,0XC3,0X18,0XE3,0X20,
-0X24,0X29,0XE3,0X20,0XE3,0X20,0XC2,0X18,0XE3,0X20,0XE3,0X20,0XC3,0X18,0X81,0X10,
-0XE3,0X20,0XA6,0X39,0XE3,0X20,0X6A,0X5A,0X28,0X42,0X28,0X4A,0X55,0XAD,0XAE,0X73,
-0XEF,0X7B,0X76,0XAD,0X6E,0X6B,0XF4,0X9C,0X55,0XA5,0XCF,0X7B,0XCF,0X7B,0X18,0XBE,
-0X96,0XAD,0X39,0XC6,0X18,0XBE,0XF8,0XBD,0XF8,0XBD,0XD7,0XB5,0XF8,0XBD,0XF7,0XBD,
-0XD7,0XB5,0XD7,0XB5,0XB7,0XB5,0X96,0XAD,0XB6,0XB5,0X96,0XAD,0X76,0XAD,0X76,0XAD,
-0X75,0XAD,0X35,0XA5,0X35,0XA5,0X35,0XA5,0X34,0XA5,0X14,0X9D,0X14,0X9D,0XF4,0X9C,
-0XD3,0X94,0XD3,0X94,0XB3,0X94,0XB3,0X94,0XB2,0X94,0X92,0X8C,0X72,0X8C,0X72,0X8C,
-0X8E,0X73,0XAF,0X73,0XAF,0X73,0XCF,0X73,0XCF,0X73,0XEF,0X7B,0X10,0X7C,0X10,0X7C,
-0X10,0X7C,0X30,0X84,0X31,0X84,0X51,0X84,0X51,0X84,0X72,0X8C,0X72,0X8C,0X92,0X8C,
-0X92,0X8C,0X93,0X94,0XD3,0X94,0XD3,0X94,0XF4,0X9C,0XD3,0X94,0XF4,0X9C,0XF4,0X9C,
-0XF4,0X9C,0XF4,0X9C,0XD3,0X94,0XF3,0X9C,0X14,0X9D,0X14,0X9D,0X14,0X9D,0X14,0X9D,
-0X14,0X9D,0XF4,0X9C,0X92,0X8C,0X35,0XA5,0X55,0XA5,0X92,0X94,0X35,0XA5,0XF4,0X9C,
-0X76,0XAD,0XEB,0X62,0X03,0X21,0X61,0X10,0X61,0X10,0X61,0X10,0X61,0X10,0XE3,0X20,
-0XA2,0X18,0X04,0X29,0XE3,0X20,0XA2,0X18,0XC3,0X18,0XC3,0X20,0XC3,0X18,0XE3,0X28,
-0X04,0X29,0X24,0X31,0X24,0X29,0X04,0X29,0XA2,0X20,0XE3,0X20,0XA2,0X18,0X81,0X18,
-0X81,0X18,0X41,0X10,0X61,0X18,0X82,0X18,0X00,0X00,0X64,0X39,0X6C,0X8B,0X2E,0XAC,
-0XF1,0XBC,0X73,0XCD,0X93,0XD5,0XB4,0XD5,0XB4,0XD5,0XB4,0XD5,0XF1,0XC4,0XAF,0XC3,
-0XCD,0XCA,0X0D,0XEB,0X6F,0XF3,0XD0,0XFB,0XAF,0XEB,0X31,0XF4,0X8F,0XFB,0X73,0XF4,
-0X32,0XF4,0XF1,0XF3,0XAF,0XF3,0X4E,0XEB,0X4E,0XE3,0X6E,0XD3,0X33,0XD5,0X16,0XDE,
-0X17,0XE6,0X37,0XE6,0X37,0XE6,0X36,0XE6,0X16,0XE6,0XF5,0XDD,0XD5,0XDD,0X93,0XD5,
-0X73,0XCD,0X11,0XC5,0X8F,0XB4,0X0D,0XA4,0X6C,0X8B,0X47,0X62,0X47,0X62,0X68,0X62,
-0X67,0X62,0X26,0X52,0X06,0X52,0XC5,0X49,0X81,0X18,0X20,0X08,0X20,0X00,0X61,0X08,
-0X41,0X08,0X04,0X21,0X61,0X08,0X82,0X10,0X45,0X29,0XC3,0X18,0XC3,0X18,0XC3,0X18,
-0X82,0X10,0XC3,0X18,0XC3,0X18,0X24,0X29,0XE4,0X20,0XC3,0X18,0X04,0X21,0XC3,0X18,
-0XE3,0X20,0XC3,0X18,0XA2,0X18,0XC3,0X20,0XC3,0X20,0XC3,0X20,0XE3,0X20,0XE3,0X20,
-0XE3,0X20,0X04,0X21,0X24,0X29,0XC3,0X18,0X82,0X10,0X04,0X21,0XA2,0X18,0XA2,0X18,
-0X61,0X10,0XE7,0X41,0X04,0X21,0X24,0X29,0X8A,0X52,0X03,0X29,0X55,0XA5,0X39,0XC6,
-0X31,0X84,0X8E,0X73,0XAF,0X73,0X18,0XC6,0XD4,0X9C,0X49,0X52,0XD8,0XBD,0XB7,0XB5,
-0X76,0XAD,0XF8,0XBD,0XF8,0XBD,0XF8,0XBD,0XF7,0XBD,0XF8,0XBD,0XD7,0XB5,0XF8,0XBD,
-0XD7,0XB5,0XB6,0XB5,0XB7,0XB5,0XB7,0XB5,0X96,0XAD,0X96,0XAD,0X96,0XAD,0X76,0XAD,
-0X76,0XAD,0X75,0XAD,0X35,0XA5,0X14,0X9D,0X34,0XA5,0X14,0X9D,0X14,0X9D,0XF4,0X9C,
-0XF3,0X9C,0XD3,0X94,0XD3,0X94,0XB3,0X94,0X92,0X8C,0X92,0X8C,0X92,0X8C,0X72,0X8C,
-0X8E,0X73,0X8F,0X73,0XAF,0X73,0XCF,0X73,0XEF,0X73,0XEF,0X7B,0XF0,0X7B,0X10,0X7C,
-0X10,0X7C,0X31,0X84,0X31,0X84,0X51,0X84,0X51,0X84,0X72,0X8C,0X92,0X8C,0X92,0X8C,
-0X92,0X8C,0XB3,0X94,0XD3,0X94,0XF3,0X94,0XF4,0X9C,0XF4,0X9C,0XF4,0X9C,0XF4,0X9C,
-0X14,0X9D,0X14,0X9D,0X55,0XA5,0X55,0XA5,0X55,0XA5,0X75,0XAD,0X75,0XAD,0X75,0XAD,
-0X14,0X9D,0XB7,0XB5,0X96,0XAD,0X35,0XA5,0X35,0XA5,0XB3,0X94,0XCF,0X7B,0X76,0XAD,
-0XB3,0X94,0X28,0X4A,0XE3,0X20,0X81,0X10,0X61,0X10,0X61,0X10,0X82,0X18,0XC2,0X18,
-0XC2,0X20,0XE3,0X20,0XE3,0X20,0XC2,0X18,0XE3,0X20,0XC3,0X20,0X04,0X21,0XA2,0X20,
-0X04,0X29,0X44,0X31,0XE3,0X28,0XE3,0X20,0X04,0X29,0X82,0X18,0XA2,0X20,0X82,0X18,
-0X61,0X18,0X61,0X18,0X41,0X10,0X41,0X10,0X61,0X10,0X00,0X00,0X89,0X6A,0XCD,0X9B,
-0X90,0XB4,0X32,0XC5,0X73,0XD5,0XB4,0XD5,0XB4,0XD5,0X94,0XD5,0X53,0XCD,0X4F,0XAC,
-0X8E,0XC3,0XAC,0XD2,0X0D,0XEB,0X8F,0XF3,0XF1,0XEB,0X11,0XEC,0XD0,0XF3,0X73,0XF4,
-0X11,0XFC,0X4E,0XF3,0XED,0XE2,0X0D,0XD3,0X8D,0XC3,0X12,0XCD,0XD5,0XDD,0X16,0XE6,
-0X37,0XE6,0X57,0XE6,0X57,0XE6,0X37,0XE6,0X16,0XDE,0XF5,0XDD,0XB4,0XD5,0X53,0XCD,
-0X11,0XC5,0XB0,0XBC,0X0D,0XA4,0X8C,0X93,0X68,0X62,0X06,0X5A,0X68,0X6A,0X88,0X6A,
-0X88,0X6A,0X68,0X62,0X47,0X5A,0XE6,0X51,0XC2,0X20,0X00,0X00,0X20,0X08,0X20,0X00,
-0X82,0X10,0XA3,0X18,0X62,0X10,0XE4,0X20,0X24,0X29,0X04,0X21,0XA3,0X18,0XE3,0X20,
-0X82,0X10,0XA2,0X18,0XE3,0X20,0XE3,0X20,0X65,0X31,0XA2,0X18,0X04,0X21,0XE3,0X20,
-0XC3,0X18,0X03,0X21,0XC3,0X18,0XA2,0X18,0XC3,0X18,0XC3,0X20,0XE3,0X20,0XE3,0X20,
-0XE3,0X20,0XC3,0X18,0XC3,0X18,0X04,0X21,0XC3,0X18,0XE3,0X20,0X04,0X21,0X81,0X10,
-0X82,0X10,0X61,0X10,0XE3,0X20,0X04,0X21,0XC7,0X39,0XA2,0X18,0X50,0X8C,0XF7,0XBD,
-0XB7,0XB5,0X92,0X8C,0X2D,0X6B,0X14,0XA5,0X8A,0X52,0X51,0X8C,0X18,0XBE,0X18,0XBE,
-0X96,0XAD,0X18,0XBE,0XD7,0XB5,0XD7,0XB5,0XB7,0XB5,0XB6,0XB5,0X76,0XAD,0X76,0XAD,
-0XB7,0XB5,0XB7,0XB5,0XB7,0XB5,0X96,0XAD,0X96,0XAD,0X76,0XAD,0X55,0XA5,0X55,0XA5,
-0X35,0XA5,0X14,0X9D,0X34,0XA5,0X55,0XA5,0X35,0XA5,0X14,0X9D,0X14,0X9D,0XF4,0X9C,
-0XF3,0X9C,0XD3,0X94,0XB3,0X94,0XB3,0X94,0X92,0X8C,0X92,0X8C,0X72,0X8C,0X72,0X8C,
-0XAE,0X6B,0XAF,0X73,0XCF,0X73,0XCF,0X73,0XEF,0X7B,0XF0,0X7B,0X10,0X7C,0X10,0X7C,
-0X10,0X7C,0X31,0X84,0X31,0X84,0X51,0X84,0X51,0X8C,0X72,0X8C,0X72,0X8C,0X92,0X8C,
-0XB2,0X94,0XB3,0X94,0XD3,0X94,0XD3,0X94,0XD3,0X94,0XF3,0X9C,0X14,0X9D,0X14,0X9D,
-0X35,0XA5,0X55,0XA5,0X55,0XA5,0X75,0XAD,0X76,0XAD,0X76,0XAD,0X96,0XAD,0X76,0XAD,
-0X96,0XAD,0X55,0XA5,0X55,0XA5,0XD7,0XB5,0X55,0XAD,0X71,0X8C,0X31,0X84,0XEF,0X7B,
-0X08,0X42,0XA6,0X39,0X61,0X10,0X81,0X10,0X61,0X10,0X81,0X10,0XA2,0X18,0XA2,0X20,
-0XA2,0X20,0XC3,0X20,0XA2,0X18,0XA2,0X18,0XC3,0X18,0XA2,0X18,0XA2,0X18,0XC2,0X18,
-0XE3,0X20,0X44,0X31,0XA2,0X18,0X24,0X29,0XE3,0X28,0X61,0X18,0XA2,0X18,0X82,0X18,
-0XA2,0X18,0X61,0X10,0X40,0X10,0X61,0X10,0X20,0X10,0X41,0X10,0X82,0X18,0X8C,0X8B,
-0X2E,0XA4,0XD1,0XBC,0X73,0XCD,0XB4,0XD5,0XD4,0XDD,0XB4,0XD5,0X73,0XCD,0X12,0XC5,
-0X4F,0XAC,0X8E,0XB3,0XCC,0XCA,0X0D,0XDB,0X6E,0XEB,0XB0,0XEB,0X8F,0XEB,0X6F,0XEB,
-0X2E,0XE3,0X0C,0XCB,0X6D,0XBB,0X4F,0XB4,0X32,0XC5,0XB4,0XD5,0X16,0XDE,0X37,0XE6,
-0X37,0XE6,0X37,0XE6,0X36,0XE6,0X36,0XE6,0X15,0XE6,0XD4,0XDD,0X93,0XD5,0X11,0XC5,
-0XB0,0XBC,0X2E,0XAC,0X8C,0X93,0X68,0X6A,0XE6,0X51,0X68,0X62,0X88,0X72,0XC9,0X72,
-0XC8,0X72,0XA8,0X6A,0X67,0X62,0X26,0X5A,0X64,0X39,0X00,0X00,0X20,0X08,0X20,0X08,
-0XA2,0X18,0X82,0X10,0XC3,0X18,0X04,0X21,0XC3,0X18,0XE3,0X20,0X82,0X10,0XE3,0X18,
-0X82,0X10,0X82,0X10,0XE4,0X20,0XC3,0X18,0X24,0X29,0X04,0X21,0XE4,0X20,0XE4,0X20,
-0XA2,0X18,0XE3,0X20,0XE3,0X20,0XA2,0X18,0XC3,0X20,0XC3,0X20,0XE3,0X20,0XA2,0X18,
-0XE3,0X20,0XE3,0X20,0XC3,0X18,0XC3,0X18,0XE3,0X20,0XA2,0X18,0X24,0X29,0XE3,0X20,
-0XA2,0X18,0X82,0X10,0X61,0X10,0X03,0X21,0X69,0X52,0X61,0X10,0XCA,0X5A,0X30,0X84,
-0XF8,0XBD,0XB2,0X94,0XB2,0X94,0X6E,0X73,0X49,0X4A,0XD7,0XBD,0XD7,0XBD,0X39,0XC6,
-0X76,0XAD,0XB7,0XB5,0XD7,0XB5,0XF8,0XBD,0XF8,0XBD,0XF7,0XBD,0X18,0XBE,0XF8,0XBD,
-0XF7,0XBD,0XD7,0XB5,0XD7,0XB5,0XD7,0XB5,0XB7,0XB5,0X96,0XAD,0X96,0XAD,0X76,0XAD,
-0X76,0XAD,0X75,0XAD,0X55,0XA5,0X55,0XA5,0X35,0XA5,0X15,0XA5,0X14,0X9D,0X14,0X9D,
-0XF4,0X9C,0XF3,0X9C,0XD3,0X94,0XB3,0X94,0XB3,0X94,0X92,0X8C,0X92,0X8C,0X72,0X8C,
-0X8E,0X6B,0XAF,0X73,0XCF,0X73,0XCF,0X73,0XF0,0X7B,0XF0,0X7B,0XF0,0X7B,0X10,0X7C,
-0X10,0X84,0X31,0X84,0X51,0X84,0X51,0X84,0X72,0X8C,0X72,0X8C,0X92,0X8C,0X92,0X8C,
-0XB3,0X94,0XD3,0X94,0XB3,0X94,0XD3,0X94,0XF4,0X9C,0X14,0X9D,0X14,0X9D,0X34,0XA5,
-0X35,0XA5,0X35,0XA5,0X55,0XA5,0X75,0XAD,0X76,0XAD,0X76,0XAD,0X55,0XA5,0X96,0XAD,
-0X96,0XAD,0X96,0XAD,0XB7,0XB5,0X55,0XA5,0X75,0XAD,0X10,0X84,0XD3,0X9C,0XD3,0X9C,
-0XEB,0X5A,0X69,0X52,0X61,0X10,0X61,0X10,0X81,0X10,0X81,0X10,0X82,0X18,0XC2,0X20,
-0X82,0X18,0XC3,0X20,0XC2,0X18,0X61,0X10,0XC3,0X18,0XC3,0X18,0X82,0X10,0X81,0X10,
-0XC2,0X18,0X45,0X31,0XC2,0X20,0X82,0X18,0X03,0X29,0XC3,0X20,0X61,0X18,0X81,0X18,
-0X61,0X18,0X61,0X18,0X61,0X10,0X41,0X10,0X40,0X10,0X41,0X10,0X00,0X00,0XA6,0X41,
-0XCD,0X93,0X8F,0XAC,0X32,0XC5,0X94,0XD5,0XD5,0XDD,0XD5,0XDD,0XB4,0XD5,0X73,0XCD,
-0X31,0XC5,0XAF,0XB4,0X6F,0XAC,0X0E,0XB4,0X0E,0XB4,0X0E,0XB4,0X0E,0XB4,0X2E,0XB4,
-0X4E,0XB4,0X8F,0XB4,0XF1,0XC4,0X73,0XCD,0XD4,0XDD,0XF5,0XDD,0X16,0XE6,0X36,0XE6,
-0X16,0XE6,0X16,0XE6,0X36,0XE6,0X16,0XE6,0XF5,0XDD,0XB4,0XDD,0X52,0XCD,0XD0,0XBC,
-0X4E,0XAC,0X8B,0X93,0X88,0X6A,0XE6,0X51,0X68,0X6A,0XC9,0X72,0XE9,0X7A,0XE9,0X7A,
-0XE9,0X7A,0XC9,0X7A,0XA8,0X72,0X47,0X62,0XC5,0X49,0X40,0X08,0X20,0X08,0X21,0X08,
-0X82,0X10,0X82,0X10,0XC3,0X18,0X04,0X21,0XE3,0X20,0X82,0X10,0XA3,0X18,0X62,0X10,
-0X82,0X10,0X41,0X08,0XE3,0X20,0XC3,0X18,0XC3,0X18,0X65,0X31,0XC3,0X18,0X04,0X21,
-0X04,0X21,0XA2,0X18,0XE3,0X20,0X82,0X18,0XC3,0X20,0XE3,0X20,0X03,0X21,0XC2,0X18,
-0XC3,0X18,0XE3,0X20,0XE3,0X20,0XC3,0X18,0XA2,0X18,0XA2,0X18,0XE3,0X20,0XC3,0X18,
-0X82,0X10,0X82,0X10,0XA2,0X18,0X61,0X10,0X86,0X31,0X85,0X31,0XAA,0X52,0X2C,0X63,
-0X2D,0X6B,0X34,0XA5,0XB3,0X94,0XC7,0X39,0X30,0X84,0X55,0XAD,0X55,0XA5,0XF8,0XBD,
-0X39,0XC6,0XD7,0XB5,0X39,0XC6,0X18,0XBE,0X18,0XBE,0X18,0XBE,0XF8,0XBD,0XF8,0XBD,
-0XF8,0XBD,0XF7,0XBD,0XD7,0XB5,0XD7,0XB5,0XB7,0XB5,0X96,0XAD,0X96,0XAD,0X76,0XAD,
-0X76,0XAD,0X76,0XAD,0X55,0XA5,0X55,0XA5,0X35,0XA5,0X15,0XA5,0X14,0X9D,0X14,0X9D,
-0XF4,0X9C,0XF3,0X9C,0XD3,0X94,0XD3,0X94,0XB3,0X94,0X92,0X8C,0X92,0X8C,0X72,0X8C,
-0XAE,0X73,0XAF,0X73,0XCF,0X73,0XCF,0X73,0XF0,0X7B,0XF0,0X7B,0XF0,0X7B,0X10,0X7C,
-0X31,0X84,0X31,0X84,0X51,0X84,0X51,0X84,0X72,0X8C,0X92,0X8C,0X92,0X8C,0XB2,0X94,
-0XB3,0X94,0X92,0X8C,0XD3,0X94,0XF4,0X9C,0XF4,0X9C,0XF4,0X9C,0X14,0X9D,0X14,0X9D,
-0X34,0XA5,0X35,0XA5,0X35,0XA5,0X35,0XA5,0X35,0XA5,0X55,0XA5,0X76,0XAD,0X76,0XAD,
-0X76,0XAD,0X96,0XAD,0X96,0XAD,0X96,0XAD,0X14,0XA5,0X72,0X8C,0X14,0X9D,0XAE,0X7B,
-0X4D,0X6B,0X65,0X31,0X61,0X10,0X81,0X10,0X61,0X10,0XA2,0X18,0XA2,0X18,0XA2,0X18,
-0X82,0X18,0XA2,0X18,0XC2,0X18,0X81,0X10,0X82,0X10,0XE3,0X20,0X61,0X10,0X61,0X10,
-0XC2,0X20,0X24,0X31,0X82,0X18,0X61,0X10,0XC3,0X20,0XC2,0X20,0X82,0X18,0X61,0X10,
-0X61,0X18,0X81,0X18,0X61,0X10,0X40,0X08,0X40,0X10,0X00,0X00,0X61,0X10,0X00,0X00,
-0XA9,0X62,0X0E,0XA4,0XD1,0XBC,0X53,0XCD,0XB4,0XD5,0XF6,0XDD,0XF6,0XDD,0XD5,0XDD,
-0XB4,0XD5,0X73,0XCD,0X32,0XC5,0XF1,0XC4,0XD0,0XBC,0XB0,0XBC,0XB0,0XBC,0XF1,0XBC,
-0X11,0XC5,0X52,0XCD,0X94,0XD5,0XF6,0XDD,0X57,0XE6,0X37,0XE6,0X37,0XE6,0X57,0XE6,
-0X36,0XE6,0X36,0XE6,0X16,0XE6,0X16,0XDE,0XD4,0XDD,0X73,0XD5,0XF0,0XBC,0X2E,0XAC,
-0X8C,0X93,0X88,0X72,0XC5,0X51,0X68,0X6A,0XC9,0X72,0XE9,0X7A,0X29,0X83,0X09,0X83,
-0X29,0X83,0X09,0X83,0XE8,0X72,0X68,0X6A,0XE6,0X51,0X44,0X31,0X00,0X00,0X41,0X08,
-0X61,0X10,0X61,0X10,0X03,0X21,0XC3,0X18,0XA2,0X18,0XA2,0X18,0X82,0X10,0X41,0X08,
-0X61,0X10,0X41,0X08,0XE3,0X20,0XC3,0X18,0XA2,0X18,0X04,0X21,0X04,0X21,0XE4,0X20,
-0X24,0X29,0XC3,0X18,0XC3,0X18,0XA2,0X18,0XC2,0X20,0XC3,0X20,0XE3,0X20,0XC3,0X18,
-0XA3,0X18,0XE3,0X20,0XC3,0X18,0XC3,0X18,0XA2,0X18,0XA2,0X18,0X61,0X10,0XC3,0X18,
-0XE3,0X20,0X41,0X08,0X61,0X10,0X82,0X10,0X82,0X18,0XA2,0X18,0X65,0X31,0XAF,0X73,
-0X6D,0X6B,0X49,0X4A,0X69,0X52,0X51,0X8C,0XD7,0XB5,0X72,0X8C,0XD7,0XBD,0XB7,0XB5,
-0XF8,0XBD,0X17,0XBE,0X39,0XC6,0X18,0XBE,0X18,0XBE,0X18,0XBE,0XF8,0XBD,0XF8,0XBD,
-0XF7,0XBD,0XF7,0XBD,0XD7,0XB5,0XD7,0XB5,0XB7,0XB5,0X97,0XB5,0X96,0XAD,0X96,0XAD,
-0X76,0XAD,0X75,0XAD,0X55,0XA5,0X55,0XA5,0X35,0XA5,0X35,0XA5,0X14,0X9D,0X14,0X9D,
-0XF4,0X9C,0XF4,0X9C,0XD3,0X94,0XD3,0X94,0XB3,0X94,0XB2,0X94,0X92,0X8C,0X72,0X8C,
-0XAF,0X73,0XAF,0X73,0XCF,0X73,0XCF,0X73,0XF0,0X7B,0XF0,0X7B,0X10,0X7C,0X30,0X84,
-0X31,0X84,0X31,0X84,0X51,0X84,0X71,0X8C,0X72,0X8C,0X72,0X8C,0X92,0X8C,0X92,0X8C,
-0X92,0X8C,0XD3,0X94,0XD3,0X94,0XF3,0X9C,0XF4,0X9C,0X14,0X9D,0X14,0X9D,0X35,0XA5,
-0X35,0XA5,0X55,0XA5,0X55,0XA5,0X75,0XAD,0X76,0XAD,0X96,0XAD,0X96,0XAD,0X96,0XAD,
-0X96,0XAD,0X96,0XAD,0X96,0XAD,0X35,0XA5,0X55,0XA5,0XD3,0X9C,0X92,0X94,0XCB,0X5A,
-0XCF,0X7B,0XA2,0X18,0X82,0X10,0X81,0X10,0XA2,0X18,0X82,0X18,0X81,0X10,0XA2,0X18,
-0XA2,0X18,0X82,0X18,0XA2,0X18,0X61,0X10,0XA2,0X18,0X82,0X10,0X82,0X10,0X41,0X08,
-0X82,0X18,0X24,0X31,0X81,0X10,0X61,0X10,0X40,0X10,0XE3,0X20,0XA2,0X20,0X81,0X18,
-0X20,0X10,0X81,0X10,0X61,0X10,0X61,0X10,0X61,0X10,0X00,0X08,0X20,0X08,0X20,0X08,
-0X00,0X08,0X4C,0X83,0X4F,0XAC,0XF2,0XBC,0X94,0XD5,0XF5,0XDD,0X36,0XE6,0X37,0XE6,
-0X17,0XE6,0X16,0XE6,0XF5,0XDD,0XD5,0XDD,0XD5,0XDD,0XD5,0XDD,0XB5,0XD5,0XD5,0XDD,
-0XF5,0XDD,0X36,0XE6,0X37,0XE6,0X78,0XEE,0X98,0XEE,0X98,0XEE,0X78,0XEE,0X57,0XEE,
-0X36,0XE6,0X16,0XE6,0XF5,0XE5,0XF5,0XDD,0X93,0XD5,0X11,0XC5,0X2E,0XAC,0X6B,0X8B,
-0X47,0X6A,0XA5,0X49,0X47,0X62,0XE9,0X7A,0X29,0X83,0X4A,0X8B,0X4A,0X8B,0X6A,0X8B,
-0X4A,0X8B,0X2A,0X83,0X09,0X7B,0XA8,0X72,0X67,0X62,0XE6,0X51,0X82,0X18,0X20,0X00,
-0X41,0X08,0X81,0X10,0XA2,0X18,0X82,0X18,0XA2,0X18,0X41,0X08,0X61,0X10,0X61,0X10,
-0X61,0X10,0X41,0X08,0XA2,0X18,0X82,0X10,0XE3,0X20,0XA3,0X18,0X45,0X29,0XC3,0X18,
-0X04,0X21,0X24,0X29,0XC2,0X18,0XE3,0X20,0XA2,0X18,0XE3,0X20,0XE3,0X20,0XC2,0X18,
-0XA2,0X18,0XE3,0X20,0XC3,0X18,0XE3,0X20,0XA2,0X18,0XA2,0X18,0X82,0X10,0X61,0X10,
-0XA2,0X18,0X61,0X10,0X61,0X10,0X61,0X10,0XE3,0X20,0X82,0X18,0XA2,0X18,0X2D,0X6B,
-0X4D,0X6B,0X28,0X4A,0X24,0X29,0X96,0XB5,0X96,0XAD,0XD7,0XB5,0XD3,0X94,0XD7,0XBD,
-0XD7,0XB5,0XF7,0XBD,0X39,0XC6,0X18,0XBE,0X18,0XBE,0X18,0XBE,0XF8,0XBD,0XF8,0XBD,
-0XF8,0XBD,0XF8,0XBD,0XD7,0XB5,0XD7,0XB5,0XB7,0XB5,0XB7,0XB5,0X96,0XAD,0X96,0XAD,
-0X76,0XAD,0X76,0XAD,0X55,0XA5,0X55,0XA5,0X55,0XA5,0X35,0XA5,0X14,0X9D,0X14,0X9D,
-0XF4,0X9C,0XF4,0X9C,0XD3,0X94,0XD3,0X94,0XB3,0X94,0X92,0X8C,0X92,0X8C,0X92,0X8C,
-0XAF,0X73,0XAF,0X73,0XCF,0X73,0XEF,0X7B,0XF0,0X7B,0XF0,0X7B,0X10,0X7C,0X30,0X84,
-0X31,0X84,0X51,0X84,0X51,0X84,0X51,0X84,0X72,0X8C,0X92,0X8C,0X92,0X8C,0X92,0X8C,
-0XB3,0X94,0XD3,0X94,0XD3,0X94,0XF4,0X9C,0XF4,0X9C,0X14,0X9D,0X14,0X9D,0X35,0X9D,
-0X35,0XA5,0X55,0XA5,0X55,0XA5,0X55,0XA5,0X76,0XAD,0X96,0XAD,0X96,0XAD,0X96,0XAD,
-0XB7,0XB5,0XB7,0XB5,0X76,0XAD,0X55,0XA5,0X55,0XA5,0XB2,0X94,0XAF,0X7B,0X10,0X84,
-0X8A,0X52,0XA2,0X18,0XC2,0X18,0X81,0X10,0XA2,0X18,0XA2,0X18,0X61,0X10,0X82,0X18,
-0XC2,0X18,0X61,0X10,0X82,0X18,0X82,0X10,0X82,0X10,0X61,0X10,0X41,0X08,0X41,0X08,
-0X61,0X10,0X24,0X31,0X82,0X18,0X20,0X08,0X20,0X10,0X81,0X18,0XC3,0X20,0X81,0X18,
-0X61,0X18,0X60,0X10,0X40,0X08,0X20,0X08,0X20,0X08,0X20,0X08,0X00,0X08,0X00,0X00,
-0X00,0X00,0X61,0X10,0XAD,0X93,0X90,0XB4,0X53,0XCD,0XD5,0XDD,0X16,0XE6,0X57,0XEE,
-0X58,0XEE,0X78,0XEE,0X78,0XEE,0X98,0XEE,0X78,0XEE,0X98,0XEE,0X78,0XEE,0X98,0XEE,
-0X98,0XEE,0XB9,0XEE,0XD9,0XF6,0XB9,0XEE,0XD9,0XF6,0XB9,0XF6,0X78,0XEE,0X57,0XEE,
-0X36,0XE6,0X16,0XE6,0XD5,0XDD,0X93,0XD5,0XF1,0XC4,0X2E,0XAC,0X4B,0X8B,0X06,0X5A,
-0XA4,0X49,0X47,0X62,0XE9,0X7A,0X2A,0X83,0X8B,0X93,0X8B,0X93,0X8B,0X93,0X8B,0X93,
-0X8B,0X93,0X6B,0X8B,0X2A,0X8B,0XE9,0X7A,0XA8,0X6A,0X84,0X41,0X44,0X31,0X00,0X08,
-0X61,0X10,0X82,0X10,0X61,0X10,0X82,0X10,0X20,0X08,0X41,0X08,0X61,0X10,0X41,0X08,
-0X41,0X08,0X41,0X08,0XA2,0X18,0X82,0X10,0XA2,0X18,0XC3,0X18,0X24,0X29,0X04,0X21,
-0XC3,0X18,0X24,0X29,0XE3,0X20,0XE3,0X20,0XE3,0X20,0XC3,0X20,0XC2,0X18,0XC2,0X18,
-0XA2,0X18,0XE3,0X20,0XA2,0X18,0XE3,0X20,0XE3,0X20,0XA2,0X18,0X82,0X10,0X81,0X10,
-0X82,0X10,0X61,0X10,0X82,0X10,0X61,0X10,0XE3,0X20,0X04,0X21,0XA2,0X18,0XA6,0X39,
-0XEC,0X62,0X86,0X31,0X6E,0X6B,0X29,0X42,0X10,0X84,0X39,0XC6,0X18,0XBE,0X92,0X94,
-0X96,0XAD,0X39,0XC6,0X39,0XC6,0X18,0XBE,0X18,0XBE,0X18,0XBE,0X18,0XBE,0XF8,0XBD,
-0XF8,0XBD,0XF7,0XBD,0XD7,0XB5,0XD7,0XB5,0XB7,0XB5,0XB7,0XB5,0XB6,0XB5,0X96,0XAD,
-0X96,0XAD,0X76,0XAD,0X75,0XAD,0X55,0XA5,0X55,0XA5,0X35,0XA5,0X34,0XA5,0X14,0X9D,
-0X14,0X9D,0XF4,0X9C,0XD3,0X94,0XD3,0X94,0XB3,0X94,0XB2,0X94,0X92,0X8C,0X92,0X8C,
-0XAF,0X73,0XCF,0X73,0XCF,0X73,0XF0,0X7B,0XF0,0X7B,0X10,0X7C,0X10,0X7C,0X10,0X7C,
-0X31,0X84,0X51,0X84,0X51,0X84,0X72,0X8C,0X72,0X8C,0X72,0X8C,0X72,0X8C,0XB3,0X94,
-0XB3,0X94,0XD3,0X94,0XD3,0X94,0XF4,0X9C,0XF4,0X9C,0X14,0X9D,0X14,0X9D,0X35,0XA5,
-0X35,0XA5,0X55,0XA5,0X55,0XA5,0X76,0XAD,0X76,0XAD,0X76,0XAD,0X96,0XAD,0X76,0XAD,
-0X76,0XAD,0X35,0XA5,0X34,0XA5,0X96,0XB5,0X96,0XAD,0XF3,0X9C,0X89,0X52,0X51,0X8C,
-0X65,0X31,0XA2,0X18,0XA2,0X18,0XA2,0X18,0X81,0X10,0XA2,0X18,0X61,0X10,0XA2,0X18,
-0XA2,0X18,0X82,0X10,0XA2,0X18,0X82,0X10,0X82,0X10,0X82,0X10,0X61,0X10,0X81,0X10,
-0XC2,0X18,0X03,0X29,0X81,0X18,0X20,0X08,0X40,0X08,0X40,0X08,0XA2,0X20,0XA2,0X20,
-0X61,0X18,0X81,0X18,0X61,0X18,0X40,0X08,0X61,0X10,0X00,0X08,0X00,0X08,0X00,0X00,
-0X00,0X00,0X00,0X00,0XE3,0X28,0X2E,0XA4,0XF2,0XBC,0X94,0XD5,0X15,0XE6,0X57,0XE6,
-0X98,0XEE,0X98,0XF6,0X98,0XEE,0XB9,0XEE,0XD9,0XF6,0XD9,0XEE,0XD9,0XEE,0XD9,0XEE,
-0XF9,0XF6,0XFA,0XF6,0X1A,0XF7,0XFA,0XF6,0XB9,0XF6,0X98,0XEE,0X77,0XEE,0X36,0XE6,
-0X16,0XE6,0XD4,0XDD,0X73,0XD5,0XF1,0XC4,0X2E,0XAC,0X2A,0X83,0XC5,0X51,0X84,0X49,
-0X47,0X62,0XE9,0X7A,0X4A,0X8B,0X8B,0X93,0XCC,0X9B,0XEC,0X9B,0XCC,0X9B,0XCB,0X9B,
-0XAB,0X93,0XAB,0X93,0X8A,0X93,0X2A,0X8B,0X67,0X6A,0X67,0X62,0XA5,0X41,0XC2,0X20,
-0X41,0X10,0X61,0X10,0X61,0X10,0X41,0X08,0X41,0X08,0X41,0X08,0X20,0X08,0X40,0X08,
-0X41,0X08,0X41,0X08,0X61,0X10,0XA2,0X18,0X62,0X10,0XC3,0X18,0XE4,0X20,0X45,0X29,
-0XE3,0X20,0X03,0X21,0X04,0X21,0XC2,0X18,0X04,0X21,0XC3,0X18,0XC2,0X18,0XC3,0X20,
-0XA2,0X18,0XE3,0X20,0XA2,0X18,0XC3,0X18,0X45,0X29,0XE3,0X20,0X61,0X10,0XA2,0X18,
-0X81,0X10,0X61,0X10,0XA2,0X18,0X61,0X10,0XA2,0X18,0X24,0X29,0XE7,0X41,0X04,0X21,
-0XC7,0X39,0XC7,0X39,0XB2,0X94,0XEF,0X7B,0XEF,0X7B,0X71,0X8C,0X96,0XAD,0XD7,0XB5,
-0X51,0X8C,0X9A,0XCE,0XF8,0XBD,0X38,0XC6,0X18,0XBE,0X18,0XBE,0XF8,0XBD,0XF8,0XBD,
-0XF8,0XBD,0XF8,0XBD,0XF7,0XBD,0XD7,0XB5,0XD7,0XB5,0XB7,0XB5,0XB6,0XB5,0X96,0XAD,
-0X76,0XAD,0X76,0XAD,0X75,0XAD,0X55,0XA5,0X55,0XA5,0X35,0XA5,0X35,0XA5,0X14,0X9D,
-0X14,0X9D,0XF4,0X9C,0XF3,0X9C,0XD3,0X94,0XB3,0X94,0X93,0X94,0X92,0X8C,0X92,0X8C,
-0XAF,0X73,0XCF,0X73,0XCF,0X73,0XEF,0X7B,0XF0,0X7B,0X10,0X7C,0X10,0X7C,0X31,0X84,
-0X31,0X84,0X51,0X84,0X51,0X84,0X72,0X8C,0X92,0X8C,0X72,0X8C,0X92,0X94,0X93,0X94,
-0XB3,0X94,0XD3,0X94,0XD3,0X94,0XF4,0X9C,0X14,0X9D,0X14,0X9D,0X14,0X9D,0X35,0XA5,
-0X35,0XA5,0X35,0XA5,0X35,0XA5,0X55,0XA5,0X55,0XA5,0X75,0XAD,0X76,0XAD,0X96,0XAD,
-0X96,0XAD,0X76,0XAD,0X35,0XA5,0XD4,0X9C,0X51,0X8C,0X8E,0X73,0XAB,0X5A,0X28,0X42,
-0X65,0X31,0XC2,0X18,0XA2,0X18,0XA2,0X18,0X81,0X10,0XA2,0X18,0X82,0X18,0X61,0X10,
-0XA2,0X18,0X81,0X10,0X82,0X10,0X82,0X10,0X82,0X10,0XA2,0X18,0X61,0X10,0X20,0X08,
-0X81,0X18,0XC2,0X20,0X61,0X10,0X20,0X08,0X40,0X08,0X20,0X08,0X82,0X18,0X81,0X18,
-0X82,0X18,0X61,0X18,0X81,0X18,0X81,0X10,0X20,0X08,0X20,0X08,0X00,0X08,0X00,0X00,
-0X00,0X00,0X00,0X00,0X00,0X00,0X44,0X31,0X6F,0XAC,0X32,0XCD,0XD5,0XDD,0X16,0XE6,
-0X78,0XEE,0X98,0XEE,0X99,0XF6,0XB9,0XF6,0XD9,0XF6,0XD9,0XF6,0XFA,0XF6,0XFA,0XF6,
-0XD9,0XF6,0XFA,0XF6,0XD9,0XF6,0XD9,0XF6,0X98,0XEE,0X57,0XEE,0X37,0XEE,0XF5,0XE5,
-0XB4,0XD5,0X53,0XCD,0XD0,0XBC,0X0D,0XAC,0XE9,0X7A,0X64,0X41,0XA5,0X49,0X26,0X5A,
-0XC9,0X7A,0X4A,0X8B,0XCC,0X9B,0XEC,0X9B,0X0C,0XA4,0X2D,0XA4,0X0C,0XA4,0XEC,0XA3,
-0XEC,0XA3,0XCB,0X9B,0XCC,0X9B,0X6A,0X93,0X29,0X83,0XE9,0X7A,0X64,0X39,0XC2,0X20,
-0X61,0X10,0X20,0X08,0X41,0X08,0X20,0X08,0X41,0X08,0X20,0X08,0X00,0X00,0X20,0X08,
-0X41,0X08,0X41,0X08,0X61,0X10,0X82,0X10,0X82,0X10,0X82,0X10,0XE3,0X20,0X45,0X29,
-0X04,0X21,0XE3,0X20,0X04,0X21,0XC2,0X18,0XC3,0X20,0XC3,0X20,0XA2,0X18,0XC3,0X18,
-0X82,0X18,0XC3,0X18,0XA2,0X18,0X03,0X21,0X04,0X21,0X86,0X31,0X82,0X10,0X81,0X10,
-0X61,0X10,0XA2,0X18,0X61,0X10,0X41,0X08,0XA2,0X18,0X44,0X29,0X04,0X21,0XCB,0X5A,
-0X45,0X29,0X49,0X4A,0X71,0X8C,0X6D,0X6B,0XB2,0X94,0XB3,0X94,0X35,0XA5,0XB7,0XB5,
-0XF0,0X7B,0X59,0XC6,0X18,0XBE,0X39,0XC6,0X38,0XC6,0X18,0XBE,0X18,0XBE,0X18,0XBE,
-0XF8,0XBD,0XF8,0XBD,0XF7,0XBD,0XD7,0XB5,0XD7,0XB5,0XB7,0XB5,0X96,0XAD,0X96,0XAD,
-0X96,0XAD,0X76,0XAD,0X76,0XAD,0X55,0XA5,0X55,0XA5,0X55,0XA5,0X34,0XA5,0X14,0X9D,
-0X14,0X9D,0XF4,0X9C,0XD3,0X94,0XD3,0X94,0XB3,0X94,0XB3,0X94,0X92,0X8C,0X92,0X8C,
-0XAF,0X73,0XCF,0X73,0XCF,0X73,0XF0,0X7B,0XF0,0X7B,0X10,0X7C,0X10,0X7C,0X11,0X84,
-0X31,0X84,0X51,0X84,0X51,0X84,0X72,0X8C,0X92,0X8C,0X72,0X8C,0XB2,0X94,0X93,0X94,
-0XB3,0X94,0XD3,0X94,0XF3,0X9C,0XF4,0X9C,0XF4,0X9C,0X14,0X9D,0X14,0X9D,0X14,0X9D,
-0X34,0XA5,0X35,0XA5,0X55,0XA5,0X55,0XA5,0X55,0XA5,0X55,0XA5,0X76,0XAD,0X76,0XAD,
-0X35,0XA5,0X55,0XA5,0X14,0XA5,0X14,0XA5,0X51,0X8C,0X8E,0X6B,0XD3,0X9C,0XEB,0X62,
-0X24,0X29,0X82,0X18,0XC2,0X18,0X81,0X10,0X82,0X18,0X82,0X18,0X82,0X18,0X81,0X10,
-0X82,0X18,0XA2,0X18,0X82,0X10,0X81,0X10,0X82,0X10,0X41,0X08,0X20,0X08,0X40,0X08,
-0X81,0X18,0X61,0X10,0X61,0X10,0X20,0X08,0X20,0X08,0X40,0X08,0X40,0X08,0XA2,0X18,
-0X61,0X10,0X81,0X18,0X61,0X18,0X61,0X10,0X41,0X10,0X41,0X08,0X21,0X08,0X00,0X00,
-0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X44,0X31,0X6F,0XB4,0X32,0XCD,0XB5,0XDD,
-0X16,0XE6,0X57,0XEE,0X78,0XEE,0XB9,0XF6,0XD9,0XF6,0XD9,0XF6,0XF9,0XF6,0XD9,0XF6,
-0XB9,0XF6,0XB9,0XF6,0X98,0XEE,0X78,0XEE,0X37,0XEE,0X16,0XEE,0XD5,0XDD,0X93,0XD5,
-0X11,0XC5,0X8F,0XB4,0XCC,0X9B,0X47,0X62,0X03,0X31,0XA4,0X49,0X06,0X5A,0XA8,0X72,
-0X2A,0X83,0XAC,0X9B,0XEC,0XA3,0X0D,0XAC,0X2D,0XAC,0X2D,0XAC,0X2D,0XAC,0X0C,0XA4,
-0X0C,0XA4,0XEC,0XA3,0XAB,0X9B,0X8B,0X93,0XE9,0X7A,0XE6,0X51,0X03,0X29,0XC2,0X20,
-0X61,0X10,0X61,0X10,0X00,0X00,0X20,0X08,0X41,0X08,0X20,0X08,0X00,0X00,0X20,0X08,
-0X61,0X10,0X41,0X08,0X61,0X10,0X82,0X10,0XA2,0X18,0X61,0X10,0XA2,0X18,0X24,0X29,
-0X45,0X29,0X04,0X21,0X04,0X21,0XC2,0X18,0XA2,0X18,0XE3,0X20,0XC2,0X18,0XE3,0X20,
-0XA2,0X18,0XA2,0X18,0XC3,0X18,0XE3,0X20,0XC7,0X39,0X45,0X29,0X25,0X21,0X61,0X10,
-0X82,0X10,0X61,0X10,0X82,0X10,0X61,0X10,0XC3,0X18,0XE3,0X20,0XC7,0X39,0XCB,0X5A,
-0X45,0X29,0X0C,0X63,0XAE,0X73,0X30,0X84,0X14,0XA5,0X35,0XA5,0XD3,0X9C,0X96,0XB5,
-0X96,0XB5,0X71,0X8C,0X59,0XC6,0X39,0XC6,0X18,0XBE,0X18,0XBE,0X18,0XBE,0X18,0XBE,
-0XF8,0XBD,0XF7,0XBD,0XD7,0XB5,0XD7,0XB5,0XD7,0XB5,0XB7,0XB5,0XB6,0XB5,0X96,0XAD,
-0X96,0XAD,0X96,0XAD,0X76,0XAD,0X55,0XA5,0X55,0XA5,0X55,0XA5,0X35,0XA5,0X14,0X9D,
-0X14,0X9D,0X14,0X9D,0XF3,0X9C,0XF3,0X94,0XB3,0X94,0XB3,0X94,0X92,0X8C,0X92,0X8C,
-0XAF,0X73,0XCF,0X73,0XEF,0X7B,0XEF,0X7B,0XF0,0X7B,0X10,0X7C,0X30,0X84,0X31,0X84,
-0X51,0X84,0X51,0X84,0X51,0X84,0X72,0X8C,0X72,0X8C,0X92,0X8C,0X92,0X8C,0XB3,0X94,
-0XD3,0X94,0XD3,0X94,0XF3,0X9C,0XF4,0X9C,0X14,0X9D,0X14,0X9D,0X34,0XA5,0X35,0XA5,
-0X55,0XA5,0X55,0XA5,0X75,0XA5,0X76,0XAD,0X76,0XAD,0X96,0XAD,0X96,0XAD,0X55,0XA5,
-0X14,0X9D,0X76,0XAD,0X35,0XA5,0X14,0X9D,0X31,0X84,0X30,0X84,0X0B,0X63,0XE7,0X41,
-0XA6,0X39,0X81,0X10,0XA2,0X18,0XA2,0X18,0X82,0X18,0X81,0X10,0X81,0X10,0X81,0X10,
-0X81,0X10,0X82,0X10,0X82,0X10,0X82,0X10,0X61,0X10,0X20,0X08,0X20,0X08,0X20,0X08,
-0X81,0X18,0X20,0X08,0X41,0X08,0X40,0X08,0X00,0X08,0X61,0X10,0X40,0X08,0X81,0X10,
-0X81,0X18,0X61,0X10,0X61,0X10,0X61,0X10,0X61,0X08,0X20,0X08,0X21,0X08,0X00,0X00,
-0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X81,0X18,0X2F,0XA4,0X32,0XCD,
-0X94,0XD5,0XF6,0XE5,0X57,0XE6,0X78,0XEE,0XB9,0XEE,0XD9,0XF6,0XB9,0XF6,0X98,0XEE,
-0X58,0XEE,0X57,0XE6,0X37,0XEE,0XF6,0XE5,0XD5,0XE5,0X73,0XD5,0X32,0XCD,0XB0,0XC4,
-0X0E,0XAC,0X0A,0X83,0X43,0X41,0X03,0X31,0X85,0X41,0XE6,0X59,0X88,0X6A,0X2A,0X83,
-0XAB,0X93,0XEC,0XA3,0X2D,0XAC,0X4D,0XAC,0X6E,0XB4,0X6E,0XB4,0X4E,0XB4,0X2D,0XB4,
-0X0D,0XAC,0XEC,0XA3,0XEC,0XA3,0XE9,0X82,0X26,0X62,0X06,0X52,0X23,0X31,0X82,0X18,
-0X81,0X10,0XA2,0X20,0X20,0X08,0X20,0X08,0X20,0X08,0X20,0X08,0X00,0X00,0X40,0X08,
-0X61,0X10,0X61,0X10,0X61,0X10,0X61,0X10,0X82,0X10,0X82,0X10,0X82,0X10,0XE3,0X20,
-0X45,0X29,0X24,0X29,0XE3,0X20,0X04,0X21,0X82,0X18,0XC3,0X20,0XA2,0X18,0XC3,0X18,
-0XC3,0X18,0XA2,0X18,0XE3,0X20,0XA2,0X18,0X48,0X4A,0XC7,0X39,0X08,0X42,0X41,0X08,
-0X81,0X10,0X61,0X10,0X41,0X08,0X41,0X08,0XE3,0X20,0X04,0X21,0X69,0X52,0XE8,0X41,
-0X4D,0X63,0X8A,0X52,0X2D,0X63,0XCF,0X73,0X76,0XAD,0XF4,0X9C,0X96,0XB5,0X92,0X8C,
-0X96,0XB5,0XF4,0X9C,0X34,0XA5,0X59,0XC6,0X38,0XC6,0X18,0XBE,0X18,0XBE,0XF8,0XBD,
-0XF8,0XBD,0XF8,0XBD,0XF7,0XBD,0XD7,0XB5,0XD7,0XB5,0XB7,0XB5,0XB7,0XB5,0X96,0XAD,
-0X96,0XAD,0X96,0XAD,0X76,0XAD,0X55,0XA5,0X55,0XA5,0X55,0XA5,0X35,0XA5,0X34,0X9D,
-0X14,0X9D,0XF4,0X9C,0XF3,0X9C,0XD3,0X94,0XD3,0X94,0XB3,0X94,0X92,0X8C,0X92,0X8C,
-0XAF,0X73,0XCF,0X73,0XCF,0X73,0XF0,0X7B,0X10,0X7C,0X10,0X7C,0X30,0X84,0X31,0X84,
-0X51,0X84,0X51,0X84,0X51,0X84,0X72,0X8C,0X72,0X8C,0X92,0X8C,0X93,0X94,0XB3,0X94,
-0XD3,0X94,0XD3,0X94,0XF4,0X9C,0XF4,0X9C,0X14,0X9D,0X14,0X9D,0X34,0XA5,0X34,0XA5,
-0X35,0XA5,0X55,0XA5,0X75,0XA5,0X76,0XAD,0X96,0XAD,0X55,0XA5,0X55,0XA5,0X55,0XA5,
-0X96,0XAD,0X96,0XAD,0X14,0XA5,0XF0,0X7B,0XB2,0X94,0X8E,0X73,0XAA,0X52,0XC7,0X41,
-0XE3,0X20,0XA2,0X18,0XA2,0X18,0X82,0X18,0XA2,0X18,0X81,0X10,0X61,0X10,0X81,0X10,
-0XA2,0X18,0X82,0X10,0X82,0X10,0X82,0X10,0X20,0X08,0X20,0X08,0X20,0X08,0X00,0X08,
-0XA2,0X18,0X00,0X08,0X20,0X08,0X61,0X10,0X41,0X08,0X61,0X10,0X41,0X10,0X61,0X10,
-0XA2,0X18,0X61,0X10,0X61,0X10,0X20,0X08,0X21,0X08,0X41,0X08,0X20,0X08,0X00,0X00,
-0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X20,0X00,0X00,0X00,0X00,0X00,0X0A,0X7B,
-0XB1,0XBC,0X53,0XD5,0XD5,0XDD,0X37,0XE6,0X57,0XE6,0X57,0XEE,0X37,0XE6,0XD5,0XE5,
-0XB5,0XDD,0XB4,0XDD,0X73,0XD5,0X32,0XCD,0XB1,0XC4,0X2F,0XB4,0XCC,0XA3,0X0A,0X83,
-0XA5,0X49,0XE2,0X28,0X43,0X39,0XA5,0X49,0XE6,0X59,0X88,0X6A,0X09,0X83,0X8B,0X93,
-0X0D,0XA4,0X4D,0XAC,0X4E,0XAC,0X8E,0XB4,0X8F,0XB4,0X8E,0XB4,0X6E,0XB4,0X4D,0XB4,
-0X2D,0XB4,0X4D,0XB4,0X0C,0XA4,0XC9,0X7A,0X88,0X6A,0X26,0X5A,0X24,0X31,0X61,0X10,
-0XA1,0X18,0X85,0X41,0X65,0X39,0X00,0X00,0X00,0X00,0X20,0X08,0X41,0X08,0X00,0X00,
-0X40,0X08,0X61,0X10,0X81,0X10,0X61,0X10,0X82,0X10,0X61,0X10,0XA2,0X18,0X82,0X18,
-0X04,0X21,0X24,0X29,0X04,0X21,0XE3,0X20,0XA3,0X18,0XC3,0X18,0XC3,0X20,0XA2,0X18,
-0XC3,0X18,0XC3,0X18,0XE3,0X20,0XC3,0X20,0X28,0X42,0X8A,0X52,0XA6,0X31,0X61,0X10,
-0X61,0X10,0X82,0X10,0X61,0X10,0X61,0X10,0XE3,0X20,0XA2,0X18,0X49,0X4A,0XC7,0X39,
-0XEF,0X7B,0X6A,0X52,0X10,0X84,0X31,0X84,0XEF,0X7B,0XB3,0X94,0XB7,0XB5,0X92,0X94,
-0X18,0XC6,0XF8,0XBD,0XF3,0X9C,0X39,0XC6,0X39,0XC6,0X18,0XBE,0X18,0XBE,0X18,0XBE,
-0X18,0XBE,0XF8,0XBD,0XF7,0XBD,0XD7,0XB5,0XD7,0XB5,0XB7,0XB5,0XB7,0XB5,0X96,0XAD,
-0X96,0XAD,0X96,0XAD,0X76,0XAD,0X75,0XAD,0X55,0XA5,0X55,0XA5,0X35,0XA5,0X14,0X9D,
-0X14,0X9D,0XF4,0X9C,0XF4,0X9C,0XF3,0X9C,0XD3,0X94,0XB3,0X94,0XB3,0X94,0X92,0X8C,
-0XCF,0X73,0XCF,0X73,0XEF,0X7B,0XF0,0X7B,0XF0,0X7B,0X10,0X7C,0X10,0X7C,0X31,0X84,
-0X51,0X84,0X51,0X84,0X72,0X8C,0X72,0X8C,0X72,0X8C,0X92,0X8C,0XB3,0X94,0XB3,0X94,
-0XD3,0X94,0XD3,0X94,0XF3,0X9C,0XF4,0X9C,0X14,0X9D,0X14,0X9D,0X35,0XA5,0X35,0XA5,
-0X55,0XA5,0X55,0XA5,0X35,0XA5,0X35,0XA5,0X35,0XA5,0X76,0XAD,0X96,0XAD,0X35,0XA5,
-0X96,0XAD,0XB7,0XB5,0XD3,0X9C,0X51,0X8C,0XEF,0X7B,0XAE,0X7B,0X6D,0X6B,0X44,0X29,
-0XA2,0X18,0XC2,0X18,0XA2,0X18,0X61,0X18,0XC3,0X20,0X81,0X10,0X61,0X10,0XA2,0X18,
-0X82,0X10,0X82,0X10,0XA2,0X18,0X41,0X08,0X00,0X00,0X40,0X08,0X40,0X08,0X00,0X00,
-0XC2,0X18,0X00,0X08,0X20,0X08,0X81,0X10,0XA2,0X18,0X61,0X10,0X61,0X10,0X61,0X10,
-0X40,0X08,0X81,0X10,0X41,0X08,0X41,0X08,0X21,0X08,0X41,0X08,0X41,0X08,0X00,0X00,
-0X21,0X08,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,
-0X24,0X31,0X8C,0X93,0X90,0XBC,0X32,0XD5,0X73,0XD5,0X53,0XD5,0X53,0XD5,0XF2,0XC4,
-0X90,0XBC,0X4F,0XB4,0XEE,0XAB,0X8C,0X9B,0X2A,0X8B,0X47,0X6A,0X44,0X41,0XA1,0X20,
-0X03,0X31,0X64,0X41,0X85,0X49,0X06,0X5A,0X87,0X6A,0X09,0X83,0XAC,0X93,0X0D,0XAC,
-0X4E,0XAC,0X6E,0XB4,0X8F,0XBC,0XAF,0XBC,0XAF,0XBC,0X8F,0XBC,0X6F,0XBC,0X6E,0XBC,
-0X6E,0XB4,0XEF,0XC4,0X09,0X83,0X09,0X7B,0X4A,0X83,0X44,0X39,0XA5,0X49,0X41,0X10,
-0XA5,0X41,0X2A,0X7B,0X06,0X52,0X07,0X52,0X20,0X08,0X00,0X00,0X40,0X08,0X41,0X08,
-0X20,0X08,0X61,0X10,0X61,0X10,0X82,0X10,0X82,0X10,0X61,0X10,0X82,0X10,0XA2,0X18,
-0X04,0X21,0X25,0X29,0X04,0X21,0X04,0X21,0XE3,0X20,0X82,0X10,0XC3,0X18,0XC3,0X20,
-0XC3,0X18,0XE3,0X20,0XC3,0X18,0XC3,0X18,0X08,0X42,0XEB,0X5A,0X49,0X4A,0X41,0X10,
-0X82,0X10,0X41,0X08,0X82,0X10,0X40,0X08,0X61,0X10,0XA2,0X18,0XA6,0X39,0X2D,0X6B,
-0X4D,0X6B,0X8A,0X52,0X51,0X8C,0X72,0X8C,0X35,0XA5,0X92,0X94,0X0C,0X5B,0X14,0XA5,
-0X76,0XAD,0XB7,0XB5,0X55,0XAD,0X39,0XC6,0X18,0XBE,0X18,0XBE,0XF8,0XBD,0X18,0XBE,
-0XD7,0XB5,0XF8,0XBD,0XF8,0XBD,0XF7,0XBD,0XD7,0XB5,0XB7,0XB5,0XB7,0XB5,0XB7,0XB5,
-0X96,0XAD,0X96,0XAD,0X76,0XAD,0X75,0XAD,0X55,0XA5,0X55,0XA5,0X35,0XA5,0X15,0XA5,
-0X14,0X9D,0X14,0X9D,0XF4,0X9C,0XF3,0X9C,0XD3,0X94,0XB3,0X94,0XB2,0X94,0XB2,0X94,
-0XCF,0X73,0XCF,0X73,0XEF,0X7B,0XF0,0X7B,0X10,0X7C,0X10,0X7C,0X30,0X84,0X31,0X84,
-0X51,0X84,0X51,0X84,0X72,0X8C,0X72,0X8C,0X72,0X8C,0X92,0X8C,0XB3,0X94,0XB3,0X94,
-0XD3,0X94,0XD3,0X94,0XF4,0X9C,0X14,0X9D,0X14,0X9D,0X14,0X9D,0XF4,0X9C,0XF4,0X9C,
-0X14,0X9D,0X14,0X9D,0X55,0XA5,0X76,0XAD,0X96,0XAD,0X96,0XAD,0X76,0XAD,0X76,0XAD,
-0X55,0XA5,0X96,0XAD,0XB3,0X94,0XD3,0X9C,0X4D,0X6B,0XEB,0X5A,0X28,0X4A,0XA2,0X18,
-0XA2,0X18,0XA2,0X18,0X82,0X18,0X81,0X18,0XA2,0X20,0X81,0X10,0X81,0X10,0XA2,0X18,
-0X82,0X10,0XC2,0X18,0X61,0X10,0X20,0X08,0X41,0X08,0X41,0X08,0X20,0X08,0X20,0X08,
-0X81,0X18,0X20,0X08,0XA2,0X18,0XC2,0X18,0XA2,0X18,0X81,0X10,0X81,0X10,0X61,0X10,
-0X61,0X10,0X40,0X08,0X41,0X08,0X41,0X08,0X41,0X08,0X41,0X08,0X41,0X08,0X00,0X00,
-0X41,0X08,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,
-0X00,0X00,0X41,0X08,0X03,0X31,0X27,0X5A,0XC9,0X7A,0X0A,0X83,0XEA,0X82,0XA9,0X72,
-0X68,0X6A,0X06,0X5A,0XC5,0X49,0X43,0X39,0XC2,0X28,0XA1,0X20,0XC2,0X28,0X23,0X31,
-0X64,0X41,0XA5,0X49,0X06,0X5A,0X67,0X6A,0XE9,0X7A,0X8B,0X93,0X0D,0XA4,0X6E,0XB4,
-0X8F,0XBC,0XAF,0XBC,0XD0,0XC4,0XF0,0XC4,0XD0,0XC4,0XD0,0XC4,0XAF,0XC4,0XAE,0XBC,
-0XCF,0XC4,0XCC,0XA3,0X29,0X83,0X0D,0XA4,0X67,0X6A,0X47,0X5A,0XC9,0X72,0X20,0X10,
-0XA5,0X41,0X2E,0XA4,0XE9,0X7A,0X88,0X6A,0X06,0X52,0X20,0X08,0X00,0X00,0X20,0X08,
-0X61,0X10,0X41,0X08,0X82,0X10,0X41,0X08,0XC2,0X18,0X82,0X10,0X61,0X10,0XA2,0X18,
-0XA2,0X18,0X24,0X29,0X04,0X21,0XE3,0X20,0XA2,0X18,0XC3,0X20,0XC3,0X20,0XE3,0X20,
-0XC3,0X20,0XC3,0X18,0XC3,0X20,0XA2,0X18,0X07,0X42,0X6E,0X6B,0X69,0X4A,0XA2,0X10,
-0X61,0X10,0X61,0X10,0X82,0X10,0X61,0X10,0X82,0X10,0X61,0X10,0XE7,0X41,0X6E,0X6B,
-0X69,0X4A,0X8E,0X73,0X4D,0X6B,0X96,0XAD,0X39,0XC6,0X92,0X94,0X39,0XC6,0XB6,0XB5,
-0X71,0X8C,0X92,0X94,0XB3,0X94,0X96,0XB5,0XD7,0XB5,0XF8,0XBD,0X38,0XC6,0XD7,0XB5,
-0XF7,0XBD,0X18,0XBE,0XF7,0XBD,0XF7,0XBD,0XD7,0XB5,0XD7,0XB5,0XB7,0XB5,0XB6,0XAD,
-0X96,0XAD,0X96,0XAD,0X76,0XAD,0X76,0XAD,0X55,0XA5,0X55,0XA5,0X35,0XA5,0X35,0XA5,
-0X14,0X9D,0X14,0X9D,0XF4,0X9C,0XD3,0X94,0XD3,0X94,0XD3,0X94,0XB3,0X94,0XB2,0X94,
-0XCF,0X73,0XCF,0X73,0XF0,0X7B,0X10,0X7C,0X10,0X7C,0X10,0X7C,0X30,0X84,0X51,0X84,
-0X51,0X84,0X71,0X8C,0X71,0X8C,0X72,0X8C,0X72,0X8C,0X92,0X8C,0XB3,0X94,0XD3,0X94,
-0XD3,0X94,0XF3,0X9C,0XD3,0X94,0XF4,0X9C,0XF4,0X9C,0X14,0X9D,0X35,0XA5,0X35,0XA5,
-0X55,0XA5,0X55,0XA5,0X75,0XAD,0X76,0XAD,0X96,0XAD,0X96,0XAD,0X34,0XA5,0X55,0XA5,
-0X96,0XAD,0X96,0XAD,0X31,0X84,0X71,0X8C,0XCB,0X5A,0XCB,0X5A,0XA6,0X39,0X82,0X18,
-0X82,0X10,0XA2,0X18,0X82,0X18,0X81,0X18,0XA2,0X18,0X61,0X10,0XC3,0X20,0XA2,0X18,
-0XA2,0X18,0X82,0X10,0X40,0X08,0X41,0X08,0X61,0X10,0X41,0X08,0X00,0X00,0X61,0X10,
-0X81,0X18,0XC2,0X18,0XA2,0X18,0XC2,0X18,0XE3,0X20,0X61,0X10,0X61,0X10,0X61,0X10,
-0X40,0X08,0X41,0X08,0X41,0X08,0X61,0X08,0X21,0X08,0X41,0X08,0X20,0X00,0X20,0X00,
-0X21,0X08,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,
-0X00,0X00,0X61,0X10,0XC2,0X20,0X81,0X10,0X81,0X18,0X81,0X18,0XA1,0X18,0XA1,0X18,
-0XA1,0X18,0XA1,0X18,0X81,0X20,0XC2,0X20,0XC2,0X28,0XE3,0X30,0X23,0X39,0X44,0X39,
-0XA5,0X49,0X06,0X5A,0X67,0X6A,0XE9,0X7A,0X8B,0X93,0XEC,0XA3,0X6E,0XB4,0XAF,0XBC,
-0XF0,0XC4,0XF0,0XC4,0X11,0XC5,0XF0,0XC4,0XF0,0XC4,0XF0,0XC4,0XF0,0XC4,0X10,0XCD,
-0XAF,0XBC,0X2D,0XB4,0XC8,0X7A,0X4D,0XAC,0X29,0X83,0XE9,0X7A,0XE9,0X7A,0XA8,0X6A,
-0X40,0X10,0XE6,0X49,0X4B,0X83,0X0D,0XA4,0X6B,0X8B,0X47,0X5A,0X40,0X08,0X00,0X00,
-0X41,0X08,0X82,0X10,0X81,0X10,0X61,0X10,0X82,0X10,0XC2,0X18,0X61,0X10,0X82,0X10,
-0XA2,0X18,0XA2,0X18,0X24,0X29,0XC3,0X18,0XE3,0X20,0XC3,0X18,0XC3,0X18,0XC3,0X18,
-0XC3,0X20,0XE3,0X20,0X82,0X18,0XC3,0X20,0X85,0X31,0X30,0X84,0XC7,0X39,0X41,0X08,
-0XE3,0X20,0X41,0X08,0X61,0X10,0XA2,0X18,0X61,0X10,0X41,0X08,0XEF,0X7B,0X6A,0X4A,
-0X0B,0X63,0X6E,0X6B,0XB2,0X94,0X59,0XC6,0X92,0X94,0XD7,0XB5,0X59,0XC6,0X59,0XC6,
-0X39,0XC6,0X55,0XA5,0XD4,0X9C,0X35,0XA5,0X39,0XC6,0XD7,0XB5,0XB6,0XB5,0XB7,0XB5,
-0XD7,0XB5,0XD7,0XB5,0XF8,0XBD,0XF7,0XBD,0XD7,0XB5,0XD7,0XB5,0XB7,0XB5,0X96,0XAD,
-0X96,0XAD,0X96,0XAD,0X76,0XAD,0X76,0XAD,0X55,0XA5,0X55,0XA5,0X35,0XA5,0X35,0XA5,
-0X14,0X9D,0X14,0X9D,0XF4,0X9C,0XF3,0X9C,0XD3,0X94,0XD3,0X94,0XB3,0X94,0XB3,0X94,
-0XCF,0X73,0XEF,0X73,0XF0,0X7B,0X10,0X7C,0X10,0X7C,0X10,0X7C,0X31,0X84,0X51,0X84,
-0X51,0X84,0X71,0X8C,0X72,0X8C,0X72,0X8C,0X72,0X8C,0XB2,0X94,0XB3,0X94,0XB3,0X94,
-0XB3,0X94,0XD3,0X94,0XF4,0X9C,0X14,0X9D,0X14,0X9D,0X14,0XA5,0X14,0X9D,0X35,0XA5,
-0X55,0XA5,0X55,0XA5,0X55,0XA5,0X55,0XA5,0X55,0XA5,0X76,0XAD,0X76,0XAD,0X76,0XAD,
-0XD7,0XB5,0X14,0XA5,0X31,0X84,0X0C,0X63,0XEB,0X5A,0X8A,0X52,0XC2,0X20,0XA2,0X18,
-0X82,0X18,0XA2,0X18,0X81,0X10,0X03,0X21,0X61,0X10,0XE3,0X20,0XE3,0X20,0XC3,0X20,
-0X82,0X10,0X61,0X10,0X81,0X10,0X82,0X10,0X61,0X10,0X41,0X08,0X41,0X08,0XA2,0X18,
-0XC3,0X20,0XA2,0X18,0XC3,0X20,0XE3,0X20,0XA2,0X18,0X41,0X10,0X82,0X10,0X41,0X08,
-0X41,0X08,0X41,0X08,0X41,0X08,0X61,0X08,0X41,0X08,0X41,0X08,0X00,0X00,0X21,0X08,
-0X21,0X08,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,
-0X00,0X00,0X41,0X10,0X03,0X29,0XA2,0X20,0XC2,0X20,0XC2,0X28,0XC2,0X28,0XC2,0X28,
-0XC2,0X28,0XC2,0X28,0XC2,0X28,0XE2,0X28,0X03,0X31,0X24,0X39,0X64,0X41,0XA5,0X49,
-0X06,0X5A,0X67,0X62,0XC8,0X7A,0X4A,0X8B,0XCB,0X9B,0X2D,0XAC,0X8F,0XBC,0XD0,0XC4,
-0XF0,0XC4,0X11,0XCD,0X32,0XCD,0X11,0XCD,0X11,0XCD,0X11,0XC5,0X31,0XCD,0X31,0XCD,
-0X4E,0XB4,0XEC,0XA3,0X6A,0X8B,0X4D,0XAC,0X6B,0X93,0XEC,0XA3,0X2A,0X83,0X2A,0X83,
-0XE6,0X51,0XC2,0X28,0XE3,0X28,0XA5,0X41,0X2A,0X7B,0XCD,0X93,0XA9,0X6A,0X61,0X10,
-0X41,0X08,0X61,0X10,0X82,0X10,0X61,0X10,0X82,0X10,0X82,0X10,0XA2,0X18,0X82,0X10,
-0X81,0X10,0XA2,0X18,0X04,0X21,0X04,0X21,0XA2,0X18,0XC3,0X18,0XC3,0X18,0X82,0X10,
-0XC3,0X20,0XC3,0X18,0XA2,0X18,0XA2,0X18,0X86,0X31,0X6E,0X6B,0XC6,0X39,0X61,0X08,
-0X24,0X29,0X41,0X08,0X61,0X10,0XC3,0X18,0X82,0X10,0X61,0X10,0X31,0X84,0X69,0X52,
-0XAA,0X52,0XAF,0X73,0XF8,0XBD,0X92,0X94,0X5A,0XCE,0X59,0XC6,0XF8,0XBD,0X59,0XC6,
-0X18,0XBE,0X35,0XA5,0X39,0XC6,0X35,0XA5,0X96,0XAD,0X38,0XC6,0X18,0XBE,0X38,0XC6,
-0XF8,0XBD,0X96,0XAD,0XB7,0XB5,0XD7,0XB5,0XD7,0XB5,0XD7,0XB5,0XB7,0XB5,0X96,0XB5,
-0X96,0XAD,0X96,0XAD,0X76,0XAD,0X76,0XAD,0X55,0XA5,0X55,0XA5,0X35,0XA5,0X35,0XA5,
-0X14,0X9D,0X14,0X9D,0XF4,0X9C,0XF4,0X9C,0XD3,0X94,0XD3,0X94,0XB3,0X94,0XB2,0X94,
-0XCF,0X73,0XCF,0X73,0XF0,0X7B,0XF0,0X7B,0X10,0X7C,0X30,0X84,0X31,0X84,0X31,0X84,
-0X51,0X84,0X51,0X84,0X71,0X8C,0X72,0X8C,0X72,0X8C,0XB3,0X94,0XB3,0X94,0XB3,0X94,
-0XD3,0X94,0XF3,0X9C,0XF4,0X9C,0X14,0X9D,0X14,0X9D,0X14,0X9D,0X35,0XA5,0X14,0XA5,
-0X14,0X9D,0X34,0XA5,0X35,0XA5,0X76,0XAD,0X76,0XAD,0X96,0XAD,0X35,0XA5,0X55,0XAD,
-0X96,0XAD,0XAE,0X73,0XB3,0X94,0X69,0X52,0X8D,0X6B,0X65,0X31,0XC2,0X18,0X82,0X18,
-0XA2,0X18,0X81,0X18,0XC2,0X18,0XA2,0X18,0XC3,0X20,0X03,0X21,0XC2,0X18,0X61,0X10,
-0X61,0X10,0XA2,0X18,0XA2,0X18,0X81,0X10,0X41,0X10,0X81,0X10,0XC2,0X20,0XC2,0X20,
-0XE3,0X20,0X24,0X29,0XE3,0X20,0XC3,0X18,0X82,0X18,0X41,0X10,0X41,0X08,0X61,0X08,
-0X21,0X08,0X41,0X08,0X41,0X08,0X61,0X10,0X41,0X08,0X41,0X08,0X20,0X08,0X41,0X08,
-0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,
-0X00,0X00,0X20,0X08,0X44,0X31,0XC2,0X20,0XE3,0X20,0XE2,0X28,0XE2,0X28,0XE2,0X28,
-0XE2,0X28,0XE2,0X28,0XE3,0X28,0X03,0X31,0X44,0X39,0X64,0X41,0XA5,0X49,0XE6,0X51,
-0X27,0X62,0XA8,0X72,0X09,0X83,0X8B,0X93,0XEC,0XA3,0X4E,0XB4,0X8F,0XBC,0XD0,0XC4,
-0X11,0XCD,0X31,0XCD,0X52,0XD5,0X52,0XCD,0X52,0XCD,0X51,0XCD,0X52,0XD5,0XB0,0XBC,
-0X6E,0XB4,0XF0,0XC4,0XA8,0X72,0XCB,0X9B,0X0D,0XAC,0X0C,0XA4,0XAB,0X9B,0X8B,0X93,
-0X2A,0X83,0X2A,0X83,0XA5,0X41,0X61,0X18,0X61,0X10,0XA5,0X41,0X2A,0X7B,0X48,0X5A,
-0X20,0X08,0X82,0X10,0X61,0X10,0XA2,0X18,0X61,0X10,0XA2,0X18,0X41,0X08,0XA2,0X18,
-0XA2,0X18,0X82,0X10,0XA2,0X18,0X24,0X29,0XC3,0X18,0XC3,0X18,0XA2,0X18,0XA2,0X18,
-0XA2,0X18,0XC3,0X20,0XA2,0X18,0X61,0X10,0X24,0X29,0XCB,0X5A,0XC2,0X18,0X41,0X08,
-0XA2,0X18,0X61,0X10,0X41,0X08,0X82,0X10,0X61,0X10,0X24,0X29,0XF0,0X7B,0X28,0X4A,
-0X28,0X42,0X39,0XC6,0X92,0X94,0X59,0XCE,0X39,0XC6,0X59,0XC6,0XF7,0XBD,0X39,0XC6,
-0X59,0XC6,0X76,0XAD,0XB7,0XB5,0X18,0XBE,0X76,0XAD,0XD7,0XB5,0XD7,0XB5,0XB7,0XB5,
-0XD7,0XB5,0XD7,0XB5,0X96,0XAD,0XB6,0XB5,0XB7,0XB5,0XD7,0XB5,0XB7,0XB5,0X96,0XB5,
-0X96,0XAD,0X96,0XAD,0X96,0XAD,0X76,0XAD,0X55,0XA5,0X55,0XA5,0X35,0XA5,0X35,0XA5,
-0X14,0X9D,0X14,0X9D,0XF4,0X9C,0XF4,0X9C,0XD3,0X94,0XD3,0X94,0XB3,0X94,0XB3,0X94,
-0XCF,0X73,0XEF,0X7B,0XF0,0X7B,0X10,0X7C,0X30,0X84,0X30,0X84,0X31,0X84,0X51,0X84,
-0X51,0X84,0X71,0X8C,0X72,0X8C,0X72,0X8C,0X72,0X8C,0XB3,0X94,0XB3,0X94,0XD3,0X94,
-0XD3,0X94,0XD3,0X94,0XD3,0X94,0XD3,0X94,0XD3,0X94,0XF4,0X9C,0XF4,0X9C,0X14,0X9D,
-0X55,0XA5,0X55,0XA5,0X75,0XAD,0X76,0XAD,0X96,0XAD,0X76,0XAD,0X55,0XA5,0X96,0XAD,
-0X55,0XA5,0XF0,0X7B,0XAE,0X7B,0X6D,0X6B,0X28,0X4A,0XA2,0X20,0XA2,0X18,0XA2,0X20,
-0XA2,0X18,0X61,0X18,0XA2,0X18,0XE3,0X20,0XE3,0X20,0XE3,0X20,0X61,0X10,0XC2,0X18,
-0X03,0X21,0XA2,0X18,0XA3,0X20,0XC3,0X20,0X03,0X21,0XC3,0X20,0XC2,0X20,0XC3,0X20,
-0XC3,0X20,0XE3,0X20,0XC2,0X18,0XA2,0X18,0XC3,0X20,0X20,0X08,0X41,0X08,0X41,0X08,
-0X20,0X08,0X41,0X08,0X20,0X08,0X62,0X10,0X20,0X08,0X41,0X08,0X20,0X00,0X41,0X08,
-0X20,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,
-0X00,0X00,0X00,0X00,0X64,0X39,0X03,0X29,0XE3,0X28,0X03,0X31,0X23,0X31,0X23,0X31,
-0X23,0X31,0X03,0X31,0X23,0X31,0X44,0X39,0X64,0X41,0XA5,0X49,0XE5,0X51,0X06,0X5A,
-0X68,0X6A,0XE9,0X7A,0X4A,0X8B,0XAB,0X9B,0X0C,0XA4,0X2D,0XB4,0X6F,0XBC,0XAF,0XC4,
-0X11,0XCD,0X31,0XCD,0X31,0XCD,0X31,0XCD,0XF1,0XCC,0X33,0XD5,0X54,0XDD,0X30,0XCC,
-0X0F,0XB4,0X8F,0XAC,0X33,0XBD,0XB1,0XAC,0X50,0X9C,0X2A,0X83,0XE5,0X51,0XCA,0X6A,
-0XEF,0X8B,0XEF,0X8B,0XF2,0XAC,0X50,0X94,0XCF,0X83,0XE7,0X41,0XA2,0X18,0X84,0X39,
-0XC6,0X49,0X61,0X10,0XA2,0X18,0XC3,0X18,0XC3,0X18,0XE3,0X20,0X61,0X10,0X82,0X10,
-0X82,0X10,0XA2,0X18,0XA2,0X18,0XC3,0X18,0XE3,0X20,0XC2,0X18,0XA2,0X18,0XA2,0X18,
-0XA2,0X18,0XC3,0X20,0XC3,0X18,0XA2,0X18,0X61,0X10,0X6E,0X73,0X61,0X10,0X81,0X10,
-0X61,0X10,0X20,0X08,0X81,0X10,0X81,0X10,0X41,0X08,0X65,0X31,0XEB,0X62,0XE7,0X41,
-0X30,0X84,0X92,0X94,0X18,0XC6,0X59,0XC6,0X59,0XC6,0X59,0XC6,0X18,0XBE,0X59,0XC6,
-0X59,0XC6,0XD7,0XB5,0XB6,0XB5,0XF8,0XBD,0X96,0XAD,0X18,0XBE,0XF7,0XBD,0XD7,0XB5,
-0XD7,0XB5,0X18,0XBE,0XF7,0XBD,0XD7,0XB5,0XB6,0XB5,0X76,0XAD,0XB7,0XB5,0X96,0XAD,
-0X96,0XAD,0X96,0XAD,0X76,0XAD,0X75,0XAD,0X55,0XA5,0X55,0XA5,0X15,0XA5,0X35,0XA5,
-0X14,0X9D,0XF4,0X9C,0XF3,0X9C,0XF3,0X9C,0XD3,0X94,0XB3,0X94,0XB3,0X94,0XB3,0X94,
-0XAE,0X73,0XCF,0X73,0XCF,0X73,0XEF,0X7B,0XEF,0X7B,0XF0,0X7B,0XF0,0X7B,0X10,0X7C,
-0X10,0X7C,0X31,0X84,0X31,0X84,0X31,0X84,0X31,0X84,0X72,0X8C,0X92,0X8C,0X92,0X8C,
-0X92,0X8C,0XB3,0X94,0XF4,0X9C,0X14,0X9D,0X14,0X9D,0X34,0XA5,0X35,0XA5,0X35,0XA5,
-0X35,0XA5,0X55,0XA5,0X76,0XAD,0X76,0XAD,0X55,0XA5,0X35,0XA5,0X35,0XA5,0XD7,0XB5,
-0XCF,0X7B,0XEF,0X7B,0X07,0X42,0X0C,0X63,0X03,0X29,0XA2,0X18,0XA2,0X20,0XA2,0X18,
-0X82,0X18,0X82,0X10,0XE3,0X20,0X04,0X29,0XC3,0X18,0XC3,0X20,0X04,0X29,0XE3,0X20,
-0XC3,0X20,0X03,0X21,0X04,0X29,0XE3,0X28,0XA2,0X18,0XA2,0X20,0XA2,0X20,0XC3,0X20,
-0XA2,0X18,0XE3,0X20,0XE3,0X20,0XE3,0X20,0XA2,0X10,0X61,0X08,0X41,0X08,0X41,0X08,
-0X21,0X08,0X61,0X08,0X41,0X08,0X61,0X08,0X41,0X08,0X41,0X08,0X21,0X08,0X21,0X08,
-0X20,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,
-0X00,0X00,0X00,0X00,0X85,0X41,0X44,0X31,0X03,0X29,0X03,0X31,0X24,0X31,0X03,0X29,
-0XE2,0X28,0X65,0X41,0X23,0X31,0X03,0X31,0X43,0X39,0X84,0X41,0XC5,0X49,0X06,0X52,
-0X67,0X62,0X2A,0X83,0XAB,0X9B,0XEC,0XA3,0XEC,0XA3,0X2D,0XB4,0X6E,0XBC,0XF1,0XCC,
-0X53,0XD5,0X94,0XDD,0X34,0XD5,0XB2,0XD4,0XB2,0XDC,0XF4,0XE4,0XF3,0XD4,0X9A,0XE6,
-0X1C,0XE7,0X3D,0XE7,0XFF,0XFF,0X5D,0XE7,0X9E,0XF7,0X3D,0XE7,0XDB,0XDE,0X34,0XAD,
-0XD3,0XA4,0X30,0X8C,0XAF,0X7B,0X8E,0X7B,0X10,0X84,0X7A,0XD6,0XB7,0XB5,0X30,0X8C,
-0XA6,0X39,0X03,0X29,0X61,0X10,0X82,0X18,0XA2,0X18,0XC3,0X20,0XA2,0X18,0XA2,0X18,
-0X61,0X10,0X61,0X10,0XA2,0X18,0X82,0X10,0XC3,0X18,0XA2,0X18,0XA2,0X18,0XA2,0X18,
-0XA2,0X18,0XA2,0X18,0XC3,0X18,0XA2,0X18,0XE3,0X20,0XE3,0X20,0X61,0X10,0X41,0X08,
-0X41,0X08,0X20,0X08,0X61,0X10,0XA2,0X18,0X41,0X08,0X24,0X29,0X65,0X31,0X2C,0X6B,
-0X14,0XA5,0X14,0X9D,0X39,0XC6,0X59,0XCE,0X7A,0XCE,0X59,0XC6,0X18,0XBE,0X59,0XC6,
-0XB7,0XB5,0X59,0XC6,0XB7,0XB5,0XF8,0XBD,0X75,0XAD,0X18,0XBE,0XF8,0XBD,0X18,0XBE,
-0XD7,0XB5,0XD7,0XB5,0XF8,0XBD,0XD7,0XB5,0XD7,0XB5,0XB7,0XB5,0X55,0XA5,0X59,0XC6,
-0XF8,0XBD,0XD7,0XB5,0X39,0XC6,0XB7,0XB5,0XB7,0XB5,0XF8,0XBD,0X38,0XC6,0X14,0X9D,
-0XB6,0XB5,0X76,0XAD,0X39,0XC6,0X55,0XA5,0XF7,0XBD,0X55,0XA5,0X14,0X9D,0XB2,0X94,
-0XCF,0X7B,0XEF,0X7B,0XF0,0X7B,0X10,0X7C,0X10,0X7C,0X31,0X84,0X31,0X84,0X51,0X84,
-0X51,0X84,0X72,0X8C,0X72,0X8C,0X92,0X8C,0X72,0X8C,0X92,0X8C,0XB3,0X94,0XD3,0X94,
-0XD3,0X94,0XF4,0X9C,0XD3,0X94,0XD3,0X94,0XF4,0X9C,0XF4,0X9C,0X14,0X9D,0X35,0XA5,
-0X55,0XA5,0X55,0XA5,0X76,0XAD,0X76,0XAD,0X76,0XAD,0X55,0XA5,0X35,0XA5,0XD3,0X9C,
-0XAF,0X7B,0XAA,0X5A,0X69,0X52,0XC7,0X39,0XC2,0X20,0XA2,0X18,0XA2,0X20,0XA2,0X18,
-0X82,0X18,0XE3,0X20,0XE3,0X20,0X04,0X21,0X03,0X21,0X04,0X29,0XC3,0X20,0XC3,0X20,
-0XA2,0X20,0XC3,0X20,0XC2,0X18,0XA2,0X18,0X82,0X18,0XA2,0X20,0X81,0X18,0XC3,0X18,
-0XC3,0X18,0XE3,0X20,0XA2,0X18,0XA2,0X18,0X82,0X18,0X62,0X10,0X41,0X08,0X61,0X10,
-0X20,0X00,0X61,0X10,0X41,0X08,0X61,0X10,0X41,0X08,0X41,0X08,0X41,0X08,0X41,0X08,
-0X00,0X00,0X00,0X00,0X41,0X08,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,
-0X00,0X00,0X00,0X00,0X85,0X41,0X85,0X41,0X23,0X31,0XA2,0X20,0X43,0X39,0X8C,0X93,
-0X11,0XD5,0X52,0XDD,0X73,0XDD,0X12,0XC5,0X90,0XB4,0X4E,0XAC,0X4E,0XAC,0X2E,0XAC,
-0X4F,0XBC,0X8F,0XBC,0XF0,0XC4,0XB0,0XC4,0X4E,0XB4,0XF1,0XD4,0X53,0XDD,0X53,0XDD,
-0X33,0XDD,0XD3,0XD4,0X51,0XCC,0X30,0XCC,0XEF,0XCB,0X95,0XD5,0XFF,0XFF,0X7A,0XCE,
-0X9E,0XF7,0X1C,0XDF,0X7D,0XF7,0X79,0XD6,0X3C,0XEF,0XBE,0XF7,0XFB,0XDE,0XDF,0XFF,
-0X7D,0XEF,0XDB,0XDE,0X5D,0XE7,0XFC,0XDE,0XD7,0XBD,0X8E,0X7B,0X10,0X8C,0XF8,0XC5,
-0XB7,0XBD,0X8D,0X7B,0X69,0X5A,0XE3,0X20,0XA2,0X18,0X82,0X10,0XE3,0X20,0XC3,0X18,
-0XA2,0X18,0X81,0X10,0X82,0X10,0XC3,0X18,0XA2,0X18,0XA2,0X18,0X82,0X10,0XA2,0X18,
-0XA2,0X18,0X82,0X10,0X82,0X10,0XC3,0X20,0XA2,0X18,0XE3,0X20,0X81,0X10,0X41,0X08,
-0X40,0X08,0X41,0X08,0X41,0X08,0X82,0X10,0X41,0X08,0XE7,0X41,0XC2,0X18,0X71,0X8C,
-0X72,0X8C,0X59,0XCE,0X7A,0XCE,0X79,0XCE,0X79,0XCE,0X7A,0XCE,0X18,0XBE,0X7A,0XCE,
-0X96,0XAD,0X59,0XC6,0XD7,0XB5,0XF8,0XBD,0XF4,0X9C,0X39,0XC6,0XF8,0XBD,0X18,0XBE,
-0XF8,0XBD,0X96,0XAD,0XF8,0XBD,0XF8,0XBD,0XD7,0XB5,0XB7,0XB5,0XB6,0XB5,0X55,0XA5,
-0X96,0XAD,0X96,0XAD,0X96,0XAD,0X96,0XAD,0X76,0XAD,0X76,0XAD,0X55,0XA5,0X35,0XA5,
-0X35,0XA5,0X14,0X9D,0X14,0X9D,0X14,0X9D,0X14,0X9D,0XD3,0X94,0XD3,0X94,0XB3,0X94,
-0XCF,0X7B,0XF0,0X7B,0XF0,0X7B,0X10,0X7C,0X30,0X7C,0X31,0X84,0X31,0X84,0X51,0X84,
-0X51,0X84,0X72,0X8C,0X72,0X8C,0X72,0X8C,0X92,0X8C,0X92,0X8C,0XD3,0X94,0XD3,0X94,
-0XD3,0X94,0XF4,0X9C,0XF4,0X9C,0X14,0X9D,0X14,0X9D,0X14,0XA5,0X35,0XA5,0X35,0XA5,
-0X35,0XA5,0X55,0XA5,0XF4,0X9C,0XD3,0X94,0XD3,0X94,0XB3,0X94,0XB3,0X94,0X30,0X84,
-0XAA,0X52,0X69,0X52,0XAA,0X5A,0X45,0X31,0XA2,0X20,0XA2,0X20,0X82,0X18,0XA2,0X18,
-0XC2,0X18,0XE3,0X20,0X44,0X29,0XE3,0X20,0XE3,0X20,0X03,0X29,0XC3,0X20,0XE3,0X20,
-0XC3,0X20,0XA2,0X18,0XE4,0X20,0XA2,0X18,0X81,0X18,0X81,0X10,0X81,0X10,0XA2,0X18,
-0X62,0X10,0XA3,0X18,0XC3,0X18,0X82,0X10,0X82,0X10,0XA2,0X18,0X20,0X00,0X61,0X08,
-0X20,0X08,0X61,0X08,0X41,0X08,0X61,0X08,0X41,0X08,0X21,0X08,0X20,0X08,0X21,0X08,
-0X20,0X00,0X00,0X00,0X21,0X08,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,
-0X00,0X00,0X00,0X00,0X65,0X39,0XA6,0X49,0XA9,0X6A,0X70,0XAC,0XB4,0XE5,0XB4,0XDD,
-0XF6,0XE5,0X17,0XEE,0X58,0XEE,0X78,0XF6,0X78,0XF6,0X57,0XEE,0XD5,0XED,0XB5,0XE5,
-0XB5,0XE5,0X95,0XE5,0XB5,0XE5,0X95,0XE5,0X95,0XE5,0X54,0XDD,0X13,0XD5,0X74,0XDD,
-0X34,0XD5,0XB1,0XCC,0XCE,0XC3,0X0F,0XC4,0X59,0XDE,0X7D,0XEF,0X1C,0XE7,0X79,0XD6,
-0X16,0XD6,0X52,0XCD,0X93,0XD5,0X94,0XD5,0XB4,0XD5,0XF2,0XBC,0X99,0XDE,0XBE,0XF7,
-0XBA,0XD6,0X9E,0XF7,0XDB,0XDE,0XFC,0XDE,0X5D,0XE7,0X9E,0XEF,0X39,0XC6,0X10,0X8C,
-0X96,0XB5,0X39,0XCE,0X34,0XAD,0XCF,0X7B,0XC6,0X41,0X04,0X29,0XE3,0X20,0XC2,0X20,
-0XC3,0X18,0X82,0X10,0X82,0X18,0XC3,0X20,0X82,0X10,0XA2,0X18,0XA2,0X18,0X81,0X10,
-0XA2,0X18,0XC3,0X18,0X61,0X10,0XA2,0X18,0XC3,0X20,0XA2,0X18,0XC2,0X18,0X82,0X10,
-0X00,0X00,0X20,0X08,0X81,0X10,0X82,0X10,0X61,0X10,0X24,0X29,0X44,0X29,0XF0,0X7B,
-0X71,0X8C,0X18,0XC6,0X9A,0XCE,0X59,0XC6,0X59,0XC6,0X9A,0XCE,0X18,0XBE,0X18,0XBE,
-0X39,0XC6,0X39,0XC6,0XD7,0XB5,0XF8,0XBD,0XF4,0X9C,0X59,0XC6,0XF8,0XBD,0X18,0XBE,
-0X18,0XBE,0XD7,0XB5,0XB7,0XB5,0XF7,0XBD,0XF7,0XBD,0XD7,0XB5,0XB7,0XB5,0X96,0XAD,
-0X35,0XA5,0X96,0XAD,0X76,0XAD,0X76,0XAD,0X55,0XA5,0X55,0XA5,0X55,0XA5,0X35,0XA5,
-0X34,0X9D,0X14,0X9D,0XF4,0X9C,0XF4,0X9C,0XD3,0X94,0XD3,0X94,0XB3,0X94,0XB3,0X94,
+const unsigned char gImage_picture[23478] = { /* lcdimg 200x112 44800->23478 */
+0X4C,0X49,0X01,0X00,0XC8,0X00,0X70,0X00,0XB4,0X78,0XCC,0X7E,0XC4,0X6B,0XC3,0X6E,
+0XC7,0X7E,0X19,0XC0,0X21,0XC1,0X6B,0X21,0X28,0X6E,0XC1,0X28,0X2D,0XC4,0X7E,0XC0,
+0X2D,0X35,0X2D,0X35,0X66,0X5E,0X35,0X2D,0X21,0XA3,0X89,0XC1,0X7A,0X28,0X35,0X2D,
+0XA3,0X99,0X0D,0X94,0X88,0X9C,0X98,0XA2,0X78,0XA3,0X99,0X51,0XC0,0X15,0X01,0X66,
+0X30,0X3C,0XC0,0X30,0XC0,0X6E,0X56,0X66,0X2D,0XC0,0X28,0X55,0XC0,0X65,0X6B,0X19,
+0X28,0X65,0X0D,0X19,0X14,0X28,0X2D,0XA2,0X98,0X3C,0XC0,0X04,0XA4,0X88,0XA5,0X89,
+0XC0,0X21,0X52,0XA5,0X98,0X5A,0XC4,0X7E,0X01,0X04,0XC0,0X01,0XC6,0X66,0X01,0X3C,
+0XC1,0X69,0XC1,0X66,0X35,0X30,0XC0,0X5A,0X30,0XC0,0X2D,0X30,0XC0,0X2D,0X66,0XC6,
+0X21,0XC0,0X66,0X21,0X1C,0X21,0X1C,0XC1,0X5A,0X1C,0X14,0XC4,0X69,0XC0,0X66,0X0D,
+0X08,0X0D,0X08,0XC6,0X05,0XC0,0X08,0X56,0X05,0XC1,0X00,0X05,0XCA,0X0D,0X05,0X0D,
+0XC4,0X14,0X0D,0X14,0XC0,0X19,0XC7,0X21,0X19,0XC1,0X21,0XC1,0X28,0X21,0X28,0X2D,
+0XC7,0X35,0XC0,0X2D,0X35,0XC1,0X3C,0X30,0XC0,0X35,0XC0,0X01,0X28,0X35,0X04,0XC0,
+0X1C,0X04,0X2D,0XA3,0X97,0X91,0X9A,0X97,0X98,0XA2,0X79,0X10,0X7F,0X10,0XC0,0X66,
+0X59,0X66,0X66,0X3C,0XC0,0X37,0X55,0X69,0X28,0X7E,0X41,0X66,0X28,0X1C,0X19,0X62,
+0X6D,0X19,0X61,0X14,0X19,0X28,0X19,0X28,0X14,0X19,0X28,0XA3,0X98,0X10,0X3C,0X55,
+0X3C,0XA5,0X88,0XA3,0X99,0XA7,0X88,0X00,0XA7,0X88,0X7F,0X01,0XA2,0X88,0X01,0X09,
+0XC4,0X66,0XC2,0X01,0XC2,0X04,0X01,0XC0,0X66,0XC0,0X35,0X3C,0X35,0XC3,0X66,0XC2,
+0X5A,0XC3,0X66,0X2D,0XC0,0X28,0XC1,0X69,0XC1,0X66,0XC0,0X21,0X1C,0XC1,0X5A,0X1C,
+0X19,0XC0,0X66,0XC2,0X0D,0XC1,0X66,0XC0,0X0D,0X08,0XC4,0X05,0XC0,0X08,0XC0,0X05,
+0X00,0XC0,0X05,0X00,0X05,0XC8,0X0D,0XC0,0X05,0X0D,0XC4,0X14,0XC0,0X0D,0X19,0X14,
+0X19,0XC7,0X21,0XC5,0X28,0XC0,0X2D,0XC8,0X35,0XC3,0X30,0X3C,0X01,0X2D,0XC0,0X01,
+0X35,0XC0,0X30,0X01,0X21,0X04,0X35,0X21,0X90,0X98,0X9C,0X88,0XA3,0X89,0X1F,0X55,
+0X6E,0X24,0X1F,0X10,0XC0,0X04,0XC0,0X3C,0X65,0XC0,0X5A,0X51,0X66,0X1C,0X3C,0X50,
+0XC1,0X2D,0X19,0X7F,0X30,0XC0,0X28,0XC0,0X21,0XC0,0X2D,0X0F,0X14,0XC0,0X7F,0X04,
+0X29,0X15,0X28,0XC0,0XA3,0X88,0X38,0X08,0XC0,0XA4,0X88,0X09,0X56,0XA2,0X88,0XC0,
+0X66,0X15,0X09,0XC3,0X66,0XC0,0X09,0XC0,0X01,0X04,0XC3,0X56,0X01,0XC0,0X3C,0X35,
+0XC5,0X32,0X66,0XC0,0X30,0X2D,0XC5,0X66,0X69,0X28,0XC0,0X21,0XC2,0X66,0XC3,0X5A,
+0X66,0XC3,0X0D,0XC2,0X08,0X0D,0X08,0XC7,0X59,0X05,0X00,0XC0,0X05,0X08,0X05,0XC7,
+0X0D,0X05,0X0D,0XC6,0X14,0XC2,0X19,0XC4,0X21,0X19,0X21,0XC4,0X28,0XC0,0X2D,0XC9,
+0X35,0XC3,0X3C,0X35,0X01,0XC0,0X3C,0X35,0XC0,0X04,0X3C,0X21,0X28,0X04,0X28,0X9C,
+0X97,0X91,0X88,0X7F,0XA2,0X88,0X6F,0X7E,0X24,0XC0,0X55,0X51,0X66,0X04,0X3C,0X51,
+0X3C,0XC0,0X04,0X30,0XC0,0X28,0X6E,0XC0,0X7E,0X28,0X30,0X3C,0X01,0X30,0X28,0X30,
+0X28,0X65,0X5A,0X28,0X21,0X28,0X1C,0X19,0XC0,0X2D,0X30,0X1F,0X24,0X10,0X28,0X1C,
+0X18,0XA8,0X78,0XA2,0X88,0XA5,0X99,0XA2,0X88,0XA2,0X78,0XC2,0X66,0XC2,0X09,0XC4,
+0X04,0X09,0X04,0XC3,0X5A,0XC3,0X65,0XC3,0X30,0XC0,0X5A,0XC6,0X66,0XC0,0X69,0XC4,
+0X66,0XC4,0X5A,0X14,0XC3,0X0D,0XC2,0X08,0XC6,0X05,0X08,0X05,0X08,0X05,0XC0,0X00,
+0X08,0X05,0XC9,0X0D,0XC5,0X14,0X0D,0X19,0XC5,0X21,0XC1,0X19,0XC0,0X21,0XC4,0X28,
+0XC0,0X2D,0XC5,0X35,0XC3,0X6B,0X35,0X01,0XC1,0X3C,0X09,0X35,0X01,0X35,0X04,0XC0,
+0X0D,0X30,0XC0,0X99,0X98,0X93,0X88,0XA2,0X88,0X7F,0X6F,0X1F,0X29,0X24,0X04,0XA2,
+0X78,0X10,0XC0,0X51,0XC1,0X55,0X61,0X21,0X04,0X10,0X3C,0X51,0X21,0X3C,0X10,0X04,
+0X51,0X3C,0X30,0X28,0X1C,0XC0,0X66,0X21,0X1C,0X28,0X2D,0X28,0X50,0X21,0X56,0X28,
+0X3C,0X18,0X15,0X1F,0X0B,0X28,0X10,0X25,0X39,0XA5,0X89,0X7E,0XA3,0X89,0XC4,0X66,
+0X15,0XC0,0X10,0X09,0XC2,0X66,0XC2,0X09,0X04,0XC0,0X01,0XC2,0X66,0XC0,0X35,0XC1,
+0X66,0X35,0X32,0X2D,0XC2,0X30,0X56,0X30,0X28,0XC2,0X69,0XC0,0X28,0X21,0X66,0X21,
+0X1C,0XC3,0X5A,0XC0,0X14,0XC1,0X69,0XC0,0X14,0X08,0XC0,0X0D,0X08,0XC6,0X05,0XC0,
+0X08,0X00,0XC0,0X08,0X05,0XC5,0X0D,0XC2,0X08,0XC0,0X0D,0XC2,0X14,0XC0,0X0D,0X19,
+0XC5,0X21,0XC0,0X19,0X21,0XC3,0X28,0X21,0X2D,0XC0,0X28,0X2D,0XC3,0X35,0XC4,0X3C,
+0XC2,0X01,0XC1,0X35,0X09,0XC0,0X3C,0X35,0XC0,0X30,0X08,0X9A,0X87,0X96,0X88,0X7F,
+0XA3,0X89,0X6E,0X18,0X38,0X10,0XC0,0X24,0X10,0X65,0X56,0XC0,0XA2,0X87,0X04,0X3C,
+0X04,0XC2,0X10,0X18,0X7F,0X2C,0X09,0XC0,0X04,0X30,0XC1,0X56,0XC2,0X65,0X21,0X1C,
+0XA2,0X78,0X51,0X61,0X6F,0X19,0XA3,0X98,0X3C,0X24,0XC0,0X04,0X5A,0X30,0X01,0XA6,
+0X98,0XA7,0X88,0XA4,0X89,0XC0,0XA3,0X89,0X7E,0X5A,0XC3,0X65,0X10,0X15,0X10,0XC0,
+0X09,0X10,0XC0,0X09,0XC2,0X66,0XC0,0X5A,0XC4,0X66,0X69,0XC4,0X56,0XC2,0X30,0XC0,
+0X2D,0XC0,0X66,0XC1,0X69,0XC3,0X66,0XC0,0X5A,0XC0,0X1C,0XC0,0X19,0XC0,0X66,0XC0,
+0X0D,0X14,0X0D,0X66,0XC0,0X0D,0XC0,0X08,0XC7,0X56,0XC0,0X08,0X5A,0XC4,0X0D,0XC0,
+0X05,0X0D,0XC6,0X14,0XC1,0X19,0XC6,0X21,0XC2,0X28,0X21,0X28,0XC1,0X2D,0XC4,0X35,
+0XC4,0X3C,0XC0,0X01,0XC4,0X09,0X01,0XC0,0X15,0X09,0X30,0X14,0X35,0X94,0X98,0X97,
+0X88,0XA2,0X89,0X24,0X1F,0X59,0X24,0X15,0XC0,0X24,0X65,0XC0,0X56,0XC0,0X18,0X9B,
+0X89,0X65,0X3C,0XC0,0X55,0X28,0XA3,0X88,0XA3,0X98,0XC0,0X18,0XC1,0X51,0X3C,0X65,
+0X3C,0X69,0X28,0XC3,0X2D,0XC0,0X28,0X30,0X1C,0X5A,0X2D,0X35,0X01,0X18,0XC0,0X15,
+0X01,0XC0,0X3C,0X35,0X29,0X08,0XA5,0X88,0X6B,0X7E,0XA3,0X88,0XC1,0X52,0XC0,0X6E,
+0XC5,0X10,0X15,0X10,0XC0,0X09,0XC2,0X56,0XC5,0X3C,0X35,0XC4,0X32,0X76,0XC1,0X5A,
+0X30,0X56,0XC2,0X69,0X28,0X21,0XC2,0X66,0X5A,0X1C,0XC2,0X19,0X14,0XC2,0X0D,0XC2,
+0X08,0XC6,0X05,0XC1,0X08,0X05,0XC4,0X0D,0XC8,0X14,0XC0,0X19,0XC6,0X21,0XC5,0X28,
+0XC0,0X2D,0X28,0X2D,0XC4,0X35,0XC2,0X3C,0XC0,0X01,0XC5,0X09,0XC0,0X04,0XC0,0X35,
+0X09,0X9B,0X98,0X35,0X93,0X98,0X97,0X99,0XA2,0X88,0XA3,0X89,0XC0,0X18,0X24,0X9D,
+0X88,0X24,0XC0,0X18,0X24,0X10,0X69,0X66,0X9B,0X89,0XA3,0X88,0X7F,0X10,0X7A,0X24,
+0X38,0X2C,0X18,0X6E,0XC0,0X09,0X62,0X09,0X04,0XC0,0X1C,0XC0,0X6F,0X1C,0X14,0XC0,
+0X1C,0XC0,0X30,0X1C,0X28,0X2D,0X51,0XC0,0X2D,0X3C,0X01,0X0B,0X01,0X04,0X2D,0X3C,
+0X37,0X2D,0X24,0XAC,0X88,0XA3,0X89,0X7E,0XC0,0X6E,0X6F,0X7E,0XC0,0X15,0XC7,0X7A,
+0X15,0X09,0X15,0X09,0XC1,0X04,0X09,0X56,0X04,0X01,0XC3,0X35,0XC3,0X66,0XC3,0X5A,
+0XC0,0X66,0XC1,0X21,0XC3,0X1C,0XC3,0X5A,0XC1,0X66,0XC0,0X0D,0X14,0X0D,0XC2,0X08,
+0XC3,0X0D,0X08,0XC1,0X05,0X08,0X05,0XC3,0X0D,0X05,0X0D,0XC6,0X14,0XC1,0X19,0XC4,
+0X1C,0X21,0XC4,0X28,0XC3,0X2D,0XC3,0X35,0XC4,0X3C,0X01,0XC4,0X09,0XC2,0X04,0X09,
+0X04,0X1C,0X2D,0X00,0X97,0X88,0X37,0XA2,0X87,0X10,0X24,0X10,0X0B,0X2C,0X38,0X2C,
+0X10,0XC1,0X50,0X52,0X10,0X29,0X00,0X31,0X2C,0X7E,0X9D,0X89,0XC0,0X7E,0X04,0X35,
+0X04,0X51,0X51,0XC0,0X28,0X04,0X21,0X52,0X1C,0X21,0X1C,0XC0,0X5A,0X28,0X21,0X1C,
+0XC0,0X30,0X1C,0XC0,0X30,0X04,0X1F,0X24,0X0B,0X55,0X28,0XC0,0X3C,0X55,0X18,0X09,
+0X9D,0X99,0X5A,0X09,0X6B,0X1D,0X15,0XCE,0X09,0XC2,0X66,0X01,0XC3,0X66,0X01,0X65,
+0XC2,0X30,0XC1,0X2D,0X30,0X2D,0XC0,0X30,0X56,0XC0,0X69,0XC0,0X28,0X21,0X66,0X21,
+0X1C,0XC2,0X5A,0XC1,0X66,0X0D,0X14,0X0D,0XC2,0X08,0XC7,0X05,0X08,0X05,0XC2,0X0D,
+0X05,0X0D,0XC6,0X14,0XC2,0X19,0XC3,0X1C,0X21,0X1C,0X21,0XC2,0X28,0X21,0X2D,0XC6,
+0X35,0XC2,0X3C,0X35,0XC0,0X01,0XC2,0X09,0XC4,0X15,0X09,0X10,0X30,0X1C,0X9A,0X87,
+0X93,0X99,0XA3,0X89,0X6E,0XA2,0X88,0X24,0X18,0X56,0X2C,0X00,0X10,0X24,0X1F,0X18,
+0X51,0X10,0X2C,0XA2,0X78,0X2C,0XC0,0X00,0X2C,0X18,0XC0,0X04,0X3F,0X04,0X55,0X66,
+0X5A,0X66,0X35,0X28,0XC0,0X04,0X3C,0X2D,0X65,0X1C,0X55,0X28,0X21,0XC0,0X1C,0XC0,
+0X21,0X28,0X51,0X28,0X30,0X10,0XA3,0X99,0X18,0X01,0X3C,0X30,0X28,0X35,0XC0,0XA2,
+0X88,0XB0,0X89,0XA2,0X88,0X56,0X50,0X04,0XA2,0X88,0X6F,0XC2,0X1D,0XC0,0X56,0X1D,
+0X15,0X1D,0X15,0XC3,0X66,0XC0,0X69,0XC2,0X56,0XC5,0X3C,0X69,0XC3,0X32,0X66,0X30,
+0X2D,0XC1,0X66,0XC1,0X21,0XC2,0X66,0X21,0X1C,0XC2,0X5A,0XC0,0X66,0X69,0XC6,0X08,
+0XC5,0X0D,0X05,0XC1,0X0D,0XCA,0X14,0XC0,0X19,0XC4,0X6E,0X21,0XC3,0X28,0X21,0X2D,
+0XC6,0X35,0XC3,0X01,0XC5,0X09,0XC2,0X10,0X09,0X15,0X09,0X30,0X19,0X39,0X91,0X98,
+0X7F,0X6F,0XA2,0X88,0XA2,0X88,0X9D,0X98,0XA2,0X88,0X38,0X2C,0X10,0X38,0X2C,0X24,
+0X18,0XC0,0X24,0XC0,0X33,0X00,0X66,0X2C,0X18,0XC1,0X6E,0XC0,0X04,0XC0,0X30,0X3C,
+0XC0,0X51,0X30,0X21,0XC0,0X28,0X65,0X30,0X66,0X1C,0X28,0X6E,0X28,0X21,0X28,0X1C,
+0X28,0X1C,0X5A,0X1C,0X30,0X3F,0X2C,0XC0,0X10,0X37,0X3C,0X2D,0X7E,0X30,0X38,0XAA,
+0X88,0XA2,0X88,0XA5,0X89,0X9D,0X98,0XC0,0XA4,0X78,0X65,0XC1,0X24,0X1D,0XC4,0X15,
+0X1D,0X15,0XC2,0X66,0XC1,0X09,0XC1,0X04,0X01,0XC3,0X66,0XC0,0X69,0XC0,0X30,0X35,
+0XC0,0X56,0X30,0XC1,0X2D,0XC0,0X66,0XC1,0X69,0XC2,0X1C,0XC4,0X14,0XC5,0X0D,0XC3,
+0X08,0XC3,0X05,0XC1,0X0D,0XC0,0X05,0X0D,0XC4,0X14,0XC2,0X6E,0XC4,0X21,0XC3,0X28,
+0XC2,0X2D,0XC4,0X35,0XC4,0X3C,0X01,0XC4,0X09,0XC2,0X10,0X15,0X10,0X7E,0X30,0XC0,
+0X50,0X8F,0X99,0XC0,0X6F,0XA3,0X98,0X5A,0X3C,0X2C,0XC0,0X56,0XC0,0X2C,0X24,0X38,
+0X24,0X18,0X2C,0XC0,0XA3,0X88,0X00,0X18,0XC0,0X2C,0XC0,0X27,0X59,0X9D,0X99,0X3C,
+0X69,0X30,0X3C,0X30,0XC0,0X3C,0X30,0XC0,0X56,0X65,0X28,0XC0,0X1C,0X30,0X28,0XC2,
+0X30,0X28,0X1C,0X6E,0X56,0X28,0X35,0X3C,0XC0,0X04,0X2C,0X04,0X1C,0X28,0X30,0XC0,
+0X28,0XAB,0X88,0XAA,0X88,0XC0,0XA3,0X89,0X9C,0X98,0X6F,0X29,0XC0,0X65,0XC2,0X6B,
+0X29,0X24,0XC0,0X1D,0XC1,0X15,0X7A,0X15,0XC0,0X10,0X15,0X09,0XC3,0X01,0XC0,0X7A,
+0X01,0XC0,0X3C,0XC1,0X35,0XC2,0X30,0XC2,0X2D,0X66,0X2D,0X28,0XC0,0X69,0X28,0X21,
+0XC0,0X66,0XC3,0X5A,0X14,0XC3,0X0D,0XC2,0X08,0XC0,0X0D,0X08,0XC2,0X5A,0XC0,0X0D,
+0X05,0XC0,0X0D,0XC6,0X14,0XC1,0X19,0XC3,0X21,0XC0,0X1C,0X21,0XC0,0X28,0X21,0X28,
+0XC1,0X2D,0XC4,0X35,0XC3,0X01,0XC3,0X09,0XC4,0X10,0X15,0X10,0X15,0X09,0X30,0X0D,
+0X94,0X98,0X9B,0X89,0X7E,0XA3,0X89,0X0B,0X59,0XA2,0X88,0X7F,0X10,0X24,0XC0,0X2C,
+0X31,0X38,0X50,0X31,0X00,0X7E,0X00,0X2C,0X3B,0X00,0X2C,0X31,0X18,0X51,0X3F,0X10,
+0XC0,0X04,0X56,0X30,0XC0,0X51,0X28,0XC0,0X30,0X28,0X69,0XC1,0X6F,0X30,0XC0,0X21,
+0X30,0XC0,0X04,0X28,0X30,0X1C,0X56,0X30,0X04,0X1F,0X18,0X10,0X24,0X01,0X28,0X14,
+0X21,0X28,0X04,0XAD,0X89,0X09,0XA2,0X88,0X66,0X51,0X18,0XA3,0X89,0X29,0XC6,0X66,
+0XC0,0X1D,0XC1,0X56,0XC4,0X66,0XC0,0X09,0XC0,0X5A,0X04,0XC0,0X5A,0XC3,0X66,0X35,
+0X66,0XC4,0X5A,0XC1,0X66,0XC0,0X69,0X28,0X21,0X66,0X21,0X1C,0XC3,0X56,0XC3,0X0D,
+0XC2,0X08,0X0D,0XC0,0X08,0XC1,0X05,0XC0,0X0D,0X05,0X0D,0X05,0X0D,0XC4,0X14,0XC1,
+0X19,0XC5,0X21,0XC2,0X28,0X21,0X2D,0XC6,0X35,0XC1,0X01,0X35,0X01,0XC2,0X09,0X01,
+0X09,0XC1,0X10,0X09,0X10,0X15,0XC3,0X0D,0X3D,0X97,0X99,0XC0,0XA3,0X98,0X56,0XA2,
+0X88,0XC0,0X7E,0X10,0XA2,0X88,0X10,0X2C,0XC1,0X10,0X2C,0X00,0XC0,0X2C,0XC0,0X00,
+0X18,0X27,0X59,0X04,0X3C,0X18,0X27,0X04,0X3C,0X65,0X3C,0XC1,0X04,0X30,0X28,0XC0,
+0X30,0X6E,0X30,0XC2,0X35,0X04,0X30,0X35,0XC1,0X30,0X51,0X56,0X1C,0X30,0X10,0X24,
+0X18,0X10,0X04,0X35,0X30,0X1C,0X28,0X30,0X10,0X08,0XA5,0X89,0XA6,0X87,0X52,0X2D,
+0XA6,0X98,0X31,0XC1,0X29,0XC6,0X24,0X69,0XC2,0X15,0XC2,0X66,0XC0,0X09,0X10,0X65,
+0XC1,0X01,0XC3,0X3C,0X69,0XC1,0X66,0XC2,0X2D,0XC0,0X66,0XC1,0X21,0XC1,0X66,0XC5,
+0X56,0XC3,0X0D,0XC3,0X08,0XC2,0X05,0X0D,0XC0,0X05,0X0D,0XC4,0X14,0XC0,0X19,0X14,
+0X19,0XC5,0X21,0XC1,0X28,0XC0,0X21,0X28,0X2D,0XC0,0X30,0XC0,0X2D,0XC0,0X35,0XC1,
+0X3C,0X01,0X3C,0X01,0XC2,0X09,0X01,0X09,0XC2,0X15,0X10,0X15,0XC3,0X35,0X25,0X94,
+0X88,0X2B,0X6E,0X6F,0X7E,0X6F,0XA2,0X88,0X18,0X24,0X18,0XA2,0X88,0X6F,0X2C,0X24,
+0X2C,0X0C,0X69,0X00,0X2C,0X38,0X24,0X2C,0X24,0X2C,0X55,0X24,0X13,0X04,0XC0,0X55,
+0X52,0XC0,0X69,0X5A,0X28,0XC3,0X30,0XC0,0X3C,0XC0,0X04,0XC0,0X1D,0X04,0XC0,0X6E,
+0XC0,0X1D,0X18,0X30,0X28,0X51,0X7E,0X28,0X10,0XC0,0X04,0X3C,0X30,0X28,0X21,0X2D,
+0X2B,0X10,0XB3,0X88,0X66,0XA3,0X89,0XA4,0X88,0X97,0X98,0X31,0X29,0XC0,0X31,0XC4,
+0X29,0XC1,0X24,0XC2,0X69,0X15,0XC5,0X09,0XC1,0X04,0X01,0X04,0X01,0XC2,0X66,0X69,
+0XC0,0X30,0XC3,0X56,0X6E,0X28,0XC0,0X69,0XC1,0X66,0X21,0XC0,0X1C,0XC0,0X19,0X1C,
+0X19,0XC0,0X66,0XC1,0X0D,0XC2,0X08,0XC1,0X0D,0X56,0X0D,0X05,0X0D,0XC5,0X14,0XC1,
+0X19,0XC4,0X21,0X5A,0X21,0XC1,0X28,0XC0,0X2D,0XC2,0X30,0XC1,0X35,0XC3,0X01,0XC3,
+0X09,0XC4,0X15,0XC3,0X6E,0X24,0X09,0X99,0X98,0X93,0X99,0X51,0X37,0X6E,0X04,0X18,
+0X55,0XA2,0X89,0X10,0X18,0X24,0XC0,0X33,0X24,0X2C,0XA3,0X99,0X00,0XC0,0X38,0XC0,
+0X2C,0XC0,0X27,0X18,0XC0,0X6E,0X61,0X10,0X3C,0X51,0XC0,0X30,0X3C,0X04,0XC1,0X3C,
+0XC0,0X04,0X3F,0X09,0XC0,0X13,0X7E,0X09,0X2C,0X27,0X7E,0X27,0XC0,0X20,0X34,0XA3,
+0X88,0X00,0X30,0X28,0X6E,0X3C,0XC1,0XA3,0X88,0X3C,0XC0,0X28,0X69,0XC0,0XA2,0X88,
+0X30,0X00,0XAF,0X79,0X9D,0X99,0XA7,0X98,0X29,0X15,0XA4,0X88,0X66,0XC1,0X31,0XC3,
+0X29,0XC3,0X66,0X69,0XC2,0X15,0XC2,0X66,0X15,0X65,0XC0,0X66,0X09,0X04,0XC2,0X5A,
+0X3C,0X69,0XC0,0X66,0XC4,0X5A,0X66,0XC1,0X69,0XC1,0X1C,0XC4,0X14,0X19,0X14,0XC1,
+0X69,0XC1,0X08,0X0D,0X08,0X0D,0XC0,0X05,0XC0,0X0D,0XC5,0X14,0XC1,0X19,0XC4,0X21,
+0XC3,0X28,0X2D,0XC3,0X30,0XC1,0X35,0XC1,0X3C,0X01,0XC4,0X09,0XC2,0X15,0XC0,0X10,
+0X15,0XC2,0X1D,0X29,0X0D,0X98,0X98,0X97,0X89,0X7E,0X6F,0X7E,0XC1,0X18,0XC0,0X04,
+0X2C,0X6F,0X51,0XC0,0X2C,0X00,0XC1,0X38,0X3B,0X2C,0XC0,0X18,0XC0,0X38,0X18,0X3F,
+0X04,0X28,0X3F,0X13,0X18,0X56,0X04,0X10,0XA2,0X87,0X18,0XC0,0X24,0X18,0XC1,0X2C,
+0X00,0X34,0XC0,0X6E,0XA3,0X99,0X00,0X0F,0XA2,0X88,0X55,0X1C,0XA4,0X88,0X14,0X2C,
+0X9C,0X88,0X5A,0X0B,0X10,0XC0,0X3C,0X04,0X3C,0X30,0X55,0X28,0XC0,0X30,0X3C,0XB1,
+0X99,0XA5,0X88,0X9C,0X88,0XAA,0X78,0X98,0X88,0XA7,0X99,0X3D,0XC3,0X66,0X31,0X38,
+0XC1,0X29,0XC3,0X66,0X69,0X24,0X1D,0X15,0XC3,0X66,0XC1,0X09,0XC0,0X66,0XC2,0X01,
+0X66,0XC0,0X35,0XC0,0X30,0XC2,0X2D,0XC0,0X66,0XC1,0X69,0XC1,0X66,0XC4,0X19,0X66,
+0XC0,0X0D,0XC2,0X08,0XC1,0X0D,0XC0,0X05,0X0D,0XC4,0X14,0XC0,0X19,0XC7,0X21,0X1C,
+0X21,0X28,0X21,0X28,0X2D,0XC3,0X30,0XC1,0X35,0XC1,0X3C,0X01,0X04,0X01,0XC0,0X09,
+0XC2,0X10,0XC0,0X15,0XC3,0X1D,0XC0,0X29,0X30,0X1C,0X8E,0X87,0X7F,0X6F,0XC0,0XA2,
+0X88,0X65,0XA2,0X88,0X55,0X04,0X2C,0X18,0X6E,0X6B,0X33,0X6E,0X00,0X38,0X33,0X00,
+0X2C,0X33,0X18,0X2C,0X38,0X18,0XC0,0X04,0X13,0X27,0X13,0X04,0XC0,0X18,0XC1,0X13,
+0X20,0X2C,0X1B,0X34,0XC0,0X20,0X34,0XA2,0X88,0XC0,0X6E,0XA3,0X99,0X7E,0X52,0X38,
+0XA3,0X89,0X38,0XA6,0X89,0X9C,0X88,0X08,0X00,0X1D,0X10,0XC0,0X7E,0XC0,0X10,0X3C,
+0X65,0XC0,0X5A,0X21,0X6B,0XC1,0X1D,0XB1,0X89,0X7F,0X35,0X31,0X29,0X0C,0X69,0X3D,
+0XC4,0X66,0XC3,0X29,0XC2,0X66,0XC1,0X69,0X15,0XC3,0X66,0XC0,0X09,0XC1,0X66,0XC1,
+0X01,0X66,0XC0,0X35,0XC0,0X66,0XC3,0X56,0XC2,0X69,0XC1,0X1C,0XC4,0X19,0X14,0XC1,
+0X69,0XC2,0X66,0X0D,0X56,0XC0,0X0D,0XC4,0X14,0X19,0XC7,0X21,0XC2,0X28,0XC0,0X6E,
+0XC4,0X30,0X35,0XC1,0X3C,0X01,0XC1,0X04,0XC0,0X01,0X09,0XC1,0X15,0X10,0XC0,0X15,
+0XC1,0X1D,0XC0,0X15,0X1D,0X24,0X21,0X94,0X88,0X99,0X99,0X7E,0X6F,0X7E,0XC3,0XA2,
+0X88,0X56,0X69,0X10,0X18,0XC0,0XA6,0X88,0X2C,0X7F,0X2C,0XC0,0X6E,0X09,0X2C,0XC0,
+0X04,0X7F,0X04,0X09,0X3C,0X55,0XA2,0X88,0X18,0XC0,0X2C,0X3B,0X31,0XA2,0X98,0X34,
+0X14,0X2B,0XA2,0X88,0XC0,0X50,0X08,0XA2,0X98,0XA3,0X88,0X5A,0X38,0XA5,0X99,0X38,
+0XA6,0X98,0XA3,0X88,0X9B,0X89,0XA2,0X88,0X2B,0X55,0X08,0X3B,0X2C,0X18,0X56,0X04,
+0X3C,0XC1,0X30,0XC0,0X55,0X28,0X30,0X28,0X30,0XAE,0X88,0XA6,0X78,0XA7,0X99,0X35,
+0X15,0X11,0X0C,0X69,0XC0,0X0C,0X3D,0XC3,0X66,0XC2,0X59,0X66,0XC2,0X66,0XC0,0X1D,
+0XC0,0X15,0X1A,0X15,0XC2,0X66,0X69,0XC1,0X66,0X5A,0X04,0X01,0X35,0XC2,0X66,0XC0,
+0X5A,0XC0,0X66,0XC1,0X69,0X28,0X21,0XC0,0X66,0XC2,0X19,0XC0,0X66,0X0D,0XC7,0X56,
+0X0D,0XC2,0X14,0X0D,0X14,0XC0,0X19,0XC5,0X21,0XC2,0X28,0X2D,0X28,0X2D,0XC4,0X35,
+0XC0,0X6B,0XC1,0X01,0XC2,0X04,0X09,0XC0,0X10,0XC0,0X15,0X10,0XC0,0X15,0X1D,0X15,
+0X1D,0XC0,0X15,0X29,0X30,0X9B,0X98,0X90,0X88,0XA2,0X88,0X6E,0X6B,0XC0,0X7E,0XC1,
+0X6E,0X6B,0X04,0X09,0X10,0XA2,0X88,0XA3,0X98,0X2C,0XC0,0X3B,0X2C,0X27,0X2C,0X00,
+0X27,0X04,0X18,0XC0,0X3C,0XC0,0X04,0X24,0XC0,0X00,0XA4,0X88,0X7E,0XC0,0X6E,0X7F,
+0X7A,0XC0,0X6E,0X2F,0XA4,0X88,0XA6,0X87,0X98,0X88,0X51,0X2F,0X7A,0X07,0XA8,0X97,
+0X37,0XA4,0X87,0X6F,0X37,0X98,0X68,0X52,0X08,0X66,0X2C,0X51,0X51,0XC1,0X56,0X65,
+0XC0,0X56,0X6E,0X65,0X28,0X30,0X6E,0X30,0XA3,0X99,0XAF,0X78,0XA2,0X88,0XA3,0X99,
+0X9A,0X88,0XAA,0X88,0X6F,0X3D,0X7E,0X0C,0XC1,0X05,0X3D,0XC2,0X38,0XC2,0X69,0X29,
+0XC3,0X66,0XC0,0X66,0X15,0XC2,0X66,0XC0,0X69,0XC0,0X66,0X06,0X01,0X04,0X01,0X66,
+0X35,0XC0,0X66,0X5E,0X66,0X30,0X2D,0X66,0X2D,0X28,0XC0,0X21,0X1C,0XC4,0X56,0XC2,
+0X0D,0X14,0X0D,0XC1,0X14,0X0D,0XC4,0X14,0XC0,0X19,0XC4,0X1E,0X21,0XC3,0X28,0XC1,
+0X2D,0XC2,0X35,0X2D,0X35,0XC2,0X01,0XC4,0X09,0XC0,0X10,0XC0,0X15,0XC0,0X10,0X18,
+0X15,0X1D,0XC2,0X29,0X1D,0X21,0X91,0X98,0X9D,0X99,0X6E,0X30,0X6F,0X7E,0XC0,0X3C,
+0X04,0X6F,0X04,0X3C,0X10,0X13,0X27,0XA2,0X87,0X2C,0XC0,0X3B,0X41,0X27,0X3B,0X27,
+0XC0,0X59,0X9C,0X99,0X51,0X04,0X24,0XA3,0X98,0XA2,0X98,0XA7,0X88,0X7F,0XA6,0X98,
+0X6E,0XA4,0X87,0X51,0X66,0XC0,0X51,0X66,0X69,0XC0,0XA5,0X88,0XA3,0X99,0X9C,0X88,
+0XA2,0X88,0XC0,0X23,0X37,0XA4,0X87,0X0F,0X38,0X9A,0X89,0X2F,0X9A,0X88,0X41,0X34,
+0X2C,0X51,0X04,0X9D,0X89,0X30,0X3C,0X30,0X51,0XC0,0X5A,0X7E,0XC0,0X28,0X30,0X04,
+0X30,0X25,0XAB,0X99,0XC0,0X9D,0X89,0X18,0XA6,0X88,0X11,0X66,0X05,0X3D,0X0C,0X05,
+0XC0,0X0C,0X05,0X3D,0XC2,0X66,0XC1,0X29,0XC3,0X66,0XC1,0X15,0X7E,0X15,0XC0,0X66,
+0XC1,0X69,0X66,0X09,0X04,0X01,0XC1,0X3C,0X69,0X66,0XC3,0X2D,0XC0,0X66,0XC0,0X69,
+0XC2,0X66,0XC1,0X5A,0XC0,0X66,0XC0,0X0D,0X14,0X0D,0XC0,0X14,0X0D,0XC4,0X14,0XC0,
+0X19,0XC5,0X1C,0X21,0XC2,0X28,0X2D,0XC4,0X35,0X2D,0X35,0XC0,0X3C,0XC0,0X01,0XC2,
+0X09,0XC1,0X10,0X15,0X10,0X15,0XC1,0X1D,0XC1,0X24,0X29,0XC0,0X31,0X04,0X25,0X94,
+0X88,0X66,0XA2,0X88,0X69,0X3C,0XC1,0X7E,0X3C,0X04,0X51,0X04,0X3C,0X04,0XA5,0X99,
+0X51,0X2C,0XA2,0X88,0X9C,0X88,0X3B,0XC0,0X50,0X3B,0X18,0X9B,0X99,0X3C,0X27,0X08,
+0XA2,0X88,0XA2,0X88,0XA5,0X99,0XA9,0X97,0XA4,0X89,0XA2,0X97,0XA3,0X89,0XA2,0X87,
+0X7F,0XA2,0X88,0X9D,0X99,0X33,0X9D,0X99,0X37,0X66,0XC0,0X7E,0XA3,0X88,0X52,0X33,
+0X9C,0X88,0X99,0X99,0XA2,0X87,0X9D,0X99,0X41,0X1F,0X99,0X89,0X41,0X1C,0X08,0X34,
+0X18,0X51,0X6F,0X04,0X28,0X65,0X6E,0X1C,0X5A,0X1C,0XC0,0X28,0X2D,0X28,0X3F,0XA2,
+0X77,0XAF,0X89,0XA6,0X89,0X65,0X9A,0X77,0X05,0X11,0XC3,0X3D,0X0C,0XC1,0X3D,0XC3,
+0X66,0XC2,0X29,0XC2,0X24,0XC1,0X1D,0XC0,0X15,0XC2,0X66,0XC0,0X69,0X66,0XC1,0X01,
+0XC0,0X65,0XC0,0X66,0X35,0X30,0XC2,0X56,0XC0,0X21,0X28,0X21,0XC2,0X66,0XC1,0X5A,
+0X14,0XC1,0X0D,0XC0,0X14,0X0D,0XC3,0X14,0XC0,0X19,0XC6,0X21,0XC4,0X6F,0XC3,0X35,
+0XC1,0X6B,0XC1,0X01,0XC0,0X09,0X01,0X09,0XC2,0X15,0XC2,0X10,0X1D,0XC1,0X29,0XC2,
+0X31,0X0D,0X92,0X98,0X9D,0X89,0XC0,0X7E,0X6F,0XC1,0X04,0X30,0X3C,0X69,0X30,0X04,
+0X3C,0XA3,0X98,0X2C,0X66,0X2C,0X56,0XA1,0XA8,0X3B,0X27,0X2F,0X3F,0X69,0X20,0XA5,
+0X99,0XA2,0X88,0XA4,0X88,0X1B,0XA5,0X88,0XA8,0X98,0X0B,0XA5,0X89,0XA4,0X88,0X6E,
+0X7F,0X27,0X7E,0X66,0X27,0XC0,0X2A,0X33,0X61,0X52,0X1A,0X65,0XA5,0X89,0X1A,0X32,
+0X50,0X9A,0X89,0X9A,0X88,0XA2,0X78,0X55,0X9B,0X89,0X9C,0X89,0X34,0X56,0X7A,0X2C,
+0X9D,0X89,0X3C,0X30,0X56,0X65,0XC2,0X5A,0XC0,0X28,0X3C,0X30,0X04,0XA7,0X88,0X09,
+0XA3,0X99,0X51,0X9C,0X88,0X31,0X7F,0X11,0XC2,0X0C,0XC0,0X11,0X0C,0XC0,0X66,0X6D,
+0X3D,0XC1,0X66,0XC1,0X29,0XC4,0X66,0XC0,0X1D,0X56,0XC2,0X66,0X09,0XC1,0X66,0XC0,
+0X01,0XC0,0X66,0X69,0XC1,0X30,0XC2,0X56,0XC2,0X21,0XC0,0X66,0XC3,0X14,0XC2,0X0D,
+0X14,0X0D,0XC4,0X6F,0XC6,0X21,0XC4,0X28,0X2D,0XC4,0X35,0XC0,0X01,0X3C,0X01,0XC2,
+0X09,0XC1,0X10,0XC0,0X15,0XC1,0X18,0X15,0X24,0XC0,0X29,0XC2,0X38,0X04,0X93,0X98,
+0X97,0X89,0XC0,0XA3,0X98,0X51,0XC0,0X6F,0X7A,0X30,0X3C,0XC0,0X28,0X3C,0XC0,0X04,
+0XA5,0X89,0X51,0XC0,0X38,0X65,0XC2,0X04,0XA2,0X88,0XA5,0XA8,0XA7,0X98,0X37,0XA3,
+0X98,0X22,0XA7,0X78,0XA4,0X88,0XA4,0X88,0XA4,0X88,0X3B,0XC0,0XA2,0X88,0XC1,0X65,
+0X6B,0X03,0X66,0X55,0X55,0X9D,0X99,0X02,0XC2,0X65,0X1A,0X9B,0X98,0X56,0X9D,0X88,
+0XA2,0X87,0X98,0X79,0X9C,0X88,0X52,0X9C,0X78,0X00,0X66,0X40,0X9C,0X89,0XC0,0X65,
+0XC1,0X28,0X65,0X5A,0XC2,0XA1,0XA9,0X30,0X04,0XA2,0X88,0XAB,0X88,0XAB,0X8A,0X31,
+0X21,0X31,0X7F,0X0C,0X11,0XC0,0X7F,0XC0,0X0C,0X11,0XC1,0X0C,0XC0,0X05,0X3D,0XC2,
+0X38,0XC1,0X59,0X29,0XC1,0X66,0XC1,0X69,0X15,0XC2,0X10,0X09,0X10,0X09,0X66,0XC2,
+0X56,0XC0,0X35,0X66,0XC2,0X2D,0X66,0XC0,0X21,0X28,0X21,0X66,0XC2,0X5A,0XC0,0X66,
+0XC1,0X0D,0X14,0X0D,0XC2,0X14,0X19,0X14,0X19,0XC4,0X21,0XC4,0X2D,0XC3,0X35,0XC1,
+0X3C,0X6E,0XC3,0X09,0XC1,0X10,0XC1,0X15,0XC2,0X1D,0X15,0X24,0X29,0XC2,0X31,0X29,
+0X21,0X8E,0X98,0X56,0XA2,0X88,0X30,0XC1,0X3C,0X30,0XC0,0X3C,0X30,0XC0,0X3C,0XC0,
+0X18,0X6F,0X18,0X2C,0XC2,0X66,0X9D,0X88,0X34,0XA9,0XA8,0XAA,0X98,0XA4,0X97,0XA4,
+0X89,0XA3,0X88,0X6F,0XA3,0X78,0XA3,0X98,0XA2,0X89,0X6E,0X7F,0XA2,0X78,0X7A,0XC1,
+0X55,0XC1,0X76,0X03,0X2F,0X2A,0X51,0X55,0X02,0X33,0X02,0X22,0X33,0X06,0X60,0X26,
+0X9B,0X88,0X98,0X78,0X9D,0X89,0X9C,0X79,0X56,0X9C,0X98,0X55,0X9D,0X89,0X30,0X51,
+0XC0,0X56,0X28,0XC0,0X69,0XC0,0X56,0XC0,0X1C,0X30,0X3C,0XA2,0X88,0XA6,0X88,0XA8,
+0X88,0XAB,0X89,0X9D,0X98,0X31,0X2C,0X3D,0XA2,0X98,0X6E,0X11,0X7F,0XC0,0X0C,0X11,
+0XC2,0X0C,0X05,0XC0,0X3D,0XC2,0X38,0XC1,0X59,0X29,0XC1,0X66,0XC1,0X1D,0XC0,0X15,
+0XC1,0X65,0XC1,0X66,0XC0,0X01,0X66,0XC0,0X35,0X66,0X35,0X30,0XC1,0X2D,0X66,0XC1,
+0X69,0XC0,0X1C,0XC2,0X5A,0X1C,0XC0,0X56,0X0D,0X14,0X0D,0XC1,0X14,0X0D,0X14,0XC0,
+0X19,0XC2,0X1C,0XC0,0X21,0XC3,0X28,0X2D,0X28,0X2D,0XC1,0X35,0XC1,0X3C,0XC0,0X01,
+0XC2,0X09,0XC1,0X6B,0XC0,0X15,0XC2,0X1D,0XC1,0X29,0XC2,0X2E,0X2C,0X51,0X91,0X98,
+0X96,0X88,0X6F,0XA2,0X88,0X65,0XC1,0X3C,0XC0,0X30,0X28,0X30,0XC2,0XA6,0X88,0X51,
+0XA3,0X88,0X2C,0X27,0XC0,0X2C,0X3F,0XA8,0X87,0XAD,0XB8,0XAD,0X98,0XA6,0X88,0X7F,
+0X6E,0X0A,0X2A,0X03,0X0F,0XC0,0X6F,0X23,0XC0,0X6F,0X69,0X23,0XC1,0X5A,0X23,0X0F,
+0X03,0X62,0X51,0X59,0X07,0XC0,0X33,0X02,0X66,0X0E,0X22,0X98,0X88,0XA4,0X89,0X99,
+0X77,0X97,0X99,0X56,0X9B,0X89,0X34,0X41,0XC0,0X6B,0X30,0X52,0X55,0X55,0XA2,0X88,
+0X7F,0X19,0X28,0XC0,0X14,0X1C,0X28,0X3C,0X18,0XA8,0X89,0X09,0XA9,0X89,0X04,0X11,
+0X65,0X38,0XA4,0X88,0X59,0X25,0X20,0X11,0X7E,0XC0,0X11,0XC1,0X0C,0X66,0X0C,0X05,
+0X56,0XC2,0X38,0X69,0XC1,0X29,0XC0,0X66,0XC0,0X69,0XC0,0X66,0XC0,0X10,0X15,0X10,
+0XC0,0X09,0X04,0XC0,0X5A,0XC0,0X66,0XC0,0X35,0X66,0XC2,0X2D,0X66,0XC0,0X21,0XC1,
+0X66,0XC3,0X5A,0XC0,0X66,0X19,0X0D,0XC1,0X14,0XC1,0X19,0XC1,0X1C,0X19,0XC0,0X1C,
+0X21,0XC2,0X28,0X2D,0XC4,0X35,0XC0,0X3C,0XC0,0X01,0XC2,0X09,0XC2,0X10,0X15,0XC2,
+0X1D,0X24,0XC0,0X1D,0X29,0XC1,0X31,0X3D,0X09,0X1D,0X89,0X99,0X65,0X6E,0X30,0XC0,
+0X56,0X3F,0X30,0XC1,0X28,0X30,0X28,0X35,0XA2,0X99,0X6E,0X6E,0X7F,0X27,0XA2,0X88,
+0X27,0X9D,0X78,0XA5,0XB8,0XAF,0XA8,0XB0,0X98,0XA6,0X88,0X2A,0X6E,0X03,0X6B,0X6E,
+0X6F,0X7A,0X6E,0X6E,0X6B,0XC0,0X7E,0X2F,0XC2,0X66,0X1E,0X69,0X03,0X3E,0X55,0X51,
+0X66,0X55,0X65,0X66,0X02,0X9D,0X88,0X7F,0X9A,0X97,0X3A,0X55,0X98,0X79,0X99,0X89,
+0X9D,0X88,0X08,0X00,0X9D,0X98,0X18,0X56,0X9C,0X88,0XC0,0X66,0X55,0XC0,0X28,0X61,
+0X14,0X28,0X65,0XC0,0X30,0X10,0X00,0X0D,0X29,0XA2,0X98,0X24,0XA2,0X88,0XA5,0X98,
+0X38,0XA3,0X98,0X6F,0X11,0XC1,0X20,0XC0,0X69,0X11,0X0C,0XC2,0X00,0X3D,0XC2,0X38,
+0XC1,0X29,0XC3,0X65,0XC1,0X15,0XC1,0X66,0X09,0XC0,0X04,0XC1,0X56,0XC1,0X65,0XC3,
+0X5A,0X66,0XC1,0X21,0XC1,0X66,0XC2,0X5A,0X66,0XC0,0X0D,0XC1,0X14,0X19,0XC2,0X1C,
+0XC0,0X5E,0X19,0X21,0XC3,0X28,0X2D,0XC2,0X7E,0XC0,0X2D,0X35,0X3C,0X6E,0XC2,0X09,
+0XC1,0X15,0XC3,0X1D,0X24,0XC0,0X29,0XC0,0X1D,0X29,0X7E,0XC0,0X38,0X1D,0XA3,0X9A,
+0X90,0X87,0X94,0X87,0X6B,0XA2,0X88,0XC0,0X28,0X7E,0XC1,0X6E,0X21,0X30,0X28,0X30,
+0XA3,0X88,0XC0,0X66,0X27,0X18,0XA2,0X98,0X2C,0X9C,0X98,0X2C,0XAB,0XC8,0XB2,0X97,
+0XA9,0X79,0X3E,0XC1,0XA2,0X88,0X6E,0X6F,0XC1,0X6F,0XC1,0X37,0XC1,0X2F,0XC2,0X23,
+0X66,0X12,0X03,0X51,0X62,0X16,0X55,0X7A,0X07,0X9D,0X99,0X22,0X7F,0X9D,0X87,0X9A,
+0X79,0X62,0X5E,0X98,0X88,0X1B,0X9C,0X78,0X08,0X34,0X18,0XC0,0X9C,0X89,0X50,0X28,
+0X51,0X6E,0X62,0X1C,0XC0,0X14,0X1C,0X28,0X69,0X3C,0XA2,0X88,0XA5,0X98,0X15,0XA6,
+0X98,0X29,0X0C,0X29,0XA6,0X88,0X9B,0X98,0XA6,0X88,0X25,0X65,0X56,0XC1,0X7F,0X19,
+0X11,0XC2,0X0C,0X66,0X6D,0X3D,0XC2,0X38,0XC0,0X29,0XC3,0X24,0XC0,0X1D,0X5A,0X15,
+0X7A,0X56,0X69,0XC0,0X66,0XC0,0X01,0X66,0XC0,0X69,0XC0,0X66,0XC2,0X56,0XC1,0X69,
+0XC0,0X66,0X21,0X1C,0XC1,0X5A,0XC0,0X1C,0X0D,0XC1,0X6B,0X19,0XC1,0X1C,0XC1,0X5E,
+0X19,0X21,0XC1,0X28,0XC0,0X6E,0XC3,0X35,0XC1,0X3C,0X01,0XC2,0X09,0XC1,0X15,0XC3,
+0X1D,0XC2,0X29,0XC0,0X1D,0X38,0X31,0X38,0X3D,0X18,0XA4,0X88,0X85,0X98,0X56,0XA2,
+0X87,0X6B,0X35,0X28,0X3C,0X28,0X30,0XC2,0X35,0X7F,0XC1,0XA3,0X88,0X6B,0X27,0XC0,
+0X13,0XC0,0XA8,0X97,0XB4,0XA6,0XAC,0X89,0XA2,0X88,0X3E,0X03,0X12,0X23,0XC0,0X6E,
+0X6B,0XC0,0X7E,0XC1,0X6B,0XC0,0X37,0XC2,0X2F,0X23,0XC0,0X12,0X03,0X66,0X2A,0X66,
+0X16,0X69,0X0A,0X02,0X0A,0X22,0X51,0X9A,0X88,0X9B,0X89,0XA2,0X78,0X9A,0X88,0X9C,
+0X88,0X9D,0X89,0X08,0X52,0X9D,0X88,0X9C,0X89,0X3C,0X55,0X51,0X7B,0X55,0XC2,0X7E,
+0X55,0X1C,0X6F,0XC0,0X35,0XAF,0X99,0X9C,0X78,0X05,0X9C,0X89,0X11,0X7A,0XC0,0X20,
+0X11,0XA3,0X99,0X20,0X6E,0XC1,0X11,0X0C,0X20,0X69,0X11,0XC1,0X0C,0XC1,0X3D,0XC2,
+0X38,0XC1,0X31,0X29,0XC1,0X24,0X69,0XC0,0X15,0XC1,0X66,0X09,0XC1,0X66,0X01,0XC0,
+0X66,0X69,0X66,0XC2,0X5A,0XC0,0X66,0XC0,0X21,0XC0,0X66,0XC3,0X5A,0X1C,0X56,0X69,
+0X14,0X19,0XC2,0X6E,0X19,0X1C,0X1E,0X21,0XC0,0X28,0XC0,0X21,0X2D,0XC3,0X35,0X2D,
+0X35,0XC0,0X01,0XC1,0X09,0X01,0X09,0XC0,0X10,0X15,0XC1,0X1D,0XC1,0X24,0X1D,0X29,
+0XC0,0X31,0X29,0X31,0X38,0X3D,0X15,0X11,0X1C,0X8D,0X98,0XA2,0X88,0X6F,0X69,0X30,
+0XC0,0X3C,0X30,0XC1,0X56,0X3C,0X28,0X35,0X7F,0XC0,0X18,0XC0,0XA2,0X98,0X04,0X18,
+0X2F,0XB0,0XB7,0XB2,0X87,0X32,0X6F,0XC0,0X7F,0X17,0X6F,0X6E,0X6B,0X7E,0XC1,0X6F,
+0XC1,0X66,0X37,0XC3,0X28,0X23,0X17,0X66,0X51,0X32,0X2A,0X66,0X69,0X55,0X02,0X16,
+0X36,0X99,0X98,0X3A,0X98,0X88,0X9A,0X68,0X7F,0X51,0X9C,0X78,0X9D,0X89,0X3B,0X18,
+0X04,0X9D,0X89,0XC1,0X55,0X66,0XC1,0X19,0X7E,0XC0,0X14,0X7E,0X21,0X30,0XA6,0X78,
+0XA5,0X99,0XAC,0X88,0XA7,0X89,0X3D,0XA4,0X88,0X9A,0X98,0XA8,0X78,0X9D,0X98,0X34,
+0X25,0X7E,0XC0,0X25,0XC1,0X0C,0X20,0X19,0X5A,0X66,0XC1,0X0C,0XC0,0X05,0X3D,0XC2,
+0X66,0XC1,0X59,0X66,0XC1,0X24,0X1D,0X15,0XC1,0X10,0XC0,0X09,0X66,0XC0,0X01,0XC0,
+0X66,0X69,0XC0,0X66,0XC2,0X5A,0X66,0X69,0X28,0X21,0XC0,0X66,0XC3,0X56,0XC0,0X6E,
+0XC5,0X6E,0X21,0XC1,0X28,0X21,0X2D,0XC4,0X35,0XC1,0X01,0XC1,0X09,0XC2,0X10,0X15,
+0XC1,0X1D,0XC1,0X24,0XC0,0X29,0XC1,0X31,0XC0,0X29,0X31,0X38,0X15,0X11,0X86,0X98,
+0X9C,0X88,0XA2,0X87,0X6B,0X35,0X66,0X3C,0X35,0X30,0XC1,0X3C,0X28,0X30,0X35,0XA3,
+0X99,0XC0,0X61,0XA4,0X78,0X07,0X18,0X27,0XAB,0XB7,0XB3,0XA8,0XA8,0X78,0X32,0XA2,
+0X78,0X7F,0XC0,0X6F,0X2F,0XC0,0X7E,0X2F,0X7F,0X6E,0X3E,0X03,0XC1,0X3E,0X03,0XC0,
+0X37,0XC0,0X2F,0X69,0X17,0X56,0X61,0X32,0X5A,0X66,0XC0,0X65,0X56,0X69,0X62,0X9C,
+0X87,0X99,0X89,0X51,0X9B,0X79,0X1B,0XA2,0X88,0X9D,0X89,0X9C,0X88,0X3B,0X40,0X9D,
+0X99,0X3C,0X51,0XC0,0X66,0XC0,0X59,0X28,0X51,0X7A,0X14,0X7E,0X14,0XC0,0X1C,0X04,
+0X6E,0XAD,0X99,0XAF,0X89,0X98,0X88,0XAB,0X89,0X3D,0XA3,0X98,0XA4,0X88,0X19,0XA2,
+0X88,0X34,0XC1,0X25,0XC1,0X51,0X20,0XC0,0X19,0X11,0XC1,0X0C,0XC0,0X66,0X6D,0X3D,
+0XC1,0X38,0X31,0XC1,0X29,0XC1,0X65,0XC0,0X18,0XC0,0X15,0X66,0X69,0XC0,0X66,0XC1,
+0X56,0XC0,0X69,0XC0,0X66,0XC0,0X5A,0X30,0X56,0XC1,0X21,0XC1,0X66,0XC1,0X21,0X52,
+0XC1,0X6E,0XC4,0X21,0XC1,0X28,0XC1,0X2D,0XC3,0X35,0XC0,0X3C,0XC0,0X6E,0XC1,0X09,
+0XC1,0X10,0X15,0XC2,0X1D,0X24,0XC1,0X29,0XC2,0X38,0X31,0X3D,0XC0,0X24,0X3D,0X04,
+0X8A,0X98,0X6E,0XC0,0XA2,0X88,0X30,0XC3,0X3F,0X30,0X3F,0X30,0X6E,0XA3,0X99,0X04,
+0X7F,0X27,0XC0,0X9D,0X98,0XA3,0X88,0XA4,0XA8,0XB4,0X96,0XAD,0X99,0XA2,0X89,0XA2,
+0X78,0X6E,0X7F,0X6E,0X6B,0XA2,0X78,0X37,0XC1,0X6B,0X6E,0X3E,0X03,0XC5,0X37,0X2F,
+0X69,0X17,0X12,0X55,0X66,0X66,0X59,0X2A,0X66,0X69,0X0F,0XC0,0X36,0X3A,0XC0,0X22,
+0X9D,0X79,0X9A,0X88,0X5B,0X51,0X9D,0X88,0X3B,0X41,0X9D,0X99,0X55,0X51,0X6E,0X28,
+0XC0,0X65,0X52,0X69,0X6F,0XC0,0X1C,0XC1,0X30,0XC0,0XA7,0X88,0X1D,0X0C,0XA3,0X88,
+0XA2,0X88,0X98,0X98,0XA9,0X88,0X9C,0X89,0X34,0X39,0X34,0XC0,0X65,0X6E,0X25,0X20,
+0XC3,0X11,0XC2,0X0C,0XC1,0X05,0X3D,0XC1,0X38,0X69,0XC0,0X29,0XC1,0X66,0X1D,0X66,
+0X15,0XC1,0X10,0X09,0XC0,0X66,0XC0,0X5A,0X65,0XC0,0X66,0X35,0X30,0XC1,0X56,0XC1,
+0X21,0XC2,0X66,0XC0,0X56,0X19,0XC5,0X21,0XC2,0X28,0XC0,0X6E,0XC4,0X35,0XC0,0X6B,
+0X01,0XC1,0X09,0XC1,0X10,0XC0,0X18,0X15,0XC0,0X1D,0XC0,0X29,0XC4,0X31,0X38,0X3D,
+0XC0,0X05,0X24,0X0C,0X8B,0X98,0X98,0X88,0XA2,0X88,0X65,0XA2,0X88,0X41,0X30,0X3C,
+0X30,0X3C,0X30,0X3F,0XC0,0X30,0XA3,0X88,0X04,0X13,0X69,0X7F,0X0C,0X27,0X6D,0XB0,
+0XC8,0XAF,0X98,0XA7,0X78,0X32,0X7F,0X0D,0X17,0X6B,0X6E,0X6F,0X7E,0XC1,0X6F,0XC8,
+0X37,0X2F,0X69,0X17,0X12,0X56,0X3E,0XC1,0X32,0X2A,0X69,0X52,0X65,0XC0,0X9C,0X88,
+0X9D,0X99,0X3A,0X95,0X79,0X41,0X9A,0X79,0X7A,0X9C,0X78,0X9C,0X88,0X9D,0X89,0X51,
+0X56,0X61,0X6E,0X30,0X28,0X65,0XC0,0X56,0X1C,0XC0,0X14,0X1C,0X6E,0XC0,0X30,0X3C,
+0XA4,0X87,0XB8,0X89,0X56,0X20,0X7E,0X05,0XA4,0X89,0X69,0X39,0XC0,0X34,0XC1,0X2D,
+0XC0,0X51,0X6F,0XC0,0X20,0XC0,0X19,0X56,0XC2,0X0C,0XC0,0X05,0X3D,0XC1,0X66,0XC1,
+0X29,0XC1,0X24,0X69,0XC0,0X15,0XC0,0X66,0X69,0XC1,0X66,0XC0,0X5A,0X66,0XC0,0X35,
+0X66,0XC2,0X5A,0X66,0XC0,0X69,0XC3,0X52,0X6E,0XC1,0X6E,0X19,0XC0,0X21,0XC2,0X28,
+0X21,0X2D,0XC4,0X35,0X3C,0XC0,0X01,0XC2,0X09,0X10,0X15,0XC3,0X1D,0XC0,0X24,0X29,
+0XC2,0X31,0X38,0X3D,0XC2,0X0C,0X9D,0X98,0X31,0X89,0X99,0X9C,0X88,0X7E,0XA2,0X88,
+0X55,0XC0,0X6B,0XC0,0X30,0X3C,0X30,0XC0,0X28,0XA3,0X99,0X04,0X6E,0X76,0XA2,0X78,
+0XC1,0X7E,0XAA,0XA8,0XB1,0XA7,0XA9,0X89,0XA3,0X88,0X32,0XA2,0X78,0X17,0X6B,0X6E,
+0XC0,0X2F,0X37,0XC1,0X6F,0X66,0X03,0XC6,0X3E,0X2F,0X69,0X17,0X12,0XC0,0X51,0XC2,
+0X32,0X2A,0X69,0X51,0XC0,0X51,0X22,0X3A,0X06,0X92,0X78,0X9D,0X79,0X9C,0X89,0X51,
+0X9C,0X78,0X9D,0X99,0X9C,0X88,0X3C,0X10,0X3C,0X55,0X62,0X1C,0X5A,0X62,0X6E,0X19,
+0X14,0X1C,0XC0,0X30,0X35,0XA3,0X99,0X6E,0XC0,0XB8,0X89,0X39,0XC0,0X3D,0XA4,0X98,
+0X25,0XA3,0X99,0X69,0X39,0XC0,0X34,0XC1,0X51,0X25,0XC0,0X20,0X25,0X20,0XC0,0X69,
+0X5A,0X11,0XC0,0X0C,0XC0,0X66,0X3D,0XC1,0X66,0XC0,0X31,0X29,0XC1,0X24,0X69,0XC0,
+0X66,0XC0,0X56,0X69,0XC0,0X66,0XC1,0X56,0XC1,0X69,0X66,0XC1,0X5A,0X66,0X21,0XC4,
+0X52,0X6E,0X7A,0XC0,0X19,0XC0,0X21,0XC3,0X28,0XC1,0X2D,0XC1,0X35,0X2D,0X35,0X3C,
+0X6E,0XC1,0X09,0XC1,0X10,0X15,0XC1,0X1D,0XC1,0X24,0X29,0XC0,0X31,0XC0,0X29,0X38,
+0XC1,0X3D,0XC0,0X05,0X0C,0X38,0X99,0X97,0X8F,0X99,0X51,0XC0,0XA3,0X88,0X52,0XC0,
+0X7A,0X3C,0X3F,0XC0,0X30,0XC0,0X3F,0XC0,0X09,0X7F,0X13,0XC0,0X18,0X7E,0XA4,0X98,
+0XB1,0XB7,0X36,0XA4,0X88,0X7F,0X3E,0X0D,0X17,0X6F,0XC0,0X6E,0X2F,0X7E,0XC0,0X03,
+0XC5,0X6E,0XC1,0X62,0X37,0XC0,0X28,0X23,0X17,0X56,0X65,0XC0,0X66,0XC0,0X66,0X59,
+0X65,0X1E,0X0A,0XC0,0X66,0X9A,0X88,0X9C,0X78,0X6E,0X96,0X79,0X98,0X78,0X41,0X52,
+0X51,0X56,0X9C,0X98,0X9D,0X88,0X66,0X69,0XC0,0X5A,0XC1,0X51,0X7F,0X69,0X14,0X1C,
+0X6E,0X28,0X04,0X6F,0XA9,0X98,0X18,0XB8,0X78,0XA8,0X79,0X9D,0X98,0X00,0X39,0X25,
+0XA3,0X98,0X5A,0X39,0XC0,0X34,0X39,0X25,0X34,0X25,0XC2,0X66,0XC0,0X11,0XC0,0X66,
+0XC3,0X05,0X3D,0XC0,0X66,0XC0,0X31,0XC0,0X56,0XC1,0X1D,0X66,0XC0,0X56,0X15,0X10,
+0X69,0XC0,0X66,0XC0,0X5A,0X66,0X35,0XC0,0X66,0X5A,0X30,0X56,0XC0,0X69,0X28,0XC0,
+0X21,0XC0,0X52,0X6E,0X7A,0XC4,0X21,0XC0,0X28,0XC1,0X2D,0XC1,0X30,0XC0,0X35,0XC1,
+0X01,0XC0,0X04,0XC0,0X09,0XC0,0X10,0X15,0XC0,0X18,0XC0,0X24,0X29,0XC1,0X31,0XC1,
+0X29,0X38,0X3D,0XC0,0X05,0X0C,0XC0,0X38,0X00,0X90,0X88,0X95,0X98,0X6E,0X30,0X6F,
+0X30,0X3C,0X3F,0X6E,0XC0,0X30,0XC0,0X04,0X3C,0XA2,0X87,0X7F,0X13,0XC0,0X18,0X61,
+0XA4,0X88,0XAD,0XA7,0XAF,0XA8,0XA8,0X79,0X2A,0XA2,0X88,0X7E,0X12,0XA2,0X77,0X6B,
+0X6F,0XC0,0X37,0XC1,0X6F,0XC9,0X37,0X2F,0X23,0XC0,0X1C,0XC0,0X06,0X5A,0XC0,0X3E,
+0XC0,0X66,0X2A,0X65,0X55,0XC0,0X9C,0X99,0X22,0X9B,0X89,0X98,0X88,0X45,0X98,0X89,
+0X9B,0X89,0X9C,0X78,0X04,0X30,0X56,0X55,0XC3,0X7B,0X55,0XC0,0X55,0XA3,0X98,0X14,
+0XC0,0X7E,0XC0,0X30,0XA3,0X89,0X18,0XA9,0X89,0X9A,0X98,0XB6,0X78,0XA7,0X79,0X14,
+0X6F,0XA4,0X87,0X56,0XC0,0X7F,0X01,0X39,0XC0,0X25,0X7F,0XC0,0X25,0XC0,0X20,0XC3,
+0X69,0X11,0XC0,0X0C,0X69,0X3D,0XC3,0X38,0X69,0XC0,0X29,0XC0,0X1D,0X24,0X1D,0X66,
+0XC0,0X56,0XC0,0X69,0XC0,0X66,0XC0,0X56,0X69,0X66,0XC2,0X2D,0X66,0XC0,0X69,0X28,
+0X21,0XC0,0X52,0X7E,0XC3,0X21,0XC2,0X28,0XC0,0X2D,0XC2,0X30,0X35,0XC0,0X3C,0X6E,
+0XC1,0X04,0X10,0X09,0X15,0XC1,0X1D,0XC1,0X24,0X29,0XC0,0X31,0XC0,0X38,0XC0,0X31,
+0X3D,0XC1,0X0C,0XC0,0X11,0X38,0X18,0X91,0X98,0X98,0X88,0X6E,0X6B,0X3F,0X30,0X3C,
+0X30,0X3C,0X7E,0X35,0XC0,0X30,0XC0,0XA4,0X88,0X13,0X65,0X13,0X69,0X18,0X33,0XAF,
+0XB7,0XAB,0X99,0X1E,0XA2,0X78,0X03,0X12,0X6E,0X6F,0XC0,0X6F,0XC1,0X37,0XC1,0X6F,
+0XC8,0X37,0XC0,0X55,0X23,0XC0,0X69,0X12,0X55,0X12,0X03,0X62,0XC0,0X59,0X1E,0X0F,
+0X0A,0X36,0X65,0X41,0X98,0X89,0X99,0X79,0X9B,0X89,0X9A,0X88,0X9D,0X88,0X9C,0X89,
+0X3C,0XC0,0X66,0XC0,0X59,0XC0,0X51,0X7A,0X19,0X66,0X19,0XC1,0X1C,0XC1,0X6F,0X3C,
+0X13,0X04,0XAD,0X89,0X9C,0X87,0XAE,0X89,0XA8,0X88,0X3D,0XA8,0X98,0X5A,0XC0,0X9D,
+0X99,0XA2,0X88,0X69,0X56,0X25,0X34,0X69,0X34,0X2D,0XC0,0X25,0XC0,0X20,0X25,0X20,
+0X69,0X11,0XC1,0X66,0XC0,0X3D,0XC2,0X38,0X31,0XC0,0X29,0XC1,0X24,0X65,0X1D,0X18,
+0X56,0XC0,0X09,0XC0,0X66,0XC0,0X56,0X69,0XC0,0X66,0XC1,0X5A,0X66,0XC1,0X21,0X28,
+0X55,0X7A,0XC2,0X21,0XC2,0X2D,0XC5,0X35,0XC1,0X6F,0XC2,0X10,0XC0,0X15,0XC1,0X1D,
+0XC1,0X29,0XC2,0X31,0X38,0X3D,0XC2,0X7A,0X6B,0X0C,0X11,0X6E,0X38,0X1C,0X92,0X88,
+0X9D,0X98,0X6F,0X69,0X7F,0X30,0X3C,0X30,0X04,0X30,0X3C,0X04,0X9D,0X89,0X30,0X13,
+0X6E,0X13,0XC1,0XA6,0X87,0XAD,0XC7,0XAD,0X89,0XA7,0X89,0X2F,0X3E,0X7F,0X12,0X23,
+0XC0,0X6E,0X6B,0XC1,0X7E,0X6B,0XC0,0X6E,0XC9,0X37,0X2F,0X28,0XC0,0X23,0X69,0X56,
+0X66,0X61,0XC1,0X66,0X1E,0X55,0X66,0X36,0X55,0X66,0X9B,0X88,0X9A,0X79,0X98,0X78,
+0X9D,0X89,0X98,0X88,0X56,0X10,0X3C,0X51,0X66,0X55,0X6E,0X23,0X14,0X7A,0X14,0X19,
+0XC0,0X7A,0XC1,0X30,0X55,0X30,0X3F,0XA8,0X78,0X3C,0XAC,0X98,0X9C,0X77,0XB0,0X89,
+0XA5,0X88,0XA2,0X89,0XA2,0X88,0X6E,0XC0,0X65,0X56,0X25,0X08,0X01,0XC0,0X39,0XC0,
+0X34,0X69,0XC0,0X25,0XC1,0X66,0X19,0X11,0XC1,0X66,0XC0,0X3D,0XC3,0X38,0X31,0XC0,
+0X29,0X1D,0XC1,0X66,0XC0,0X56,0X09,0XC0,0X66,0XC1,0X56,0X69,0X66,0XC2,0X5A,0X66,
+0XC0,0X69,0X28,0X55,0XC0,0X7A,0XC1,0X21,0XC1,0X28,0XC1,0X2D,0XC1,0X35,0XC2,0X3C,
+0X6E,0XC1,0X09,0XC0,0X15,0X18,0XC0,0X1A,0X1D,0XC0,0X24,0X29,0XC0,0X31,0X38,0XC0,
+0X3D,0XC3,0X0C,0XC0,0X11,0XC1,0X2C,0X92,0X88,0X95,0X98,0X6F,0X30,0XC0,0X3C,0X30,
+0XC1,0X3F,0X30,0X3C,0X51,0X69,0X13,0XC2,0X55,0XA3,0X99,0XAB,0XA7,0XAB,0XB8,0X2A,
+0X1E,0XA2,0X88,0XA2,0X78,0X12,0X6E,0X6F,0XC1,0X2F,0XC1,0X7E,0XC0,0X6B,0X6E,0XC0,
+0X6E,0X03,0XC2,0X08,0X03,0XC0,0X3E,0X37,0X2F,0XC0,0X23,0X6E,0X23,0X59,0X62,0X65,
+0X66,0XC0,0X66,0X55,0X1E,0X16,0X61,0X36,0X55,0X22,0X9C,0X78,0X95,0X99,0X9B,0X79,
+0X9A,0X78,0X9A,0X88,0X3C,0X9D,0X99,0X69,0X23,0X59,0X14,0XC4,0X1C,0XC0,0X21,0X6B,
+0X21,0X30,0X3C,0XA2,0X87,0X04,0XA7,0X88,0X30,0XAC,0X78,0X7A,0X31,0X2C,0XAB,0X89,
+0X56,0X9C,0X87,0X66,0X69,0X66,0X20,0X19,0X11,0XC1,0XA3,0X98,0X25,0XC4,0X20,0XC0,
+0X19,0X11,0XC1,0X0C,0X3D,0XC2,0X38,0X31,0XC0,0X24,0XC0,0X29,0X1D,0X18,0XC0,0X15,
+0X10,0X69,0XC0,0X66,0XC0,0X56,0XC1,0X65,0X35,0X30,0XC0,0X5A,0X30,0X56,0XC0,0X55,
+0XC0,0X7A,0XC1,0X6E,0XC0,0X28,0XC1,0X2D,0XC2,0X35,0XC1,0X3C,0X6E,0XC1,0X09,0XC0,
+0X15,0XC0,0X18,0XC0,0X1D,0XC0,0X29,0XC1,0X31,0X38,0XC1,0X3D,0X6B,0X0C,0XC0,0X3D,
+0X0C,0X11,0XC0,0X0C,0X11,0X98,0X98,0X91,0X98,0X9A,0X88,0X6F,0X51,0X3C,0X30,0X6E,
+0X62,0X35,0X3F,0XC0,0X30,0X28,0X35,0X13,0X65,0X13,0X59,0X7A,0XA6,0X88,0XAD,0XA7,
+0XAA,0XA9,0XAA,0X77,0X1E,0X32,0X03,0X12,0X17,0X6F,0XC0,0X2F,0XC0,0X7E,0X2F,0XC0,
+0X37,0X6B,0X6E,0XC0,0X6E,0XC0,0X03,0XC0,0X08,0X03,0X08,0X03,0XC0,0X37,0XC0,0X2F,
+0X69,0XC0,0X23,0X59,0X66,0X61,0XC0,0X66,0X39,0X32,0X1E,0X16,0X61,0X36,0X27,0X61,
+0X9C,0X79,0X9C,0X77,0X93,0X8A,0X9D,0X89,0X9C,0X78,0X9A,0X88,0X41,0X62,0X59,0XC0,
+0X7A,0X19,0X66,0X65,0X19,0X14,0X19,0X1C,0X30,0X56,0XC1,0X30,0X04,0X2C,0X00,0XA3,
+0X89,0X3C,0X20,0XA3,0X98,0XA5,0X89,0X7E,0X25,0XA3,0X99,0XC0,0X55,0X08,0X69,0XC0,
+0X39,0X34,0XC0,0X11,0X25,0XC0,0X11,0X66,0XC0,0XA2,0X88,0XC3,0X11,0XC1,0X0C,0X69,
+0XC0,0X3D,0XC0,0X31,0XC0,0X29,0XC1,0X24,0X1D,0X18,0XC0,0X15,0X10,0X69,0XC0,0X66,
+0XC0,0X56,0XC0,0X69,0XC0,0X30,0XC2,0X56,0XC0,0X65,0XC1,0X21,0XC1,0X28,0X21,0X28,
+0XC0,0X6E,0XC1,0X6E,0X35,0XC0,0X3C,0X6E,0XC1,0X09,0XC0,0X10,0X15,0XC1,0X1D,0XC0,
+0X29,0XC1,0X31,0XC0,0X6B,0X3D,0XC1,0X05,0X0C,0XC0,0X3D,0X11,0X05,0X0C,0X20,0X25,
+0X8D,0XA8,0X95,0X89,0XC0,0X65,0XC0,0X3C,0X30,0XC1,0X6E,0XC1,0X30,0XC0,0XA2,0X88,
+0XC0,0X13,0XC0,0X3F,0XA3,0X88,0XAC,0XA7,0XAB,0X98,0X36,0X1E,0X2A,0XA2,0X87,0X03,
+0XA2,0X78,0X7E,0X6B,0X6E,0X2F,0XC0,0X7E,0X2F,0X37,0XC0,0X6B,0XC1,0XA2,0X77,0XC0,
+0X66,0XC0,0X08,0XC0,0X03,0XC1,0X37,0XC0,0X2F,0X28,0XC0,0X23,0X59,0X14,0X66,0X69,
+0X62,0X66,0X59,0X1E,0X56,0X0A,0X55,0X62,0X22,0X3A,0X9D,0X88,0X97,0X89,0X98,0X69,
+0X9A,0X88,0X18,0X04,0X41,0X66,0X65,0X56,0XC3,0X6E,0X1C,0X28,0XC1,0X7E,0XC1,0X3C,
+0X18,0XA6,0X88,0X56,0XA2,0X87,0X98,0X88,0X00,0XAD,0X88,0XA2,0X89,0XA9,0X89,0X7E,
+0X5A,0X0D,0X39,0X7E,0X39,0X0D,0X66,0XC0,0X39,0XC2,0X34,0X25,0X11,0X66,0X55,0X0C,
+0X20,0XC0,0X69,0X11,0XC0,0X0C,0XC0,0X3D,0XC0,0X38,0X29,0X38,0X29,0XC0,0X24,0XC0,
+0X18,0XC1,0X10,0XC1,0X69,0X66,0XC0,0X5A,0X66,0X69,0XC0,0X66,0XC0,0X5A,0X66,0XC0,
+0X65,0XC2,0X21,0XC1,0X28,0X2D,0XC3,0X35,0X3C,0XC0,0X01,0XC2,0X09,0XC0,0X10,0X15,
+0XC0,0X1D,0XC0,0X24,0X29,0XC1,0X7E,0X38,0X3D,0XC1,0X0C,0XC1,0X11,0X0C,0XC0,0X19,
+0X11,0X20,0X05,0X8B,0XA9,0X99,0X88,0X6F,0X69,0XC0,0X7F,0X30,0X35,0XC0,0X04,0XC0,
+0X35,0X62,0X3C,0XA2,0X87,0X62,0X7E,0XA2,0X78,0X3F,0XA8,0X87,0XAC,0XA7,0X26,0XA9,
+0X99,0X1E,0X2A,0XA3,0X88,0X6E,0X7F,0X23,0XC1,0X6F,0X37,0XC3,0X6B,0X6E,0X3E,0XA2,
+0X77,0XC0,0X03,0XC0,0X08,0XC0,0X03,0XC1,0X37,0XC1,0X55,0XC0,0X23,0XC0,0X55,0X0F,
+0X69,0X62,0X66,0X59,0X1E,0X16,0X0A,0X55,0X36,0X22,0XC0,0X2E,0X9D,0X79,0X92,0X79,
+0X00,0X9B,0X89,0X30,0X41,0XC0,0X66,0X19,0X14,0XC0,0X66,0X14,0XC1,0X7F,0X6E,0XC0,
+0X30,0XC0,0X28,0X35,0X09,0X2C,0XA8,0X88,0X9B,0X89,0XA2,0X88,0X18,0X00,0XAE,0X78,
+0X9D,0X98,0XB0,0X89,0XA2,0X88,0X0D,0XC0,0X66,0X0D,0X65,0X08,0XC1,0X34,0X6E,0XC1,
+0X34,0XC1,0X25,0X65,0X11,0X66,0XC0,0X19,0X11,0X0C,0X3D,0X0C,0X3D,0X38,0X3D,0X38,
+0X55,0XC2,0X66,0X1D,0X66,0XC0,0X15,0X66,0X09,0X66,0XC1,0X56,0XC0,0X69,0XC0,0X2D,
+0X7A,0X2D,0X30,0X1C,0XC1,0X21,0XC0,0X6B,0X21,0X2D,0XC3,0X35,0XC1,0X3C,0X6E,0XC2,
+0X6E,0X15,0X18,0X15,0XC0,0X1D,0X24,0X29,0XC1,0X38,0XC0,0X3D,0XC1,0X7E,0X0C,0XC0,
+0X11,0XC0,0X0C,0X11,0X7F,0XC0,0X25,0X1D,0X13,0X9D,0X88,0X56,0X30,0XC0,0X6E,0XC1,
+0X7F,0X35,0XC0,0X30,0XC0,0X7F,0XC0,0X04,0X13,0XC1,0XAD,0X97,0XAA,0XA8,0XA9,0X99,
+0XA5,0X88,0X16,0X2A,0X3E,0XA2,0X77,0X17,0X6E,0X6B,0X6E,0X6B,0X37,0XC2,0X2F,0X37,
+0X6B,0X03,0XC1,0X6E,0XC2,0X03,0X08,0X03,0XC0,0X37,0X2F,0X23,0XC1,0X56,0X69,0X66,
+0X69,0X66,0X61,0X2A,0X55,0X16,0X0A,0XC0,0X51,0XC0,0X22,0X9D,0X88,0X9B,0X99,0X9B,
+0X79,0X95,0X79,0X97,0X89,0X9C,0X88,0X56,0X55,0X66,0X51,0X6E,0XC0,0X14,0XC2,0X19,
+0X7A,0X28,0XC0,0X35,0X28,0X04,0X66,0X04,0XA3,0X99,0XAA,0X77,0X2C,0XA6,0X88,0X51,
+0XC0,0X31,0X9B,0X99,0XAB,0X88,0XA4,0X89,0X0D,0X7E,0X52,0XC0,0X0D,0X65,0X08,0X39,
+0X08,0X39,0XC1,0X34,0XC0,0X25,0XC0,0X9D,0X99,0X25,0X11,0X3D,0X0C,0X11,0X0C,0X38,
+0X3D,0X38,0XC0,0X31,0X38,0XC0,0X65,0X29,0XC0,0X1D,0X66,0XC0,0X5A,0X10,0X09,0XC0,
+0X04,0XC0,0X5A,0XC0,0X65,0X66,0XC3,0X51,0XC0,0X21,0XC2,0X6B,0X6E,0XC1,0X30,0XC0,
+0X35,0X3C,0X01,0XC2,0X04,0X09,0XC0,0X15,0XC2,0X1D,0X29,0XC1,0X38,0X31,0X38,0X3D,
+0XC0,0X7E,0X0C,0X11,0XC1,0X7E,0X11,0XC0,0X20,0X25,0X6E,0X8F,0XB9,0X93,0X88,0X56,
+0X65,0XC1,0X3C,0X04,0X30,0X3F,0X04,0X30,0XC0,0X6E,0X04,0X3F,0XC0,0XA3,0X88,0X04,
+0XA4,0X98,0XAD,0XA7,0XA8,0X88,0XA8,0X99,0X02,0X16,0XA2,0X78,0XA2,0X98,0X6F,0X17,
+0XC0,0X23,0XC0,0X6E,0X6B,0X7F,0X37,0XC2,0X3E,0X6E,0XC0,0X6E,0XC1,0X03,0XC3,0X3E,
+0X59,0X2F,0X23,0XC0,0X56,0X0F,0XC0,0X65,0X0F,0X03,0X51,0X62,0X16,0XC0,0X65,0XC0,
+0X55,0X36,0X22,0X50,0X51,0X9C,0X78,0X94,0X79,0X98,0X79,0X35,0X9D,0X89,0X66,0XC0,
+0X19,0X7A,0X14,0XC0,0X55,0X14,0XC0,0X19,0X7B,0X6E,0X3C,0X04,0X3C,0X30,0XC0,0X18,
+0X13,0XA5,0X88,0XA3,0X89,0XA5,0X88,0X98,0X88,0X20,0XA5,0X98,0XA6,0X89,0X2C,0XA8,
+0X88,0XA3,0X79,0X61,0X6E,0XC0,0X39,0X7E,0X39,0X66,0X39,0XC1,0X6E,0XC0,0X39,0X51,
+0XC0,0X7E,0X38,0X6E,0XC0,0X24,0X2C,0X3D,0X11,0X0C,0XC0,0X69,0X3D,0XC0,0X38,0XC0,
+0X29,0XC1,0X1D,0XC0,0X66,0XC0,0X56,0X09,0XC0,0X66,0XC0,0X56,0X69,0X3C,0X35,0XC0,
+0X66,0XC0,0X51,0XC0,0X21,0XC0,0X6B,0X21,0X28,0X6E,0XC1,0X30,0X35,0XC1,0X6F,0XC1,
+0X09,0XC0,0X10,0X6E,0XC1,0X1D,0XC0,0X24,0X29,0XC0,0X31,0X38,0X31,0X3D,0XC0,0X05,
+0X0C,0X11,0XC1,0X7E,0XC0,0X11,0X7F,0XC0,0X25,0X39,0X00,0X99,0X88,0X51,0X35,0X52,
+0XA3,0X98,0X51,0X35,0XC0,0X04,0X9D,0X99,0X35,0X30,0X04,0X30,0X35,0X3F,0XA2,0X87,
+0X6F,0XA4,0X98,0XA7,0XA8,0XAA,0X87,0XA9,0X99,0XA7,0X88,0X16,0X2F,0XA2,0X88,0X0F,
+0XC0,0X17,0X6F,0XC0,0X6E,0X6F,0X37,0X6B,0X37,0X56,0X37,0XC0,0X6F,0XC0,0X6E,0XC1,
+0X03,0XC3,0X3E,0X37,0X52,0X23,0X1B,0X0F,0X9D,0X89,0X66,0X02,0X07,0XA6,0X88,0X66,
+0X9D,0X88,0X61,0X02,0XC1,0X3B,0X36,0X55,0X9D,0X99,0X50,0X12,0X99,0X79,0X94,0X79,
+0X18,0X9B,0X89,0X14,0XC0,0X55,0X14,0XC1,0X65,0X6B,0XA2,0X77,0X7B,0X28,0X23,0X30,
+0X6F,0X04,0X30,0X04,0XC0,0XA3,0X99,0X0C,0XA9,0X89,0X9D,0X89,0XA4,0X88,0X0C,0XA5,
+0X98,0XA6,0X89,0X69,0XC0,0XAC,0X78,0XA6,0X89,0X55,0X52,0X0D,0XC1,0X39,0X7F,0XC0,
+0X65,0X56,0X20,0X11,0X66,0X3D,0X66,0X0C,0X11,0X7E,0X20,0X0C,0X11,0X6E,0X11,0X0C,
+0X69,0X3D,0XC0,0X38,0XC0,0X31,0X5A,0X29,0X24,0X1D,0X66,0XC0,0X10,0XC1,0X09,0X52,
+0X01,0XC0,0X3C,0X69,0X66,0XC1,0X55,0X1C,0X21,0XC1,0X6B,0X6E,0XC2,0X35,0XC1,0X3C,
+0X01,0XC1,0X09,0XC0,0X15,0XC2,0X1D,0X24,0X29,0XC0,0X31,0X38,0XC0,0X3D,0XC0,0X05,
+0X0C,0X11,0XC1,0X19,0X20,0X11,0X25,0XC0,0X11,0XC0,0X61,0X04,0XC0,0X9C,0X88,0XA3,
+0X89,0X65,0X3C,0XC0,0X69,0X7B,0X30,0X04,0X30,0X35,0X04,0X30,0X3F,0XA2,0X88,0X04,
+0XC0,0XA3,0XA8,0XA6,0X88,0XA8,0X98,0XA4,0X88,0X7A,0XA5,0X98,0XA7,0X98,0XA3,0X78,
+0X1E,0XA3,0X88,0XA2,0X78,0XA1,0X9A,0X69,0X6F,0X2F,0XC0,0X7F,0X69,0XC1,0X3E,0XC0,
+0X6E,0XC0,0X6E,0XC0,0X03,0X55,0X3E,0XC0,0X03,0X59,0X2F,0X9C,0X98,0X55,0X66,0X9B,
+0X99,0X9D,0X88,0X06,0X9D,0X99,0X7E,0X51,0XA6,0X88,0XA5,0X88,0X02,0X66,0XC0,0X69,
+0X6E,0X36,0X22,0X55,0X3A,0X9D,0X88,0X9A,0X78,0X96,0X79,0X96,0X79,0X3C,0X1C,0X56,
+0XC0,0X55,0X0F,0X14,0X1C,0X14,0X6E,0XC0,0X1C,0X6B,0X6E,0XC0,0X3C,0XA2,0X88,0XC0,
+0X04,0X7F,0XA2,0X78,0X18,0XA3,0X89,0XA4,0X87,0X52,0XA4,0X88,0X2C,0X9C,0X88,0X31,
+0X9A,0X88,0XA3,0X99,0X31,0XA7,0X99,0X6F,0XC0,0X3C,0X56,0XC0,0X9D,0X98,0X55,0XC0,
+0X14,0XA2,0X88,0X5E,0X25,0XA2,0X88,0X34,0X25,0X20,0XC1,0X55,0X66,0X11,0XC0,0X0C,
+0X05,0X56,0XC1,0X31,0XC0,0X29,0XC0,0X66,0XC0,0X18,0XC0,0X15,0X66,0X51,0X04,0XC0,
+0X01,0XC0,0X35,0XC0,0X66,0XC0,0X51,0X6E,0XC0,0X6B,0XC1,0X6E,0XC2,0X35,0XC0,0X3C,
+0X01,0XC1,0X7E,0XC0,0X10,0X15,0XC2,0X24,0X29,0XC0,0X31,0X6B,0XC0,0X3D,0XC0,0X05,
+0X0C,0X11,0XC1,0X16,0X20,0XC0,0X69,0X25,0XC1,0X39,0X09,0X8C,0X98,0X51,0XC0,0X6E,
+0X6F,0X66,0X04,0X35,0X04,0X30,0X3C,0X30,0X04,0X30,0X35,0X76,0X04,0XC0,0X3F,0XA5,
+0X98,0XA6,0X97,0XA2,0X89,0XA4,0X87,0XA2,0X98,0X7E,0X7E,0XA3,0X99,0XA3,0X98,0XA3,
+0X99,0XA3,0X89,0XA7,0X78,0XA3,0X89,0XA4,0X88,0XA3,0X78,0XC0,0X37,0XC0,0X56,0XC0,
+0X37,0XC2,0X03,0X37,0X2F,0X66,0X9D,0X98,0X6E,0X61,0X9D,0X99,0X22,0X9B,0XA9,0X56,
+0X9A,0X77,0XA3,0X89,0X55,0X7B,0X55,0X9C,0X88,0X05,0X9C,0X98,0X50,0X0A,0X1D,0XA3,
+0X88,0X6F,0X69,0X36,0X22,0X55,0X51,0X9D,0X98,0X9A,0X79,0X97,0X79,0X97,0X89,0X99,
+0X89,0X52,0X51,0X55,0XA2,0X88,0X65,0X0F,0X59,0X0F,0X14,0X6E,0X7F,0XC1,0X30,0X04,
+0X3C,0X04,0X6F,0X04,0XA2,0X88,0X10,0XA2,0X88,0X7E,0XA2,0X88,0X1C,0X65,0XAC,0X78,
+0X9A,0X99,0XA9,0X78,0X7A,0XA5,0X88,0X97,0X99,0XC0,0X05,0X28,0X55,0X25,0X39,0X7F,
+0X59,0XC0,0X25,0X39,0XC1,0X66,0X51,0XA2,0X87,0X20,0X25,0XC0,0X11,0X66,0X11,0XC0,
+0X0C,0X05,0X3D,0XC1,0X66,0X31,0X66,0X29,0X66,0X69,0X66,0X5A,0X61,0X6F,0X69,0X04,
+0XC0,0X56,0XC0,0X69,0XC1,0X1C,0XC0,0X21,0XC0,0X6B,0XC0,0X7E,0XC0,0X5A,0X35,0XC1,
+0X6F,0XC1,0X09,0XC1,0X15,0XC2,0X24,0X29,0XC1,0X38,0XC0,0X3D,0XC1,0X0C,0XC0,0X11,
+0XC1,0X20,0XC0,0X25,0X20,0X25,0XC0,0X7E,0XA3,0X89,0X89,0XA8,0X95,0X89,0X9D,0X98,
+0XA2,0X88,0X6E,0X3C,0X30,0XA2,0X88,0X30,0X3C,0X7A,0X30,0XC0,0X35,0X2B,0X35,0X33,
+0XA2,0X88,0XC0,0X6E,0XA4,0X88,0XA5,0XA9,0XA2,0X88,0X6E,0X7E,0X7A,0X0F,0X6B,0XA2,
+0X97,0X6B,0X2A,0XA8,0X88,0XA3,0X98,0XA5,0X89,0XA7,0X89,0XA2,0X78,0X2F,0XC6,0X6E,
+0X2F,0X9B,0X98,0X66,0X9D,0X98,0X9C,0X88,0X9D,0X98,0X98,0X89,0X9A,0X88,0X6E,0X26,
+0X5F,0XC0,0XA5,0XA8,0X1A,0X27,0X7B,0X51,0XC0,0X9C,0X77,0X9C,0X99,0XA5,0X98,0XAC,
+0X87,0XA7,0X8A,0X69,0XC1,0X50,0X9D,0X89,0X51,0X9B,0X88,0X99,0X79,0X93,0X8A,0X9B,
+0X79,0X9D,0X99,0X9D,0X99,0X69,0X56,0X0F,0X59,0X0F,0X08,0X14,0X28,0XC2,0X35,0X30,
+0X3C,0X30,0XA3,0X88,0X7F,0XC0,0X6E,0X52,0X18,0X7F,0X10,0XB4,0X88,0X6E,0X18,0XA4,
+0X88,0XA5,0X88,0X66,0XA4,0X78,0X3E,0X39,0X25,0X28,0XA3,0X89,0X7E,0X39,0XC2,0X2D,
+0XC0,0X25,0X20,0X25,0X20,0XC3,0X11,0X66,0X11,0X0C,0XC0,0X69,0X56,0XC1,0X65,0X2C,
+0X29,0XC0,0X1D,0X18,0X56,0X18,0X10,0XC0,0X69,0X66,0XC0,0X5A,0X65,0XC1,0X9D,0X99,
+0X21,0X6B,0XC2,0X6E,0X7A,0XC0,0X35,0XC0,0X01,0XC1,0X09,0XC1,0X10,0X15,0XC1,0X1D,
+0X24,0XC0,0X29,0X31,0X38,0X3D,0XC1,0X7B,0X0C,0X11,0XC1,0X19,0X20,0XC0,0X25,0X20,
+0X7E,0X6F,0X39,0X7A,0X84,0X87,0X9B,0X89,0X7A,0X56,0XA2,0X98,0XC0,0X30,0XA2,0X88,
+0X55,0XC1,0X62,0X04,0X30,0X35,0X30,0X33,0X04,0X7A,0XA9,0X99,0XA7,0X97,0X7A,0X56,
+0X23,0X9D,0X89,0X52,0X6E,0X51,0X7E,0XA3,0XA8,0XA7,0X88,0XA6,0X98,0XA2,0X88,0XA7,
+0X99,0XA5,0X88,0XA6,0X78,0X6F,0X6F,0X7A,0X23,0XC0,0X32,0X23,0X6E,0X62,0X40,0X9C,
+0X99,0X36,0X56,0X61,0X9B,0X89,0X0E,0XC0,0X56,0X9D,0X88,0X66,0XA2,0X88,0X0E,0XA5,
+0X98,0X52,0X6E,0XA2,0X98,0X65,0X3E,0X9A,0X89,0XC0,0X79,0XA8,0X88,0XA9,0X89,0X5E,
+0X2E,0X69,0X9D,0X99,0X9D,0X88,0X9C,0X88,0X9B,0X79,0X93,0X79,0X97,0X8A,0X55,0X14,
+0X55,0X0F,0X05,0X14,0XC0,0X65,0X0F,0XA3,0X88,0X2D,0X30,0XC0,0X28,0X30,0XC0,0X3C,
+0XC0,0XA4,0X87,0X51,0XA3,0X99,0XC0,0XA3,0X88,0X9B,0X99,0X66,0XAC,0X77,0XA7,0X89,
+0XA7,0X99,0X38,0X24,0XAA,0X87,0X6F,0XA3,0X99,0X0D,0X39,0XC0,0X20,0X25,0X39,0X01,
+0X39,0X34,0X25,0XA3,0X99,0X39,0X34,0X20,0X25,0XC2,0X20,0X19,0X0C,0X11,0X0C,0X69,
+0X0C,0X38,0X3D,0XC0,0X38,0X65,0X29,0XC0,0X65,0X66,0XC2,0X56,0X09,0X66,0XC1,0X56,
+0XC1,0X21,0XC1,0X6B,0X6E,0X7A,0XC1,0X6E,0X3C,0X35,0X6F,0XC1,0X09,0XC1,0X6F,0XC1,
+0X1D,0X24,0X29,0XC0,0X6E,0X38,0XC0,0X3D,0XC0,0X0C,0XC1,0X11,0XC0,0X20,0XC1,0X25,
+0XC1,0X34,0X39,0X6F,0X38,0X87,0XA7,0X5B,0X65,0XC0,0X3C,0X7A,0X30,0XA2,0X88,0X55,
+0X30,0X35,0X51,0X04,0X30,0XC3,0XA8,0X97,0X3E,0XAA,0X78,0XA3,0X98,0X6B,0X9D,0X98,
+0X9C,0X78,0X9D,0X98,0X1A,0X60,0X6F,0X9C,0X88,0XC0,0XA4,0X87,0XA7,0XA9,0X7E,0XA7,
+0X8A,0XA9,0X78,0XA3,0X88,0XA2,0X78,0X66,0XC4,0X55,0X9A,0XA8,0X3B,0X22,0X65,0X9C,
+0X88,0X99,0X99,0X9B,0X89,0XA3,0X88,0X6F,0X2A,0XA4,0X89,0XA9,0X89,0XA5,0X78,0X7A,
+0XA3,0X89,0X69,0X22,0X69,0X51,0X7F,0X51,0X51,0X9B,0X98,0X65,0XA5,0X89,0X27,0X22,
+0X55,0X9C,0X89,0X12,0X9B,0X79,0X95,0X79,0X04,0X41,0X51,0X0F,0X6E,0X0F,0X14,0X19,
+0X7F,0X66,0XA2,0X87,0X28,0XC0,0X30,0XC0,0X28,0XA2,0X87,0X6B,0XA2,0X88,0X04,0X7F,
+0XA5,0X88,0X51,0X00,0XA2,0X88,0X9B,0X88,0X6B,0XA4,0X87,0XA7,0X99,0X18,0XA6,0X88,
+0X9B,0X88,0X25,0XA3,0X88,0XA2,0X99,0XC0,0XA2,0X87,0X1C,0X0D,0X1C,0X50,0X39,0X08,
+0X34,0X39,0X25,0XC1,0X39,0X34,0X65,0X25,0XC0,0X20,0XC0,0X11,0XC1,0X51,0X7E,0X3D,
+0XC0,0X66,0XC0,0X55,0X66,0XC1,0X1D,0X18,0XC0,0X56,0XC0,0X09,0XC0,0X66,0XC0,0X56,
+0XC0,0X50,0X6B,0XC0,0X6E,0XC0,0X7A,0XC0,0X6E,0XC0,0X3C,0X6E,0XC1,0X09,0XC0,0X10,
+0XC0,0X6E,0XC0,0X1D,0XC0,0X24,0X29,0XC0,0X38,0XC1,0X3D,0X7A,0X0C,0X11,0XC1,0X20,
+0XC1,0X25,0XC0,0X7E,0X25,0X39,0XC0,0XA3,0X88,0X8B,0XB9,0X93,0X88,0XC0,0X9C,0X88,
+0XA3,0X89,0XC0,0X04,0X51,0X6E,0X3F,0X51,0X35,0X2B,0XA3,0X98,0X30,0X35,0X30,0XC0,
+0X04,0XAA,0XA8,0XB4,0XA7,0X27,0XA3,0X89,0X1B,0X1E,0X16,0XC0,0X9D,0XA8,0X9D,0X88,
+0X55,0X9A,0X99,0X51,0X59,0XA2,0X88,0XA2,0X88,0X16,0X1E,0XA4,0X78,0X17,0X6F,0XC0,
+0X66,0X23,0XC1,0X1E,0X0A,0X9C,0X98,0X16,0X9D,0X98,0X15,0X0B,0XA3,0X99,0X32,0X22,
+0X0A,0XA3,0X89,0XA4,0X89,0X2F,0X55,0XC0,0X66,0X1E,0X59,0X03,0X51,0X2A,0X0A,0X02,
+0X51,0X22,0X27,0XC0,0X62,0X3A,0X9D,0X88,0X9B,0X89,0X95,0X69,0X95,0X8A,0X9C,0X88,
+0XC0,0X9D,0X98,0X5A,0X08,0XC0,0X6F,0XC0,0X08,0X1C,0X30,0X28,0X3C,0X30,0X28,0XA2,
+0X87,0X3C,0XC0,0XA3,0X98,0X3F,0XA4,0X78,0XA4,0X88,0X7E,0XA2,0X88,0X0C,0X10,0X28,
+0XA6,0X88,0X99,0X88,0XA6,0X88,0XA7,0X89,0XA4,0X88,0XA5,0X99,0X34,0XA4,0X88,0X0D,
+0X7E,0X52,0X55,0X0D,0X08,0X39,0X1C,0X9A,0X88,0X39,0XC1,0X34,0XC0,0X55,0X34,0X25,
+0XC1,0X65,0X11,0X66,0X11,0X05,0X3D,0X05,0X3D,0X38,0X65,0X29,0X2C,0X29,0X66,0X1D,
+0X66,0XC0,0X5A,0X66,0X09,0X66,0XC0,0X5A,0XC0,0X21,0XC0,0X6B,0XC0,0X7E,0X5A,0X30,
+0X6E,0XC0,0X01,0XC2,0X09,0X10,0XC0,0X15,0XC1,0X24,0XC0,0X29,0XC0,0X6E,0X38,0XC0,
+0X3D,0XC0,0X05,0X0C,0X11,0XC0,0X19,0X20,0XC2,0X25,0X34,0X59,0X39,0X08,0X9D,0X98,
+0X84,0X97,0X42,0X65,0X56,0X3C,0X3F,0XC1,0X59,0X30,0XA2,0X88,0X30,0X3F,0X69,0X30,
+0XC0,0X55,0X3F,0X04,0XB0,0XA7,0XAF,0XA7,0XA5,0X99,0XA2,0X89,0X0A,0XA2,0X87,0X6B,
+0XC0,0X6E,0X17,0X0A,0X50,0X2A,0X9D,0X98,0X66,0X0A,0XA3,0X88,0XA2,0X89,0XA4,0X79,
+0XA2,0X88,0X7F,0XA2,0X77,0XC0,0X6F,0X69,0X17,0X52,0X1E,0X9B,0X98,0X65,0X05,0XA2,
+0X87,0X1E,0XA2,0X88,0XA2,0X79,0XA3,0X88,0X3E,0X03,0X6F,0X03,0X0F,0X66,0X0F,0X03,
+0X3E,0X56,0X65,0X65,0X56,0X02,0X65,0X56,0X36,0X55,0X22,0X9D,0X88,0X9D,0X99,0X9C,
+0X78,0X92,0X69,0X97,0X89,0X9C,0X78,0X9D,0X99,0XC0,0X51,0X6E,0XC0,0X14,0XC2,0X3C,
+0X28,0X3C,0XC0,0X04,0X51,0X3C,0X30,0XA5,0X89,0X04,0XA4,0X88,0XA6,0X88,0X56,0XA7,
+0X88,0X9D,0X99,0X99,0X98,0X9B,0X89,0X20,0XA3,0X98,0X9C,0X88,0X7E,0X3C,0XA7,0X89,
+0XAA,0X88,0XC0,0XA4,0X88,0X6F,0X6E,0X9D,0X98,0X39,0X21,0X51,0X11,0X01,0X0D,0X66,
+0XC0,0X39,0XC1,0X65,0X25,0XC0,0X66,0X19,0XC0,0X11,0XC0,0X66,0X3D,0X0C,0X51,0XC0,
+0X3D,0X38,0X29,0X7A,0X29,0X66,0XC0,0X65,0X56,0X15,0X09,0XC0,0X04,0XC1,0X9D,0X88,
+0XC0,0X6B,0XC0,0X7E,0X5A,0X7E,0X30,0X6F,0X6E,0XC0,0X09,0XC1,0X10,0X15,0XC1,0X1D,
+0X24,0XC0,0X29,0XC0,0X38,0XC0,0X3D,0XC0,0X7E,0X0C,0X11,0XC0,0X19,0X20,0X25,0XC1,
+0X11,0X34,0X39,0X34,0X39,0X1C,0X8D,0X98,0X91,0X98,0X6B,0X50,0X56,0XA2,0X98,0XA2,
+0X78,0X9D,0X99,0X6D,0X04,0X35,0XC0,0X30,0XA2,0X98,0X30,0X35,0X30,0XC0,0X3F,0X04,
+0XB2,0XB7,0X33,0X27,0XA2,0X87,0XA1,0X9A,0XA3,0X87,0XA1,0X9A,0X3E,0X0F,0X03,0X3E,
+0X1E,0X9D,0X98,0X2F,0X9D,0XA9,0X55,0X6E,0XA2,0X89,0X3E,0XA4,0X79,0XA2,0X88,0XA2,
+0X88,0X17,0X6E,0XC0,0X52,0X32,0X9D,0X98,0X51,0X51,0X65,0XC0,0X3E,0X6F,0XA3,0X89,
+0X03,0XC0,0X7F,0X0F,0X66,0X65,0XC1,0X32,0X3E,0X2A,0X32,0X51,0X51,0XC0,0X02,0X36,
+0XC0,0X2F,0X51,0X51,0X33,0X9A,0X89,0X93,0X69,0X96,0X7A,0X9D,0X88,0X9C,0X88,0X55,
+0XC0,0X7B,0X05,0X7A,0X14,0X7E,0X14,0X3C,0X30,0X28,0X04,0X3C,0X04,0X30,0XC0,0XA3,
+0X88,0XA2,0X88,0X6B,0X00,0XA7,0X89,0XA2,0X88,0XA7,0X89,0X1C,0X04,0XAD,0X99,0XA8,
+0X79,0X94,0X87,0XA3,0X98,0X9C,0X88,0XA2,0X88,0XA6,0X88,0XAA,0X78,0XA2,0X88,0XA2,
+0X88,0X0D,0XC0,0X2D,0X39,0XC0,0XA3,0X99,0X50,0X0D,0XC0,0X66,0XC0,0X01,0X39,0X2D,
+0X25,0X66,0XC1,0X25,0X20,0X19,0X11,0X3D,0XC4,0X2C,0XC0,0X29,0XC0,0X66,0X18,0X15,
+0X66,0X15,0X65,0XC0,0X66,0XC0,0X21,0X6B,0X6E,0XC0,0X7A,0X5E,0X7A,0XC0,0X6F,0XC2,
+0X09,0X10,0XC0,0X15,0XC0,0X7E,0X24,0XC0,0X29,0XC0,0X7E,0X6B,0X3D,0XC1,0X0C,0X11,
+0XC0,0X7A,0X20,0XC0,0X25,0XC0,0X7E,0X25,0XC0,0X2D,0X39,0X08,0X19,0X91,0X99,0X93,
+0X98,0XC0,0X51,0X2B,0X3F,0X04,0X56,0X3F,0X04,0X30,0X04,0X30,0X3F,0X69,0X30,0X2B,
+0XA2,0X77,0X76,0XA2,0X88,0X3A,0XAC,0X97,0XC0,0XA3,0X98,0X52,0X9A,0X88,0X65,0XA5,
+0X88,0XA3,0X89,0X1E,0XA7,0X79,0X66,0X03,0X9B,0XA8,0X51,0X9D,0X99,0X1B,0X7A,0X3E,
+0XA3,0X89,0XA2,0X88,0XA2,0X79,0X7E,0X17,0XC0,0X03,0X2A,0X9D,0X98,0X60,0X2F,0X32,
+0X0A,0XA3,0X88,0X7F,0X6F,0XA2,0X78,0XC0,0X17,0X3E,0X0A,0X36,0XA2,0X87,0X0A,0XA3,
+0X98,0X1E,0X23,0X1E,0X0A,0XC0,0X65,0X5A,0X36,0XC0,0X2F,0X1B,0X56,0X9D,0X98,0X9C,
+0X79,0X8F,0X7A,0X98,0X79,0X3C,0X9D,0X98,0X41,0X66,0X7F,0XC1,0X6E,0X6E,0XC0,0X30,
+0X3C,0X30,0X55,0XA4,0X89,0X3C,0X04,0X30,0XC0,0XA7,0X89,0X9D,0X98,0X38,0XA7,0X98,
+0X56,0XA7,0X88,0XA3,0X99,0X93,0X89,0X99,0XA8,0XB6,0X77,0X20,0X34,0XAA,0X88,0X9A,
+0X88,0X65,0X3C,0X18,0X2C,0X0C,0XA6,0X87,0X6B,0X51,0X0D,0XC0,0X39,0X08,0XC0,0X39,
+0XC1,0X34,0X39,0XC0,0X34,0X2D,0X56,0X65,0X20,0XC0,0X0C,0X51,0X11,0X0C,0X55,0X7A,
+0X3D,0X2C,0X31,0X5A,0X29,0XC0,0X1D,0X18,0XC1,0X56,0X09,0XC0,0X66,0X28,0XC0,0X6E,
+0X7A,0XC0,0X35,0XC0,0X6B,0X6E,0XC2,0X10,0X15,0XC2,0X24,0XC1,0X29,0X2E,0X38,0XC0,
+0X3D,0XC0,0X7E,0X0C,0X11,0XC0,0X20,0XC1,0X25,0X7E,0X34,0XC0,0X2D,0X34,0X25,0XA3,
+0X98,0X94,0X98,0X94,0X88,0X13,0X3F,0X41,0XC0,0XA3,0X98,0XC0,0X3F,0XC1,0X69,0X3F,
+0X55,0X04,0X38,0X30,0X66,0X38,0X51,0XA4,0X88,0X3A,0XA7,0X97,0X97,0X9A,0X96,0X68,
+0XA2,0X98,0X9D,0X89,0XC0,0XA6,0X97,0XA4,0X89,0XA5,0X87,0XA3,0XA9,0XAB,0X88,0XAC,
+0X78,0X56,0X9C,0X99,0X0A,0X2F,0X61,0X2F,0XA3,0X89,0XA3,0X99,0X6F,0X12,0XC0,0X17,
+0X12,0X32,0X0A,0X65,0X6E,0XA1,0X9A,0X2A,0X6E,0X32,0XC0,0X99,0X98,0X97,0XA9,0X9A,
+0X78,0X9A,0X78,0X9D,0X98,0X9A,0X79,0XA5,0X98,0XA6,0X98,0XA5,0X98,0XAA,0X88,0XA3,
+0X89,0X3E,0XC0,0X36,0X2A,0X6B,0X36,0XC0,0X69,0X27,0X51,0X33,0X9C,0X79,0X90,0X69,
+0X98,0X79,0X9C,0X98,0X9D,0X89,0X40,0X66,0X7E,0X6F,0X6E,0X14,0X7E,0X23,0XA2,0X87,
+0X6F,0X30,0XC0,0X3C,0XC0,0X69,0X04,0X30,0XA7,0X89,0X69,0XC0,0XA5,0X99,0XA9,0X89,
+0XA6,0X88,0X98,0X88,0X9D,0X98,0X93,0X89,0XA4,0X98,0XFE,0XB5,0X96,0X98,0X78,0X95,
+0XA8,0XC1,0X9B,0X89,0X7A,0XAF,0X78,0X3D,0X7E,0XA6,0X89,0X34,0X0D,0X7E,0X0D,0X08,
+0X0D,0XC1,0X39,0X08,0X39,0XC0,0X34,0XC0,0X25,0XC0,0X11,0X05,0X20,0X05,0X11,0XC0,
+0X66,0X00,0XC0,0X56,0XC1,0X2C,0XC0,0X56,0X1D,0X66,0XC0,0X5A,0X66,0X09,0XC0,0X9C,
+0X89,0X6E,0X30,0XC2,0X6F,0X6E,0XC1,0X09,0XC0,0X10,0XC0,0X15,0XC0,0X24,0XC1,0X6E,
+0X2C,0X38,0XC1,0X3D,0X7B,0X0C,0X11,0XC0,0X19,0X20,0XC0,0X25,0XC0,0X7E,0X34,0X39,
+0XC1,0X6E,0X2C,0X6E,0X8C,0X98,0X9D,0X89,0X35,0X66,0X6F,0X7E,0X6E,0X04,0XC2,0X30,
+0XC0,0X3C,0XC0,0X35,0X30,0X7A,0X30,0XA4,0X98,0XAC,0XA7,0X1A,0X97,0X8A,0X9D,0X78,
+0X9A,0X68,0X67,0XAC,0X88,0X2C,0X1C,0X66,0X3F,0XB0,0XA6,0XA9,0XB8,0XB1,0X79,0XA2,
+0X89,0X1E,0X0A,0X2A,0XC0,0X03,0XA3,0X9A,0XA3,0X78,0XA2,0X88,0X6F,0X17,0X03,0X61,
+0X9D,0X99,0X51,0X0A,0XA2,0X89,0XC0,0X1E,0X69,0X92,0XA8,0X92,0X69,0X96,0X59,0X56,
+0XC0,0X55,0X04,0X30,0XA3,0XA8,0XA7,0X98,0XA3,0XA8,0XA7,0XA8,0XAA,0X98,0XA4,0X78,
+0X16,0XC0,0X2F,0X6F,0X7A,0X3B,0X2F,0X51,0X9D,0X89,0X9C,0X88,0X8D,0X6B,0X98,0X88,
+0X3C,0X51,0X14,0X51,0X6E,0XA2,0X88,0X7B,0X14,0X28,0XC0,0X30,0X3C,0XC1,0X30,0X04,
+0X3C,0X7A,0X04,0XA5,0X89,0X2C,0XA2,0X88,0X9D,0X88,0XAF,0X89,0XA3,0X99,0XAA,0X78,
+0X94,0X98,0X96,0X88,0X99,0X98,0XAC,0X88,0XB6,0X78,0X0C,0X7F,0X97,0X88,0XA9,0X98,
+0X96,0X88,0X98,0X87,0XB3,0X89,0X7F,0X14,0XA5,0X88,0X08,0XC0,0X34,0X0D,0X7E,0X0D,
+0X01,0X0D,0X08,0XC0,0X01,0X39,0X51,0XC0,0X66,0X25,0XC0,0X51,0X65,0X14,0X11,0X0C,
+0XC0,0X59,0X62,0XC1,0X2E,0X66,0X24,0X69,0XC0,0X66,0X5A,0XC0,0X66,0X69,0X9C,0X89,
+0XC0,0X30,0XC0,0X35,0XC0,0X3C,0X6E,0XC1,0X09,0XC0,0X10,0X15,0XC0,0X24,0XC1,0X29,
+0XC0,0X31,0X38,0X3D,0XC1,0X0C,0XC0,0X11,0X19,0XC0,0X20,0X25,0XC0,0X34,0XC1,0X39,
+0XC0,0X08,0X39,0X05,0X18,0X00,0X9A,0X88,0X51,0X56,0XA2,0X88,0XA2,0X88,0X69,0X51,
+0X3F,0X04,0XC0,0X28,0X3F,0X04,0XC0,0X65,0X51,0X33,0X38,0XA6,0X98,0XA7,0X98,0X9A,
+0X89,0X9B,0X78,0X9D,0X8A,0X06,0XB9,0X78,0XAE,0X89,0XFE,0X31,0X24,0X99,0X88,0XBB,
+0X7B,0X9A,0X88,0X8A,0X96,0XA9,0XA8,0XB5,0XB7,0X0A,0X6F,0X7F,0X9D,0X88,0X2A,0X3E,
+0XA5,0X79,0XA3,0X89,0XA2,0X88,0X6E,0X23,0X0F,0X9D,0XA8,0X50,0X67,0X1E,0XC1,0X61,
+0X90,0X88,0X94,0X68,0X9F,0X6B,0X13,0X30,0XFE,0X9D,0X17,0X87,0XA6,0X24,0XAC,0X89,
+0XA3,0X89,0X30,0XA2,0X98,0XA8,0XA7,0XA8,0X98,0XA6,0X97,0XA4,0X88,0XA6,0X78,0XA5,
+0X88,0X0A,0X6E,0X65,0X56,0X9D,0X99,0X02,0X9B,0X89,0X8F,0X6A,0X96,0X79,0X37,0X55,
+0X51,0X51,0X6E,0X28,0X6E,0X1C,0X28,0X37,0X30,0X3C,0X04,0X30,0X3C,0X6E,0X04,0X3C,
+0XC0,0XA2,0X88,0XA4,0X88,0XC0,0X50,0XAB,0X99,0X18,0XB0,0X88,0X91,0X88,0X9C,0X88,
+0X94,0X98,0X6E,0X1D,0XA4,0X88,0X1D,0XAC,0X89,0X8F,0X97,0XA9,0X99,0X56,0X91,0X98,
+0XB1,0X89,0XA2,0X88,0XC0,0X9D,0X89,0XA5,0X98,0X6F,0X9D,0X88,0X7E,0X3C,0XA2,0X78,
+0X08,0X39,0X34,0XC4,0X25,0XC0,0X65,0X11,0XC2,0X0C,0X3D,0XC1,0X66,0XC0,0X65,0XC0,
+0X56,0X1D,0X18,0XC0,0X15,0X66,0XC0,0X9D,0X88,0XC0,0X7A,0XC0,0X35,0XC0,0X6B,0X6E,
+0XC0,0X7E,0XC1,0X15,0XC1,0X24,0XC0,0X6E,0XC1,0X38,0XC0,0X3D,0XC0,0X05,0X0C,0X11,
+0XC0,0X20,0XC0,0X25,0XC0,0X7E,0X34,0X39,0XC1,0X08,0X0D,0X0C,0X20,0X93,0X97,0X98,
+0X89,0X9B,0X98,0X9C,0X88,0X6E,0XC0,0X13,0X59,0X04,0X3F,0XC0,0X04,0X30,0X04,0X3F,
+0XC0,0X33,0X30,0X33,0X6E,0XAB,0XA9,0XA3,0X98,0X9B,0X88,0X9B,0X79,0XA5,0XB9,0XB0,
+0X88,0XB4,0X58,0X55,0X38,0X76,0XA2,0X59,0X7E,0X9C,0X97,0XAA,0X89,0XB1,0X88,0XA4,
+0XB6,0X1E,0X6B,0X1E,0X3E,0X03,0XA4,0X79,0XA3,0X89,0XA3,0X88,0X7F,0X28,0X61,0X9D,
+0X99,0X32,0X2F,0X66,0X61,0X55,0X97,0XA8,0X8D,0X6A,0XA8,0X69,0XB7,0X79,0X38,0X24,
+0XAB,0X7B,0X3F,0X38,0XA7,0X99,0XFE,0XDE,0XDB,0X8B,0XB8,0X93,0X98,0X98,0X88,0XA2,
+0X78,0XA6,0XA8,0XA8,0XA7,0XAC,0X77,0XA5,0X8A,0X1E,0X55,0X65,0XC0,0X22,0X02,0X12,
+0X2B,0X94,0X79,0X3F,0X10,0X9A,0X88,0X66,0X59,0XA3,0X99,0XA2,0X88,0X28,0X37,0X3C,
+0XC3,0X30,0X04,0XC1,0X30,0X04,0XA6,0X88,0XA3,0X89,0X9B,0X98,0X20,0XAF,0X89,0XA7,
+0X98,0XC0,0X95,0X98,0X9A,0X89,0X9D,0X87,0XA6,0X89,0XAD,0X88,0X98,0X88,0X2D,0XA2,
+0X89,0X8D,0X98,0XAA,0X88,0XC0,0X94,0X98,0X38,0XA4,0X88,0XA4,0X88,0X3C,0XC0,0X08,
+0XC0,0X3C,0X39,0XA2,0X88,0XC1,0X08,0X69,0X39,0X66,0XC0,0X2D,0X56,0X65,0X11,0X20,
+0X11,0XC0,0X51,0X7E,0XC0,0X3D,0XC0,0X38,0X69,0X2C,0XC0,0X1D,0XC0,0X66,0XC0,0X56,
+0XC0,0X9C,0X88,0X30,0X5A,0X7E,0X6B,0X35,0X6F,0XC1,0X7E,0XC0,0X10,0X6E,0XC0,0X7F,
+0XC0,0X29,0XC1,0X31,0X38,0X3D,0XC0,0X7F,0XC1,0X11,0X19,0X20,0X25,0XC0,0X7E,0X34,
+0XC0,0X39,0XC0,0X08,0X0D,0X20,0X34,0X25,0X8E,0XA7,0X9A,0X79,0X04,0X51,0XA3,0X89,
+0X3F,0XA3,0X88,0X04,0XC1,0X3F,0X04,0X52,0X04,0X7A,0X55,0X3F,0X30,0X38,0XC0,0XB0,
+0XA7,0XA6,0X98,0X51,0X94,0X89,0X9D,0X88,0XAC,0XA8,0XB8,0X59,0XAA,0X68,0XFE,0X39,
+0X85,0X33,0XB1,0X89,0XA2,0X88,0X8A,0X97,0XBB,0X7A,0XB9,0X87,0X83,0XC9,0XB4,0X96,
+0XA7,0X79,0X66,0X9C,0X87,0X69,0XA2,0X89,0XA4,0X79,0XA3,0X89,0XA2,0X87,0X66,0X51,
+0X61,0X03,0X3E,0XC0,0X1E,0X50,0X8A,0X99,0XA2,0X89,0XB7,0X49,0XA8,0X68,0X07,0X9D,
+0X98,0XFE,0X9C,0XF5,0X83,0XA6,0X9C,0X98,0XAB,0X7A,0XFE,0XE7,0X3D,0X88,0XE6,0X93,
+0X98,0XA3,0X79,0X02,0XA5,0XA8,0XA7,0X89,0XA6,0X77,0XA4,0X88,0XC1,0X52,0X03,0X9D,
+0X99,0X9C,0X88,0X99,0X89,0X91,0X69,0X30,0X04,0XA3,0X88,0X99,0X89,0X14,0X66,0XA2,
+0X88,0XA2,0X88,0X6E,0XC2,0X04,0X3C,0XC0,0X04,0X3C,0XC0,0X04,0XC0,0X30,0XA6,0X88,
+0XA6,0X88,0X18,0XA3,0X89,0XAD,0X88,0XA9,0X99,0XA2,0X88,0X9C,0X78,0X35,0X96,0X88,
+0X33,0X2D,0X28,0XA4,0X88,0X51,0X6F,0X8F,0X97,0XA6,0X99,0X5A,0X9B,0X98,0XAC,0X89,
+0X5D,0X3C,0X08,0X0D,0XA2,0X88,0X08,0XA2,0X88,0X39,0X0D,0XC0,0X08,0XC0,0X69,0X39,
+0XC0,0X2D,0X51,0X25,0X66,0XC1,0X3D,0X7F,0X6E,0X0C,0X3D,0XC1,0X66,0XC0,0X55,0XC0,
+0X66,0X69,0X18,0X56,0X18,0X9C,0X78,0X7A,0X35,0XC0,0X6B,0X6E,0XC1,0X09,0XC0,0X10,
+0X6E,0XC0,0X1D,0X24,0XC0,0X29,0XC0,0X7E,0X38,0X3D,0XC0,0X05,0X0C,0XC0,0X11,0XC0,
+0X20,0X25,0XC1,0X7F,0XC0,0X39,0XC0,0X08,0XC0,0X39,0XC0,0X14,0X39,0X88,0X97,0X9C,
+0X89,0X04,0X51,0X3F,0X04,0X7F,0X04,0XA2,0X88,0X07,0X3F,0X30,0XC0,0X04,0XC1,0X3F,
+0X30,0X3F,0X6D,0XB1,0XB8,0XA7,0XA8,0X66,0X96,0X88,0X9A,0X89,0XA3,0X88,0XA7,0XA8,
+0XB3,0X5A,0XA3,0X69,0X07,0X9C,0X88,0XC0,0XAC,0X88,0XFE,0XD6,0X58,0X99,0XB8,0X8B,
+0XB8,0X6E,0XFE,0XFF,0X3B,0X9D,0X88,0X9B,0XA8,0X65,0XA2,0X78,0XA3,0X8A,0XA4,0X78,
+0XA2,0X88,0X65,0X9D,0X99,0X12,0XC1,0X55,0X61,0X8F,0XA8,0X9C,0X99,0X71,0XB4,0X18,
+0XAA,0X69,0X8A,0X99,0X1F,0XA4,0X87,0X55,0X52,0XFE,0XA4,0XB2,0X9F,0XC7,0X94,0X98,
+0X25,0XA3,0X99,0XAB,0X98,0XA6,0X78,0XA5,0X69,0X7F,0X65,0X6E,0X17,0X56,0X65,0X9D,
+0X99,0X9B,0X89,0X9B,0X99,0X8E,0X59,0X97,0X79,0X65,0X51,0X6E,0X56,0X61,0XA2,0X89,
+0X3C,0X55,0X3C,0XC2,0X69,0X3C,0X30,0XA3,0X89,0XC0,0X55,0X3C,0XC0,0X2C,0XA4,0X88,
+0X51,0X9D,0X89,0XAD,0X98,0XA6,0X79,0XAA,0X87,0X66,0X94,0X88,0X92,0X98,0X04,0XA7,
+0X98,0XA2,0X79,0XC0,0XA7,0X88,0XA5,0X88,0X99,0X99,0X8D,0XA8,0XA6,0X88,0X9C,0X88,
+0XA6,0X88,0XA3,0X78,0XA9,0X9A,0X9B,0X88,0XA3,0X99,0X0D,0X21,0X08,0XA2,0X87,0X39,
+0X0D,0XC0,0X08,0XC0,0X39,0X25,0XC0,0X7F,0X51,0X25,0X20,0X11,0XC0,0X66,0XC1,0X55,
+0XC1,0X38,0XC0,0X55,0XC0,0X66,0XC0,0X65,0XC1,0X9C,0X78,0XC0,0X7E,0XC1,0X6B,0X04,
+0X6E,0XC1,0X6B,0X6E,0XC0,0X7E,0X24,0XC0,0X29,0X7E,0X38,0XC0,0X3D,0XC0,0X7E,0X0C,
+0X11,0XC0,0X20,0XC0,0X25,0XC0,0X7B,0X34,0X39,0XC0,0X08,0XC0,0X0D,0X9D,0X98,0X08,
+0X11,0X7E,0X8B,0XA9,0X9C,0X78,0X51,0X30,0X6F,0X3F,0XA3,0X88,0X51,0XC0,0X07,0X45,
+0X30,0X35,0XA2,0X98,0X13,0X07,0X3F,0X69,0X66,0XA4,0X77,0XB0,0XB8,0XA8,0X97,0XA2,
+0X88,0X9C,0X98,0X95,0X89,0X7F,0X7F,0XA5,0X98,0XA5,0X78,0X6F,0X9D,0X79,0XA4,0X98,
+0XA6,0X88,0X9C,0X97,0XC0,0XA3,0X8A,0X9C,0X77,0X32,0XA5,0X79,0X32,0X55,0X6B,0XA4,
+0X78,0X37,0XA2,0X78,0X66,0X9D,0X98,0X65,0XC0,0X6E,0X0F,0X70,0X8A,0X98,0XA1,0XA9,
+0X2B,0X55,0XAA,0X78,0XA4,0X68,0X90,0X89,0X99,0X8A,0XA4,0X87,0XA5,0XA8,0XAB,0XA7,
+0X98,0X98,0X9B,0X89,0X7E,0XA9,0X89,0XA7,0X78,0X0A,0XA3,0X89,0XC0,0X69,0XC0,0X66,
+0X55,0X61,0X51,0X9B,0X88,0X98,0X89,0X90,0X59,0X9D,0X89,0X97,0X99,0X7E,0X41,0X6F,
+0XC0,0X7E,0X3C,0XC0,0X66,0X3C,0XC1,0X04,0XC1,0X55,0XA3,0X99,0X3C,0X3F,0X30,0X18,
+0XA9,0X88,0X52,0X9A,0X87,0XAF,0X99,0X51,0XAB,0X89,0XA6,0X88,0X94,0X88,0X20,0XA8,
+0X88,0XA3,0X89,0X39,0X7E,0X9D,0X99,0XA5,0X89,0XA4,0X88,0X1C,0X8D,0X98,0X24,0X30,
+0XA2,0X88,0X14,0XA8,0X88,0X34,0XA2,0X88,0X6E,0X6E,0X08,0X0D,0X08,0X0D,0X01,0X39,
+0X65,0X39,0XC0,0X25,0X66,0XC1,0X25,0X20,0X55,0XC0,0X66,0XC0,0X55,0XC1,0X66,0XC0,
+0X55,0X7A,0X56,0XC0,0X18,0XC0,0X30,0XC0,0X6E,0XC0,0X6F,0X04,0XC0,0X6E,0XC0,0X10,
+0X6E,0XC0,0X7E,0X24,0XC0,0X29,0XC0,0X31,0X38,0X3D,0XC1,0X0C,0X11,0XC1,0X20,0XC0,
+0X25,0X2D,0X34,0XC0,0X39,0XC0,0X08,0X0D,0X25,0XA5,0X99,0X39,0X14,0X51,0X90,0X88,
+0X9B,0X98,0X9A,0X88,0X3C,0X30,0XA3,0X88,0X66,0X55,0X04,0X3F,0X30,0XC0,0X35,0XA2,
+0X98,0X6F,0X07,0X55,0XC0,0X66,0XA5,0X88,0XB0,0XB7,0XAA,0X87,0X7F,0XC0,0X9C,0X98,
+0X9B,0X98,0X7F,0XC0,0XA2,0X89,0XA7,0X89,0X55,0XA7,0X79,0X65,0X65,0X6E,0XA5,0X8A,
+0X6E,0XA2,0X87,0XA3,0X89,0X37,0X23,0XC0,0X17,0XA4,0X78,0XA2,0X79,0X03,0X50,0X65,
+0XC0,0X5A,0X7B,0X37,0X9D,0X98,0X9C,0X99,0X9B,0X99,0X6E,0X6F,0XA2,0X98,0X51,0XA4,
+0X78,0XA2,0X88,0X20,0X99,0X98,0X7F,0X6E,0XA3,0X88,0X3E,0X1E,0X6E,0X2A,0XC0,0X6E,
+0X23,0XC0,0X61,0X3E,0X22,0X2E,0X98,0X79,0X92,0X58,0X61,0X9C,0X79,0X3C,0X9D,0X89,
+0X98,0X79,0X7F,0X14,0XA4,0X88,0X66,0X3C,0XC0,0X04,0X3C,0X30,0X35,0X3C,0X35,0X04,
+0XC0,0X3C,0X7A,0XC0,0XA6,0X77,0XA7,0X9A,0XA3,0X88,0X99,0X88,0XAB,0X99,0XA3,0X98,
+0XAB,0X79,0X9A,0X98,0X04,0X96,0X88,0XAB,0X99,0X08,0X7E,0XA2,0X78,0X0D,0XA5,0X88,
+0XA3,0X89,0X9C,0X99,0X1C,0X65,0X04,0X00,0XA3,0X89,0XA6,0X88,0X9C,0X88,0XC1,0X7F,
+0X59,0X2D,0X56,0XA2,0X98,0X39,0XC0,0X25,0XC1,0X34,0XC0,0X25,0XC0,0X20,0XC0,0X55,
+0XC0,0X66,0X69,0X56,0XC0,0X66,0XC0,0X65,0X29,0X66,0XC0,0X69,0X66,0X9C,0X88,0XC0,
+0X6E,0X01,0XC0,0X6E,0XC0,0X7A,0XC0,0X6B,0X6E,0XC0,0X1D,0X24,0XC0,0X29,0XC0,0X38,
+0XC0,0X3D,0XC0,0X0C,0XC0,0X11,0XC0,0X20,0X25,0XC0,0X2D,0XC0,0X34,0X39,0X6E,0X08,
+0X0D,0X39,0X08,0X1C,0X39,0X20,0X18,0X93,0X98,0X41,0X3F,0X55,0X6F,0X7E,0XC1,0X6E,
+0X3F,0X69,0X5A,0X30,0XA3,0X99,0X69,0X66,0X3F,0X30,0X33,0XA5,0X98,0X16,0X2E,0XA3,
+0X98,0XC0,0X6B,0X51,0X7E,0X66,0X66,0XA4,0X77,0XA2,0X79,0X66,0XC0,0X69,0XA3,0X88,
+0X2A,0XA2,0X88,0XA2,0X88,0XC0,0X54,0X9D,0X99,0X2F,0XA3,0X89,0XA4,0X88,0XA3,0X79,
+0X61,0X9D,0X98,0X69,0XC0,0X28,0X6B,0X60,0X5A,0X1B,0X99,0XB9,0X00,0X20,0X31,0XC0,
+0XA3,0X88,0XC0,0X25,0XC1,0XA3,0X88,0XA2,0X88,0XA2,0X78,0X2A,0X6E,0X32,0XC0,0X26,
+0X6B,0X23,0X62,0X9D,0X98,0X41,0X9A,0X88,0X96,0X78,0X93,0X7A,0X9C,0X87,0XB1,0X98,
+0X93,0X89,0X52,0X98,0X68,0X7F,0X51,0XA3,0X88,0XC0,0X7F,0XC0,0X04,0XC0,0X30,0X3C,
+0XC0,0X6E,0X3C,0X04,0X52,0X7E,0XC0,0XA3,0X88,0XA6,0X78,0X10,0X13,0XB8,0X78,0X97,
+0X98,0XAE,0X78,0XA2,0X88,0X92,0X99,0X99,0X88,0XA9,0X98,0XA7,0X89,0XA4,0X88,0XA7,
+0X89,0X9D,0X98,0X0D,0XA3,0X99,0X04,0X65,0X88,0X88,0XAA,0X88,0X98,0X88,0XAE,0X87,
+0X0D,0X66,0X51,0XA3,0X98,0X6F,0X0D,0X51,0X3C,0XC0,0X39,0X34,0X39,0X01,0X39,0X34,
+0XC0,0X55,0XC0,0X66,0XC1,0X55,0XC0,0X66,0X69,0X56,0XC0,0X66,0XC0,0X2C,0XC0,0X29,
+0X66,0X1D,0X9B,0X99,0X6E,0XC0,0X6B,0X6E,0XC0,0X7A,0X6F,0XC0,0X15,0XC0,0X1D,0XC0,
+0X24,0X29,0XC0,0X7E,0X38,0X3D,0XC0,0X0C,0XC0,0X11,0XC1,0X20,0XC0,0X25,0XC0,0X34,
+0X39,0XC1,0X08,0XC0,0X34,0X1C,0X0D,0XC0,0X34,0X91,0X98,0X18,0XA3,0X88,0X9B,0X99,
+0X51,0XC0,0X04,0XC0,0X13,0X04,0XC0,0X55,0X30,0XC0,0X18,0X13,0X04,0X07,0X30,0X33,
+0XA4,0X98,0XB5,0XA7,0XA9,0X98,0XA3,0X88,0X7F,0X6F,0X7A,0X3E,0X6E,0XC0,0X0A,0X12,
+0X0A,0X6B,0XA2,0X98,0XA2,0X67,0X7F,0XC0,0XA2,0X88,0XC0,0X50,0X55,0X2F,0X12,0XA5,
+0X78,0X6F,0X66,0X50,0XC0,0X66,0X28,0X6B,0X28,0X17,0X3E,0X51,0XC0,0X51,0X7E,0XC0,
+0X2A,0X7A,0X32,0X55,0X32,0X69,0X66,0X32,0XC1,0X3E,0X32,0XC0,0X2D,0X1E,0X65,0X41,
+0X9C,0X88,0X99,0X99,0X95,0X79,0X95,0X89,0XAD,0X98,0X55,0X0B,0X41,0X19,0XA3,0X99,
+0X55,0X66,0X2D,0X3C,0XC3,0X04,0X66,0XC0,0X04,0XC1,0X3C,0X35,0X09,0X31,0XAD,0X99,
+0X94,0X78,0X2C,0X97,0X88,0XAE,0X99,0X6E,0X10,0X9A,0X97,0X1C,0X2C,0XAF,0X89,0X65,
+0X5A,0X66,0X51,0X30,0X1C,0X9C,0X88,0X8C,0X97,0XA8,0X88,0XA3,0X89,0XAE,0X88,0X41,
+0X1C,0X65,0X5E,0XA2,0X98,0X0D,0XC3,0X65,0X56,0XC1,0X34,0X69,0X25,0XC1,0X20,0X55,
+0XC0,0X0C,0X66,0X59,0XC0,0X66,0XC1,0X69,0X56,0X66,0X1D,0X9B,0X99,0X6E,0X6B,0X6E,
+0XC1,0X7F,0XC1,0X15,0XC0,0X24,0XC1,0X29,0X31,0X38,0XC0,0X3D,0X05,0X0C,0X11,0XC1,
+0X20,0XC0,0X25,0XC0,0X34,0XC0,0X39,0XC0,0X7F,0X0D,0X39,0X08,0X1C,0X0D,0X08,0X20,
+0X93,0X97,0X98,0X99,0X40,0X9B,0X99,0X51,0X3F,0X04,0X7E,0X3F,0X04,0XC0,0X65,0X30,
+0X6E,0XA3,0X99,0XC0,0X04,0XC0,0X38,0X33,0XA4,0X88,0XB6,0XB7,0X02,0XA4,0X88,0XA2,
+0X88,0XA2,0X78,0X7A,0X1E,0X32,0XC0,0X5A,0X32,0X6B,0X32,0X6F,0X6E,0XC0,0X7F,0XC1,
+0X50,0X55,0X67,0X12,0XA4,0X78,0XA2,0X78,0X65,0X51,0X65,0XC0,0X28,0X6F,0X37,0X65,
+0X17,0X56,0X03,0XC0,0X6B,0X12,0X17,0XC0,0X12,0X65,0X03,0X3E,0X32,0XC1,0X3E,0XC1,
+0X32,0X66,0X1E,0X65,0X51,0X9B,0X89,0X99,0X89,0X91,0X79,0XA2,0X87,0XA4,0X98,0X98,
+0X78,0XA3,0X99,0X0B,0X93,0X79,0XA5,0X89,0XC0,0X9D,0X98,0X6F,0X3C,0XC4,0X04,0X6F,
+0X30,0XC1,0X10,0X04,0XC0,0XA6,0X88,0XA7,0X89,0XA3,0X88,0XA3,0X99,0X1D,0XA3,0X99,
+0X6F,0X2C,0X93,0X98,0X6E,0XAA,0X89,0XAE,0X78,0X7A,0XA3,0X89,0XA2,0X87,0X24,0XA2,
+0X78,0X56,0X35,0X8E,0X98,0X9C,0X98,0X18,0XA6,0X78,0XA9,0X99,0X9B,0X98,0X24,0X0D,
+0X7F,0XC0,0X0D,0XC3,0X66,0X55,0X66,0X39,0X34,0X69,0X25,0XC0,0X20,0XC0,0X11,0XC0,
+0X0C,0XC0,0X3D,0XC0,0X66,0XC0,0X2C,0XC0,0X56,0XC0,0X9C,0X87,0XC0,0X01,0XC1,0X04,
+0X6E,0X6B,0X6E,0XC0,0X1D,0X24,0XC0,0X29,0XC0,0X7E,0X3D,0XC1,0X0C,0XC0,0X11,0XC0,
+0X7E,0X20,0XC0,0X25,0X2D,0X34,0X39,0XC0,0X08,0XC1,0X39,0XA2,0X99,0X1C,0XC0,0X34,
+0X39,0X8E,0X97,0X99,0X9A,0X54,0X9A,0X89,0X65,0XA2,0X88,0X6E,0X04,0X3F,0XC0,0X3C,
+0X69,0X04,0X35,0XA3,0X99,0X66,0X04,0X7A,0X55,0X52,0XA6,0X97,0XB4,0XA7,0X0E,0X36,
+0XA2,0X98,0X6F,0X1E,0X32,0X6F,0XC0,0X03,0XC0,0X3E,0X03,0XC0,0X7B,0X6E,0X6E,0X12,
+0X03,0X65,0X52,0X2F,0X0F,0XA4,0X88,0XA2,0X78,0X51,0X65,0X17,0XC0,0X28,0X6E,0X37,
+0XC0,0X28,0X66,0X17,0XC0,0X6B,0X7E,0X23,0XC1,0X69,0X12,0X06,0XC1,0X3E,0X03,0X3E,
+0X32,0XC0,0X51,0XC0,0X65,0X36,0X02,0X99,0X89,0X90,0X69,0XA7,0X98,0X9D,0X88,0XA3,
+0X98,0X3B,0X8E,0X69,0XA2,0X88,0X30,0X3C,0XC0,0X55,0X7B,0X3C,0XC2,0X35,0XC0,0X3F,
+0XA2,0X78,0X3C,0X04,0X30,0X04,0X10,0XA2,0X88,0XB5,0X88,0X92,0X98,0X6F,0XB3,0X99,
+0X97,0X88,0XAA,0X88,0X9A,0X88,0X96,0X88,0X9D,0X98,0XA4,0X89,0XAF,0X88,0XAA,0X78,
+0X9B,0X99,0XA3,0X88,0XC0,0X51,0X30,0XC1,0X28,0XA2,0X88,0XB5,0X79,0X9D,0X99,0XA4,
+0X88,0X51,0X21,0XC0,0X0D,0X1C,0X0D,0XC1,0X08,0XC1,0X39,0X34,0X39,0X34,0X25,0XC1,
+0X20,0X69,0X11,0XC0,0X0C,0X3D,0XC1,0X66,0XC0,0X2C,0XC0,0X29,0X9B,0X98,0XC0,0X6F,
+0XC0,0X6E,0X76,0X6F,0XC0,0X15,0XC1,0X7F,0XC0,0X29,0X38,0XC0,0X3D,0XC1,0X0C,0XC0,
+0X11,0XC0,0X20,0XC0,0X25,0XC0,0X34,0XC0,0X39,0X7E,0X08,0X0D,0X01,0X0D,0X1C,0XC1,
+0X9C,0X87,0XA3,0X99,0X8A,0X87,0XA2,0X89,0X98,0X87,0X9A,0X88,0X67,0X35,0X7F,0XC2,
+0X65,0X3F,0X04,0X51,0XA4,0X88,0X13,0XC0,0X07,0X38,0X52,0X1B,0XB5,0XC7,0XA9,0X89,
+0XA6,0X87,0XA2,0X89,0X1E,0X32,0X6F,0XC0,0X7E,0X6F,0XC3,0X17,0XC1,0X12,0X03,0X2F,
+0X65,0X2F,0X03,0XA5,0X89,0X6F,0X55,0X61,0X69,0X12,0X1C,0XA2,0X78,0X7A,0X37,0XC0,
+0X55,0X23,0XC1,0X7E,0X6B,0X28,0X23,0XC0,0X17,0X12,0XC0,0X66,0X06,0XC0,0X66,0XC0,
+0X55,0X66,0X19,0X51,0X9D,0X98,0X2E,0X98,0X79,0X94,0X79,0XA6,0X87,0X7A,0XA4,0X87,
+0X95,0X79,0X90,0X6A,0XA4,0X88,0XC0,0XA3,0X88,0X66,0X28,0X6E,0X3C,0X28,0X7E,0X3C,
+0X04,0X3C,0XC0,0X13,0X04,0XC3,0XA2,0X88,0XAE,0X78,0X66,0X97,0X98,0XB2,0X78,0XAB,
+0X99,0X8E,0X88,0XAD,0X89,0X96,0X87,0X93,0XA8,0XAF,0X89,0X31,0XAE,0X89,0X99,0X99,
+0XA9,0X88,0X9D,0X88,0X04,0X51,0X51,0X6E,0X51,0X00,0X14,0X1C,0X51,0X34,0X1C,0X21,
+0X0D,0X65,0X1C,0XC0,0X0D,0XC1,0X08,0XC0,0X34,0X39,0X34,0X69,0X56,0XC0,0X66,0XC0,
+0X11,0XC0,0X0C,0XC0,0X65,0X3D,0XC0,0X66,0X31,0X2C,0X29,0X9B,0X98,0XC0,0X6F,0XC1,
+0X7F,0XC0,0X15,0XC0,0X7E,0XC0,0X6B,0X29,0XC0,0X31,0X38,0X3D,0XC0,0X7E,0X0C,0X11,
+0XC0,0X20,0XC0,0X25,0XC0,0X34,0XC0,0X39,0X6B,0X08,0X0D,0X08,0XC0,0X1C,0X21,0XC0,
+0X0D,0X39,0X08,0X8A,0X97,0X6F,0X9C,0X88,0X97,0X98,0XC0,0X6E,0X7F,0X6E,0X61,0X7F,
+0X38,0XC0,0X35,0X30,0XA3,0X98,0X1B,0X07,0X13,0X3F,0X51,0XA4,0X97,0XB6,0XB7,0X02,
+0X36,0X19,0X32,0X3E,0X7A,0X06,0X12,0XC1,0X17,0XC1,0X6E,0X7B,0X17,0X12,0X55,0X9D,
+0X98,0X56,0X2A,0X03,0XA4,0X89,0XA2,0X78,0X37,0X55,0X17,0X12,0X17,0X28,0XC1,0X37,
+0XC1,0X65,0X28,0X2B,0X32,0XC0,0X55,0X26,0X17,0X12,0X17,0X12,0X06,0X01,0X06,0X3E,
+0X65,0X1E,0X19,0X50,0X9C,0X88,0X99,0X79,0X96,0X89,0X9A,0X77,0XA6,0X98,0XA4,0X97,
+0X6F,0X88,0X6A,0X9B,0X79,0X30,0XC0,0X3C,0XC1,0X51,0X3C,0XC0,0X55,0X3C,0XC0,0X04,
+0XC0,0X3C,0XA3,0X98,0X3F,0X3C,0XC0,0X30,0X13,0XAE,0X78,0X9B,0X98,0XC0,0XA4,0X89,
+0X0D,0XA5,0X99,0X8B,0X98,0XAD,0X88,0X85,0XA9,0XB3,0X88,0XA6,0X78,0X04,0X51,0XC0,
+0XA4,0X88,0X55,0X04,0X55,0X08,0X18,0X87,0X88,0XA0,0XA8,0XB5,0X68,0X76,0X9C,0X89,
+0X08,0X21,0X0D,0XC0,0X7F,0X69,0XC1,0X0D,0X08,0XC0,0X39,0XC1,0X66,0X2D,0X25,0XC0,
+0X66,0X69,0X11,0X66,0XC1,0X3D,0XC1,0X66,0X29,0XC0,0X9B,0X99,0X6E,0XC0,0X7E,0X10,
+0XC1,0X6E,0XC0,0X7F,0XC0,0X29,0XC1,0X38,0XC0,0X3D,0XC0,0X0C,0X11,0XC0,0X19,0X20,
+0X25,0XC0,0X7B,0X34,0XC0,0X39,0X08,0XC0,0X0D,0XC0,0X08,0X1C,0X21,0X1C,0X21,0X39,
+0XA3,0X98,0X86,0X98,0XA3,0X89,0X61,0X3F,0X55,0X6E,0X7F,0X3F,0X04,0X3F,0XC1,0X30,
+0X35,0XA2,0X98,0X7F,0X0C,0XC0,0X33,0X56,0XA2,0X87,0XB6,0XB7,0XAA,0X88,0XA5,0X98,
+0XA4,0X89,0XA3,0X88,0X6F,0X06,0XC0,0X12,0X6E,0XC0,0X6B,0XC0,0X17,0X6F,0X17,0XC0,
+0X12,0X50,0X9D,0X99,0X56,0XA2,0X88,0X12,0XA4,0X78,0X6F,0X60,0X17,0X12,0X55,0X17,
+0X6E,0X7B,0X2B,0X37,0XC0,0X6E,0X52,0X37,0X66,0X37,0X32,0XC0,0X2B,0X26,0X66,0X17,
+0X62,0XC1,0X65,0X56,0X69,0X1E,0X51,0X9D,0X99,0X9C,0X77,0X99,0X89,0X93,0X79,0XA5,
+0XB8,0XA8,0X87,0X61,0X94,0X69,0X00,0XC0,0XA4,0X88,0XC0,0XA2,0X88,0XC0,0X6E,0X30,
+0X3C,0X66,0X3C,0XC1,0X04,0XC2,0XA3,0X89,0X9C,0X98,0X3C,0X30,0X04,0XA5,0X99,0XAB,
+0X78,0X99,0X98,0X34,0XAC,0X88,0XAE,0X78,0X25,0X95,0X98,0X95,0XA9,0XA7,0X88,0XAA,
+0X88,0XAE,0X79,0X65,0X6E,0XA2,0X88,0X56,0XC0,0X18,0X08,0XA4,0X88,0X9D,0X89,0X84,
+0XA6,0XBC,0X79,0X6F,0X10,0XA3,0X78,0X9D,0X99,0X08,0XA3,0X88,0X1C,0X21,0X1C,0XC0,
+0X0D,0XC1,0X08,0X55,0XC1,0X66,0X25,0XC0,0X20,0XC0,0X69,0X56,0XC0,0X66,0X59,0X76,
+0X5A,0X66,0XC0,0X69,0X9A,0X89,0X6E,0XC1,0X7E,0X6B,0X6E,0XC1,0X7F,0XC0,0X29,0XC0,
+0X38,0XC1,0X3D,0X00,0X0C,0X11,0XC0,0X20,0XC0,0X25,0XC0,0X7A,0X34,0XC0,0X39,0X08,
+0X0D,0XC0,0X08,0X0D,0X21,0XC1,0X1C,0X08,0XA2,0X87,0X89,0X98,0XA4,0X89,0X0F,0X3F,
+0X59,0XC0,0X3F,0XC2,0X6E,0X51,0X3F,0X30,0X04,0X13,0X1B,0X55,0X3F,0X51,0X69,0XB6,
+0XB7,0XAB,0X98,0XA5,0X99,0XA5,0X89,0X32,0X7F,0X3E,0X7F,0X12,0XC0,0X17,0X7B,0X6E,
+0XC1,0X17,0X12,0X3E,0X54,0X9D,0X99,0XC0,0X2A,0XA3,0X89,0XA4,0X78,0X7F,0X23,0X17,
+0X0D,0X03,0XC0,0X17,0XC0,0XA2,0X88,0X6F,0XC3,0X66,0X37,0XC1,0X32,0X66,0X64,0X21,
+0X12,0X0D,0XC0,0X55,0X66,0X65,0X1E,0X9D,0X99,0X9C,0X88,0X9B,0X88,0X99,0X88,0X93,
+0X7A,0XB0,0XA6,0XA2,0X88,0X93,0X89,0X8B,0X5B,0XC0,0X6E,0XA4,0X88,0X7F,0XC0,0X2D,
+0X3C,0XA2,0X88,0X9D,0X99,0X3C,0X04,0X37,0XA3,0X87,0X7F,0X13,0X3F,0XC0,0X10,0X18,
+0X3F,0X41,0X3F,0XA5,0X88,0XAA,0X78,0X9B,0X99,0XA8,0X88,0XA8,0X88,0X9D,0X99,0XAF,
+0X88,0X8F,0X88,0X93,0X99,0XAF,0X98,0X95,0X89,0XBD,0X88,0X9D,0X89,0XC0,0XA4,0X88,
+0X11,0X6B,0X35,0XC0,0X51,0XA3,0X99,0X87,0X97,0XAA,0X89,0X35,0X98,0X98,0X35,0X9C,
+0X88,0X15,0X08,0XA2,0X88,0X21,0XC0,0X1C,0X15,0X0D,0XC0,0X08,0X55,0X6E,0X39,0X66,
+0X28,0X5A,0X66,0XC0,0X55,0XC1,0X66,0X3D,0X00,0X3D,0XC0,0X66,0X31,0X9A,0X89,0X6E,
+0X7A,0X09,0XC0,0X6B,0X6E,0XC1,0X7F,0XC0,0X29,0XC0,0X31,0X38,0X3D,0XC0,0X7B,0X0C,
+0X11,0XC0,0X20,0XC0,0X25,0XC1,0X34,0X39,0XC0,0X08,0X0D,0XC0,0X39,0X1C,0X21,0X1C,
+0XA2,0X88,0X50,0XC0,0X0D,0X8A,0X98,0XA6,0X88,0X9B,0X99,0X92,0X87,0X3F,0X59,0X7A,
+0X3F,0X38,0X13,0X30,0XC0,0X3F,0X30,0X13,0X55,0X13,0XC0,0X3F,0X33,0X9D,0X88,0XB6,
+0XA7,0XAB,0XA9,0XA6,0X98,0XA5,0X78,0XA3,0X99,0XA2,0X88,0X5A,0X7F,0XC0,0X12,0XC0,
+0X7F,0X6E,0XC0,0X56,0X17,0X0D,0X3E,0X9D,0X88,0X0A,0XC0,0XA2,0X89,0XA4,0X77,0X32,
+0X6E,0X23,0X12,0X06,0X55,0X66,0X3E,0X17,0X26,0X6E,0X6F,0XC6,0X66,0X66,0XC0,0X26,
+0X61,0X12,0X0D,0X01,0X56,0X25,0X19,0X36,0X9B,0X89,0X9A,0X88,0X99,0X88,0X94,0X79,
+0XA2,0X87,0X33,0X9B,0X79,0XA2,0X88,0X65,0XC0,0XA3,0X89,0XA3,0X88,0X66,0XC0,0X55,
+0X04,0XA2,0X89,0X3C,0X04,0X13,0X3C,0X04,0XA2,0X88,0X56,0X18,0X3C,0X18,0X6F,0X18,
+0X30,0X13,0XAB,0X78,0XA4,0X98,0X99,0X89,0XAB,0X98,0XA7,0X89,0X6F,0X9C,0X88,0X90,
+0X97,0XA5,0X89,0X65,0XB4,0X78,0XA5,0X89,0XC0,0X1D,0XC1,0X9B,0X99,0XA3,0X88,0X30,
+0X1C,0X9B,0X88,0X8D,0XA8,0XBC,0X79,0X9D,0X88,0X1C,0X21,0XC0,0X35,0X21,0XC1,0X1C,
+0XC0,0X55,0XC1,0X51,0X01,0X39,0XC0,0X66,0X59,0X25,0X20,0XC0,0X11,0XC0,0X66,0XC0,
+0X65,0X3D,0XC0,0X38,0XC0,0X9A,0X88,0X6E,0X6E,0XC0,0X7B,0XC0,0X6E,0XC0,0X7F,0XC0,
+0X29,0XC1,0X38,0X3D,0XC0,0X6E,0X0C,0X11,0XC0,0X20,0XC0,0X25,0XC0,0X34,0XC0,0X39,
+0X34,0XA2,0X88,0XC0,0X0D,0XC1,0X21,0X1C,0X69,0X30,0X21,0X9D,0X98,0X21,0X28,0XAB,
+0X89,0X95,0X99,0X94,0X87,0X7F,0X6E,0X3F,0XC0,0X13,0X04,0X3F,0X59,0X3F,0X35,0XA1,
+0XA9,0X13,0XC0,0X69,0X33,0X3F,0X9C,0X77,0XB1,0XB8,0XAF,0XB8,0XA6,0X88,0XA5,0X89,
+0XA3,0X99,0XA2,0X78,0X7E,0X6F,0X12,0XC1,0X7F,0XC0,0X26,0X17,0XC0,0X12,0X3E,0X9A,
+0X97,0X41,0XA3,0X99,0X19,0X12,0X23,0X37,0X23,0X0D,0X55,0X61,0X55,0X6E,0XA4,0X78,
+0XA2,0X89,0X26,0X2B,0X32,0X37,0XC2,0X6B,0X37,0X32,0X66,0XC0,0X21,0X17,0X12,0X65,
+0X01,0X51,0X1E,0X05,0X9D,0X88,0X9B,0X89,0X9A,0X87,0X98,0X79,0X91,0X69,0X98,0X89,
+0XC1,0XA3,0X88,0X66,0X66,0XA3,0X88,0XA2,0X88,0XC0,0X30,0X28,0X3C,0XC0,0XA4,0X88,
+0X04,0X6F,0X7E,0X04,0X18,0X09,0X04,0X10,0X9C,0X98,0X18,0XC0,0X04,0XC0,0XA6,0X88,
+0XA7,0X89,0XC0,0XA8,0X88,0XA8,0X88,0XC0,0X1C,0X88,0X97,0XC0,0XA5,0X99,0XAC,0X78,
+0XA2,0X88,0XA9,0X88,0XA2,0X89,0X1D,0X9D,0X99,0X6E,0X9D,0X99,0XC0,0X69,0X1D,0XFE,
+0X31,0X45,0X1C,0X7F,0X9D,0X88,0X1C,0X6E,0XA2,0X88,0X30,0X21,0XC1,0X1C,0X69,0X56,
+0X08,0XC1,0X55,0XC0,0X34,0X66,0X25,0XC0,0X20,0XC0,0X55,0XC0,0X66,0X69,0X56,0XC0,
+0X38,0XC0,0X9B,0X98,0X5A,0X04,0X6F,0X6E,0XC1,0X7E,0X6B,0XC0,0X6E,0XC0,0X38,0XC0,
+0X3D,0XC0,0X05,0X11,0XC2,0X20,0X25,0XC0,0X34,0X39,0XC0,0X08,0X39,0X08,0X0D,0X08,
+0X69,0X21,0XC0,0X30,0X1C,0X08,0X7E,0X30,0X83,0XA8,0XAD,0X79,0X97,0XA8,0X94,0X87,
+0X56,0XA2,0X88,0XC1,0X07,0XC0,0X45,0X3F,0X35,0X33,0X07,0X04,0X13,0X69,0X3F,0XC0,
+0X9C,0X88,0XAC,0X87,0XB2,0XC8,0XA6,0X87,0XA5,0X99,0XA4,0X78,0X2D,0XA2,0X88,0X06,
+0X12,0XC0,0X1A,0XC0,0X26,0XC1,0X55,0X12,0X50,0X97,0X98,0X6F,0XA3,0X89,0X19,0X06,
+0XA5,0X79,0X3E,0X9D,0X98,0X03,0X61,0X51,0X54,0X62,0X32,0XA5,0X79,0X7E,0X26,0X6F,
+0X37,0XC1,0X6B,0XC1,0X32,0X66,0XC0,0X65,0XC0,0X51,0X01,0X66,0X55,0X19,0X51,0X0E,
+0X9C,0X78,0X99,0X99,0X97,0X79,0X35,0X9A,0X89,0X7F,0X6E,0X7F,0X14,0XC0,0XA3,0X88,
+0XC0,0X7F,0X2D,0X66,0X2D,0XA3,0X99,0X9D,0X99,0XA4,0X87,0XC0,0X6F,0X10,0XC0,0X24,
+0X04,0X10,0X04,0X6E,0XC0,0X10,0X13,0XA3,0X88,0XA5,0X88,0X7F,0XA7,0X88,0XA6,0X89,
+0XB1,0X89,0X90,0X88,0X97,0X98,0X9D,0X98,0XA2,0X88,0XB0,0X78,0X2C,0XAB,0X89,0XA2,
+0X88,0XA3,0X88,0X7E,0X6F,0X9C,0X88,0X65,0X09,0X18,0X3C,0XAE,0X77,0X35,0X9C,0X88,
+0XA2,0X98,0X30,0XC2,0X55,0XC0,0X1C,0XC0,0X69,0X51,0X0D,0X66,0X01,0X39,0XC0,0X66,
+0X2F,0X25,0X20,0XC0,0X69,0X56,0XC0,0X66,0X55,0XC0,0X38,0XC0,0X9A,0X88,0X7E,0X6F,
+0XC1,0X6E,0XC0,0X7F,0XC0,0X6E,0XC0,0X31,0X38,0XC0,0X3D,0X7E,0X0C,0X11,0XC0,0X19,
+0X20,0XC2,0X25,0X34,0X39,0X08,0X0D,0XC0,0X1C,0X0D,0X08,0XC0,0X1C,0X21,0XC0,0X0D,
+0X39,0X08,0X8B,0X97,0X6F,0X7E,0X93,0X99,0X51,0XA3,0X88,0X04,0X3F,0X04,0X3F,0XC0,
+0X69,0X3F,0X04,0X3F,0X04,0X13,0X04,0X3F,0X38,0X9C,0X89,0XA5,0X98,0X22,0XA7,0XA8,
+0XA6,0X88,0XA4,0X89,0XA3,0X88,0X7F,0XA2,0X78,0X12,0XC1,0X26,0XC2,0X5A,0X65,0X99,
+0XA9,0X98,0X88,0X27,0XA2,0X99,0X1E,0X0D,0XA4,0X68,0XA2,0X88,0X9C,0X98,0X9D,0XA8,
+0X55,0X51,0X65,0X9C,0X88,0XA2,0X88,0XA8,0X79,0XA3,0X78,0X26,0X2B,0X6B,0X6E,0X32,
+0X37,0XC0,0X6E,0X37,0X32,0X26,0X66,0X65,0X06,0X56,0X2D,0X56,0X0A,0X9D,0X99,0X9C,
+0X78,0X9B,0X88,0X9B,0X88,0X96,0X7A,0X8E,0X78,0XC0,0X6F,0XC0,0X7F,0X14,0XC0,0XA2,
+0X88,0XA2,0X88,0X66,0X59,0XC0,0X28,0XA3,0X88,0X7B,0X3C,0X13,0XA2,0X78,0XA2,0X88,
+0X9C,0X88,0X24,0X65,0X04,0X10,0X61,0X10,0X69,0X61,0XA4,0X78,0XA5,0X99,0XA4,0X88,
+0XC0,0XAD,0X89,0XA9,0X88,0X66,0X88,0X88,0XA7,0X98,0X9D,0X89,0XAB,0X98,0XA9,0X79,
+0X61,0XA8,0X78,0X9D,0X99,0X35,0XA3,0X99,0X50,0X6B,0X35,0X09,0X92,0X88,0X9A,0X97,
+0XB0,0X89,0X10,0X24,0X5A,0X35,0XC0,0X30,0XC0,0X21,0XC1,0X0D,0XC1,0X66,0XC0,0X69,
+0X56,0XC0,0X66,0X55,0XC0,0X66,0XC0,0X11,0XC0,0X0C,0X69,0X56,0XC0,0X66,0X9B,0X98,
+0XC0,0X6F,0XC1,0X6E,0XC0,0X7F,0XC0,0X6E,0XC0,0X38,0XC0,0X3D,0XC0,0X0C,0XC0,0X11,
+0XC0,0X20,0XC0,0X25,0XC0,0X34,0XC0,0X39,0X01,0XC1,0X08,0X0D,0XC0,0X08,0X1C,0XC0,
+0X08,0X1C,0X21,0XC0,0X35,0X8A,0X97,0XA3,0X8A,0X9A,0X97,0X9A,0X88,0X28,0XA4,0X87,
+0X3F,0XC0,0X6E,0X07,0X3F,0X33,0X3F,0X55,0X04,0X07,0X6E,0X13,0X3F,0XC0,0X9D,0X98,
+0X41,0XB9,0XB8,0XA7,0XA8,0XA7,0X99,0XA5,0X88,0XA3,0X99,0XA2,0X78,0X7E,0X6E,0X12,
+0X7F,0X26,0XC1,0X2B,0X56,0X17,0X36,0X2A,0XA2,0X78,0XA1,0X9A,0XA3,0X88,0XA3,0X99,
+0XA5,0X78,0X03,0X12,0X3E,0X65,0X2A,0X1E,0X9D,0X98,0X9D,0X99,0XA7,0X78,0XA6,0X79,
+0X26,0XC0,0X2B,0X6B,0XC0,0X37,0XC0,0X32,0XC1,0X26,0X1A,0X12,0X06,0X56,0X61,0X19,
+0X05,0X9C,0X88,0X9C,0X78,0X9C,0X88,0X9A,0X78,0X95,0X79,0X90,0X79,0XA2,0X88,0XC1,
+0XA2,0X88,0X14,0XC0,0X28,0XA2,0X88,0X30,0X28,0X3C,0X9D,0X99,0X3C,0XA2,0X88,0XC0,
+0X3C,0X10,0X7E,0XA2,0X88,0XC0,0X56,0X18,0X3C,0X13,0X18,0X09,0X30,0X10,0XA4,0X98,
+0XA5,0X88,0X6E,0XAC,0X89,0XA2,0X88,0X20,0X94,0X98,0X9D,0X87,0X38,0X98,0X97,0XB1,
+0X89,0X34,0XA5,0X98,0XA3,0X89,0XC0,0X9D,0X88,0X7E,0XA3,0X89,0XC0,0X7E,0X9C,0X89,
+0X88,0X97,0XB5,0X79,0X7F,0X30,0X35,0XC0,0X30,0X35,0X30,0X29,0X21,0XC0,0X0D,0XC2,
+0X66,0XC0,0X55,0XC0,0X34,0X69,0X56,0X20,0XC0,0X55,0XC1,0X66,0X3D,0XC1,0X9A,0X98,
+0X5E,0X7B,0X6E,0XC1,0X7F,0XC0,0X6E,0XC0,0X7E,0X38,0XC0,0X3D,0XC0,0X0C,0XC0,0X11,
+0XC0,0X20,0X25,0XC1,0X34,0X39,0XC0,0X08,0XC0,0X0D,0X1C,0XC1,0X0D,0X21,0XC0,0X35,
+0X30,0X21,0X0D,0XA5,0X88,0X04,0X97,0X88,0XA8,0X99,0X93,0X87,0X98,0X99,0XA4,0X77,
+0X66,0X07,0XC0,0X6E,0X52,0X69,0X07,0X2B,0X09,0X0C,0XC0,0X3F,0X04,0X38,0X2B,0X9D,
+0X78,0XB1,0XB8,0XAC,0XA7,0XA7,0X99,0XA6,0X88,0X19,0XA3,0X99,0X6E,0XC0,0X12,0X1A,
+0X26,0XC4,0X36,0X31,0X36,0XA2,0X89,0XA3,0X98,0X12,0X03,0XC0,0X9C,0X98,0X3E,0X9D,
+0X99,0XA2,0X87,0X55,0X7A,0X9C,0X98,0X45,0XAB,0X79,0X17,0X7B,0X6E,0X6E,0X6B,0XC1,
+0X66,0X32,0X26,0X1A,0X17,0X62,0X65,0X56,0X61,0X19,0X36,0X0E,0X9B,0X89,0X9C,0X77,
+0X99,0X89,0X92,0X7A,0X96,0X78,0X14,0XC1,0XA2,0X88,0X14,0XC0,0X28,0XA2,0X88,0X28,
+0XC0,0X3C,0X55,0X28,0X04,0XC0,0X6B,0X6E,0XC1,0XA2,0X88,0X66,0X24,0X10,0X13,0X10,
+0X18,0XC0,0X04,0XA7,0X89,0XA3,0X98,0XA2,0X88,0XAA,0X78,0X7F,0XA3,0X89,0X2C,0X90,
+0X87,0XAD,0X89,0XC0,0XAA,0X88,0X7F,0XA5,0X88,0XA5,0X89,0X66,0X55,0X66,0X29,0X6F,
+0X7E,0X1D,0XFE,0X39,0XA7,0XBD,0X78,0X66,0X35,0XC2,0X30,0XC1,0X29,0X1C,0XC0,0X55,
+0X7E,0X0D,0XC0,0X08,0X59,0X66,0X34,0XC0,0X55,0XC0,0X20,0X69,0X56,0XC0,0X0C,0XC0,
+0X55,0XC0,0X9A,0X98,0X6E,0X6B,0XC0,0X6E,0XC0,0X7F,0XC0,0X6E,0XC0,0X7E,0X6B,0X3D,
+0XC0,0X7E,0X0C,0XC0,0X11,0X20,0X25,0XC1,0X7B,0X34,0X39,0X7E,0X08,0X0D,0XC0,0X7B,
+0X1C,0XC0,0X08,0X21,0X30,0XC0,0X35,0XC0,0X0D,0X30,0X94,0X97,0X93,0X89,0XA5,0X88,
+0X92,0X98,0X9D,0X89,0XA2,0X87,0X66,0XC1,0X7A,0X3F,0XA2,0X87,0X9D,0X89,0XC0,0X09,
+0X0C,0X18,0X04,0X65,0X66,0X56,0X9D,0X88,0XA8,0X98,0XB2,0XA7,0XA8,0X98,0XA5,0X99,
+0XA5,0X88,0X9D,0XA8,0X6F,0XA8,0X78,0X6F,0X12,0X26,0XC3,0X55,0X36,0XC0,0X55,0X36,
+0XA6,0X89,0X01,0XA3,0X89,0XA2,0X77,0X17,0X9D,0X98,0X9C,0X88,0XA4,0X98,0X5E,0X62,
+0X9D,0X98,0X9B,0X99,0XAB,0X69,0X17,0XC0,0X26,0XC0,0X2B,0X6B,0XC1,0X26,0XC0,0X61,
+0X5A,0X0D,0X55,0X61,0X51,0X05,0X9D,0X88,0X9D,0X98,0X9B,0X79,0X9A,0X88,0X9A,0X79,
+0X8D,0X7A,0X00,0XA3,0X98,0X14,0XC0,0XA2,0X88,0X55,0X14,0X28,0XA2,0X88,0XC0,0X28,
+0X04,0X52,0X19,0XA4,0X88,0X0B,0X30,0XA3,0X89,0X7E,0X3C,0X10,0X1F,0X6E,0X18,0X30,
+0X10,0XC0,0X04,0XC0,0XA4,0X88,0XA2,0X88,0XA3,0X89,0X31,0X6B,0XAA,0X88,0X9B,0X98,
+0X91,0X98,0X6E,0X31,0X1C,0X9C,0X87,0XA3,0X99,0XA2,0X88,0X1D,0XC0,0X51,0XC0,0X65,
+0XC0,0X6B,0X84,0X97,0X3D,0X98,0X89,0XA7,0X98,0X56,0X04,0X3D,0X35,0XC0,0X30,0X55,
+0XC1,0X51,0X7B,0X0D,0XC1,0X65,0X56,0XC0,0X34,0X2D,0X56,0XC0,0X66,0X69,0X11,0XC0,
+0X66,0X55,0XC0,0X06,0X7B,0XC0,0X6E,0XC1,0X7E,0X6B,0X29,0XC0,0X7F,0XC0,0X3D,0X7E,
+0XC0,0X0C,0X11,0XC0,0X19,0X20,0XC0,0X2F,0XC0,0X39,0XC0,0X01,0X6B,0X0D,0XC0,0X1C,
+0X21,0X7E,0X34,0X35,0X30,0X35,0XC1,0X0D,0X09,0X95,0XA8,0X95,0X89,0X9C,0X88,0X96,
+0X98,0X9B,0X88,0X3F,0X6E,0XC0,0X7F,0X04,0X13,0X69,0X41,0XC0,0X04,0X0C,0XC0,0X04,
+0X3F,0X33,0X56,0X51,0X51,0XB8,0X97,0XA8,0XA7,0XA5,0X99,0XA6,0X88,0XA2,0X88,0X7F,
+0XA5,0X78,0X7E,0X12,0X6F,0X6E,0X26,0X6E,0X26,0X55,0X36,0X9D,0X98,0X93,0X98,0X46,
+0XB4,0X98,0XA1,0X9A,0X69,0XA3,0X78,0X21,0X9D,0X88,0X93,0X89,0X8F,0X79,0XB3,0XA8,
+0XAD,0X98,0X9D,0X98,0X9D,0X99,0X23,0X26,0X59,0X26,0XC1,0X2B,0X26,0XC1,0X1E,0X75,
+0X56,0X06,0X52,0X65,0X51,0X05,0X9C,0X88,0X9C,0X77,0X9B,0X9A,0X9A,0X77,0X99,0X79,
+0X8D,0X7A,0X6E,0X7F,0X66,0X14,0XA2,0X88,0X55,0X28,0X66,0XA2,0X77,0XA3,0X99,0X30,
+0X3C,0X6E,0X9C,0X98,0X2D,0X04,0X18,0X30,0X18,0XC0,0X10,0XA2,0X88,0X18,0XC0,0X04,
+0X28,0X18,0X9D,0X99,0XC0,0XA2,0X88,0X2C,0XA5,0X89,0XA6,0X87,0XAD,0X89,0X66,0XA2,
+0X88,0X8F,0X99,0XA4,0X87,0XA5,0X88,0XB1,0X89,0X34,0XA7,0X98,0X34,0X09,0XC1,0X51,
+0XC0,0X29,0X09,0X20,0X09,0X9B,0X99,0X55,0X35,0X7F,0XC0,0X35,0XC0,0X66,0X29,0XC0,
+0X1C,0XC1,0X69,0X0D,0X66,0XC1,0X55,0X34,0X69,0X25,0XC0,0X66,0X19,0X56,0XC0,0X66,
+0X69,0X56,0X9B,0X98,0X6B,0XC0,0X6E,0XC0,0X7E,0X6B,0X6E,0XC0,0X7F,0XC1,0X3D,0XC0,
+0X0C,0X11,0XC0,0X14,0X20,0XC0,0X25,0XC0,0X34,0X39,0XC0,0X08,0XC0,0X0D,0X6B,0X1C,
+0X6E,0X1C,0X0D,0XA3,0X98,0X30,0X35,0XC0,0X04,0X9C,0X87,0XA5,0X89,0X9A,0X98,0X8E,
+0X88,0X51,0X2C,0X9B,0X88,0X3F,0X55,0X3F,0XA2,0X87,0X13,0X3F,0X6E,0X30,0X3F,0XC0,
+0XA3,0X98,0X13,0X0C,0X33,0X6E,0X51,0X56,0X00,0XB1,0XA8,0XAC,0XA7,0XA6,0X88,0XA6,
+0X98,0XA4,0X88,0XA2,0X88,0XA2,0X88,0XA2,0X78,0X06,0X17,0X6F,0XC0,0X69,0X17,0X66,
+0X99,0X98,0X93,0XA8,0XA3,0X88,0X96,0X89,0X6E,0XB0,0X88,0X32,0X9D,0X99,0X55,0X8F,
+0X9A,0X5A,0X99,0X88,0XA4,0X98,0XB2,0X87,0X7A,0XA9,0X69,0XA9,0X89,0X26,0XC6,0X1A,
+0X12,0XC0,0X66,0X51,0X69,0X56,0X9D,0X98,0X51,0X9C,0X88,0X9C,0X88,0X9A,0X88,0X9B,
+0X78,0X92,0X7A,0X00,0XA2,0X88,0XC2,0XA2,0X88,0X66,0X59,0X28,0X3C,0X6F,0X0B,0X3C,
+0X04,0X51,0X19,0XA2,0X99,0XA3,0X88,0XC0,0X28,0X0B,0X10,0X0B,0XA3,0X87,0X18,0XC0,
+0X3F,0XC0,0XA2,0X77,0X04,0X30,0XA7,0X89,0X3B,0XAB,0X88,0XA9,0X89,0XC0,0X34,0X93,
+0X98,0XA2,0X87,0XA2,0X99,0XB0,0X78,0X56,0X65,0X9B,0X88,0XA3,0X99,0XA9,0X89,0X9C,
+0X88,0X6E,0X51,0X04,0X24,0X8E,0X88,0XB1,0X89,0XC0,0XA2,0X88,0X35,0X7E,0X35,0X3D,
+0X35,0X30,0X21,0XC0,0X7E,0X1C,0XC1,0X55,0XC0,0X66,0XC0,0X55,0XC0,0X34,0X25,0XC0,
+0X20,0XC0,0X69,0X11,0X66,0X69,0XC0,0X9A,0X88,0X6B,0X6E,0XC0,0X7E,0X6B,0XC0,0X6E,
+0XC0,0X7E,0X6B,0X6E,0XC0,0X05,0X0C,0X11,0XC0,0X20,0X25,0XC1,0X34,0X39,0XC0,0X7E,
+0X08,0X0D,0XC0,0X7A,0X1C,0X21,0X0D,0X21,0X1C,0X35,0XC0,0X30,0X04,0X21,0XA3,0X88,
+0X76,0X85,0X98,0XA8,0X78,0X93,0X98,0X98,0X98,0XA3,0X89,0X3C,0XC0,0X13,0X7E,0X04,
+0X3F,0X04,0X3F,0X04,0X18,0X1B,0X04,0X65,0X7F,0X9C,0X78,0XC0,0X51,0X04,0XB3,0XB8,
+0XA6,0X97,0XA6,0X99,0XA5,0X88,0XA3,0X89,0XA2,0X98,0X32,0X6B,0XA2,0X87,0X17,0XC1,
+0X12,0X06,0X9D,0X89,0X97,0XA8,0X98,0X88,0XA2,0X87,0X01,0X55,0XA7,0X89,0X11,0X40,
+0X9B,0XA9,0X16,0XA2,0X99,0X6E,0X99,0X98,0XA6,0X79,0XAB,0X79,0X2B,0XC0,0X56,0X7A,
+0XC3,0X17,0X12,0XC0,0X66,0X06,0X52,0X65,0X51,0X51,0X31,0X9B,0X98,0X9C,0X78,0X9A,
+0X78,0X9C,0X78,0X24,0X9C,0X79,0X7F,0XA2,0X77,0X14,0X1C,0X6F,0X19,0X14,0X37,0XA2,
+0X87,0X28,0X0B,0X37,0X04,0X3C,0X28,0X1C,0X3C,0XA2,0X88,0XC0,0X3C,0XC0,0X04,0XC0,
+0XA3,0X88,0X18,0X10,0X3C,0XA2,0X87,0X04,0X3F,0X10,0XA8,0X88,0X65,0XAB,0X89,0XA2,
+0X88,0XA9,0X89,0X8F,0X98,0XA3,0X98,0XA7,0X89,0XA9,0X88,0XA5,0X89,0XA6,0X98,0X99,
+0X88,0X2C,0XB0,0X88,0XA3,0X89,0XC0,0X29,0X35,0X9B,0X99,0X90,0X98,0XB3,0X88,0XA3,
+0X89,0X30,0X9D,0X88,0X04,0X35,0X30,0X21,0X29,0X35,0X30,0X29,0X52,0X21,0X1C,0X0D,
+0XC0,0X08,0XC1,0X55,0XC0,0X66,0X25,0XC0,0X66,0XC0,0X55,0XC0,0X66,0X69,0X9A,0X88,
+0XC0,0X15,0XC1,0X7F,0X6E,0XC0,0X6E,0X7B,0XC0,0X6E,0XC0,0X0C,0X11,0XC0,0X6E,0X20,
+0X25,0XC0,0X7B,0X34,0X39,0XC0,0X08,0XC0,0X0D,0XC0,0X1C,0X21,0X1C,0X21,0XC0,0X1C,
+0X35,0X65,0XA2,0X88,0X04,0X29,0X35,0X04,0X89,0X98,0XA3,0X88,0X8E,0X98,0X51,0X3C,
+0XC1,0X1B,0X56,0X07,0X04,0X3F,0X07,0XC0,0X6E,0XA3,0X99,0X07,0XC0,0X55,0X66,0X41,
+0X56,0X00,0XB6,0XA7,0XA7,0XA8,0XA7,0X98,0XA4,0X99,0X36,0XA4,0X88,0X2D,0X6F,0X06,
+0X6B,0X6E,0XC0,0X0D,0X59,0X9D,0X98,0X0A,0X36,0X9C,0X87,0X9D,0X99,0X26,0X65,0X26,
+0X2E,0X36,0XA3,0X89,0X61,0X9D,0X98,0X2A,0X17,0XA3,0X88,0X66,0X5A,0X66,0X7A,0XC0,
+0X17,0X7B,0X17,0XC0,0X12,0X0D,0X06,0X56,0X2D,0X51,0X0A,0X36,0X9D,0X99,0X9C,0X88,
+0X9B,0X88,0X9A,0X78,0X99,0X89,0X00,0XC0,0X7E,0X14,0XC0,0XA2,0X88,0X55,0X7B,0X14,
+0XA3,0X98,0X04,0X30,0X3C,0X55,0X04,0X0B,0X37,0X19,0X2D,0X04,0X10,0X0B,0X04,0X0B,
+0X04,0X3C,0XA2,0X87,0X10,0XC0,0X04,0XA2,0X88,0X3C,0XC0,0XA7,0X98,0XA7,0X89,0X9B,
+0X98,0XAA,0X88,0XAE,0X79,0X94,0X97,0X99,0X89,0XAA,0X88,0XAB,0X88,0X6F,0XA7,0X98,
+0X6B,0X9A,0X88,0X94,0X87,0X25,0X9B,0X89,0XA4,0X88,0X15,0XA6,0X89,0X89,0X98,0XAE,
+0X88,0X18,0X55,0X9D,0X99,0XC0,0X29,0X30,0XA2,0X88,0X30,0X21,0X30,0X21,0XC1,0X66,
+0X66,0X59,0XC0,0X66,0XC0,0X55,0X34,0XC0,0X55,0XC0,0X20,0XC0,0X11,0XC0,0X66,0XC0,
+0X9A,0X87,0X6F,0XC1,0X7E,0X24,0X6E,0XC0,0X7F,0XC0,0X6E,0XC0,0X7E,0X0C,0X11,0XC0,
+0X20,0XC0,0X25,0XC0,0X34,0XC0,0X39,0XC0,0X08,0XC0,0X0D,0X7A,0X1C,0X21,0X1C,0X21,
+0X30,0X0D,0X30,0X35,0X7E,0X6F,0X21,0X09,0X35,0X8D,0X98,0X9D,0X99,0X91,0X98,0X51,
+0XC0,0X6F,0X7A,0X13,0XC0,0X3F,0X7E,0XC0,0X3F,0X04,0XC0,0X2F,0X3F,0X07,0X33,0X07,
+0X9B,0X89,0XA2,0X87,0X9C,0X79,0XAD,0X98,0XAE,0XA7,0XA6,0X98,0XA5,0X99,0XA4,0X98,
+0XA4,0X77,0X1E,0XA2,0X88,0X6F,0X06,0XC1,0X03,0XC0,0X65,0X2A,0X61,0X36,0X65,0XC2,
+0X5A,0XA6,0X88,0X6F,0X32,0X3E,0XA4,0X77,0X2B,0XC0,0X5A,0X66,0XC0,0X1C,0X66,0XC1,
+0X12,0XC0,0X66,0X06,0X3E,0X66,0X55,0X19,0X51,0X51,0X9D,0X88,0X9B,0X99,0X9B,0X88,
+0X9B,0X89,0X92,0X69,0X95,0X79,0XC0,0XA2,0X88,0XC0,0X6E,0X2D,0X14,0X19,0X7F,0X2D,
+0XA3,0X99,0X3C,0X6E,0X30,0X04,0X3C,0XC0,0X2D,0XC1,0X10,0XC0,0X66,0X10,0X7E,0X04,
+0XC0,0X10,0X13,0XC0,0X04,0X10,0X50,0XA2,0X88,0XA9,0X99,0XC0,0XAB,0X89,0XA5,0X88,
+0X18,0X97,0X98,0XA5,0X89,0XB2,0X88,0XA5,0X89,0X6E,0X7E,0X9D,0X89,0X08,0X99,0X98,
+0X18,0X1D,0X20,0XAF,0X88,0X3C,0XB8,0X78,0X18,0X09,0XC0,0X51,0X7F,0X35,0X29,0X52,
+0X55,0X35,0X51,0X29,0X21,0X1C,0XC0,0X0D,0XC0,0X08,0XC0,0X55,0XC0,0X34,0X69,0X56,
+0XC0,0X20,0XC0,0X11,0X0C,0XC0,0X9A,0X87,0X6B,0X7E,0XC0,0X6E,0X6F,0XC1,0X38,0XC0,
+0X6E,0X05,0XC0,0X0C,0X11,0XC0,0X20,0XC0,0X25,0XC0,0X34,0XC0,0X39,0X08,0XC0,0X0D,
+0XC0,0X7B,0X1C,0X21,0X6B,0X1C,0XA2,0X88,0X50,0XA2,0X88,0X35,0X04,0X6E,0X15,0XA4,
+0X88,0X30,0X97,0X98,0X8F,0X98,0X98,0X88,0X9D,0X88,0X7F,0X3F,0X55,0X3F,0X18,0X07,
+0XC1,0X55,0X07,0X3F,0XA6,0X87,0X04,0XC0,0X7E,0X33,0X38,0X9C,0X89,0X65,0X17,0XB6,
+0X97,0XA7,0XA7,0XA5,0X99,0XA5,0X99,0XA4,0X88,0X1E,0X7F,0X3E,0XC1,0X37,0XC0,0X3E,
+0XC0,0X32,0X55,0X51,0X7A,0X1E,0XC0,0X66,0X0F,0X3E,0XA2,0X88,0XC1,0X6E,0X6E,0X6B,
+0XC0,0X1C,0XC0,0X17,0X12,0XC2,0X06,0X3E,0XC0,0X66,0X32,0X52,0X51,0X36,0X51,0X02,
+0X9A,0X89,0X9B,0X78,0X9B,0X89,0X8D,0X7A,0X9C,0X78,0XC0,0XA2,0X88,0XC0,0X6E,0XA2,
+0X88,0X9C,0X99,0X14,0XA4,0X88,0X51,0XA4,0X88,0X3C,0X10,0X3C,0X66,0X30,0X04,0X2D,
+0X28,0XC1,0X10,0XC2,0X18,0XC0,0X10,0XC0,0X18,0XC0,0X66,0X35,0X30,0XAD,0X89,0X9A,
+0X87,0XAD,0X99,0XA5,0X89,0X55,0X99,0X99,0XA5,0X98,0X20,0XAD,0X88,0X09,0X1D,0X66,
+0X51,0X08,0X15,0X29,0X52,0XA9,0X88,0XFE,0X42,0X07,0XBF,0X89,0X09,0X04,0X51,0XC0,
+0X21,0XA3,0X88,0X66,0X04,0X65,0X21,0X29,0XC0,0X21,0XC0,0X1C,0XC0,0X55,0XC0,0X08,
+0X55,0XC0,0X66,0XC0,0X55,0XC0,0X20,0XC0,0X69,0X56,0X66,0X9A,0X88,0X6E,0XC1,0X7F,
+0X6E,0XC0,0X7E,0X6B,0X6E,0XC1,0X0C,0XC0,0X11,0XC0,0X20,0X25,0XC0,0X7B,0X34,0X39,
+0XC0,0X08,0XC1,0X0D,0X1C,0XC1,0XA2,0X77,0X1C,0XC0,0X30,0X1C,0X35,0XC0,0X7E,0X99,
+0X99,0XA6,0X88,0X1C,0X9C,0X87,0X85,0XA9,0X9D,0X88,0X56,0X50,0X7F,0XC0,0X04,0X27,
+0X04,0X30,0XA3,0X88,0X7A,0X3F,0X04,0XA4,0X98,0X13,0X04,0X07,0X33,0X13,0X9B,0X98,
+0X56,0X00,0XB3,0XA8,0XA9,0XA8,0XA6,0X97,0X02,0XA4,0X89,0X0A,0X1E,0X32,0X6E,0X32,
+0X5A,0XC0,0X76,0X32,0XC0,0X2F,0X66,0X1E,0X03,0X3E,0X32,0X55,0X3E,0XA2,0X88,0XC2,
+0X6E,0X6E,0XC0,0X17,0XC0,0X12,0X66,0X12,0X0D,0X06,0XC0,0X3E,0X66,0X32,0X1E,0XC0,
+0X05,0X36,0X9D,0X98,0X9C,0X89,0X9B,0X88,0X9B,0X78,0X97,0X8A,0X90,0X68,0X00,0X7E,
+0X14,0XC0,0X28,0XC0,0X14,0X7E,0XA4,0X88,0X14,0XA6,0X88,0X04,0X10,0XC0,0X1C,0X3C,
+0X55,0X3C,0X2D,0X28,0XC0,0X3C,0X10,0XC0,0X04,0XC0,0XA2,0X88,0X6F,0X13,0XC0,0X51,
+0X18,0XC0,0X3F,0X04,0XA5,0X99,0XA8,0X78,0X34,0X8C,0X97,0XA6,0X78,0XA4,0X98,0XA9,
+0X89,0XAF,0X78,0X7B,0X1D,0XA2,0X88,0X65,0X3D,0X9B,0X89,0X99,0X98,0X1D,0X65,0X88,
+0X98,0X1D,0X3D,0X52,0X6E,0X11,0X56,0X3D,0XC0,0X67,0X35,0X30,0X55,0X30,0X69,0X21,
+0X66,0XC0,0X65,0X0D,0X66,0XC0,0X69,0X56,0X34,0XC0,0X55,0XC0,0X20,0X55,0XC1,0X99,
+0X99,0X15,0XC0,0X7E,0X6B,0X6E,0XC0,0X7F,0XC0,0X6E,0XC0,0X7F,0XC1,0X11,0X20,0XC0,
+0X25,0XC0,0X7B,0X34,0X39,0XC0,0X08,0X0D,0XC1,0X1C,0X21,0XC2,0X30,0XC0,0X0D,0X35,
+0XC0,0X30,0X35,0X9D,0X98,0XA5,0X99,0X98,0X88,0X85,0X98,0X18,0X9D,0X89,0X65,0X2B,
+0X59,0XA4,0X88,0X27,0X04,0X66,0X30,0X04,0XC0,0X07,0X13,0X7E,0X04,0X7E,0X04,0XC0,
+0X07,0X9D,0X88,0X9D,0X89,0X07,0XB3,0XA7,0XA5,0XA9,0X2E,0X16,0XA3,0X89,0XA3,0X98,
+0X1E,0X2A,0XC0,0X55,0X66,0X1E,0XC0,0X2A,0X6E,0XA2,0X78,0X03,0XA4,0X78,0X37,0X1E,
+0X23,0XA5,0X79,0X7F,0XC0,0X69,0X17,0X66,0X17,0X14,0X65,0X03,0X66,0XC2,0X06,0XC0,
+0X3E,0X61,0X1E,0X66,0X0A,0X65,0X22,0X02,0X9C,0X89,0X9B,0X88,0X99,0X79,0X95,0X79,
+0X95,0X89,0X5A,0X08,0X6F,0XC0,0XA2,0X88,0X66,0X14,0XA3,0X88,0X30,0X14,0X3C,0X04,
+0X6F,0XC0,0X3C,0X66,0X28,0X3C,0X2D,0X28,0XC0,0X3C,0XC0,0X04,0XC0,0X10,0X04,0X18,
+0X27,0X18,0X6F,0X10,0X24,0X10,0X18,0XA5,0X89,0X65,0XB8,0X78,0X8D,0X99,0XA5,0X88,
+0X76,0XAA,0X78,0XB1,0X89,0X51,0XC0,0X2C,0X9C,0X88,0XC0,0X65,0X95,0X88,0XAF,0X89,
+0X25,0X96,0X98,0X1D,0X9A,0X88,0XA4,0X88,0XC0,0X7E,0X09,0XC0,0X66,0X51,0X35,0XC0,
+0X30,0XC0,0X69,0X21,0XC0,0X66,0XC0,0X0D,0XC0,0X66,0XC0,0X55,0XC0,0X66,0X25,0XC0,
+0X20,0XC0,0X55,0XC0,0X99,0X99,0X6E,0XC0,0X7F,0XC0,0X6E,0X6E,0X7B,0XC0,0X3D,0XC0,
+0X7F,0XC0,0X11,0XC0,0X7E,0X20,0X25,0XC0,0X34,0XC0,0X39,0X7B,0X08,0X0D,0XC1,0X1C,
+0XC0,0X21,0X30,0X21,0X30,0X35,0XC0,0X21,0X35,0XA3,0X98,0X08,0X30,0XC0,0X9D,0X98,
+0X88,0X88,0X97,0X98,0X51,0XC0,0X51,0XC0,0X04,0XA2,0X98,0X9D,0X89,0X13,0X30,0X04,
+0X3F,0X13,0X3F,0XA4,0X87,0X3F,0XA2,0X87,0X04,0X3F,0X07,0X30,0X61,0X9D,0X79,0XB6,
+0XA6,0XA7,0XA9,0XA6,0X88,0XA5,0X97,0XA3,0X9A,0X0A,0X7E,0X6F,0X59,0X9D,0X9A,0XC0,
+0X36,0X0A,0XA3,0X88,0X9C,0XB9,0X98,0XC9,0X9B,0XA9,0XA8,0X68,0XA6,0X57,0X06,0XA2,
+0X79,0X9C,0XB9,0X9C,0XA8,0XA2,0X68,0X6E,0X17,0XC0,0X51,0X66,0X2F,0X66,0X65,0X2A,
+0X7F,0X3E,0XC1,0X65,0X2A,0X1E,0X55,0X62,0X36,0X9D,0X98,0X9C,0X89,0X9B,0X88,0X9B,
+0X89,0X97,0X78,0X20,0X97,0X89,0XC1,0X6F,0X6E,0X1C,0X14,0XC0,0XA6,0X88,0X19,0X1C,
+0X3C,0X04,0X3F,0XA3,0X89,0X10,0X3C,0X30,0X28,0X3C,0X28,0X1C,0X28,0X3C,0X04,0X10,
+0X04,0XA2,0X88,0X55,0X04,0X27,0X18,0X10,0X18,0X27,0X13,0XA2,0X78,0XA4,0X98,0XAD,
+0X88,0X6B,0X99,0X87,0X9A,0X89,0XB3,0X99,0XAB,0X78,0X3A,0XA3,0XA9,0X56,0XA2,0X77,
+0X9D,0X99,0X93,0X99,0XAC,0X88,0X9A,0X88,0X38,0XA8,0X87,0X09,0XC0,0X11,0X18,0X09,
+0XC0,0X04,0X69,0X04,0X35,0X66,0XC1,0X21,0XC1,0X66,0X69,0X0D,0XC0,0X08,0XC0,0X55,
+0XC0,0X34,0X25,0XC1,0X66,0X69,0X56,0X9A,0X88,0XC0,0X7E,0X6B,0X29,0XC1,0X38,0XC0,
+0X6E,0XC0,0X0C,0X11,0XC1,0X20,0X25,0XC1,0X6B,0X34,0X39,0XC0,0X08,0XC0,0X0D,0X08,
+0X7F,0X21,0X7B,0X30,0X21,0X30,0X35,0X04,0X0D,0X09,0X35,0X21,0XA3,0X98,0X30,0X9D,
+0X98,0X84,0X88,0X99,0X98,0XC0,0X55,0XC1,0XA4,0X98,0X6F,0X3F,0X0C,0X56,0XC0,0X0C,
+0X3F,0X0C,0X6B,0X0C,0X04,0X0C,0X9C,0X89,0X30,0X13,0X9B,0X98,0X56,0XA5,0X98,0X0E,
+0XA6,0X88,0XA5,0X98,0XA4,0X87,0XA2,0X88,0XA2,0X89,0X6E,0X55,0X9D,0XA9,0X9D,0X89,
+0XC0,0X9D,0XB9,0X96,0XEA,0X9A,0XB8,0X66,0X7E,0X7A,0XA2,0X89,0XAB,0X48,0XC0,0X9C,
+0X98,0X9D,0X98,0X51,0X6E,0XA5,0X79,0XAB,0X47,0X32,0X5A,0X9D,0X99,0X36,0XC0,0XA2,
+0X88,0XA3,0X89,0XA2,0X88,0XC0,0X32,0XC0,0X23,0X62,0X0A,0X61,0X41,0X9D,0X98,0X9C,
+0X88,0X9B,0X79,0X98,0X78,0X9A,0X88,0X99,0X89,0X9A,0X79,0X41,0X7B,0XA2,0X77,0X66,
+0X7F,0X19,0X3C,0X6E,0X14,0XA5,0X89,0X3C,0XA2,0X88,0X65,0X10,0XA3,0X99,0X28,0X3C,
+0X28,0X30,0X6B,0X30,0XC0,0X28,0X3C,0X04,0XC0,0X3C,0X13,0XC0,0X6E,0XC0,0X7F,0X10,
+0XC0,0X04,0XA3,0X89,0X04,0XA5,0X88,0XA9,0X99,0XA2,0X88,0X9B,0X88,0XAF,0X99,0XB1,
+0X79,0XC0,0X9D,0X99,0X9D,0X88,0X7F,0X35,0X9B,0XA9,0X5A,0X20,0X8F,0X98,0XBE,0X78,
+0X35,0X18,0X04,0X09,0XC3,0X65,0X35,0XC2,0X51,0X7F,0X21,0XC0,0X66,0X69,0X0D,0X08,
+0XC0,0X69,0X56,0X66,0XC0,0X55,0XC0,0X20,0X69,0X11,0X9A,0X88,0XC0,0X7F,0XC0,0X6E,
+0XC0,0X7E,0X6B,0XC0,0X6E,0XC0,0X7F,0XC0,0X11,0X19,0X20,0X25,0XC0,0X34,0XC0,0X39,
+0XC0,0X08,0XC0,0X0D,0X7B,0X1C,0XC1,0X21,0X30,0X66,0X35,0XC0,0X30,0X35,0X30,0X69,
+0X35,0X04,0X09,0X96,0X98,0X8C,0X88,0X94,0X87,0X7F,0X21,0XC0,0X66,0X13,0X6E,0X9D,
+0X99,0X6E,0X6E,0X13,0X04,0XC0,0X18,0X04,0X18,0X61,0X6E,0X51,0X51,0X6B,0X38,0X1C,
+0X9D,0X89,0XB5,0XB7,0XA9,0X98,0X1A,0XA5,0X88,0XA3,0X99,0XA2,0X88,0XC0,0X55,0X9D,
+0X89,0X98,0X98,0X98,0XBA,0X98,0XD9,0X56,0X7A,0X61,0XA0,0XA8,0X62,0XA1,0XA8,0XA8,
+0X68,0X61,0X97,0X78,0XA8,0X58,0XA2,0X78,0X9D,0X99,0X65,0X7A,0XA6,0X67,0XA9,0X58,
+0XA5,0X77,0X96,0X69,0XA5,0X87,0XAD,0X88,0XA3,0X9A,0XA2,0X78,0X7E,0XC0,0X2A,0X1E,
+0X16,0X0A,0X9D,0X99,0X9D,0X88,0X9D,0X98,0X06,0X99,0X79,0X96,0X78,0X66,0X9B,0X79,
+0X30,0X9B,0X89,0X14,0XC1,0XA2,0X88,0X14,0XA7,0X88,0X28,0X14,0XA6,0X88,0X3C,0XC1,
+0X10,0XA3,0X99,0X3C,0X7F,0X30,0XC4,0X28,0XA3,0X98,0XC4,0XA2,0X88,0X66,0X18,0X13,
+0X04,0X66,0XAF,0X88,0X18,0XAD,0X89,0X9B,0X88,0X51,0XB3,0X99,0X35,0X1D,0X51,0XA3,
+0X99,0X9C,0X88,0X35,0X9C,0X98,0XA4,0X88,0X9A,0X88,0X91,0X98,0XB8,0X79,0X35,0X04,
+0X69,0X09,0X04,0X35,0XC0,0X66,0X3D,0X35,0XC1,0X30,0XC1,0X55,0XC0,0X66,0X69,0X56,
+0XC0,0X08,0XC0,0X55,0X34,0XC0,0X69,0X56,0XC0,0X66,0X69,0X99,0X89,0XC0,0X7F,0X6E,
+0XC0,0X7E,0X6B,0XC0,0X6E,0XC0,0X7B,0X6E,0X6E,0XC0,0X20,0XC0,0X25,0X6E,0X34,0X39,
+0XC0,0X01,0X08,0X0D,0XC0,0X6B,0X1C,0X21,0X1C,0XA2,0X87,0XC0,0X30,0X29,0X35,0XC0,
+0X6E,0X0D,0X04,0X30,0X35,0XA6,0X88,0X8A,0X98,0X90,0X88,0X98,0X87,0X2B,0X21,0X66,
+0X2B,0X13,0X7E,0X3F,0X6E,0X51,0XA4,0X88,0X61,0X13,0XC1,0X1B,0X07,0X04,0X3F,0X2B,
+0X69,0XA2,0X88,0X9D,0X99,0X1C,0XA2,0X98,0XB6,0XA7,0XA5,0X98,0XA6,0X88,0XA4,0X87,
+0X2F,0X7F,0X51,0X1B,0X97,0XAA,0X87,0X79,0X9C,0X99,0X4A,0XA3,0X88,0XAC,0X87,0XA4,
+0X89,0XA6,0X98,0XA1,0XB8,0X98,0XD9,0XA2,0X58,0XB1,0X48,0XA9,0X58,0X76,0X88,0X98,
+0X9B,0X98,0X97,0X99,0X9A,0XA9,0X7A,0XA1,0XA9,0XA8,0X77,0XB4,0X66,0XAB,0X78,0X1E,
+0X6F,0X6E,0XC0,0X65,0X1E,0X51,0X36,0X9D,0X99,0X9C,0X88,0X9C,0X88,0X9B,0X88,0X98,
+0X68,0X9C,0X88,0X51,0X41,0X9C,0X89,0X98,0X79,0XA3,0X99,0X51,0XA2,0X77,0XC0,0X28,
+0XA6,0X88,0X98,0X88,0XA3,0X88,0XA2,0X98,0X56,0XC1,0XA2,0X88,0X24,0X10,0X04,0X3C,
+0X66,0X3C,0X30,0XC1,0X3C,0X30,0X04,0XC3,0X10,0X69,0X04,0XC0,0XA2,0X88,0X04,0XA5,
+0X89,0X18,0XA9,0X88,0XA6,0X8A,0X93,0X97,0XA6,0X88,0XFE,0XC6,0X59,0X9B,0X99,0XA6,
+0X88,0X9C,0X88,0X9D,0X88,0X7E,0X9C,0X88,0XA3,0X99,0X95,0X88,0X7B,0X04,0XA4,0X88,
+0X18,0X6E,0XC0,0X51,0XC0,0X7E,0X09,0X04,0X35,0X66,0X55,0XC1,0X30,0X21,0XC0,0X66,
+0XC0,0X55,0XC0,0X66,0X01,0X39,0XC0,0X34,0X69,0X25,0XC0,0X20,0XC0,0X99,0X88,0XC0,
+0X7F,0XC0,0X6E,0X7E,0X6B,0XC0,0X6E,0XC0,0X7F,0XC0,0X6E,0XC0,0X20,0XC0,0X25,0X7A,
+0X34,0X39,0XC0,0X08,0XC0,0X0D,0X7E,0X1C,0XC0,0X21,0XC1,0X30,0XC0,0X21,0XC0,0X30,
+0XC0,0X21,0X04,0X30,0X04,0X1C,0X95,0X98,0X8C,0X88,0X99,0X98,0X6E,0X1C,0X55,0XA5,
+0X99,0XC0,0XA2,0X88,0X3F,0X04,0X51,0X07,0X13,0XC0,0X7E,0X13,0X04,0X07,0X3F,0XC0,
+0X51,0XC0,0X1C,0X30,0X1C,0X9D,0X99,0XB1,0X97,0XAC,0XA8,0XA6,0X87,0XA5,0X98,0XA3,
+0X99,0X6E,0XC1,0X0A,0X97,0XB9,0X8E,0XBA,0X9D,0X88,0X66,0X41,0X55,0XA4,0X58,0XA6,
+0X67,0XA4,0X78,0X9B,0X98,0XA9,0XA9,0XA2,0X98,0X66,0XFE,0X99,0X87,0XA2,0X99,0XA3,
+0X98,0X55,0XA4,0X98,0XA3,0X88,0XB5,0X07,0XA4,0X57,0X66,0X7E,0X6E,0X6B,0XC0,0X1E,
+0X0A,0X51,0X51,0X02,0X9C,0X88,0X9B,0X89,0X99,0X78,0X99,0X89,0X7E,0X52,0X9D,0X89,
+0X55,0X95,0X8A,0XA3,0X88,0X14,0X19,0X14,0XA5,0X98,0X0B,0X14,0X0B,0X04,0X56,0XC2,
+0XA2,0X88,0XA2,0X88,0X30,0X10,0X9D,0X99,0X3C,0X30,0X3C,0X30,0XC0,0X04,0X30,0X04,
+0XC3,0X6E,0X04,0XC0,0X1C,0X30,0XA4,0X88,0X10,0X24,0XAE,0X88,0X97,0X98,0X6E,0X30,
+0X2D,0XA4,0X89,0XA5,0X98,0X01,0XA3,0X99,0X35,0X9A,0X98,0X90,0X88,0X1D,0X9D,0X99,
+0XA2,0X87,0X1D,0X66,0X55,0X18,0XC0,0X11,0X09,0XC0,0X04,0XC0,0X51,0X35,0X30,0X51,
+0XC0,0X6E,0X1C,0XC0,0X69,0X56,0XC0,0X66,0X39,0XC0,0X34,0XC0,0X25,0XC0,0X66,0XC0,
+0X99,0X88,0X7F,0XC1,0X29,0X2C,0X38,0XC0,0X3D,0X05,0X6B,0X6E,0XC0,0X7E,0X20,0X25,
+0XC0,0X34,0XC1,0X39,0X08,0X0D,0XC0,0X08,0X1C,0XC0,0X21,0X30,0XC0,0X21,0X30,0X21,
+0X0D,0X21,0XC0,0X30,0X1C,0XC0,0X69,0X3D,0X9B,0X98,0X91,0X98,0X98,0X88,0X6F,0X62,
+0X69,0XA4,0X88,0X65,0XA2,0X89,0X3F,0X04,0X51,0X04,0XC1,0XA2,0X88,0X7E,0X33,0XA4,
+0X88,0X38,0X3F,0X33,0X55,0X1C,0X7A,0X2B,0X9D,0X98,0X6F,0XB6,0XA7,0XA7,0X98,0XA6,
+0X87,0XA4,0X88,0XA3,0X98,0X6B,0XC1,0X7E,0X92,0XDA,0X97,0XBA,0XA2,0XB8,0X7A,0X24,
+0X9C,0X99,0X9C,0X67,0X52,0XA1,0XA8,0XA3,0X98,0XA2,0X99,0X7F,0XA8,0X67,0X51,0X71,
+0X5E,0XA2,0X58,0XAE,0X16,0XA8,0X57,0X66,0X1E,0X2A,0X69,0X1E,0XC0,0X0A,0X55,0X61,
+0X9D,0X88,0X9C,0X88,0X9C,0X88,0X9A,0X79,0X96,0X78,0XA3,0X98,0X56,0X18,0X51,0X66,
+0X94,0X69,0X1C,0X08,0X1C,0X56,0XA8,0X88,0X9A,0X88,0X1C,0X10,0X65,0X56,0X6E,0X28,
+0X04,0XC0,0XA2,0X88,0X28,0X18,0X04,0XC0,0X3C,0X30,0X04,0X3C,0XC2,0X04,0X18,0X04,
+0XC0,0X55,0X04,0XC0,0X3C,0X21,0X04,0XA6,0X88,0X04,0XAC,0X99,0X9E,0X67,0X7A,0XB9,
+0X89,0X93,0X88,0XA2,0X88,0XAC,0X89,0X90,0X88,0XAC,0X88,0XA3,0X88,0X94,0X98,0XC0,
+0XB2,0X78,0X9C,0X88,0XA5,0X99,0X1D,0X66,0XC0,0X55,0X18,0X69,0X09,0XC0,0X66,0X35,
+0X7E,0X35,0X30,0XC0,0X69,0X52,0XC1,0X15,0X0D,0XC0,0X08,0X55,0XC0,0X66,0XC0,0X69,
+0X56,0X66,0XC0,0X99,0X98,0X6F,0XC0,0X6E,0XC0,0X31,0X6F,0XC1,0X05,0X0C,0X6E,0XC0,
+0X20,0XC0,0X25,0XC0,0X7B,0X39,0XC0,0X08,0X39,0X08,0XC2,0X39,0X7E,0X0D,0XC3,0X08,
+0X25,0X1C,0X21,0X9A,0X98,0X1C,0X08,0X30,0X8C,0X97,0X91,0X88,0X9B,0X99,0XC2,0XA4,
+0X88,0X51,0XA3,0X99,0X04,0X30,0X3C,0X7A,0X3C,0XA1,0XA8,0X13,0X7E,0X5A,0X13,0X33,
+0X04,0X30,0X65,0XC0,0X17,0X7E,0X6F,0X9C,0X78,0XAB,0XA7,0X0E,0XA6,0X97,0XA6,0X78,
+0XA4,0X88,0X7E,0X3B,0XC1,0X02,0X96,0XDB,0X99,0XDA,0XA2,0XB7,0XA3,0X89,0XA3,0X88,
+0X45,0XA4,0X78,0X9B,0XC9,0XA7,0X49,0X61,0X61,0X60,0X9D,0X99,0X5A,0X4E,0XAE,0X16,
+0XA7,0X68,0X7B,0X6E,0XC0,0X69,0X1E,0X55,0X66,0X2F,0X27,0X9D,0X98,0X9C,0X88,0X9C,
+0X88,0X9B,0X8A,0X97,0X88,0XC0,0X6F,0X69,0X41,0X66,0X51,0X24,0X9D,0X89,0X5A,0XA2,
+0X88,0X66,0XA6,0X88,0X19,0X7F,0XA6,0X88,0X3C,0XC1,0X28,0X3C,0XC0,0XA3,0X98,0X52,
+0X3C,0X10,0X3C,0X7E,0X3C,0X30,0X7F,0XC1,0X04,0XC1,0X10,0X18,0X3C,0X28,0X10,0X30,
+0XC0,0X1C,0XAC,0X88,0X10,0X18,0XAB,0X89,0X94,0X97,0X21,0XA7,0X99,0X90,0X88,0X9B,
+0X98,0X6F,0XB3,0X98,0X96,0X89,0X8C,0X97,0XBC,0X79,0X55,0X51,0XA4,0X88,0XC1,0X69,
+0X18,0X55,0X18,0X09,0X65,0X04,0XC0,0X35,0XC1,0X30,0XC0,0X69,0X52,0X0D,0X15,0X0D,
+0XC0,0X66,0X01,0X39,0XC0,0X66,0X55,0XC1,0X66,0X99,0X98,0X6B,0X24,0X6E,0X6E,0X31,
+0X6B,0X6E,0XC0,0X0C,0XC0,0X6E,0XC0,0X20,0X25,0XC1,0X34,0X39,0X6E,0X08,0XC2,0X0D,
+0XC0,0X21,0XC1,0X7E,0XC1,0X0D,0X04,0X35,0X1C,0XC0,0X34,0X99,0X98,0X30,0X34,0X8C,
+0X97,0X96,0X88,0X9D,0X88,0X66,0XC0,0X2B,0XA2,0X77,0X7A,0X04,0XC0,0X35,0X04,0X3F,
+0X10,0X33,0XA3,0X89,0XA2,0X87,0X9D,0X99,0X04,0X13,0X2B,0X33,0X2B,0X65,0XC0,0X17,
+0XC0,0X1C,0X00,0XB4,0XB7,0XAA,0X97,0XA6,0X88,0XA5,0X88,0XA2,0X98,0XA2,0X78,0XC0,
+0X66,0X22,0X98,0X88,0X9A,0XEA,0X99,0XEA,0XA3,0XA8,0XA4,0X78,0XA3,0X69,0X6E,0X71,
+0XA5,0X69,0X9D,0XB8,0X9A,0XA8,0X9D,0X89,0X4E,0XA4,0X46,0XAC,0X37,0XA6,0X78,0X1E,
+0X6F,0X6E,0XC0,0X2A,0X1B,0X65,0X3B,0X9D,0X99,0X50,0X9D,0X99,0X9B,0X88,0X9C,0X89,
+0X97,0X79,0X9D,0X98,0XA3,0X99,0X6E,0XC0,0X3B,0X55,0X9D,0X99,0X38,0X00,0X7E,0X05,
+0XA3,0X99,0X7F,0X51,0XA4,0X88,0XA2,0X87,0X10,0X37,0X04,0X28,0X7E,0X04,0XC0,0XA4,
+0X88,0X30,0X10,0X04,0X3C,0XA2,0X87,0X3C,0X30,0X3C,0X3F,0X04,0XC1,0X3C,0XC0,0X10,
+0X3C,0X04,0X10,0X9C,0X87,0X28,0X1C,0X04,0X10,0XA6,0X88,0X30,0XBD,0X88,0XAD,0X89,
+0X52,0X25,0X95,0XA9,0XAF,0X88,0X8C,0X88,0XAE,0X88,0XAE,0X78,0XC0,0X9C,0X88,0X1D,
+0X51,0XC0,0X04,0X69,0X52,0XC0,0X04,0XC1,0X35,0XC0,0X30,0X55,0XC0,0X66,0X55,0X15,
+0X21,0X1C,0X0D,0XC0,0X66,0X01,0X39,0X66,0XC0,0X25,0XC0,0X66,0XC0,0X9A,0X77,0X24,
+0X6E,0XC0,0X31,0X6B,0X6E,0XC1,0X7F,0XC0,0X6E,0X14,0X20,0XC0,0X25,0X2D,0X34,0X39,
+0XC1,0X01,0X0D,0XC0,0X1C,0X21,0XC0,0X7E,0X30,0XC0,0X35,0X30,0X35,0X21,0XC0,0X09,
+0X9C,0X98,0X99,0X88,0X0C,0X31,0X91,0X99,0X9D,0X98,0X96,0X88,0X6E,0X1C,0X21,0X7F,
+0X33,0XC0,0X6F,0X30,0XC0,0X3C,0X30,0XC0,0X6E,0X7F,0XA3,0X98,0X30,0X18,0X61,0X1F,
+0X30,0X2B,0X30,0X1C,0X65,0X1C,0X61,0X17,0X2B,0XB8,0XA6,0XA5,0X98,0X3A,0X27,0XA2,
+0X88,0X7E,0X3B,0X27,0X9D,0X99,0X12,0X9A,0XCA,0X9A,0XE9,0XA2,0X98,0XA3,0X98,0XA2,
+0X79,0X65,0X66,0X51,0X9F,0X67,0XA3,0X58,0XA7,0X47,0XA7,0X78,0X3B,0XA3,0X89,0X2A,
+0XC1,0X69,0XC0,0X65,0X03,0X51,0X9C,0X88,0X2E,0X06,0X16,0X3E,0X9C,0X78,0XA4,0X88,
+0XA1,0XA8,0XA2,0X78,0X69,0X56,0X51,0X51,0X9A,0X79,0X95,0X7A,0X7E,0XC0,0XA4,0X88,
+0X56,0X3C,0XA2,0X88,0X3C,0X04,0X28,0XA3,0X88,0X28,0XC0,0XA3,0X99,0X3C,0XA3,0X98,
+0X10,0X0B,0XC0,0X30,0X04,0XC0,0X30,0X3F,0XC0,0X04,0X30,0X04,0XC0,0X3C,0XC0,0X04,
+0X30,0X18,0X04,0X30,0X28,0X1C,0XA5,0X88,0XAB,0X99,0X1C,0XB3,0X88,0XAB,0X89,0XAE,
+0X89,0X2D,0XC0,0X96,0X99,0X97,0X88,0XBC,0X88,0XC0,0XA3,0X89,0X9A,0X88,0XA2,0X88,
+0X6E,0X18,0XC0,0X69,0X1D,0X18,0X11,0X09,0XC1,0X04,0X55,0XC0,0X30,0XC0,0X29,0X56,
+0XC0,0X66,0X66,0X59,0XC0,0X66,0X69,0X39,0X66,0XC0,0X25,0XC0,0X66,0X99,0X88,0X7F,
+0X6E,0XC0,0X38,0XC1,0X3D,0X7A,0X6F,0X6E,0XC0,0X20,0XC0,0X25,0XC0,0X34,0X39,0X34,
+0X39,0X08,0X0D,0XC0,0X7E,0X1C,0XC0,0X21,0X7E,0X30,0XC0,0X21,0X35,0XC1,0X04,0X21,
+0X29,0X00,0XA6,0X88,0XC0,0X91,0X88,0X9C,0X98,0X90,0X88,0XC0,0X6E,0XC0,0X2B,0XA2,
+0X87,0X2B,0X3F,0X59,0X1C,0XA3,0X89,0XC0,0X28,0X21,0X35,0XA4,0X99,0X38,0X2B,0XA4,
+0X87,0X3F,0X1F,0X6E,0X1F,0XC0,0X1C,0X66,0X69,0X17,0X41,0XAD,0XA8,0XB1,0XA7,0XA6,
+0X87,0XA5,0X99,0XA3,0X99,0X0A,0XC0,0X55,0X51,0X50,0X9C,0X88,0X52,0X9D,0XB9,0XC2,
+0X6E,0X6E,0XA2,0X78,0XA3,0X99,0X27,0XA3,0X98,0X0F,0X1E,0X23,0X1E,0XC0,0X23,0X1E,
+0X0F,0X61,0X9D,0X88,0X9C,0X88,0X9C,0X88,0X9A,0X88,0X98,0X79,0X9B,0X89,0XA4,0X98,
+0XA3,0X88,0X7E,0XC1,0X66,0X55,0X9D,0X89,0X9C,0X78,0X94,0X69,0X66,0X6B,0X28,0XC0,
+0X3C,0XA2,0X88,0X65,0X28,0X37,0X51,0X28,0X51,0X04,0X3C,0XC0,0XA5,0X98,0X3C,0X10,
+0XC0,0X9D,0X98,0X04,0X2B,0X3F,0X04,0X6E,0X35,0X3C,0X04,0XC0,0X3C,0X30,0XC0,0X04,
+0X3C,0X28,0XC0,0X30,0X51,0XA9,0X89,0X69,0XA9,0X89,0XA4,0X88,0X7B,0X15,0X34,0X89,
+0X98,0X05,0XA9,0X99,0X5A,0X18,0XA2,0X88,0X9D,0X88,0X2C,0X1D,0XC1,0X18,0XC1,0X69,
+0X09,0XC0,0X66,0X55,0XC0,0X66,0XC1,0X21,0XC0,0X66,0X66,0X59,0XC0,0X66,0X01,0X39,
+0XC0,0X34,0X25,0XC0,0X20,0X9A,0X87,0X6B,0X6E,0XC0,0X7F,0XC1,0X3D,0X7F,0XC0,0X6E,
+0XC0,0X20,0X25,0XC0,0X2D,0X34,0X25,0X39,0X08,0XC1,0X0D,0XC0,0X15,0X1C,0XC2,0X21,
+0X30,0XC1,0X35,0XC1,0X9C,0X98,0X20,0X0D,0X95,0XA8,0X9D,0X89,0X91,0X98,0X98,0X88,
+0X6E,0X1C,0XA2,0X88,0XC1,0X2B,0X30,0X6E,0X21,0X28,0XA3,0X98,0X1C,0XC0,0XA3,0X98,
+0XA3,0X99,0X2B,0X1C,0XA3,0X99,0X38,0X2B,0X1C,0X7A,0X6E,0X1C,0X55,0X7A,0X00,0X1C,
+0X00,0XB5,0XA7,0XAB,0XB8,0X3A,0X22,0X3B,0XA2,0X89,0XC0,0X0A,0X3B,0X27,0X51,0X02,
+0X33,0X2E,0XC0,0XA2,0X78,0X07,0XA2,0X88,0X36,0X16,0XA3,0X88,0X2A,0XC0,0X2F,0X65,
+0XC0,0X1E,0X5A,0X60,0X9D,0X99,0X9C,0X77,0X9A,0X99,0X9B,0X89,0X98,0X88,0X9A,0X78,
+0XA5,0X99,0XA3,0X88,0X7E,0XA2,0X87,0X66,0X2C,0X27,0X45,0X3E,0X9C,0X78,0X9B,0X79,
+0X00,0X14,0X1C,0XC0,0XA5,0X88,0X3C,0X30,0XC0,0X28,0X14,0X1C,0X14,0X04,0X3C,0X30,
+0XA3,0X89,0XC0,0X66,0XA2,0X87,0X3C,0XC0,0X30,0X7E,0X6B,0X04,0X3C,0X37,0X04,0X3C,
+0XC0,0X30,0XC0,0X1C,0X3C,0X04,0X14,0X1C,0X28,0X2B,0X30,0XA6,0X88,0XB2,0X79,0X50,
+0X97,0X99,0X7E,0XAF,0X89,0XAC,0X78,0X95,0X99,0XAB,0X98,0X56,0XA2,0X88,0X6D,0XA1,
+0X9A,0X55,0XC1,0X18,0XC0,0X69,0XC0,0X09,0XC0,0X04,0X66,0X59,0XC0,0X66,0X69,0X56,
+0XC0,0X66,0XC0,0X55,0XC0,0X08,0XC0,0X39,0XC0,0X66,0X2D,0X25,0X20,0X24,0XC0,0X6E,
+0XC0,0X7F,0XC0,0X3D,0X05,0X6B,0XC0,0X6E,0X19,0X20,0XC0,0X25,0XC1,0X39,0XC0,0X01,
+0X08,0X0D,0XC0,0X1C,0XC0,0X21,0XC0,0X7E,0X30,0X35,0XC4,0X1C,0X21,0X9C,0X98,0X51,
+0X92,0X88,0XA8,0X88,0X87,0X98,0X56,0X69,0X30,0X2B,0X21,0X30,0XC0,0X2B,0X30,0X51,
+0X30,0X28,0XC0,0X51,0X2B,0XA5,0X98,0X21,0X1C,0X65,0XA5,0X89,0X61,0X55,0X9D,0X99,
+0X21,0X1C,0XC1,0X9D,0X99,0X6E,0XC0,0X03,0XBA,0XA7,0X12,0XA5,0X89,0X36,0XA3,0X88,
+0X23,0X6B,0X66,0X1E,0X0F,0X0A,0XC1,0X56,0X0A,0X0F,0X23,0X2A,0XA2,0X88,0X6E,0XC0,
+0X3E,0X65,0X23,0X1E,0X65,0X0F,0X9D,0X98,0X9C,0X88,0X99,0X99,0X9A,0X78,0X97,0X99,
+0X9B,0X79,0XA5,0X98,0X1F,0XA2,0X87,0X7F,0XC0,0X6E,0X3B,0X56,0X55,0X9D,0X99,0X41,
+0X13,0X2B,0X9D,0X78,0X14,0X21,0X30,0X2B,0X30,0X14,0X1C,0XC1,0X14,0X30,0X28,0X04,
+0X37,0XA5,0X88,0X9C,0X88,0XA2,0X88,0X7E,0X9D,0X88,0X04,0X30,0X04,0XC0,0X35,0X30,
+0X04,0X3C,0X04,0X30,0XC0,0X28,0X1C,0X30,0X1C,0XC1,0X04,0X2B,0X30,0XB4,0X89,0X6E,
+0X97,0X98,0X18,0XFE,0XB5,0X96,0X5A,0X09,0X39,0XA8,0X98,0X09,0X7E,0XA2,0X89,0X1D,
+0XC1,0X66,0XC2,0X09,0XC0,0X66,0XC0,0X35,0XC0,0X66,0XC0,0X55,0XC1,0X66,0X0D,0XC0,
+0X66,0XC0,0X39,0XC0,0X66,0X55,0XC1,0X99,0X99,0XC0,0X6E,0X7E,0X6B,0XC0,0X3D,0X7E,
+0X6B,0X6E,0XC1,0X20,0X25,0XC1,0X34,0X39,0XC0,0X08,0XC0,0X0D,0XC0,0X6F,0X1C,0X21,
+0XC1,0X30,0X35,0XC1,0X04,0XC0,0X30,0X21,0XC0,0X2D,0X98,0X99,0XA3,0X88,0X94,0X88,
+0X91,0X98,0X6E,0X51,0X30,0XC0,0X51,0X2B,0X35,0X1C,0X2B,0X5A,0XC0,0X1C,0X14,0XC0,
+0X1C,0X1B,0X2B,0X9D,0X88,0X7A,0XA3,0X88,0XA2,0X89,0X24,0X66,0X59,0X56,0X08,0XC1,
+0X66,0X5A,0XC0,0X1C,0XBA,0XB7,0X26,0XA6,0X88,0X0A,0X1E,0XA2,0X88,0X6B,0X3E,0XC0,
+0X6E,0X3E,0X03,0X3E,0X03,0XC0,0X6F,0X7E,0X0F,0X17,0X66,0X3E,0X32,0X23,0X1E,0X0A,
+0X50,0X9B,0X99,0X06,0X99,0X89,0X96,0X78,0X9D,0X88,0XA5,0X99,0XA5,0X98,0X33,0XA3,
+0X98,0XC3,0X07,0X61,0X1F,0X41,0X97,0X89,0X42,0X96,0X89,0X1C,0X28,0X1C,0X28,0X9D,
+0X98,0X14,0X1C,0X14,0XC1,0XA3,0X98,0X28,0X30,0X3C,0XA3,0X98,0X10,0X3C,0X18,0X51,
+0XC1,0X3F,0X35,0XC0,0X30,0X04,0X30,0X04,0XC0,0X30,0X28,0X21,0X28,0X1C,0X28,0X1C,
+0X04,0X10,0X30,0XA8,0X88,0XAA,0X89,0X95,0X88,0XAF,0X89,0X96,0X88,0XAF,0X98,0XB1,
+0X89,0X1D,0X94,0X98,0XA8,0X78,0X2C,0XC0,0X1D,0XC2,0X66,0XC0,0X69,0X09,0XC0,0X66,
+0XC0,0X69,0X35,0XC0,0X66,0X69,0X56,0XC0,0X66,0X69,0X56,0XC0,0X66,0X55,0XC0,0X34,
+0X2D,0X25,0XC0,0X99,0X99,0X6E,0XC0,0X7F,0XC0,0X6E,0XC1,0X0C,0X6E,0XC0,0X7F,0XC2,
+0X34,0XC0,0X39,0XC0,0X08,0XC0,0X0D,0XC0,0X1C,0XC0,0X21,0XC0,0X30,0XC1,0X35,0X30,
+0XC0,0X1C,0X15,0XA3,0X99,0X35,0X01,0X8D,0X98,0XAE,0X89,0X89,0X98,0X9A,0X88,0XC1,
+0X55,0X30,0X51,0X30,0XC0,0X56,0X30,0X28,0XC1,0X1C,0X21,0XA2,0X88,0XA2,0X98,0X9C,
+0X88,0X9D,0X89,0X6E,0XC0,0XA3,0XA9,0XC0,0X51,0X24,0X1F,0X0D,0X1C,0X03,0XC0,0X5A,
+0XC1,0XA7,0XA8,0XBA,0XA6,0XA6,0X89,0XA5,0X98,0XA4,0X87,0XA2,0X79,0XA2,0X88,0X7A,
+0X03,0X6F,0X7E,0X5A,0XC1,0X7E,0X6B,0X6E,0X23,0X12,0X03,0X65,0X51,0X1E,0X50,0X9D,
+0X99,0X9C,0X88,0X9A,0X88,0X98,0X78,0X95,0X89,0X51,0XA6,0X88,0XA5,0X98,0X3B,0XA2,
+0X88,0XA2,0X88,0X6E,0X23,0X69,0X56,0XC0,0X65,0X9D,0X9A,0X9A,0X78,0X5A,0X9A,0X79,
+0X99,0X89,0X9C,0X89,0X6E,0XC0,0X56,0XC1,0X65,0X0D,0X14,0XC0,0X1C,0X30,0X52,0XA3,
+0X88,0X7F,0XA3,0X88,0X9D,0X98,0X6E,0X6B,0X35,0X10,0X3C,0X35,0X3F,0X30,0X04,0X30,
+0X3C,0X24,0X04,0X1C,0X30,0X21,0X1C,0X30,0X1C,0X30,0XA4,0X88,0XA6,0X88,0X10,0XA6,
+0X88,0XC0,0X2D,0X31,0XC0,0XA4,0X88,0XA9,0X89,0XA2,0X88,0X94,0X98,0XB2,0X78,0X9B,
+0X99,0XA2,0X87,0X1D,0XC0,0X18,0XC2,0X69,0X09,0XC0,0X66,0X69,0X35,0X66,0XC0,0X69,
+0X56,0XC0,0X66,0XC0,0X55,0XC0,0X66,0X69,0X39,0X66,0X66,0X59,0XC0,0X99,0X99,0X6E,
+0XC0,0X31,0X6B,0X6E,0XC0,0X7F,0XC0,0X6E,0XC0,0X20,0X25,0X20,0X7E,0X2F,0X34,0X39,
+0XC0,0X08,0X0D,0XC1,0X1C,0XC2,0X21,0XC0,0X7E,0X30,0X35,0XC0,0X30,0X1C,0X9D,0X99,
+0X14,0X9A,0X88,0X99,0X99,0X9C,0X77,0X2C,0X9B,0X88,0X66,0XC0,0X55,0X30,0X66,0X55,
+0X30,0X21,0X6B,0XC1,0X30,0X1C,0X51,0XA3,0X98,0XA2,0X88,0X1C,0X08,0X6E,0X08,0X2B,
+0X24,0X2B,0X65,0X24,0X21,0X08,0XC0,0X66,0X00,0XC2,0XAA,0X97,0XB9,0XB7,0XA6,0X98,
+0X0A,0X1E,0X3E,0X6E,0X7B,0X12,0X6E,0XC0,0X6F,0XC0,0X17,0X23,0X17,0XC0,0X03,0X32,
+0X66,0X50,0X41,0X22,0X9C,0X87,0X9A,0X98,0X97,0X79,0X94,0X79,0XA2,0X88,0XA4,0X87,
+0X1A,0XA4,0X87,0XA4,0X88,0X6E,0X7E,0X6F,0X30,0X66,0XC0,0X55,0X23,0X9D,0X98,0X41,
+0X1F,0X94,0X69,0X38,0X9D,0X89,0X08,0X6F,0X08,0X14,0X08,0X00,0X08,0X14,0XC0,0X1C,
+0X6F,0XC1,0XA3,0X98,0XA3,0X89,0X10,0X04,0X10,0X35,0X7B,0XC0,0X55,0X6F,0X61,0X3C,
+0X30,0XA3,0X88,0X10,0XA4,0X88,0X28,0X21,0X1C,0X30,0X1C,0X14,0X30,0XA5,0X88,0X10,
+0XAE,0X88,0X24,0XA8,0X88,0X19,0X98,0X88,0XAA,0X88,0X6B,0XA4,0X88,0XA4,0X88,0X92,
+0X88,0XB3,0X88,0X51,0X7F,0X69,0X1D,0XC1,0X66,0XC0,0X69,0X56,0XC0,0X04,0X55,0XC1,
+0X66,0XC0,0X55,0XC1,0X15,0X56,0XC0,0X66,0X39,0XC0,0X34,0XC0,0X55,0XC0,0X99,0X99,
+0X6E,0XC0,0X38,0XC0,0X3D,0XC0,0X7B,0X0C,0X6E,0XC0,0X7F,0X25,0X20,0X2D,0X2F,0X34,
+0X39,0X01,0X08,0XC0,0X0D,0XC1,0X15,0X1C,0X21,0XC2,0X30,0XC0,0X1C,0X21,0X61,0XC0,
+0X9A,0X88,0X9A,0X78,0XAA,0X98,0X91,0X98,0X92,0X88,0X2B,0XA2,0X77,0X51,0X2B,0XC1,
+0X21,0X2B,0X6E,0X28,0X21,0X28,0X51,0X65,0X6E,0XA2,0X98,0X56,0XC0,0X08,0XC0,0X0D,
+0XC0,0X30,0X1C,0X24,0X66,0X1C,0X66,0X14,0X66,0X00,0XC3,0XAA,0X97,0XB9,0XC7,0X16,
+0XA4,0X89,0X1E,0X32,0X3E,0XA2,0X88,0X6E,0XC0,0X6E,0X17,0X12,0XC0,0X55,0X3E,0X61,
+0X65,0X0A,0X50,0X9C,0X88,0X9C,0X88,0X23,0X94,0X79,0X96,0X79,0XA5,0X97,0X1B,0XA5,
+0X98,0XA4,0X88,0XA4,0X98,0XA2,0X87,0X3A,0X6E,0XC1,0X55,0XC0,0X2B,0X51,0X56,0X9B,
+0X89,0X13,0X99,0X79,0X51,0X9D,0X89,0XC0,0X00,0X08,0X14,0X08,0X00,0X08,0X1C,0X14,
+0X1C,0X28,0X7E,0X1C,0X30,0X18,0X6F,0X51,0XC0,0X35,0X30,0XA2,0X88,0X35,0X04,0X30,
+0XC0,0X6F,0X04,0XA7,0X89,0X24,0X56,0X9A,0X97,0X28,0X1C,0X28,0X1C,0X3C,0X04,0X0C,
+0XA8,0X88,0X24,0XAE,0X88,0XA5,0X88,0XA4,0X88,0XA7,0X99,0X6F,0X9D,0X98,0XA6,0X88,
+0XC0,0X19,0X31,0X2C,0X55,0XC2,0X66,0X69,0X09,0XC1,0X66,0X69,0X56,0XC1,0X66,0X55,
+0XC1,0X1C,0X55,0XC1,0X01,0X5A,0X34,0XC0,0X25,0XC0,0X99,0X99,0X29,0X7E,0XC0,0X6B,
+0X6E,0X05,0X6B,0X6E,0XC1,0X7F,0XC0,0X25,0XC0,0X34,0X39,0XC0,0X01,0X6B,0X0D,0XC0,
+0X7E,0X1C,0X21,0XC0,0X6E,0X30,0XC0,0X35,0XC0,0X21,0X0D,0X30,0X1C,0X0D,0X0C,0X05,
+0X97,0X98,0X97,0X99,0X51,0X97,0X88,0X7F,0XC0,0X66,0X21,0XC2,0X28,0XC1,0X65,0X51,
+0XC1,0XA3,0X98,0X08,0X6F,0X69,0X62,0X1C,0X0D,0X21,0X24,0X1C,0XC1,0X5A,0X08,0X6B,
+0X55,0XC4,0X24,0XBD,0XB8,0X16,0XA3,0X89,0XA3,0X99,0XA3,0X78,0X7F,0XA2,0X78,0X7E,
+0X12,0X55,0X62,0X2F,0X2D,0X19,0X65,0X2A,0X16,0X9C,0X98,0X9B,0X89,0X98,0X78,0X92,
+0X78,0X42,0XA4,0X88,0XA3,0XA8,0XA5,0X88,0X33,0XA4,0X87,0XA2,0X98,0X3F,0X6E,0X7F,
+0XC0,0X0E,0X65,0X3A,0X2B,0XC0,0X98,0X89,0X9A,0X78,0X46,0X99,0X89,0X9B,0X8A,0X21,
+0XA1,0XA9,0X08,0XC2,0X00,0XA2,0X87,0X1C,0XC2,0X28,0XC1,0XA3,0X98,0XA3,0X89,0X65,
+0X04,0X6F,0X2B,0XA2,0X88,0X30,0X6F,0XC0,0X30,0X04,0X30,0XAD,0X88,0X9C,0X89,0XA2,
+0X88,0X92,0X88,0X21,0X1C,0X14,0XC0,0X04,0X10,0XAB,0X98,0X9C,0X89,0XAB,0X78,0X9A,
+0X98,0XA5,0X89,0XA5,0X88,0XAD,0X99,0X9C,0X88,0XA5,0X98,0X25,0X38,0X08,0X15,0XA9,
+0X89,0X65,0X1D,0XC0,0X66,0XC1,0X69,0X09,0XC0,0X66,0XC0,0X35,0XC1,0X30,0X55,0XC1,
+0X66,0X59,0X66,0X08,0X69,0X56,0XC0,0X34,0X55,0XC0,0X99,0X99,0X29,0XC0,0X7F,0X3D,
+0XC0,0X05,0X6B,0X6E,0XC1,0X7F,0XC0,0X25,0X7B,0X34,0X39,0XC0,0X08,0XC0,0X0D,0XC0,
+0X15,0XC0,0X1C,0X21,0X26,0X30,0X35,0X21,0XC1,0X35,0XC0,0X9C,0X98,0X38,0XA6,0X87,
+0X97,0X99,0X99,0X88,0X99,0XA9,0X99,0X88,0X51,0XC0,0X2B,0X30,0X55,0X66,0X21,0X30,
+0X28,0XC1,0X9D,0X98,0XC1,0X66,0X30,0X03,0X08,0X1C,0X14,0X1C,0X66,0X1C,0X30,0X1C,
+0XC0,0X08,0X6B,0X14,0X08,0X00,0XC3,0X6E,0X00,0XC0,0XB8,0XB6,0XAD,0XA9,0XA5,0X98,
+0XA4,0X78,0XA3,0X89,0X6E,0X32,0X2A,0X9D,0XA8,0X56,0X69,0X51,0X51,0X9C,0X99,0X9C,
+0X88,0X9D,0X87,0X2E,0X95,0X79,0X9A,0X78,0XA3,0X98,0X3F,0XA2,0X98,0XA5,0X88,0XA4,
+0X97,0XA4,0X88,0XA4,0X88,0XA2,0X87,0X6B,0XA2,0X87,0X6B,0X18,0X13,0X65,0X02,0X07,
+0X41,0X96,0X8A,0X03,0X9D,0X88,0X98,0X7A,0X9A,0X78,0XA2,0X87,0XA7,0XA9,0X56,0X95,
+0X79,0XC0,0X08,0X14,0X00,0XA2,0X87,0X1C,0X21,0X1C,0X28,0X1C,0XA2,0X88,0X66,0XA4,
+0X78,0X7E,0X10,0X65,0X52,0X6E,0X7A,0X30,0X3C,0XC0,0X04,0X3F,0XAB,0X78,0XA3,0X99,
+0X99,0X88,0X1C,0XC0,0X28,0X1C,0XC0,0X04,0X30,0XAD,0X89,0X9C,0X88,0XB1,0X88,0X94,
+0X99,0XAD,0X88,0X6F,0X31,0XA6,0X89,0XA8,0X88,0X97,0X98,0XAC,0X88,0X56,0X01,0X2C,
+0XC0,0X1D,0XC2,0X18,0X69,0X09,0XC0,0X04,0XC0,0X55,0XC1,0X66,0X69,0X56,0XC0,0X66,
+0X55,0XC0,0X66,0XC0,0X01,0X39,0X34,0XC0,0X55,0X9A,0X88,0XC0,0X31,0X6B,0XC0,0X6E,
+0XC0,0X0C,0X6E,0XC0,0X7F,0XC1,0X25,0X34,0XC0,0X39,0XC0,0X01,0X08,0X0D,0XC0,0X1C,
+0XC0,0X21,0XC0,0X1C,0XC1,0X30,0X35,0X1C,0X35,0X04,0X99,0X98,0X9C,0X88,0X31,0X61,
+0X41,0X8F,0X98,0X9B,0X99,0X6E,0X30,0X61,0X3F,0X40,0X66,0X30,0X56,0XC0,0X30,0X9D,
+0X89,0X51,0XA2,0X87,0XC0,0X00,0X35,0X9A,0X99,0X6E,0X21,0X30,0X1C,0XC1,0X0D,0X21,
+0X14,0XC0,0X66,0X14,0XC0,0X00,0X0F,0X00,0XC5,0X1B,0XB3,0XB7,0XA8,0X98,0XA5,0X98,
+0X2A,0X66,0XC0,0X9D,0X89,0X29,0X51,0X9D,0X99,0X9D,0X88,0X9D,0X88,0X99,0X89,0X98,
+0X79,0X9B,0X78,0XA3,0X99,0XA3,0X98,0X7F,0XA4,0X87,0XA4,0X87,0X27,0XA5,0X89,0XA3,
+0XA8,0X0B,0X13,0X7F,0X6E,0XC0,0X22,0X66,0X69,0X13,0XA4,0X87,0X91,0X8A,0X5A,0XA2,
+0X88,0X90,0X7A,0XA3,0X98,0X17,0XAB,0X97,0XAC,0X97,0X97,0X89,0X6B,0X08,0X00,0X0D,
+0X14,0X08,0X1C,0XC0,0X28,0XC0,0X1C,0X28,0X7E,0X10,0X7F,0X10,0XC0,0X65,0X28,0XA2,
+0X88,0X7A,0X3C,0X04,0X3C,0XC0,0XAA,0X88,0XA7,0X88,0X9B,0X99,0X17,0X28,0X14,0X28,
+0X0D,0X1C,0X30,0XA8,0X88,0XAC,0X89,0X6E,0X9A,0X88,0XAE,0X88,0X6F,0XA6,0X88,0X9B,
+0X98,0X94,0X78,0XB0,0X98,0XA3,0X89,0XA2,0X88,0X9D,0X98,0XA7,0X89,0X55,0XC0,0X66,
+0X1D,0X51,0X18,0XC0,0X69,0X09,0X04,0XC1,0X55,0XC0,0X30,0X69,0X56,0XC0,0X1C,0X66,
+0X59,0XC0,0X66,0X01,0X39,0X66,0X69,0XC0,0X99,0X89,0XC0,0X31,0X6B,0X3D,0XC0,0X7E,
+0X0C,0X6E,0XC0,0X20,0XC1,0X6E,0X34,0XC0,0X39,0XC0,0X08,0X0D,0XC1,0X08,0XC0,0X0D,
+0XC0,0X21,0X30,0X35,0XC0,0X30,0XC0,0X21,0X35,0X34,0X7E,0X94,0X88,0X9D,0X88,0X9A,
+0X98,0X94,0X88,0XC1,0X66,0X69,0X33,0X45,0XC0,0X30,0X56,0XA2,0X87,0X9D,0X99,0X51,
+0X6F,0XC0,0X08,0XC0,0X24,0X08,0X30,0X35,0X30,0X21,0XC0,0X1C,0XC0,0X55,0X14,0XC3,
+0X51,0X14,0X00,0XC6,0X14,0X0F,0XA9,0X98,0X1A,0X2E,0X66,0X41,0X51,0X9D,0X88,0X41,
+0X9C,0X88,0X9C,0X89,0X55,0X3B,0XA3,0X88,0XA2,0X98,0XA2,0X88,0X1B,0XA3,0X98,0XA4,
+0X88,0XA5,0X98,0XA4,0X88,0X13,0X22,0X6E,0X7F,0X6E,0X36,0XC0,0X65,0X59,0X7F,0X98,
+0X89,0X9B,0X78,0X37,0X93,0X89,0X46,0XA4,0X98,0X8B,0X7A,0XAC,0X87,0XB4,0XA7,0X1F,
+0X9D,0X89,0X9C,0X78,0X08,0X00,0X08,0XA2,0X88,0X56,0X28,0X14,0X35,0X28,0X1C,0X30,
+0XC0,0XA4,0X88,0X56,0X65,0X30,0X7F,0XC0,0X04,0X3F,0X5A,0X3F,0X30,0XAB,0X88,0XAB,
+0X8A,0X98,0X87,0X92,0X88,0X1C,0XC0,0X28,0X1C,0X28,0X1C,0XAC,0X88,0X10,0X39,0XA9,
+0X99,0X51,0XB2,0X78,0XA5,0X99,0X93,0X98,0X2C,0X9C,0X87,0X96,0X88,0X28,0X34,0XA7,
+0X98,0X09,0X7F,0XA2,0X87,0X09,0X7E,0X1D,0X11,0XC0,0X09,0XC0,0X66,0X59,0X35,0XC0,
+0X66,0XC0,0X55,0XC0,0X66,0XC0,0X55,0XC0,0X66,0X55,0XC1,0X34,0X69,0X99,0X89,0XC0,
+0X7F,0X6E,0XC1,0X05,0X6F,0XC0,0X19,0XC0,0X6B,0XC0,0X6E,0X34,0X39,0XC0,0X01,0X39,
+0X08,0XC0,0X0D,0X1C,0XC0,0X21,0XC0,0X7E,0X30,0X35,0XC0,0X9D,0X98,0X21,0X35,0XC0,
+0X0C,0X19,0X93,0X99,0XC0,0X97,0X98,0X97,0X99,0X5A,0X7E,0X2B,0X24,0X30,0X51,0X3F,
+0X30,0XC0,0X28,0X50,0X6B,0X1C,0X14,0X51,0X1C,0X24,0XA2,0X78,0X30,0X35,0X7F,0X1C,
+0XC1,0X0D,0X14,0XC0,0X6E,0X62,0X14,0X55,0XC0,0X0F,0X00,0XC6,0X1C,0XA3,0X98,0X41,
+0X24,0XC0,0X6E,0XC2,0X76,0X38,0X7A,0X7F,0XA2,0X87,0X23,0XA3,0X98,0X1B,0X37,0X1F,
+0XA5,0X98,0XA3,0X98,0X13,0XA2,0X88,0XA2,0X88,0XC0,0X6F,0X3B,0XC2,0X7E,0X27,0X02,
+0X95,0X79,0XAC,0X87,0X97,0X89,0X1F,0XC0,0X41,0X8D,0X7A,0XAD,0X98,0XAB,0XA8,0XA6,
+0X97,0X9B,0X89,0X97,0X79,0X0D,0X00,0X14,0X28,0X21,0X1C,0X28,0X35,0X1C,0X28,0X30,
+0XC0,0XA4,0X88,0X3C,0X7E,0X3C,0XC1,0X7A,0X04,0X9D,0X99,0X3F,0XA6,0X77,0XB5,0X89,
+0X8D,0X99,0X14,0X04,0X14,0X1C,0X30,0X1C,0X14,0XBD,0X88,0X94,0X89,0XA5,0X97,0XA3,
+0X8A,0X2D,0XAD,0X89,0X92,0X98,0X09,0X31,0XC0,0X66,0X99,0X88,0X9C,0X99,0XA3,0X88,
+0X2C,0X09,0X65,0X6B,0X09,0XC0,0X7F,0X69,0X09,0XC0,0X04,0X55,0XC1,0X66,0XC0,0X21,
+0XC0,0X1C,0XC0,0X55,0XC0,0X66,0X01,0X39,0XC0,0X34,0XC0,0X99,0X88,0X6E,0X7B,0X6E,
+0XC1,0X7F,0X6E,0XC0,0X7E,0X20,0XC1,0X2D,0X34,0XC1,0X39,0X08,0X0D,0XC0,0X7A,0X0D,
+0X1C,0X21,0XC3,0X30,0XC1,0X09,0X10,0X0C,0X97,0X98,0X55,0X9D,0X99,0X92,0X97,0X56,
+0X2B,0X30,0X55,0XA4,0X88,0X9B,0X99,0XA4,0X88,0XC0,0X3F,0X41,0X1C,0X21,0X28,0X1C,
+0X14,0XC0,0X30,0X3F,0X30,0X3F,0X04,0X30,0X9D,0X99,0X28,0X14,0XC2,0X6E,0X14,0XC0,
+0X51,0X7F,0XC0,0X00,0XC6,0X17,0XA6,0X87,0X33,0X38,0X7A,0XC4,0X6E,0X7F,0X7F,0XA2,
+0X87,0XA2,0X88,0X1B,0XA3,0X88,0X13,0XA4,0X88,0XA4,0X87,0XA3,0X99,0X22,0X36,0X6E,
+0X7F,0X6F,0X0A,0XC0,0X5A,0X7E,0XC0,0X0E,0X9D,0X88,0X9C,0X78,0XA7,0X98,0X99,0X9A,
+0X2B,0X9A,0X79,0XC0,0X96,0X79,0X97,0X89,0X6F,0XA6,0X87,0XAC,0X97,0XA5,0X99,0X97,
+0X89,0X8E,0X69,0X14,0X1C,0X28,0X1C,0X28,0XC0,0X7E,0X28,0X21,0X30,0XA3,0X89,0XC0,
+0X30,0X6F,0XC0,0X28,0XA2,0X98,0X3C,0X30,0XC0,0XA7,0X89,0XAF,0X89,0X93,0X97,0X19,
+0XA6,0X98,0X14,0X1C,0X3C,0X28,0X1C,0XBE,0X79,0X92,0X97,0XA2,0X78,0XA8,0X89,0XB2,
+0X88,0X95,0X98,0XAE,0X89,0X31,0X18,0X31,0X1D,0X99,0X99,0X2C,0X1C,0X35,0XA5,0X98,
+0X1D,0X25,0X18,0X35,0X7F,0X6E,0XC1,0X04,0X65,0X35,0XC0,0X66,0XC0,0X55,0XC0,0X1C,
+0XC0,0X55,0XC0,0X66,0XC0,0X39,0XC0,0X66,0X2D,0X29,0XC0,0X7F,0XC0,0X3D,0X7E,0X0C,
+0XC0,0X11,0XC0,0X7E,0X20,0XC0,0X34,0XC1,0X39,0X01,0X08,0X0D,0XC1,0X1C,0X65,0X0D,
+0X15,0X1C,0X30,0XC0,0X35,0X1C,0X7E,0X35,0X91,0X98,0X34,0X3C,0XA9,0X78,0X8F,0XA9,
+0X9B,0X88,0X62,0X6E,0X65,0X35,0X30,0X3F,0XA2,0X77,0X35,0X9D,0X99,0XC0,0X30,0XC0,
+0X55,0X17,0X21,0XA2,0X98,0XC0,0X6F,0XA2,0X88,0X04,0X56,0X2B,0X17,0X14,0X6E,0X62,
+0X14,0XC0,0X1C,0X14,0XC0,0X65,0X14,0X51,0XC7,0X08,0XA9,0X98,0X38,0X04,0X79,0XC3,
+0X07,0X7E,0X23,0X7E,0XA2,0X88,0X13,0XA2,0X98,0XA4,0X87,0XA3,0X98,0XA4,0X88,0XA3,
+0X98,0XA3,0X99,0X22,0X36,0XA2,0X88,0X6E,0X7F,0X5A,0XC0,0X69,0X1E,0X9B,0X89,0X50,
+0XA4,0X88,0X0B,0XA9,0X97,0XA2,0X99,0X59,0X9D,0X99,0X56,0X33,0XC0,0X94,0X69,0X96,
+0X89,0X5A,0X3C,0XAC,0X97,0X99,0X8A,0X08,0XA3,0X89,0X1C,0XA2,0X88,0X1C,0X30,0X9D,
+0X89,0X30,0XC0,0X28,0X30,0X18,0X9D,0X89,0XC0,0X30,0XC1,0X7F,0X30,0X1C,0X18,0XAD,
+0X89,0X35,0X14,0X30,0X51,0X14,0X28,0X1C,0X18,0XB6,0X79,0X92,0X97,0X5A,0XFE,0XC6,
+0X39,0X93,0X98,0XAE,0X88,0X2C,0X31,0X9D,0X98,0X2C,0X31,0X99,0X99,0XA2,0X88,0XA3,
+0X88,0X30,0XA3,0X88,0XC0,0X04,0X09,0XC0,0X51,0X7E,0X04,0X09,0X04,0X65,0X35,0XC1,
+0X30,0X55,0XC0,0X66,0XC0,0X0D,0XC0,0X66,0XC0,0X39,0XC0,0X66,0XC0,0X29,0X7E,0X6B,
+0X6E,0X05,0XC0,0X0C,0X6E,0XC0,0X7E,0X6B,0XC1,0X34,0XC0,0X39,0XC4,0X08,0XC0,0X0D,
+0X21,0XC0,0X7E,0X30,0X35,0X30,0X21,0X35,0X21,0X38,0X60,0X41,0X96,0X98,0X94,0X98,
+0X5A,0X33,0X30,0X1F,0X30,0XA2,0X88,0XC1,0X9C,0X88,0XA3,0X88,0XA2,0X88,0X30,0X7B,
+0X3F,0X09,0X3F,0X69,0X3F,0XC0,0X04,0X35,0X30,0X3F,0X9B,0X88,0X14,0XC0,0X08,0X14,
+0X08,0XA2,0X89,0X08,0X14,0X55,0X14,0X05,0X66,0XC7,0XAB,0XA7,0X9D,0X89,0X07,0X7E,
+0X6E,0XC1,0X0F,0X14,0X7F,0X7E,0XA2,0X88,0XA2,0X87,0X7F,0X3E,0XA4,0X87,0XA3,0X98,
+0X17,0XA3,0X88,0X02,0XA2,0X89,0XA2,0X87,0X0A,0X6E,0XC1,0X62,0XA2,0X89,0X7F,0X97,
+0XB9,0X9F,0X68,0XA4,0X56,0XA5,0X8A,0X9C,0X88,0X9D,0X89,0X97,0XA7,0X0C,0XA7,0X8A,
+0XA9,0X89,0XC0,0XA8,0X87,0X9B,0X89,0X9C,0X89,0X91,0X88,0X96,0X88,0XA7,0X97,0XA2,
+0X99,0X95,0X79,0X30,0X3C,0XC0,0X04,0X1C,0X6F,0XC0,0X30,0XC0,0X3C,0X04,0X35,0X30,
+0XC1,0X7F,0X3C,0X30,0X1C,0XB8,0X89,0X1C,0X6E,0X1C,0X08,0X21,0XC0,0X52,0XA9,0X98,
+0XAC,0X88,0X98,0X88,0XB2,0X78,0XA3,0X99,0XAC,0X88,0XA2,0X78,0XC1,0X51,0X31,0XC0,
+0X9C,0X88,0X65,0XA2,0X89,0X9D,0X88,0X1D,0X65,0X09,0XC0,0X1D,0X11,0X09,0X3D,0X52,
+0XA2,0X88,0X35,0XC1,0X30,0X29,0X56,0XC0,0X62,0X6E,0X0D,0X66,0X01,0XC0,0X39,0X34,
+0XC1,0X98,0X87,0X6F,0XC0,0X7E,0XC0,0X6B,0XC0,0X6E,0XC0,0X7F,0XC2,0XA2,0X88,0X6E,
+0XC1,0X34,0X08,0X0D,0XC0,0X15,0X1C,0XC1,0X21,0X30,0XC0,0X21,0X1C,0XC0,0X09,0X90,
+0X98,0X31,0X91,0X98,0XA8,0X89,0X90,0X97,0X9D,0X89,0X7A,0X30,0X66,0X5A,0XA3,0X98,
+0X7F,0X3C,0X3F,0X13,0X04,0X3F,0XA2,0X77,0X13,0X07,0X30,0X33,0XC0,0X3F,0X30,0X04,
+0XC1,0X41,0X51,0X66,0XC0,0X66,0X19,0X14,0X19,0X14,0XC0,0X0F,0XC0,0X59,0X66,0XC7,
+0XAC,0XA7,0X41,0X0C,0X7A,0X6F,0X0C,0X65,0XA4,0X99,0X40,0X0F,0XA2,0X87,0XA2,0X88,
+0XA2,0X88,0XA2,0X88,0XA3,0X98,0XA6,0X98,0XA4,0X97,0XA2,0X88,0XC0,0X02,0XA2,0X88,
+0XA4,0X89,0XA3,0X89,0XA2,0X88,0X9D,0X9A,0X9C,0XA8,0X7A,0XA2,0X89,0X49,0XAD,0X49,
+0XA4,0X68,0X6F,0XA6,0X87,0X9B,0X89,0XA2,0X98,0X3C,0X9D,0X98,0X93,0X98,0X9D,0X99,
+0X9B,0X88,0X9C,0X89,0X65,0XA4,0X78,0XB3,0X99,0X9A,0X78,0X08,0X8C,0X88,0X0C,0X9B,
+0X89,0X7F,0X6E,0X7F,0X30,0XC0,0X1C,0XC0,0X30,0X28,0XA2,0X88,0X30,0XC3,0X3C,0X30,
+0XA2,0X88,0XC0,0X1C,0X56,0XC0,0X65,0X1C,0X30,0X14,0XA7,0X98,0XA2,0X88,0XAE,0X88,
+0XAF,0X89,0X0D,0XA9,0X99,0X7E,0X6F,0X55,0X51,0X31,0X9B,0X99,0X31,0X04,0XA2,0X88,
+0X9C,0X87,0X1D,0X18,0X1D,0X51,0XC0,0X18,0X09,0XC0,0X04,0X21,0X31,0X18,0X09,0X2C,
+0X04,0XC0,0X18,0XA2,0X87,0X0D,0XA5,0X98,0X52,0X2C,0X21,0X11,0X21,0X0D,0X9D,0X98,
+0X99,0X99,0X6E,0X6B,0X6E,0XC0,0X7F,0XC0,0X6E,0XC0,0X7F,0XC0,0X6E,0X20,0X25,0X7F,
+0X6E,0XC0,0X7F,0X39,0XC0,0X08,0XC0,0X0D,0X7F,0X21,0XC0,0X30,0XC1,0X21,0X1C,0X9D,
+0X98,0X27,0X98,0X87,0X51,0X9B,0X89,0X98,0X97,0X56,0X7A,0X30,0X2B,0XA3,0X88,0XC0,
+0X6F,0X69,0X13,0X3F,0XC0,0X33,0X3F,0X59,0X30,0X2B,0X33,0X55,0XA2,0X79,0XC0,0X04,
+0X30,0XC0,0X2B,0X56,0X14,0X7E,0X41,0X1C,0X14,0X1C,0X14,0XC2,0X51,0XC0,0X14,0X00,
+0XC5,0X37,0XC0,0X9D,0X88,0X33,0XA5,0X97,0XB2,0XA8,0XAC,0XA7,0XA2,0X88,0X6F,0X9D,
+0X79,0X9C,0X88,0X50,0XC0,0X06,0XA1,0XA9,0X22,0XA3,0X88,0X62,0X9D,0X88,0XA5,0XA9,
+0XA3,0X89,0XC0,0X66,0X9D,0X9A,0X9C,0X98,0X65,0X61,0XAD,0X38,0XB3,0X49,0X94,0X89,
+0XA9,0X98,0X9C,0X78,0XA3,0XA8,0X98,0X88,0XA6,0X88,0XA4,0X78,0X9A,0X88,0XA7,0X99,
+0X9D,0X88,0X9B,0X99,0X01,0X9D,0X99,0X97,0X98,0X1B,0XA4,0X88,0XAF,0X89,0X51,0X8F,
+0X97,0X97,0X99,0X04,0X30,0X56,0X04,0X56,0X30,0X55,0X28,0X3C,0X30,0XC0,0X28,0X30,
+0XC0,0X28,0XC0,0XA2,0X98,0X30,0X04,0X21,0X52,0X69,0X14,0XC0,0X28,0X14,0XAD,0X98,
+0X35,0XBD,0X89,0X6B,0XAF,0X98,0X00,0X69,0XC0,0X00,0X9D,0X88,0X00,0X99,0X88,0XA6,
+0X88,0X9C,0X88,0X7F,0X98,0X88,0XAA,0X88,0X18,0X1D,0X18,0X35,0X18,0XC0,0X09,0X66,
+0X69,0X9D,0X89,0X35,0XC2,0X66,0XC0,0X21,0X66,0XC0,0X55,0XC2,0X51,0XC0,0X66,0X99,
+0X98,0X6F,0XC0,0X6E,0X6E,0X7B,0XC0,0X6E,0XC0,0X20,0XC1,0X25,0XC0,0X39,0XC1,0X08,
+0XC0,0X0D,0XC0,0X7A,0X1C,0XC1,0X21,0X08,0X39,0XC0,0X34,0XC0,0X9C,0X87,0X94,0X88,
+0X61,0XA2,0X88,0X95,0X99,0X33,0XC0,0X2B,0X6E,0X6E,0X7F,0XA3,0X88,0X04,0XC0,0X7E,
+0X3F,0X04,0X3F,0X30,0XA2,0X89,0X30,0X24,0X5A,0XC0,0X30,0X52,0XA2,0X88,0X6E,0X28,
+0XC0,0X30,0X9C,0X78,0XA2,0X88,0X61,0X19,0X66,0X19,0X14,0X66,0X08,0X0F,0X05,0X66,
+0X0F,0X00,0XC5,0XAB,0XA8,0XA2,0X98,0XA8,0X87,0XAE,0X98,0XAA,0XA7,0X5A,0XA2,0X89,
+0X7F,0XA2,0X78,0X7E,0XC0,0X55,0X9C,0XA8,0X56,0XC0,0X66,0X08,0X03,0XC0,0X51,0X51,
+0XA3,0X88,0X52,0X9C,0X97,0X99,0XB9,0XA2,0X78,0XB2,0X29,0XA9,0X68,0X9D,0X99,0X9B,
+0X98,0X9D,0XA7,0X9A,0XA7,0XA2,0X88,0X6B,0X6E,0X9A,0X89,0XAD,0X69,0XA9,0X79,0X98,
+0X88,0XA7,0X99,0X9A,0X88,0X6F,0XA3,0X88,0XA2,0X88,0X95,0X99,0X8F,0XA8,0XAC,0X78,
+0XA5,0X99,0X98,0X87,0X95,0X89,0X90,0X97,0X13,0X55,0X65,0X5B,0X51,0X2B,0X3F,0X28,
+0X7E,0XC0,0X21,0X30,0X3C,0X9D,0X98,0X30,0X3F,0X30,0X35,0X28,0X9C,0X88,0X7E,0X21,
+0X28,0X1C,0XA6,0X88,0X6E,0XB5,0X8A,0XA4,0X87,0XAD,0X99,0XA4,0X78,0X31,0XC0,0X05,
+0X9C,0X88,0XC0,0X7F,0XC0,0X9D,0X88,0X7F,0X98,0X88,0X31,0X18,0X1D,0XC0,0X09,0X66,
+0XA2,0X87,0XC0,0X09,0X04,0X55,0X9D,0X99,0X35,0X66,0XC0,0X55,0XC1,0X1C,0X59,0X66,
+0X08,0XC0,0X55,0XC0,0X66,0XC0,
 };
 
 
@@ -1,6 +1,9 @@
 #include "tftlcd.h"
 #include "stdlib.h"
 #include "font.h" 
+#include "lcd_dma.h"
+#include "lcd_glyph.h"
+#include "lcd_dlist.h"
 #include "usart.h"	 
 #include "SysTick.h"	   
 
@@ -10,165 +13,35 @@ u16 FRONT_COLOR=BLACK;	//
 u16 BACK_COLOR=WHITE;  //ɫ 
 
 _tftlcd_data tftlcd_data; 
+
+#if TFTLCD_BUS_STAT
+_lcd_bus_stat lcd_bus_stat;
+
+//дͳ
+void LCD_BusStat_Clear(void)
+{
+	lcd_bus_stat.cmd=0;
+	lcd_bus_stat.data=0;
+	lcd_bus_stat.pixel=0;
+}
+#endif
   
 
 //дĴ
 //cmd:Ĵֵ
 void LCD_WriteCmd(u16 cmd)
 {
-#ifdef TFTLCD_HX8357D	
-	TFTLCD->LCD_CMD=cmd;//дҪдļĴ
-#endif
-	
-#ifdef TFTLCD_HX8357DN	
-	TFTLCD->LCD_CMD=cmd;
-#endif
-
-#ifdef TFTLCD_R61509V	
-	TFTLCD->LCD_CMD=cmd;//дҪдļĴ
-#endif
-	
-#ifdef TFTLCD_R61509VN	
-	TFTLCD->LCD_CMD=(cmd>>8)<<1;
-	TFTLCD->LCD_CMD=(cmd&0xff)<<1;
-#endif
-
-#ifdef TFTLCD_R61509V3	
-	TFTLCD->LCD_CMD=cmd;//дҪдļĴ
-#endif
-	
-#ifdef TFTLCD_HX8352C
-	TFTLCD->LCD_CMD=cmd<<8;
-#endif
-
-#ifdef TFTLCD_ILI9341
-	TFTLCD->LCD_CMD=cmd<<8;
-#endif
-	
-#ifdef TFTLCD_ILI9327
-	TFTLCD->LCD_CMD=cmd;
-#endif
-
-#ifdef TFTLCD_ILI9325
-	TFTLCD->LCD_CMD=cmd;
-#endif
-
-#ifdef TFTLCD_ILI9486
-	TFTLCD->LCD_CMD=cmd;
-#endif
-
-#ifdef TFTLCD_ST7793		
-	TFTLCD->LCD_CMD=cmd>>8;
-	TFTLCD->LCD_CMD=cmd&0xff;
-#endif
-
-#ifdef TFTLCD_SSD1963		
-	TFTLCD->LCD_CMD=cmd;
-#endif
-	
-#ifdef TFTLCD_NT35510		
-	TFTLCD->LCD_CMD=cmd;	
-#endif
-
-#ifdef TFTLCD_ILI9481
-	TFTLCD->LCD_CMD=cmd;
-#endif
-
-#ifdef TFTLCD_R61509VE
-	TFTLCD->LCD_CMD=cmd;
-#endif
-
-#ifdef TFTLCD_SSD1963N		
-	TFTLCD->LCD_CMD=cmd;
-#endif
-
-#ifdef TFTLCD_ILI9488
-	TFTLCD->LCD_CMD=cmd;
-#endif
-
-#ifdef TFTLCD_ILI9806
-	TFTLCD->LCD_CMD=cmd;
-#endif
-	
+	LCD_DMA_WAIT();		//DMAδʱܲ
+	LCD_STAT_CMD();
+	LCD_PORT_CMD(cmd);	//ѡдд,lcd_port.h
 }
 
 //д
 //data:Ҫдֵ
 void LCD_WriteData(u16 data)
 {
-#ifdef TFTLCD_HX8357D	
-	TFTLCD->LCD_DATA=data;//дҪдļĴ
-#endif
-
-#ifdef TFTLCD_HX8357DN	
-	TFTLCD->LCD_DATA=data;
-#endif
-	
-#ifdef TFTLCD_R61509V	
-	TFTLCD->LCD_DATA=data;//дҪдļĴ
-#endif
-	
-#ifdef TFTLCD_R61509VN	
-	TFTLCD->LCD_DATA=(data>>8)<<1;
-	TFTLCD->LCD_DATA=(data&0xff)<<1;	
-#endif
-
-#ifdef TFTLCD_R61509V3	
-	TFTLCD->LCD_DATA=data;//дҪдļĴ
-#endif
-	
-#ifdef TFTLCD_HX8352C
-	TFTLCD->LCD_DATA=data<<8;
-#endif
-
-#ifdef TFTLCD_ILI9341
-	TFTLCD->LCD_DATA=data<<8;
-#endif
-
-#ifdef TFTLCD_ILI9327
-	TFTLCD->LCD_DATA=data;
-#endif
-
-#ifdef TFTLCD_ILI9325
-	TFTLCD->LCD_DATA=data;
-#endif
-	
-#ifdef TFTLCD_ILI9486
-	TFTLCD->LCD_DATA=data;
-#endif
-	
-#ifdef TFTLCD_ST7793	
-	TFTLCD->LCD_DATA=data>>8;	
-	TFTLCD->LCD_DATA=data&0xff;	
-#endif
-
-#ifdef TFTLCD_SSD1963
-	TFTLCD->LCD_DATA=data;
-#endif
-	
-#ifdef TFTLCD_NT35510		
-	TFTLCD->LCD_DATA=data;	
-#endif
-
-#ifdef TFTLCD_ILI9481
-	TFTLCD->LCD_DATA=data;
-#endif
-
-#ifdef TFTLCD_R61509VE
-	TFTLCD->LCD_DATA=data;
-#endif
-
-#ifdef TFTLCD_SSD1963N
-	TFTLCD->LCD_DATA=data;
-#endif
-
-#ifdef TFTLCD_ILI9488
-	TFTLCD->LCD_DATA=data;
-#endif
-
-#ifdef TFTLCD_ILI9806
-	TFTLCD->LCD_DATA=data;
-#endif
+	LCD_STAT_DATA();
+	LCD_PORT_DATA(data);
 }
 
 void LCD_WriteCmdData(u16 cmd,u16 data)
@@ -190,86 +63,7 @@ u32 LCD_RGBColor_Change(u16 color)
 }
 void LCD_WriteData_Color(u16 color)
 {
-#ifdef TFTLCD_HX8357D
-	TFTLCD->LCD_DATA=color;
-#endif
-
-#ifdef TFTLCD_HX8357DN
-	TFTLCD->LCD_DATA=color>>8;
-	TFTLCD->LCD_DATA=color&0xff;
-#endif
-
-#ifdef TFTLCD_R61509V
-	TFTLCD->LCD_DATA=color;
-#endif
-	
-#ifdef TFTLCD_R61509VN
-	u32 recolor=0;
-	recolor=LCD_RGBColor_Change(color);
-	TFTLCD->LCD_DATA=(recolor>>9);
-	TFTLCD->LCD_DATA=recolor;
-#endif
-	
-#ifdef TFTLCD_R61509V3
-	TFTLCD->LCD_DATA=color;
-#endif
-
-#ifdef TFTLCD_HX8352C
-	TFTLCD->LCD_DATA=color&0xff00;
-	TFTLCD->LCD_DATA=color<<8;
-#endif	
-
-#ifdef TFTLCD_ILI9341
-	TFTLCD->LCD_DATA=color&0xff00;
-	TFTLCD->LCD_DATA=color<<8;
-#endif
-	
-#ifdef TFTLCD_ILI9327
-	TFTLCD->LCD_DATA=color>>8;
-	TFTLCD->LCD_DATA=color&0xff;
-#endif
-
-#ifdef TFTLCD_ILI9325
-	TFTLCD->LCD_DATA=color;
-#endif
-
-#ifdef TFTLCD_ILI9486
-	TFTLCD->LCD_DATA=color;
-#endif
-
-#ifdef TFTLCD_ST7793
-	TFTLCD->LCD_DATA=color>>8;
-	TFTLCD->LCD_DATA=color&0xff;
-#endif
-
-#ifdef TFTLCD_SSD1963
-	TFTLCD->LCD_DATA=color;
-#endif
-	
-#ifdef TFTLCD_NT35510
-	TFTLCD->LCD_DATA=color;	
-#endif
-
-#ifdef TFTLCD_ILI9481
-	TFTLCD->LCD_DATA=color;
-#endif
-
-#ifdef TFTLCD_R61509VE
-	TFTLCD->LCD_DATA=color;
-#endif
-
-#ifdef TFTLCD_SSD1963N
-	TFTLCD->LCD_DATA=color;
-#endif
-
-#ifdef TFTLCD_ILI9488
-	TFTLCD->LCD_DATA=color>>8;
-	TFTLCD->LCD_DATA=color&0xff;
-#endif
-
-#ifdef TFTLCD_ILI9806
-	TFTLCD->LCD_DATA=color;
-#endif
+	LCD_PIXEL(color);
 }
 
 //
@@ -667,317 +461,38 @@ void LCD_Display_Dir(u8 dir)
 //width,height:ڿȺ͸߶,0!!
 //С:width*height. 
 void LCD_Set_Window(u16 sx,u16 sy,u16 width,u16 height)
-{    
-#ifdef TFTLCD_HX8357D	
-	LCD_WriteCmd(0x2A);
-    LCD_WriteData(sx>>8);
-    LCD_WriteData(sx&0XFF);
-    LCD_WriteData(width>>8);
-    LCD_WriteData(width&0XFF);
-
-    LCD_WriteCmd(0x2b);
-    LCD_WriteData(sy>>8);
-    LCD_WriteData(sy&0XFF);
-    LCD_WriteData(height>>8);
-    LCD_WriteData(height&0XFF);
-    LCD_WriteCmd(0x2c); 
-#endif
-
-#ifdef TFTLCD_HX8357DN	
-	LCD_WriteCmd(0x2A);
-    LCD_WriteData(sx>>8);
-    LCD_WriteData(sx&0XFF);
-    LCD_WriteData(width>>8);
-    LCD_WriteData(width&0XFF);
-
-    LCD_WriteCmd(0x2b);
-    LCD_WriteData(sy>>8);
-    LCD_WriteData(sy&0XFF);
-    LCD_WriteData(height>>8);
-    LCD_WriteData(height&0XFF);
-    LCD_WriteCmd(0x2c); 
-#endif
-
-#ifdef TFTLCD_R61509V	
-	if(tftlcd_data.dir==0)
-	{
-		LCD_WriteCmd(0x0210);   
-	    LCD_WriteData(sx);
-		LCD_WriteCmd(0x0211);  
-	    LCD_WriteData(width);
-		LCD_WriteCmd(0x0212);   
-	    LCD_WriteData(sy);
-		LCD_WriteCmd(0x0213);   
-	    LCD_WriteData(height);
-	
-		LCD_WriteCmd(0x0200);   
-	    LCD_WriteData(sx);
-		LCD_WriteCmd(0x0201);   
-	    LCD_WriteData(sy);	
-	}   	
-	else
-	{
-		LCD_WriteCmd(0x0212);   
-	    LCD_WriteData(sx);
-		LCD_WriteCmd(0x0213);  
-	    LCD_WriteData(width);
-		LCD_WriteCmd(0x0210);   
-	    LCD_WriteData(sy);
-		LCD_WriteCmd(0x0211);   
-	    LCD_WriteData(height);
-	
-		LCD_WriteCmd(0x0201);   
-	    LCD_WriteData(sx);
-		LCD_WriteCmd(0x0200);   
-	    LCD_WriteData(sy);	
-	}
-	LCD_WriteCmd(0x0202);
-#endif
-
-#ifdef TFTLCD_R61509VN	
-	if(tftlcd_data.dir==0)
-	{
-		LCD_WriteCmd(0x0210);   
-	    LCD_WriteData(sx);
-		LCD_WriteCmd(0x0211);  
-	    LCD_WriteData(width);
-		LCD_WriteCmd(0x0212);   
-	    LCD_WriteData(sy);
-		LCD_WriteCmd(0x0213);   
-	    LCD_WriteData(height);
-	
-		LCD_WriteCmd(0x0200);   
-	    LCD_WriteData(sx);
-		LCD_WriteCmd(0x0201);   
-	    LCD_WriteData(sy);	
-	}   	
-	else
-	{
-		LCD_WriteCmd(0x0212);   
-	    LCD_WriteData(sx);
-		LCD_WriteCmd(0x0213);  
-	    LCD_WriteData(width);
-		LCD_WriteCmd(0x0210);   
-	    LCD_WriteData(sy);
-		LCD_WriteCmd(0x0211);   
-	    LCD_WriteData(height);
-	
-		LCD_WriteCmd(0x0201);   
-	    LCD_WriteData(sx);
-		LCD_WriteCmd(0x0200);   
-	    LCD_WriteData(sy);	
-	}
-	LCD_WriteCmd(0x0202);
-#endif	
-
-#ifdef TFTLCD_R61509V3	
-	if(tftlcd_data.dir==0)
-	{
-		LCD_WriteCmd(0x0210);   
-	    LCD_WriteData(sx);
-		LCD_WriteCmd(0x0211);  
-	    LCD_WriteData(width);
-		LCD_WriteCmd(0x0212);   
-	    LCD_WriteData(sy);
-		LCD_WriteCmd(0x0213);   
-	    LCD_WriteData(height);
-	
-		LCD_WriteCmd(0x0200);   
-	    LCD_WriteData(sx);
-		LCD_WriteCmd(0x0201);   
-	    LCD_WriteData(sy);	
-	}   	
-	else
-	{
-		LCD_WriteCmd(0x0212);   
-	    LCD_WriteData(sx);
-		LCD_WriteCmd(0x0213);  
-	    LCD_WriteData(width);
-		LCD_WriteCmd(0x0210);   
-	    LCD_WriteData(sy);
-		LCD_WriteCmd(0x0211);   
-	    LCD_WriteData(height);
-	
-		LCD_WriteCmd(0x0201);   
-	    LCD_WriteData(sx);
-		LCD_WriteCmd(0x0200);   
-	    LCD_WriteData(sy);	
-	}
-	LCD_WriteCmd(0x0202);
-#endif
-	
-#ifdef TFTLCD_HX8352C
-	LCD_WriteCmd(0x02);LCD_WriteData(sx/256);   
-	LCD_WriteCmd(0x03);LCD_WriteData(sx%256); 	 
-	LCD_WriteCmd(0x04);LCD_WriteData(width/256); 
-	LCD_WriteCmd(0x05);LCD_WriteData(width%256);
-	
-	LCD_WriteCmd(0x06);LCD_WriteData(sy/256);  
-	LCD_WriteCmd(0x07);LCD_WriteData(sy%256);
-	LCD_WriteCmd(0x08);LCD_WriteData(height/256); 
-	LCD_WriteCmd(0x09);LCD_WriteData(height%256); 	
-
-	LCD_WriteCmd(0x22);
-
-#endif
-
-#ifdef TFTLCD_ILI9341
-	LCD_WriteCmd(0x2A);
-	LCD_WriteData(sx/256);   
-	LCD_WriteData(sx%256); 	 
-	LCD_WriteData(width/256); 
-	LCD_WriteData(width%256);
-	
-	LCD_WriteCmd(0x2B);
-	LCD_WriteData(sy/256);  
-	LCD_WriteData(sy%256);
-	LCD_WriteData(height/256); 
-	LCD_WriteData(height%256); 	
-
-	LCD_WriteCmd(0x2C);
-
-#endif
-
-#ifdef TFTLCD_ILI9327
-	LCD_WriteCmd(0x2A);
-	LCD_WriteData(sx/256);   
-	LCD_WriteData(sx%256); 	 
-	LCD_WriteData(width/256); 
-	LCD_WriteData(width%256);
-	
-	LCD_WriteCmd(0x2B);
-	LCD_WriteData(sy/256);  
-	LCD_WriteData(sy%256);
-	LCD_WriteData(height/256); 
-	LCD_WriteData(height%256); 	
-
-	LCD_WriteCmd(0x2C);
-
-#endif
-
-#ifdef TFTLCD_ILI9325
-	if(tftlcd_data.dir==0)
-	{
-		LCD_WriteCmd(0x0050);   
-	    LCD_WriteData(sx);
-		LCD_WriteCmd(0x0051);  
-	    LCD_WriteData(width);
-		LCD_WriteCmd(0x0052);   
-	    LCD_WriteData(sy);
-		LCD_WriteCmd(0x0053);   
-	    LCD_WriteData(height);
-	
-		LCD_WriteCmd(0x0020);   
-	    LCD_WriteData(sx);
-		LCD_WriteCmd(0x0021);   
-	    LCD_WriteData(sy);	
-	}   	
-	else
-	{
-		LCD_WriteCmd(0x0052);   
-	    LCD_WriteData(sx);
-		LCD_WriteCmd(0x0053);  
-	    LCD_WriteData(width);
-		LCD_WriteCmd(0x0050);   
-	    LCD_WriteData(sy);
-		LCD_WriteCmd(0x0051);   
-	    LCD_WriteData(height);
-	
-		LCD_WriteCmd(0x0021);   
-	    LCD_WriteData(sx);
-		LCD_WriteCmd(0x0020);   
-	    LCD_WriteData(sy);	
-	}
-	LCD_WriteCmd(0x0022);
+{
+#if defined(LCD_PORT_WIN_DCS)||defined(LCD_PORT_WIN_DCS_SWAP)
+	u16 cx=0x2A,cy=0x2B;
 #endif
 
-#ifdef TFTLCD_ILI9486
-	LCD_WriteCmd(0x2A);
-	LCD_WriteData(sx/256);   
-	LCD_WriteData(sx%256); 	 
-	LCD_WriteData(width/256); 
-	LCD_WriteData(width%256);
-	
-	LCD_WriteCmd(0x2B);
-	LCD_WriteData(sy/256);  
-	LCD_WriteData(sy%256);
-	LCD_WriteData(height/256); 
-	LCD_WriteData(height%256); 	
-
-	LCD_WriteCmd(0x2C);
-
+#if LCD_DLIST
+	if(lcd_dl_rec)LCD_DL_Sync();	//¼ڼֱӻͼ,ȻѼ¼ĲȺ˳
 #endif
 
-#ifdef TFTLCD_ST7793	
+#if defined(LCD_PORT_WIN_DCS)||defined(LCD_PORT_WIN_DCS_SWAP)
+#ifdef LCD_PORT_WIN_DCS_SWAP
 	if(tftlcd_data.dir==0)
 	{
-		LCD_WriteCmd(0x0210);   
-	    LCD_WriteData(sx);
-		LCD_WriteCmd(0x0211);  
-	    LCD_WriteData(width);
-		LCD_WriteCmd(0x0212);   
-	    LCD_WriteData(sy);
-		LCD_WriteCmd(0x0213);   
-	    LCD_WriteData(height);
-	
-		LCD_WriteCmd(0x0200);   
-	    LCD_WriteData(sx);
-		LCD_WriteCmd(0x0201);   
-	    LCD_WriteData(sy);	
-	}   	
-	else
-	{
-		LCD_WriteCmd(0x0212);   
-	    LCD_WriteData(sx);
-		LCD_WriteCmd(0x0213);  
-	    LCD_WriteData(width);
-		LCD_WriteCmd(0x0210);   
-	    LCD_WriteData(sy);
-		LCD_WriteCmd(0x0211);   
-	    LCD_WriteData(height);
-	
-		LCD_WriteCmd(0x0201);   
-	    LCD_WriteData(sx);
-		LCD_WriteCmd(0x0200);   
-	    LCD_WriteData(sy);	
+		cx=0x2B;
+		cy=0x2A;
 	}
-	LCD_WriteCmd(0x0202);		
 #endif
-
-#ifdef TFTLCD_SSD1963
-	if(tftlcd_data.dir==0)
-	{
-		LCD_WriteCmd(0x2B);
-		LCD_WriteData(sx/256);   
-		LCD_WriteData(sx%256); 	 
-		LCD_WriteData(width/256); 
-		LCD_WriteData(width%256);
-		
-		LCD_WriteCmd(0x2A);
-		LCD_WriteData(sy/256);  
-		LCD_WriteData(sy%256);
-		LCD_WriteData(height/256); 
-		LCD_WriteData(height%256);
-	}
-	else
-	{
-		LCD_WriteCmd(0x2A);
-		LCD_WriteData(sx/256);   
-		LCD_WriteData(sx%256); 	 
-		LCD_WriteData(width/256); 
-		LCD_WriteData(width%256);
-		
-		LCD_WriteCmd(0x2B);
-		LCD_WriteData(sy/256);  
-		LCD_WriteData(sy%256);
-		LCD_WriteData(height/256); 
-		LCD_WriteData(height%256);
-	}
+	LCD_WriteCmd(cx);
+	LCD_WriteData(sx>>8);
+	LCD_WriteData(sx&0XFF);
+	LCD_WriteData(width>>8);
+	LCD_WriteData(width&0XFF);
+
+	LCD_WriteCmd(cy);
+	LCD_WriteData(sy>>8);
+	LCD_WriteData(sy&0XFF);
+	LCD_WriteData(height>>8);
+	LCD_WriteData(height&0XFF);
 	LCD_WriteCmd(0x2C);
-
 #endif
 
-#ifdef TFTLCD_NT35510	
+#ifdef LCD_PORT_WIN_NT35510
 	LCD_WriteCmd(0X2A00);LCD_WriteData(sx>>8);  
 	LCD_WriteCmd(0X2A01);LCD_WriteData(sx&0XFF);	  
 	LCD_WriteCmd(0X2A02);LCD_WriteData(width>>8);   
@@ -989,122 +504,89 @@ void LCD_Set_Window(u16 sx,u16 sy,u16 width,u16 height)
 	LCD_WriteCmd(0x2C00);
 #endif
 
-#ifdef TFTLCD_ILI9481
-	LCD_WriteCmd(0x2A);
-	LCD_WriteData(sx/256);   
-	LCD_WriteData(sx%256); 	 
-	LCD_WriteData(width/256); 
-	LCD_WriteData(width%256);
+#ifdef LCD_PORT_WIN_HX8352C
+	LCD_WriteCmd(0x02);LCD_WriteData(sx/256);   
+	LCD_WriteCmd(0x03);LCD_WriteData(sx%256); 	 
+	LCD_WriteCmd(0x04);LCD_WriteData(width/256); 
+	LCD_WriteCmd(0x05);LCD_WriteData(width%256);
 	
-	LCD_WriteCmd(0x2B);
-	LCD_WriteData(sy/256);  
-	LCD_WriteData(sy%256);
-	LCD_WriteData(height/256); 
-	LCD_WriteData(height%256); 	
+	LCD_WriteCmd(0x06);LCD_WriteData(sy/256);  
+	LCD_WriteCmd(0x07);LCD_WriteData(sy%256);
+	LCD_WriteCmd(0x08);LCD_WriteData(height/256); 
+	LCD_WriteCmd(0x09);LCD_WriteData(height%256); 	
 
-	LCD_WriteCmd(0x2C);
+	LCD_WriteCmd(0x22);
 #endif
 
-#ifdef TFTLCD_R61509VE	
+#ifdef LCD_PORT_WIN_REG
 	if(tftlcd_data.dir==0)
 	{
-		LCD_WriteCmd(0x0210);   
-	    LCD_WriteData(sx);
-		LCD_WriteCmd(0x0211);  
-	    LCD_WriteData(width);
-		LCD_WriteCmd(0x0212);   
-	    LCD_WriteData(sy);
-		LCD_WriteCmd(0x0213);   
-	    LCD_WriteData(height);
-	
-		LCD_WriteCmd(0x0200);   
-	    LCD_WriteData(sx);
-		LCD_WriteCmd(0x0201);   
-	    LCD_WriteData(sy);	
-	}   	
+		LCD_WriteCmd(LCD_PORT_REG_HSA);
+		LCD_WriteData(sx);
+		LCD_WriteCmd(LCD_PORT_REG_HEA);
+		LCD_WriteData(width);
+		LCD_WriteCmd(LCD_PORT_REG_VSA);
+		LCD_WriteData(sy);
+		LCD_WriteCmd(LCD_PORT_REG_VEA);
+		LCD_WriteData(height);
+
+		LCD_WriteCmd(LCD_PORT_REG_X);
+		LCD_WriteData(sx);
+		LCD_WriteCmd(LCD_PORT_REG_Y);
+		LCD_WriteData(sy);
+	}
 	else
 	{
-		LCD_WriteCmd(0x0212);   
-	    LCD_WriteData(sx);
-		LCD_WriteCmd(0x0213);  
-	    LCD_WriteData(width);
-		LCD_WriteCmd(0x0210);   
-	    LCD_WriteData(sy);
-		LCD_WriteCmd(0x0211);   
-	    LCD_WriteData(height);
-	
-		LCD_WriteCmd(0x0201);   
-	    LCD_WriteData(sx);
-		LCD_WriteCmd(0x0200);   
-	    LCD_WriteData(sy);	
+		LCD_WriteCmd(LCD_PORT_REG_VSA);
+		LCD_WriteData(sx);
+		LCD_WriteCmd(LCD_PORT_REG_VEA);
+		LCD_WriteData(width);
+		LCD_WriteCmd(LCD_PORT_REG_HSA);
+		LCD_WriteData(sy);
+		LCD_WriteCmd(LCD_PORT_REG_HEA);
+		LCD_WriteData(height);
+
+		LCD_WriteCmd(LCD_PORT_REG_Y);
+		LCD_WriteData(sx);
+		LCD_WriteCmd(LCD_PORT_REG_X);
+		LCD_WriteData(sy);
 	}
-	LCD_WriteCmd(0x0202);
+	LCD_WriteCmd(LCD_PORT_REG_GRAM);
 #endif
+}
 
-#ifdef TFTLCD_SSD1963N
-	if(tftlcd_data.dir==0)
+//ȡһɫ,дbuf
+//֧GRAMֻһδ,һζ,ȡ
+//(sx,sy),(ex,ey):ζԽ,ĻĲֲ
+//buf:ɫ,СΪ(ex-sx+1)*(ey-sy+1)
+void LCD_ReadRect(u16 sx,u16 sy,u16 ex,u16 ey,u16 *buf)
+{
+#ifdef LCD_PORT_READ_BUS8
+	u32 num;
+	u16 c;
+#else
+	u16 x,y;
+#endif
+
+	if(ex>=tftlcd_data.width)ex=tftlcd_data.width-1;
+	if(ey>=tftlcd_data.height)ey=tftlcd_data.height-1;
+	if(sx>ex||sy>ey)return;
+#ifdef LCD_PORT_READ_BUS8
+	num=(u32)(ex-sx+1)*(ey-sy+1);
+	LCD_Set_Window(sx,sy,ex,ey);
+	LCD_WriteCmd(0X2E);
+	c=TFTLCD->LCD_DATA;		//dummy Read
+	while(num--)
 	{
-		LCD_WriteCmd(0x2B);
-		LCD_WriteData(sx/256);   
-		LCD_WriteData(sx%256); 	 
-		LCD_WriteData(width/256); 
-		LCD_WriteData(width%256);
-		
-		LCD_WriteCmd(0x2A);
-		LCD_WriteData(sy/256);  
-		LCD_WriteData(sy%256);
-		LCD_WriteData(height/256); 
-		LCD_WriteData(height%256);
+		c=TFTLCD->LCD_DATA<<8;
+		c|=TFTLCD->LCD_DATA&0xff;
+		*buf++=c;
 	}
-	else
+#else
+	for(y=sy;y<=ey;y++)
 	{
-		LCD_WriteCmd(0x2A);
-		LCD_WriteData(sx/256);   
-		LCD_WriteData(sx%256); 	 
-		LCD_WriteData(width/256); 
-		LCD_WriteData(width%256);
-		
-		LCD_WriteCmd(0x2B);
-		LCD_WriteData(sy/256);  
-		LCD_WriteData(sy%256);
-		LCD_WriteData(height/256); 
-		LCD_WriteData(height%256);
+		for(x=sx;x<=ex;x++)*buf++=LCD_ReadPoint(x,y);
 	}
-	LCD_WriteCmd(0x2C);
-#endif
-
-#ifdef TFTLCD_ILI9488
-	LCD_WriteCmd(0x2A);
-	LCD_WriteData(sx/256);   
-	LCD_WriteData(sx%256); 	 
-	LCD_WriteData(width/256); 
-	LCD_WriteData(width%256);
-	
-	LCD_WriteCmd(0x2B);
-	LCD_WriteData(sy/256);  
-	LCD_WriteData(sy%256);
-	LCD_WriteData(height/256); 
-	LCD_WriteData(height%256); 	
-
-	LCD_WriteCmd(0x2C);
-
-#endif
-
-#ifdef TFTLCD_ILI9806
-	LCD_WriteCmd(0x2A);
-	LCD_WriteData(sx/256);   
-	LCD_WriteData(sx%256); 	 
-	LCD_WriteData(width/256); 
-	LCD_WriteData(width%256);
-	
-	LCD_WriteCmd(0x2B);
-	LCD_WriteData(sy/256);  
-	LCD_WriteData(sy%256);
-	LCD_WriteData(height/256); 
-	LCD_WriteData(height%256); 	
-
-	LCD_WriteCmd(0x2C);
-
 #endif
 }
 
@@ -3789,23 +3271,51 @@ delay_ms(50);
 #endif
 
 	LCD_Display_Dir(TFTLCD_DIR);		//0  1  Ĭ
+#if LCD_DMA_ENABLE
+	LCD_DMA_Init();
+#endif
 	LCD_Clear(WHITE);
 }
 
+//ü,ͼֻдڵ,ĬΪĻ
+static u16 clip_sx=0,clip_sy=0,clip_ex=0xFFFF,clip_ey=0xFFFF;
+
+#define LCD_IN_CLIP(x,y)	((x)>=clip_sx&&(x)<=clip_ex&&(y)>=clip_sy&&(y)<=clip_ey&&(x)<tftlcd_data.width&&(y)<tftlcd_data.height)
+
+//òü
+//(sx,sy),(ex,ey):üζԽ
+void LCD_Set_Clip(u16 sx,u16 sy,u16 ex,u16 ey)
+{
+	clip_sx=sx;
+	clip_sy=sy;
+	clip_ex=ex;
+	clip_ey=ey;
+}
+
+//ȡü,ָΪĻ
+void LCD_Reset_Clip(void)
+{
+	LCD_Set_Clip(0,0,0xFFFF,0xFFFF);
+}
+
+//üĻΧ󽻼
+//ֵ:0,Ϊ;1,д(sx,sy),(ex,ey)
+u8 LCD_ClipRect(u16 *sx,u16 *sy,u16 *ex,u16 *ey)
+{
+	if(*sx<clip_sx)*sx=clip_sx;
+	if(*sy<clip_sy)*sy=clip_sy;
+	if(*ex>clip_ex)*ex=clip_ex;
+	if(*ey>clip_ey)*ey=clip_ey;
+	if(*ex>=tftlcd_data.width)*ex=tftlcd_data.width-1;
+	if(*ey>=tftlcd_data.height)*ey=tftlcd_data.height-1;
+	return (*sx<=*ex)&&(*sy<=*ey);
+}
+
 //
 //color:Ҫɫ
 void LCD_Clear(u16 color)
 {
-	uint16_t i, j ;
-
-	LCD_Set_Window(0, 0, tftlcd_data.width-1, tftlcd_data.height-1);	 //
-  	for(i=0; i<tftlcd_data.width; i++)
-	{
-		for (j=0; j<tftlcd_data.height; j++)
-		{
-			LCD_WriteData_Color(color);
-		}
-	} 
+	LCD_Fill(0,0,tftlcd_data.width-1,tftlcd_data.height-1,color);
 }
 
 
@@ -3814,50 +3324,142 @@ void LCD_Clear(u16 color)
 //color:Ҫɫ
 void LCD_Fill(u16 xState,u16 yState,u16 xEnd,u16 yEnd,u16 color)
 {          
-	uint16_t temp;
+	u32 num;
 
     if((xState > xEnd) || (yState > yEnd))
     {
         return;
     }   
+	if(LCD_ClipRect(&xState,&yState,&xEnd,&yEnd)==0)return;
+#if LCD_DLIST
+	if(lcd_dl_rec)
+	{
+		LCD_DL_Fill(xState,yState,xEnd,yEnd,color);
+		return;
+	}
+#endif
+	num=(u32)(xEnd-xState+1)*(yEnd-yState+1);
+#if LCD_DMA_ENABLE
+	if(num>=LCD_DMA_MIN_PIXELS)
+	{
+		LCD_DMA_Fill(xState,yState,xEnd,yEnd,color,0);	//DMAں̨,´дǰԶȴ
+		return;
+	}
+#endif
 	LCD_Set_Window(xState, yState, xEnd, yEnd); 
-    xState = xEnd - xState + 1;
-	yState = yEnd - yState + 1;
-
-	while(xState--)
+	while(num--)
 	{
-	 	temp = yState;
-		while (temp--)
-	 	{			
-			LCD_WriteData_Color(color);	
-		}
+		LCD_PIXEL(color);	
 	}	
 } 
 
+//дһɫ,ü,ضʱDMA
+static void LCD_Color_Block(u16 sx,u16 sy,u16 ex,u16 ey,const u16 *color)
+{
+	u32 num;
+
+	num=(u32)(ex-sx+1)*(ey-sy+1);
+#if LCD_DMA_ENABLE
+	if(num>=LCD_DMA_MIN_PIXELS)
+	{
+		LCD_DMA_Blit(sx,sy,ex,ey,color,0);
+		return;
+	}
+#endif
+	LCD_Set_Window(sx,sy,ex,ey);
+	while(num--)
+	{
+		LCD_PIXEL(*color++);
+	}
+}
+
 //ָָɫ			 
 //(sx,sy),(ex,ey):ζԽ,СΪ:(ex-sx+1)*(ey-sy+1)   
 //color:Ҫɫ
 void LCD_Color_Fill(u16 sx,u16 sy,u16 ex,u16 ey,u16 *color)
 {  
-	u16 height,width;
-	u16 i,j;
-	width=ex-sx+1; 			//õĿ
-	height=ey-sy+1;			//߶
-	
-	for(i=0;i<height;i++)
+	if(sx>ex||sy>ey)return;
+	LCD_Blit(sx,sy,ex-sx+1,ey-sy+1,color,ex-sx+1);
+}
+
+//ɫеһдĻ
+//ü󴰿ֻһ,дпɼ;ʱд,ضʱDMA
+//(x,y):ĻϵϽ
+//w,h:дĿȺ͸߶
+//src:һеһ,д
+//stride:еļ(),дͼƬͼеһʱw
+void LCD_Blit(u16 x,u16 y,u16 w,u16 h,const u16 *src,u16 stride)
+{
+	u16 sx=x,sy=y,ex,ey;
+	u16 i,n;
+	const u16 *p;
+
+	if(w==0||h==0)return;
+	ex=x+w-1;
+	ey=y+h-1;
+	if(LCD_ClipRect(&sx,&sy,&ex,&ey)==0)return;
+	src+=(u32)(sy-y)*stride+(sx-x);
+	n=ex-sx+1;
+	if(n==stride)	//,д
+	{
+		LCD_Color_Block(sx,sy,ex,ey,src);
+	}
+#if LCD_DMA_ENABLE
+	else if(n>=LCD_DMA_MIN_PIXELS)	//ÿж㹻,нDMA
+	{
+		for(i=sy;i<=ey;i++,src+=stride)LCD_Color_Block(sx,i,ex,i,src);
+	}
+#endif
+	else
+	{
+		LCD_Set_Window(sx,sy,ex,ey);
+		for(i=sy;i<=ey;i++,src+=stride)
+		{
+			for(p=src;p<src+n;p++)LCD_PIXEL(*p);
+		}
+	}
+#if LCD_DMA_ENABLE
+	LCD_DMA_Wait();			//ɫڵ,ǰ봫
+#endif
+}
+
+//͸ɫĿд,LCD_Blitͬ,ɫkeyزд
+//ÿа͸زɶ,ÿһδ
+//key:͸ɫ
+void LCD_Blit_Key(u16 x,u16 y,u16 w,u16 h,const u16 *src,u16 stride,u16 key)
+{
+	u16 sx=x,sy=y,ex,ey;
+	u16 i,j,k;
+
+	if(w==0||h==0)return;
+	ex=x+w-1;
+	ey=y+h-1;
+	if(LCD_ClipRect(&sx,&sy,&ex,&ey)==0)return;
+	src+=(u32)(sy-y)*stride;
+	for(i=sy;i<=ey;i++,src+=stride)
 	{
-		for(j=0;j<width;j++)
+		j=sx;
+		while(j<=ex)
 		{
-			LCD_Set_Window(sx+j, sy+i,ex, ey);
-			LCD_WriteData_Color(color[i*width+j]);
+			while(j<=ex&&src[j-x]==key)j++;		//͸
+			if(j>ex)break;
+			k=j;
+			while(k<ex&&src[k+1-x]!=key)k++;	//͸һj..k
+			LCD_Color_Block(j,i,k,i,src+(j-x));
+			j=k+1;
 		}
-	}		  
+	}
+#if LCD_DMA_ENABLE
+	LCD_DMA_Wait();
+#endif
 }
+
 //
 //x,y:
 //FRONT_COLOR:˵ɫ
 void LCD_DrawPoint(u16 x,u16 y)
 {
+	if(!LCD_IN_CLIP(x,y))return;
 	LCD_Set_Window(x, y, x, y);  //õλ
 	LCD_WriteData_Color(FRONT_COLOR);	
 }
@@ -3867,33 +3469,87 @@ void LCD_DrawPoint(u16 x,u16 y)
 //color:ɫ
 void LCD_DrawFRONT_COLOR(u16 x,u16 y,u16 color)
 {	   
+	if(!LCD_IN_CLIP(x,y))return;
 	LCD_Set_Window(x, y, x, y);
 	LCD_WriteData_Color(color);	
 } 
 
+//ˮƽ߶,ԳĻ,ֲ
+static void LCD_HSpan(int x1,int x2,int y,u16 color)
+{
+	if(y<0||x2<0||x1>x2)return;
+	if(x1<0)x1=0;
+	LCD_Fill(x1,y,x2,y,color);
+}
+
+//ֱ߶,ԳĻ,ֲ
+static void LCD_VSpan(int x,int y1,int y2,u16 color)
+{
+	if(x<0||y2<0||y1>y2)return;
+	if(y1<0)y1=0;
+	LCD_Fill(x,y1,x,y2,color);
+}
+
 //
+//ˮƽߺʹֱֱ;бͬһ()ĵϳһ,
+//ÿֻһδ,ĵ㻭ͬ
 //x1,y1:
-//x2,y2:յ  
-void LCD_DrawLine(u16 x1, u16 y1, u16 x2, u16 y2)
+//x2,y2:յ
+//color:ߵɫ
+static void LCD_Line(u16 x1, u16 y1, u16 x2, u16 y2,u16 color)
 {
 	u16 t; 
 	int xerr=0,yerr=0,delta_x,delta_y,distance; 
 	int incx,incy,uRow,uCol; 
+	int rs,re;		//ǰһϵֹ
+	int rc;			//ǰһڵ()
+	u8 xmajor;		//1:x,ÿˮƽ߶
+
+	if(y1==y2)
+	{
+		LCD_Fill(x1<x2?x1:x2,y1,x1<x2?x2:x1,y1,color);
+		return;
+	}
+	if(x1==x2)
+	{
+		LCD_Fill(x1,y1<y2?y1:y2,x1,y1<y2?y2:y1,color);
+		return;
+	}
 	delta_x=x2-x1; // 
 	delta_y=y2-y1; 
 	uRow=x1; 
 	uCol=y1; 
 	if(delta_x>0)incx=1; //õ 
-	else if(delta_x==0)incx=0;//ֱ 
 	else {incx=-1;delta_x=-delta_x;} 
 	if(delta_y>0)incy=1; 
-	else if(delta_y==0)incy=0;//ˮƽ 
 	else{incy=-1;delta_y=-delta_y;} 
 	if( delta_x>delta_y)distance=delta_x; //ѡȡ 
 	else distance=delta_y; 
+	xmajor=delta_x>delta_y;
+	rs=re=xmajor?uRow:uCol;
+	rc=xmajor?uCol:uRow;
 	for(t=0;t<=distance+1;t++ )// 
 	{  
-		LCD_DrawPoint(uRow,uCol);// 
+		if(xmajor)
+		{
+			if(uCol!=rc)	//,һ
+			{
+				LCD_HSpan(rs<re?rs:re,rs<re?re:rs,rc,color);
+				rs=uRow;
+				rc=uCol;
+			}
+			re=uRow;
+		}
+		else
+		{
+			if(uRow!=rc)
+			{
+				LCD_VSpan(rc,rs<re?rs:re,rs<re?re:rs,color);
+				rs=uCol;
+				rc=uRow;
+			}
+			re=uCol;
+		}
 		xerr+=delta_x ; 
 		yerr+=delta_y ; 
 		if(xerr>distance) 
@@ -3907,41 +3563,21 @@ void LCD_DrawLine(u16 x1, u16 y1, u16 x2, u16 y2)
 			uCol+=incy; 
 		} 
 	}  
+	if(xmajor)LCD_HSpan(rs<re?rs:re,rs<re?re:rs,rc,color);
+	else LCD_VSpan(rc,rs<re?rs:re,rs<re?re:rs,color);
+}
+
+//
+//x1,y1:
+//x2,y2:յ  
+void LCD_DrawLine(u16 x1, u16 y1, u16 x2, u16 y2)
+{
+	LCD_Line(x1,y1,x2,y2,FRONT_COLOR);
 } 
 
 void LCD_DrawLine_Color(u16 x1, u16 y1, u16 x2, u16 y2,u16 color)
 {
-	u16 t; 
-	int xerr=0,yerr=0,delta_x,delta_y,distance; 
-	int incx,incy,uRow,uCol; 
-	delta_x=x2-x1; // 
-	delta_y=y2-y1; 
-	uRow=x1; 
-	uCol=y1; 
-	if(delta_x>0)incx=1; //õ 
-	else if(delta_x==0)incx=0;//ֱ 
-	else {incx=-1;delta_x=-delta_x;} 
-	if(delta_y>0)incy=1; 
-	else if(delta_y==0)incy=0;//ˮƽ 
-	else{incy=-1;delta_y=-delta_y;} 
-	if( delta_x>delta_y)distance=delta_x; //ѡȡ 
-	else distance=delta_y; 
-	for(t=0;t<=distance+1;t++ )// 
-	{  
-		LCD_DrawFRONT_COLOR(uRow,uCol,color);// 
-		xerr+=delta_x ; 
-		yerr+=delta_y ; 
-		if(xerr>distance) 
-		{ 
-			xerr-=distance; 
-			uRow+=incx; 
-		} 
-		if(yerr>distance) 
-		{ 
-			yerr-=distance; 
-			uCol+=incy; 
-		} 
-	}  
+	LCD_Line(x1,y1,x2,y2,color);
 } 
 
 
@@ -3984,71 +3620,255 @@ void LCD_DrawRectangle(u16 x1, u16 y1, u16 x2, u16 y2)
 	LCD_DrawLine(x1,y2,x2,y2);
 	LCD_DrawLine(x2,y1,x2,y2);
 }
+//Բbͬ,aasae8ζԳ߶
+static void LCD_Circle_Arc(int x0,int y0,int as,int ae,int b,u16 color)
+{
+	LCD_HSpan(x0+as,x0+ae,y0-b,color);
+	LCD_HSpan(x0-ae,x0-as,y0-b,color);
+	LCD_HSpan(x0+as,x0+ae,y0+b,color);
+	LCD_HSpan(x0-ae,x0-as,y0+b,color);
+	LCD_VSpan(x0+b,y0+as,y0+ae,color);
+	LCD_VSpan(x0+b,y0-ae,y0-as,color);
+	LCD_VSpan(x0-b,y0+as,y0+ae,color);
+	LCD_VSpan(x0-b,y0-ae,y0-as,color);
+}
+
 //ָλûһָСԲ
+//bʱaĵϳˮƽʹֱ߶,ÿֻһδ
 //(x,y):ĵ
 //r    :뾶
 void LCD_Draw_Circle(u16 x0,u16 y0,u8 r)
 {
-	int a,b;
+	int a,b,nb;
 	int di;
+	int as;			//ǰһεĵһa
 	a=0;b=r;	  
+	as=0;
 	di=3-(r<<1);             //ж¸λõı־
 	while(a<=b)
 	{
-		LCD_DrawPoint(x0+a,y0-b);             //5
- 		LCD_DrawPoint(x0+b,y0-a);             //0           
-		LCD_DrawPoint(x0+b,y0+a);             //4               
-		LCD_DrawPoint(x0+a,y0+b);             //6 
-		LCD_DrawPoint(x0-a,y0+b);             //1       
- 		LCD_DrawPoint(x0-b,y0+a);             
-		LCD_DrawPoint(x0-a,y0-b);             //2             
-  		LCD_DrawPoint(x0-b,y0-a);             //7     	         
-		a++;
-		//ʹBresenham㷨Բ     
-		if(di<0)di +=4*a+6;	  
+		//ʹBresenham㷨Բ,һb
+		nb=b;
+		if(di<0)di +=4*(a+1)+6;	  
 		else
 		{
-			di+=10+4*(a-b);   
-			b--;
+			di+=10+4*(a+1-b);   
+			nb=b-1;
 		} 						    
+		if(nb!=b||a+1>nb)	//bҪıһ,as..aһ
+		{
+			LCD_Circle_Arc(x0,y0,as,a,b,FRONT_COLOR);
+			as=a+1;
+		}
+		a++;
+		b=nb;
 	}
 } 
 
+//Բ֮ˮƽɨ,ʵԲԲǾ
+//(xl,yt):Բ (xr,yb):Բ,ʵԲʱԲͬ
+//r:뾶
+//color:ɫ
+static void LCD_Fill_Caps(int xl,int yt,int xr,int yb,u8 r,u16 color)
+{
+	int a,b,na,nb;
+	int di;
+	a=0;b=r;	  
+	di=3-(r<<1);
+	while(a<=b)
+	{
+		//yƫa,b
+		LCD_HSpan(xl-b,xr+b,yb+a,color);
+		if(a||yt!=yb)LCD_HSpan(xl-b,xr+b,yt-a,color);
+		na=a+1;
+		nb=b;
+		if(di<0)di +=4*na+6;	  
+		else
+		{
+			di+=10+4*(na-b);   
+			nb=b-1;
+		} 						    
+		//yƫb,bҪıʱa,ֻһ
+		if((nb!=b||na>nb)&&a!=b)
+		{
+			LCD_HSpan(xl-a,xr+a,yb+b,color);
+			LCD_HSpan(xl-a,xr+a,yt-b,color);
+		}
+		a=na;
+		b=nb;
+	}
+}
+
+//ʵԲ,ɨ,ÿֻһδ
+//(x0,y0):ĵ
+//r:뾶
+//color:ɫ
+void LCD_Fill_Circle(u16 x0,u16 y0,u8 r,u16 color)
+{
+	LCD_Fill_Caps(x0,y0,x0,y0,r,color);
+}
+
+//ʵԲǾ
+//(sx,sy),(ex,ey):ζԽ
+//r:Բǰ뾶,̱һʱ̱һ
+//color:ɫ
+void LCD_Fill_RoundRect(u16 sx,u16 sy,u16 ex,u16 ey,u8 r,u16 color)
+{
+	if(sx>ex||sy>ey)return;
+	if(r>(ex-sx)/2)r=(ex-sx)/2;
+	if(r>(ey-sy)/2)r=(ey-sy)/2;
+	if(ey-sy>2*r+1)LCD_Fill(sx,sy+r+1,ex,ey-r-1,color);	//мľβ
+	LCD_Fill_Caps(sx+r,sy+r,ex-r,ey-r,r,color);
+}
+
+
+
+//ȡַĵ
+//num:Ҫʾַ:" "--->"~"
+//size:ֿС 12/16/24/32
+//ֵ:׵ַ,ûжӦֿǷַ0
+//ȡģ,ÿsize/8(ȡ)ֽ,λ,size/2
+const u8 *LCD_GetFont(u8 num,u8 size)
+{
+	if(num<' '||num>'~')return 0;
+	num=num-' ';//õƫƺֵASCIIֿǴӿոʼȡģ-' 'ǶӦַֿ⣩
+	if(size==12)return ascii_1206[num]; 		//1206
+	else if(size==16)return ascii_1608[num];	//1608
+	else if(size==24)return ascii_2412[num];	//2412
+	else if(size==32)return ascii_3216[num];	//3216
+	return 0;									//ûеֿ
+}
+
+//ѡʾsizeСַõֿ
+//ôֿ,ֿûеĴСֿŴ,36=1206*3,48=2412*2
+//ֵ:ֿС,0ʾ޷ʾôС
+u8 LCD_FontBase(u8 size)
+{
+	if(size==0)return 0;
+	if(size%32==0)return 32;
+	if(size%24==0)return 24;
+	if(size%16==0)return 16;
+	if(size%12==0)return 12;
+	return 0;
+}
 
+//һʾnַ(ǵӷʽ)
+//Ȱַĵչ,һдGRAM,ÿַֻһδ
+//Ŵʾʱÿλscale,ÿظscale
+//ֻڲüڵĲ
+//x,y:ʼ
+//p:ַ,n:ַ
+//size:С,LCD_FontBase
+static void LCD_ShowCharRun(u16 x,u16 y,u8 *p,u16 n,u8 size)
+{
+	const u8 *font;
+	u8 base=LCD_FontBase(size);			//ֿС
+	u8 scale;							//Ŵ
+	u8 cbytes=base/8+((base%8)?1:0);	//ÿռֽ
+	u8 bw=base/2;						//ַֿ
+	u8 cw=size/2;						//ַ
+	u8 mask,k;
+	u16 sx,sy,ex,ey,r,i,c,cnt,sr;
+
+	if(n==0||base==0)return;			//ûеֿ
+#if LCD_GLYPH_CACHE
+	if(LCD_Glyph_ShowRun(x,y,p,n,size))return;	//ӻȡչõ
+#endif
+	scale=size/base;
+	sx=x;
+	sy=y;
+	ex=x+n*cw-1;
+	ey=y+size-1;
+	if(LCD_ClipRect(&sx,&sy,&ex,&ey)==0)return;
+	LCD_Set_Window(sx,sy,ex,ey);
+	for(r=sy;r<=ey;r++)
+	{
+		sr=(r-y)/scale;					//Ӧĵ
+		mask=0x80>>(sr&7);
+		i=(sx-x)/cw;
+		c=(sx-x)%cw;
+		k=c%scale;
+		c=c/scale;
+		font=LCD_GetFont(p[i],base);
+		if(font==0)font=LCD_GetFont(' ',base);
+		font+=sr>>3;
+		for(cnt=ex-sx+1;cnt;cnt--)
+		{
+			if(font[c*cbytes]&mask)LCD_PIXEL(FRONT_COLOR);
+			else LCD_PIXEL(BACK_COLOR);
+			if(++k<scale)continue;
+			k=0;
+			if(++c==bw&&cnt>1)
+			{
+				c=0;
+				i++;
+				font=LCD_GetFont(p[i],base);
+				if(font==0)font=LCD_GetFont(' ',base);
+				font+=sr>>3;
+			}
+		}
+	}
+}
 
 //ָλʾһַ
 //x,y:ʼ
 //num:Ҫʾַ:" "--->"~"
-//size:С 12/16/24
+//size:С,LCD_FontBase
 //mode:ӷʽ(1)Ƿǵӷʽ(0)
+//ǵӷʽַֻһδд;ӷʽÿǰϲһ,
+//ŴÿһΪγ*scale,Ϊscaleľ,ÿοһδ
 void LCD_ShowChar(u16 x,u16 y,u8 num,u8 size,u8 mode)
 {  							  
-    u8 temp,t1,t;
-	u16 y0=y;
-	u8 csize=(size/8+((size%8)?1:0))*(size/2);		//õһַӦռֽ	
- 	num=num-' ';//õƫƺֵASCIIֿǴӿոʼȡģ-' 'ǶӦַֿ⣩
-	for(t=0;t<csize;t++)
-	{   
-		if(size==12)temp=ascii_1206[num][t]; 	 	//1206
-		else if(size==16)temp=ascii_1608[num][t];	//1608
-		else if(size==24)temp=ascii_2412[num][t];	//2412
-		else return;								//ûеֿ
-		for(t1=0;t1<8;t1++)
-		{			    
-			if(temp&0x80)LCD_DrawFRONT_COLOR(x,y,FRONT_COLOR);
-			else if(mode==0)LCD_DrawFRONT_COLOR(x,y,BACK_COLOR);
-			temp<<=1;
-			y++;
-			if(y>=tftlcd_data.height)return;		//
-			if((y-y0)==size)
+	const u8 *font;
+	u8 base=LCD_FontBase(size);
+	u8 scale;
+	u8 cbytes=base/8+((base%8)?1:0);	//õһռֽ
+	u8 bw=base/2;
+	u8 mask;
+	u16 sx,sy,ex,ey,sr,c,s;
+	u16 x0,x1,y0,y1;
+	u32 num_px;
+
+	if(mode==0)
+	{
+		LCD_ShowCharRun(x,y,&num,1,size);
+		return;
+	}
+	if(base==0)return;
+	font=LCD_GetFont(num,base);
+	if(font==0)return;
+	scale=size/base;
+	sx=x;
+	sy=y;
+	ex=x+size/2-1;
+	ey=y+size-1;
+	if(LCD_ClipRect(&sx,&sy,&ex,&ey)==0)return;	//
+	for(sr=(sy-y)/scale;sr<=(ey-y)/scale;sr++)
+	{
+		mask=0x80>>(sr&7);
+		y0=y+sr*scale;
+		y1=y0+scale-1;
+		if(y0<sy)y0=sy;
+		if(y1>ey)y1=ey;
+		c=0;
+		while(c<bw)
+		{
+			if((font[c*cbytes+(sr>>3)]&mask)==0)
 			{
-				y=y0;
-				x++;
-				if(x>=tftlcd_data.width)return;	//
-				break;
+				c++;
+				continue;
 			}
-		}  	 
-	}  	    	   	 	  
+			s=c;
+			while(c<bw&&(font[c*cbytes+(sr>>3)]&mask))c++;
+			x0=x+s*scale;
+			x1=x+c*scale-1;
+			if(x0<sx)x0=sx;
+			if(x1>ex)x1=ex;
+			if(x0>x1)continue;
+			LCD_Set_Window(x0,y0,x1,y1);
+			for(num_px=(u32)(x1-x0+1)*(y1-y0+1);num_px;num_px--)LCD_PIXEL(FRONT_COLOR);
+		}
+	}
 }   
 //m^n
 //ֵ:m^nη.
@@ -4118,18 +3938,29 @@ void LCD_ShowxNum(u16 x,u16 y,u32 num,u8 len,u8 size,u8 mode)
 //width,height:С  
 //size:С
 //*p:ַʼַ		  
+//ͬһܷµַΪһ,ֻһδд
 void LCD_ShowString(u16 x,u16 y,u16 width,u16 height,u8 size,u8 *p)
 {         
-	u8 x0=x;
+	u16 x0=x;
+	u16 n;
+#if LCD_DLIST
+	if(lcd_dl_rec)
+	{
+		LCD_DL_String(x,y,width,height,size,p);
+		return;
+	}
+#endif
 	width+=x;
 	height+=y;
     while((*p<='~')&&(*p>=' '))//жǲǷǷַ!
     {       
         if(x>=width){x=x0;y+=size;}
         if(y>=height)break;//˳
-        LCD_ShowChar(x,y,*p,size,0);
-        x+=size/2;
-        p++;
+		n=0;
+		while((p[n]<='~')&&(p[n]>=' ')&&(x+n*(size/2)<width))n++;	//ܷµַ
+        LCD_ShowCharRun(x,y,p,n,size);
+        x+=n*(size/2);
+        p+=n;
     }  
 }
 
@@ -4181,84 +4012,106 @@ void LCD_ShowFontHZ(u16 x, u16 y, u8 *cn)
 #endif
 
 
-#if 1
+#define HZ_NUM	(sizeof(CnChar32x29)/sizeof(CnChar32x29[0]))	//ֿеĺ
+#define HZ_CODE(p)	(((u16)(p)[0]<<8)|(p)[1])						//ֽ
+
+static u8 hz_order[HZ_NUM];		//Сеֿ±
+static u8 hz_sorted=0;
+
+//Һģ,һεʱź,ֲ֮
+//cn:
+//ֵ:ģ,ֿûʱ0
+static const struct Cn32CharTypeDef *LCD_FindHZ(u8 *cn)
+{
+	u8 i,j,t;
+	u16 code=HZ_CODE(cn);
+	u16 lo=0,hi=HZ_NUM,mid;
+
+	if(hz_sorted==0)
+	{
+		for(i=0;i<HZ_NUM;i++)	//
+		{
+			t=i;
+			for(j=i;j>0&&HZ_CODE(CnChar32x29[hz_order[j-1]].Index)>HZ_CODE(CnChar32x29[t].Index);j--)
+			{
+				hz_order[j]=hz_order[j-1];
+			}
+			hz_order[j]=t;
+		}
+		hz_sorted=1;
+	}
+	while(lo<hi)
+	{
+		mid=(lo+hi)/2;
+		if(HZ_CODE(CnChar32x29[hz_order[mid]].Index)<code)lo=mid+1;
+		else hi=mid;
+	}
+	if(lo<HZ_NUM&&HZ_CODE(CnChar32x29[hz_order[lo]].Index)==code)return &CnChar32x29[hz_order[lo]];
+	return 0;
+}
+
+//ʾ32*29ִ,ֿûеĺ
+//ÿֻһδ,дڲüڵ
+//x,y:ʼ
+//cn:ִ(GB2312)
 void LCD_ShowFontHZ(u16 x, u16 y, u8 *cn)
 {
-	u8 i, j, wordNum;
-	u16 color;
-	u16 x0=x; 
-	u16 y0=y; 
-	while (*cn != '\0')
+	const struct Cn32CharTypeDef *hz;
+	const u8 *row;
+	u8 mask;
+	u16 sx,sy,ex,ey,r,c;
+
+	while(cn[0]!='\0'&&cn[1]!='\0')
 	{
-		for (wordNum=0; wordNum<20; wordNum++)
-		{	//wordNumɨֿ
-			if ((CnChar32x29[wordNum].Index[0]==*cn)
-			     &&(CnChar32x29[wordNum].Index[1]==*(cn+1)))
+		hz=LCD_FindHZ(cn);
+		sx=x;
+		sy=y;
+		ex=x+31;
+		ey=y+28;
+		if(hz!=0&&LCD_ClipRect(&sx,&sy,&ex,&ey))
+		{
+			LCD_Set_Window(sx,sy,ex,ey);
+			for(r=sy;r<=ey;r++)
 			{
-				for(i=0; i<116; i++) 
-				{	//MSKλ
-					color=CnChar32x29[wordNum].Msk[i];
-					for(j=0;j<8;j++) 
+				row=&hz->Msk[(r-y)*4+((sx-x)>>3)];
+				mask=0x80>>((sx-x)&7);
+				for(c=sx;c<=ex;c++)
+				{
+					if(*row&mask)LCD_PIXEL(FRONT_COLOR);
+					else LCD_PIXEL(BACK_COLOR);
+					mask>>=1;
+					if(mask==0)
 					{
-						if((color&0x80)==0x80)
-						{
-							LCD_DrawFRONT_COLOR(x,y,FRONT_COLOR);
-						} 						
-						else
-						{
-							LCD_DrawFRONT_COLOR(x,y,BACK_COLOR);
-						} 
-						color<<=1;
-						x++;
-						if((x-x0)==32)
-						{
-							x=x0;
-							y++;
-							if((y-y0)==29)
-							{
-								y=y0;
-							}
-						}
-					}//for(j=0;j<8;j++)
-				}	
+						mask=0x80;
+						row++;
+					}
+				}
 			}
-			
-		} //for (wordNum=0; wordNum<20; wordNum++) 	
-		cn += 2;
-		x += 32;
-		x0=x;
+		}
+		cn+=2;
+		x+=32;
 	}
-}	
-#endif
+}
 
+//ʾRGB565ͼƬ(ֽǰ)
+//x,y:Ͻ
+//wide,high:ͼƬ
+//pic:ͼƬ
 void LCD_ShowPicture(u16 x, u16 y, u16 wide, u16 high,u8 *pic)
 {
 	u16 i,j;
-	u16 temp = 0;
-	long tmp=0,num=0;
-	LCD_Set_Window(x, y, x+wide-1, y+high-1);
-	num = wide * high*2 ;
-	//1ʾٶȣ̫ܵͼʾȫ
-//	do
-//	{  
-//		temp = pic[tmp + 1];
-//		temp = temp << 8;
-//		temp = temp | pic[tmp];
-//		LCD_WriteData_Color(temp);//ʾ
-//		tmp += 2;
-//	}
-//	while(tmp < num);
-	
-	//2ЧLCDʾٶȹ쵼ʾȫ
-	for(i=0;i<high;i++)
+	u16 sx=x,sy=y,ex=x+wide-1,ey=y+high-1;
+	u8 *p;
+
+	if(LCD_ClipRect(&sx,&sy,&ex,&ey)==0)return;
+	LCD_Set_Window(sx,sy,ex,ey);	//ɼֻһδ,д
+	for(i=sy;i<=ey;i++)
 	{
-		for(j=0;j<wide;j++)
+		p=pic+((u32)(i-y)*wide+(sx-x))*2;
+		for(j=sx;j<=ex;j++)
 		{
-			temp = pic[tmp + 1];
-			temp = temp << 8;
-			temp = temp | pic[tmp];
-			LCD_DrawFRONT_COLOR(x+j,y+i,temp);
-			tmp += 2;
+			LCD_PIXEL(p[0]|(p[1]<<8));
+			p+=2;
 		}
-	}	
+	}
 }
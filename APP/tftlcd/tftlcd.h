@@ -45,17 +45,48 @@
 #define	LCD_LED PBout(0) //LCD  PB0
 
 //TFTLCDַṹ
+//Ϊvolatile,дչܺϲʡд
 typedef struct
 {
-	u16 LCD_CMD;
-	u16 LCD_DATA;
+	vu16 LCD_CMD;
+	vu16 LCD_DATA;
 }TFTLCD_TypeDef;
 
 
 //ʹNOR/SRAM Bank1.sector4,ַλHADDR[27,26]=11 A10Ϊ 
 //ע16λʱSTM32ڲһλ!			    
 #define TFTLCD_BASE        ((u32)(0x6C000000 | 0x000007FE))
+#ifndef TFTLCD	//ϲʱԤȶTFTLCDָģļĴ
 #define TFTLCD             ((TFTLCD_TypeDef *) TFTLCD_BASE)
+#endif
+
+//дͳ  1: 0:ر  ڱȽϸͼ߿
+#ifndef TFTLCD_BUS_STAT	//ϲʱڱд
+#define TFTLCD_BUS_STAT	0
+#endif
+
+#if TFTLCD_BUS_STAT
+typedef struct
+{
+	u32 cmd;			//д
+	u32 data;			//д
+	u32 pixel;			//ɫд(HX8357DNÿɫռ2д)
+}_lcd_bus_stat;
+extern _lcd_bus_stat lcd_bus_stat;
+#define LCD_STAT_CMD()		(lcd_bus_stat.cmd++)
+#define LCD_STAT_DATA()		(lcd_bus_stat.data++)
+#define LCD_STAT_PIXEL()	(lcd_bus_stat.pixel++)
+void LCD_BusStat_Clear(void);
+#else
+#define LCD_STAT_CMD()
+#define LCD_STAT_DATA()
+#define LCD_STAT_PIXEL()
+#endif
+
+#include "lcd_port.h"
+
+//дһصɫ,ôں,ѡֱչݿд
+#define LCD_PIXEL(c)	do{LCD_PORT_PIXEL(c);LCD_STAT_PIXEL();}while(0)
   
 //TFTLCDҪ
 typedef struct  
@@ -140,21 +171,32 @@ void LCD_WriteCmd(u16 cmd);
 void LCD_WriteData(u16 data);
 void LCD_WriteCmdData(u16 cmd,u16 data);
 void LCD_WriteData_Color(u16 color);
+u32 LCD_RGBColor_Change(u16 color);
 
 void TFTLCD_Init(void); //ʼ
 void LCD_Set_Window(u16 sx,u16 sy,u16 width,u16 height);//ô
 void LCD_Display_Dir(u8 dir);//Ļʾ
+void LCD_Set_Clip(u16 sx,u16 sy,u16 ex,u16 ey);//òü
+void LCD_Reset_Clip(void);//ȡü
+u8 LCD_ClipRect(u16 *sx,u16 *sy,u16 *ex,u16 *ey);//ü󽻼
 void LCD_Clear(u16 Color);//
 void LCD_Fill(u16 xState,u16 yState,u16 xEnd,u16 yEnd,u16 color);//䵥ɫ
 void LCD_Color_Fill(u16 sx,u16 sy,u16 ex,u16 ey,u16 *color);//ָָɫ
+void LCD_Blit(u16 x,u16 y,u16 w,u16 h,const u16 *src,u16 stride);//дɫеһ
+void LCD_Blit_Key(u16 x,u16 y,u16 w,u16 h,const u16 *src,u16 stride,u16 key);//͸ɫд
 void LCD_DrawPoint(u16 x,u16 y);//
 void LCD_DrawFRONT_COLOR(u16 x,u16 y,u16 color);//ָɫ
 u16 LCD_ReadPoint(u16 x,u16 y);//
+void LCD_ReadRect(u16 sx,u16 sy,u16 ex,u16 ey,u16 *buf);//һɫ
 void LCD_DrawLine(u16 x1, u16 y1, u16 x2, u16 y2);//
 void LCD_DrawLine_Color(u16 x1, u16 y1, u16 x2, u16 y2,u16 color);//ָɫ
 void LCD_DrowSign(uint16_t x, uint16_t y, uint16_t color);//ʮֱ
 void LCD_DrawRectangle(u16 x1, u16 y1, u16 x2, u16 y2);//
 void LCD_Draw_Circle(u16 x0,u16 y0,u8 r);//Բ
+void LCD_Fill_Circle(u16 x0,u16 y0,u8 r,u16 color);//ʵԲ
+void LCD_Fill_RoundRect(u16 sx,u16 sy,u16 ex,u16 ey,u8 r,u16 color);//ʵԲǾ
+const u8 *LCD_GetFont(u8 num,u8 size);//ȡַ
+u8 LCD_FontBase(u8 size);//ѡֿ
 void LCD_ShowChar(u16 x,u16 y,u8 num,u8 size,u8 mode);//ʾһַ
 void LCD_ShowNum(u16 x,u16 y,u32 num,u8 len,u8 size);//ʾһ
 void LCD_ShowxNum(u16 x,u16 y,u32 num,u8 len,u8 size,u8 mode);//ʾ
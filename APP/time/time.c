@@ -2,6 +2,7 @@
 #include "led.h"
 #include "tftlcd.h"
 #include "key.h"
+#include "evq.h"
 
 
 /*******************************************************************************
@@ -45,12 +46,11 @@ void TIM4_Init(u16 per,u16 psc)
 *******************************************************************************/
 void TIM4_IRQHandler(void)
 {
-	static u8 i=0,j=0;
 	if(TIM_GetITStatus(TIM4,TIM_IT_Update))
 	{
-		
+		TIM_ClearITPendingBit(TIM4,TIM_IT_Update);
+		Key_Tick();		//,1msһ
 	}
-	TIM_ClearITPendingBit(TIM4,TIM_IT_Update);	
 }
 
 
@@ -124,6 +124,22 @@ void TIM5_IRQHandler(void)
 }
 
 
+//TIM6,1usһ,ж,DHT11ͺյıشʱ
+//ģʼʱ,ظûӰ
+void TIM6_Init(void)
+{
+	TIM_TimeBaseInitTypeDef  TIM_TimeBaseInitStructure;
+
+	RCC_APB1PeriphClockCmd(RCC_APB1Periph_TIM6, ENABLE);
+	TIM_TimeBaseInitStructure.TIM_Period=0xFFFF;
+	TIM_TimeBaseInitStructure.TIM_Prescaler=72-1;	//APB1ʱʱ72MHz
+	TIM_TimeBaseInitStructure.TIM_ClockDivision=TIM_CKD_DIV1;
+	TIM_TimeBaseInitStructure.TIM_CounterMode=TIM_CounterMode_Up;
+	TIM_TimeBaseInit(TIM6,&TIM_TimeBaseInitStructure);
+	TIM_Cmd(TIM6, ENABLE);
+}
+
+
 void TIM7_Int_Init(u16 pre,u16 psc)
 {	
 	NVIC_InitTypeDef NVIC_InitStructure;
@@ -158,6 +174,7 @@ void TIM7_IRQHandler(void)
 	if (TIM_GetITStatus(TIM7, TIM_IT_Update) != RESET)//Ǹж
 	{	 			   
 		USART3_RX_STA|=1<<15;	//ǽ
+		EvQ_Post(EV_BT_FRAME,USART3_RX_STA&0x7FFF);
 		TIM_ClearITPendingBit(TIM7, TIM_IT_Update);  //TIM7жϱ־    
 		TIM_Cmd(TIM7, DISABLE);  //رTIM7 
 	}	    
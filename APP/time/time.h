@@ -8,4 +8,7 @@ void TIM4_Init(u16 per,u16 psc);
 void TIM3_Init(u16 per,u16 psc);
 void TIM5_Init(u16 per,u16 psc);
 void TIM7_Int_Init(u16 pre,u16 psc);
+void TIM6_Init(void);
+
+#define TIM6_US()	((u16)TIM6->CNT)	//1us16λʱ,65.5ms,ζõ
 #endif
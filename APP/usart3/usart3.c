@@ -4,6 +4,7 @@
 #include "stdio.h"	 	 
 #include "string.h"	 
 #include "time.h"
+#include "evq.h"
 
 
 //串口接收缓存区 	
@@ -38,6 +39,7 @@ void USART3_IRQHandler(void)
 			}else 
 			{
 				USART3_RX_STA|=1<<15;				//强制标记接收完成
+				EvQ_Post(EV_BT_FRAME,USART3_RX_STA&0x7FFF);
 			} 
 		}
 	}  				 											 
@@ -96,7 +98,7 @@ void USART3_Init(u32 bound)
 
 //串口3,printf 函数
 //确保一次发送数据不超过USART3_MAX_SEND_LEN字节
-void u3_printf(char* fmt,...)  
+void u3_printf(const char* fmt,...)  
 {  
 	u16 i,j; 
 	va_list ap; 
@@ -13,7 +13,7 @@ extern u8  USART3_TX_BUF[USART3_MAX_SEND_LEN]; 		//
 extern vu16 USART3_RX_STA;   						//״̬
 
 void USART3_Init(u32 bound);				//2ʼ 
-void u3_printf(char* fmt,...);
+void u3_printf(const char* fmt,...);
 #endif
 
 
@@ -2,53 +2,173 @@
 
 static u8  fac_us=0;							//usʱ			   
 static u16 fac_ms=0;							//msʱ
+static u8  fac_cyc=0;							//ÿusCPU
+static u32 fac_sleep=0;							//SysTick_Sleepһ˯ߵĺ
 
+volatile u32 systick_ms=0;						//ϵĺ,SysTickже
+static volatile u32 systick_ms_hi=0;			//systick_msƴ,systick_ms64λ
 
-//ʼӳٺ
-//SYSTICKʱӹ̶ΪAHBʱӵ1/8
-//SYSCLK:ϵͳʱƵ
+//DWTڼ,CMSISͷļûDWTĶ
+#define DWT_CTRL		(*(volatile u32 *)0xE0001000)
+#define DWT_CYCCNT		(*(volatile u32 *)0xE0001004)
+#define DWT_CTRL_CYCCNTENA	(1<<0)
+
+
+//ʼӳٺ1msʱ
+//SYSTICKʱӹ̶ΪAHBʱӵ1/8,ÿ1msжһ,һֱ
+//ʱʹDWTڼ,ĶSysTick,жеҲӰʱ
+//SYSCLK:ϵͳʱƵ(MHz)
 void SysTick_Init(u8 SYSCLK)
 {
 	SysTick_CLKSourceConfig(SysTick_CLKSource_HCLK_Div8); 
 	fac_us=SYSCLK/8;					
 	fac_ms=(u16)fac_us*1000;				   
+	fac_cyc=SYSCLK;
+	fac_sleep=(SysTick_LOAD_RELOAD_Msk-fac_ms)/fac_ms;
+	CoreDebug->DEMCR|=CoreDebug_DEMCR_TRCENA_Msk;	//ʹDWT
+	DWT_CYCCNT=0;
+	DWT_CTRL|=DWT_CTRL_CYCCNTENA;
+	SysTick->LOAD=fac_ms-1;						//1msжһ
+	SysTick->VAL=0x00;
+	NVIC_SetPriority(SysTick_IRQn,(1<<__NVIC_PRIO_BITS)-1);	//ȼ
+	SysTick->CTRL|=SysTick_CTRL_TICKINT_Msk|SysTick_CTRL_ENABLE_Msk;
 }								    
 
+//1msʱж
+void SysTick_Handler(void)
+{
+	SysTick->LOAD=fac_ms-1;						//SysTick_Sleepһڲ1ms,ָ֮
+	if(++systick_ms==0)systick_ms_hi++;
+}
+
+//n,SysTick_SleepSTOPģʽѺֹͣڼʱ
+void SysTick_Add(u32 n)
+{
+	u32 ms=systick_ms;
+
+	systick_ms=ms+n;
+	if(systick_ms<ms)systick_ms_hi++;
+}
+
+//ֵ:ϵĺ
+u32 SysTick_Ms(void)
+{
+	return systick_ms;
+}
+
+//ֵ:ϵĺ,64λ,
+u64 SysTick_Ms64(void)
+{
+	u32 hi,lo;
+
+	do
+	{
+		hi=systick_ms_hi;
+		lo=systick_ms;
+	}while(hi!=systick_ms_hi);					//ڼ32λ,ض
+	return ((u64)hi<<32)|lo;
+}
+
+//ֵ:ϵ΢,Լ71ӻһ
+u32 SysTick_Us(void)
+{
+	u32 ms,val;
+
+	do
+	{
+		ms=systick_ms;
+		val=SysTick->VAL;
+	}while(ms!=systick_ms);						//ڼ䷢ж,ض
+	if((SCB->ICSR&SCB_ICSR_PENDSTSET_Msk)&&val>fac_ms/2)ms++;	//ѻƵжϻûִ(ڸȼже)
+	return ms*1000+(fac_ms-1-val)/fac_us;
+}
+
+
+//tickless˯:ͣ1msж,SysTickĳms,WFIȴ,
+//󰴼߹ĽĲϺ,һжԭĺ߽
+//ڹж(PRIMASK)ʱ,жϹʱWFI,жڿжϺִ
+//ms:˯ߵĺ,fac_sleepfac_sleep(9MHzʱ1863ms)
+//ֵ:ʵ˯ߵ΢
+u32 SysTick_Sleep(u32 ms)
+{
+	u32 val,load,now,done,n,rem;
+
+	if(ms==0)return 0;
+	if(ms>fac_sleep)ms=fac_sleep;
+	SysTick->CTRL&=~SysTick_CTRL_ENABLE_Msk;	//ֹͣ
+	if(SCB->ICSR&SCB_ICSR_PENDSTSET_Msk)		//һĵȴ,˯
+	{
+		SysTick->CTRL|=SysTick_CTRL_ENABLE_Msk;
+		return 0;
+	}
+	val=SysTick->VAL;							//ʣĽ
+	if(val==0)val=fac_ms;
+	load=val+(ms-1)*fac_ms;						//ms߽Ľ
+	if(load<2)									//LOADΪ0ʱж,Ͼ͵,˯
+	{
+		SysTick->CTRL|=SysTick_CTRL_ENABLE_Msk;
+		return 0;
+	}
+	SysTick->LOAD=load-1;
+	SysTick->VAL=0;
+	SysTick->CTRL|=SysTick_CTRL_ENABLE_Msk;
+	__WFI();
+	SysTick->CTRL&=~SysTick_CTRL_ENABLE_Msk;
+	if(SCB->ICSR&SCB_ICSR_PENDSTSET_Msk)		//˯,1msжϼ
+	{
+		done=load;
+		n=ms-1;
+		rem=fac_ms;
+	}
+	else										//жϻ
+	{
+		now=SysTick->VAL;
+		done=now?load-now:0;
+		if(done<val)
+		{
+			n=0;
+			rem=val-done;
+		}
+		else
+		{
+			n=1+(done-val)/fac_ms;
+			rem=fac_ms-(done-val)%fac_ms;
+		}
+		if(rem<2)								//ֻ1,ѹ߽
+		{
+			n++;
+			rem+=fac_ms;
+		}
+	}
+	SysTick_Add(n);
+	SysTick->LOAD=rem-1;						//һжڱʱ,жлָ1ms
+	SysTick->VAL=0;
+	SysTick->CTRL|=SysTick_CTRL_ENABLE_Msk;
+	return done/fac_us;
+}
+
+//STOPģʽѺָ1msʱ
+//ms:ֹͣڼ侭ĺ,RTC
+void SysTick_Resume(u32 ms)
+{
+	SysTick_Add(ms);
+	SysTick->LOAD=fac_ms-1;
+	SysTick->VAL=0;
+	SysTick->CTRL|=SysTick_CTRL_TICKINT_Msk|SysTick_CTRL_ENABLE_Msk;
+}
 
 //ʱnus
-//nusΪҪʱus.		    								   
+//DWTڼʱ,же,nus59(72MHz)
 void delay_us(u32 nus)
 {		
-	u32 temp;	    	 
-	SysTick->LOAD=nus*fac_us; 					//ʱ	  		 
-	SysTick->VAL=0x00;        					//ռ
-	SysTick->CTRL|=SysTick_CTRL_ENABLE_Msk ;	//ʼ	  
-	do
-	{
-		temp=SysTick->CTRL;
-	}while((temp&0x01)&&!(temp&(1<<16)));		//ȴʱ䵽   
-	SysTick->CTRL&=~SysTick_CTRL_ENABLE_Msk;	//رռ
-	SysTick->VAL =0X00;      					 //ռ	 
+	u32 start=DWT_CYCCNT;
+	u32 cycles=nus*fac_cyc;
+
+	while(DWT_CYCCNT-start<cycles);
 }
 
 //ʱnms
-//עnmsķΧ
-//SysTick->LOADΪ24λĴ,,ʱΪ:
-//nms<=0xffffff*8*1000/SYSCLK
-//SYSCLKλΪHz,nmsλΪms
-//72M,nms<=1864 
 void delay_ms(u16 nms)
 {	 		  	  
-	u32 temp;		   
-	SysTick->LOAD=(u32)nms*fac_ms;				//ʱ(SysTick->LOADΪ24bit)
-	SysTick->VAL =0x00;							//ռ
-	SysTick->CTRL|=SysTick_CTRL_ENABLE_Msk ;	//ʼ  
-	do
-	{
-		temp=SysTick->CTRL;
-	}while((temp&0x01)&&!(temp&(1<<16)));		//ȴʱ䵽   
-	SysTick->CTRL&=~SysTick_CTRL_ENABLE_Msk;	//رռ
-	SysTick->VAL =0X00;       					//ռ	  	    
+	while(nms--)delay_us(1000);
 } 
-
-
@@ -3,7 +3,17 @@
 
 #include "system.h"
 
+typedef uint64_t u64;
+
+extern volatile u32 systick_ms;
+
 void SysTick_Init(u8 SYSCLK);
+u32 SysTick_Ms(void);
+u64 SysTick_Ms64(void);
+u32 SysTick_Us(void);
+void SysTick_Add(u32 n);
+u32 SysTick_Sleep(u32 ms);
+void SysTick_Resume(u32 ms);
 void delay_ms(u16 nms);
 void delay_us(u32 nus);
 
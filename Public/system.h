@@ -9,7 +9,7 @@
 //ʵ˼,ο<<CM3Ȩָ>>(87ҳ~92ҳ).
 //IOڲ궨
 #define BITBAND(addr, bitnum) ((addr & 0xF0000000)+0x2000000+((addr &0xFFFFF)<<5)+(bitnum<<2)) 
-#define MEM_ADDR(addr)  *((volatile unsigned long  *)(addr)) 
+#define MEM_ADDR(addr)  *((volatile uint32_t *)(addr))	//λ32λ,ϲʱunsigned long64λ
 #define BIT_ADDR(addr, bitnum)   MEM_ADDR(BITBAND(addr, bitnum)) 
 //IOڵַӳ
 #define GPIOA_ODR_Addr    (GPIOA_BASE+12) //0x4001080C 
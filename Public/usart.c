@@ -1,7 +1,10 @@
 #include "usart.h"		 
 
+u8 USART1_TX_MUTE=0;
+
 int fputc(int ch,FILE *p)  //ĬϵģʹprintfʱԶ
 {
+	if(USART1_TX_MUTE)return ch;
 	USART_SendData(USART1,(u8)ch);	
 	while(USART_GetFlagStatus(USART1,USART_FLAG_TXE)==RESET);
 	return ch;
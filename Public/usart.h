@@ -8,6 +8,7 @@
 
 extern u8  USART1_RX_BUF[USART1_REC_LEN]; //ջ,USART_REC_LENֽ.ĩֽΪз 
 extern u16 USART1_RX_STA;         		//״̬
+extern u8  USART1_TX_MUTE;					//1:printf,DMAռô1ʱλ
 
 
 void USART1_Init(u32 bound);
@@ -3,6 +3,14 @@
 #include "led.h"
 #include "usart.h"
 #include "tftlcd.h"
+#include "lcd_dirty.h"
+#include "lcd_prof.h"
+#include "lcd_console.h"
+#include "lcd_shot.h"
+#include "sched.h"
+#include "swtimer.h"
+#include "evq.h"
+#include "power.h"
 #include "time.h"
 #include "key.h"
 #include "rtc.h"
@@ -17,6 +25,7 @@
 #include "misc.h"
 #include "stm32f10x_adc.h" // 添加ADC支持
 #include "lsens.h"
+#include "ldet.h"
 #include "hwjs.h"
 #include "ws2812.h" // 彩灯模块
 #include "pwm.h"    // 电机PWM模块
@@ -37,6 +46,7 @@
 #define BT_CMD_STATUS "STATUS"
 #define BT_CMD_MED_CHECK "MED_CHECK"
 #define BT_CMD_ENV_CHECK "ENV_CHECK"
+#define BT_CMD_SHOT "SHOT" // 截屏，压缩数据从串口1发出
 
 // 红外遥控按键编码
 #define IR_KEYa 0x00FFA25D // 按键开关的编码
@@ -91,18 +101,59 @@ Medicine medicines[] = {
     {"Anti_drugs", 12, 30, 0},
     {"Calcium_tablets", 19, 0, 0}};
 
-// 光敏传感器计数器(用于检测取药动作)
-u32 light_sensor_count = 0;
-u16 light_base_value = 0;  // 基准光强值
-u16 light_threshold = 100; // 光强变化阈值
-u16 current_light_value = 0;
+// 光敏取药动作检测
+_ldet light_det;
 
 // 全局变量声明
 u8 last_screen = 0xFF;         // 上一次显示的屏幕
 u8 last_state = 0xFF;          // 上一次的系统状态
-u8 last_minute_display = 0xFF; // 上一次显示更新的分钟数
 u8 force_refresh = 1;          // 强制刷新标志
 
+// 界面上的一个文本字段
+// 绘制函数只根据字段内容绘图，字段记住上一次显示的内容，
+// 界面已显示时内容变化只重绘发生变化的字符格，其余情况把新旧文字占用的区域标记为脏
+typedef struct
+{
+    u16 x, y;               // LCD_ShowString的起点
+    u16 width, height;      // LCD_ShowString的区域大小
+    u8 size;                // 字体大小
+    u16 color;              // 文字颜色
+    char text[40];          // 当前显示的内容
+    u16 back;               // 上一次绘制时的背景色
+    void (*owner)(void);    // 上一次绘制该字段的界面绘制函数
+} UiField;
+
+// 当前界面的绘制函数，每轮主循环末尾由LCD_Dirty_Flush在脏区域内调用
+void (*screen_paint)(void) = 0;
+u8 screen_drawn = 0; // 当前界面已完整绘制到屏幕上
+
+// 主界面字段
+UiField home_time = {50, 50, 200, 30, 16, BLACK, "", WHITE, 0};
+UiField home_next = {30, 80, 200, 30, 16, BLACK, "", WHITE, 0};
+UiField home_env = {80, 110, 200, 30, 16, GREEN, "", WHITE, 0};
+UiField home_role = {10, 140, 200, 16, 16, BLUE, "", WHITE, 0};
+UiField home_sta = {110, 140, 120, 16, 16, BLUE, "", WHITE, 0};
+UiField home_send = {50, 160, 180, 16, 16, BLACK, "", WHITE, 0};
+UiField home_recv = {80, 180, 160, 16, 16, BLACK, "", WHITE, 0};
+
+// 药物信息界面字段
+UiField med_lines[sizeof(medicines) / sizeof(Medicine)];
+
+// 环境信息界面字段
+UiField env_temp = {80, 60, 200, 30, 24, BLACK, "", WHITE, 0};
+UiField env_humi = {80, 90, 200, 30, 24, BLACK, "", WHITE, 0};
+UiField env_light = {80, 120, 200, 30, 24, BLACK, "", WHITE, 0};
+UiField env_status = {60, 150, 200, 30, 24, BLACK, "", WHITE, 0};
+UiField env_hint = {30, 180, 200, 30, 16, BLACK, "", WHITE, 0};
+
+// 警报界面字段
+UiField alarm_name = {150, 100, 200, 30, 24, BLACK, "", WHITE, 0};
+UiField alarm_sched = {200, 140, 200, 30, 24, BLACK, "", WHITE, 0};
+UiField alarm_now = {180, 180, 200, 30, 24, BLACK, "", WHITE, 0};
+UiField taken_info = {40, 150, 240, 30, 24, BLACK, "", WHITE, 0};
+UiField env_alert_msg = {50, 100, 240, 30, 24, WHITE, "", WHITE, 0};
+UiField env_alert_time = {50, 140, 240, 30, 24, WHITE, "", WHITE, 0};
+
 // 蓝牙相关外部变量声明
 extern u8 USART3_RX_BUF[USART3_MAX_RECV_LEN];
 extern vu16 USART3_RX_STA;
@@ -111,9 +162,14 @@ extern vu16 USART3_RX_STA;
 u8 bt_send_mask = 0; // 蓝牙发送状态标志
 u8 bt_send_cnt = 0;  // 蓝牙发送计数器
 
+// 蓝牙接收超时
+#define BT_RX_TIMEOUT_MS 100 // 数据长度这么久没有变化认为接收完成
+_swtimer bt_rx_timer;        // 蓝牙接收超时定时器
+u16 bt_rx_len = 0;           // 上一次检查时的接收长度
+
 // 彩灯和电机控制变量
 u8 medicine_box_active = 0; // 当前活跃的药盒编号(1-9)
-u32 event_timer = 0;        // 事件总计时器
+_swtimer event_timer;       // 药盒事件阶段定时器
 u8 event_active = 0;        // 事件是否正在执行（防止误操作）
 u8 fan_running = 0;         // 风扇运行状态
 u8 led_showing = 0;         // 彩灯显示状态
@@ -122,6 +178,8 @@ u8 led_showing = 0;         // 彩灯显示状态
 #define EVENT_STAGE_WAITING 1  // 等待阶段（0.5秒）
 #define EVENT_STAGE_RUNNING 2  // 风扇运转阶段（3秒）
 #define EVENT_STAGE_COMPLETE 3 // 事件完成
+#define EVENT_WAIT_MS 500      // 等待阶段时长
+#define EVENT_RUN_MS 3000      // 风扇运转时长
 u8 event_stage = 0;            // 当前事件阶段
 
 // 函数声明
@@ -129,6 +187,9 @@ void show_home_screen(void);
 void show_medication_screen(void);
 void show_environment_screen(void);
 void show_alert_screen(u8 alert_type);
+void ui_field_set(UiField *f, const char *text, u16 color);
+void ui_field_draw(UiField *f);
+void ui_flush(void);
 void bluetooth_data_process(void);     // 蓝牙数据处理函数
 void bluetooth_cmd_handler(char *cmd); // 蓝牙命令处理函数
 void Bluetooth_Send(const char *msg);
@@ -136,9 +197,7 @@ void send_device_status(void);           // 发送设备状态函数
 void simple_bluetooth_test(void);        // 简单蓝牙测试函数
 void HC05_Role_Show(void);               // 显示HC05主从状态
 void HC05_Sta_Show(void);                // 显示HC05连接状态
-u16 Read_Light_Sensor(void);             // 读取光敏传感器值
-void update_light_threshold(void);       // 更新光强阈值
-void process_medicine_box_control(void); // 处理药盒控制逻辑
+void medicine_box_fan_start(void);       // 药盒等待阶段结束，启动风扇
 void start_medicine_box(u8 box_number);  // 启动指定药盒
 void stop_medicine_box(void);            // 停止药盒操作
 
@@ -157,96 +216,46 @@ void system_init(void)
     system_state.light_intensity = 0; // 光照强度初始化为0
 }
 
-// 读取光敏传感器值
-u16 Read_Light_Sensor(void)
-{
-    while (ADC_GetFlagStatus(ADC1, ADC_FLAG_EOC) == RESET)
-        ;
-    return ADC_GetConversionValue(ADC1);
-}
+// 蓝牙命令的副本，三种接收方法共用，都在主循环中调用；不放在栈上（启动文件中栈共2KB）
+static char recv_data[USART3_MAX_RECV_LEN + 1];
 
-// 更新光强阈值
-void update_light_threshold(void)
+// 蓝牙接收超时：数据长度一段时间没有变化，认为接收完成（方法2）
+void bluetooth_rx_timeout(void)
 {
-    static u16 light_values[10];
-    static u8 index = 0;
-    u32 sum = 0;
-    u32 avg = 0;
-    u32 variance = 0;
+    u16 len = USART3_RX_STA & 0x7FFF;
     u8 i;
 
-    // 保存当前值
-    light_values[index] = current_light_value;
-    index = (index + 1) % 10;
-
-    // 计算平均值
-    for (i = 0; i < 10; i++)
-    {
-        sum += light_values[i];
-    }
-    avg = sum / 10;
+    if ((USART3_RX_STA & (1 << 15)) || len == 0 || len != bt_rx_len)
+        return;
 
-    // 计算方差
-    for (i = 0; i < 10; i++)
+    // 查找换行符位置，确保命令完整
+    for (i = 0; i < len; i++)
     {
-        variance += (light_values[i] - avg) * (light_values[i] - avg);
-    }
-    variance /= 10;
-
-    // 设置阈值为标准差的2.5倍
-    light_threshold = (u16)(2.5 * sqrt(variance));
+        if (USART3_RX_BUF[i] == '\r' || USART3_RX_BUF[i] == '\n')
+        {
+            // 找到换行符，处理数据
+            memcpy(recv_data, USART3_RX_BUF, i);
+            recv_data[i] = '\0';
 
-    // 确保阈值在合理范围内
-    if (light_threshold < 50)
-        light_threshold = 50;
-    if (light_threshold > 500)
-        light_threshold = 500;
-}
+            if (i > 0) // 确保不是空命令
+            {
+                printf("BT Received (Method2): %s\r\n", recv_data);
+                bluetooth_cmd_handler(recv_data);
+            }
 
-// 处理红外遥控器输入
-void Process_IR_Command(void)
-{
-    char buf[32]; // 将变量声明移到函数开头
-
-    if (hw_jsbz)
-    {                                          // 有红外数据接收到
-        printf("IR Code: 0x%08X\r\n", hw_jsm); // 打印接收到的红外代码
-
-        // 根据红外代码控制LED2
-        if (hw_jsm == IR_KEY1)
-        {             // 按键1
-            LED2 = 0; // 开LED2
-            printf("IR Key 1: LED2 ON\r\n");
-
-            // 更新显示
-            LCD_Fill(10, 320, 220, 336, WHITE);
-            sprintf(buf, "LED2: %s", LED2 ? "OFF" : "ON");
-            LCD_ShowString(10, 320, 220, 16, 16, (u8 *)buf);
-        }
-        else if (hw_jsm == IR_KEY2)
-        {             // 按键2
-            LED2 = 1; // 关LED2
-            printf("IR Key 2: LED2 OFF\r\n");
-
-            // 更新显示
-            LCD_Fill(10, 320, 220, 336, WHITE);
-            sprintf(buf, "LED2: %s", LED2 ? "OFF" : "ON");
-            LCD_ShowString(10, 320, 220, 16, 16, (u8 *)buf);
+            // 清除接收标志和缓冲区
+            USART3_RX_STA = 0;
+            memset(USART3_RX_BUF, 0, USART3_MAX_RECV_LEN);
+            bt_rx_len = 0;
+            break;
         }
-
-        hw_jsbz = 0; // 处理完成，清除标志
     }
 }
 
 // 蓝牙数据处理函数
 void bluetooth_data_process(void)
 {
-    static u32 check_counter = 0;
-    static u16 last_rx_len = 0;
     u16 len;
-    char recv_data[USART3_MAX_RECV_LEN];
-
-    check_counter++; // 简单计数器，每次调用递增
 
     // 检查是否接收到一帧完整数据（方法1：检查完成标志）
     if (USART3_RX_STA & (1 << 15)) // 接收到一帧数据
@@ -266,46 +275,20 @@ void bluetooth_data_process(void)
         // 清除接收标志和缓冲区
         USART3_RX_STA = 0;
         memset(USART3_RX_BUF, 0, USART3_MAX_RECV_LEN);
-        last_rx_len = 0;
+        SwTimer_Stop(&bt_rx_timer);
+        bt_rx_len = 0;
+        return;
     }
-    // 方法2：检查数据长度变化和超时（备用方案）
-    else if ((USART3_RX_STA & 0x7FFF) > 0) // 有数据但未完成
-    {
-        len = USART3_RX_STA & 0x7FFF;
-
-        // 如果数据长度变化，重置计数器
-        if (len != last_rx_len)
-        {
-            check_counter = 0;
-            last_rx_len = len;
-        }
-        // 如果数据长度超过500次检查没有变化，认为接收完成（约50ms，因为主循环100ms调用一次）
-        else if (len > 0 && check_counter > 5)
-        {
-            // 查找换行符位置，确保命令完整
-            u8 i;
-            for (i = 0; i < len; i++)
-            {
-                if (USART3_RX_BUF[i] == '\r' || USART3_RX_BUF[i] == '\n')
-                {
-                    // 找到换行符，处理数据
-                    memcpy(recv_data, USART3_RX_BUF, i);
-                    recv_data[i] = '\0';
 
-                    if (i > 0) // 确保不是空命令
-                    {
-                        printf("BT Received (Method2): %s\r\n", recv_data);
-                        bluetooth_cmd_handler(recv_data);
-                    }
-
-                    // 清除接收标志和缓冲区
-                    USART3_RX_STA = 0;
-                    memset(USART3_RX_BUF, 0, USART3_MAX_RECV_LEN);
-                    last_rx_len = 0;
-                    break;
-                }
-            }
-        }
+    // 方法2：数据长度变化时重新开始超时计时，超时后由bluetooth_rx_timeout处理
+    len = USART3_RX_STA & 0x7FFF;
+    if (len != bt_rx_len)
+    {
+        bt_rx_len = len;
+        if (len > 0)
+            SwTimer_Start(&bt_rx_timer, BT_RX_TIMEOUT_MS, 0, bluetooth_rx_timeout);
+        else
+            SwTimer_Stop(&bt_rx_timer);
     }
 }
 
@@ -325,6 +308,7 @@ void bluetooth_cmd_handler(char *cmd)
         }
         p++;
     }
+    LCD_Console_Printf("%02d:%02d BT: %.32s\n", calendar.hour, calendar.min, cmd);
 
     // LED1控制命令
     if (strcmp(cmd, BT_CMD_LED1_ON) == 0)
@@ -397,6 +381,11 @@ void bluetooth_cmd_handler(char *cmd)
         Bluetooth_Send(response);
         printf("ENVIRONMENT CHECK\r\n"); // 串口调试输出
     }
+    // 截屏命令，数据由task_input分批从串口1发出
+    else if (strcmp(cmd, BT_CMD_SHOT) == 0)
+    {
+        Bluetooth_Send(LCD_Shot_Start() ? "SHOT_OK" : "SHOT_BUSY");
+    }
     // 兼容原始格式的LED2控制命令
     else if (strcmp(cmd, "+LED2 ON") == 0)
     {
@@ -456,12 +445,11 @@ void simple_bluetooth_test(void)
             {
                 if (i > 0) // 确保命令不为空
                 {
-                    char cmd[USART3_MAX_RECV_LEN];
-                    memcpy(cmd, USART3_RX_BUF, i);
-                    cmd[i] = '\0';
+                    memcpy(recv_data, USART3_RX_BUF, i);
+                    recv_data[i] = '\0';
 
-                    printf("Simple BT Test - Received: %s\r\n", cmd);
-                    bluetooth_cmd_handler(cmd);
+                    printf("Simple BT Test - Received: %s\r\n", recv_data);
+                    bluetooth_cmd_handler(recv_data);
                 }
 
                 // 清除缓冲区
@@ -478,11 +466,11 @@ void HC05_Role_Show(void)
 {
     if (HC05_Get_Role() == 1)
     {
-        LCD_ShowString(10, 140, 200, 16, 16, (u8 *)"ROLE:Master"); // 主机
+        ui_field_set(&home_role, "ROLE:Master", BLUE); // 主机
     }
     else
     {
-        LCD_ShowString(10, 140, 200, 16, 16, (u8 *)"ROLE:Slave "); // 从机
+        ui_field_set(&home_role, "ROLE:Slave ", BLUE); // 从机
     }
 }
 
@@ -491,11 +479,11 @@ void HC05_Sta_Show(void)
 {
     if (HC05_LED)
     {
-        LCD_ShowString(110, 140, 120, 16, 16, (u8 *)"STA:Connected "); // 连接成功
+        ui_field_set(&home_sta, "STA:Connected ", BLUE); // 连接成功
     }
     else
     {
-        LCD_ShowString(110, 140, 120, 16, 16, (u8 *)"STA:Disconnect"); // 未连接
+        ui_field_set(&home_sta, "STA:Disconnect", BLUE); // 未连接
     }
 }
 
@@ -511,6 +499,8 @@ void check_medication_time(void)
             current_hour == medicines[i].hour &&
             current_minute == medicines[i].minute)
         {
+            if (system_state.current_state != STATE_ALARM)
+                LCD_Console_Printf("%02d:%02d Alarm: %s\n", current_hour, current_minute, medicines[i].name);
             system_state.next_med_index = i;
             system_state.current_state = STATE_ALARM;
             break;
@@ -521,186 +511,399 @@ void check_medication_time(void)
 // 检查环境状态函数
 void check_environment(void)
 {
-    u8 temp = 0, humi = 0;
-    if (DHT11_Read_Data(&temp, &humi) == 0)
+    DHT11_Start(); // 结果由EV_DHT11事件送到update_environment
+}
+
+// 温湿度测量结束，arg为状态<<16|温度<<8|湿度
+void update_environment(u32 arg)
+{
+    u8 temp = (arg >> 8) & 0xFF, humi = arg & 0xFF;
+    if ((arg >> 16) != DHT11_OK)
     {
-        system_state.temperature = temp;
-        system_state.humidity = humi;
-        if (system_state.temperature > 30.0 || system_state.temperature < 10.0 ||
-            system_state.humidity > 70.0)
-        {
-            system_state.env_alert = 1;
-            system_state.current_state = STATE_ENV_ALERT;
-        }
-        else
-        {
-            system_state.env_alert = 0;
-        }
+        printf("DHT11 read failed: %d\r\n", (int)(arg >> 16));
+        return;
+    }
+    system_state.temperature = temp;
+    system_state.humidity = humi;
+    if (system_state.temperature > 30.0 || system_state.temperature < 10.0 ||
+        system_state.humidity > 70.0)
+    {
+        if (!system_state.env_alert)
+            LCD_Console_Printf("%02d:%02d Env: %dC %d%%\n", calendar.hour, calendar.min, temp, humi);
+        system_state.env_alert = 1;
+        system_state.current_state = STATE_ENV_ALERT;
+    }
+    else
+    {
+        system_state.env_alert = 0;
     }
 }
 
-// 处理服药逻辑函数
+// 处理服药逻辑函数，光敏检测到取药动作时调用
 void handle_medication(void)
 {
-    // 检测到多次光敏传感器触发(表示取药动作)
     char msg[64];
-    if (light_sensor_count >= 3)
+    if (system_state.current_state == STATE_ALARM)
     {
         medicines[system_state.next_med_index].taken = 1;
         system_state.current_state = STATE_MED_TAKEN;
-        light_sensor_count = 0;
-
-        // 更新基准光强值
-        light_base_value = current_light_value;
 
         // 发送蓝牙消息通知手机端
         sprintf(msg, "MED_TAKEN:%s,%02d:%02d",
                 medicines[system_state.next_med_index].name,
                 calendar.hour, calendar.min);
         Bluetooth_Send(msg);
+        LCD_Console_Printf("%02d:%02d Taken: %s\n", calendar.hour, calendar.min,
+                           medicines[system_state.next_med_index].name);
+    }
+}
+
+// 计算字段文字在显示区域内实际占用的宽高（与LCD_ShowString的换行规则一致）
+void ui_text_extent(UiField *f, const char *text, u16 *w, u16 *h)
+{
+    u16 cw = f->size / 2;
+    u16 len = strlen(text);
+    u16 per_line;
+    u16 lines;
+
+    *w = 0;
+    *h = 0;
+    if (len == 0 || cw == 0)
+        return;
+    per_line = (f->width + cw - 1) / cw; // 每行能放下的字符数
+    lines = (len + per_line - 1) / per_line;
+    if (lines > (f->height + f->size - 1) / f->size)
+        lines = (f->height + f->size - 1) / f->size;
+    *w = (len < per_line ? len : per_line) * cw;
+    *h = lines * f->size;
+}
+
+// 直接重绘字段第start到end-1个字符格，不预先清屏
+// 新内容中的字符以不叠加方式写出（同时写背景），超出新内容长度的格子用背景色填充
+void ui_field_cells(UiField *f, u16 start, u16 end)
+{
+    char run[sizeof(f->text)];
+    u16 cw = f->size / 2;
+    u16 len = strlen(f->text);
+    u16 n;
+
+    if (start < len)
+    {
+        n = (end < len ? end : len) - start;
+        memcpy(run, f->text + start, n);
+        run[n] = '\0';
+        FRONT_COLOR = f->color;
+        BACK_COLOR = f->back;
+        LCD_ShowString(f->x + start * cw, f->y, n * cw, f->size, f->size, (u8 *)run);
+        start += n;
+    }
+    if (start < end)
+        LCD_Fill(f->x + start * cw, f->y, f->x + end * cw - 1, f->y + f->size - 1, f->back);
+}
+
+// 更新字段内容
+// 字段所在界面已显示且新旧内容都只占一行时，逐字符比较，只重绘变化的字符格；
+// 否则把新旧文字占用的区域标记为脏，由界面绘制函数重绘
+void ui_field_set(UiField *f, const char *text, u16 color)
+{
+    char old[sizeof(f->text)];
+    u16 old_w, old_h, new_w, new_h;
+    u16 cw = f->size / 2;
+    u16 old_len, new_len, n, i, start;
+    u8 recolor;
+
+    if (f->color == color && strncmp(f->text, text, sizeof(f->text) - 1) == 0)
+        return;
+    strcpy(old, f->text);
+    recolor = f->color != color;
+    strncpy(f->text, text, sizeof(f->text) - 1);
+    f->text[sizeof(f->text) - 1] = '\0';
+    f->color = color;
+    ui_text_extent(f, old, &old_w, &old_h);
+    ui_text_extent(f, f->text, &new_w, &new_h);
+
+    if (screen_drawn && f->owner == screen_paint && old_h <= f->size && new_h <= f->size)
+    {
+        old_len = old_w / cw;
+        new_len = new_w / cw;
+        n = old_len > new_len ? old_len : new_len;
+        i = 0;
+        while (i < n)
+        {
+            if (!recolor && i < old_len && i < new_len && old[i] == f->text[i])
+            {
+                i++;
+                continue;
+            }
+            start = i;
+            while (i < n && (recolor || i >= old_len || i >= new_len || old[i] != f->text[i]))
+                i++;
+            ui_field_cells(f, start, i);
+        }
+        return;
     }
+
+    if (new_w < old_w)
+        new_w = old_w;
+    if (new_h < old_h)
+        new_h = old_h;
+    if (new_w && new_h)
+        LCD_Dirty_Add(f->x, f->y, f->x + new_w - 1, f->y + new_h - 1);
+}
+
+// 绘制字段，背景色由所在界面的绘制函数设置
+void ui_field_draw(UiField *f)
+{
+    f->back = BACK_COLOR;
+    f->owner = screen_paint;
+    FRONT_COLOR = f->color;
+    LCD_ShowString(f->x, f->y, f->width, f->height, f->size, (u8 *)f->text);
+}
+
+// 切换到新界面：整屏标记为脏，由新界面的绘制函数重绘
+void ui_enter_screen(void (*paint)(void))
+{
+    screen_paint = paint;
+    screen_drawn = 0;
+    LCD_Console_Detach(); // 日志只在主界面显示，由主界面绘制函数重新接上
+    LCD_Dirty_All();
+}
+
+// 重绘本轮所有脏区域，之后当前界面已完整显示，字段可以直接按字符更新
+void ui_flush(void)
+{
+    LCD_Dirty_Flush(screen_paint);
+    screen_drawn = 1;
+}
+
+// 主界面绘制函数
+void paint_home_screen(void)
+{
+    LCD_Clear(WHITE);
+    BACK_COLOR = WHITE;
+    FRONT_COLOR = BLUE;
+    LCD_ShowString(60, 10, 200, 30, 24, (u8 *)"Medicine Box");
+    LCD_ShowString(10, 160, 200, 16, 16, (u8 *)"Send:");
+    LCD_ShowString(10, 180, 200, 16, 16, (u8 *)"Receive:");
+
+    FRONT_COLOR = BLACK;
+    LCD_ShowString(20, 200, 200, 16, 16, (u8 *)"KEY0:Medicine KEY1:Env");
+    LCD_ShowString(20, 220, 200, 16, 16, (u8 *)"KEY2:Send KEY_UP:Role/Return");
+
+    ui_field_draw(&home_time);
+    ui_field_draw(&home_next);
+    ui_field_draw(&home_env);
+    ui_field_draw(&home_role);
+    ui_field_draw(&home_sta);
+    ui_field_draw(&home_send);
+    ui_field_draw(&home_recv);
+    LCD_Console_Paint();
 }
 
 // 优化显示主界面函数
+// 只更新字段内容，实际绘制由主循环末尾的脏矩形刷新完成
 void show_home_screen(void)
 {
-    char time_str[20];
+    char time_str[24]; // 日历字段取到u16/u8的最大值也放得下
     char med_info[40];
-    char env_status[30];
-    char light_str[20];
-    // 只在需要时清屏和重绘
+
+    // 切换到本界面时整屏重绘
     if (force_refresh || last_screen != 0)
     {
-        LCD_Clear(WHITE);
-        FRONT_COLOR = BLUE;
-        BACK_COLOR = WHITE;
-        LCD_ShowString(60, 10, 200, 30, 24, (u8 *)"Medicine Box");
-
-        FRONT_COLOR = BLACK;
-        LCD_ShowString(20, 200, 200, 16, 16, (u8 *)"KEY0:Medicine KEY1:Env");
-        LCD_ShowString(20, 220, 200, 16, 16, (u8 *)"KEY2:Send KEY_UP:Role/Return");
-
-        // 显示HC05状态信息
-        FRONT_COLOR = BLUE;
-        LCD_ShowString(10, 160, 200, 16, 16, (u8 *)"Send:");
-        LCD_ShowString(10, 180, 200, 16, 16, (u8 *)"Receive:");
+        ui_enter_screen(paint_home_screen);
         HC05_Role_Show();
         HC05_Sta_Show();
-        FRONT_COLOR = BLACK;
-
         last_screen = 0;
+        last_state = 0xFF;
     }
 
-    // 显示光照强度（每次刷新都更新）
+    sprintf(time_str, "%04d-%02d-%02d %02d:%02d", calendar.w_year, calendar.w_month, calendar.w_date, calendar.hour, calendar.min);
+    ui_field_set(&home_time, time_str, BLACK);
 
-    // 只在时间变化时更新时间显示（只在分钟变化时更新）
-    if (force_refresh || last_minute_display != calendar.min)
+    // 下一个服药信息
+    if (system_state.next_med_index < system_state.med_count)
     {
-        sprintf(time_str, "%04d-%02d-%02d %02d:%02d", calendar.w_year, calendar.w_month, calendar.w_date, calendar.hour, calendar.min);
-        // 先清除时间显示区域
-        LCD_Fill(50, 50, 250, 80, WHITE);
-        FRONT_COLOR = BLACK;
-        LCD_ShowString(50, 50, 200, 30, 16, (u8 *)time_str);
-        last_minute_display = calendar.min;
+        sprintf(med_info, "Next: %s %02d:%02d", medicines[system_state.next_med_index].name, medicines[system_state.next_med_index].hour, medicines[system_state.next_med_index].minute);
+        ui_field_set(&home_next, med_info, BLACK);
     }
 
-    // 更新下一个服药信息（只在需要时）
-    if (force_refresh)
-    {
-        if (system_state.next_med_index < system_state.med_count)
-        {
-            sprintf(med_info, "Next: %s %02d:%02d", medicines[system_state.next_med_index].name, medicines[system_state.next_med_index].hour, medicines[system_state.next_med_index].minute);
-            LCD_Fill(30, 80, 230, 110, WHITE);
-            LCD_ShowString(30, 80, 200, 30, 16, (u8 *)med_info);
-        }
+    // 环境状态
+    if (system_state.env_alert)
+        ui_field_set(&home_env, "Env Alert!", RED);
+    else
+        ui_field_set(&home_env, "Env Normal", GREEN);
+}
 
-        // 更新环境状态
-        if (system_state.env_alert)
-        {
-            sprintf(env_status, "Env Alert!");
-            FRONT_COLOR = RED;
-        }
-        else
-        {
-            sprintf(env_status, "Env Normal");
-            FRONT_COLOR = GREEN;
-        }
-        LCD_Fill(80, 110, 180, 140, WHITE);
-        LCD_ShowString(80, 110, 200, 30, 16, (u8 *)env_status);
-        FRONT_COLOR = BLACK;
+// 药物信息界面绘制函数
+void paint_medication_screen(void)
+{
+    u8 i;
+
+    LCD_Clear(LGRAY);
+    BACK_COLOR = LGRAY;
+    FRONT_COLOR = BLUE;
+    LCD_ShowString(80, 10, 200, 30, 24, (u8 *)"Medicine Info");
+    for (i = 0; i < system_state.med_count; i++)
+    {
+        ui_field_draw(&med_lines[i]);
     }
+    FRONT_COLOR = BLACK;
+    LCD_ShowString(20, 260, 200, 30, 16, (u8 *)"KEY_UP: Return");
 }
 
 // 优化药物信息显示函数
 void show_medication_screen(void)
 {
-    u8 y_pos = 50;
     u8 i;
     char med_info[50];
     u8 *status_str;
 
-    // 只在屏幕切换时重新绘制
     if (force_refresh || last_screen != 1)
     {
-        LCD_Clear(LGRAY);
-        FRONT_COLOR = BLUE;
-        BACK_COLOR = LGRAY;
-        LCD_ShowString(80, 10, 200, 30, 24, (u8 *)"Medicine Info");
-
+        ui_enter_screen(paint_medication_screen);
         for (i = 0; i < system_state.med_count; i++)
         {
-            if (medicines[i].taken)
-                status_str = (u8 *)"Taken";
-            else
-                status_str = (u8 *)"Not taken";
-            sprintf(med_info, "%s %02d:%02d %s", medicines[i].name, medicines[i].hour, medicines[i].minute, status_str);
-            FRONT_COLOR = medicines[i].taken ? GREEN : RED;
-            LCD_ShowString(30, y_pos, 200, 30, 16, (u8 *)med_info);
-            y_pos += 30;
+            med_lines[i].x = 30;
+            med_lines[i].y = 50 + i * 30;
+            med_lines[i].width = 200;
+            med_lines[i].height = 30;
+            med_lines[i].size = 16;
         }
-        FRONT_COLOR = BLACK;
-        LCD_ShowString(20, 260, 200, 30, 16, (u8 *)"KEY_UP: Return");
         last_screen = 1;
+        last_state = 0xFF;
+    }
+
+    for (i = 0; i < system_state.med_count; i++)
+    {
+        if (medicines[i].taken)
+            status_str = (u8 *)"Taken";
+        else
+            status_str = (u8 *)"Not taken";
+        sprintf(med_info, "%s %02d:%02d %s", medicines[i].name, medicines[i].hour, medicines[i].minute, status_str);
+        ui_field_set(&med_lines[i], med_info, medicines[i].taken ? GREEN : RED);
     }
 }
 
+// 环境信息界面绘制函数
+void paint_environment_screen(void)
+{
+    LCD_Clear(LGRAY);
+    BACK_COLOR = LGRAY;
+    FRONT_COLOR = BLUE;
+    LCD_ShowString(80, 10, 200, 30, 24, (u8 *)"Env Info");
+
+    ui_field_draw(&env_temp);
+    ui_field_draw(&env_humi);
+    ui_field_draw(&env_light);
+    ui_field_draw(&env_status);
+    ui_field_draw(&env_hint);
+
+    FRONT_COLOR = BLACK;
+    LCD_ShowString(20, 260, 200, 30, 16, (u8 *)"KEY_UP: Return");
+}
+
 // 优化环境信息显示函数
 void show_environment_screen(void)
 {
     char temp_str[20];
     char humi_str[20];
     char light_str[20];
-    // 只在屏幕切换时重新绘制
+
     if (force_refresh || last_screen != 2)
     {
-        LCD_Clear(LGRAY);
-        FRONT_COLOR = BLUE;
-        BACK_COLOR = LGRAY;
-        LCD_ShowString(80, 10, 200, 30, 24, (u8 *)"Env Info");
+        ui_enter_screen(paint_environment_screen);
+        last_screen = 2;
+        last_state = 0xFF;
+    }
 
-        sprintf(temp_str, "Temp: %.1fC", system_state.temperature);
-        sprintf(humi_str, "Humi: %.1f%%", system_state.humidity);
-        sprintf(light_str, "Light: %d%%", system_state.light_intensity);
-        FRONT_COLOR = BLACK;
-        LCD_ShowString(80, 60, 200, 30, 24, (u8 *)temp_str);
-        LCD_ShowString(80, 90, 200, 30, 24, (u8 *)humi_str);
-        LCD_ShowString(80, 120, 200, 30, 24, (u8 *)light_str);
+    sprintf(temp_str, "Temp: %.1fC", system_state.temperature);
+    sprintf(humi_str, "Humi: %.1f%%", system_state.humidity);
+    sprintf(light_str, "Light: %d%%", system_state.light_intensity);
+    ui_field_set(&env_temp, temp_str, BLACK);
+    ui_field_set(&env_humi, humi_str, BLACK);
+    ui_field_set(&env_light, light_str, BLACK);
 
-        if (system_state.env_alert)
-        {
-            LCD_ShowString(60, 150, 200, 30, 24, (u8 *)"Env Alert!");
-            LCD_ShowString(30, 180, 200, 30, 16, (u8 *)"Please check!");
-            FRONT_COLOR = RED;
-        }
-        else
-        {
-            LCD_ShowString(80, 150, 200, 30, 24, (u8 *)"Env Normal");
-            FRONT_COLOR = GREEN;
-        }
-        FRONT_COLOR = BLACK;
-        LCD_ShowString(20, 260, 200, 30, 16, (u8 *)"KEY_UP: Return");
-        last_screen = 2;
+    if (system_state.env_alert)
+    {
+        ui_field_set(&env_status, "Env Alert!", BLACK);
+        ui_field_set(&env_hint, "Please check!", BLACK);
     }
+    else
+    {
+        ui_field_set(&env_status, "Env Normal", BLACK);
+        ui_field_set(&env_hint, "", BLACK);
+    }
+}
+
+// 服药提醒界面绘制函数
+void paint_alarm_screen(void)
+{
+    LCD_Clear(YELLOW);
+    BACK_COLOR = YELLOW;
+
+    // 显示大号警报标题,36号字每字宽18,分两行居中
+    FRONT_COLOR = RED;
+    LCD_ShowString(70, 20, 180, 36, 36, (u8 *)"MEDICATION");
+    LCD_ShowString(106, 56, 108, 36, 36, (u8 *)"ALERT!");
+
+    // 显示药物信息
+    FRONT_COLOR = BLUE;
+    LCD_ShowString(50, 100, 200, 30, 24, (u8 *)"Medicine:");
+    ui_field_draw(&alarm_name);
+
+    // 显示时间信息
+    FRONT_COLOR = BLUE;
+    LCD_ShowString(50, 140, 200, 30, 24, (u8 *)"Scheduled Time:");
+    ui_field_draw(&alarm_sched);
+
+    // 显示当前时间
+    FRONT_COLOR = BLUE;
+    LCD_ShowString(50, 180, 200, 30, 24, (u8 *)"Current Time:");
+    ui_field_draw(&alarm_now);
+
+    // 操作提示
+    FRONT_COLOR = RED;
+    LCD_ShowString(30, 220, 240, 30, 24, (u8 *)"Take medicine or press UP");
+}
+
+// 已服药界面绘制函数
+void paint_med_taken_screen(void)
+{
+    LCD_Clear(GREEN);
+    BACK_COLOR = GREEN;
+
+    // 显示确认信息
+    FRONT_COLOR = BLUE;
+    LCD_ShowString(70, 60, 180, 36, 36, (u8 *)"MEDICATION");
+    LCD_ShowString(115, 96, 90, 36, 36, (u8 *)"TAKEN");
+
+    // 显示药物信息
+    ui_field_draw(&taken_info);
+
+    // 操作提示
+    FRONT_COLOR = BLUE;
+    LCD_ShowString(60, 200, 200, 30, 24, (u8 *)"Press UP to return");
+}
+
+// 环境警报界面绘制函数
+void paint_env_alert_screen(void)
+{
+    LCD_Clear(RED);
+    BACK_COLOR = RED;
+    FRONT_COLOR = WHITE;
+
+    // 显示警报标题
+    LCD_ShowString(61, 20, 198, 36, 36, (u8 *)"ENVIRONMENT");
+    LCD_ShowString(106, 56, 108, 36, 36, (u8 *)"ALERT!");
+
+    // 显示具体警报信息和当前时间
+    ui_field_draw(&env_alert_msg);
+    ui_field_draw(&env_alert_time);
+
+    // 操作提示
+    FRONT_COLOR = WHITE;
+    LCD_ShowString(30, 200, 240, 30, 24, (u8 *)"Check environment!");
+    LCD_ShowString(60, 240, 200, 30, 24, (u8 *)"Press UP to return");
 }
 
 // 优化警报显示函数
@@ -710,97 +913,54 @@ void show_alert_screen(u8 alert_type)
     char alert_msg[50];
     char time_str[20];
 
-    // 只在状态变化时重新绘制
+    // 状态变化时切换界面
     if (force_refresh || last_state != alert_type)
     {
-        // 先获取当前时间
-        sprintf(time_str, "%02d:%02d", calendar.hour, calendar.min);
-
         if (alert_type == STATE_ALARM)
-        {
-            LCD_Clear(YELLOW);
-            FRONT_COLOR = RED;
-            BACK_COLOR = YELLOW;
-
-            // 显示大号警报标题
-            LCD_ShowString(30, 40, 240, 50, 36, (u8 *)"MEDICATION ALERT!");
-
-            // 显示药物信息
-            FRONT_COLOR = BLUE;
-            LCD_ShowString(50, 100, 200, 30, 24, (u8 *)"Medicine:");
-            FRONT_COLOR = BLACK;
-            LCD_ShowString(150, 100, 200, 30, 24, (u8 *)medicines[system_state.next_med_index].name);
-
-            // 显示时间信息
-            FRONT_COLOR = BLUE;
-            LCD_ShowString(50, 140, 200, 30, 24, (u8 *)"Scheduled Time:");
-            FRONT_COLOR = BLACK;
-            sprintf(med_info, "%02d:%02d", medicines[system_state.next_med_index].hour,
-                    medicines[system_state.next_med_index].minute);
-            LCD_ShowString(200, 140, 200, 30, 24, (u8 *)med_info);
-
-            // 显示当前时间
-            FRONT_COLOR = BLUE;
-            LCD_ShowString(50, 180, 200, 30, 24, (u8 *)"Current Time:");
-            FRONT_COLOR = BLACK;
-            LCD_ShowString(180, 180, 200, 30, 24, (u8 *)time_str);
-
-            // 操作提示
-            FRONT_COLOR = RED;
-            LCD_ShowString(30, 220, 240, 30, 24, (u8 *)"Take medicine or press UP");
-        }
+            ui_enter_screen(paint_alarm_screen);
         else if (alert_type == STATE_MED_TAKEN)
-        {
-            LCD_Clear(GREEN);
-            FRONT_COLOR = BLUE;
-            BACK_COLOR = GREEN;
-
-            // 显示确认信息
-            LCD_ShowString(80, 80, 200, 50, 36, (u8 *)"MEDICATION TAKEN");
-
-            // 显示药物信息
-            FRONT_COLOR = BLACK;
-            sprintf(med_info, "%s at %s",
-                    medicines[system_state.next_med_index].name, time_str);
-            LCD_ShowString(40, 150, 240, 30, 24, (u8 *)med_info);
-
-            // 操作提示
-            FRONT_COLOR = BLUE;
-            LCD_ShowString(60, 200, 200, 30, 24, (u8 *)"Press UP to return");
-        }
+            ui_enter_screen(paint_med_taken_screen);
         else if (alert_type == STATE_ENV_ALERT)
-        {
-            LCD_Clear(RED);
-            FRONT_COLOR = WHITE;
-            BACK_COLOR = RED;
+            ui_enter_screen(paint_env_alert_screen);
 
-            // 显示警报标题
-            LCD_ShowString(60, 40, 240, 50, 36, (u8 *)"ENVIRONMENT ALERT!");
+        // 已服药界面显示的是服药时刻，只在进入时记录
+        if (alert_type == STATE_MED_TAKEN)
+        {
+            sprintf(med_info, "%s at %02d:%02d",
+                    medicines[system_state.next_med_index].name, calendar.hour, calendar.min);
+            ui_field_set(&taken_info, med_info, BLACK);
+        }
 
-            // 显示具体警报信息
-            if (system_state.temperature > 30.0)
-            {
-                sprintf(alert_msg, "HIGH TEMP: %.1fC", system_state.temperature);
-            }
-            else if (system_state.temperature < 10.0)
-            {
-                sprintf(alert_msg, "LOW TEMP: %.1fC", system_state.temperature);
-            }
-            else
-            {
-                sprintf(alert_msg, "HIGH HUMI: %.1f%%", system_state.humidity);
-            }
-            LCD_ShowString(50, 100, 240, 30, 24, (u8 *)alert_msg);
+        last_state = alert_type;
+        last_screen = 0xFF; // 返回普通界面时需要重绘
+    }
 
-            // 显示当前时间
-            LCD_ShowString(50, 140, 240, 30, 24, (u8 *)time_str);
+    sprintf(time_str, "%02d:%02d", calendar.hour, calendar.min);
 
-            // 操作提示
-            LCD_ShowString(30, 200, 240, 30, 24, (u8 *)"Check environment!");
-            LCD_ShowString(60, 240, 200, 30, 24, (u8 *)"Press UP to return");
+    if (alert_type == STATE_ALARM)
+    {
+        ui_field_set(&alarm_name, medicines[system_state.next_med_index].name, BLACK);
+        sprintf(med_info, "%02d:%02d", medicines[system_state.next_med_index].hour,
+                medicines[system_state.next_med_index].minute);
+        ui_field_set(&alarm_sched, med_info, BLACK);
+        ui_field_set(&alarm_now, time_str, BLACK);
+    }
+    else if (alert_type == STATE_ENV_ALERT)
+    {
+        if (system_state.temperature > 30.0)
+        {
+            sprintf(alert_msg, "HIGH TEMP: %.1fC", system_state.temperature);
         }
-
-        last_state = alert_type;
+        else if (system_state.temperature < 10.0)
+        {
+            sprintf(alert_msg, "LOW TEMP: %.1fC", system_state.temperature);
+        }
+        else
+        {
+            sprintf(alert_msg, "HIGH HUMI: %.1f%%", system_state.humidity);
+        }
+        ui_field_set(&env_alert_msg, alert_msg, WHITE);
+        ui_field_set(&env_alert_time, time_str, WHITE);
     }
 }
 
@@ -826,7 +986,6 @@ void start_medicine_box(u8 box_number)
     // 启动新事件
     medicine_box_active = box_number;
     event_active = 1;
-    event_timer = 0;
     event_stage = EVENT_STAGE_WAITING;
     led_showing = 1;
     fan_running = 0;
@@ -837,6 +996,7 @@ void start_medicine_box(u8 box_number)
 
     // 显示对应数字的彩灯（白色）
     RGB_ShowCharNum(box_number, RGB_COLOR_WHITE);
+    SwTimer_Start(&event_timer, EVENT_WAIT_MS, 0, medicine_box_fan_start);
 
     // 发送蓝牙消息
     sprintf(msg, "MEDICINE_BOX_OPEN:%d", box_number);
@@ -854,11 +1014,11 @@ void stop_medicine_box(void)
 
     // 停止风扇（设置PWM为非0值，因为极性为Low时非0表示停止）
     TIM_SetCompare2(TIM3, 400);
+    SwTimer_Stop(&event_timer);
 
     // 重置所有状态
     medicine_box_active = 0;
     event_active = 0;
-    event_timer = 0;
     event_stage = 0;
     led_showing = 0;
     fan_running = 0;
@@ -866,490 +1026,530 @@ void stop_medicine_box(void)
     printf("Medicine Box: Event Complete\r\n");
 }
 
-// 处理药盒控制逻辑
-void process_medicine_box_control(void)
+// 药盒等待阶段结束，启动风扇，运转结束后由定时器停止
+void medicine_box_fan_start(void)
 {
-    // 只有在事件激活时才处理
-    if (!event_active)
-    {
-        return;
-    }
+    event_stage = EVENT_STAGE_RUNNING;
+    fan_running = 1;
 
-    event_timer++; // 每100ms调用一次，所以这里递增
+    // 启动风扇（设置PWM为0，因为极性为Low时0表示转动）
+    TIM_SetCompare2(TIM3, 0);
+    SwTimer_Start(&event_timer, EVENT_RUN_MS, 0, stop_medicine_box);
 
-    switch (event_stage)
-    {
-    case EVENT_STAGE_WAITING: // 等待阶段（0.5秒）
-        if (event_timer >= 5) // 5 * 100ms = 0.5秒
-        {
-            // 进入风扇运转阶段
-            event_stage = EVENT_STAGE_RUNNING;
-            fan_running = 1;
+    printf("Medicine Box %d: Fan Started (3s)\r\n", medicine_box_active);
+}
 
-            // 启动风扇（设置PWM为0，因为极性为Low时0表示转动）
-            TIM_SetCompare2(TIM3, 0);
+#if TFTLCD_BUS_STAT
+// 测试常用绘图函数和各界面整屏绘制的总线开销，结果由串口1打印
+void profile_screens(void)
+{
+    LCD_Prof_Init();
+    LCD_Prof_Run();
+    LCD_Prof_Call("paint_home_screen", paint_home_screen);
+    LCD_Prof_Call("paint_medication_screen", paint_medication_screen);
+    LCD_Prof_Call("paint_environment_screen", paint_environment_screen);
+    LCD_Prof_Call("paint_alarm_screen", paint_alarm_screen);
+    LCD_Prof_Call("paint_med_taken_screen", paint_med_taken_screen);
+    LCD_Prof_Call("paint_env_alert_screen", paint_env_alert_screen);
+}
+#endif
+
+// 主循环任务
+// 原来的主循环每轮delay_ms(100)，各功能靠计数器分频；现在每个功能是一个任务，
+// 按自己的周期由调度器运行，空闲时CPU睡眠等待中断
+#define TASK_INPUT_MS 10    // 串口1命令
+#define TASK_LIGHT_MS 100   // 光敏取药检测，处理这段时间内的抽取输出
+#define TASK_BT_MS 20       // 蓝牙数据处理
+#define TASK_DEVICE_MS 250  // 蜂鸣器和LED控制，报警时LED每次取反，闪烁周期500ms
+#define TASK_EVENT_MS 0     // 中断事件，轮询任务
+#define TASK_DISP_MS 100    // 界面刷新
+#define TASK_HC05_MS 5000   // HC05定时发送和状态显示
+#define TASK_DEBUG_MS 10000 // 调试信息
+#define TASK_POWER_MS 1000  // 低功耗策略
+#define POWER_DEEP_IDLE_MS 60000 // 无操作超过该时间后空闲时进入停止模式
+#define POWER_POLL_S 60          // 停止模式最长时间(s)，醒来检查环境和刷新时钟
+#define ALARM_NOTIFY_MS 5000 // 服药报警期间蓝牙提醒间隔
+#define ENV_NOTIFY_MS 10000  // 环境报警期间蓝牙提醒间隔
+
+u8 current_screen = 0;     // 当前界面：0主界面，1药物信息，2环境信息
+u16 last_minute = 0xFFFF;  // 上一次检查时的时分(时<<8|分)，停止模式可能跨过整小时，只比分钟会漏检
+_swtimer alert_timer;      // 报警提醒定时器
+u8 alert_state = STATE_NORMAL; // 报警提醒定时器对应的系统状态
+u8 task_disp_id;           // 界面刷新任务号
+u8 task_bt_id;             // 蓝牙任务号
+u32 last_active_ms = 0;    // 最近一次按键、红外或蓝牙操作的时间
+
+// 红外遥控按键，1-9启动对应药盒
+void ir_key(u32 code)
+{
+    printf("IR code: 0x%08X\r\n", code); // 串口打印，方便调试
 
-            printf("Medicine Box %d: Fan Started (3s)\r\n", medicine_box_active);
-        }
+    // 根据完整的红外码匹配按键1-9
+    switch (code)
+    {
+    case IR_KEY1: // 按键1
+        start_medicine_box(1);
         break;
-
-    case EVENT_STAGE_RUNNING:  // 风扇运转阶段（0.5秒等待 + 3秒运转 = 3.5秒总）
-        if (event_timer >= 35) // 35 * 100ms = 3.5秒总时间
-        {
-            // 事件完成，停止所有操作
-            event_stage = EVENT_STAGE_COMPLETE;
-            stop_medicine_box();
-        }
+    case IR_KEY2: // 按键2
+        start_medicine_box(2);
         break;
-
-    case EVENT_STAGE_COMPLETE: // 事件完成，已在stop_medicine_box()中处理
+    case IR_KEY3: // 按键3
+        start_medicine_box(3);
+        break;
+    case IR_KEY4: // 按键4
+        start_medicine_box(4);
+        break;
+    case IR_KEY5: // 按键5
+        start_medicine_box(5);
+        break;
+    case IR_KEY6: // 按键6
+        start_medicine_box(6);
+        break;
+    case IR_KEY7: // 按键7
+        start_medicine_box(7);
+        break;
+    case IR_KEY8: // 按键8
+        start_medicine_box(8);
+        break;
+    case IR_KEY9: // 按键9
+        start_medicine_box(9);
         break;
-
     default:
-        // 异常状态，重置
-        stop_medicine_box();
+        printf("IR: Unknown key (0x%08X)\r\n", code);
         break;
     }
 }
 
-// main函数变量声明提前
-int main(void)
+// 串口1命令
+void task_input(void)
 {
-    // === 所有变量声明在可执行语句之前 ===
-    u8 last_minute = 0;
-    u8 last_second = 0;
-    u8 current_screen = 0;
-    u8 key;
-    char msg[64];
-    u8 current_minute;
-    u8 current_second;
-    static u8 debug_counter = 0;
-    static u8 light_sensor_timer = 0;
-    u8 i;
-    u8 light_base_value;        // 光敏基准值
-    u8 light_threshold;         // 光敏阈值
-    u8 diff;                    // 光敏差值
-    u16 hc05_timer = 0;         // HC05定时器
-    char sendbuf[64];           // 发送缓冲区
-    u16 reclen;                 // 接收长度
-    static u8 light_values[10]; // 光敏值历史记录
-    u8 light_index = 0;
-    u16 sum;      // 光敏值总和
-    u8 avg;       // 光敏平均值
-    u16 variance; // 光敏方差
-
-    // 初始化系统
-    SysTick_Init(72);
-    NVIC_PriorityGroupConfig(NVIC_PriorityGroup_2);
-    LED_Init();
-    USART1_Init(115200);
-    USART3_Init(9600);
-    TFTLCD_Init();
-    KEY_Init();
-    RTC_Init();
-    DHT11_Init();
-    BEEP_Init();
-    HC05_Init();
-    system_init();
-    Hwjs_Init();
-
-    // 初始化彩灯和电机模块
-    RGB_LED_Init();                 // 初始化WS2812彩灯
-    TIM3_CH2_PWM_Init(500, 72 - 1); // 初始化PWM，频率2KHz
-    TIM_SetCompare2(TIM3, 400);     // 确保风扇初始为停止状态（极性为Low时，非0值停止）
-
-    // 初始化光敏传感器
-    Lsens_Init();
-    light_base_value = 50; // 初始基准值设为50%
-    light_threshold = 20;  // 阈值设为20%
+    // 串口1命令：SHOT截屏，用tools/lcdshot.py接收
+    if (USART1_RX_STA & 0x8000)
+    {
+        if ((USART1_RX_STA & 0x3FFF) == 4 && memcmp(USART1_RX_BUF, BT_CMD_SHOT, 4) == 0)
+            LCD_Shot_Start();
+        USART1_RX_STA = 0;
+    }
+    // 截屏每次只读出压缩几行，由DMA发送，不阻塞其他任务
+    LCD_Shot_Poll();
+}
 
-    // 显示启动界面
-    LCD_Clear(BLUE);
-    FRONT_COLOR = WHITE;
-    BACK_COLOR = BLUE; // 设置背景颜色与清屏颜色一致
-    LCD_ShowString(30, 80, 240, 30, 24, (u8 *)"Smart Medicine Box");
-    LCD_ShowString(50, 120, 200, 30, 16, (u8 *)"System Starting...");
-    LCD_ShowString(60, 150, 200, 30, 16, (u8 *)"Bluetooth Ready");
-    LCD_ShowString(50, 180, 200, 30, 16, (u8 *)"Light Sensor Init");
-    delay_ms(2000);
+// 按键事件，消抖在TIM4中断中完成，这里只处理按下
+void key_event(u32 arg)
+{
+    u8 key = KEY_CODE(arg);
+    char msg[64];
 
-    // 发送蓝牙连接成功消息
-    Bluetooth_Send("SYSTEM_READY");
-    printf("=== Smart Medicine Box Started ===\r\n");
-    printf("Light Sensor Base Value: %d%%\r\n", light_base_value);
-    printf("Bluetooth Ready - Waiting for Commands...\r\n");
+    last_active_ms = SysTick_Ms();
+    if (KEY_EVENT(arg) != KEY_EV_PRESS) // 松开、长按、重复只算作有操作
+        return;
 
-    while (1)
+    if (key == KEY_UP_PRESS)
     {
-        current_minute = calendar.min;
-        current_second = calendar.sec;
-
-        // 红外遥控处理逻辑
-        if (hw_jsbz) // 红外接收到一帧数据
+        if (system_state.current_state == STATE_ALARM)
         {
-            u32 code = hw_jsm; // 读取红外码
-            u8 key_value;      // 声明提前到最前面
-            hw_jsbz = 0;       // 清零标志，准备下一次接收
-
-            printf("IR code: 0x%08X\r\n", code); // 串口打印，方便调试
-
-            key_value = code & 0xFF; // 取最低8位作为按键码
-
-            // 根据完整的红外码匹配按键1-9
-            switch (code)
+            medicines[system_state.next_med_index].taken = 1;
+            system_state.current_state = STATE_MED_TAKEN;
+            sprintf(msg, "MED_TAKEN:%s,%02d:%02d", medicines[system_state.next_med_index].name, calendar.hour, calendar.min);
+            Bluetooth_Send(msg);
+        }
+        else if (system_state.current_state == STATE_MED_TAKEN || system_state.current_state == STATE_ENV_ALERT)
+        {
+            system_state.current_state = STATE_NORMAL;
+            current_screen = 0;
+        }
+        else if (current_screen == 0) // 在主界面时，切换HC05主从模式
+        {
+            u8 role = HC05_Get_Role();
+            if (role != 0xFF)
             {
-            case IR_KEY1: // 按键1
-                start_medicine_box(1);
-                break;
-            case IR_KEY2: // 按键2
-                start_medicine_box(2);
-                break;
-            case IR_KEY3: // 按键3
-                start_medicine_box(3);
-                break;
-            case IR_KEY4: // 按键4
-                start_medicine_box(4);
-                break;
-            case IR_KEY5: // 按键5
-                start_medicine_box(5);
-                break;
-            case IR_KEY6: // 按键6
-                start_medicine_box(6);
-                break;
-            case IR_KEY7: // 按键7
-                start_medicine_box(7);
-                break;
-            case IR_KEY8: // 按键8
-                start_medicine_box(8);
-                break;
-            case IR_KEY9: // 按键9
-                start_medicine_box(9);
-                break;
-            default:
-                printf("IR: Unknown key (0x%08X)\r\n", code);
-                break;
+                role = !role; // 状态取反
+                if (role == 0)
+                    HC05_Set_Cmd((u8 *)"AT+ROLE=0");
+                else
+                    HC05_Set_Cmd((u8 *)"AT+ROLE=1");
+                HC05_Role_Show();
+                HC05_Set_Cmd((u8 *)"AT+RESET"); // 复位HC05模块
+                delay_ms(200);
+                printf("HC05 Role switched\r\n");
             }
         }
+        else
+        {
+            current_screen = 0;
+        }
+    }
+    else if (key == KEY0_PRESS)
+    {
+        current_screen = 1;
+    }
+    else if (key == KEY1_PRESS)
+    {
+        current_screen = 2;
+    }
+    else if (key == KEY2_PRESS) // 新增KEY2控制蓝牙发送
+    {
+        bt_send_mask = !bt_send_mask; // 发送/停止发送
+        if (bt_send_mask == 0)
+        {
+            ui_field_set(&home_send, "", BLACK); // 清除发送显示
+            printf("BT Send: OFF\r\n");
+        }
+        else
+        {
+            printf("BT Send: ON\r\n");
+        }
+    }
+    Sched_Delay(task_disp_id, 0); // 按键后立即刷新界面
+}
 
-        // 读取当前光敏传感器值 (0-100范围)
-        system_state.light_intensity = Lsens_Get_Val();
+// 光敏取药检测：依次处理光敏驱动抽取出的采样，检测到取药动作时放入事件队列
+void task_light(void)
+{
+    u16 raw;
+    u32 now = SysTick_Ms();
 
-        // 每10秒更新一次光强阈值
-        if (++light_sensor_timer >= 100) // 100 * 100ms = 10秒
+    while (Lsens_Read(&raw))
+    {
+        if (Ldet_Update(&light_det, raw, now))
         {
-            // 保存当前值
-            light_values[light_index] = system_state.light_intensity;
-            light_index = (light_index + 1) % 10;
-
-            // 计算平均值
-            sum = 0;
-            for (i = 0; i < 10; i++)
-            {
-                sum += light_values[i];
-            }
-            avg = sum / 10;
+            printf("Light Change: %d (Base:%d, Sigma:%d)\r\n", light_det.delta,
+                   (u16)(light_det.mean >> LDET_FRAC), Ldet_Sigma(&light_det));
+            EvQ_Post(EV_ADC, (u32)light_det.delta);
+        }
+    }
+    system_state.light_intensity = Lsens_Get_Val();
+}
 
-            // 计算方差
-            variance = 0;
-            for (i = 0; i < 10; i++)
-            {
-                diff = (light_values[i] > avg) ? (light_values[i] - avg) : (avg - light_values[i]);
-                variance += diff * diff;
-            }
-            variance /= 10;
+// 蓝牙数据处理
+void task_bluetooth(void)
+{
+    u16 reclen; // 接收长度
 
-            // 设置阈值
-            light_threshold = (u8)(1.5 * variance);
-            if (light_threshold < 10)
-                light_threshold = 10; // 最小阈值
-            if (light_threshold > 40)
-                light_threshold = 40; // 最大阈值
+    // 处理蓝牙数据（主要方法）
+    bluetooth_data_process();
 
-            light_sensor_timer = 0;
-        }
+    // 简单蓝牙测试（备用方法）
+    simple_bluetooth_test();
 
-        // 检测光照变化（取药动作）
-        diff = (system_state.light_intensity > light_base_value) ? (system_state.light_intensity - light_base_value) : (light_base_value - system_state.light_intensity);
+    if (USART3_RX_STA & 0x8000) // 接收到一次数据了
+    {
+        reclen = USART3_RX_STA & 0x7FFF; // 得到数据长度
+        USART3_RX_BUF[reclen] = '\0';    // 加入结束符
+        printf("Additional RX - Received length=%d\r\n", reclen);
+        printf("Additional RX - Received data=%s\r\n", USART3_RX_BUF);
 
-        if (diff > light_threshold)
+        // 显示接收到的数据（仅在主界面）
+        if (current_screen == 0)
         {
-            light_sensor_count++;
-            light_base_value = system_state.light_intensity; // 更新基准值
-
-            // 调试输出
-            printf("Light Change: %d%% (Base:%d%%, Thres:%d%%)\r\n",
-                   current_light_value, light_base_value, light_threshold);
-
-            delay_ms(200); // 避免连续计数
+            ui_field_set(&home_recv, (char *)USART3_RX_BUF, BLACK);
         }
 
-        // 处理蓝牙数据（主要方法）
-        bluetooth_data_process();
-
-        // 简单蓝牙测试（备用方法）
-        simple_bluetooth_test();
+        USART3_RX_STA = 0;
+    }
+}
 
-        // 处理药盒控制逻辑
-        process_medicine_box_control();
+// 处理中断放入事件队列的事件
+void task_events(void)
+{
+    _event ev;
+    u16 minute;
 
-        // 调试信息：每10秒显示一次USART3接收状态
-        if (++debug_counter >= 100) // 100 * 100ms = 10秒
-        {
-            debug_counter = 0;
-            printf("USART3 Status: RX_STA=0x%04X, DataLen=%d\r\n",
-                   USART3_RX_STA, USART3_RX_STA & 0x7FFF);
-            if ((USART3_RX_STA & 0x7FFF) > 0)
-            {
-                printf("RX Buffer Content: ");
-                for (i = 0; i < (USART3_RX_STA & 0x7FFF) && i < 20; i++)
-                {
-                    printf("0x%02X ", USART3_RX_BUF[i]);
-                }
-                printf("\r\n");
-            }
-        }
-        // 调试信息：每10秒显示一次USART3接收状态
-        if (++debug_counter >= 100) // 100 * 100ms = 10秒
+    while (EvQ_Get(&ev))
+    {
+        switch (ev.type)
         {
-            debug_counter = 0;
-            printf("USART3 Status: RX_STA=0x%04X, DataLen=%d\r\n",
-                   USART3_RX_STA, USART3_RX_STA & 0x7FFF);
-            if ((USART3_RX_STA & 0x7FFF) > 0)
+        case EV_IR: // 红外遥控一帧
+            last_active_ms = SysTick_Ms();
+            ir_key(ev.arg);
+            break;
+        case EV_IR_REP: // 红外按键按住不放，只算作有操作，不重复启动药盒
+            last_active_ms = SysTick_Ms();
+            break;
+        case EV_KEY: // 按键
+            key_event(ev.arg);
+            break;
+        case EV_BT_FRAME: // 蓝牙收到一帧，立即处理
+            last_active_ms = SysTick_Ms();
+            Sched_Delay(task_bt_id, 0);
+            break;
+        case EV_ADC: // 光敏检测到取药动作
+            handle_medication();
+            break;
+        case EV_DHT11: // 温湿度测量结束
+            update_environment(ev.arg);
+            break;
+        case EV_RTC_SEC: // 每秒一次，分钟变化时检查服药时间和环境
+            minute = (ev.arg >> 8) & 0xFFFF;
+            if (minute != last_minute)
             {
-                printf("RX Buffer Content: ");
-                for (i = 0; i < (USART3_RX_STA & 0x7FFF) && i < 20; i++)
-                {
-                    printf("0x%02X ", USART3_RX_BUF[i]);
-                }
-                printf("\r\n");
+                check_medication_time();
+                check_environment();
+                last_minute = minute;
             }
+            break;
+        default:
+            break;
         }
+    }
+}
 
-        // HC05控制逻辑 - 定时发送和状态更新
-        if (++hc05_timer >= 50) // 50 * 100ms = 5秒
-        {
-            if (bt_send_mask && current_screen == 0) // 只在主界面且开启发送时才发送
-            {
-                sprintf(sendbuf, "SmartBox %d", bt_send_cnt);
-                LCD_ShowString(50, 160, 180, 16, 16, (u8 *)sendbuf); // 显示发送数据
-                printf("Sending: %s\r\n", sendbuf);
-                u3_printf("SmartBox %d\r\n", bt_send_cnt); // 发送到蓝牙模块
-                bt_send_cnt++;
-                if (bt_send_cnt > 99)
-                    bt_send_cnt = 0;
-            }
+// 报警期间定时通过蓝牙发送提醒
+void alert_notify(void)
+{
+    char msg[64];
 
-            // 更新HC05连接状态显示（仅在主界面）
-            if (current_screen == 0)
-            {
-                HC05_Sta_Show();
-            }
+    if (system_state.current_state == STATE_ALARM)
+    {
+        sprintf(msg, "ALARM:%s,%02d:%02d",
+                medicines[system_state.next_med_index].name,
+                medicines[system_state.next_med_index].hour,
+                medicines[system_state.next_med_index].minute);
+    }
+    else if (system_state.temperature > 30.0)
+    {
+        sprintf(msg, "ENV_ALERT:HIGH_TEMP,%.1fC", system_state.temperature);
+    }
+    else if (system_state.temperature < 10.0)
+    {
+        sprintf(msg, "ENV_ALERT:LOW_TEMP,%.1fC", system_state.temperature);
+    }
+    else
+    {
+        sprintf(msg, "ENV_ALERT:HIGH_HUMI,%.1f%%", system_state.humidity);
+    }
+    Bluetooth_Send(msg);
+}
 
-            hc05_timer = 0;
-        }
+// 设备控制逻辑 - 区分系统警报和蓝牙控制
+void task_device(void)
+{
+    // 进入报警状态时立即发送一次提醒，之后定时重发，离开报警状态时停止
+    if (system_state.current_state != alert_state)
+    {
+        alert_state = system_state.current_state;
+        if (alert_state == STATE_ALARM)
+            SwTimer_Start(&alert_timer, 0, ALARM_NOTIFY_MS, alert_notify);
+        else if (alert_state == STATE_ENV_ALERT)
+            SwTimer_Start(&alert_timer, 0, ENV_NOTIFY_MS, alert_notify);
+        else
+            SwTimer_Stop(&alert_timer);
+    }
 
-        if (USART3_RX_STA & 0x8000) // 接收到一次数据了
+    if (system_state.current_state == STATE_ALARM)
+    {
+        BEEP = 1;     // 蜂鸣器响
+        LED1 = !LED1; // LED闪烁(500ms周期)
+        LED2 = 0;
+    }
+    else if (system_state.current_state == STATE_ENV_ALERT)
+    {
+        BEEP = (calendar.sec % 2); // 蜂鸣器间歇响(1秒周期)
+        LED1 = 0;
+        LED2 = 1; // LED2常亮
+    }
+    else
+    {
+        // 正常状态下，根据蓝牙控制状态设置设备
+        if (system_state.bt_beep_ctrl)
         {
-            if (current_screen == 0) // 仅在主界面显示接收数据
-            {
-                LCD_Fill(10, 190, 240, 210, WHITE); // 清除接收显示区域
-            }
-
-            reclen = USART3_RX_STA & 0x7FFF; // 得到数据长度
-            USART3_RX_BUF[reclen] = '\0';    // 加入结束符
-            printf("Additional RX - Received length=%d\r\n", reclen);
-            printf("Additional RX - Received data=%s\r\n", USART3_RX_BUF);
-
-            // 显示接收到的数据（仅在主界面）
-            if (current_screen == 0)
-            {
-                LCD_ShowString(60, 180, 180, 16, 16, USART3_RX_BUF);
-            }
-
-            USART3_RX_STA = 0;
+            BEEP = 1;
         }
-
-        if (current_minute != last_minute)
+        else
         {
-            check_medication_time();
-            check_environment();
-            last_minute = current_minute;
-            force_refresh = 1; // 标记需要刷新显示
+            BEEP = 0;
         }
 
-        // 设备控制逻辑 - 区分系统警报和蓝牙控制
-        if (system_state.current_state == STATE_ALARM)
+        if (system_state.bt_led1_ctrl)
         {
-            BEEP = 1;     // 蜂鸣器响
-            LED1 = !LED1; // LED闪烁(500ms周期)
-            LED2 = 0;
-            handle_medication(); // 处理服药动作
-
-            // 每5秒发送一次提醒
-            if (current_minute != last_minute)
-            {
-                check_medication_time();
-                check_environment();
-                last_minute = current_minute;
-                force_refresh = 1; // 标记需要刷新显示
-            }
+            LED1 = 0; // 低电平点亮
         }
-        // 设备控制逻辑 - 区分系统警报和蓝牙控制
-        if (system_state.current_state == STATE_ALARM)
+        else
         {
-            BEEP = 1;     // 蜂鸣器响
-            LED1 = !LED1; // LED闪烁(500ms周期)
-            LED2 = 0;
-            handle_medication(); // 处理服药动作
-
-            // 每5秒发送一次提醒
-            if (current_second % 5 == 0 && last_second != current_second)
-            {
-                sprintf(msg, "ALARM:%s,%02d:%02d",
-                        medicines[system_state.next_med_index].name,
-                        medicines[system_state.next_med_index].hour,
-                        medicines[system_state.next_med_index].minute);
-                Bluetooth_Send(msg);
-            }
+            LED1 = 1; // 高电平熄灭
         }
-        else if (system_state.current_state == STATE_ENV_ALERT)
-        {
-            BEEP = (current_second % 2); // 蜂鸣器间歇响(1秒周期)
-            LED1 = 0;
-            LED2 = 1; // LED2常亮
 
-            // 每10秒发送一次环境警报
-            if (current_second % 10 == 0 && last_second != current_second)
-            {
-                if (system_state.temperature > 30.0)
-                {
-                    sprintf(msg, "ENV_ALERT:HIGH_TEMP,%.1fC", system_state.temperature);
-                }
-                else if (system_state.temperature < 10.0)
-                {
-                    sprintf(msg, "ENV_ALERT:LOW_TEMP,%.1fC", system_state.temperature);
-                }
-                else
-                {
-                    sprintf(msg, "ENV_ALERT:HIGH_HUMI,%.1f%%", system_state.humidity);
-                }
-                Bluetooth_Send(msg);
-            }
+        if (system_state.bt_led2_ctrl)
+        {
+            LED2 = 0; // 低电平点亮
         }
         else
         {
-            // 正常状态下，根据蓝牙控制状态设置设备
-            if (system_state.bt_beep_ctrl)
-            {
-                BEEP = 1;
-            }
-            else
-            {
-                BEEP = 0;
-            }
-
-            if (system_state.bt_led1_ctrl)
-            {
-                LED1 = 0; // 低电平点亮
-            }
-            else
-            {
-                LED1 = 1; // 高电平熄灭
-            }
-
-            if (system_state.bt_led2_ctrl)
-            {
-                LED2 = 0; // 低电平点亮
-            }
-            else
-            {
-                LED2 = 1; // 高电平熄灭
-            }
+            LED2 = 1; // 高电平熄灭
         }
+    }
+}
 
-        key = KEY_Scan(0);
-        if (key != 0)
-        {
-            force_refresh = 1; // 按键操作后强制刷新
-            if (key == KEY_UP_PRESS)
-            {
-                if (system_state.current_state == STATE_ALARM)
-                {
-                    medicines[system_state.next_med_index].taken = 1;
-                    system_state.current_state = STATE_MED_TAKEN;
-                    sprintf(msg, "MED_TAKEN:%s,%02d:%02d", medicines[system_state.next_med_index].name, calendar.hour, calendar.min);
-                    Bluetooth_Send(msg);
-                }
-                else if (system_state.current_state == STATE_MED_TAKEN || system_state.current_state == STATE_ENV_ALERT)
-                {
-                    system_state.current_state = STATE_NORMAL;
-                    current_screen = 0;
-                }
-                else if (current_screen == 0) // 在主界面时，切换HC05主从模式
-                {
-                    u8 role = HC05_Get_Role();
-                    if (role != 0xFF)
-                    {
-                        role = !role; // 状态取反
-                        if (role == 0)
-                            HC05_Set_Cmd("AT+ROLE=0");
-                        else
-                            HC05_Set_Cmd("AT+ROLE=1");
-                        HC05_Role_Show();
-                        HC05_Set_Cmd("AT+RESET"); // 复位HC05模块
-                        delay_ms(200);
-                        printf("HC05 Role switched\r\n");
-                    }
-                }
-                else
-                {
-                    current_screen = 0;
-                }
-            }
-            else if (key == KEY0_PRESS)
-            {
-                current_screen = 1;
-            }
-            else if (key == KEY1_PRESS)
-            {
-                current_screen = 2;
-            }
-            else if (key == KEY2_PRESS) // 新增KEY2控制蓝牙发送
-            {
-                bt_send_mask = !bt_send_mask; // 发送/停止发送
-                if (bt_send_mask == 0)
-                {
-                    LCD_Fill(50, 160, 240, 176, WHITE); // 清除发送显示
-                    printf("BT Send: OFF\r\n");
-                }
-                else
-                {
-                    printf("BT Send: ON\r\n");
-                }
-            }
-        }
-        if (system_state.current_state == STATE_NORMAL)
+// 界面刷新
+void task_display(void)
+{
+    if (system_state.current_state == STATE_NORMAL)
+    {
+        switch (current_screen)
         {
-            switch (current_screen)
-            {
-            case 0:
-                show_home_screen();
-                break;
-            case 1:
-                show_medication_screen();
-                break;
-            case 2:
-                show_environment_screen();
-                break;
-            }
+        case 0:
+            show_home_screen();
+            break;
+        case 1:
+            show_medication_screen();
+            break;
+        case 2:
+            show_environment_screen();
+            break;
         }
-        else
+    }
+    else
+    {
+        show_alert_screen(system_state.current_state);
+    }
+
+    // 只重绘本轮内容发生变化的区域
+    ui_flush();
+
+    // 重置强制刷新标志
+    force_refresh = 0;
+}
+
+// HC05控制逻辑 - 定时发送和状态更新
+void task_hc05(void)
+{
+    char sendbuf[64]; // 发送缓冲区
+
+    if (current_screen != 0) // 只在主界面发送和显示
+        return;
+
+    if (bt_send_mask) // 开启发送时才发送
+    {
+        sprintf(sendbuf, "SmartBox %d", bt_send_cnt);
+        ui_field_set(&home_send, sendbuf, BLACK); // 显示发送数据
+        printf("Sending: %s\r\n", sendbuf);
+        u3_printf("SmartBox %d\r\n", bt_send_cnt); // 发送到蓝牙模块
+        bt_send_cnt++;
+        if (bt_send_cnt > 99)
+            bt_send_cnt = 0;
+    }
+
+    // 更新HC05连接状态显示
+    HC05_Sta_Show();
+}
+
+// 调试信息：USART3接收状态和各任务运行统计
+void task_debug(void)
+{
+    u8 i;
+
+    printf("USART3 Status: RX_STA=0x%04X, DataLen=%d\r\n",
+           USART3_RX_STA, USART3_RX_STA & 0x7FFF);
+    if ((USART3_RX_STA & 0x7FFF) > 0)
+    {
+        printf("RX Buffer Content: ");
+        for (i = 0; i < (USART3_RX_STA & 0x7FFF) && i < 20; i++)
         {
-            show_alert_screen(system_state.current_state);
+            printf("0x%02X ", USART3_RX_BUF[i]);
         }
+        printf("\r\n");
+    }
+    printf("Events: peak %d, dropped %lu\r\n", evq_peak, (unsigned long)evq_dropped);
+    Sched_Report();
+    Power_Report();
+}
+
+// 低功耗策略：平时空闲由调度器tickless睡眠；长时间无操作且没有报警、药盒动作和蓝牙连接时，
+// 请求空闲时进入停止模式，RTC闹钟在下一次服药时间或下一次传感器检查时唤醒
+// 停止模式下USART3收不到数据，蓝牙连接时不进入；按键还不能唤醒，最多等到下一次检查
+void task_power(void)
+{
+    u32 cnt, sod, wake, t;
+    u8 i;
+
+    if (system_state.current_state != STATE_NORMAL || event_active || bt_send_mask)
+        return;
+    if (HC05_LED) // 蓝牙已连接
+        return;
+    if (Key_Busy()) // 按键按住时TIM4在消抖，停止模式下不走
+        return;
+    if (LCD_Shot_Busy()) // 截屏正在由DMA发送
+        return;
+    if (SysTick_Ms() - last_active_ms < POWER_DEEP_IDLE_MS)
+        return;
 
-        // 重置强制刷新标志
-        force_refresh = 0;
-        delay_ms(100);
+    cnt = RTC_GetCounter();
+    sod = cnt % 86400; // 当天的秒数
+    wake = (sod / POWER_POLL_S + 1) * POWER_POLL_S;
+    for (i = 0; i < system_state.med_count; i++)
+    {
+        if (medicines[i].taken)
+            continue;
+        t = (u32)medicines[i].hour * 3600 + (u32)medicines[i].minute * 60;
+        if (t > sod && t < wake)
+            wake = t;
     }
+    Power_StopUntil(cnt - sod + wake);
+}
+
+int main(void)
+{
+    // 初始化系统
+    SysTick_Init(72);
+    EvQ_Init(); // 中断初始化之前，中断中会放入事件
+    NVIC_PriorityGroupConfig(NVIC_PriorityGroup_2);
+    LED_Init();
+    USART1_Init(115200);
+    USART3_Init(9600);
+    TFTLCD_Init();
+    KEY_Init();
+    RTC_Init();
+    Power_Init();
+    DHT11_Init();
+    BEEP_Init();
+    HC05_Init();
+    system_init();
+    Hwjs_Init();
+
+    // 初始化彩灯和电机模块
+    RGB_LED_Init();                 // 初始化WS2812彩灯
+    TIM3_CH2_PWM_Init(500, 72 - 1); // 初始化PWM，频率2KHz
+    TIM_SetCompare2(TIM3, 400);     // 确保风扇初始为停止状态（极性为Low时，非0值停止）
+
+    // 初始化光敏传感器
+    Lsens_Init();
+    Ldet_Init(&light_det);
+
+    // 显示启动界面
+    LCD_Clear(BLUE);
+    FRONT_COLOR = WHITE;
+    BACK_COLOR = BLUE; // 设置背景颜色与清屏颜色一致
+    LCD_ShowString(30, 80, 240, 30, 24, (u8 *)"Smart Medicine Box");
+    LCD_ShowString(50, 120, 200, 30, 16, (u8 *)"System Starting...");
+    LCD_ShowString(60, 150, 200, 30, 16, (u8 *)"Bluetooth Ready");
+    LCD_ShowString(50, 180, 200, 30, 16, (u8 *)"Light Sensor Init");
+    delay_ms(2000);
+#if TFTLCD_BUS_STAT
+    profile_screens();
+#endif
+    LCD_Dirty_Init();
+    LCD_Console_Init(352, 479, 16, BLACK, WHITE); // 主界面底部的事件日志
+
+    // 发送蓝牙连接成功消息
+    Bluetooth_Send("SYSTEM_READY");
+    printf("=== Smart Medicine Box Started ===\r\n");
+    printf("Light Sensor: %d%%\r\n", Lsens_Get_Val());
+    printf("Bluetooth Ready - Waiting for Commands...\r\n");
+
+    SwTimer_Init();
+
+    // 注册任务：名称、函数、周期、首次运行偏移、允许延迟(ms)
+    // 周期相同或成倍数的任务错开首次运行时间，避免同一毫秒内集中到期
+    Sched_Add("input", task_input, TASK_INPUT_MS, 0, 10);
+    Sched_Add("event", task_events, TASK_EVENT_MS, 0, 2);
+    task_bt_id = Sched_Add("bt", task_bluetooth, TASK_BT_MS, 1, 20);
+    Sched_Add("light", task_light, TASK_LIGHT_MS, 3, 50);
+    Sched_Add("device", task_device, TASK_DEVICE_MS, 7, 50);
+    task_disp_id = Sched_Add("display", task_display, TASK_DISP_MS, 9, 100);
+    Sched_Add("hc05", task_hc05, TASK_HC05_MS, 13, 1000);
+    Sched_Add("debug", task_debug, TASK_DEBUG_MS, TASK_DEBUG_MS, 1000);
+    Sched_Add("power", task_power, TASK_POWER_MS, 500, 1000);
+
+    Sched_Loop(); // 不返回
+    return 0;
 }
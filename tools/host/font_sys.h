@@ -0,0 +1,2 @@
+//按系统头文件包含font.h(用尖括号,经-isystem找到),其中的警告不报告;之后的#include "font.h"由头文件保护跳过
+#include <font.h>
@@ -0,0 +1,168 @@
+#include "host.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <sys/mman.h>
+
+#ifndef MAP_FIXED_NOREPLACE
+#define MAP_FIXED_NOREPLACE	0x100000
+#endif
+
+volatile u32 systick_ms=0;
+u32 host_fails=0;
+u32 host_sleep_calls=0;
+u64 host_sleep_us=0;
+void (*host_stop)(void)=0;
+
+static u64 host_us=0;
+static u64 host_irq_us;
+static u32 host_resume_ms=0;	//SysTick_Resume补上的毫秒数,停止期间虚拟时间不走
+static void (*host_irq)(void)=0;
+
+
+//在STM32的地址上映射普通内存
+static void Host_Map(unsigned long addr,unsigned long size)
+{
+	void *p=mmap((void *)addr,size,PROT_READ|PROT_WRITE,
+		MAP_PRIVATE|MAP_ANONYMOUS|MAP_NORESERVE|MAP_FIXED_NOREPLACE,-1,0);
+
+	if(p!=(void *)addr)
+	{
+		fprintf(stderr,"host: cannot map 0x%08lx\n",addr);
+		exit(2);
+	}
+}
+
+__attribute__((constructor)) static void Host_Init(void)
+{
+	Host_Map(FLASH_BASE,0x80000);			//内部Flash,LCD_Prof_Run把它当作图片数据
+	Host_Map(PERIPH_BASE,0x04000000);		//外设和位带别名区
+	Host_Map(FSMC_R_BASE,0x1000);			//FSMC寄存器
+	Host_Map(SCS_BASE&0xFFF00000,0x100000);	//SysTick,NVIC,SCB,DWT,CoreDebug
+	USART1->SR=USART_FLAG_TXE|USART_FLAG_TC;	//串口发送总是完成
+	USART3->SR=USART_FLAG_TXE|USART_FLAG_TC;
+}
+
+
+//时间经过模拟中断的时刻时先运行中断
+void Host_Set_Us(u64 us)
+{
+	void (*fn)(void);
+
+	while(host_irq&&host_irq_us<=us)
+	{
+		host_us=host_irq_us;
+		systick_ms=(u32)(host_us/1000)+host_resume_ms;
+		fn=host_irq;
+		host_irq=0;
+		fn();				//可以再用Host_Irq_At安排下一次
+	}
+	host_us=us;
+	systick_ms=(u32)(us/1000)+host_resume_ms;
+}
+
+void Host_Irq_At(u64 us,void (*fn)(void))
+{
+	host_irq_us=us;
+	host_irq=fn;
+}
+
+void Host_Advance_Us(u32 us)
+{
+	Host_Set_Us(host_us+us);
+}
+
+u64 Host_Us(void)
+{
+	return host_us;
+}
+
+
+void Host_Fail(const char *file,int line,const char *cond)
+{
+	printf("FAIL %s:%d: %s\n",file,line,cond);
+	host_fails++;
+}
+
+int Host_Result(const char *name)
+{
+	if(host_fails)
+	{
+		printf("%s: %u check(s) failed\n",name,host_fails);
+		return 1;
+	}
+	printf("%s: ok\n",name);
+	return 0;
+}
+
+
+//以下代替Public/SysTick.c
+void SysTick_Init(u8 SYSCLK)
+{
+	(void)SYSCLK;
+}
+
+u32 SysTick_Ms(void)
+{
+	return systick_ms;
+}
+
+u64 SysTick_Ms64(void)
+{
+	return host_us/1000+host_resume_ms;
+}
+
+u32 SysTick_Us(void)
+{
+	return (u32)host_us+host_resume_ms*1000;
+}
+
+void SysTick_Add(u32 n)
+{
+	Host_Set_Us(host_us+(u64)n*1000);
+}
+
+//睡到第ms个毫秒边界,模拟的中断提前唤醒
+u32 SysTick_Sleep(u32 ms)
+{
+	u64 end;
+	u32 us;
+
+	if(ms==0)return 0;
+	host_sleep_calls++;
+	end=(host_us/1000+ms)*1000;
+	if(host_irq&&host_irq_us<end)end=host_irq_us;
+	us=(u32)(end-host_us);
+	host_sleep_us+=us;
+	Host_Set_Us(end);
+	return us;
+}
+
+void SysTick_Resume(u32 ms)
+{
+	host_resume_ms+=ms;
+	systick_ms+=ms;
+}
+
+void delay_us(u32 nus)
+{
+	Host_Advance_Us(nus);
+}
+
+void delay_ms(u16 nms)
+{
+	Host_Advance_Us((u32)nms*1000);
+}
+
+
+//stm32f10x_pwr.c中WFI/WFE是ARM指令,主机上不编译,用到的函数在这里代替
+void PWR_BackupAccessCmd(FunctionalState NewState)
+{
+	(void)NewState;
+}
+
+void PWR_EnterSTOPMode(uint32_t PWR_Regulator,uint8_t PWR_STOPEntry)
+{
+	(void)PWR_Regulator;
+	(void)PWR_STOPEntry;
+	if(host_stop)host_stop();
+}
@@ -0,0 +1,29 @@
+#ifndef _host_H
+#define _host_H
+
+#include "system.h"
+#include "SysTick.h"
+
+//主机测试运行环境
+//外设寄存器:程序启动时在STM32的Flash、外设(含位带别名区)、内核外设和FSMC寄存器地址上
+//映射普通内存,标准外设库和驱动直接读写,测试程序可以直接设置寄存器值,
+//例如TIM6->CNT=100、KEY0=0(位带别名区);写1清零之类的硬件行为不模拟
+//时基:代替Public/SysTick.c,时间是虚拟的,只在测试调用Host_Advance_Us、
+//delay_us/delay_ms或SysTick_Sleep时前进,结果与运行速度无关
+
+//检查条件,不成立时打印位置并计数,测试程序最后返回Host_Result()
+#define HOST_CHECK(c)	do{if(!(c))Host_Fail(__FILE__,__LINE__,#c);}while(0)
+
+extern u32 host_fails;					//检查失败次数
+extern u32 host_sleep_calls;			//SysTick_Sleep调用次数
+extern u64 host_sleep_us;				//SysTick_Sleep睡眠的总时间(us)
+extern void (*host_stop)(void);			//PWR_EnterSTOPMode时调用,由测试模拟停止期间的时间流逝
+
+void Host_Advance_Us(u32 us);			//虚拟时间前进us微秒
+void Host_Set_Us(u64 us);				//设置虚拟时间
+u64 Host_Us(void);						//虚拟时间(us),不含停止模式的时间
+void Host_Irq_At(u64 us,void (*fn)(void));	//虚拟时间到us时调用fn模拟一次中断(fn中不推进时间),睡眠中提前唤醒;同时只有一个
+void Host_Fail(const char *file,int line,const char *cond);
+int Host_Result(const char *name);		//打印测试结果,返回进程退出码
+
+#endif
@@ -0,0 +1,211 @@
+#include "lcd_emu.h"
+#include "stm32f10x.h"
+#include <stdio.h>
+#include <string.h>
+
+Emu emu;
+EmuRegs emu_regs;
+EmuDma emu_dma={256,0,0,0,0,0,0};
+
+//由lcd_dma.c提供,没有链接时不产生中断
+void DMA2_Channel1_IRQHandler(void) __attribute__((weak));
+
+
+void Emu_Reset(void)
+{
+	memset(&emu,0,sizeof emu);
+	emu.x1=EMU_W-1;
+	emu.y1=EMU_H-1;
+	emu.vsa=EMU_H;
+}
+
+void Emu_Clear_Count(void)
+{
+	memset(&emu.n,0,sizeof emu.n);
+}
+
+EmuCmd &EmuCmd::operator=(unsigned v)
+{
+	emu.n.cmd++;
+	emu.cur=v&0xff;
+	emu.narg=0;
+	emu.half=0;
+	if(emu.cur==0x2C||emu.cur==0x2E)	//写/读GRAM从窗口左上角开始
+	{
+		emu.cx=emu.x0;
+		emu.cy=emu.y0;
+		emu.rd_dummy=1;
+		emu.rd_half=0;
+	}
+	return *this;
+}
+
+EmuCmd::operator uint16_t() const
+{
+	return 0;
+}
+
+//窗口内下一个位置
+static void Emu_Next(void)
+{
+	if(++emu.cx>emu.x1)
+	{
+		emu.cx=emu.x0;
+		emu.cy++;
+	}
+}
+
+EmuData &EmuData::operator=(unsigned v)
+{
+	uint16_t c;
+
+	if(emu.cur==0x2C)
+	{
+		if(!emu.half)
+		{
+			emu.hi=v&0xff;
+			emu.half=1;
+			return *this;
+		}
+		emu.half=0;
+		c=(emu.hi<<8)|(v&0xff);
+		emu.n.pixel++;
+		if(emu.cy>emu.y1||emu.cy>=EMU_H||emu.cx>=EMU_W)emu.outside++;
+		else emu.gram[emu.cy][emu.cx]=c;
+		Emu_Next();
+		return *this;
+	}
+	emu.n.data++;
+	if(emu.narg<sizeof emu.arg)emu.arg[emu.narg++]=v&0xff;
+	if(emu.cur==0x2A&&emu.narg==4)
+	{
+		emu.x0=(emu.arg[0]<<8)|emu.arg[1];
+		emu.x1=(emu.arg[2]<<8)|emu.arg[3];
+	}
+	if(emu.cur==0x2B&&emu.narg==4)
+	{
+		emu.y0=(emu.arg[0]<<8)|emu.arg[1];
+		emu.y1=(emu.arg[2]<<8)|emu.arg[3];
+	}
+	if(emu.cur==0x33&&emu.narg==6)
+	{
+		emu.tfa=(emu.arg[0]<<8)|emu.arg[1];
+		emu.vsa=(emu.arg[2]<<8)|emu.arg[3];
+		emu.bfa=(emu.arg[4]<<8)|emu.arg[5];
+	}
+	if(emu.cur==0x37&&emu.narg==2)emu.vsp=(emu.arg[0]<<8)|emu.arg[1];
+	return *this;
+}
+
+EmuData::operator uint16_t() const
+{
+	uint16_t c;
+
+	emu.n.read++;
+	if(emu.cur==0xD0)return 0x99;	//TFTLCD_Init读ID
+	if(emu.cur!=0x2E)return 0;
+	if(emu.rd_dummy)
+	{
+		emu.rd_dummy=0;
+		return 0xA5;
+	}
+	c=(emu.cy<EMU_H&&emu.cx<EMU_W)?emu.gram[emu.cy][emu.cx]:0;
+	if(!emu.rd_half)
+	{
+		emu.rd_half=1;
+		return c>>8;
+	}
+	emu.rd_half=0;
+	Emu_Next();
+	return c&0xff;
+}
+
+int Emu_Row(int y)
+{
+	int v;
+
+	if(y<emu.tfa||y>=emu.tfa+emu.vsa)return y;
+	v=emu.vsp<emu.tfa?emu.tfa:emu.vsp;
+	return emu.tfa+((y-emu.tfa)+(v-emu.tfa))%emu.vsa;
+}
+
+void Emu_Screen(uint16_t out[EMU_H][EMU_W])
+{
+	int y;
+
+	for(y=0;y<EMU_H;y++)memcpy(out[y],emu.gram[Emu_Row(y)],sizeof out[y]);
+}
+
+//usart.c重定义了fputc(输出到USART1),这里只用fwrite
+int Emu_Save_PPM(const char *path)
+{
+	static uint16_t scr[EMU_H][EMU_W];
+	unsigned char row[EMU_W*3];
+	FILE *f;
+	int x,y;
+	uint16_t c;
+
+	f=fopen(path,"wb");
+	if(f==0)return -1;
+	Emu_Screen(scr);
+	fprintf(f,"P6\n%d %d\n255\n",EMU_W,EMU_H);
+	for(y=0;y<EMU_H;y++)
+	{
+		for(x=0;x<EMU_W;x++)
+		{
+			c=scr[y][x];
+			row[x*3]=((c>>11)&0x1f)*255/31;
+			row[x*3+1]=((c>>5)&0x3f)*255/63;
+			row[x*3+2]=(c&0x1f)*255/31;
+		}
+		fwrite(row,1,sizeof row,f);
+	}
+	fclose(f);
+	return 0;
+}
+
+
+//按DMA2通道1的寄存器传输,通道使能后开始一次传输
+void Emu_Dma_Step(void)
+{
+	DMA_Channel_TypeDef *ch=DMA2_Channel1;
+	uint32_t n=emu_dma.burst,v,ccr;
+	uint8_t word;
+
+	emu_dma.idle++;
+	while(n)
+	{
+		ccr=ch->CCR;
+		if(!emu_dma.run)
+		{
+			if(!(ccr&DMA_CCR1_EN)||ch->CNDTR==0)return;
+			if(ch->CPAR!=(uint32_t)(uintptr_t)&TFTLCD->LCD_DATA||!(ccr&DMA_CCR1_DIR)||(ccr&DMA_CCR1_PINC)||
+				((ccr&DMA_CCR1_PSIZE)>>8)!=((ccr&DMA_CCR1_MSIZE)>>10))emu_dma.bad++;
+			emu_dma.src=ch->CMAR;
+			emu_dma.run=1;
+		}
+		word=(ccr&DMA_CCR1_PSIZE)==DMA_CCR1_PSIZE_1;
+		if(word)
+		{
+			v=*(uint32_t *)emu_dma.src;
+			TFTLCD->LCD_DATA=v&0xffff;
+			TFTLCD->LCD_DATA=v>>16;
+		}
+		else TFTLCD->LCD_DATA=*(uint16_t *)emu_dma.src;
+		if(ccr&DMA_CCR1_MINC)emu_dma.src+=word?4:2;
+		emu_dma.item++;
+		n--;
+		if(--ch->CNDTR==0)
+		{
+			emu_dma.run=0;
+			DMA2->ISR|=DMA_ISR_TCIF1|DMA_ISR_GIF1;
+			if((ccr&DMA_CCR1_TCIE)&&DMA2_Channel1_IRQHandler)
+			{
+				emu_dma.tc++;
+				DMA2->IFCR=0;
+				DMA2_Channel1_IRQHandler();
+				DMA2->ISR&=~DMA2->IFCR;
+			}
+		}
+	}
+}
@@ -0,0 +1,89 @@
+#ifndef _lcd_emu_H
+#define _lcd_emu_H
+
+//HX8357DN命令级模拟,主机上测试tftlcd.c及其上层绘图模块用
+//编译LCD模块时用-include强制包含本文件,TFTLCD指向模拟的寄存器块,
+//驱动对LCD_CMD/LCD_DATA的每次读写都进入下面的运算符,按命令解码:
+//0x2A/0x2B设置窗口,0x2C之后每两次数据写(先高字节后低字节)是一个像素,
+//0x2E之后一次空读再每个像素读两次,0x33/0x37是硬件垂直滚动
+//DMA2通道1按寄存器设置把存储器中的数据写到LCD_DATA,在驱动等待DMA的空转(LCD_DMA_IDLE)中推进
+//LCD模块需按C++编译(g++ -x c++),见Makefile
+
+#include <stdint.h>
+
+#define EMU_W	320
+#define EMU_H	480
+
+struct EmuCmd
+{
+	EmuCmd &operator=(unsigned v);
+	operator uint16_t() const;
+};
+
+struct EmuData
+{
+	EmuData &operator=(unsigned v);
+	operator uint16_t() const;
+};
+
+struct EmuRegs
+{
+	EmuCmd LCD_CMD;
+	EmuData LCD_DATA;
+};
+
+//总线访问计数,测试时在每次API调用前清零
+struct EmuCount
+{
+	uint32_t cmd;		//命令写次数
+	uint32_t data;		//参数写次数(不含像素)
+	uint32_t pixel;		//像素数(每个像素2次数据写)
+	uint32_t read;		//数据读次数
+};
+
+struct Emu
+{
+	uint16_t gram[EMU_H][EMU_W];	//显存,按GRAM行号
+	EmuCount n;
+	uint8_t cur;					//当前命令
+	uint8_t arg[8];					//当前命令的参数
+	uint8_t narg;
+	uint16_t x0,x1,y0,y1;			//窗口
+	uint16_t cx,cy;					//写/读位置
+	uint8_t half;					//1:已写像素的高字节
+	uint8_t hi;
+	uint8_t rd_dummy,rd_half;		//0x2E读状态
+	uint16_t tfa,vsa,bfa,vsp;		//垂直滚动
+	uint32_t outside;				//写到窗口之外(超过y1)的像素数,正常绘图应为0
+};
+
+//DMA2通道1模拟:通道使能后从CMAR读,MINC决定是否递增,PSIZE为32位时按FSMC的拆分先写低半字再写高半字,
+//每传一次CNDTR减1,减到0时置ISR的TC标志,TCIE使能时调用DMA2_Channel1_IRQHandler(写IFCR清零由这里模拟)
+struct EmuDma
+{
+	uint32_t burst;		//每次空转传输的次数,测试可以修改
+	uint32_t idle;		//空转次数
+	uint32_t item;		//传输次数
+	uint32_t tc;		//传输完成中断次数
+	uint32_t bad;		//设置不对的传输:目标不是LCD_DATA,方向或数据宽度不对
+	uint8_t run;		//正在传输
+	uintptr_t src;		//下一次读的地址
+};
+
+extern Emu emu;
+extern EmuRegs emu_regs;
+extern EmuDma emu_dma;
+
+#define TFTLCD	(&emu_regs)
+#define LCD_DMA_LOCK()		//模拟的DMA中断只在空转时发生
+#define LCD_DMA_UNLOCK()
+#define LCD_DMA_IDLE()		Emu_Dma_Step()
+
+void Emu_Reset(void);
+void Emu_Clear_Count(void);
+int Emu_Row(int y);											//屏幕第y行显示的GRAM行
+void Emu_Screen(uint16_t out[EMU_H][EMU_W]);				//按滚动设置得到屏幕上看到的图像
+int Emu_Save_PPM(const char *path);							//屏幕图像保存为PPM,返回0成功
+void Emu_Dma_Step(void);									//DMA传输emu_dma.burst次
+
+#endif
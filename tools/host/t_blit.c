@@ -0,0 +1,232 @@
+#include "host.h"
+#include "lcd_emu.h"
+#include "tftlcd.h"
+#include "lcd_dma.h"
+#include <stdio.h>
+#include <string.h>
+#include <time.h>
+
+//块写入测试:LCD_Blit,LCD_Blit_Key,LCD_Color_Fill经LCD模拟器运行
+//1.从一张大图中随机取2000块矩形写到屏幕上的随机位置(可超出屏幕),有时设置裁剪区域,
+//  每次写入后屏幕与逐点计算的相同,写出的像素数等于可见且不透明的像素数
+//2.开销表:同一块矩形用LCD_Blit按行间隔写入,与逐行调用LCD_Color_Fill,
+//  以及先拷贝成连续数组再一次LCD_Color_Fill比较,带透明色的与逐段LCD_Color_Fill比较
+
+#define AW		400			//大图的宽和高
+#define AH		300
+#define KEY		0xF81F		//透明色
+
+static u16 atlas[AH][AW];			//DMA地址只有32位,不能放在栈上
+static u16 packed[AW*AH];			//拷贝成连续的一块
+static u16 ref[EMU_H][EMU_W];
+static u32 rnd=1;
+
+
+static u32 Rand(u32 n)
+{
+	rnd=rnd*1103515245+12345;
+	return (rnd>>8)%n;
+}
+
+static double Now(void)
+{
+	struct timespec t;
+
+	clock_gettime(CLOCK_MONOTONIC,&t);
+	return t.tv_sec+t.tv_nsec*1e-9;
+}
+
+//大图:随机颜色中夹着长短不一的透明段
+static void Make_Atlas(void)
+{
+	u32 i,k,n;
+	u16 *p=&atlas[0][0];
+	u16 c;
+	u8 key;
+
+	for(i=0;i<AW*AH;i+=n)
+	{
+		n=1+Rand(Rand(4)?6:60);
+		if(n>AW*AH-i)n=AW*AH-i;
+		key=Rand(3)==0;
+		for(k=0;k<n;k++)
+		{
+			c=Rand(0x10000);
+			if(c==KEY)c^=1;
+			p[i+k]=key?KEY:c;
+		}
+	}
+}
+
+//随机取一块写入,同时算出参考结果,返回应写出的像素数
+static u32 Blit_Random(u8 mode)
+{
+	u16 w=1+Rand(Rand(3)?40:AW),h=1+Rand(Rand(3)?40:AH);
+	u16 ax=Rand(AW-w+1),ay=Rand(AH-h+1);
+	u16 x=Rand(EMU_W+20),y=Rand(EMU_H+20);
+	u16 sx=0,sy=0,ex=EMU_W-1,ey=EMU_H-1;
+	u16 i,j,c;
+	u32 n=0;
+
+	if(Rand(4)==0)
+	{
+		sx=Rand(EMU_W);
+		sy=Rand(EMU_H);
+		ex=sx+Rand(EMU_W-sx);
+		ey=sy+Rand(EMU_H-sy);
+		LCD_Set_Clip(sx,sy,ex,ey);
+	}
+	if(mode==2)			//LCD_Color_Fill只能写连续的数组
+	{
+		w=1+Rand(AW);
+		h=1+Rand(AW*AH/w);
+		if(h>EMU_H)h=EMU_H;
+		LCD_Color_Fill(x,y,x+w-1,y+h-1,&atlas[0][0]);
+	}
+	else if(mode==1)LCD_Blit_Key(x,y,w,h,&atlas[ay][ax],AW,KEY);
+	else LCD_Blit(x,y,w,h,&atlas[ay][ax],AW);
+	LCD_Reset_Clip();
+	for(i=0;i<h;i++)
+		for(j=0;j<w;j++)
+		{
+			if(x+j<sx||x+j>ex||y+i<sy||y+i>ey)continue;
+			c=mode==2?(&atlas[0][0])[(u32)i*w+j]:atlas[ay+i][ax+j];
+			if(mode==1&&c==KEY)continue;
+			ref[y+i][x+j]=c;
+			n++;
+		}
+	return n;
+}
+
+static void Test_Random(void)
+{
+	u32 r,n,bad=0;
+	u8 mode;
+
+	LCD_Clear(GRAY);
+	LCD_DMA_Wait();
+	memcpy(ref,emu.gram,sizeof ref);
+	for(r=0;r<2000;r++)
+	{
+		mode=Rand(5);
+		if(mode>2)mode=0;
+		Emu_Clear_Count();
+		n=Blit_Random(mode);
+		LCD_DMA_Wait();
+		if(memcmp(emu.gram,ref,sizeof ref)||emu.n.pixel!=n)
+		{
+			if(bad++<5)printf("blit %u (mode %u): %u px written, %u expected\n",r,mode,emu.n.pixel,n);
+			memcpy(ref,emu.gram,sizeof ref);
+		}
+	}
+	printf("2000 random blits: %u differ\n",bad);
+	HOST_CHECK(bad==0);
+	HOST_CHECK(emu.outside==0);
+}
+
+//每行一次LCD_Color_Fill,LCD_Blit之前写大图中一块的办法
+static void Fill_Rows(u16 x,u16 y,u16 w,u16 h,const u16 *src)
+{
+	u16 i;
+
+	for(i=0;i<h;i++)LCD_Color_Fill(x,y+i,x+w-1,y+i,(u16 *)src+(u32)i*AW);
+}
+
+//每段不透明的像素一次LCD_Color_Fill
+static void Fill_Runs(u16 x,u16 y,u16 w,u16 h,const u16 *src)
+{
+	u16 i,j,k;
+
+	for(i=0;i<h;i++,src+=AW)
+		for(j=0;j<w;j=k)
+		{
+			if(src[j]==KEY)
+			{
+				k=j+1;
+				continue;
+			}
+			for(k=j;k<w&&src[k]!=KEY;k++);
+			LCD_Color_Fill(x+j,y+i,x+k-1,y+i,(u16 *)src+j);
+		}
+}
+
+//拷贝成连续数组再一次LCD_Color_Fill
+static void Fill_Packed(u16 x,u16 y,u16 w,u16 h,const u16 *src)
+{
+	u16 i;
+
+	for(i=0;i<h;i++)memcpy(packed+(u32)i*w,src+(u32)i*AW,w*2);
+	LCD_Color_Fill(x,y,x+w-1,y+h-1,packed);
+}
+
+static void Blit(u16 x,u16 y,u16 w,u16 h,const u16 *src)
+{
+	LCD_Blit(x,y,w,h,src,AW);
+}
+
+static void Blit_Key(u16 x,u16 y,u16 w,u16 h,const u16 *src)
+{
+	LCD_Blit_Key(x,y,w,h,src,AW,KEY);
+}
+
+typedef struct
+{
+	const char *name;
+	void (*fn)(u16 x,u16 y,u16 w,u16 h,const u16 *src);
+	u8 ref;				//1:这一项的结果作为后面各项的参考
+}_bench;
+
+static const _bench bench[]=
+{
+	{"LCD_Blit",Blit,1},
+	{"LCD_Color_Fill per row",Fill_Rows,0},
+	{"copy + LCD_Color_Fill",Fill_Packed,0},
+	{"LCD_Blit_Key",Blit_Key,1},
+	{"LCD_Color_Fill per run",Fill_Runs,0},
+};
+
+//各种大小的块用各方法写入,打印总线写次数和主机上每次的时间,结果应相同
+static void Test_Bench(void)
+{
+	static const u16 size[][2]={{16,16},{48,48},{200,100},{EMU_W,200}};
+	const u16 *src;
+	u16 s,b,w,h;
+	u32 r,reps;
+	double t0,t1;
+
+	printf("%-24s %9s %6s %6s %7s %9s\n","call","size","cmd","data","pixel","ns/call");
+	for(s=0;s<sizeof size/sizeof size[0];s++)
+	{
+		w=size[s][0];
+		h=size[s][1];
+		src=&atlas[7][3];
+		reps=2000000/((u32)w*h)+1;
+		for(b=0;b<sizeof bench/sizeof bench[0];b++)
+		{
+			LCD_Clear(GRAY);
+			LCD_DMA_Wait();
+			bench[b].fn(0,0,w,h,src);
+			LCD_DMA_Wait();
+			if(bench[b].ref)memcpy(ref,emu.gram,sizeof ref);
+			else HOST_CHECK(memcmp(emu.gram,ref,sizeof ref)==0);
+			Emu_Clear_Count();
+			t0=Now();
+			for(r=0;r<reps;r++)bench[b].fn(0,0,w,h,src);
+			LCD_DMA_Wait();
+			t1=Now();
+			printf("%-24s %4ux%-4u %6u %6u %7u %9.0f\n",bench[b].name,w,h,emu.n.cmd/reps,emu.n.data/reps,
+				emu.n.pixel/reps,(t1-t0)*1e9/reps);
+		}
+	}
+}
+
+int main(void)
+{
+	Emu_Reset();
+	TFTLCD_Init();
+	LCD_DMA_Wait();
+	Make_Atlas();
+	Test_Random();
+	Test_Bench();
+	return Host_Result("t_blit");
+}
@@ -0,0 +1,214 @@
+#include "host.h"
+#include "dht11.h"
+#include "time.h"
+#include "swtimer.h"
+#include "evq.h"
+#include <stdio.h>
+
+//DHT11非阻塞读取测试:虚拟时间每毫秒调用SwTimer_Poll,驱动把PG11设为上拉输入(释放总线)时,
+//这里模拟DHT11发出一帧:每个下降沿设置TIM6->CNT(1us时间戳,加上中断延迟的抖动)和EXTI->PR,
+//调用EXTI15_10_IRQHandler;结果从事件队列取出
+//1.正常一帧,起始信号的长度,DHT11_Get的读数和时间
+//2.时间戳跨过TIM6的16位回绕
+//3.校验和错一次后重试成功;无应答时按1,2,4秒退避重试,用完后报告失败;多一个毛刺边沿时重试
+//4.DHT11_Decode对中断延迟抖动的容忍:抖动不超过20us时全部正确,更大时打印解出的比例和校验和没能发现的错误
+
+#define MODE_OK		0
+#define MODE_NORESP	1		//没有应答
+#define MODE_SUM	2		//校验和错
+#define MODE_GLITCH	3		//多一个下降沿
+
+void EXTI15_10_IRQHandler(void);
+
+static u8 sensor[5]={45,0,23,0,0};		//湿度45%,温度23度
+static u8 mode[8];
+static u8 modes=0,frames=0;
+static u16 jitter=5;
+static u16 cnt_base=0;				//TIM6计数值的起点,测试回绕
+static u32 rnd=1;
+static u32 low_at,low_ms;			//起始信号开始的时间和长度
+
+
+//TIM6只作时间戳,计数值由Edge设置;time.c的其他定时器要连上按键和串口3,这里不用它
+void TIM6_Init(void){}
+
+static u32 Rand(u32 n)
+{
+	rnd=rnd*1103515245+12345;
+	return (rnd>>8)%n;
+}
+
+//PG11是否为上拉输入
+static u8 Pin_Released(void)
+{
+	return ((GPIOG->CRH>>12)&0xF)==0x8;
+}
+
+//t us时的下降沿
+static void Edge(u32 t)
+{
+	TIM6->CNT=(u16)(cnt_base+Host_Us()+t+Rand(jitter+1));
+	EXTI->PR|=EXTI_Line11;
+	EXTI15_10_IRQHandler();
+}
+
+//DHT11的一帧:应答80us低80us高,每位50us低加27us(0)或70us(1)高,最后一个下降沿结束
+static void Frame(void)
+{
+	u8 b[5],i,m=frames<modes?mode[frames]:MODE_OK;
+	u32 t=30;
+
+	frames++;
+	if(m==MODE_NORESP)return;
+	for(i=0;i<4;i++)b[i]=sensor[i];
+	b[4]=b[0]+b[1]+b[2]+b[3];
+	if(m==MODE_SUM)b[4]^=4;
+	Edge(t);
+	t+=160;
+	for(i=0;i<40;i++)
+	{
+		Edge(t);
+		if(m==MODE_GLITCH&&i==20)Edge(t+20);
+		t+=50+((b[i>>3]>>(7-(i&7)))&1?70:27);
+	}
+	Edge(t);
+}
+
+//每毫秒运行一次,直到有事件或超时
+static u8 Run(u32 max_ms,_event *ev)
+{
+	u8 out=!Pin_Released(),rel;
+
+	while(max_ms--)
+	{
+		Host_Advance_Us(1000);
+		SwTimer_Poll();
+		rel=Pin_Released();
+		if(!rel&&!out)low_at=SysTick_Ms();		//开始起始信号
+		if(rel&&out)
+		{
+			low_ms=SysTick_Ms()-low_at;
+			Frame();
+		}
+		out=!rel;
+		if(EvQ_Get(ev))return 1;
+	}
+	return 0;
+}
+
+//开始测量,记下起始信号开始的时间;重试时由Run记录
+static u8 Start(void)
+{
+	low_at=SysTick_Ms();
+	return DHT11_Start();
+}
+
+static void Set_Modes(u8 n,u8 m)
+{
+	u8 i;
+
+	for(i=0;i<n;i++)mode[i]=m;
+	modes=n;
+	frames=0;
+}
+
+static void Test_Read(void)
+{
+	_event ev;
+	u8 t,h;
+	u32 age,t0,err0;
+
+	HOST_CHECK(DHT11_Get(&t,&h,&age)==1);		//还没有读数
+
+	//正常一帧
+	t0=SysTick_Ms();
+	HOST_CHECK(Start()==1);
+	HOST_CHECK(DHT11_Start()==0);				//测量中
+	HOST_CHECK(Run(100,&ev)&&ev.type==EV_DHT11&&ev.arg==((DHT11_OK<<16)|(23<<8)|45));
+	printf("clean frame: event after %u ms, start pulse %u ms\n",SysTick_Ms()-t0,low_ms);
+	HOST_CHECK(low_ms>=18&&low_ms<=DHT11_START_MS+1);
+	HOST_CHECK(SysTick_Ms()-t0<=DHT11_START_MS+DHT11_WAIT_MS+2);
+	HOST_CHECK(!(EXTI->IMR&EXTI_Line11));		//一帧结束后关闭中断
+	Host_Advance_Us(1500000);
+	HOST_CHECK(DHT11_Get(&t,&h,&age)==0&&t==23&&h==45&&age>=1500&&age<1600);
+
+	//时间戳跨过16位回绕
+	cnt_base=65536-2000;
+	HOST_CHECK(Start());
+	HOST_CHECK(Run(100,&ev)&&ev.arg==((DHT11_OK<<16)|(23<<8)|45));
+	cnt_base=0;
+
+	//校验和错一次,1秒后重试成功
+	err0=dht11_errors;
+	Set_Modes(1,MODE_SUM);
+	t0=SysTick_Ms();
+	HOST_CHECK(Start());
+	HOST_CHECK(Run(5000,&ev)&&ev.arg==((DHT11_OK<<16)|(23<<8)|45));
+	HOST_CHECK(frames==2&&dht11_errors==err0+1);
+	HOST_CHECK(SysTick_Ms()-t0>=DHT11_BACKOFF_MS);
+	printf("checksum error then ok: event after %u ms\n",SysTick_Ms()-t0);
+
+	//多一个毛刺边沿,重试
+	Set_Modes(1,MODE_GLITCH);
+	HOST_CHECK(Start());
+	HOST_CHECK(Run(5000,&ev)&&ev.arg==((DHT11_OK<<16)|(23<<8)|45));
+	HOST_CHECK(frames==2);
+
+	//一直无应答:重试DHT11_RETRY_MAX次,间隔1,2,4秒,之后报告失败
+	err0=dht11_errors;
+	Set_Modes(8,MODE_NORESP);
+	t0=SysTick_Ms();
+	HOST_CHECK(Start());
+	HOST_CHECK(Run(20000,&ev)&&ev.arg==((u32)DHT11_ERR_NORESP<<16));
+	printf("no response: failure after %u ms, %u attempts\n",SysTick_Ms()-t0,frames);
+	HOST_CHECK(frames==DHT11_RETRY_MAX+1&&dht11_errors==err0+DHT11_RETRY_MAX+1);
+	HOST_CHECK(SysTick_Ms()-t0>=(u32)DHT11_BACKOFF_MS*7);
+	HOST_CHECK(Start());					//失败后可以重新开始
+	modes=0;
+	HOST_CHECK(Run(100,&ev)&&(ev.arg>>16)==DHT11_OK);
+	HOST_CHECK(DHT11_Get(&t,&h,&age)==0&&age<100);
+}
+
+//随机数据,边沿时间加0~j us的抖动,只解码
+static void Test_Jitter(void)
+{
+	u16 e[DHT11_EDGES],j;
+	u8 b[5],o[5],k;
+	u32 i,t,ok,bad;
+
+	for(j=0;j<=40;j+=10)
+	{
+		ok=bad=0;
+		for(i=0;i<2000;i++)
+		{
+			for(k=0;k<4;k++)b[k]=Rand(256);
+			b[4]=b[0]+b[1]+b[2]+b[3];
+			t=30+Rand(60000);
+			e[0]=(u16)(t+Rand(j+1));
+			t+=160;
+			for(k=0;k<40;k++)
+			{
+				e[k+1]=(u16)(t+Rand(j+1));
+				t+=50+((b[k>>3]>>(7-(k&7)))&1?70:27);
+			}
+			e[41]=(u16)(t+Rand(j+1));
+			if(DHT11_Decode(e,DHT11_EDGES,o)!=DHT11_OK)continue;
+			if(o[0]==b[0]&&o[1]==b[1]&&o[2]==b[2]&&o[3]==b[3])ok++;
+			else bad++;
+		}
+		printf("ISR latency jitter 0..%2u us: %4u/2000 decoded, %u wrong values accepted\n",j,ok,bad);
+		if(j<=20)HOST_CHECK(ok==2000&&bad==0);
+	}
+	HOST_CHECK(DHT11_Decode(e,DHT11_EDGES-1,o)==DHT11_ERR_NORESP);
+}
+
+int main(void)
+{
+	Host_Set_Us(5000000);
+	SwTimer_Init();
+	EvQ_Init();
+	DHT11_Init();
+	Test_Read();
+	Test_Jitter();
+	return Host_Result("t_dht11");
+}
@@ -0,0 +1,137 @@
+#include "host.h"
+#include "evq.h"
+#include <stdio.h>
+#include <pthread.h>
+#include <sched.h>
+
+//事件队列测试
+//1.单线程:按放入顺序取出,队列满时丢弃并计数,积压峰值
+//2.压力测试:几个线程同时放入事件(代替不同优先级、互相抢占的中断),主线程一边取出,
+//  每个线程的事件按放入顺序取到、没有丢失和重复,队列满时放入失败的次数与evq_dropped相同
+
+#define PRODUCERS	4
+#define PER_THREAD	200000
+
+typedef struct
+{
+	u8 id;
+	u32 fails;			//队列满时放入失败的次数
+}_producer;
+
+static volatile u8 go=0;
+
+
+//单线程
+static void Test_Basic(void)
+{
+	_event ev;
+	u32 i;
+
+	EvQ_Init();
+	HOST_CHECK(!EvQ_Pending());
+	HOST_CHECK(EvQ_Get(&ev)==0);
+	Host_Set_Us(1234);
+	HOST_CHECK(EvQ_Post(EV_IR,0x00FF30CF));
+	HOST_CHECK(EvQ_Post(EV_KEY,2));
+	HOST_CHECK(EvQ_Pending());
+	HOST_CHECK(EvQ_Get(&ev)&&ev.type==EV_IR&&ev.arg==0x00FF30CF&&ev.time==1234);
+	HOST_CHECK(EvQ_Get(&ev)&&ev.type==EV_KEY&&ev.arg==2);
+	HOST_CHECK(!EvQ_Pending());
+	HOST_CHECK(evq_peak==2);
+
+	//放满之后的丢弃,取走一个又能放入
+	for(i=0;i<EVQ_SIZE+8;i++)EvQ_Post(EV_ADC,i);
+	HOST_CHECK(evq_dropped==8);
+	HOST_CHECK(EvQ_Post(EV_ADC,999)==0);
+	HOST_CHECK(EvQ_Get(&ev)&&ev.arg==0);
+	HOST_CHECK(evq_peak==EVQ_SIZE);
+	HOST_CHECK(EvQ_Post(EV_ADC,1000));
+	for(i=1;i<EVQ_SIZE;i++)HOST_CHECK(EvQ_Get(&ev)&&ev.arg==i);
+	HOST_CHECK(EvQ_Get(&ev)&&ev.arg==1000);
+	HOST_CHECK(EvQ_Get(&ev)==0);
+	HOST_CHECK(evq_dropped==9);
+
+	//读写位置转很多圈
+	for(i=0;i<100000;i++)
+	{
+		EvQ_Post(EV_RTC_SEC,i);
+		EvQ_Post(EV_RTC_SEC,i+1);
+		HOST_CHECK(EvQ_Get(&ev)&&ev.arg==i);
+		HOST_CHECK(EvQ_Get(&ev)&&ev.arg==i+1);
+	}
+	HOST_CHECK(evq_dropped==9);
+}
+
+//放入事件的线程,arg为线程号<<24|序号,放入失败时重试同一序号
+static void *Producer(void *p)
+{
+	_producer *pr=(_producer *)p;
+	u32 seq=0;
+
+	while(!go)sched_yield();
+	while(seq<PER_THREAD)
+	{
+		if(EvQ_Post(EV_KEY,(u32)pr->id<<24|seq))seq++;
+		else
+		{
+			pr->fails++;
+			sched_yield();
+		}
+	}
+	return 0;
+}
+
+static void Test_Stress(void)
+{
+	pthread_t th[PRODUCERS];
+	_producer pr[PRODUCERS];
+	u32 next[PRODUCERS];
+	u32 got=0,bad=0,fails=0,id,seq;
+	_event ev;
+	u8 i;
+
+	EvQ_Init();
+	for(i=0;i<PRODUCERS;i++)
+	{
+		pr[i].id=i;
+		pr[i].fails=0;
+		next[i]=0;
+		pthread_create(&th[i],0,Producer,&pr[i]);
+	}
+	go=1;
+	while(got<PRODUCERS*PER_THREAD)
+	{
+		if(!EvQ_Get(&ev))
+		{
+			sched_yield();
+			continue;
+		}
+		id=ev.arg>>24;
+		seq=ev.arg&0xFFFFFF;
+		if(ev.type!=EV_KEY||id>=PRODUCERS||seq!=next[id])
+		{
+			if(bad++<10)printf("got type %u arg %08x, expected %u\n",ev.type,ev.arg,id<PRODUCERS?next[id]:0);
+			if(id<PRODUCERS)next[id]=seq+1;
+		}
+		else next[id]++;
+		got++;
+	}
+	for(i=0;i<PRODUCERS;i++)
+	{
+		pthread_join(th[i],0);
+		fails+=pr[i].fails;
+	}
+	printf("stress: %u threads, %u events, %u full, peak %u\n",PRODUCERS,got,evq_dropped,evq_peak);
+	HOST_CHECK(bad==0);
+	HOST_CHECK(got==PRODUCERS*PER_THREAD);
+	HOST_CHECK(EvQ_Get(&ev)==0);
+	HOST_CHECK(evq_dropped==fails);
+	HOST_CHECK(evq_peak<=EVQ_SIZE);
+}
+
+int main(void)
+{
+	Test_Basic();
+	Test_Stress();
+	return Host_Result("t_evq");
+}
@@ -0,0 +1,186 @@
+#include "host.h"
+#include "lcd_emu.h"
+#include "tftlcd.h"
+#include "lcd_dma.h"
+#include "lcd_glyph.h"
+#include <stdio.h>
+#include <string.h>
+#include <time.h>
+
+//字符点阵缓存测试:同一串文字分别由开启缓存(t_glyph)和关闭缓存(t_glyph_off,tftlcd.c用-DLCD_GLYPH_CACHE=0编译)的驱动显示
+//文字是界面上的几个字段(时间,温湿度,服药信息),位置和颜色固定,大小12/16/24(缓存)和32/48(不缓存),有时设置裁剪区域
+//打印每秒显示的字符串数和每个字符的总线开销,开启缓存时打印命中和未命中次数
+//关闭缓存的程序先运行,把每个字符串显示后所在区域的校验值,总线写次数和最后的屏幕存入<输出目录>/glyph_off.bin,
+//开启缓存的程序与之比较,屏幕应逐字节相同
+//用法:t_glyph <输出目录>
+
+#define NSTR	3000		//每轮显示的字符串数
+#define ROUNDS	10			//计时的轮数
+
+typedef struct
+{
+	u32 sum[NSTR];			//每个字符串显示后所在区域的校验值
+	EmuCount n;				//一轮的总线写次数
+	u32 chars;				//一轮的字符数
+	u16 gram[EMU_H][EMU_W];	//最后的屏幕
+}_result;
+
+typedef struct
+{
+	u16 x;
+	u16 y;
+	u8 size;
+	u8 kind;				//字段内容
+	u16 fg;
+	u16 bg;
+}_field;
+
+//界面上的字段:位置,大小,颜色固定,内容随时间变化;32和48号字不缓存
+static const _field fields[]=
+{
+	{8,8,16,0,WHITE,BLUE},
+	{16,56,48,3,BLACK,WHITE},
+	{16,112,32,3,BLACK,WHITE},
+	{16,160,24,1,BLACK,WHITE},
+	{16,192,16,2,RED,WHITE},
+	{16,216,12,1,BLACK,WHITE},
+	{180,216,12,3,BLACK,WHITE},
+	{160,8,16,3,WHITE,BLUE},
+};
+static _result res;
+#if LCD_GLYPH_CACHE
+static _result ref;			//关闭缓存时的结果
+#endif
+static u32 rnd;
+
+
+static u32 Rand(u32 n)
+{
+	rnd=rnd*1103515245+12345;
+	return (rnd>>8)%n;
+}
+
+static double Now(void)
+{
+	struct timespec t;
+
+	clock_gettime(CLOCK_MONOTONIC,&t);
+	return t.tv_sec+t.tv_nsec*1e-9;
+}
+
+//区域内像素的校验值(FNV-1a)
+static u32 Sum(u16 sx,u16 sy,u16 ex,u16 ey)
+{
+	u32 h=2166136261u;
+	u16 x,y;
+
+	if(ex>=EMU_W)ex=EMU_W-1;
+	if(ey>=EMU_H)ey=EMU_H-1;
+	for(y=sy;y<=ey;y++)
+		for(x=sx;x<=ex;x++)
+		{
+			h^=emu.gram[y][x];
+			h*=16777619u;
+		}
+	return h;
+}
+
+//一轮:NSTR个字符串,sum不为0时记下每个字符串显示后的校验值
+static u32 Run(u32 *sum)
+{
+	char s[40];
+	u16 x,y,w;
+	u32 i,chars=0;
+	const _field *f;
+	u8 size,len;
+
+	rnd=12345;
+	for(i=0;i<NSTR;i++)
+	{
+		f=&fields[Rand(sizeof fields/sizeof fields[0])];
+		switch(f->kind)
+		{
+		case 0:sprintf(s,"2026-10-%02u %02u:%02u",1+Rand(31),Rand(24),Rand(60));break;
+		case 1:sprintf(s,"Temp:%uC Humi:%u%%",10+Rand(30),20+Rand(70));break;
+		case 2:sprintf(s,"Next: Vitamin_C %02u:%02u",Rand(24),Rand(60));break;
+		default:sprintf(s,"%02u:%02u",Rand(24),Rand(60));break;
+		}
+		size=f->size;
+		len=strlen(s);
+		w=len*(size/2);
+		x=f->x;
+		y=f->y;
+		FRONT_COLOR=f->fg;
+		BACK_COLOR=f->bg;
+		if(Rand(8)==0)LCD_Set_Clip(x+Rand(w),y+Rand(size),EMU_W-1-Rand(40),EMU_H-1);
+		LCD_ShowString(x,y,EMU_W-x,size,size,(u8 *)s);
+		LCD_Reset_Clip();
+		chars+=len;
+		if(sum)
+		{
+			LCD_DMA_Wait();
+			sum[i]=Sum(x,y,x+w-1,y+size-1);
+		}
+	}
+	LCD_DMA_Wait();
+	return chars;
+}
+
+int main(int argc,char *argv[])
+{
+	const char *out_dir=argc>1?argv[1]:".";
+	char path[256];
+	double t0,t1;
+	u32 i;
+	FILE *f;
+
+	snprintf(path,sizeof path,"%s/glyph_off.bin",out_dir);
+	Emu_Reset();
+	TFTLCD_Init();
+	LCD_Clear(GRAY);
+	LCD_DMA_Wait();
+#if LCD_GLYPH_CACHE
+	LCD_Glyph_Clear();
+#endif
+	Emu_Clear_Count();
+	res.chars=Run(res.sum);
+	res.n=emu.n;
+	memcpy(res.gram,emu.gram,sizeof res.gram);
+	HOST_CHECK(emu.outside==0);
+
+	t0=Now();
+	for(i=0;i<ROUNDS;i++)Run(0);
+	t1=Now();
+	printf("glyph cache %-3s %u strings %u chars: %8.0f strings/s %6.1f ns/char, per char %.2f cmd %.2f data %.1f px\n",
+		LCD_GLYPH_CACHE?"on":"off",NSTR,res.chars,NSTR*ROUNDS/(t1-t0),(t1-t0)*1e9/((double)res.chars*ROUNDS),
+		(double)res.n.cmd/res.chars,(double)res.n.data/res.chars,(double)res.n.pixel/res.chars);
+
+#if LCD_GLYPH_CACHE
+	printf("glyph cache: %u hits %u misses (%.1f%% hit)\n",lcd_glyph_hit,lcd_glyph_miss,
+		100.0*lcd_glyph_hit/(lcd_glyph_hit+lcd_glyph_miss));
+	HOST_CHECK(lcd_glyph_hit>lcd_glyph_miss);
+	f=fopen(path,"rb");
+	HOST_CHECK(f!=0);
+	if(f)
+	{
+		u32 bad=0;
+
+		HOST_CHECK(fread(&ref,sizeof ref,1,f)==1);
+		fclose(f);
+		for(i=0;i<NSTR;i++)if(res.sum[i]!=ref.sum[i])bad++;
+		printf("against the uncached driver: %u of %u strings differ\n",bad,NSTR);
+		HOST_CHECK(bad==0);
+		HOST_CHECK(memcmp(res.gram,ref.gram,sizeof res.gram)==0);
+		HOST_CHECK(res.chars==ref.chars&&res.n.pixel==ref.n.pixel);
+	}
+#else
+	f=fopen(path,"wb");
+	HOST_CHECK(f!=0);
+	if(f)
+	{
+		HOST_CHECK(fwrite(&res,sizeof res,1,f)==1);
+		fclose(f);
+	}
+#endif
+	return Host_Result(LCD_GLYPH_CACHE?"t_glyph":"t_glyph_off");
+}
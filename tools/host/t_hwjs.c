@@ -0,0 +1,188 @@
+#include "host.h"
+#include "hwjs.h"
+#include "evq.h"
+#include <stdio.h>
+
+//NEC红外解码测试:在虚拟时间上产生下降沿,设置TIM6->CNT(加上抖动)和EXTI->PR,调用EXTI9_5_IRQHandler
+//按键码取自main.c中的IR_KEY*定义(由Makefile生成ir_keys.h)
+//1.每个按键的完整一帧,±40us抖动,起点随机,TIM6在帧内的任意位置回绕
+//2.按住按键:一帧之后每108ms一个重复码,每个都报告同一按键;太久之后的重复码不报告
+//3.干扰:帧前的毛刺,帧不完整后发送方停下,帧内多一个毛刺;坏帧不产生错误的按键码,之后的帧正常
+
+typedef struct
+{
+	const char *name;
+	u32 code;
+}_irkey;
+
+static const _irkey keys[]=
+{
+#include "ir_keys.h"
+};
+
+#define NK		(sizeof keys/sizeof keys[0])
+#define JITTER	40
+
+void EXTI9_5_IRQHandler(void);
+
+static u32 rnd=1;
+static s16 jitter=JITTER;
+static u32 edges=0;
+
+
+//TIM6只作时间戳,计数值由Edge设置
+void TIM6_Init(void){}
+
+static u32 Rand(u32 n)
+{
+	rnd=rnd*1103515245+12345;
+	return (rnd>>8)%n;
+}
+
+//us时刻的下降沿
+static void Edge(u64 us)
+{
+	s16 j=jitter?(s16)Rand(2*jitter+1)-jitter:0;
+
+	Host_Set_Us(us);
+	TIM6->CNT=(u16)(us+j);
+	EXTI->PR|=EXTI_Line9;
+	EXTI9_5_IRQHandler();
+	edges++;
+}
+
+//从t开始的一帧:引导码13.5ms,32位数据从高位起,0为1.125ms,1为2.25ms,最后一个下降沿结束
+//返回值:最后一个下降沿的时间
+static u64 Frame(u64 t,u32 code)
+{
+	s8 i;
+
+	Edge(t);
+	t+=13500;
+	for(i=31;i>=0;i--)
+	{
+		Edge(t);
+		t+=(code>>i)&1?2250:1125;
+	}
+	Edge(t);
+	return t;
+}
+
+//重复码:9ms低+2.25ms高,两个下降沿
+static void Repeat(u64 t)
+{
+	Edge(t);
+	Edge(t+11250);
+}
+
+//取出全部事件,返回个数
+static u8 Drain(_event *ev,u8 max)
+{
+	u8 n=0;
+
+	while(n<max&&EvQ_Get(&ev[n]))n++;
+	return n;
+}
+
+static void Test_Keys(void)
+{
+	_event ev[16];
+	u32 r,i,bad=0;
+	u8 n;
+
+	for(r=0;r<50;r++)
+		for(i=0;i<NK;i++)
+		{
+			Frame(Host_Us()+100000+Rand(70000),keys[i].code);
+			Host_Advance_Us(100000);
+			n=Drain(ev,16);
+			if(n!=1||ev[0].type!=EV_IR||ev[0].arg!=keys[i].code)
+			{
+				if(bad++<5)printf("%s: %u events, code %08x\n",keys[i].name,n,n?ev[0].arg:0);
+			}
+		}
+	printf("%u keys x 50 frames with +-%u us jitter: %u decoded, %u errors\n",(u32)NK,JITTER,hw_frames,hw_errors);
+	HOST_CHECK(NK>=21);
+	HOST_CHECK(bad==0&&hw_frames==NK*50&&hw_errors==0);
+}
+
+static void Test_Repeat(void)
+{
+	_event ev[16];
+	u64 t;
+	u32 i,rep0=hw_repeats;
+	u8 n,j,ok;
+
+	for(i=0;i<NK;i++)
+	{
+		t=Host_Us()+300000;
+		Frame(t,keys[i].code);
+		for(j=1;j<=10;j++)Repeat(t+108000*j);
+		Host_Advance_Us(200000);
+		n=Drain(ev,16);
+		ok=n==11&&ev[0].type==EV_IR&&ev[0].arg==keys[i].code;
+		for(j=1;j<n;j++)ok&=ev[j].type==EV_IR_REP&&ev[j].arg==keys[i].code;
+		HOST_CHECK(ok);
+	}
+	HOST_CHECK(hw_repeats-rep0==NK*10);
+
+	//上一帧之后很久的重复码
+	Repeat(Host_Us()+1000000);
+	Host_Advance_Us(100000);
+	HOST_CHECK(Drain(ev,16)==0);
+}
+
+static void Test_Noise(void)
+{
+	_event ev[16];
+	u64 t;
+	u32 err0;
+	u8 n,j;
+
+	//帧前的毛刺
+	t=Host_Us()+500000;
+	for(j=0;j<5;j++)Edge(t+j*700+Rand(500));
+	Frame(t+80000,keys[3].code);
+	Host_Advance_Us(100000);
+	n=Drain(ev,16);
+	HOST_CHECK(n==1&&ev[0].arg==keys[3].code);
+
+	//帧不完整,发送方停下,100ms后完整的一帧
+	t=Host_Us()+100000;
+	Edge(t);
+	Edge(t+13500);
+	for(j=1;j<=10;j++)Edge(t+13500+1125*j);
+	Frame(t+100000,keys[7].code);
+	Host_Advance_Us(100000);
+	n=Drain(ev,16);
+	HOST_CHECK(n==1&&ev[0].type==EV_IR&&ev[0].arg==keys[7].code);
+
+	//帧内多一个毛刺:这一帧丢弃并计数,不产生按键码
+	err0=hw_errors;
+	t=Host_Us()+100000;
+	Edge(t);
+	t+=13500;
+	for(j=0;j<15;j++)Edge(t+1125*j);
+	Edge(t+1125*14+300);
+	for(j=15;j<33;j++)Edge(t+1125*j);
+	Host_Advance_Us(100000);
+	n=Drain(ev,16);
+	HOST_CHECK(n==0);
+	HOST_CHECK(hw_errors>err0);
+	Frame(Host_Us()+100000,keys[0].code);
+	Host_Advance_Us(100000);
+	n=Drain(ev,16);
+	HOST_CHECK(n==1&&ev[0].arg==keys[0].code);
+}
+
+int main(void)
+{
+	Host_Set_Us(123456789);
+	EvQ_Init();
+	Hwjs_Init();
+	Test_Keys();
+	Test_Repeat();
+	Test_Noise();
+	printf("%u edges, %u frames, %u repeats, %u errors\n",edges,hw_frames,hw_repeats,hw_errors);
+	return Host_Result("t_hwjs");
+}
@@ -0,0 +1,248 @@
+#include "host.h"
+#include "lcd_emu.h"
+#include "tftlcd.h"
+#include "lcd_dma.h"
+#include "font.h"
+#include <stdio.h>
+#include <string.h>
+#include <time.h>
+
+//汉字显示测试:LCD_ShowFontHZ经LCD模拟器运行,结果与按字模逐点计算的相同
+//1.字库CnChar32x29中的每个汉字,随机位置和颜色,只写该字的32*29区域
+//2.字库中没有的汉字留空,不写任何像素,后面的字照常右移32
+//3.超出屏幕右边和下边,以及设置了裁剪区域时只写可见部分
+//4.打印每秒显示的汉字数,与原来逐个比较字库,每像素开一次窗口的实现(tftlcd.c中#if 0的部分)对照
+
+#define HZ_N	(sizeof CnChar32x29/sizeof CnChar32x29[0])
+
+static const u8 missing[2]={0xB0,0xA1};		//字库中没有的汉字
+static u16 ref[EMU_H][EMU_W];
+static u32 rnd=1;
+
+
+static u32 Rand(u32 n)
+{
+	rnd=rnd*1103515245+12345;
+	return (rnd>>8)%n;
+}
+
+static double Now(void)
+{
+	struct timespec t;
+
+	clock_gettime(CLOCK_MONOTONIC,&t);
+	return t.tv_sec+t.tv_nsec*1e-9;
+}
+
+//在字库中查找,没有时返回0
+static const u8 *Msk(const u8 *cn)
+{
+	u8 i;
+
+	for(i=0;i<HZ_N;i++)
+		if(CnChar32x29[i].Index[0]==cn[0]&&CnChar32x29[i].Index[1]==cn[1])return CnChar32x29[i].Msk;
+	return 0;
+}
+
+//按字模逐点画到ref,只画裁剪区域sx~ex,sy~ey内的部分
+static void Ref_HZ(u16 x,u16 y,const u8 *cn,u16 sx,u16 sy,u16 ex,u16 ey)
+{
+	const u8 *m;
+	u16 r,c;
+
+	for(;cn[0]&&cn[1];cn+=2,x+=32)
+	{
+		m=Msk(cn);
+		if(m==0)continue;
+		for(r=0;r<29;r++)
+			for(c=0;c<32;c++)
+			{
+				if(x+c<sx||x+c>ex||y+r<sy||y+r>ey)continue;
+				ref[y+r][x+c]=(m[r*4+c/8]&(0x80>>(c%8)))?FRONT_COLOR:BACK_COLOR;
+			}
+	}
+}
+
+//原来的实现:逐个比较字库,每个像素调用一次LCD_WriteData_Color,不裁剪
+static void Old_ShowFontHZ(u16 x,u16 y,u8 *cn)
+{
+	u8 i,j,wordNum;
+	u16 color;
+
+	while(*cn!='\0')
+	{
+		LCD_Set_Window(x,y,x+31,y+28);
+		for(wordNum=0;wordNum<HZ_N;wordNum++)
+		{
+			if((CnChar32x29[wordNum].Index[0]==*cn)&&(CnChar32x29[wordNum].Index[1]==*(cn+1)))
+			{
+				for(i=0;i<116;i++)
+				{
+					color=CnChar32x29[wordNum].Msk[i];
+					for(j=0;j<8;j++)
+					{
+						if((color&0x80)==0x80)LCD_WriteData_Color(FRONT_COLOR);
+						else LCD_WriteData_Color(BACK_COLOR);
+						color<<=1;
+					}
+				}
+			}
+		}
+		cn+=2;
+		x+=32;
+	}
+}
+
+//显示一串汉字,与逐点计算的比较
+static u8 Show(u16 x,u16 y,u8 *cn,u16 sx,u16 sy,u16 ex,u16 ey)
+{
+	LCD_Set_Clip(sx,sy,ex,ey);
+	LCD_ShowFontHZ(x,y,cn);
+	LCD_Reset_Clip();
+	LCD_DMA_Wait();
+	Ref_HZ(x,y,cn,sx,sy,ex,ey);
+	HOST_CHECK(emu.outside==0);
+	return memcmp(emu.gram,ref,sizeof ref)==0;
+}
+
+static void Test_Table(void)
+{
+	u8 s[3];
+	u16 i,r,x,y;
+
+	HOST_CHECK(HZ_N>0&&Msk(missing)==0);
+	for(r=0;r<50;r++)
+		for(i=0;i<HZ_N;i++)
+		{
+			s[0]=CnChar32x29[i].Index[0];
+			s[1]=CnChar32x29[i].Index[1];
+			s[2]=0;
+			x=Rand(EMU_W-31);
+			y=Rand(EMU_H-28);
+			FRONT_COLOR=Rand(0x10000);
+			BACK_COLOR=Rand(0x10000);
+			Emu_Clear_Count();
+			HOST_CHECK(Show(x,y,s,0,0,EMU_W-1,EMU_H-1));
+			HOST_CHECK(emu.n.pixel==32*29);
+		}
+}
+
+static void Test_Missing(void)
+{
+	u8 s[7];
+
+	s[0]=CnChar32x29[0].Index[0];
+	s[1]=CnChar32x29[0].Index[1];
+	s[2]=missing[0];
+	s[3]=missing[1];
+	s[4]=CnChar32x29[HZ_N-1].Index[0];
+	s[5]=CnChar32x29[HZ_N-1].Index[1];
+	s[6]=0;
+	FRONT_COLOR=BLACK;
+	BACK_COLOR=WHITE;
+	Emu_Clear_Count();
+	HOST_CHECK(Show(40,100,s,0,0,EMU_W-1,EMU_H-1));
+	HOST_CHECK(emu.n.pixel==2*32*29);
+	Emu_Clear_Count();
+	HOST_CHECK(Show(40,100,s+2,0,0,EMU_W-1,EMU_H-1));
+	HOST_CHECK(emu.n.pixel==32*29);				//只有后一个字
+	Emu_Clear_Count();
+	LCD_ShowFontHZ(40,150,(u8 *)missing);
+	LCD_DMA_Wait();
+	HOST_CHECK(emu.n.pixel==0&&emu.n.cmd==0);
+}
+
+static void Test_Clip(void)
+{
+	u8 s[2*12+1];
+	u8 one[3];
+	u16 i,r,x,y,sx,sy,ex,ey;
+	u32 bad=0;
+
+	for(r=0;r<500;r++)
+	{
+		for(i=0;i<12;i++)
+		{
+			if(Rand(6)==0)memcpy(s+2*i,missing,2);
+			else memcpy(s+2*i,CnChar32x29[Rand(HZ_N)].Index,2);
+		}
+		s[2*(1+Rand(12))]=0;
+		x=Rand(EMU_W);						//可超出屏幕右边和下边
+		y=Rand(EMU_H);
+		sx=0;
+		sy=0;
+		ex=EMU_W-1;
+		ey=EMU_H-1;
+		if(Rand(2))
+		{
+			sx=Rand(EMU_W);
+			sy=Rand(EMU_H);
+			ex=sx+Rand(EMU_W-sx);
+			ey=sy+Rand(EMU_H-sy);
+		}
+		FRONT_COLOR=Rand(0x10000);
+		BACK_COLOR=Rand(0x10000);
+		if(!Show(x,y,s,sx,sy,ex,ey))
+		{
+			if(bad++<5)printf("string at %u,%u clip %u,%u-%u,%u differs\n",x,y,sx,sy,ex,ey);
+			memcpy(ref,emu.gram,sizeof ref);
+		}
+	}
+	printf("500 clipped strings: %u differ\n",bad);
+	HOST_CHECK(bad==0);
+
+	//右下角只露出一部分
+	one[0]=CnChar32x29[0].Index[0];
+	one[1]=CnChar32x29[0].Index[1];
+	one[2]=0;
+	Emu_Clear_Count();
+	HOST_CHECK(Show(EMU_W-20,EMU_H-10,one,0,0,EMU_W-1,EMU_H-1));
+	HOST_CHECK(emu.n.pixel==20*10);
+}
+
+//每行9个字,第5个是字库中没有的
+static void Test_Bench(void)
+{
+	static const char *name[2]={"LCD_ShowFontHZ","old linear scan"};
+	u8 s[2*9+1];
+	u16 i,k;
+	u32 r,n;
+	double t0,t1;
+
+	for(i=0;i<9;i++)memcpy(s+2*i,i==4?missing:CnChar32x29[i%HZ_N].Index,2);
+	s[18]=0;
+	FRONT_COLOR=BLACK;
+	BACK_COLOR=WHITE;
+	n=20000;
+	for(k=0;k<2;k++)
+	{
+		Emu_Clear_Count();
+		t0=Now();
+		for(r=0;r<n;r++)
+		{
+			if(k==0)LCD_ShowFontHZ(16,(r%16)*29,s);
+			else Old_ShowFontHZ(16,(r%16)*29,s);
+		}
+		LCD_DMA_Wait();
+		t1=Now();
+		printf("%-16s %8.0f glyphs/s, per glyph %5.1f cmd %5.1f data %6.1f px\n",name[k],n*9/(t1-t0),
+			(double)emu.n.cmd/(n*9),(double)emu.n.data/(n*9),(double)emu.n.pixel/(n*9));
+		HOST_CHECK(emu.n.pixel==n*8*32*29);
+		if(k==0)memcpy(ref,emu.gram,sizeof ref);
+		else HOST_CHECK(memcmp(emu.gram,ref,sizeof ref)==0);
+	}
+}
+
+int main(void)
+{
+	Emu_Reset();
+	TFTLCD_Init();
+	LCD_Clear(GRAY);
+	LCD_DMA_Wait();
+	memcpy(ref,emu.gram,sizeof ref);
+	Test_Table();
+	Test_Missing();
+	Test_Clip();
+	Test_Bench();
+	return Host_Result("t_hz");
+}
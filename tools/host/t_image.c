@@ -0,0 +1,156 @@
+#include "host.h"
+#include "lcd_emu.h"
+#include "tftlcd.h"
+#include "lcd_image.h"
+#include "lcd_dma.h"
+#include "img_src.h"
+#include "img_lz.h"
+#include <stdio.h>
+#include <string.h>
+#include <time.h>
+
+//压缩图片往返测试:LCD_ShowImage经LCD模拟器解码出的像素与压缩之前的原图逐个比较
+//原图是压缩之前的Image2Lcd数组(低字节在前),由Makefile从git历史中取出生成img_src.h,
+//img_lz.h是现在程序中使用的压缩数组
+//另外打印压缩率,以及主机上LCD_ShowImage与直接写原图LCD_ShowPicture的速度
+
+typedef struct
+{
+	const char *name;
+	const u8 *src;			//原图
+	u32 src_len;
+	const u8 *img;			//压缩后
+	u32 img_len;
+	u16 width;
+	u16 height;
+}_image;
+
+static const _image images[]=
+{
+	{"gImage_picture",src_picture,sizeof src_picture,img_picture,sizeof img_picture,200,112},
+	{"snake pic 240x400",src_snake400,sizeof src_snake400,img_snake400,sizeof img_snake400,240,400},
+	{"snake pic 240x320",src_snake320,sizeof src_snake320,img_snake320,sizeof img_snake320,240,320},
+};
+
+#define SPEED_PIXELS	5000000		//速度测试至少写入的像素数
+
+
+//比较屏幕上(x,y)起显示的图片在(sx,sy)-(ex,ey)内的部分,返回不同的像素数
+static u32 Compare(const _image *m,u16 x,u16 y,u16 sx,u16 sy,u16 ex,u16 ey)
+{
+	const u8 *p;
+	u32 bad=0;
+	u16 i,j;
+
+	LCD_DMA_Wait();
+	for(j=sy;j<=ey;j++)
+	{
+		for(i=sx;i<=ex;i++)
+		{
+			p=m->src+((u32)(j-y)*m->width+(i-x))*2;
+			if(emu.gram[j][i]!=(p[0]|(p[1]<<8)))bad++;
+		}
+	}
+	return bad;
+}
+
+//区域外的像素是否保持为color
+static u32 Count_Other(u16 sx,u16 sy,u16 ex,u16 ey,u16 color)
+{
+	u32 n=0;
+	u16 x,y;
+
+	LCD_DMA_Wait();
+	for(y=0;y<EMU_H;y++)
+		for(x=0;x<EMU_W;x++)
+			if((x<sx||x>ex||y<sy||y>ey)&&emu.gram[y][x]!=color)n++;
+	return n;
+}
+
+static double Now(void)
+{
+	struct timespec t;
+
+	clock_gettime(CLOCK_MONOTONIC,&t);
+	return t.tv_sec+t.tv_nsec*1e-9;
+}
+
+//整幅图片解码结果与原图相同
+static void Test_Full(const _image *m)
+{
+	u16 w,h;
+
+	HOST_CHECK(m->src_len==(u32)m->width*m->height*2);
+	HOST_CHECK(LCD_Img_Size(m->img,&w,&h)==1);
+	HOST_CHECK(w==m->width&&h==m->height);
+	LCD_Clear(BLACK);
+	LCD_DMA_Wait();				//清屏由DMA在后台完成,不计入
+	Emu_Clear_Count();
+	LCD_ShowImage(0,0,m->img);
+	LCD_DMA_Wait();
+	HOST_CHECK(emu.n.pixel==(u32)w*h);
+	HOST_CHECK(emu.outside==0);
+	HOST_CHECK(Compare(m,0,0,0,0,w-1,h-1)==0);
+	HOST_CHECK(Count_Other(0,0,w-1,h-1,BLACK)==0);
+}
+
+//裁剪:分成四块分别在裁剪区内显示,拼起来与原图相同;部分超出屏幕时只显示屏幕内的部分
+static void Test_Clip(const _image *m)
+{
+	u16 mx=m->width/3,my=m->height/2;
+	u16 x=EMU_W-m->width/2,y=EMU_H-m->height/2;
+
+	LCD_Clear(BLACK);
+	LCD_Set_Clip(0,0,mx-1,my-1);
+	LCD_ShowImage(0,0,m->img);
+	LCD_Set_Clip(mx,0,m->width-1,my-1);
+	LCD_ShowImage(0,0,m->img);
+	LCD_Set_Clip(0,my,mx-1,m->height-1);
+	LCD_ShowImage(0,0,m->img);
+	LCD_Set_Clip(mx,my,m->width-1,m->height-1);
+	LCD_ShowImage(0,0,m->img);
+	LCD_Reset_Clip();
+	HOST_CHECK(Compare(m,0,0,0,0,m->width-1,m->height-1)==0);
+	HOST_CHECK(Count_Other(0,0,m->width-1,m->height-1,BLACK)==0);
+
+	LCD_Clear(BLACK);
+	LCD_DMA_Wait();				//清屏由DMA在后台完成,不计入
+	Emu_Clear_Count();
+	LCD_ShowImage(x,y,m->img);
+	LCD_DMA_Wait();
+	HOST_CHECK(emu.n.pixel==(u32)(EMU_W-x)*(EMU_H-y));
+	HOST_CHECK(Compare(m,x,y,x,y,EMU_W-1,EMU_H-1)==0);
+	HOST_CHECK(Count_Other(x,y,EMU_W-1,EMU_H-1,BLACK)==0);
+}
+
+//主机上的速度,包括模拟总线的开销,两者之差约为解码的开销
+static void Test_Speed(const _image *m)
+{
+	u32 n,i,px=(u32)m->width*m->height;
+	double t0,t1,t2;
+
+	n=SPEED_PIXELS/px+1;
+	t0=Now();
+	for(i=0;i<n;i++)LCD_ShowImage(0,0,m->img);
+	t1=Now();
+	for(i=0;i<n;i++)LCD_ShowPicture(0,0,m->width,m->height,(u8 *)m->src);
+	t2=Now();
+	printf("%-20s %7u %7u %6.2f %10.1f %10.1f\n",m->name,m->src_len,m->img_len,
+		(double)m->src_len/m->img_len,px*n/(t1-t0)/1e6,px*n/(t2-t1)/1e6);
+}
+
+int main(void)
+{
+	u8 i;
+
+	Emu_Reset();
+	TFTLCD_Init();
+	printf("%-20s %7s %7s %6s %10s %10s\n","image","raw","lz","ratio","Mpx/s img","Mpx/s raw");
+	for(i=0;i<sizeof images/sizeof images[0];i++)
+	{
+		Test_Full(&images[i]);
+		Test_Clip(&images[i]);
+		Test_Speed(&images[i]);
+	}
+	return Host_Result("t_image");
+}
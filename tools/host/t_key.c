@@ -0,0 +1,286 @@
+#include "host.h"
+#include "key.h"
+#include "time.h"
+#include "evq.h"
+#include <stdio.h>
+
+//按键消抖测试:虚拟时间每100us一步,按波形写KEY_UP/KEY0~2(位带别名区),电平变化时调用对应的EXTI中断函数;
+//TIM4使能(CR1的CEN)时计数器每步加100,到1000调用TIM4_IRQHandler,与TIM_SetCounter的清零一致
+//1.每个按键单独按下松开,两个边沿各有0~10ms的抖动:只有一次按下和一次松开,按下延迟不超过抖动加KEY_DEB_MS
+//2.25ms的短按;3.比消抖时间短的干扰脉冲不产生事件
+//4.长按:一次长按事件,之后每KEY_REPEAT_MS一次重复
+//5.几个按键同时和交错按下;6.上电时已按住的按键;7.没有按键时TIM4关闭,不产生中断
+
+#define NKEY	KEY_NUM
+#define MAXC	256				//每个按键的电平变化数
+
+typedef struct
+{
+	u32 t;						//取出事件的时间(us)
+	u8 ev;
+	u8 key;
+}_rec;
+
+static u32 ct[NKEY][MAXC];		//电平变化的时间(us)
+static u8 cl[NKEY][MAXC];		//变化后的电平,1为按下
+static u16 cn[NKEY],ci[NKEY];
+static u8 lvl[NKEY];
+static _rec rec[256];
+static u16 nrec;
+static u32 ticks=0;
+static u32 rnd=1;
+
+void TIM4_IRQHandler(void);
+void EXTI0_IRQHandler(void);
+void EXTI2_IRQHandler(void);
+void EXTI3_IRQHandler(void);
+void EXTI4_IRQHandler(void);
+
+
+static u32 Rand(u32 n)
+{
+	rnd=rnd*1103515245+12345;
+	return (rnd>>8)%n;
+}
+
+static u32 Now(void)
+{
+	return (u32)Host_Us();
+}
+
+//按键k(按键值k+1)的电平,KEY_UP按下为1,KEY0~2按下为0,同时产生EXTI中断
+static void Pin(u8 k,u8 on)
+{
+	lvl[k]=on;
+	switch(k+1)
+	{
+	case KEY_UP_PRESS:
+		KEY_UP=on;
+		EXTI->PR|=EXTI_Line0;
+		EXTI0_IRQHandler();
+		break;
+	case KEY0_PRESS:
+		KEY0=!on;
+		EXTI->PR|=EXTI_Line4;
+		EXTI4_IRQHandler();
+		break;
+	case KEY1_PRESS:
+		KEY1=!on;
+		EXTI->PR|=EXTI_Line3;
+		EXTI3_IRQHandler();
+		break;
+	default:
+		KEY2=!on;
+		EXTI->PR|=EXTI_Line2;
+		EXTI2_IRQHandler();
+		break;
+	}
+}
+
+static u8 Tim_On(void)
+{
+	return (TIM4->CR1&TIM_CR1_CEN)!=0;
+}
+
+static void At(u8 k,u32 t,u8 l)
+{
+	if(cn[k]==MAXC)return;
+	ct[k][cn[k]]=t;
+	cl[k][cn[k]]=l;
+	cn[k]++;
+}
+
+//从t开始抖动b us后稳定在电平l,抖动期间每50~450us翻转一次
+static void Bounce(u8 k,u32 t,u8 l,u32 b)
+{
+	u32 x=t;
+	u8 v=l;
+
+	while(x<t+b)
+	{
+		At(k,x,v);
+		v=!v;
+		x+=50+Rand(400);
+	}
+	At(k,x,l);
+}
+
+//运行到until,每毫秒取出事件
+static void Run(u32 until)
+{
+	_event ev;
+	u8 k;
+
+	while((s32)(Now()-until)<0)
+	{
+		Host_Advance_Us(100);
+		for(k=0;k<NKEY;k++)
+			while(ci[k]<cn[k]&&(s32)(ct[k][ci[k]]-Now())<=0)
+			{
+				if(lvl[k]!=cl[k][ci[k]])Pin(k,cl[k][ci[k]]);
+				ci[k]++;
+			}
+		if(Tim_On()&&(TIM4->CNT+=100)>=1000)
+		{
+			TIM4->CNT=0;
+			TIM4->SR=TIM_IT_Update;
+			ticks++;
+			TIM4_IRQHandler();
+		}
+		if(Now()%1000==0)
+			while(EvQ_Get(&ev)&&nrec<256)
+			{
+				rec[nrec].t=Now();
+				rec[nrec].ev=KEY_EVENT(ev.arg);
+				rec[nrec].key=KEY_CODE(ev.arg);
+				nrec++;
+			}
+	}
+}
+
+static void Reset(void)
+{
+	u8 k;
+
+	for(k=0;k<NKEY;k++)cn[k]=ci[k]=0;
+	nrec=0;
+}
+
+static u16 Count(u8 ev,u8 key)
+{
+	u16 i,n=0;
+
+	for(i=0;i<nrec;i++)if(rec[i].ev==ev&&rec[i].key==key)n++;
+	return n;
+}
+
+static u32 First(u8 ev,u8 key)
+{
+	u16 i;
+
+	for(i=0;i<nrec;i++)if(rec[i].ev==ev&&rec[i].key==key)return rec[i].t;
+	return 0;
+}
+
+
+static void Test_Bounce(void)
+{
+	u32 r,t0,b,h,lat,max_lat=0,bad=0;
+	u8 k;
+
+	for(r=0;r<400;r++)
+	{
+		k=r%NKEY;
+		Reset();
+		t0=Now()+5000;
+		b=Rand(10000);
+		h=40000+Rand(260000);
+		Bounce(k,t0,1,b);
+		Bounce(k,t0+b+h,0,Rand(10000));
+		Run(t0+b+h+40000);
+		lat=First(KEY_EV_PRESS,k+1)-t0;
+		if(lat>max_lat)max_lat=lat;
+		if(nrec!=2||Count(KEY_EV_PRESS,k+1)!=1||Count(KEY_EV_RELEASE,k+1)!=1||
+			lat>b+KEY_DEB_MS*1000+2000||Tim_On())
+		{
+			if(bad++<5)printf("key %u bounce %u us: %u events, latency %u us\n",k+1,b,nrec,lat);
+		}
+	}
+	printf("400 bouncing presses: max press latency %.1f ms from first edge (bounce up to 10 ms)\n",max_lat/1000.0);
+	HOST_CHECK(bad==0);
+}
+
+static void Test_Short(void)
+{
+	u32 t0,r;
+
+	//25ms的短按
+	Reset();
+	t0=Now()+5000;
+	Bounce(1,t0,1,3000);
+	Bounce(1,t0+25000,0,3000);
+	Run(t0+60000);
+	HOST_CHECK(Count(KEY_EV_PRESS,2)==1&&Count(KEY_EV_RELEASE,2)==1);
+
+	//干扰脉冲0.3~2.3ms
+	Reset();
+	t0=Now()+5000;
+	for(r=0;r<50;r++)
+	{
+		At(r%NKEY,t0+r*20000,1);
+		At(r%NKEY,t0+r*20000+300+Rand(2000),0);
+	}
+	Run(t0+1100000);
+	HOST_CHECK(nrec==0&&!Tim_On());
+}
+
+static void Test_Long(void)
+{
+	u32 t0,tk=ticks;
+
+	Reset();
+	t0=Now()+5000;
+	Bounce(0,t0,1,4000);
+	Bounce(0,t0+2500000,0,4000);
+	Run(t0+2600000);
+	printf("2.5 s hold: long at %.0f ms, %u repeats, %u ticks\n",(First(KEY_EV_LONG,1)-t0)/1000.0,
+		Count(KEY_EV_REPEAT,1),ticks-tk);
+	HOST_CHECK(Count(KEY_EV_PRESS,1)==1&&Count(KEY_EV_LONG,1)==1&&Count(KEY_EV_RELEASE,1)==1);
+	HOST_CHECK(Count(KEY_EV_REPEAT,1)==(2500-KEY_LONG_MS)/KEY_REPEAT_MS);
+	HOST_CHECK(First(KEY_EV_LONG,1)-First(KEY_EV_PRESS,1)>=KEY_LONG_MS*1000);
+	HOST_CHECK(ticks-tk<2600+20);				//只在按住期间运行
+}
+
+static void Test_Combo(void)
+{
+	u32 t0;
+
+	Reset();
+	t0=Now()+5000;
+	Bounce(1,t0,1,6000);
+	Bounce(2,t0+1000,1,6000);
+	Bounce(3,t0+2000,1,6000);
+	Run(t0+100000);
+	HOST_CHECK(Key_State()==((1<<1)|(1<<2)|(1<<3)));
+	Bounce(2,t0+200000,0,5000);
+	Bounce(1,t0+300000,0,5000);
+	Bounce(3,t0+1300000,0,5000);
+	Run(t0+1400000);
+	HOST_CHECK(Count(KEY_EV_PRESS,2)==1&&Count(KEY_EV_PRESS,3)==1&&Count(KEY_EV_PRESS,4)==1);
+	HOST_CHECK(Count(KEY_EV_RELEASE,2)==1&&Count(KEY_EV_RELEASE,3)==1&&Count(KEY_EV_RELEASE,4)==1);
+	HOST_CHECK(Count(KEY_EV_LONG,4)==1&&Count(KEY_EV_LONG,2)==0&&Count(KEY_EV_LONG,3)==0);
+	HOST_CHECK(Key_State()==0&&!Tim_On()&&!Key_Busy());
+}
+
+int main(void)
+{
+	u32 tk;
+
+	//上电时KEY0已按住,其他松开
+	KEY_UP=0;
+	KEY0=0;
+	KEY1=1;
+	KEY2=1;
+	lvl[1]=1;
+	Host_Set_Us(1000000);
+	EvQ_Init();
+	KEY_Init();
+	HOST_CHECK(Tim_On()&&Key_Busy());
+	Run(Now()+20000);
+	HOST_CHECK(Count(KEY_EV_PRESS,KEY0_PRESS)==1&&Key_State()==1<<(KEY0_PRESS-1));
+	Reset();
+	At(1,Now()+1000,0);
+	Run(Now()+20000);
+	HOST_CHECK(Count(KEY_EV_RELEASE,KEY0_PRESS)==1&&!Tim_On());
+
+	Test_Bounce();
+	Test_Short();
+	Test_Long();
+	Test_Combo();
+
+	//没有按键时不产生中断
+	tk=ticks;
+	Run(Now()+5000000);
+	HOST_CHECK(ticks==tk);
+	return Host_Result("t_key");
+}
@@ -0,0 +1,575 @@
+#include "host.h"
+#include "lcd_emu.h"
+#include "tftlcd.h"
+#include "lcd_dirty.h"
+#include "lcd_console.h"
+#include "lcd_dma.h"
+#include "lcd_dlist.h"
+#include "lcd_image.h"
+#include "rtc.h"
+#include "picture.h"
+#include <stdio.h>
+#include <string.h>
+#include <time.h>
+
+//LCD驱动测试:tftlcd.c和绘图模块经LCD模拟器运行
+//1.初始化后的屏幕参数,常用绘图函数画出的像素
+//2.各绘图函数和main.c各界面的总线开销表,与驱动自己的lcd_bus_stat统计对照
+//3.各界面经脏矩形刷新的结果与整屏重绘相同,截图保存为PPM,打印显示列表的统计;
+//  时间走一分钟(08:59->09:00->09:01)和过零点(2026-10-17 23:59->2026-10-18 00:00)只重画变了的字符格,
+//  每一步写出的像素不超过上限
+//4.随机的填充和字符串经显示列表记录后绘制,与直接绘制的结果相同
+//5.放大显示的字体(36=1206*3,48=2412*2等)与按点阵逐像素放大的参考结果相同,含裁剪;
+//  打印32/36/48号字LCD_ShowString每秒写出的像素数
+//6.主界面的日志控制台写满后继续追加(硬件滚动),离开主界面再回来,每一步的屏幕与整区重画方式相同,
+//  硬件滚动时每追加一行只写一行像素和一次滚动起始行
+//用法:t_lcd <输出目录>
+
+//main.c
+extern u8 force_refresh;
+extern void (*screen_paint)(void);
+void system_init(void);
+void show_home_screen(void);
+void show_medication_screen(void);
+void show_environment_screen(void);
+void show_alert_screen(u8 alert_type);
+void ui_flush(void);
+void paint_home_screen(void);
+void paint_medication_screen(void);
+void paint_environment_screen(void);
+void paint_alarm_screen(void);
+void paint_med_taken_screen(void);
+void paint_env_alert_screen(void);
+
+static const char *out_dir=".";
+static u16 scr[EMU_H][EMU_W];
+static u16 scr2[EMU_H][EMU_W];
+static u16 pic_buf[64*64];
+static u16 con_ref[40][128][EMU_W];		//整区重画方式下每一步后控制台区域的屏幕
+static u32 rnd=1;
+
+
+static u32 Rand(u32 n)
+{
+	rnd=rnd*1103515245+12345;
+	return (rnd>>8)%n;
+}
+
+//区域内颜色为color的像素数
+static u32 Count_Color(u16 sx,u16 sy,u16 ex,u16 ey,u16 color)
+{
+	u32 n=0;
+	u16 x,y;
+
+	LCD_DMA_Wait();
+	for(y=sy;y<=ey;y++)
+		for(x=sx;x<=ex;x++)
+			if(emu.gram[y][x]==color)n++;
+	return n;
+}
+
+static double Now(void)
+{
+	struct timespec t;
+
+	clock_gettime(CLOCK_MONOTONIC,&t);
+	return t.tv_sec+t.tv_nsec*1e-9;
+}
+
+static void Save(const char *name)
+{
+	char path[256];
+
+	snprintf(path,sizeof path,"%s/%s.ppm",out_dir,name);
+	HOST_CHECK(Emu_Save_PPM(path)==0);
+}
+
+
+//各测试项
+static void b_clear(void){LCD_Clear(WHITE);}
+static void b_fill100(void){LCD_Fill(10,10,109,109,RED);}
+static void b_fill8(void){LCD_Fill(10,120,17,127,BLUE);}
+static void b_str16(void){LCD_ShowString(10,140,300,16,16,(u8 *)"Medicine Box 0123");}
+static void b_str24(void){LCD_ShowString(10,160,300,24,24,(u8 *)"Medicine Box 0123");}
+static void b_str32(void){LCD_ShowString(10,140,300,32,32,(u8 *)"Medicine 012");}
+static void b_str36(void){LCD_ShowString(10,140,300,36,36,(u8 *)"Medicine 012");}
+static void b_str48(void){LCD_ShowString(10,140,300,48,48,(u8 *)"Medicine 012");}
+static void b_hline(void){LCD_DrawLine(10,200,309,200);}
+static void b_dline(void){LCD_DrawLine(10,210,309,309);}
+static void b_rect(void){LCD_DrawRectangle(10,220,209,319);}
+static void b_circle(void){LCD_Draw_Circle(260,260,50);}
+static void b_fcircle(void){LCD_Fill_Circle(260,260,40,GREEN);}
+static void b_rrect(void){LCD_Fill_RoundRect(10,400,209,439,10,BLUE);}
+static void b_picture(void){LCD_ShowPicture(10,320,64,64,(u8 *)pic_buf);}
+static void b_image(void){LCD_ShowImage(100,320,gImage_picture);}
+static void b_readrect(void){LCD_ReadRect(10,320,73,383,(u16 *)scr);}
+
+typedef struct
+{
+	const char *name;
+	void (*fn)(void);
+}_bench;
+
+static const _bench bench[]=
+{
+	{"LCD_Clear",b_clear},
+	{"LCD_Fill 100x100",b_fill100},
+	{"LCD_Fill 8x8",b_fill8},
+	{"LCD_ShowString 16x17",b_str16},
+	{"LCD_ShowString 24x17",b_str24},
+	{"LCD_ShowString 32x12",b_str32},
+	{"LCD_ShowString 36x12",b_str36},
+	{"LCD_ShowString 48x12",b_str48},
+	{"LCD_DrawLine horiz 300",b_hline},
+	{"LCD_DrawLine diag 300",b_dline},
+	{"LCD_DrawRectangle",b_rect},
+	{"LCD_Draw_Circle r50",b_circle},
+	{"LCD_Fill_Circle r40",b_fcircle},
+	{"LCD_Fill_RoundRect",b_rrect},
+	{"LCD_ShowPicture 64x64",b_picture},
+	{"LCD_ShowImage 200x112",b_image},
+	{"LCD_ReadRect 64x64",b_readrect},
+	{"paint_home_screen",paint_home_screen},
+	{"paint_medication_screen",paint_medication_screen},
+	{"paint_environment_screen",paint_environment_screen},
+	{"paint_alarm_screen",paint_alarm_screen},
+	{"paint_med_taken_screen",paint_med_taken_screen},
+	{"paint_env_alert_screen",paint_env_alert_screen},
+};
+
+//运行一项并打印一行:模拟器看到的总线写次数,驱动统计的次数应与之相同
+static void Bench(const _bench *b)
+{
+	Emu_Clear_Count();
+	LCD_BusStat_Clear();
+	emu.outside=0;
+	b->fn();
+	LCD_DMA_Wait();
+	printf("%-26s %8u %8u %8u %8u\n",b->name,emu.n.cmd,emu.n.data,emu.n.pixel,emu.n.read);
+	HOST_CHECK(emu.outside==0);
+	HOST_CHECK(lcd_bus_stat.cmd==emu.n.cmd);
+	HOST_CHECK(lcd_bus_stat.data==emu.n.data);
+	HOST_CHECK(lcd_bus_stat.pixel==emu.n.pixel);
+}
+
+
+//初始化
+static void Test_Init(void)
+{
+	Emu_Reset();
+	TFTLCD_Init();
+	HOST_CHECK(tftlcd_data.id==0x99);
+	HOST_CHECK(tftlcd_data.width==EMU_W);
+	HOST_CHECK(tftlcd_data.height==EMU_H);
+}
+
+//绘图结果
+static void Test_Draw(void)
+{
+	u16 i,x,y;
+
+	LCD_Clear(WHITE);
+	HOST_CHECK(Count_Color(0,0,EMU_W-1,EMU_H-1,WHITE)==(u32)EMU_W*EMU_H);
+
+	LCD_Fill(10,10,109,109,RED);
+	HOST_CHECK(Count_Color(10,10,109,109,RED)==100*100);
+	HOST_CHECK(Count_Color(0,0,EMU_W-1,EMU_H-1,RED)==100*100);
+
+	FRONT_COLOR=BLACK;
+	LCD_DrawLine(10,200,309,200);
+	HOST_CHECK(Count_Color(10,200,309,200,BLACK)==300);
+	HOST_CHECK(Count_Color(0,199,EMU_W-1,201,BLACK)==300);
+
+	//文字只画在指定区域内,前景和背景以外没有别的颜色
+	BACK_COLOR=WHITE;
+	LCD_ShowString(10,140,300,16,16,(u8 *)"Medicine Box 0123");
+	HOST_CHECK(Count_Color(10,140,10+17*8-1,155,BLACK)>100);
+	HOST_CHECK(Count_Color(10,140,10+17*8-1,155,BLACK)+Count_Color(10,140,10+17*8-1,155,WHITE)==17*8*16);
+	HOST_CHECK(Count_Color(0,130,EMU_W-1,165,BLACK)==Count_Color(10,140,10+17*8-1,155,BLACK));
+
+	//图片写入后连续读回
+	for(i=0;i<64*64;i++)pic_buf[i]=i*37;
+	LCD_ShowPicture(10,320,64,64,(u8 *)pic_buf);
+	for(y=0;y<64;y++)
+		for(x=0;x<64;x++)
+			HOST_CHECK(emu.gram[320+y][10+x]==pic_buf[y*64+x]);
+	memset(scr,0,sizeof scr);
+	LCD_ReadRect(10,320,73,383,(u16 *)scr);
+	HOST_CHECK(memcmp(scr,pic_buf,sizeof pic_buf)==0);
+	HOST_CHECK(LCD_ReadPoint(11,320)==pic_buf[1]);
+}
+
+//开销表
+static void Test_Bench(void)
+{
+	u8 i;
+
+	system_init();
+	LCD_Dirty_Init();
+	LCD_Console_Init(352,479,16,BLACK,WHITE);
+	printf("%-26s %8s %8s %8s %8s\n","call","cmd","data","pixel","read");
+	for(i=0;i<sizeof bench/sizeof bench[0];i++)Bench(&bench[i]);
+	Save("bench");
+}
+
+//按点阵逐像素放大画出一个字符到scr,只画裁剪区域sx~ex,sy~ey内的部分
+static void Ref_Char(u16 x,u16 y,u8 ch,u8 size,u16 sx,u16 sy,u16 ex,u16 ey)
+{
+	u8 base=LCD_FontBase(size);
+	u8 scale=size/base;
+	u8 cbytes=base/8+((base%8)?1:0);
+	const u8 *font=LCD_GetFont(ch,base);
+	u16 r,c;
+	u8 sr,sc;
+
+	for(r=0;r<size;r++)
+		for(c=0;c<size/2;c++)
+		{
+			if(x+c<sx||x+c>ex||y+r<sy||y+r>ey)continue;
+			sr=r/scale;
+			sc=c/scale;
+			scr[y+r][x+c]=(font[sc*cbytes+sr/8]&(0x80>>(sr%8)))?FRONT_COLOR:BACK_COLOR;
+		}
+}
+
+//放大显示的字体与逐像素放大的结果相同,打印各大小每秒写出的像素数
+static void Test_Scaled(void)
+{
+	static const u8 sizes[]={32,36,48,64,72};
+	static const u8 bench_sizes[]={32,36,48};
+	static const u8 text[]="Medicine 012";
+	u8 s[96];
+	u16 x,y,sx,sy,ex,ey,n,k,i,j;
+	u32 r,bad=0;
+	double t0,t1;
+
+	for(i=0;i<sizeof sizes;i++)
+	{
+		//全部可显示字符,每行能放下的分一段,有时设置裁剪区域
+		for(k=' ';k<='~';k+=n)
+		{
+			n=EMU_W/(sizes[i]/2);
+			if(n>'~'+1-k)n='~'+1-k;
+			for(j=0;j<n;j++)s[j]=k+j;
+			s[n]=0;
+			LCD_Clear(GRAY);
+			LCD_DMA_Wait();
+			memcpy(scr,emu.gram,sizeof scr);
+			x=Rand(EMU_W-n*(sizes[i]/2)+1);
+			y=Rand(EMU_H-sizes[i]+1);
+			sx=0;
+			sy=0;
+			ex=EMU_W-1;
+			ey=EMU_H-1;
+			if(Rand(2))
+			{
+				sx=x+Rand(sizes[i]);
+				sy=y+Rand(sizes[i]/2);
+				ex=sx+Rand(EMU_W-sx);
+				ey=sy+Rand(EMU_H-sy);
+				LCD_Set_Clip(sx,sy,ex,ey);
+			}
+			FRONT_COLOR=Rand(0x10000);
+			BACK_COLOR=Rand(0x10000);
+			LCD_ShowString(x,y,EMU_W-x,sizes[i],sizes[i],s);
+			LCD_Reset_Clip();
+			LCD_DMA_Wait();
+			for(j=0;j<n;j++)Ref_Char(x+j*(sizes[i]/2),y,s[j],sizes[i],sx,sy,ex,ey);
+			if(memcmp(emu.gram,scr,sizeof scr))
+			{
+				if(bad++<5)printf("size %u from '%c': differs from the per-pixel scaler\n",sizes[i],k);
+			}
+		}
+	}
+	HOST_CHECK(bad==0);
+
+	FRONT_COLOR=BLACK;
+	BACK_COLOR=WHITE;
+	for(i=0;i<sizeof bench_sizes;i++)
+	{
+		Emu_Clear_Count();
+		t0=Now();
+		for(r=0;r<2000;r++)LCD_ShowString(10,140,300,bench_sizes[i],bench_sizes[i],(u8 *)text);
+		LCD_DMA_Wait();
+		t1=Now();
+		printf("LCD_ShowString %u x%u: %6.1f Mpixel/s\n",bench_sizes[i],(u32)strlen((const char *)text),emu.n.pixel/(t1-t0)/1e6);
+		HOST_CHECK(emu.n.pixel==2000u*strlen((const char *)text)*(bench_sizes[i]/2)*bench_sizes[i]);
+	}
+}
+
+//界面经脏矩形刷新后与整屏重绘结果相同
+//打印上一次检查之后更新界面写入的像素数(字段直接重绘的字符格加上脏矩形刷新),不超过max_px,
+//以及脏矩形刷新时显示列表的统计:记录的操作,被遮住丢弃的,合并的,填充写出的块数,写出的像素
+static void Check_Screen(const char *name,u32 max_px)
+{
+	_lcd_dlist_stat *st=&lcd_dlist_stat;
+
+	force_refresh=0;
+	LCD_DL_Stat_Reset();
+	ui_flush();
+	LCD_DMA_Wait();
+	printf("%-26s %8u px %4u ops %3u culled %3u merged %4u pieces %8u px\n",name,emu.n.pixel,
+		st->ops,st->culled,st->merged,st->pieces,st->pixel);
+	HOST_CHECK(st->culled+st->merged<=st->ops);
+	HOST_CHECK(st->pixel<=emu.n.pixel);
+	HOST_CHECK(st->ops>0||st->pixel==0);
+	HOST_CHECK(emu.n.pixel<=max_px);
+	Emu_Screen(scr);
+	Save(name);
+	screen_paint();
+	LCD_DMA_Wait();
+	Emu_Screen(scr2);
+	HOST_CHECK(memcmp(scr,scr2,sizeof scr)==0);
+	Emu_Clear_Count();
+}
+
+//一轮随机操作:填充(有时紧接一块同色的相邻填充),字符串(含没有字体的大小和多行),偶尔画点
+static void DList_Ops(u8 n)
+{
+	static const u8 sizes[]={12,16,24,32,36,48,10,13,20};
+	u8 text[32],i,len,size;
+	u16 x,y,w,h,c;
+
+	while(n--)
+	{
+		x=Rand(EMU_W);
+		y=Rand(EMU_H);
+		c=Rand(4)?Rand(0x10000):WHITE;
+		switch(Rand(8))
+		{
+		case 0:
+		case 1:
+		case 2:
+			w=1+Rand(Rand(4)?80:EMU_W);
+			h=1+Rand(Rand(4)?60:EMU_H);
+			LCD_Fill(x,y,x+w-1,y+h-1,c);
+			if(Rand(2))LCD_Fill(x,y+h,x+w-1,y+h+Rand(20),c);
+			break;
+		case 7:
+			FRONT_COLOR=c;
+			LCD_DrawPoint(x,y);
+			break;
+		default:
+			size=sizes[Rand(sizeof sizes)];
+			len=1+Rand(sizeof text-1);
+			for(i=0;i<len;i++)text[i]=' '+Rand(95);
+			text[len]=0;
+			FRONT_COLOR=c;
+			BACK_COLOR=Rand(0x10000);
+			LCD_ShowString(x,y,Rand(2)?EMU_W-x:1+Rand(160),Rand(2)?size:1+Rand(120),size,text);
+			break;
+		}
+	}
+}
+
+static void Test_DList(void)
+{
+	_lcd_dlist_stat *st=&lcd_dlist_stat;
+	u32 r,seed,bad=0,direct=0;
+	u16 sx,sy;
+	u8 n,pass;
+
+	LCD_DL_Stat_Reset();
+	for(r=0;r<400;r++)
+	{
+		seed=rnd;
+		n=1+Rand(LCD_DLIST_OPS*3/2);		//有时超过一批的操作数
+		sx=Rand(EMU_W/2);
+		sy=Rand(EMU_H/2);
+		for(pass=0;pass<2;pass++)
+		{
+			rnd=seed;
+			LCD_Clear(GRAY);
+			LCD_DMA_Wait();
+			if(r&1)LCD_Set_Clip(sx,sy,sx+EMU_W/2,sy+EMU_H/2);
+			Emu_Clear_Count();
+			if(pass)LCD_DL_Begin();
+			DList_Ops(n);
+			if(pass)LCD_DL_End();
+			LCD_DMA_Wait();
+			LCD_Reset_Clip();
+			if(pass==0)
+			{
+				direct+=emu.n.pixel;
+				memcpy(scr,emu.gram,sizeof scr);
+			}
+		}
+		if(memcmp(scr,emu.gram,sizeof scr))bad++;
+	}
+	printf("display list, 400 random frames: %u ops, %u culled, %u merged, %u pieces, %u px (%u px direct), %u different\n",
+		st->ops,st->culled,st->merged,st->pieces,st->pixel,direct,bad);
+	HOST_CHECK(bad==0);
+	HOST_CHECK(st->culled>0&&st->merged>0&&st->culled+st->merged<=st->ops);
+	HOST_CHECK(st->pixel<direct);
+}
+
+#define SCREEN_PX	((u32)EMU_W*EMU_H*3/2)		//切换界面整屏重绘,允许部分区域画两遍
+#define HOME_CELL	(8*16)						//主界面时间字段的一个字符格
+#define ALARM_CELL	(12*24)						//警报界面时间字段的一个字符格
+
+static void Test_Screens(void)
+{
+	calendar.w_year=2026;
+	calendar.w_month=10;
+	calendar.w_date=17;
+	calendar.hour=8;
+	calendar.min=59;
+	force_refresh=1;
+	LCD_Console_Printf("08:58 BT: STATUS\n");
+	Emu_Clear_Count();
+	show_home_screen();
+	Check_Screen("home",SCREEN_PX);
+	show_home_screen();
+	Check_Screen("home_idle",0);
+	calendar.hour=9;
+	calendar.min=0;
+	show_home_screen();
+	Check_Screen("home_minute",3*HOME_CELL);		//08:59->09:00
+	calendar.min=1;
+	show_home_screen();
+	Check_Screen("home_0901",HOME_CELL);			//09:00->09:01
+	calendar.hour=23;
+	calendar.min=59;
+	show_home_screen();
+	Check_Screen("home_2359",4*HOME_CELL);
+	calendar.w_date=18;
+	calendar.hour=0;
+	calendar.min=0;
+	show_home_screen();
+	Check_Screen("home_midnight",5*HOME_CELL);		//2026-10-17 23:59->2026-10-18 00:00
+	calendar.w_date=17;
+	calendar.hour=9;
+	calendar.min=0;
+	show_medication_screen();
+	Check_Screen("medication",SCREEN_PX);
+	show_environment_screen();
+	Check_Screen("environment",SCREEN_PX);
+	show_alert_screen(1);
+	Check_Screen("alarm",SCREEN_PX);
+	calendar.min=1;
+	show_alert_screen(1);
+	Check_Screen("alarm_minute",ALARM_CELL);
+	show_alert_screen(2);
+	Check_Screen("med_taken",SCREEN_PX);
+	show_alert_screen(3);
+	Check_Screen("env_alert",SCREEN_PX);
+	show_home_screen();
+	Check_Screen("home_back",SCREEN_PX);
+}
+
+//控制台测试的一步后的屏幕:rows行以上与整屏重绘相同,控制台区域与整区重画方式的第step步相同
+//pass:0,整区重画,记录;1,硬件滚动,比较
+static void Console_Check(u8 pass,u8 step)
+{
+	Emu_Screen(scr);
+	if(pass==0)memcpy(con_ref[step],scr[352],sizeof con_ref[step]);
+	else HOST_CHECK(memcmp(con_ref[step],scr[352],sizeof con_ref[step])==0);
+}
+
+//追加一行,返回写出的像素数,cmd/data为命令和参数写次数
+static u32 Console_Log(const char *fmt,u32 n,u32 *cmd,u32 *data)
+{
+	LCD_DMA_Wait();
+	Emu_Clear_Count();
+	LCD_Console_Printf(fmt,9+n/60,n%60,n);
+	LCD_DMA_Wait();
+	*cmd=emu.n.cmd;
+	*data=emu.n.data;
+	return emu.n.pixel;
+}
+
+//切换界面并刷新
+static void Console_Screen(void (*show)(void))
+{
+	force_refresh=1;
+	show();
+	force_refresh=0;
+	ui_flush();
+	LCD_DMA_Wait();
+}
+
+static void Test_Console(void)
+{
+	static const char *mode[2]={"repaint","hw scroll"};
+	u32 n,px,cmd,data,max_cmd,max_data,max_px,sum_px;
+	u8 pass,step;
+
+	for(pass=0;pass<2;pass++)
+	{
+		//先按硬件滚动建立一次,滚动起始行回到区域顶部;整区重画方式再按横屏建立(只看方向)
+		LCD_Console_Init(352,479,16,BLACK,WHITE);
+		if(pass==0)
+		{
+			tftlcd_data.dir=1;
+			LCD_Console_Init(352,479,16,BLACK,WHITE);
+			tftlcd_data.dir=0;
+		}
+		step=0;
+		Console_Screen(show_home_screen);
+		Console_Check(pass,step++);
+		max_cmd=max_data=max_px=sum_px=0;
+		for(n=0;n<20;n++)			//8行的区域写20行
+		{
+			px=Console_Log("%02u:%02u line %u\n",n,&cmd,&data);
+			if(cmd>max_cmd)max_cmd=cmd;
+			if(data>max_data)max_data=data;
+			if(px>max_px)max_px=px;
+			sum_px+=px;
+			if(pass)
+			{
+				//只画新的一行:文字和行尾填充各一个窗口,写满后再写一次滚动起始行
+				HOST_CHECK(px==EMU_W*16);
+				HOST_CHECK(cmd==(n<8?6:7)&&data==(n<8?16:18));
+				HOST_CHECK(emu.vsp==352+((n+1)%8)*16||n<7);
+			}
+			Console_Check(pass,step++);
+		}
+		printf("console %-9s 20 lines: max %u cmd %u data %u px per line, %u px total\n",mode[pass],max_cmd,max_data,max_px,sum_px);
+		if(pass==0)HOST_CHECK(max_px==8*EMU_W*16);		//写满后每行都整区重画
+
+		//超过一行的长文字折成两行
+		Console_Log("%02u:%02u a long line that does not fit into forty columns %u\n",20,&cmd,&data);
+		Console_Check(pass,step++);
+
+		//离开主界面:滚动起始行复位,日志只保存不画
+		Console_Screen(show_medication_screen);
+		HOST_CHECK(emu.vsp==352||pass==0);
+		Console_Check(pass,step++);
+		Emu_Screen(scr2);
+		screen_paint();
+		LCD_DMA_Wait();
+		Emu_Screen(scr);
+		HOST_CHECK(memcmp(scr,scr2,sizeof scr)==0);
+		for(n=21;n<24;n++)
+		{
+			px=Console_Log("%02u:%02u away %u\n",n,&cmd,&data);
+			HOST_CHECK(px==0&&cmd==0&&data==0);
+		}
+		Console_Check(pass,step++);
+
+		//回到主界面:按当前内容重画
+		Console_Screen(show_home_screen);
+		Console_Check(pass,step++);
+		for(n=24;n<30;n++)
+		{
+			px=Console_Log("%02u:%02u back %u\n",n,&cmd,&data);
+			if(pass)HOST_CHECK(px==EMU_W*16&&cmd==7&&data==18);
+			Console_Check(pass,step++);
+		}
+		HOST_CHECK(step<=sizeof con_ref/sizeof con_ref[0]);
+	}
+	Save("console");
+}
+
+int main(int argc,char *argv[])
+{
+	if(argc>1)out_dir=argv[1];
+	Test_Init();
+	Test_Draw();
+	Test_Bench();
+	Test_Scaled();
+	Test_Screens();
+	Test_DList();
+	Test_Console();
+	return Host_Result("t_lcd");
+}
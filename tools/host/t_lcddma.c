@@ -0,0 +1,264 @@
+#include "host.h"
+#include "lcd_emu.h"
+#include "tftlcd.h"
+#include "lcd_dma.h"
+#include <stdio.h>
+#include <string.h>
+
+//DMA刷屏引擎测试:lcd_dma.c经lcd_emu.cpp中模拟的DMA2通道1运行(见lcd_emu.h),
+//同一串填充和块写入分别交给DMA和由CPU逐像素写入,两次的显存和总线写次数应相同
+//1.随机矩形的填充和块写入,每次空转传输的次数随机,队列经常写满,入队时要等待
+//2.超过65535个像素的填充分段传输,整屏块写入经两个中转缓冲轮流传输,传输完成中断的次数
+//3.完成回调按入队顺序各执行一次,执行时这个任务的像素已全部写入显存
+//4.DMA任务未完成时CPU绘图先等待:LCD_Fill(大块经DMA,小块由CPU)与画点交替,结果与逐点计算的相同
+
+#define NOPS	400
+
+typedef struct
+{
+	u16 sx;
+	u16 sy;
+	u16 ex;
+	u16 ey;
+	const u16 *buf;			//为0时填充color
+	u16 color;
+}_op;
+
+static _op ops[NOPS];
+static u16 nops;
+static u16 done_n;					//已执行的完成回调数
+static u16 done_bad;				//回调执行时像素没有写完的任务数
+static u16 src[EMU_W*EMU_H];		//块写入的颜色数组,DMA地址只有32位,不能放在栈上
+static u16 start[EMU_H][EMU_W];
+static u16 ref[EMU_H][EMU_W];
+static u32 rnd=1;
+
+
+static u32 Rand(u32 n)
+{
+	rnd=rnd*1103515245+12345;
+	return (rnd>>8)%n;
+}
+
+//显存中op的矩形是否已是它的颜色
+static u8 Op_Done(const _op *op)
+{
+	const u16 *p=op->buf;
+	u16 x,y;
+
+	for(y=op->sy;y<=op->ey;y++)
+		for(x=op->sx;x<=op->ex;x++)
+			if(emu.gram[y][x]!=(p?*p++:op->color))return 0;
+	return 1;
+}
+
+//完成回调,在模拟的DMA中断中执行
+static void Done(void)
+{
+	if(done_n>=nops||!Op_Done(&ops[done_n]))done_bad++;
+	done_n++;
+}
+
+//任务的传输段数:填充每段最多65535个像素,每像素写2次的屏块写入每段一个中转缓冲
+static u32 Segments(const _op *op)
+{
+	u32 n=(u32)(op->ex-op->sx+1)*(op->ey-op->sy+1);
+
+#ifdef LCD_DMA_BUS8
+	if(op->buf)return (n+LCD_DMA_STAGE-1)/LCD_DMA_STAGE;
+#endif
+	return (n+0xFFFE)/0xFFFF;
+}
+
+static void Add(u16 sx,u16 sy,u16 ex,u16 ey,const u16 *buf,u16 color)
+{
+	_op *op=&ops[nops++];
+
+	op->sx=sx;
+	op->sy=sy;
+	op->ex=ex;
+	op->ey=ey;
+	op->buf=buf;
+	op->color=color;
+}
+
+//随机矩形,块写入从src的随机位置取颜色
+static void Add_Random(void)
+{
+	u16 w=1+Rand(Rand(4)?80:EMU_W),h=1+Rand(Rand(4)?60:EMU_H);
+	u16 x=Rand(EMU_W-w+1),y=Rand(EMU_H-h+1);
+
+	if(Rand(2))Add(x,y,x+w-1,y+h-1,0,Rand(0x10000));
+	else Add(x,y,x+w-1,y+h-1,src+Rand(EMU_W*EMU_H-(u32)w*h+1),0);
+}
+
+//CPU逐像素写入,总线上的命令和像素与DMA相同
+static void Cpu_Run(void)
+{
+	const _op *op;
+	const u16 *p;
+	u32 n;
+	u16 i;
+
+	for(i=0;i<nops;i++)
+	{
+		op=&ops[i];
+		LCD_Set_Window(op->sx,op->sy,op->ex,op->ey);
+		n=(u32)(op->ex-op->sx+1)*(op->ey-op->sy+1);
+		p=op->buf;
+		while(n--)LCD_PIXEL(p?*p++:op->color);
+	}
+}
+
+//全部任务交给DMA,queued:入队后还没完成的回调数,waits:入队时等待队列空位的空转次数
+static void Dma_Run(u8 rand_burst,u32 *queued,u32 *waits)
+{
+	const _op *op;
+	u32 idle0=emu_dma.idle;
+	u16 i;
+
+	done_n=0;
+	done_bad=0;
+	for(i=0;i<nops;i++)
+	{
+		op=&ops[i];
+		if(rand_burst)emu_dma.burst=1+Rand(400);
+		if(op->buf)LCD_DMA_Blit(op->sx,op->sy,op->ex,op->ey,op->buf,Done);
+		else LCD_DMA_Fill(op->sx,op->sy,op->ex,op->ey,op->color,Done);
+	}
+	*queued=nops-done_n;
+	*waits=emu_dma.idle-idle0;
+	LCD_DMA_Wait();
+}
+
+//同一串任务由CPU和DMA分别写入,比较显存和总线写次数,name不为0时打印一行
+static void Compare(const char *name,u8 rand_burst)
+{
+	EmuCount cpu;
+	u32 queued,waits,tc0,seg=0;
+	u16 i;
+
+	for(i=0;i<nops;i++)seg+=Segments(&ops[i]);
+	memcpy(emu.gram,start,sizeof start);
+	Emu_Clear_Count();
+	Cpu_Run();
+	cpu=emu.n;
+	memcpy(ref,emu.gram,sizeof ref);
+
+	memcpy(emu.gram,start,sizeof start);
+	Emu_Clear_Count();
+	LCD_BusStat_Clear();
+	tc0=emu_dma.tc;
+	Dma_Run(rand_burst,&queued,&waits);
+	if(name)printf("%-24s %4u jobs %8u px %6u segments, %3u queued after push, %6u waits for a free slot\n",
+		name,nops,emu.n.pixel,emu_dma.tc-tc0,queued,waits);
+	HOST_CHECK(memcmp(emu.gram,ref,sizeof ref)==0);
+	HOST_CHECK(emu.n.cmd==cpu.cmd&&emu.n.data==cpu.data&&emu.n.pixel==cpu.pixel);
+	HOST_CHECK(lcd_bus_stat.pixel==emu.n.pixel);
+	HOST_CHECK(emu_dma.tc-tc0==seg);
+	HOST_CHECK(done_n==nops&&done_bad==0);
+	HOST_CHECK(!LCD_DMA_Busy()&&!(DMA2_Channel1->CCR&DMA_CCR1_EN));
+	HOST_CHECK(emu.outside==0&&emu_dma.bad==0);
+}
+
+static void Test_Random(void)
+{
+	u16 r;
+
+	for(r=0;r<20;r++)
+	{
+		nops=0;
+		while(nops<NOPS)Add_Random();
+		Compare(r==0?"random":0,1);
+	}
+	HOST_CHECK(LCD_DMA_QUEUE<NOPS);
+}
+
+static void Test_Large(void)
+{
+	u32 queued,waits;
+
+	//整屏填充分3段,整屏块写入1200个中转缓冲
+	nops=0;
+	Add(0,0,EMU_W-1,EMU_H-1,0,RED);
+	Add(0,0,EMU_W-1,EMU_H-1,src,0);
+	Add(0,0,EMU_W-1,EMU_H-1,0,BLUE);
+	Add(0,0,EMU_W-1,204,0,GREEN);				//65600像素,比65535多一点
+	Add(5,7,EMU_W-6,EMU_H-8,src+3,0);
+	Compare("full screen",0);
+
+	//只有一个中转缓冲大小,或多一个像素
+	nops=0;
+	Add(0,0,LCD_DMA_STAGE-1,0,src,0);
+	Add(0,1,LCD_DMA_STAGE,1,src+7,0);
+	Add(0,2,LCD_DMA_STAGE*2-1,2,src+9,0);
+	Add(0,3,0,3,src+11,0);
+	Add(3,4,3,4,0,WHITE);
+	Compare("stage edges",0);
+
+	//每次空转只传1次:入队一定要等
+	emu_dma.burst=1;
+	nops=0;
+	while(nops<LCD_DMA_QUEUE*3)Add(Rand(100),Rand(100),100+Rand(100),100+Rand(100),nops&1?src:0,Rand(0x10000));
+	memcpy(emu.gram,start,sizeof start);
+	Dma_Run(0,&queued,&waits);
+	HOST_CHECK(queued>=LCD_DMA_QUEUE-1&&waits>0);
+	HOST_CHECK(done_n==nops&&done_bad==0);
+	emu_dma.burst=256;
+}
+
+//DMA任务未完成时CPU画点和小块填充先等待,显存与逐点计算的相同
+static void Test_Mixed(void)
+{
+	u16 sx,sy,w,h,x,y,c;
+	u32 r,async=0;
+
+	memcpy(emu.gram,start,sizeof start);
+	memcpy(ref,start,sizeof ref);
+	for(r=0;r<3000;r++)
+	{
+		emu_dma.burst=1+Rand(2000);
+		c=Rand(0x10000);
+		if(Rand(3))
+		{
+			w=1+Rand(Rand(2)?8:EMU_W);
+			h=1+Rand(Rand(2)?8:EMU_H);
+			sx=Rand(EMU_W-w+1);
+			sy=Rand(EMU_H-h+1);
+			LCD_Fill(sx,sy,sx+w-1,sy+h-1,c);
+			async+=LCD_DMA_Busy();
+			for(y=sy;y<sy+h;y++)
+				for(x=sx;x<sx+w;x++)ref[y][x]=c;
+		}
+		else
+		{
+			x=Rand(EMU_W);
+			y=Rand(EMU_H);
+			FRONT_COLOR=c;
+			LCD_DrawPoint(x,y);
+			ref[y][x]=c;
+		}
+	}
+	LCD_DMA_Wait();
+	printf("3000 fills and points: %u fills still running on return\n",async);
+	HOST_CHECK(memcmp(emu.gram,ref,sizeof ref)==0);
+	HOST_CHECK(async>0);
+	emu_dma.burst=256;
+}
+
+int main(void)
+{
+	u32 i;
+
+	Emu_Reset();
+	TFTLCD_Init();
+	LCD_DMA_Wait();
+	for(i=0;i<EMU_W*EMU_H;i++)src[i]=Rand(0x10000);
+	for(i=0;i<EMU_W*EMU_H;i++)start[i/EMU_W][i%EMU_W]=Rand(0x10000);
+	Test_Random();
+	Test_Large();
+	Test_Mixed();
+	printf("%u DMA transfers, %u completion interrupts\n",emu_dma.item,emu_dma.tc);
+	HOST_CHECK(emu_dma.bad==0);
+	return Host_Result("t_lcddma");
+}
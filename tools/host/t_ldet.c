@@ -0,0 +1,234 @@
+#include "host.h"
+#include "ldet.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <math.h>
+
+//取药动作检测测试:把光敏抽取输出的序列(20Hz,与task_light相同)逐个送入Ldet_Update,
+//与序列中标注的开盖时间比较,打印每个场景的检出数、漏检数、检测延迟和每小时误报数
+//序列由下面的场景生成:环境光缓慢漂移、传感器噪声、偶尔的单点毛刺、手影(短暂变暗)、
+//环境光的小台阶和开盖取药(几百毫秒内变暗300~1500,持续1~8秒)
+//另外检查几种边界情况:单点毛刺不触发,环境光长时间改变后重建基准,两次开盖间隔小于LDET_HOLD_MS算一次
+//也可以回放串口记录的序列:t_ldet <输出目录> <文件>,文件每行"时间(ms) ADC值 [1]",1表示此处开盖
+
+#define FS			20			//输入频率(Hz)
+#define DT			(1000/FS)
+#define MATCH_MS	12000		//开盖后这段时间内的检测算这次开盖的(盖子可能开着8秒)
+#define MAX_EV		512
+
+typedef struct
+{
+	u32 n;
+	u16 *x;
+	u32 nev;
+	u32 ev[MAX_EV];				//开盖时间(ms)
+}_trace;
+
+typedef struct
+{
+	const char *name;
+	u8 hours;
+	u8 noise;					//噪声标准差(ADC值)
+	u8 opens;					//每小时开盖次数
+	u8 shadows;					//每小时手影次数
+	u8 steps;					//每小时环境光台阶次数
+	u16 max_lat_ms;				//允许的最大检测延迟
+	u8 max_fp;					//允许的误报次数
+}_scene;
+
+static u32 rnd;
+
+
+static u32 Rand(u32 n)
+{
+	rnd=rnd*1103515245+12345;
+	return (rnd>>8)%n;
+}
+
+static double Gauss(void)
+{
+	double u=(Rand(1<<20)+1.0)/((1<<20)+1.0),v=Rand(1<<20)/(double)(1<<20);
+
+	return sqrt(-2*log(u))*cos(2*M_PI*v);
+}
+
+static void Make(_trace *t,const _scene *sc,u32 seed)
+{
+	u32 n=(u32)sc->hours*3600*FS,i,k,at,len,ramp;
+	double *y=(double *)malloc(n*sizeof(double)),a,f,v;
+
+	rnd=seed;
+	t->n=n;
+	t->x=(u16 *)malloc(n*sizeof(u16));
+	t->nev=0;
+	for(i=0;i<n;i++)y[i]=2200+300*sin(2*M_PI*i/(FS*3600.0*2));	//2小时一个周期的漂移
+	for(k=0;k<(u32)sc->steps*sc->hours;k++)		//环境光台阶
+	{
+		at=Rand(n);
+		a=(Rand(2)?1:-1)*(40.0+Rand(60));
+		for(i=at;i<n;i++)y[i]+=a;
+	}
+	for(k=0;k<(u32)sc->shadows*sc->hours;k++)	//手影:0.3~1.3秒,变暗80~200
+	{
+		at=Rand(n);
+		len=FS*3/10+Rand(FS);
+		a=80+Rand(120);
+		for(i=at;i<at+len&&i<n;i++)y[i]+=a*sin(M_PI*(i-at)/len);
+	}
+	for(k=0;k<(u32)sc->opens*sc->hours&&t->nev<MAX_EV;k++)	//开盖:均匀分布,互相不重叠
+	{
+		at=(u32)((k+0.3+0.4*Rand(1000)/1000)*n/((u32)sc->opens*sc->hours));
+		ramp=2+Rand(5);
+		len=FS+Rand(FS*7);
+		a=-(300.0+Rand(1200));
+		for(i=at;i<at+len+2*ramp&&i<n;i++)
+		{
+			if(i<at+ramp)f=(double)(i-at)/ramp;
+			else if(i<at+ramp+len)f=1;
+			else f=1-(double)(i-at-ramp-len)/ramp;
+			y[i]+=a*f;
+		}
+		t->ev[t->nev++]=at*DT;
+	}
+	for(i=0;i<n;i++)
+	{
+		v=y[i]+sc->noise*Gauss();
+		if(Rand(20000)==0)v+=600;				//单点毛刺
+		t->x[i]=v<0?0:v>4095?4095:(u16)v;
+	}
+	free(y);
+}
+
+//读取记录的序列,时间由文件给出
+static u32 *trace_ms=0;
+
+static u8 Load(_trace *t,const char *path)
+{
+	FILE *fp=fopen(path,"r");
+	u32 cap=1024,ms,x,mark;
+	char line[64];
+
+	if(!fp)return 0;
+	t->n=0;
+	t->nev=0;
+	t->x=(u16 *)malloc(cap*sizeof(u16));
+	trace_ms=(u32 *)malloc(cap*sizeof(u32));
+	while(fgets(line,sizeof line,fp))
+	{
+		mark=0;
+		if(sscanf(line,"%u %u %u",&ms,&x,&mark)<2)continue;
+		if(t->n==cap)
+		{
+			cap*=2;
+			t->x=(u16 *)realloc(t->x,cap*sizeof(u16));
+			trace_ms=(u32 *)realloc(trace_ms,cap*sizeof(u32));
+		}
+		if(mark&&t->nev<MAX_EV)t->ev[t->nev++]=ms;
+		trace_ms[t->n]=ms;
+		t->x[t->n++]=x>4095?4095:x;
+	}
+	fclose(fp);
+	return 1;
+}
+
+//回放,返回误报数;lat_max:最大检测延迟(ms),missed:漏检数
+static u32 Replay(const char *name,const _trace *t,u32 *lat_max,u32 *missed)
+{
+	_ldet d;
+	u32 i,e=0,tp=0,fp=0,ms,lat,lat_sum=0;
+	u8 hit[MAX_EV]={0};
+
+	Ldet_Init(&d);
+	*lat_max=0;
+	for(i=0;i<t->n;i++)
+	{
+		ms=trace_ms?trace_ms[i]:i*DT;
+		if(!Ldet_Update(&d,t->x[i],ms))continue;
+		while(e<t->nev&&t->ev[e]+MATCH_MS<ms)e++;
+		if(e<t->nev&&ms>=t->ev[e]&&!hit[e])
+		{
+			hit[e]=1;
+			tp++;
+			lat=ms-t->ev[e];
+			lat_sum+=lat;
+			if(lat>*lat_max)*lat_max=lat;
+		}
+		else fp++;								//没有开盖,或同一次开盖检测了两次
+	}
+	*missed=t->nev-tp;
+	printf("%-14s %3u opens, %3u detected, %2u missed, latency avg %4u max %4u ms, %3u false (%.2f/h)\n",
+		name,t->nev,tp,*missed,tp?lat_sum/tp:0,*lat_max,fp,fp*3600000.0/(t->n*(double)DT));
+	return fp;
+}
+
+//边界情况,t为输入时间(ms)
+static u32 Feed(_ldet *d,u16 x,u32 n,u32 *t)
+{
+	u32 ev=0;
+
+	while(n--)
+	{
+		ev+=Ldet_Update(d,x,*t);
+		*t+=DT;
+	}
+	return ev;
+}
+
+static void Test_Cases(void)
+{
+	_ldet d;
+	u32 t=0,ev=0,i;
+
+	Ldet_Init(&d);
+	for(i=0;i<200;i++,t+=DT)ev+=Ldet_Update(&d,2000+(i&1)*4,t);
+	HOST_CHECK(ev==0&&d.state==LDET_IDLE);
+	HOST_CHECK((d.mean>>LDET_FRAC)>=2000&&(d.mean>>LDET_FRAC)<=2004);
+	HOST_CHECK(Ldet_Sigma(&d)<=4);
+
+	//单点毛刺
+	ev=Feed(&d,2600,1,&t)+Feed(&d,2002,4,&t);
+	HOST_CHECK(ev==0);
+
+	//开灯后一直保持:只报一次,超过LDET_STUCK_MS后以新的光照为基准
+	ev=Feed(&d,1200,LDET_STUCK_MS/DT+FS*10,&t);
+	HOST_CHECK(ev==1&&d.delta<0);
+	HOST_CHECK(d.state==LDET_IDLE&&(d.mean>>LDET_FRAC)==1200);
+
+	//新基准上的两次开盖相隔500ms,算一次;2秒后再开一次
+	ev=Feed(&d,600,6,&t)+Feed(&d,1200,4,&t)+Feed(&d,600,6,&t)+Feed(&d,1200,4,&t);
+	HOST_CHECK(ev==1);
+	t+=2000;
+	ev=Feed(&d,600,6,&t)+Feed(&d,1200,4,&t);
+	HOST_CHECK(ev==1&&d.events==3);
+}
+
+int main(int argc,char *argv[])
+{
+	static const _scene scene[]=
+	{
+		{"quiet room",		24,4,3,0,0,		400,0},
+		{"noisy sensor",	24,15,3,0,0,	400,0},
+		{"shadows+drift",	24,6,3,6,2,		400,1},
+		{"busy kitchen",	24,10,6,30,6,	400,4},
+	};
+	_trace t;
+	u32 fp,lat_max,missed;
+	u8 i;
+
+	Test_Cases();
+	for(i=0;i<sizeof scene/sizeof scene[0];i++)
+	{
+		Make(&t,&scene[i],i+1);
+		fp=Replay(scene[i].name,&t,&lat_max,&missed);
+		HOST_CHECK(missed==0);
+		HOST_CHECK(lat_max<=scene[i].max_lat_ms);
+		HOST_CHECK(fp<=scene[i].max_fp);
+		free(t.x);
+	}
+	if(argc>2)
+	{
+		if(Load(&t,argv[2]))Replay(argv[2],&t,&lat_max,&missed);
+		else printf("cannot open %s\n",argv[2]);
+	}
+	return Host_Result("t_ldet");
+}
@@ -0,0 +1,196 @@
+#include "host.h"
+#include "lsens.h"
+#include <stdio.h>
+
+//光敏传感器连续采样测试,不调用Lsens_Init(ADC校准等待硬件置位,在主机上不会结束)
+//这里模拟DMA2通道5:每个采样写到CMAR指向的缓冲,CNDTR递减,循环模式下减到0时重新装入,
+//写满一半和写满全部时置ISR中的HT5/TC5,稍后调用DMA2_Channel4_5_IRQHandler,
+//中断函数写IFCR清除标志(写1清零由这里模拟)
+//1.Lsens_Config设置的DMA和TIM8寄存器,参数限幅
+//2.每个抽取输出是半个缓冲的平均值,Lsens_Read按顺序取出,lsens_raw是最新的
+//3.中断晚到(DMA已在写另一半)时结果不变
+//4.主循环来不及取时丢弃最早的输出并计数,之后继续按顺序取出
+//5.运行中改变抽取倍数
+
+void DMA2_Channel4_5_IRQHandler(void);
+
+static u16 dma_size;				//Lsens_Config设置的缓冲长度
+static u16 dma_pos;					//下一个采样写入的位置
+static u32 pend;					//已置位、中断还没处理的标志
+static u16 late;					//中断晚几个采样处理
+static u16 late_cnt;
+static u32 in_seq=0;				//送入的采样序号
+
+
+//按Lsens_Config设置的寄存器开始
+static void Dma_Start(void)
+{
+	dma_size=DMA2_Channel5->CNDTR;
+	dma_pos=0;
+	pend=0;
+	DMA2->ISR=0;
+}
+
+//处理一个挂起的标志
+static void Dma_Irq(u32 flag)
+{
+	DMA2->ISR|=flag;
+	DMA2->IFCR=0;
+	DMA2_Channel4_5_IRQHandler();
+	HOST_CHECK(DMA2->IFCR&flag);
+	DMA2->ISR&=~flag;
+	pend&=~flag;
+}
+
+//ADC转换完成一个采样,DMA写入缓冲
+static void Dma_Sample(u16 v)
+{
+	u16 *buf=(u16 *)(unsigned long)DMA2_Channel5->CMAR;
+
+	HOST_CHECK(DMA2_Channel5->CCR&DMA_CCR5_EN);
+	buf[dma_pos++]=v;
+	DMA2_Channel5->CNDTR=dma_size-dma_pos;
+	if(dma_pos==dma_size/2)
+	{
+		HOST_CHECK(!(pend&DMA_ISR_TCIF5));	//上一圈的后一半必须已处理
+		pend|=DMA_ISR_HTIF5;
+		late_cnt=late;
+	}
+	else if(dma_pos==dma_size)
+	{
+		HOST_CHECK(!(pend&DMA_ISR_HTIF5));
+		pend|=DMA_ISR_TCIF5;
+		late_cnt=late;
+		dma_pos=0;
+		DMA2_Channel5->CNDTR=dma_size;	//循环模式重新装入
+	}
+	else if(late_cnt)late_cnt--;
+	if(pend&&late_cnt==0)Dma_Irq(pend);
+}
+
+//采样值:按序号变化,每个块的平均值各不相同
+static u16 Sample(void)
+{
+	u32 n=in_seq++;
+
+	return (n*37+(n>>3)*11)%4096;
+}
+
+//送入一个块(dec个采样),返回平均值
+static u16 Block(u8 dec)
+{
+	u32 sum=0;
+	u16 v;
+	u8 i;
+
+	for(i=0;i<dec;i++)
+	{
+		v=Sample();
+		sum+=v;
+		Dma_Sample(v);
+	}
+	return sum/dec;
+}
+
+
+static void Test_Config(void)
+{
+	Lsens_Config(LSENS_RATE_HZ,LSENS_DEC);
+	HOST_CHECK(DMA2_Channel5->CPAR==(u32)(unsigned long)&ADC3->DR);
+	HOST_CHECK(DMA2_Channel5->CMAR!=0);
+	HOST_CHECK(DMA2_Channel5->CNDTR==LSENS_DEC*2);
+	HOST_CHECK((DMA2_Channel5->CCR&(DMA_CCR5_CIRC|DMA_CCR5_MINC|DMA_CCR5_HTIE|DMA_CCR5_TCIE|DMA_CCR5_EN))==
+		(DMA_CCR5_CIRC|DMA_CCR5_MINC|DMA_CCR5_HTIE|DMA_CCR5_TCIE|DMA_CCR5_EN));
+	HOST_CHECK(!(DMA2_Channel5->CCR&DMA_CCR5_DIR));		//外设到内存
+	HOST_CHECK(TIM8->PSC==72-1&&TIM8->ARR==1000000/LSENS_RATE_HZ-1);
+	HOST_CHECK((TIM8->CR2&TIM_CR2_MMS)==TIM_TRGOSource_Update);
+	HOST_CHECK(TIM8->CR1&TIM_CR1_CEN);
+
+	Lsens_Config(5,0);							//最低16Hz,抽取倍数至少1
+	HOST_CHECK(TIM8->ARR==1000000/16-1&&DMA2_Channel5->CNDTR==2);
+	Lsens_Config(60000,200);					//最高LSENS_RATE_MAX,抽取倍数最多LSENS_DEC_MAX
+	HOST_CHECK(TIM8->ARR==1000000/LSENS_RATE_MAX-1&&DMA2_Channel5->CNDTR==LSENS_DEC_MAX*2);
+}
+
+//按顺序取出,每个输出都是它那一块的平均
+static void Test_Order(u8 dec,u32 blocks)
+{
+	u16 expect,raw;
+	u32 i,bad=0,seq0;
+
+	Lsens_Config(LSENS_RATE_HZ,dec);
+	Dma_Start();
+	while(Lsens_Read(&raw));			//取走以前的输出
+	seq0=lsens_seq;
+	for(i=0;i<blocks;i++)
+	{
+		expect=Block(dec);
+		if(lsens_seq!=seq0+i+1||!Lsens_Read(&raw)||raw!=expect)bad++;
+		if(lsens_raw!=expect||Lsens_Read(&raw))bad++;
+	}
+	printf("dec %u: %u blocks, %u bad\n",dec,blocks,bad);
+	HOST_CHECK(bad==0);
+}
+
+//中断晚到:HT中断在DMA写了另一半的几个采样之后才处理,平均的仍是前一半
+static void Test_Late(void)
+{
+	u16 expect[4],raw;
+	u8 i;
+
+	Lsens_Config(LSENS_RATE_HZ,LSENS_DEC);
+	Dma_Start();
+	while(Lsens_Read(&raw));
+	late=LSENS_DEC-1;					//不超过半个缓冲的时间
+	for(i=0;i<4;i++)expect[i]=Block(LSENS_DEC);
+	late=0;
+	HOST_CHECK(pend==DMA_ISR_TCIF5);
+	Dma_Irq(pend);						//最后一块的中断
+	for(i=0;i<4;i++)HOST_CHECK(Lsens_Read(&raw)&&raw==expect[i]);
+	HOST_CHECK(!Lsens_Read(&raw));
+}
+
+//来不及取:保留最近LSENS_RING-2个,丢弃的计入lsens_lost
+static void Test_Overrun(void)
+{
+	u16 expect[40],raw;
+	u32 lost0,i;
+
+	Lsens_Config(LSENS_RATE_HZ,8);
+	Dma_Start();
+	while(Lsens_Read(&raw));
+	lost0=lsens_lost;
+	for(i=0;i<40;i++)expect[i]=Block(8);
+	for(i=40-(LSENS_RING-2);i<40;i++)HOST_CHECK(Lsens_Read(&raw)&&raw==expect[i]);
+	HOST_CHECK(!Lsens_Read(&raw));
+	HOST_CHECK(lsens_lost-lost0==40-(LSENS_RING-2));
+
+	//之后没有丢失
+	for(i=0;i<3;i++)expect[i]=Block(8);
+	for(i=0;i<3;i++)HOST_CHECK(Lsens_Read(&raw)&&raw==expect[i]);
+	HOST_CHECK(lsens_lost-lost0==40-(LSENS_RING-2));
+}
+
+//光照值:ADC值越大越暗
+static void Test_Val(void)
+{
+	lsens_raw=0;
+	HOST_CHECK(Lsens_Get_Val()==100);
+	lsens_raw=2000;
+	HOST_CHECK(Lsens_Get_Val()==50);
+	lsens_raw=4095;
+	HOST_CHECK(Lsens_Get_Val()==0);
+}
+
+int main(void)
+{
+	Test_Config();
+	Test_Order(LSENS_DEC,1000);
+	Test_Order(1,1000);						//每个采样一个输出,HT和TC交替
+	Test_Order(LSENS_DEC_MAX,100);
+	Test_Order(10,500);						//运行中改变抽取倍数
+	Test_Late();
+	Test_Overrun();
+	Test_Val();
+	return Host_Result("t_lsens");
+}
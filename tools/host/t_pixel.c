@@ -0,0 +1,166 @@
+#include "system.h"
+
+//逐像素写入的开销:每像素调用一次函数(原来的LCD_WriteData_Color)与LCD_PIXEL内联展开(lcd_port.h)对照
+//按C在-O0编译(与Keil工程的优化等级相同),不经LCD模拟器,总线是内存中的一个寄存器块,写入没有别的开销
+//三种常见的循环:单色填充,颜色数组块写入,24号字逐行展开(与LCD_ShowCharRun相同)
+//打印每个像素的纳秒数,取5次中最快的一次
+//用法:make bench
+
+#define TFTLCD	(&null_bus)
+#include "tftlcd.h"
+#include "font.h"
+#include <stdio.h>
+#include <string.h>
+#include <time.h>
+
+#define NPX		(480*320)		//每次写入的像素数
+#define TEXT	"Medicine Box 0123"
+
+static TFTLCD_TypeDef null_bus;
+static u16 block[NPX];
+
+
+static double Now(void)
+{
+	struct timespec t;
+
+	clock_gettime(CLOCK_MONOTONIC,&t);
+	return t.tv_sec+t.tv_nsec*1e-9;
+}
+
+//原来的写法:每个像素一次函数调用
+static void Old_WriteData_Color(u16 color)
+{
+	LCD_PORT_PIXEL(color);
+}
+
+static void Old_Fill(u16 color)
+{
+	u32 n;
+
+	for(n=NPX;n;n--)Old_WriteData_Color(color);
+}
+
+static void New_Fill(u16 color)
+{
+	u32 n;
+
+	for(n=NPX;n;n--)LCD_PORT_PIXEL(color);
+}
+
+static void Old_Block(u16 color)
+{
+	const u16 *p=block;
+	u32 n;
+
+	(void)color;
+	for(n=NPX;n;n--)Old_WriteData_Color(*p++);
+}
+
+static void New_Block(u16 color)
+{
+	const u16 *p=block;
+	u32 n;
+
+	(void)color;
+	for(n=NPX;n;n--)LCD_PORT_PIXEL(*p++);
+}
+
+//一行字符逐行展开,返回写入的像素数
+static u32 Old_Text_Run(const u8 *s,u16 n)
+{
+	const u8 *font;
+	u16 r,i,c;
+	u8 mask;
+
+	for(r=0;r<24;r++)
+	{
+		mask=0x80>>(r&7);
+		for(i=0;i<n;i++)
+		{
+			font=ascii_2412[s[i]-' ']+(r>>3);
+			for(c=0;c<12;c++)Old_WriteData_Color((font[c*3]&mask)?BLACK:WHITE);
+		}
+	}
+	return (u32)n*12*24;
+}
+
+static u32 New_Text_Run(const u8 *s,u16 n)
+{
+	const u8 *font;
+	u16 r,i,c;
+	u8 mask;
+
+	for(r=0;r<24;r++)
+	{
+		mask=0x80>>(r&7);
+		for(i=0;i<n;i++)
+		{
+			font=ascii_2412[s[i]-' ']+(r>>3);
+			for(c=0;c<12;c++)LCD_PORT_PIXEL((font[c*3]&mask)?BLACK:WHITE);
+		}
+	}
+	return (u32)n*12*24;
+}
+
+static void Old_Text(u16 color)
+{
+	u32 n=0;
+
+	(void)color;
+	while(n<NPX)n+=Old_Text_Run((const u8 *)TEXT,strlen(TEXT));
+}
+
+static void New_Text(u16 color)
+{
+	u32 n=0;
+
+	(void)color;
+	while(n<NPX)n+=New_Text_Run((const u8 *)TEXT,strlen(TEXT));
+}
+
+typedef struct
+{
+	const char *name;
+	void (*fn[2])(u16 color);		//原来的写法,LCD_PIXEL
+	u32 px;							//每次写入的像素数
+}_bench;
+
+static const _bench bench[]=
+{
+	{"LCD_Fill",{Old_Fill,New_Fill},NPX},
+	{"colour block",{Old_Block,New_Block},NPX},
+	{"24px text",{Old_Text,New_Text},(NPX+17*12*24-1)/(17*12*24)*(17*12*24)},
+};
+
+//5次中最快一次每像素的纳秒数
+static double Run(void (*fn)(u16 color),u32 px)
+{
+	double t0,t,best=1e9;
+	u8 i;
+
+	for(i=0;i<5;i++)
+	{
+		t0=Now();
+		fn(RED);
+		t=(Now()-t0)*1e9/px;
+		if(t<best)best=t;
+	}
+	return best;
+}
+
+int main(void)
+{
+	double t[2];
+	u32 i;
+
+	for(i=0;i<NPX;i++)block[i]=i*37;
+	printf("%-14s %8s %8s  (ns/pixel, null bus, -O0)\n","loop","call","inline");
+	for(i=0;i<sizeof bench/sizeof bench[0];i++)
+	{
+		t[0]=Run(bench[i].fn[0],bench[i].px);
+		t[1]=Run(bench[i].fn[1],bench[i].px);
+		printf("%-14s %8.2f %8.2f\n",bench[i].name,t[0],t[1]);
+	}
+	return 0;
+}
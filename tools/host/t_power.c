@@ -0,0 +1,282 @@
+#include "host.h"
+#include "lcd_emu.h"
+#include "rtc.h"
+#include "evq.h"
+#include "key.h"
+#include "power.h"
+#include "dht11.h"
+#include "lsens.h"
+#include "hc05.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <unistd.h>
+
+//低功耗测试:整个应用程序(main.c的app_main)在虚拟时间上运行24小时
+//RTC由这里按真实时间模拟:每秒调用RTC_IRQHandler,停止模式期间SysTick不走、RTC照走,
+//PWR_EnterSTOPMode一直停到RTC闹钟;TIM4在运行时每1ms调用TIM4_IRQHandler
+//服药报警出现20秒后模拟按一下KEY_UP(经EXTI0和TIM4消抖),5秒后再按一下回到主界面
+//检查:每个服药时间都按时报警,其余时间大部分在停止模式,醒来后补上的SysTick与RTC一致,
+//打印运行/睡眠/停止的比例
+//程序的串口输出写到<输出目录>/t_power.log
+//温湿度和光敏由下面的桩代替,它们的驱动另有测试
+
+#define SIM_S		(24*3600+60)		//模拟时长(s)
+#define START_SOD	30					//开始时间 00:00:30
+#define REACT_S		20					//报警后多久按键
+#define PRESS_US	150000				//按键按住的时间
+
+//main.c
+struct SystemState
+{
+	u8 current_state;
+};
+typedef struct
+{
+	char name[16];
+	u8 hour;
+	u8 minute;
+	u8 taken;
+}Medicine;
+extern struct SystemState system_state;
+extern Medicine medicines[3];
+int app_main(void);
+
+//中断函数
+void RTC_IRQHandler(void);
+void EXTI0_IRQHandler(void);
+void TIM4_IRQHandler(void);
+
+#define STATE_ALARM		1
+#define STATE_MED_TAKEN	2
+
+#define NMED	(sizeof medicines/sizeof medicines[0])
+
+//RTC:真实时间 = 虚拟时间 + rtc_off,停止模式期间rtc_off增加
+static long long rtc_off=0;
+static u32 rtc_base;				//真实时间0时的计数值
+static u32 rtc_alarm;
+static u16 rtc_it=0;				//待处理的RTC中断标志
+static u32 rtc_day0;				//开始那天0点的计数值
+
+static u64 next_sec,next_tick,key_down=0,key_up=0;
+static u64 stop_us=0;
+static u32 stops=0;
+static u8 last_state=0xFF;
+static u32 alarms[NMED];			//各药的报警次数
+static s32 alarm_late[NMED];		//报警时间与服药时间之差(s)
+static s32 drift_ms=0;				//进入停止模式时SysTick与RTC之差(ms)
+static int out_fd=-1;
+
+
+static long long Real_Us(void)
+{
+	return (long long)Host_Us()+rtc_off;
+}
+
+//标准外设库中的RTC函数,这里按上面的模型实现,
+//RTC_WaitForSynchro之类等待硬件置位的循环在主机上不会结束
+void RTC_ITConfig(uint16_t RTC_IT,FunctionalState NewState){(void)RTC_IT;(void)NewState;}
+void RTC_EnterConfigMode(void){}
+void RTC_ExitConfigMode(void){}
+void RTC_SetPrescaler(uint32_t PrescalerValue){(void)PrescalerValue;}
+void RTC_WaitForLastTask(void){}
+void RTC_WaitForSynchro(void){}
+void RTC_ClearFlag(uint16_t RTC_FLAG){(void)RTC_FLAG;}
+
+uint32_t RTC_GetCounter(void)
+{
+	return rtc_base+(u32)(Real_Us()/1000000);
+}
+
+void RTC_SetCounter(uint32_t CounterValue)
+{
+	rtc_base=CounterValue-(u32)(Real_Us()/1000000);
+}
+
+uint32_t RTC_GetDivider(void)
+{
+	return 32767-(u32)(Real_Us()%1000000*32768/1000000);	//向下计数
+}
+
+void RTC_SetAlarm(uint32_t AlarmValue)
+{
+	rtc_alarm=AlarmValue;
+}
+
+ITStatus RTC_GetITStatus(uint16_t RTC_IT)
+{
+	return (rtc_it&RTC_IT)?SET:RESET;
+}
+
+void RTC_ClearITPendingBit(uint16_t RTC_IT)
+{
+	rtc_it&=~RTC_IT;
+}
+
+
+//温湿度和光敏的桩:测量立即完成,25度40%;光敏没有取药动作
+u8 DHT11_Init(void)
+{
+	return 0;
+}
+
+u8 DHT11_Start(void)
+{
+	EvQ_Post(EV_DHT11,(DHT11_OK<<16)|(25<<8)|40);
+	return 1;
+}
+
+void Lsens_Init(void){}
+
+u8 Lsens_Read(u16 *raw)
+{
+	(void)raw;
+	return 0;
+}
+
+u8 Lsens_Get_Val(void)
+{
+	return 50;
+}
+
+
+static void Irq(void);
+
+//停止模式:停到RTC计数器从闹钟值变为下一个值
+static void Stop(void)
+{
+	long long now=Real_Us();
+	long long wake=(long long)(rtc_alarm+1-rtc_base)*1000000;
+
+	HOST_CHECK(wake>now);
+	if(wake<=now)return;
+	HOST_CHECK(key_down==0&&key_up==0);		//按键期间不应进入
+	drift_ms=(s32)((long long)SysTick_Ms64()-now/1000);	//上次醒来时补上的时间是否准确
+	rtc_off+=wake-now;
+	stop_us+=wake-now;
+	stops++;
+	next_sec=Host_Us();				//醒来时RTC秒中断已挂起,虚拟时间不走,这里直接处理
+	Irq();
+}
+
+static void Report(void)
+{
+	double total=Real_Us(),sleep=host_sleep_us;
+	u8 i;
+
+	fflush(stdout);
+	dup2(out_fd,1);
+	printf("%-16s %6s %6s %6s\n","medicine","time","alarms","late");
+	for(i=0;i<NMED;i++)
+		printf("%-16s  %02u:%02u %6u %5ds\n",medicines[i].name,medicines[i].hour,medicines[i].minute,alarms[i],alarm_late[i]);
+	printf("24h: stop %.2f%% (%u times), sleep %.2f%%, run %.2f%%, SysTick drift %d ms\n",
+		stop_us*100/total,stops,sleep*100/total,(total-stop_us-sleep)*100/total,drift_ms);
+	for(i=0;i<NMED;i++)
+	{
+		HOST_CHECK(alarms[i]==1);
+		HOST_CHECK(alarm_late[i]>=0&&alarm_late[i]<=2);
+		HOST_CHECK(medicines[i].taken);
+	}
+	HOST_CHECK(stops>1000);
+	HOST_CHECK(stop_us>total*0.9);
+	HOST_CHECK(drift_ms>=-20&&drift_ms<=20);
+	exit(Host_Result("t_power"));
+}
+
+//每秒检查一次状态:报警时记录时间,安排按键
+static void Monitor(void)
+{
+	u32 sec=RTC_GetCounter()-rtc_day0;
+	u32 sod=sec%86400,t;
+	u8 s=system_state.current_state,i;
+
+	if(s!=last_state)
+	{
+		printf("[t_power] %02u:%02u:%02u state %u\n",sod/3600,sod/60%60,sod%60,s);
+		if(s==STATE_ALARM)
+		{
+			for(i=0;i<NMED;i++)
+			{
+				t=(u32)medicines[i].hour*3600+medicines[i].minute*60;
+				if(sod>=t&&sod<t+60)
+				{
+					alarms[i]++;
+					alarm_late[i]=sod-t;
+				}
+			}
+		}
+		if(s==STATE_ALARM||s==STATE_MED_TAKEN)key_down=Host_Us()+(s==STATE_ALARM?REACT_S:5)*1000000ULL;
+		last_state=s;
+	}
+	if(sec>=START_SOD+SIM_S)Report();
+}
+
+//模拟的中断:RTC秒中断,TIM4的1ms中断,KEY_UP的边沿
+static void Irq(void)
+{
+	u64 now=Host_Us(),next;
+
+	HC05_LED=0;						//蓝牙没有连接;HC05_Init写的1在硬件上无效,这里是普通内存
+	if(now>=next_sec)
+	{
+		rtc_it|=RTC_IT_SEC;
+		RTC_IRQHandler();
+		Monitor();
+		next_sec=now+1000000-Real_Us()%1000000;
+	}
+	if(key_down&&now>=key_down)
+	{
+		key_down=0;
+		key_up=now+PRESS_US;
+		KEY_UP=1;
+		EXTI->PR|=EXTI_Line0;
+		EXTI0_IRQHandler();
+	}
+	else if(key_up&&now>=key_up)
+	{
+		key_up=0;
+		KEY_UP=0;
+		EXTI->PR|=EXTI_Line0;
+		EXTI0_IRQHandler();
+	}
+	if((TIM4->CR1&TIM_CR1_CEN)&&now>=next_tick)
+	{
+		TIM4->SR=TIM_IT_Update;
+		TIM4_IRQHandler();
+		next_tick=now+1000;
+	}
+	next=next_sec;
+	if(TIM4->CR1&TIM_CR1_CEN)
+	{
+		if(next_tick<=now)next_tick=now+1000;
+		if(next_tick<next)next=next_tick;
+	}
+	if(key_down&&key_down<next)next=key_down;
+	if(key_up&&key_up<next)next=key_up;
+	Host_Irq_At(next,Irq);
+}
+
+int main(int argc,char *argv[])
+{
+	char path[256];
+
+	snprintf(path,sizeof path,"%s/t_power.log",argc>1?argv[1]:".");
+	fflush(stdout);
+	out_fd=dup(1);
+	if(!freopen(path,"w",stdout))return 2;
+
+	Emu_Reset();
+	BKP->DR1=0xA0A0;				//RTC已配置过,RTC_Init不重新设置
+	RTC_Set(2026,10,17,0,0,START_SOD);
+	rtc_day0=RTC_GetCounter()-START_SOD;
+	KEY0=1;							//KEY0~2上拉,松开时为1
+	KEY1=1;
+	KEY2=1;
+	KEY_UP=0;
+	host_stop=Stop;
+	next_sec=1000000;
+	next_tick=1000;
+	Host_Irq_At(next_tick,Irq);
+	app_main();
+	return 1;
+}
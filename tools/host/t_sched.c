@@ -0,0 +1,166 @@
+#include "host.h"
+#include "sched.h"
+#include "swtimer.h"
+#include "evq.h"
+#include "power.h"
+#include <stdio.h>
+#include <setjmp.h>
+
+//调度器测试:Sched_Loop在虚拟时钟上运行60秒,任务按main.c的周期注册,用推进虚拟时间模拟运行时间
+//检查:各任务运行次数和间隔(不漂移,落后后不补跑)、轮询任务和事件延迟、软件定时器准时、
+//空闲时tickless睡眠(唤醒次数远少于毫秒数)、空闲时间统计与实际相符
+
+#define RUN_MS		60000
+#define STALL_MS	20000		//这之后display的一次运行占用30ms
+
+typedef struct
+{
+	u32 runs;
+	u32 last;			//上一次运行时间(ms)
+	u32 min_gap;
+	u32 max_gap;
+}_stat;
+
+static jmp_buf done;
+static u64 busy_us=0;					//各任务占用的时间
+static _stat st_input,st_bt,st_light,st_disp,st_hc05;
+static u32 ev_posted=0,ev_got=0,ev_max_us=0,ev_sum_us=0;
+static u32 polls=0;
+static u8 stalled=0;
+static _swtimer tm_once,tm_period;
+static u32 once_ms=0,period_runs=0,period_last=0,period_late=0;
+
+
+static void Burn(u32 us)
+{
+	Host_Advance_Us(us);
+	busy_us+=us;
+}
+
+static void Stat(_stat *s)
+{
+	u32 now=SysTick_Ms(),gap;
+
+	if(s->runs)
+	{
+		gap=now-s->last;
+		if(s->runs==1||gap<s->min_gap)s->min_gap=gap;
+		if(gap>s->max_gap)s->max_gap=gap;
+	}
+	s->last=now;
+	s->runs++;
+}
+
+static void task_input(void){Stat(&st_input);Burn(30);}
+static void task_bt(void){Stat(&st_bt);Burn(80);}
+static void task_light(void){Stat(&st_light);Burn(2600);}
+static void task_hc05(void){Stat(&st_hc05);Burn(3000);}
+static void task_stop(void){longjmp(done,1);}
+
+static void task_display(void)
+{
+	Stat(&st_disp);
+	if(!stalled&&SysTick_Ms()>=STALL_MS)
+	{
+		stalled=1;
+		Burn(30000);
+	}
+	else Burn(900);
+}
+
+//轮询任务:取出事件,统计从中断放入到取出的延迟
+static void task_events(void)
+{
+	_event ev;
+	u32 us;
+
+	polls++;
+	while(EvQ_Get(&ev))
+	{
+		us=SysTick_Us()-ev.time;
+		if(us>ev_max_us)ev_max_us=us;
+		ev_sum_us+=us;
+		ev_got++;
+	}
+}
+
+//模拟的外部中断,间隔不规则
+static void Irq(void)
+{
+	EvQ_Post(EV_KEY,ev_posted++);
+	Host_Irq_At(Host_Us()+20000+(ev_posted*7919)%35000,Irq);
+}
+
+static void Once(void)
+{
+	once_ms=SysTick_Ms();
+}
+
+static void Period(void)
+{
+	u32 now=SysTick_Ms();
+
+	if(now-period_last>7+3)period_late++;
+	period_last=now;
+	period_runs++;
+}
+
+int main(void)
+{
+	u64 elapsed;
+	u32 idle;
+
+	EvQ_Init();
+	SwTimer_Init();
+	Sched_Add("input",task_input,10,0,10);
+	Sched_Add("event",task_events,0,0,2);
+	Sched_Add("bt",task_bt,20,1,20);
+	Sched_Add("light",task_light,100,3,50);
+	Sched_Add("display",task_display,100,9,100);
+	Sched_Add("hc05",task_hc05,5000,13,1000);
+	Sched_Add("stop",task_stop,RUN_MS,RUN_MS,1000);
+	SwTimer_Start(&tm_once,12345,0,Once);
+	SwTimer_Start(&tm_period,7,7,Period);
+	Host_Irq_At(5000,Irq);
+
+	if(setjmp(done)==0)Sched_Loop();
+	elapsed=Host_Us();
+	idle=sched_idle_us;
+	Sched_Report();
+
+	printf("input %u runs gap %u..%u ms, bt %u, light %u, display %u, hc05 %u\n",
+		st_input.runs,st_input.min_gap,st_input.max_gap,st_bt.runs,st_light.runs,st_disp.runs,st_hc05.runs);
+	printf("events %u/%u, latency max %u us avg %u us, %u polls\n",ev_got,ev_posted,ev_max_us,
+		ev_got?ev_sum_us/ev_got:0,polls);
+	printf("sleeps %u in %u ms, idle %u ms, busy %u ms\n",host_sleep_calls,(u32)(elapsed/1000),
+		idle/1000,(u32)(busy_us/1000));
+
+	//周期不漂移,落后一个周期以上时不补跑,最多少跑几次
+	HOST_CHECK(st_input.runs<=RUN_MS/10&&st_input.runs>=RUN_MS/10-3);
+	HOST_CHECK(st_input.min_gap>=10-3);			//其他任务最长运行2.6ms
+	HOST_CHECK(st_input.max_gap>=30&&st_input.max_gap<=40);	//30ms的那一次
+	HOST_CHECK(st_bt.runs<=RUN_MS/20&&st_bt.runs>=RUN_MS/20-2);
+	HOST_CHECK(st_light.runs==RUN_MS/100);
+	HOST_CHECK(st_disp.runs==RUN_MS/100);
+	HOST_CHECK(st_hc05.runs==RUN_MS/5000);
+	HOST_CHECK(st_light.min_gap>=100-3&&st_light.max_gap<=100+30);
+
+	//轮询任务每轮都运行,事件最多等一个任务的运行时间
+	HOST_CHECK(ev_posted>1000&&ev_got==ev_posted);
+	HOST_CHECK(ev_max_us<=30000);
+	HOST_CHECK(ev_sum_us/ev_got<3000);
+	HOST_CHECK(evq_dropped==0);
+
+	//定时器准时,睡眠不会错过定时器
+	HOST_CHECK(once_ms==12345);
+	HOST_CHECK(period_runs<=RUN_MS/7&&period_runs>=RUN_MS/7-5);
+	HOST_CHECK(period_late<=1);					//只有30ms那一次
+
+	//tickless:只在有任务、定时器到期或中断时醒来,不是每毫秒醒一次
+	HOST_CHECK(host_sleep_calls<RUN_MS/3);
+	//虚拟时间里调度本身不占时间,空闲加上任务运行正好是全部时间,空闲都在Power_Idle中睡眠
+	HOST_CHECK(elapsed>=(u64)RUN_MS*1000&&elapsed<(u64)RUN_MS*1000+1000);
+	HOST_CHECK(idle+busy_us==elapsed);
+	HOST_CHECK(power_sleep_us==idle);
+	return Host_Result("t_sched");
+}
@@ -0,0 +1,191 @@
+#include "host.h"
+#include "lcd_emu.h"
+#include "tftlcd.h"
+#include "lcd_dma.h"
+#include "lcd_shadow.h"
+#include <stdio.h>
+#include <string.h>
+
+//调色板影子帧缓冲测试,lcd_shadow.c和本文件用-DLCD_SHADOW=1编译(见Makefile)
+//1.第一帧写出全部600块,屏幕与直接用LCD_Fill/LCD_ShowString画出的相同
+//2.再画一遍相同的文字不写出;时钟走一分钟只重画时钟,写出最后一位数字所在的2块
+//  (整屏先清再重画时途经的块都变脏,脏标记只记像素是否被改过)
+//3.随机填充和画点,每次刷新后屏幕与按调色板逐点计算的相同,写出的块包含全部改变了的块
+//4.改变调色板后全部重新写出
+
+#define TILES	(LCD_SHADOW_TX*LCD_SHADOW_TY)
+
+static const u16 pal[LCD_SHADOW_COLORS]={WHITE,BLACK,BLUE,RED};
+static u16 scr[EMU_H][EMU_W];
+static u16 ref[EMU_H][EMU_W];
+static u16 last[EMU_H][EMU_W];		//上次刷新后的屏幕
+static u32 rnd=1;
+
+
+static u32 Rand(u32 n)
+{
+	rnd=rnd*1103515245+12345;
+	return (rnd>>8)%n;
+}
+
+//刷新,返回写出的块数,写出的像素与块数一致
+static u32 Flush(void)
+{
+	u32 n;
+
+	Emu_Clear_Count();
+	n=LCD_Shadow_Flush();
+	LCD_DMA_Wait();
+	HOST_CHECK(n==lcd_shadow_tiles);
+	HOST_CHECK(emu.n.pixel==n*LCD_SHADOW_TILE*LCD_SHADOW_TILE);
+	HOST_CHECK(emu.outside==0);
+	return n;
+}
+
+//与last相比有像素改变的块数
+static u32 Changed_Tiles(void)
+{
+	u16 tx,ty,y;
+	u32 n=0;
+
+	for(ty=0;ty<LCD_SHADOW_TY;ty++)
+		for(tx=0;tx<LCD_SHADOW_TX;tx++)
+		{
+			for(y=ty*LCD_SHADOW_TILE;y<(ty+1)*LCD_SHADOW_TILE;y++)
+				if(memcmp(&emu.gram[y][tx*LCD_SHADOW_TILE],&last[y][tx*LCD_SHADOW_TILE],LCD_SHADOW_TILE*2))break;
+			if(y<(ty+1)*LCD_SHADOW_TILE)n++;
+		}
+	return n;
+}
+
+//主界面的样子:背景,标题栏,时钟和两行文字,shadow为1时画到影子缓冲,为0时直接画到屏幕
+static void Frame(u8 shadow,const char *clock)
+{
+	if(shadow)
+	{
+		LCD_Shadow_Fill(0,0,EMU_W-1,EMU_H-1,0);
+		LCD_Shadow_Fill(0,0,EMU_W-1,47,2);
+		LCD_Shadow_String(16,8,288,32,32,(u8 *)"Medicine Box",0,2);
+		LCD_Shadow_String(16,96,160,32,32,(u8 *)clock,1,0);
+		LCD_Shadow_String(16,160,288,16,16,(u8 *)"Next dose 12:00",3,0);
+		LCD_Shadow_String(16,192,288,16,16,(u8 *)"2026-10-17",1,0);
+		return;
+	}
+	LCD_Fill(0,0,EMU_W-1,EMU_H-1,WHITE);
+	LCD_Fill(0,0,EMU_W-1,47,BLUE);
+	FRONT_COLOR=WHITE;
+	BACK_COLOR=BLUE;
+	LCD_ShowString(16,8,288,32,32,(u8 *)"Medicine Box");
+	FRONT_COLOR=BLACK;
+	BACK_COLOR=WHITE;
+	LCD_ShowString(16,96,160,32,32,(u8 *)clock);
+	FRONT_COLOR=RED;
+	LCD_ShowString(16,160,288,16,16,(u8 *)"Next dose 12:00");
+	FRONT_COLOR=BLACK;
+	LCD_ShowString(16,192,288,16,16,(u8 *)"2026-10-17");
+	LCD_DMA_Wait();
+}
+
+static void Test_Frames(void)
+{
+	u32 n;
+
+	//直接画出的参考画面
+	Frame(0,"12:35");
+	memcpy(ref,emu.gram,sizeof ref);
+	Frame(0,"12:34");
+	memcpy(scr,emu.gram,sizeof scr);
+	LCD_Clear(GREEN);
+	LCD_DMA_Wait();
+
+	LCD_Shadow_Palette(pal,LCD_SHADOW_COLORS);
+	LCD_Shadow_Init();
+	Frame(1,"12:34");
+	n=Flush();
+	printf("first frame: %u tiles, %u px\n",n,emu.n.pixel);
+	HOST_CHECK(n==TILES);
+	HOST_CHECK(memcmp(emu.gram,scr,sizeof scr)==0);
+
+	HOST_CHECK(Flush()==0);
+	LCD_Shadow_String(16,96,160,32,32,(u8 *)"12:34",1,0);		//相同内容不变脏
+	HOST_CHECK(Flush()==0);
+
+	LCD_Shadow_String(16,96,160,32,32,(u8 *)"12:35",1,0);
+	n=Flush();
+	printf("minute change: %u tiles, %u cmd, %u px\n",n,emu.n.cmd,emu.n.pixel);
+	HOST_CHECK(n==2);
+	HOST_CHECK(memcmp(emu.gram,ref,sizeof ref)==0);
+
+	Frame(1,"12:35");
+	n=Flush();
+	printf("full redraw of the same frame: %u tiles\n",n);
+	HOST_CHECK(memcmp(emu.gram,ref,sizeof ref)==0);
+}
+
+static void Test_Random(void)
+{
+	u16 x,y,w,h,sx,sy;
+	u32 r,i,n,changed,flushed=0,need=0;
+	u8 c;
+
+	memcpy(ref,emu.gram,sizeof ref);
+	memcpy(last,emu.gram,sizeof last);
+	for(r=0;r<300;r++)
+	{
+		for(i=1+Rand(20);i;i--)
+		{
+			c=Rand(LCD_SHADOW_COLORS);
+			w=1+Rand(Rand(4)?24:EMU_W);
+			h=1+Rand(Rand(4)?24:EMU_H);
+			sx=Rand(EMU_W-w+1);
+			sy=Rand(EMU_H-h+1);
+			if(Rand(3))LCD_Shadow_Fill(sx,sy,sx+w-1,sy+h-1,c);
+			else
+			{
+				w=h=1;
+				LCD_Shadow_Point(sx,sy,c);
+			}
+			for(y=sy;y<sy+h;y++)
+				for(x=sx;x<sx+w;x++)ref[y][x]=pal[c];
+		}
+		n=Flush();
+		changed=Changed_Tiles();
+		flushed+=n;
+		need+=changed;
+		HOST_CHECK(memcmp(emu.gram,ref,sizeof ref)==0);
+		HOST_CHECK(n>=changed);
+		memcpy(last,emu.gram,sizeof last);
+	}
+	printf("300 random updates: %u tiles flushed, %u tiles changed\n",flushed,need);
+}
+
+static void Test_Palette(void)
+{
+	static const u16 pal2[LCD_SHADOW_COLORS]={BLACK,WHITE,BLUE,RED};
+	u16 x,y;
+
+	LCD_Shadow_Palette(pal,LCD_SHADOW_COLORS);
+	HOST_CHECK(Flush()==0);
+	LCD_Shadow_Palette(pal2,LCD_SHADOW_COLORS);
+	HOST_CHECK(Flush()==TILES);
+	for(y=0;y<EMU_H;y++)
+		for(x=0;x<EMU_W;x++)
+		{
+			if(ref[y][x]==WHITE)ref[y][x]=BLACK;
+			else if(ref[y][x]==BLACK)ref[y][x]=WHITE;
+		}
+	HOST_CHECK(memcmp(emu.gram,ref,sizeof ref)==0);
+	HOST_CHECK(LCD_Shadow_Index(RED)==3&&LCD_Shadow_Index(GREEN)==0);
+}
+
+int main(void)
+{
+	Emu_Reset();
+	TFTLCD_Init();
+	LCD_DMA_Wait();
+	HOST_CHECK(LCD_SHADOW_TX==EMU_W/LCD_SHADOW_TILE&&LCD_SHADOW_TY==EMU_H/LCD_SHADOW_TILE);
+	Test_Frames();
+	Test_Random();
+	Test_Palette();
+	return Host_Result("t_shadow");
+}
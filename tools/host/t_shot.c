@@ -0,0 +1,143 @@
+#include "host.h"
+#include "lcd_emu.h"
+#include "tftlcd.h"
+#include "lcd_shot.h"
+#include "usart.h"
+#include <stdio.h>
+#include <string.h>
+#include <stdint.h>
+
+//截屏测试:LCD_Shot_Start/LCD_Shot_Poll分批读出GRAM,由DMA1通道4发送到USART1
+//模拟115200波特率下每10ms(task_input的周期)DMA送出的字节数,收到的数据解码后与GRAM逐像素比较,
+//并检查每次LCD_Shot_Poll读出的行数不超过LCD_SHOT_ROWS,发送期间printf的输出被丢弃
+
+#define POLL_MS		10
+#define DMA_BYTES	(115200/10*POLL_MS/1000)	//每个周期串口送出的字节数
+
+static u8 rx[EMU_W*EMU_H*3];
+static u32 rx_len;
+static u16 scr[EMU_H][EMU_W];
+
+
+//模拟DMA1通道4和USART1:写1清零的IFCR,每次送出DMA_BYTES字节,送完置位传输完成
+static void Dma_Step(void)
+{
+	u32 n;
+	u8 *p;
+
+	if(DMA1->IFCR)
+	{
+		DMA1->ISR&=~DMA1->IFCR;
+		DMA1->IFCR=0;
+	}
+	if((DMA1_Channel4->CCR&DMA_CCR4_EN)==0||(DMA1->ISR&DMA_ISR_TCIF4))return;
+	HOST_CHECK(USART1->CR3&USART_DMAReq_Tx);
+	n=DMA1_Channel4->CNDTR;
+	if(n>DMA_BYTES)n=DMA_BYTES;
+	p=(u8 *)(uintptr_t)DMA1_Channel4->CMAR;
+	memcpy(rx+rx_len,p,n);
+	rx_len+=n;
+	DMA1_Channel4->CMAR+=n;
+	DMA1_Channel4->CNDTR-=n;
+	if(DMA1_Channel4->CNDTR==0)
+	{
+		DMA1->ISR|=DMA_ISR_TCIF4|DMA_ISR_GIF4;
+		USART1->SR|=USART_FLAG_TC;
+	}
+}
+
+static u16 Get16(const u8 *p)
+{
+	return p[0]|(p[1]<<8);
+}
+
+//按tools/lcdshot.py的格式解码,返回0表示格式错误
+static u8 Decode(void)
+{
+	const u8 *p=rx,*end=rx+rx_len;
+	u32 sum=0;
+	u16 w,h,x,y,n,c;
+
+	if(rx_len<14||p[0]!='L'||p[1]!='S'||p[2]!=1)return 0;
+	w=Get16(p+4);
+	h=Get16(p+6);
+	if(w!=EMU_W||h!=EMU_H)return 0;
+	p+=8;
+	for(y=0;y<h;y++)
+	{
+		x=0;
+		while(x<w)
+		{
+			if(p>=end)return 0;
+			n=(*p&0x7f)+1;
+			if(x+n>w)return 0;		//游程不跨行
+			if(*p++&0x80)
+			{
+				c=Get16(p);
+				p+=2;
+				while(n--){scr[y][x++]=c;sum+=c;}
+			}
+			else
+			{
+				while(n--){c=Get16(p);p+=2;scr[y][x++]=c;sum+=c;}
+			}
+		}
+	}
+	if(end-p!=6||p[0]!='E'||p[1]!='S')return 0;
+	return Get16(p+2)==(sum&0xffff)&&Get16(p+4)==(sum>>16);
+}
+
+static void Draw(void)
+{
+	u16 i;
+
+	LCD_Clear(WHITE);
+	LCD_Fill(20,20,299,99,BLUE);
+	for(i=0;i<EMU_H;i+=3)LCD_DrawLine_Color(0,i,i*2/3,EMU_H-1-i,i*97);	//不规则的内容
+	for(i=0;i<EMU_W;i++)LCD_DrawFRONT_COLOR(i,300,i*211);				//整行都是不重复的像素
+	FRONT_COLOR=BLACK;
+	BACK_COLOR=WHITE;
+	LCD_ShowString(10,200,300,24,24,(u8 *)"SHOT 0123456789");
+}
+
+//一次截屏,返回LCD_Shot_Poll的调用次数
+static u32 Shot(void)
+{
+	u32 polls=0,rows;
+
+	rx_len=0;
+	HOST_CHECK(LCD_Shot_Start()==1);
+	HOST_CHECK(LCD_Shot_Start()==0);	//发送完之前不能再开始
+	HOST_CHECK(LCD_Shot_Busy());
+	HOST_CHECK(USART1_TX_MUTE==1);
+	while(polls<100000)
+	{
+		Emu_Clear_Count();
+		polls++;
+		if(LCD_Shot_Poll()==0)break;
+		rows=emu.n.read/(EMU_W*2+1);
+		HOST_CHECK(rows<=LCD_SHOT_ROWS);
+		Dma_Step();
+	}
+	HOST_CHECK(!LCD_Shot_Busy());
+	HOST_CHECK(USART1_TX_MUTE==0);
+	HOST_CHECK(rx_len==LCD_Shot_Bytes());
+	HOST_CHECK(Decode());
+	HOST_CHECK(memcmp(scr,emu.gram,sizeof scr)==0);
+	return polls;
+}
+
+int main(void)
+{
+	u32 polls;
+
+	Emu_Reset();
+	TFTLCD_Init();
+	Draw();
+	polls=Shot();
+	printf("shot: %u bytes (raw %u), %u polls, %.2f s at 115200\n",rx_len,EMU_W*EMU_H*2,polls,polls*POLL_MS/1000.0);
+	LCD_Clear(RED);
+	polls=Shot();
+	printf("shot: %u bytes (solid), %u polls\n",rx_len,polls);
+	return Host_Result("t_shot");
+}
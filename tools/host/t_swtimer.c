@@ -0,0 +1,261 @@
+#include "host.h"
+#include "swtimer.h"
+#include <stdio.h>
+#include <string.h>
+
+//软件定时器测试:虚拟时间按毫秒或按SwTimer_Next跳着前进,调用SwTimer_Poll
+//1.远近不同的单次定时器,经过各层的重新分配后准时到期,按SwTimer_Next睡眠不会错过
+//2.周期定时器不漂移,落后超过一个周期时不补调用
+//3.停止、重新启动、回调中停止同一毫秒到期的其他定时器
+//4.随机启动停止,与参考模型比较每个定时器的调用次数和SwTimer_Next,时间跨过32位毫秒回绕
+
+#define NT		16			//随机测试的定时器数
+
+static _swtimer tm[NT];
+static u32 fires[NT];			//调用次数
+static u32 fire_ms[NT];			//最后一次调用的时间
+
+//参考模型
+typedef struct
+{
+	u8 active;
+	u32 expire;
+	u32 period;
+	u32 fires;
+}_model;
+
+static _model model[NT];
+static u32 rnd=12345;
+
+
+static u32 Rand(u32 n)
+{
+	rnd=rnd*1103515245+12345;
+	return (rnd>>8)%n;
+}
+
+static void Fire(u8 i)
+{
+	fires[i]++;
+	fire_ms[i]=SysTick_Ms();
+}
+
+#define CB(n)	static void Cb##n(void){Fire(n);}
+CB(0) CB(1) CB(2) CB(3) CB(4) CB(5) CB(6) CB(7)
+CB(8) CB(9) CB(10) CB(11) CB(12) CB(13) CB(14) CB(15)
+
+static void (*const cb[NT])(void)=
+{
+	Cb0,Cb1,Cb2,Cb3,Cb4,Cb5,Cb6,Cb7,Cb8,Cb9,Cb10,Cb11,Cb12,Cb13,Cb14,Cb15
+};
+
+//回调中停止定时器1
+static void Cb_Stop1(void)
+{
+	Fire(0);
+	SwTimer_Stop(&tm[1]);
+}
+
+//从ms毫秒(32位计数)开始,清空时间轮
+static void Reset(u32 ms)
+{
+	Host_Set_Us((u64)ms*1000);
+	SwTimer_Init();
+	memset(tm,0,sizeof tm);
+	memset(fires,0,sizeof fires);
+	memset(model,0,sizeof model);
+	SwTimer_Poll();
+}
+
+static void Step_Ms(u32 ms)
+{
+	Host_Advance_Us(ms*1000);
+	SwTimer_Poll();
+}
+
+
+//单次定时器,按SwTimer_Next前进,到期时间准确,每一步都有定时器到期或第0层转完一圈
+static void Test_Far(u32 start,u32 delay)
+{
+	u32 steps=0,next,idle=0;
+
+	Reset(start);
+	SwTimer_Start(&tm[0],delay,0,cb[0]);
+	HOST_CHECK(SwTimer_Active(&tm[0]));
+	while(fires[0]==0&&steps<(delay>>6)+1000)
+	{
+		next=SwTimer_Next();
+		HOST_CHECK(next>0&&next<=SWT_L0_SIZE);
+		Step_Ms(next);
+		if(fires[0]==0&&(SysTick_Ms()&(SWT_L0_SIZE-1))!=0)idle++;
+		steps++;
+	}
+	HOST_CHECK(fires[0]==1);
+	HOST_CHECK(fire_ms[0]==start+delay);
+	HOST_CHECK(idle==0);
+	HOST_CHECK(!SwTimer_Active(&tm[0]));
+	HOST_CHECK(SwTimer_Next()==0xFFFFFFFF);
+	if(fire_ms[0]!=start+delay)printf("delay %u from %u: fired at +%u\n",delay,start,fire_ms[0]-start);
+}
+
+static void Test_Levels(void)
+{
+	static const u32 delay[]=
+	{
+		1,2,255,256,257,511,512,1000,16383,16384,16385,65535,65536,
+		(1<<20)-1,1<<20,(1<<20)+1,(1<<24)+3
+	};
+	static const u32 start[]={0,1,255,256,0x12345678,0xFFFFFF00,0xFFFFFFFF};
+	u8 i,j;
+
+	for(j=0;j<sizeof start/sizeof start[0];j++)
+		for(i=0;i<sizeof delay/sizeof delay[0];i++)Test_Far(start[j],delay[i]);
+	Test_Far(0xFFFFFF00,(1<<26)+12345);		//最上层,SwTimer_Poll逐毫秒处理比较慢,只测一次
+}
+
+//周期定时器:每次轮询晚0~5ms,调用时间仍在原来的格点上;停顿100ms后只调用一次,之后从当时开始计
+static void Test_Period(void)
+{
+	u32 t0=5000,i,late=0,stall;
+
+	Reset(t0);
+	SwTimer_Start(&tm[0],7,7,cb[0]);
+	for(i=0;i<7000;i++)
+	{
+		Step_Ms(1+(Rand(8)==0?Rand(6):0));
+		if(fires[0]&&(fire_ms[0]-t0)%7>late)late=(fire_ms[0]-t0)%7;
+	}
+	HOST_CHECK(late<=5);
+	HOST_CHECK(fires[0]==(SysTick_Ms()-t0)/7);
+
+	i=fires[0];
+	stall=SysTick_Ms();
+	Step_Ms(100);
+	HOST_CHECK(fires[0]==i+1);
+	HOST_CHECK(SwTimer_Next()==7);
+	Step_Ms(6);
+	HOST_CHECK(fires[0]==i+1);
+	Step_Ms(1);
+	HOST_CHECK(fires[0]==i+2&&fire_ms[0]==stall+107);
+	SwTimer_Stop(&tm[0]);
+}
+
+//停止和重新启动
+static void Test_Stop(void)
+{
+	Reset(100);
+	SwTimer_Start(&tm[0],50,0,cb[0]);
+	SwTimer_Start(&tm[1],300,0,cb[1]);
+	SwTimer_Start(&tm[2],20000,0,cb[2]);
+	SwTimer_Stop(&tm[1]);
+	SwTimer_Stop(&tm[1]);			//停止两次没有影响
+	HOST_CHECK(!SwTimer_Active(&tm[1]));
+	Step_Ms(40);
+	SwTimer_Start(&tm[0],50,0,cb[0]);	//运行中重新启动,重新计时
+	Step_Ms(49);
+	HOST_CHECK(fires[0]==0);
+	Step_Ms(1);
+	HOST_CHECK(fires[0]==1&&fire_ms[0]==190);
+	Step_Ms(1000);
+	HOST_CHECK(fires[1]==0);
+	SwTimer_Stop(&tm[2]);			//上层中的定时器也能停止
+	HOST_CHECK(SwTimer_Next()==0xFFFFFFFF);
+	Step_Ms(30000);
+	HOST_CHECK(fires[2]==0);
+
+	//同一毫秒到期,先调用的回调停止另一个;先放入的在链表后面,后调用
+	Reset(0);
+	SwTimer_Start(&tm[1],10,0,cb[1]);
+	SwTimer_Start(&tm[0],10,0,Cb_Stop1);
+	Step_Ms(10);
+	HOST_CHECK(fires[0]==1&&fires[1]==0);
+}
+
+
+//参考模型的一次轮询:每个到期的定时器调用一次,周期定时器落后超过一个周期时从现在开始计
+static void Model_Poll(u32 now)
+{
+	u8 i;
+	_model *m;
+
+	for(i=0;i<NT;i++)
+	{
+		m=&model[i];
+		if(!m->active||(s32)(now-m->expire)<0)continue;
+		m->fires++;
+		if(m->period==0)
+		{
+			m->active=0;
+			continue;
+		}
+		m->expire+=m->period;
+		if((s32)(m->expire-now)<=0)m->expire=now+m->period;
+	}
+}
+
+//SwTimer_Next最多看到第0层这一圈结束
+static u32 Model_Next(u32 now)
+{
+	u32 next=0xFFFFFFFF,lap;
+	u8 i;
+
+	for(i=0;i<NT;i++)
+		if(model[i].active&&model[i].expire-now<next)next=model[i].expire-now;
+	if(next==0xFFFFFFFF)return next;
+	lap=(now|(SWT_L0_SIZE-1))+1;		//now之后第一个整圈
+	return next<lap-now?next:lap-now;
+}
+
+//周期定时器落后时模型里的调用次数与轮询间隔有关,这里只让它在每毫秒轮询的时候落后不到一个周期
+static void Test_Random(u32 start,u32 ops)
+{
+	u32 i,now,ms,bad=0,next_bad=0;
+	u8 k;
+
+	Reset(start);
+	for(i=0;i<ops;i++)
+	{
+		k=Rand(NT);
+		switch(Rand(4))
+		{
+		case 0:
+		case 1:
+			ms=1+(Rand(3)==0?Rand(1<<Rand(24)):Rand(300));	//0ms要到下一毫秒轮询才调用,模型不考虑
+			model[k].period=Rand(2)?Rand(2000)+1:0;
+			model[k].expire=SysTick_Ms()+ms;
+			model[k].active=1;
+			SwTimer_Start(&tm[k],ms,model[k].period,cb[k]);
+			break;
+		case 2:
+			model[k].active=0;
+			SwTimer_Stop(&tm[k]);
+			break;
+		default:
+			ms=Rand(10)==0?Rand(70000):Rand(300);	//偶尔很久不轮询
+			Host_Advance_Us(ms*1000);
+			now=SysTick_Ms();
+			SwTimer_Poll();
+			Model_Poll(now);
+			break;
+		}
+		for(k=0;k<NT;k++)
+		{
+			if(fires[k]!=model[k].fires||SwTimer_Active(&tm[k])!=model[k].active)bad++;
+			fires[k]=model[k].fires;	//只报告第一次不同
+		}
+		if(SwTimer_Next()!=Model_Next(SysTick_Ms()))next_bad++;
+	}
+	printf("random from %u: %u ops to %u, %u mismatch, %u next mismatch\n",start,ops,SysTick_Ms(),bad,next_bad);
+	HOST_CHECK(bad==0);
+	HOST_CHECK(next_bad==0);
+}
+
+int main(void)
+{
+	Test_Levels();
+	Test_Period();
+	Test_Stop();
+	Test_Random(0,200000);
+	Test_Random(0xFFFFFFFF-3000000,200000);		//跨过32位毫秒回绕
+	return Host_Result("t_swtimer");
+}
@@ -0,0 +1,214 @@
+#!/usr/bin/env python3
+# -*- coding: utf-8 -*-
+"""RGB565 图片压缩工具, 生成 LCD_ShowImage() 使用的数组.
+
+输入可以是:
+  *.h / *.c   Image2Lcd 生成的 C 数组(RGB565, 低字节在前), 文件中所有数组
+              都会被压缩, 数组以外的内容(#if 等)原样保留, 已压缩的数组跳过
+  *.bin       RGB565 原始数据(低字节在前), 需用 -W/-H 指定宽高
+  其它        png/bmp/jpg 等, 需要安装 Pillow
+
+压缩格式(与 APP/tftlcd/lcd_image.c 对应):
+  头 8 字节: 'L' 'I' 版本(1) 保留(0) 宽(16位,低字节在前) 高(16位,低字节在前)
+  之后按行扫描逐个像素编码, prev 为前一个像素(初值 0), index 为 64 项颜色表:
+  00iiiiii             index[i]
+  01rrggbb             与 prev 的 r/g/b 差值各 -2..1
+  10gggggg rrrrbbbb    g 差值 -32..31, r/b 差值减去 floor(g差值/2) 后 -8..7
+  11nnnnnn             重复 prev n+1 次, n 为 0..61
+  0xFE hi lo           直接给出颜色
+  除重复外, 每个像素都写入 index[(r*3+g*5+b*7)%64]
+
+每次转换都会解码一遍并与原图逐像素比较, 并打印压缩率和解码速度.
+
+用法:
+  python tools/lcdimg.py APP/snake/picture.h -o APP/snake/picture.h
+  python tools/lcdimg.py logo.png -n gImage_logo -o logo.h
+"""
+
+import argparse
+import re
+import sys
+import time
+
+MAGIC = b'LI'
+VERSION = 1
+OP_RGB = 0xFE
+MAX_RUN = 62
+
+
+def split565(c):
+    return c >> 11, (c >> 5) & 0x3f, c & 0x1f
+
+
+def color_hash(c):
+    r, g, b = split565(c)
+    return (r * 3 + g * 5 + b * 7) & 0x3f
+
+
+def encode(pixels, width, height):
+    out = bytearray(MAGIC)
+    out += bytes([VERSION, 0, width & 0xff, width >> 8, height & 0xff, height >> 8])
+    index = [0] * 64
+    prev = 0
+    run = 0
+    for c in pixels:
+        if c == prev:
+            run += 1
+            if run == MAX_RUN:
+                out.append(0xc0 | (run - 1))
+                run = 0
+            continue
+        if run:
+            out.append(0xc0 | (run - 1))
+            run = 0
+        h = color_hash(c)
+        if index[h] == c:
+            out.append(h)
+        else:
+            index[h] = c
+            pr, pg, pb = split565(prev)
+            r, g, b = split565(c)
+            dr, dg, db = r - pr, g - pg, b - pb
+            if -2 <= dr <= 1 and -2 <= dg <= 1 and -2 <= db <= 1:
+                out.append(0x40 | (dr + 2) << 4 | (dg + 2) << 2 | (db + 2))
+            elif -32 <= dg <= 31 and -8 <= dr - dg // 2 <= 7 and -8 <= db - dg // 2 <= 7:
+                out.append(0x80 | (dg + 32))
+                out.append((dr - dg // 2 + 8) << 4 | (db - dg // 2 + 8))
+            else:
+                out += bytes([OP_RGB, c >> 8, c & 0xff])
+        prev = c
+    if run:
+        out.append(0xc0 | (run - 1))
+    return bytes(out)
+
+
+def decode(data):
+    if data[:2] != MAGIC or data[2] != VERSION:
+        raise ValueError('not an lcdimg stream')
+    width = data[4] | data[5] << 8
+    height = data[6] | data[7] << 8
+    total = width * height
+    pixels = []
+    index = [0] * 64
+    prev = 0
+    p = 8
+    while len(pixels) < total:
+        b = data[p]
+        p += 1
+        if b == OP_RGB:
+            c = data[p] << 8 | data[p + 1]
+            p += 2
+        elif b >> 6 == 3:
+            pixels.extend([prev] * ((b & 0x3f) + 1))
+            continue
+        elif b >> 6 == 0:
+            c = index[b]
+        else:
+            pr, pg, pb = split565(prev)
+            if b >> 6 == 1:
+                r = pr + ((b >> 4) & 3) - 2
+                g = pg + ((b >> 2) & 3) - 2
+                bl = pb + (b & 3) - 2
+            else:
+                dg = (b & 0x3f) - 32
+                b2 = data[p]
+                p += 1
+                r = pr + (b2 >> 4) - 8 + dg // 2
+                g = pg + dg
+                bl = pb + (b2 & 0x0f) - 8 + dg // 2
+            c = (r & 0x1f) << 11 | (g & 0x3f) << 5 | (bl & 0x1f)
+        index[color_hash(c)] = c
+        pixels.append(c)
+        prev = c
+    return width, height, pixels[:total]
+
+
+def c_array(name, data, comment):
+    lines = ['const unsigned char %s[%d] = { /* %s */' % (name, len(data), comment)]
+    for i in range(0, len(data), 16):
+        lines.append(''.join('0X%02X,' % x for x in data[i:i + 16]))
+    lines.append('};')
+    return '\n'.join(lines)
+
+
+def convert(name, pixels, width, height):
+    raw = width * height * 2
+    data = encode(pixels, width, height)
+    t = time.perf_counter()
+    w, h, back = decode(data)
+    t = time.perf_counter() - t
+    if (w, h) != (width, height) or back != list(pixels):
+        raise SystemExit('%s: round-trip mismatch' % name)
+    sys.stderr.write('%s: %dx%d %d -> %d bytes, %.2fx, decode %.2f Mpixel/s (python)\n'
+                     % (name, width, height, raw, len(data), raw / len(data), w * h / t / 1e6))
+    return c_array(name, data, 'lcdimg %dx%d %d->%d' % (width, height, raw, len(data)))
+
+
+def bytes_to_pixels(b):
+    return [b[i] | b[i + 1] << 8 for i in range(0, len(b) - 1, 2)]
+
+
+ARRAY_RE = re.compile(r'const\s+unsigned\s+char\s+(\w+)\s*\[\s*\d*\s*\]\s*=\s*\{(.*?)\};', re.S)
+
+
+def convert_source(text, args):
+    def repl(m):
+        name, body = m.group(1), m.group(2)
+        head = re.match(r'\s*/\*(.*?)\*/', body, re.S)
+        values = bytes(int(x, 16) for x in re.findall(r'0[xX][0-9a-fA-F]+', re.sub(r'/\*.*?\*/', '', body, flags=re.S)))
+        if values[:2] == MAGIC:
+            sys.stderr.write('%s: already compressed, skipped\n' % name)
+            return m.group(0)
+        width, height = args.width, args.height
+        if head and not (width and height):
+            # Image2Lcd 头: 扫描方式, 灰度, 宽(低,高), 高(低,高), ...
+            h = [int(x, 16) for x in re.findall(r'0[xX][0-9a-fA-F]+', head.group(1))]
+            if len(h) >= 6:
+                width, height = h[2] | h[3] << 8, h[4] | h[5] << 8
+        if not (width and height) or width * height * 2 != len(values):
+            raise SystemExit('%s: cannot determine size, use -W/-H' % name)
+        return convert(name, bytes_to_pixels(values), width, height)
+    return ARRAY_RE.sub(repl, text)
+
+
+def load_image(path):
+    try:
+        from PIL import Image
+    except ImportError:
+        raise SystemExit('Pillow is required to read %s' % path)
+    img = Image.open(path).convert('RGB')
+    pixels = [(r >> 3) << 11 | (g >> 2) << 5 | (b >> 3) for r, g, b in img.getdata()]
+    return pixels, img.width, img.height
+
+
+def main():
+    ap = argparse.ArgumentParser(description='RGB565 image compressor for LCD_ShowImage()')
+    ap.add_argument('input')
+    ap.add_argument('-o', '--output', help='output file (default: stdout)')
+    ap.add_argument('-n', '--name', default='gImage_picture', help='array name for .bin/image input')
+    ap.add_argument('-W', '--width', type=int)
+    ap.add_argument('-H', '--height', type=int)
+    args = ap.parse_args()
+
+    ext = args.input.rsplit('.', 1)[-1].lower()
+    if ext in ('h', 'c'):
+        with open(args.input, encoding='latin-1') as f:
+            text = convert_source(f.read(), args)
+    elif ext == 'bin':
+        if not (args.width and args.height):
+            raise SystemExit('-W/-H required for raw input')
+        with open(args.input, 'rb') as f:
+            text = convert(args.name, bytes_to_pixels(f.read()), args.width, args.height) + '\n'
+    else:
+        pixels, width, height = load_image(args.input)
+        text = convert(args.name, pixels, width, height) + '\n'
+
+    if args.output:
+        with open(args.output, 'w', encoding='latin-1', newline='') as f:
+            f.write(text)
+    else:
+        sys.stdout.write(text)
+
+
+if __name__ == '__main__':
+    main()
@@ -0,0 +1,155 @@
+#!/usr/bin/env python3
+# -*- coding: utf-8 -*-
+"""LCD 截屏接收/解码工具, 生成 PNG.
+
+数据来源:
+  -p COM3       打开串口1, 发送 "SHOT\\r\\n" 后接收设备返回的截屏数据,
+                需要安装 pyserial; 蓝牙发送 SHOT 命令时数据同样从串口1输出
+  file.bin      已保存的截屏数据
+
+数据格式(与 APP/tftlcd/lcd_shot.c 对应), 多字节数均为低字节在前:
+  头 8 字节: 'L' 'S' 版本(1) 保留(0) 宽(16位) 高(16位)
+  之后按行编码, 游程不跨行:
+  0nnnnnnn             后面跟 n+1 个像素, 每个像素 2 字节
+  1nnnnnnn             后面 1 个像素重复 n+1 次
+  尾 6 字节: 'E' 'S' 全部像素值之和(32位)
+
+用法:
+  python tools/lcdshot.py -p COM3 -o shot.png
+  python tools/lcdshot.py shot.bin -o shot.png
+"""
+
+import argparse
+import struct
+import sys
+import time
+import zlib
+
+MAGIC = b'LS'
+VERSION = 1
+TRAILER = b'ES'
+
+
+class ShotError(Exception):
+    pass
+
+
+class Reader:
+    """按需取字节, 数据可以来自文件或串口"""
+
+    def __init__(self, read):
+        self.read_fn = read
+        self.count = 0
+
+    def take(self, n):
+        out = bytearray()
+        while len(out) < n:
+            b = self.read_fn(n - len(out))
+            if not b:
+                raise ShotError('data ends after %d bytes' % (self.count + len(out)))
+            out += b
+        self.count += n
+        return bytes(out)
+
+
+def decode(reader):
+    head = reader.take(8)
+    if head[:2] != MAGIC or head[2] != VERSION:
+        raise ShotError('bad header %r' % head)
+    width, height = struct.unpack('<HH', head[4:8])
+    pixels = []
+    for _ in range(height):
+        row = 0
+        while row < width:
+            op = reader.take(1)[0]
+            n = (op & 0x7f) + 1
+            if row + n > width:
+                raise ShotError('run crosses row end')
+            if op & 0x80:
+                pixels.extend(struct.unpack('<H', reader.take(2)) * n)
+            else:
+                pixels.extend(struct.unpack('<%dH' % n, reader.take(2 * n)))
+            row += n
+    tail = reader.take(6)
+    if tail[:2] != TRAILER:
+        raise ShotError('bad trailer %r' % tail)
+    if struct.unpack('<I', tail[2:])[0] != sum(pixels) & 0xffffffff:
+        raise ShotError('checksum mismatch')
+    return pixels, width, height
+
+
+def png(pixels, width, height):
+    raw = bytearray()
+    for y in range(height):
+        raw.append(0)
+        for c in pixels[y * width:(y + 1) * width]:
+            r, g, b = c >> 11, (c >> 5) & 0x3f, c & 0x1f
+            raw += bytes([(r << 3) | (r >> 2), (g << 2) | (g >> 4), (b << 3) | (b >> 2)])
+
+    def chunk(tag, data):
+        return struct.pack('>I', len(data)) + tag + data + struct.pack('>I', zlib.crc32(tag + data))
+
+    return (b'\x89PNG\r\n\x1a\n' +
+            chunk(b'IHDR', struct.pack('>IIBBBBB', width, height, 8, 2, 0, 0, 0)) +
+            chunk(b'IDAT', zlib.compress(bytes(raw), 9)) +
+            chunk(b'IEND', b''))
+
+
+def main():
+    ap = argparse.ArgumentParser(description='LCD screenshot decoder')
+    ap.add_argument('input', nargs='?', help='saved screenshot data')
+    ap.add_argument('-p', '--port', help='serial port of USART1')
+    ap.add_argument('-b', '--baud', type=int, default=115200)
+    ap.add_argument('-o', '--output', default='shot.png')
+    ap.add_argument('--save', help='also save the raw data')
+    args = ap.parse_args()
+
+    t = time.time()
+    if args.port:
+        import serial
+        ser = serial.Serial(args.port, args.baud, timeout=5)
+        ser.reset_input_buffer()
+        ser.write(b'SHOT\r\n')
+        # 跳过截屏数据之前的调试输出
+        buf = b''
+        while not buf.endswith(MAGIC):
+            b = ser.read(1)
+            if not b:
+                raise SystemExit('no response')
+            buf = (buf + b)[-2:]
+        first = [MAGIC]
+
+        def read(n):
+            if first:
+                return first.pop()
+            return ser.read(n)
+        reader = Reader(read)
+    elif args.input:
+        f = open(args.input, 'rb')
+        reader = Reader(f.read)
+    else:
+        raise SystemExit('input file or -p required')
+
+    raw = bytearray()
+    read_fn = reader.read_fn
+
+    def keep(n):
+        b = read_fn(n)
+        raw.extend(b)
+        return b
+    reader.read_fn = keep
+
+    pixels, width, height = decode(reader)
+    t = time.time() - t
+    with open(args.output, 'wb') as f:
+        f.write(png(pixels, width, height))
+    if args.save:
+        with open(args.save, 'wb') as f:
+            f.write(raw)
+    sys.stderr.write('%dx%d, %d bytes (%.1f%% of raw), %.2f s -> %s\n' %
+                     (width, height, reader.count, 100.0 * reader.count / (width * height * 2),
+                      t, args.output))
+
+
+if __name__ == '__main__':
+    main()